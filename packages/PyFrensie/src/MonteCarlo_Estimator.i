@@ -33,6 +33,7 @@
 #include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
 #include "MonteCarlo_CellCollisionFluxEstimator.hpp"
 #include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_DenseMeshTrackLengthFluxEstimator.hpp"
 
 #include "MonteCarlo_ParticleResponse.hpp"
 using namespace MonteCarlo;
@@ -473,6 +474,18 @@ typedef long unsigned int uint64_t;
 // The multiplied cell collision flux estimators
 %post_estimator_setup_helper( MeshTrackLengthFluxEstimator )
 
+//---------------------------------------------------------------------------//
+// Add DenseMeshTrackLengthFluxEstimator support
+//---------------------------------------------------------------------------//
+
+// The multiplied dense mesh track-length flux estimators
+%pre_estimator_setup_helper( DenseMeshTrackLengthFluxEstimator )
+
+%include "MonteCarlo_DenseMeshTrackLengthFluxEstimator.hpp"
+
+// The multiplied dense mesh track-length flux estimators
+%post_estimator_setup_helper( DenseMeshTrackLengthFluxEstimator )
+
 //---------------------------------------------------------------------------//
 // end MonteCarlo_Estimator.i
 //---------------------------------------------------------------------------//
@@ -152,6 +152,12 @@ using namespace MonteCarlo;
 
 %template(addEstimator) MonteCarlo::EventHandler::addEstimator<MonteCarlo::MeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> >;
 
+%template(addEstimator) MonteCarlo::EventHandler::addEstimator<MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> >;
+
+%template(addEstimator) MonteCarlo::EventHandler::addEstimator<MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> >;
+
+%template(addEstimator) MonteCarlo::EventHandler::addEstimator<MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> >;
+
 %template(addEstimator) MonteCarlo::EventHandler::addEstimator<MonteCarlo::CellPulseHeightEstimator<MonteCarlo::WeightAndChargeMultiplier> >;
 
 %template(addEstimator) MonteCarlo::EventHandler::addEstimator<MonteCarlo::CellPulseHeightEstimator<MonteCarlo::WeightAndEnergyMultiplier> >;
@@ -19,6 +19,9 @@
 #include "MonteCarlo_BremsstrahlungAngularDistributionType.hpp"
 #include "MonteCarlo_ElectroionizationSamplingType.hpp"
 #include "MonteCarlo_ElasticElectronDistributionType.hpp"
+#include "MonteCarlo_UnionizedEnergyGridMode.hpp"
+#include "MonteCarlo_HistoryScheduleType.hpp"
+#include "MonteCarlo_DistributedBatchScheduleType.hpp"
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "MonteCarlo_SimulationNeutronProperties.hpp"
 #include "MonteCarlo_SimulationPhotonProperties.hpp"
@@ -113,6 +116,15 @@ using namespace MonteCarlo;
 // Import the ElasticElectronDistributionType
 %include "MonteCarlo_ElasticElectronDistributionType.hpp"
 
+// Import the UnionizedEnergyGridMode
+%include "MonteCarlo_UnionizedEnergyGridMode.hpp"
+
+// Import the HistoryScheduleType
+%include "MonteCarlo_HistoryScheduleType.hpp"
+
+// Import the DistributedBatchScheduleType
+%include "MonteCarlo_DistributedBatchScheduleType.hpp"
+
 //---------------------------------------------------------------------------//
 // Add support for the SimulationGeneralProperties
 //---------------------------------------------------------------------------//
@@ -52,6 +52,77 @@ MonteCarlo::PROPERTIES::setImplicitCaptureModeOn;
 %feature("autodoc", "isImplicitCaptureModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isImplicitCaptureModeOn;
 
+// Set arena particle bank mode on/off
+%feature("autodoc", "setArenaParticleBankModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setArenaParticleBankModeOn;
+
+%feature("autodoc", "setStandardParticleBankModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setStandardParticleBankModeOn;
+
+%feature("autodoc", "isArenaParticleBankModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isArenaParticleBankModeOn;
+
+// Set/get the unionized energy grid mode
+%feature("autodoc", "setUnionizedEnergyGridMode(PROPERTIES self, const MonteCarlo::UnionizedEnergyGridMode mode) -> void")
+MonteCarlo::PROPERTIES::setUnionizedEnergyGridMode;
+
+%feature("autodoc", "getUnionizedEnergyGridMode(PROPERTIES self) -> MonteCarlo::UnionizedEnergyGridMode")
+MonteCarlo::PROPERTIES::getUnionizedEnergyGridMode;
+
+// Set/get the history schedule type
+%feature("autodoc", "setHistoryScheduleType(PROPERTIES self, const MonteCarlo::HistoryScheduleType type) -> void")
+MonteCarlo::PROPERTIES::setHistoryScheduleType;
+
+%feature("autodoc", "getHistoryScheduleType(PROPERTIES self) -> MonteCarlo::HistoryScheduleType")
+MonteCarlo::PROPERTIES::getHistoryScheduleType;
+
+// Set/get the history schedule chunk size
+%feature("autodoc", "setHistoryScheduleChunkSize(PROPERTIES self, const unsigned chunk_size) -> void")
+MonteCarlo::PROPERTIES::setHistoryScheduleChunkSize;
+
+%feature("autodoc", "getHistoryScheduleChunkSize(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getHistoryScheduleChunkSize;
+
+// Set/get the transport mode
+%feature("autodoc", "setEventBasedTransportModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setEventBasedTransportModeOn;
+
+%feature("autodoc", "setHistoryBasedTransportModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setHistoryBasedTransportModeOn;
+
+%feature("autodoc", "isEventBasedTransportModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isEventBasedTransportModeOn;
+
+// Set/get the tracking mode
+%feature("autodoc", "setDeltaTrackingModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setDeltaTrackingModeOn;
+
+%feature("autodoc", "setSurfaceTrackingModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setSurfaceTrackingModeOn;
+
+%feature("autodoc", "isDeltaTrackingModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isDeltaTrackingModeOn;
+
+// Set/get the estimator moment accumulation mode
+%feature("autodoc", "setThreadPrivateMomentAccumulationModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setThreadPrivateMomentAccumulationModeOn;
+
+%feature("autodoc", "setSharedMomentAccumulationModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setSharedMomentAccumulationModeOn;
+
+%feature("autodoc", "isThreadPrivateMomentAccumulationModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isThreadPrivateMomentAccumulationModeOn;
+
+// Set/get the random number generator mode
+%feature("autodoc", "setCounterBasedRandomNumberGeneratorModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setCounterBasedRandomNumberGeneratorModeOn;
+
+%feature("autodoc", "setLinearCongruentialRandomNumberGeneratorModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setLinearCongruentialRandomNumberGeneratorModeOn;
+
+%feature("autodoc", "isCounterBasedRandomNumberGeneratorModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isCounterBasedRandomNumberGeneratorModeOn;
+
 // Set/get max energy
 %feature("autodoc", "setNumberOfBatchesPerProcessor(PROPERTIES self, const unsigned batches_per_processor) -> void")
 MonteCarlo::PROPERTIES::setNumberOfBatchesPerProcessor;
@@ -59,6 +130,13 @@ MonteCarlo::PROPERTIES::setNumberOfBatchesPerProcessor;
 %feature("autodoc", "getNumberOfBatchesPerProcessor(PROPERTIES self) -> unsigned")
 MonteCarlo::PROPERTIES::getNumberOfBatchesPerProcessor;
 
+// Set/get the distributed batch schedule type
+%feature("autodoc", "setDistributedBatchScheduleType(PROPERTIES self, const MonteCarlo::DistributedBatchScheduleType type) -> void")
+MonteCarlo::PROPERTIES::setDistributedBatchScheduleType;
+
+%feature("autodoc", "getDistributedBatchScheduleType(PROPERTIES self) -> MonteCarlo::DistributedBatchScheduleType")
+MonteCarlo::PROPERTIES::getDistributedBatchScheduleType;
+
 
 %enddef
 
@@ -126,6 +204,13 @@ MonteCarlo::PROPERTIES::setFreeGasThreshold;
 %feature("autodoc", "getFreeGasThreshold(PROPERTIES self) -> double")
 MonteCarlo::PROPERTIES::getFreeGasThreshold;
 
+// Set/get the max on-the-fly Doppler broadening energy
+%feature("autodoc", "setMaxDopplerBroadeningEnergy(PROPERTIES self, const double energy) -> void")
+MonteCarlo::PROPERTIES::setMaxDopplerBroadeningEnergy;
+
+%feature("autodoc", "getMaxDopplerBroadeningEnergy(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getMaxDopplerBroadeningEnergy;
+
 // Set unresolved resonance probability table mode On/Off
 %feature("autodoc", "setUnresolvedResonanceProbabilityTableModeOn(PROPERTIES self) -> void")
 MonteCarlo::PROPERTIES::setUnresolvedResonanceProbabilityTableModeOn;
@@ -136,6 +221,36 @@ MonteCarlo::PROPERTIES::setUnresolvedResonanceProbabilityTableModeOff;
 %feature("autodoc", "isUnresolvedResonanceProbabilityTableModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isUnresolvedResonanceProbabilityTableModeOn;
 
+// Set power iteration/fixed source mode On
+%feature("autodoc", "setPowerIterationModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setPowerIterationModeOn;
+
+%feature("autodoc", "setFixedSourceModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setFixedSourceModeOn;
+
+%feature("autodoc", "isPowerIterationModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isPowerIterationModeOn;
+
+// Set/get the number of neutrons per power iteration cycle
+%feature("autodoc", "setNumberOfNeutronsPerCycle(PROPERTIES self, const uint64_t neutrons) -> void")
+MonteCarlo::PROPERTIES::setNumberOfNeutronsPerCycle;
+
+%feature("autodoc", "getNumberOfNeutronsPerCycle(PROPERTIES self) -> uint64_t")
+MonteCarlo::PROPERTIES::getNumberOfNeutronsPerCycle;
+
+// Set/get the number of inactive/active power iteration cycles
+%feature("autodoc", "setNumberOfInactiveCycles(PROPERTIES self, const unsigned cycles) -> void")
+MonteCarlo::PROPERTIES::setNumberOfInactiveCycles;
+
+%feature("autodoc", "getNumberOfInactiveCycles(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getNumberOfInactiveCycles;
+
+%feature("autodoc", "setNumberOfActiveCycles(PROPERTIES self, const unsigned cycles) -> void")
+MonteCarlo::PROPERTIES::setNumberOfActiveCycles;
+
+%feature("autodoc", "getNumberOfActiveCycles(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getNumberOfActiveCycles;
+
 %enddef
 
 //---------------------------------------------------------------------------//
@@ -289,6 +404,29 @@ MonteCarlo::PROPERTIES::setAtomicExcitationModeOff;
 %feature("autodoc", "isAtomicExcitationModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isAtomicExcitationModeOn;
 
+// Set Condensed History mode On/Off
+%feature("autodoc", "setCondensedHistoryModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryModeOn;
+
+%feature("autodoc", "setCondensedHistoryModeOff(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryModeOff;
+
+%feature("autodoc", "isCondensedHistoryModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isCondensedHistoryModeOn;
+
+// Set/get the condensed history step parameters
+%feature("autodoc", "setCondensedHistoryMaxEnergyLossFraction(PROPERTIES self, const double fraction) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryMaxEnergyLossFraction;
+
+%feature("autodoc", "getCondensedHistoryMaxEnergyLossFraction(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getCondensedHistoryMaxEnergyLossFraction;
+
+%feature("autodoc", "setCondensedHistoryBoundarySkinDepth(PROPERTIES self, const double skin_depth) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryBoundarySkinDepth;
+
+%feature("autodoc", "getCondensedHistoryBoundarySkinDepth(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getCondensedHistoryBoundarySkinDepth;
+
 // Set/get the critical line energies
 %feature("autodoc", "setCriticalAdjointElectronLineEnergies(PROPERTIES self, const std::vector<double>& critical_line_energies) -> void")
 MonteCarlo::PROPERTIES::setCriticalAdjointElectronLineEnergies;
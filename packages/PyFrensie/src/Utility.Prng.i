@@ -159,11 +159,35 @@ use the RandomNumberGenerator internally (e.g. the distribution classes in
 PyFrensie.Utility.Distribution).
 "
 
+%feature("docstring")
+Utility::RandomNumberGenerator::useCounterBasedGenerator
+"
+This method switches all random number streams to the counter-based (Philox)
+generator. The random numbers generated for a history will then only depend on
+the history number and the substream number. The streams must be created again
+(by calling 'createStreams') after switching generators.
+"
+
+%feature("docstring")
+Utility::RandomNumberGenerator::useLinearCongruentialGenerator
+"
+This method switches all random number streams to the linear congruential
+generator (default). The streams must be created again (by calling
+'createStreams') after switching generators.
+"
+
+%feature("docstring")
+Utility::RandomNumberGenerator::isCounterBasedGeneratorUsed
+"
+This method can be used to check if the counter-based generator is used.
+"
+
 %feature("docstring")
 Utility::RandomNumberGenerator::initialize
 "
 This method initializes the random number stream for desired particle history
-number (or history 0 if no history number is provided).
+number (or history 0 if no history number is provided). A substream number
+can also be provided when the counter-based generator is used.
 "
 
 %feature("docstring")
@@ -207,6 +231,9 @@ that the original random number stream state will be reset as well.
   $1 = (PyArray_Check($input) || PySequence_Check($input)) ? 1 : 0;
 }
 
+// The array fill method is not needed in Python
+%ignore Utility::RandomNumberGenerator::getRandomNumbers;
+
 // Include the RandomNumberGenerator
 %include "Utility_RandomNumberGenerator.hpp"
 
@@ -16,6 +16,7 @@
 #include "FRENSIE_Archives.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
 #include "Data_DataContainerHelpers.hpp"
+#include "Data_NativeMappedDataFileWriter.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -79,6 +80,160 @@ const char* ElectronPhotonRelaxationDataContainer::getArchiveName() const
   return s_archive_name.c_str();
 }
 
+// Save the data to a native mapped data file
+/*! \details The entries have the same names that are used in the other
+ * archive formats. Nested maps are stored as one indexed array entry per
+ * subshell (e.g. electroionization_recoil_energy/1). The relaxation vacancy
+ * pairs are stored consecutively. The data can be accessed without copying
+ * it with the Data::MappedElectronPhotonRelaxationDataContainer.
+ */
+void ElectronPhotonRelaxationDataContainer::saveToMappedFile(
+                         const boost::filesystem::path& file_name_with_path,
+                         const bool overwrite ) const
+{
+  NativeMappedDataFileWriter writer;
+
+  writer.addString( "notes", d_notes );
+
+  // Table data
+  writer.addValue( "atomic_number", d_atomic_number );
+  writer.addValue( "atomic_weight", d_atomic_weight );
+  writer.addValue( "min_photon_energy", d_min_photon_energy );
+  writer.addValue( "max_photon_energy", d_max_photon_energy );
+  writer.addValue( "min_electron_energy", d_min_electron_energy );
+  writer.addValue( "max_electron_energy", d_max_electron_energy );
+  writer.addValue( "occupation_number_evaluation_tolerance", d_occupation_number_evaluation_tolerance );
+  writer.addValue( "subshell_incoherent_evaluation_tolerance", d_subshell_incoherent_evaluation_tolerance );
+  writer.addValue( "photon_threshold_energy_nudge_factor", d_photon_threshold_energy_nudge_factor );
+  writer.addValue( "cutoff_angle_cosine", d_cutoff_angle_cosine );
+  writer.addValue( "number_of_moment_preserving_angles", d_number_of_moment_preserving_angles );
+  writer.addValue( "electron_tabular_evaluation_tol", d_electron_tabular_evaluation_tol );
+  writer.addValue( "photon_grid_convergence_tol", d_photon_grid_convergence_tol );
+  writer.addValue( "photon_grid_absolute_diff_tol", d_photon_grid_absolute_diff_tol );
+  writer.addValue( "photon_grid_distance_tol", d_photon_grid_distance_tol );
+  writer.addValue( "electron_grid_convergence_tol", d_electron_grid_convergence_tol );
+  writer.addValue( "electron_grid_absolute_diff_tol", d_electron_grid_absolute_diff_tol );
+  writer.addValue( "electron_grid_distance_tol", d_electron_grid_distance_tol );
+  writer.addValue( "bremsstrahlung_evaluation_tolerance", d_bremsstrahlung_evaluation_tolerance );
+  writer.addValue( "bremsstrahlung_convergence_tolerance", d_bremsstrahlung_convergence_tolerance );
+  writer.addValue( "bremsstrahlung_absolute_diff_tol", d_bremsstrahlung_absolute_diff_tol );
+  writer.addValue( "bremsstrahlung_distance_tol", d_bremsstrahlung_distance_tol );
+  writer.addValue( "electroionization_evaluation_tol", d_electroionization_evaluation_tol );
+  writer.addValue( "electroionization_convergence_tol", d_electroionization_convergence_tol );
+  writer.addValue( "electroionization_absolute_diff_tol", d_electroionization_absolute_diff_tol );
+  writer.addValue( "electroionization_distance_tol", d_electroionization_distance_tol );
+
+  // Relaxation data
+  writer.addArray( "subshells", d_subshells );
+  writer.addIndexedValues( "subshell_occupancies", d_subshell_occupancies );
+  writer.addIndexedValues( "subshell_binding_energies", d_subshell_binding_energies );
+  writer.addIndexedValues( "relaxation_transitions", d_relaxation_transitions );
+
+  {
+    std::map<unsigned,std::vector<unsigned> > flat_relaxation_vacancies;
+
+    for( auto&& vacancies : d_relaxation_vacancies )
+    {
+      std::vector<unsigned>& flat_vacancies =
+        flat_relaxation_vacancies[vacancies.first];
+
+      for( auto&& vacancy_pair : vacancies.second )
+      {
+        flat_vacancies.push_back( vacancy_pair.first );
+        flat_vacancies.push_back( vacancy_pair.second );
+      }
+    }
+
+    writer.addIndexedArrays( "relaxation_vacancies", flat_relaxation_vacancies );
+  }
+
+  writer.addIndexedArrays( "relaxation_particle_energies", d_relaxation_particle_energies );
+  writer.addIndexedArrays( "relaxation_probabilities", d_relaxation_probabilities );
+
+  // Photon data
+  writer.addIndexedArrays( "compton_profile_momentum_grids", d_compton_profile_momentum_grids );
+  writer.addIndexedArrays( "compton_profiles", d_compton_profiles );
+  writer.addIndexedArrays( "occupation_number_momentum_grids", d_occupation_number_momentum_grids );
+  writer.addIndexedArrays( "occupation_numbers", d_occupation_numbers );
+  writer.addArray( "waller_hartree_scattering_function_momentum_grid", d_waller_hartree_scattering_function_momentum_grid );
+  writer.addArray( "waller_hartree_scattering_function", d_waller_hartree_scattering_function );
+  writer.addArray( "waller_hartree_atomic_form_factor_momentum_grid", d_waller_hartree_atomic_form_factor_momentum_grid );
+  writer.addArray( "waller_hartree_atomic_form_factor", d_waller_hartree_atomic_form_factor );
+  writer.addArray( "waller_hartree_squared_atomic_form_factor_squared_momentum_grid", d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid );
+  writer.addArray( "waller_hartree_squared_atomic_form_factor", d_waller_hartree_squared_atomic_form_factor );
+  writer.addArray( "photon_energy_grid", d_photon_energy_grid );
+  writer.addValue( "has_average_photon_heating_numbers", (unsigned)d_has_average_photon_heating_numbers );
+  writer.addArray( "average_photon_heating_numbers", d_average_photon_heating_numbers );
+  writer.addArray( "waller_hartree_incoherent_cross_section", d_waller_hartree_incoherent_cross_section );
+  writer.addValue( "waller_hartree_incoherent_cross_section_threshold_index", d_waller_hartree_incoherent_cross_section_threshold_index );
+  writer.addArray( "impulse_approx_incoherent_cross_section", d_impulse_approx_incoherent_cross_section );
+  writer.addValue( "impulse_approx_incoherent_cross_section_threshold_index", d_impulse_approx_incoherent_cross_section_threshold_index );
+  writer.addIndexedArrays( "impulse_approx_subshell_incoherent_cross_sections", d_impulse_approx_subshell_incoherent_cross_sections );
+  writer.addIndexedValues( "impulse_approx_subshell_incoherent_cross_section_threshold_indices", d_impulse_approx_subshell_incoherent_cross_section_threshold_indices );
+  writer.addArray( "waller_hartree_coherent_cross_section", d_waller_hartree_coherent_cross_section );
+  writer.addValue( "waller_hartree_coherent_cross_section_threshold_index", d_waller_hartree_coherent_cross_section_threshold_index );
+  writer.addArray( "pair_production_cross_section", d_pair_production_cross_section );
+  writer.addValue( "pair_production_cross_section_threshold_index", d_pair_production_cross_section_threshold_index );
+  writer.addArray( "triplet_production_cross_section", d_triplet_production_cross_section );
+  writer.addValue( "triplet_production_cross_section_threshold_index", d_triplet_production_cross_section_threshold_index );
+  writer.addArray( "photoelectric_cross_section", d_photoelectric_cross_section );
+  writer.addValue( "photoelectric_cross_section_threshold_index", d_photoelectric_cross_section_threshold_index );
+  writer.addIndexedArrays( "subshell_photoelectric_cross_sections", d_subshell_photoelectric_cross_sections );
+  writer.addIndexedValues( "subshell_photoelectric_cross_section_threshold_indices", d_subshell_photoelectric_cross_section_threshold_indices );
+  writer.addArray( "waller_hartree_total_cross_section", d_waller_hartree_total_cross_section );
+  writer.addArray( "impulse_approx_total_cross_section", d_impulse_approx_total_cross_section );
+
+  // Electron data
+  writer.addString( "electron_two_d_interp", d_electron_two_d_interp );
+  writer.addString( "electron_two_d_grid", d_electron_two_d_grid );
+  writer.addArray( "angular_energy_grid", d_angular_energy_grid );
+  writer.addString( "cutoff_elastic_interp", d_cutoff_elastic_interp );
+  writer.addIndexedArrays( "cutoff_elastic_angles", d_cutoff_elastic_angles );
+  writer.addIndexedArrays( "cutoff_elastic_pdf", d_cutoff_elastic_pdf );
+  writer.addIndexedArrays( "moment_preserving_elastic_discrete_angles", d_moment_preserving_elastic_discrete_angles );
+  writer.addIndexedArrays( "moment_preserving_elastic_weights", d_moment_preserving_elastic_weights );
+  writer.addArray( "moment_preserving_cross_section_reductions", d_moment_preserving_cross_section_reductions );
+  writer.addIndexedArrays( "electroionization_energy_grid", d_electroionization_energy_grid );
+  writer.addString( "electroionization_interp", d_electroionization_interp );
+
+  for( auto&& subshell_data : d_electroionization_recoil_energy )
+    writer.addIndexedArrays( "electroionization_recoil_energy/" + Utility::toString( subshell_data.first ), subshell_data.second );
+
+  for( auto&& subshell_data : d_electroionization_recoil_pdf )
+    writer.addIndexedArrays( "electroionization_recoil_pdf/" + Utility::toString( subshell_data.first ), subshell_data.second );
+
+  for( auto&& subshell_data : d_electroionization_outgoing_energy )
+    writer.addIndexedArrays( "electroionization_outgoing_energy/" + Utility::toString( subshell_data.first ), subshell_data.second );
+
+  for( auto&& subshell_data : d_electroionization_outgoing_pdf )
+    writer.addIndexedArrays( "electroionization_outgoing_pdf/" + Utility::toString( subshell_data.first ), subshell_data.second );
+
+  writer.addArray( "bremsstrahlung_energy_grid", d_bremsstrahlung_energy_grid );
+  writer.addString( "bremsstrahlung_photon_interp", d_bremsstrahlung_photon_interp );
+  writer.addIndexedArrays( "bremsstrahlung_photon_energy", d_bremsstrahlung_photon_energy );
+  writer.addIndexedArrays( "bremsstrahlung_photon_pdf", d_bremsstrahlung_photon_pdf );
+  writer.addArray( "atomic_excitation_energy_grid", d_atomic_excitation_energy_grid );
+  writer.addString( "atomic_excitation_energy_loss_interp", d_atomic_excitation_energy_loss_interp );
+  writer.addArray( "atomic_excitation_energy_loss", d_atomic_excitation_energy_loss );
+  writer.addArray( "electron_energy_grid", d_electron_energy_grid );
+  writer.addString( "electron_cross_section_interp", d_electron_cross_section_interp );
+  writer.addArray( "total_electron_cross_section", d_total_electron_cross_section );
+  writer.addArray( "cutoff_elastic_cross_section", d_cutoff_elastic_cross_section );
+  writer.addValue( "cutoff_elastic_cross_section_threshold_index", d_cutoff_elastic_cross_section_threshold_index );
+  writer.addArray( "screened_rutherford_elastic_cross_section", d_screened_rutherford_elastic_cross_section );
+  writer.addValue( "screened_rutherford_elastic_cross_section_threshold_index", d_screened_rutherford_elastic_cross_section_threshold_index );
+  writer.addArray( "total_elastic_cross_section", d_total_elastic_cross_section );
+  writer.addValue( "total_elastic_cross_section_threshold_index", d_total_elastic_cross_section_threshold_index );
+  writer.addIndexedArrays( "electroionization_subshell_cross_section", d_electroionization_subshell_cross_section );
+  writer.addIndexedValues( "electroionization_subshell_cross_section_threshold_index", d_electroionization_subshell_cross_section_threshold_index );
+  writer.addArray( "bremsstrahlung_cross_section", d_bremsstrahlung_cross_section );
+  writer.addValue( "bremsstrahlung_cross_section_threshold_index", d_bremsstrahlung_cross_section_threshold_index );
+  writer.addArray( "atomic_excitation_cross_section", d_atomic_excitation_cross_section );
+  writer.addValue( "atomic_excitation_cross_section_threshold_index", d_atomic_excitation_cross_section_threshold_index );
+
+  writer.write( file_name_with_path, overwrite );
+}
+
 //---------------------------------------------------------------------------//
 // GET NOTES
 //---------------------------------------------------------------------------//
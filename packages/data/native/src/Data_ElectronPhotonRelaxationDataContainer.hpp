@@ -48,6 +48,10 @@ public:
   //! The database name used in an archive
   const char* getArchiveName() const override;
 
+  //! Save the data to a native mapped data file
+  void saveToMappedFile( const boost::filesystem::path& file_name_with_path,
+                         const bool overwrite = false ) const;
+
 //---------------------------------------------------------------------------//
 // GET NOTES
 //---------------------------------------------------------------------------//
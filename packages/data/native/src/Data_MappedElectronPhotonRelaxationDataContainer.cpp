@@ -0,0 +1,820 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_MappedElectronPhotonRelaxationDataContainer.cpp
+//! \author Alex Robinson
+//! \brief  The memory-mapped electron-photon-relaxation data container def.
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Data_MappedElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Data{
+
+// Constructor
+MappedElectronPhotonRelaxationDataContainer::MappedElectronPhotonRelaxationDataContainer(
+                           const boost::filesystem::path& file_name_with_path )
+  : d_mapped_file( new NativeMappedDataFile( file_name_with_path ) )
+{ /* ... */ }
+
+// Return the mapped data file
+const NativeMappedDataFile& MappedElectronPhotonRelaxationDataContainer::getMappedFile() const
+{
+  return *d_mapped_file;
+}
+
+// Check if a subshell is valid
+bool MappedElectronPhotonRelaxationDataContainer::isValidSubshell(
+                                                const unsigned subshell ) const
+{
+  Utility::ArrayView<const unsigned> subshells = this->getSubshells();
+
+  return std::binary_search( subshells.begin(), subshells.end(), subshell );
+}
+
+// Return the entry name of subshell electroionization data
+std::string MappedElectronPhotonRelaxationDataContainer::getSubshellEntryName(
+                                                    const std::string& name,
+                                                    const unsigned subshell )
+{
+  return name + "/" + Utility::toString( subshell );
+}
+
+//---------------------------------------------------------------------------//
+// GET NOTES
+//---------------------------------------------------------------------------//
+
+// Data table notes
+std::string MappedElectronPhotonRelaxationDataContainer::getNotes() const
+{
+  return d_mapped_file->getString( "notes" );
+}
+
+//---------------------------------------------------------------------------//
+// GET TABLE DATA
+//---------------------------------------------------------------------------//
+
+// Return the atomic number
+unsigned MappedElectronPhotonRelaxationDataContainer::getAtomicNumber() const
+{
+  return d_mapped_file->getValue<unsigned>( "atomic_number" );
+}
+
+// Return the atomic weight
+double MappedElectronPhotonRelaxationDataContainer::getAtomicWeight() const
+{
+  return d_mapped_file->getValue<double>( "atomic_weight" );
+}
+
+// Return the minimum photon energy
+double MappedElectronPhotonRelaxationDataContainer::getMinPhotonEnergy() const
+{
+  return d_mapped_file->getValue<double>( "min_photon_energy" );
+}
+
+// Return the maximum photon energy
+double MappedElectronPhotonRelaxationDataContainer::getMaxPhotonEnergy() const
+{
+  return d_mapped_file->getValue<double>( "max_photon_energy" );
+}
+
+// Return the minimum electron energy
+double MappedElectronPhotonRelaxationDataContainer::getMinElectronEnergy() const
+{
+  return d_mapped_file->getValue<double>( "min_electron_energy" );
+}
+
+// Return the maximum electron energy
+double MappedElectronPhotonRelaxationDataContainer::getMaxElectronEnergy() const
+{
+  return d_mapped_file->getValue<double>( "max_electron_energy" );
+}
+
+// Return the occupation number evaluation tolerance
+double MappedElectronPhotonRelaxationDataContainer::getOccupationNumberEvaluationTolerance() const
+{
+  return d_mapped_file->getValue<double>( "occupation_number_evaluation_tolerance" );
+}
+
+// Return the subshell incoherent evaluation tolerance
+double MappedElectronPhotonRelaxationDataContainer::getSubshellIncoherentEvaluationTolerance() const
+{
+  return d_mapped_file->getValue<double>( "subshell_incoherent_evaluation_tolerance" );
+}
+
+// Return the photon threshold energy nudge factor
+double MappedElectronPhotonRelaxationDataContainer::getPhotonThresholdEnergyNudgeFactor() const
+{
+  return d_mapped_file->getValue<double>( "photon_threshold_energy_nudge_factor" );
+}
+
+// Return the upper cutoff scattering angle cosine above which moment preserving elastic scattering is used
+double MappedElectronPhotonRelaxationDataContainer::getCutoffAngleCosine() const
+{
+  return d_mapped_file->getValue<double>( "cutoff_angle_cosine" );
+}
+
+// Return the number of discrete moment preserving angles
+unsigned MappedElectronPhotonRelaxationDataContainer::getNumberOfMomentPreservingAngles() const
+{
+  return (unsigned)d_mapped_file->getValue<double>( "number_of_moment_preserving_angles" );
+}
+
+// Return the electron FullyTabularTwoDDistribution evaluation tolerance
+double MappedElectronPhotonRelaxationDataContainer::getElectronTabularEvaluationTolerance() const
+{
+  return d_mapped_file->getValue<double>( "electron_tabular_evaluation_tol" );
+}
+
+// Return the photon union energy grid convergence tolerance
+double MappedElectronPhotonRelaxationDataContainer::getPhotonGridConvergenceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "photon_grid_convergence_tol" );
+}
+
+// Return the photon union energy grid absolute difference tolerance
+double MappedElectronPhotonRelaxationDataContainer::getPhotonGridAbsoluteDifferenceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "photon_grid_absolute_diff_tol" );
+}
+
+// Return the photon union energy grid distance tolerance
+double MappedElectronPhotonRelaxationDataContainer::getPhotonGridDistanceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "photon_grid_distance_tol" );
+}
+
+// Return the electron union energy grid convergence tolerance
+double MappedElectronPhotonRelaxationDataContainer::getElectronGridConvergenceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "electron_grid_convergence_tol" );
+}
+
+// Return the electron union energy grid absolute difference tolerance
+double MappedElectronPhotonRelaxationDataContainer::getElectronGridAbsoluteDifferenceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "electron_grid_absolute_diff_tol" );
+}
+
+// Return the electron union energy grid distance tolerance
+double MappedElectronPhotonRelaxationDataContainer::getElectronGridDistanceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "electron_grid_distance_tol" );
+}
+
+// Return the bremsstrahlung cross section evaluation tolerance
+double MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungEvaluationTolerance() const
+{
+  return d_mapped_file->getValue<double>( "bremsstrahlung_evaluation_tolerance" );
+}
+
+// Return the bremsstrahlung grid convergence tolerance
+double MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungGridConvergenceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "bremsstrahlung_convergence_tolerance" );
+}
+
+// Return the bremsstrahlung absolute difference tolerance
+double MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungAbsoluteDifferenceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "bremsstrahlung_absolute_diff_tol" );
+}
+
+// Return the bremsstrahlung distance tolerance
+double MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungDistanceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "bremsstrahlung_distance_tol" );
+}
+
+// Return the electroionization cross section evaluation tolerance
+double MappedElectronPhotonRelaxationDataContainer::getElectroionizationEvaluationTolerance() const
+{
+  return d_mapped_file->getValue<double>( "electroionization_evaluation_tol" );
+}
+
+// Return the electroionization grid convergence tolerance
+double MappedElectronPhotonRelaxationDataContainer::getElectroionizationGridConvergenceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "electroionization_convergence_tol" );
+}
+
+// Return the electroionization absolute difference tolerance
+double MappedElectronPhotonRelaxationDataContainer::getElectroionizationAbsoluteDifferenceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "electroionization_absolute_diff_tol" );
+}
+
+// Return the electroionization distance tolerance
+double MappedElectronPhotonRelaxationDataContainer::getElectroionizationDistanceTolerance() const
+{
+  return d_mapped_file->getValue<double>( "electroionization_distance_tol" );
+}
+
+//---------------------------------------------------------------------------//
+// GET RELAXATION DATA
+//---------------------------------------------------------------------------//
+
+// Return the atomic subshells (sorted)
+Utility::ArrayView<const unsigned> MappedElectronPhotonRelaxationDataContainer::getSubshells() const
+{
+  return d_mapped_file->getArray<unsigned>( "subshells" );
+}
+
+// Return the occupancy for a subshell
+double MappedElectronPhotonRelaxationDataContainer::getSubshellOccupancy(const unsigned subshell ) const
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedValue<double>( "subshell_occupancies", subshell );
+}
+
+// Return the binding energy for a subshell
+double MappedElectronPhotonRelaxationDataContainer::getSubshellBindingEnergy(const unsigned subshell ) const
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedValue<double>( "subshell_binding_energies", subshell );
+}
+
+// Return if there is relaxation data
+bool MappedElectronPhotonRelaxationDataContainer::hasRelaxationData() const
+{
+  return d_mapped_file->getKeys<unsigned>( "relaxation_transitions" ).size() > 0;
+}
+
+// Return if the subshell has relaxation data
+bool MappedElectronPhotonRelaxationDataContainer::hasSubshellRelaxationData(const unsigned subshell ) const
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->hasKey( "relaxation_transitions", subshell );
+}
+
+// Return the number of transitions that can fill a subshell vacancy
+unsigned MappedElectronPhotonRelaxationDataContainer::getSubshellRelaxationTransitions(const unsigned subshell ) const
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedValue<unsigned>( "relaxation_transitions", subshell );
+}
+
+// Return the relaxation vacancies for a subshell (consecutive pairs)
+Utility::ArrayView<const unsigned>
+MappedElectronPhotonRelaxationDataContainer::getSubshellRelaxationVacancies(
+                                                const unsigned subshell ) const
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<unsigned>( "relaxation_vacancies", subshell );
+}
+
+// Return the relaxation particle energies for a subshell
+auto MappedElectronPhotonRelaxationDataContainer::getSubshellRelaxationParticleEnergies(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "relaxation_particle_energies", subshell );
+}
+
+// Return the relaxation probabilities for a subshell
+auto MappedElectronPhotonRelaxationDataContainer::getSubshellRelaxationProbabilities(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "relaxation_probabilities", subshell );
+}
+
+//---------------------------------------------------------------------------//
+// GET PHOTON DATA
+//---------------------------------------------------------------------------//
+
+// Return the Compton profile momentum grid
+auto MappedElectronPhotonRelaxationDataContainer::getComptonProfileMomentumGrid(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "compton_profile_momentum_grids", subshell );
+}
+
+// Return the Compton profile for a subshell
+auto MappedElectronPhotonRelaxationDataContainer::getComptonProfile(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "compton_profiles", subshell );
+}
+
+// Return the occupation number momentum grid
+auto MappedElectronPhotonRelaxationDataContainer::getOccupationNumberMomentumGrid(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "occupation_number_momentum_grids", subshell );
+}
+
+// Return the occupation number for a subshell
+auto MappedElectronPhotonRelaxationDataContainer::getOccupationNumber(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "occupation_numbers", subshell );
+}
+
+// Return the Waller-Hartree scattering function momentum grid
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunctionMomentumGrid() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_scattering_function_momentum_grid" );
+}
+
+// Return the Waller-Hartree scattering function
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_scattering_function" );
+}
+
+// Return the Waller-Hartree atomic form factor momentum grid
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactorMomentumGrid() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_atomic_form_factor_momentum_grid" );
+}
+
+// Return the Waller-Hartree atomic form factor
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactor() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_atomic_form_factor" );
+}
+
+// Return the Waller-Hartree squared atomic form factor squared mom. grid
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_squared_atomic_form_factor_squared_momentum_grid" );
+}
+
+// Return the Waller-Hartree squared atomic form factor
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactor() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_squared_atomic_form_factor" );
+}
+
+// Return the photon energy grid
+auto MappedElectronPhotonRelaxationDataContainer::getPhotonEnergyGrid() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "photon_energy_grid" );
+}
+
+// Check if there are average heating numbers
+bool MappedElectronPhotonRelaxationDataContainer::hasAveragePhotonHeatingNumbers() const
+{
+  return d_mapped_file->getValue<unsigned>( "has_average_photon_heating_numbers" ) != 0;
+}
+
+// Return the average heating numbers
+auto MappedElectronPhotonRelaxationDataContainer::getAveragePhotonHeatingNumbers() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "average_photon_heating_numbers" );
+}
+
+// Return the Waller-Hartree (WH) incoherent photon cross section
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_incoherent_cross_section" );
+}
+
+// Return the WH incoherent photon cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "waller_hartree_incoherent_cross_section_threshold_index" );
+}
+
+// Return the impluse approx. (IA) incoherent photon cross section
+auto MappedElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "impulse_approx_incoherent_cross_section" );
+}
+
+// Return the IA incoherent photon cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "impulse_approx_incoherent_cross_section_threshold_index" );
+}
+
+// Return the subshell Impulse approx. incoherent photon cross section
+auto MappedElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSection(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "impulse_approx_subshell_incoherent_cross_sections", subshell );
+}
+
+// Return the subshell IA incoherent photon cs threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex(const unsigned subshell ) const
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedValue<unsigned>( "impulse_approx_subshell_incoherent_cross_section_threshold_indices", subshell );
+}
+
+// Return the Waller-Hartree coherent cross section
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_coherent_cross_section" );
+}
+
+// Return the Waller-Hartree coherent cs threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "waller_hartree_coherent_cross_section_threshold_index" );
+}
+
+// Return the pair production cross section
+auto MappedElectronPhotonRelaxationDataContainer::getPairProductionCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "pair_production_cross_section" );
+}
+
+// Return the pair production cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getPairProductionCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "pair_production_cross_section_threshold_index" );
+}
+
+// Return the triplet production cross section
+auto MappedElectronPhotonRelaxationDataContainer::getTripletProductionCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "triplet_production_cross_section" );
+}
+
+// Return the triple production cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getTripletProductionCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "triplet_production_cross_section_threshold_index" );
+}
+
+// Return the Photoelectric effect cross section
+auto MappedElectronPhotonRelaxationDataContainer::getPhotoelectricCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "photoelectric_cross_section" );
+}
+
+// Return the Photoelectric effect cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getPhotoelectricCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "photoelectric_cross_section_threshold_index" );
+}
+
+// Return the Photoelectric effect cross section for a subshell
+auto MappedElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSection(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "subshell_photoelectric_cross_sections", subshell );
+}
+
+// Return the subshell Photoelectric effect cross section threshold index
+unsigned MappedElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSectionThresholdEnergyIndex(const unsigned subshell ) const
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedValue<unsigned>( "subshell_photoelectric_cross_section_threshold_indices", subshell );
+}
+
+// Return the Waller-Hartree total cross section
+auto MappedElectronPhotonRelaxationDataContainer::getWallerHartreeTotalCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "waller_hartree_total_cross_section" );
+}
+
+// Return the impulse approx. total cross section
+auto MappedElectronPhotonRelaxationDataContainer::getImpulseApproxTotalCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "impulse_approx_total_cross_section" );
+}
+
+//---------------------------------------------------------------------------//
+// GET ELECTRON DATA
+//---------------------------------------------------------------------------//
+
+// Return the electron TwoDInterpPolicy
+std::string MappedElectronPhotonRelaxationDataContainer::getElectronTwoDInterpPolicy() const
+{
+  return d_mapped_file->getString( "electron_two_d_interp" );
+}
+
+// Return the electron TwoDGridPolicy
+std::string MappedElectronPhotonRelaxationDataContainer::getElectronTwoDGridPolicy() const
+{
+  return d_mapped_file->getString( "electron_two_d_grid" );
+}
+
+// Return the elastic angular energy grid
+auto MappedElectronPhotonRelaxationDataContainer::getElasticAngularEnergyGrid() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "angular_energy_grid" );
+}
+
+// Return the cutoff elastic scattering interpolation policy
+std::string MappedElectronPhotonRelaxationDataContainer::getCutoffElasticInterpPolicy() const
+{
+  return d_mapped_file->getString( "cutoff_elastic_interp" );
+}
+
+// Return the cutoff elastic scattering angles for an incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getCutoffElasticAngles(
+                                   const double incoming_energy ) const -> ArrayView
+{
+  return d_mapped_file->getIndexedArray<double>( "cutoff_elastic_angles", incoming_energy );
+}
+
+// Return the cutoff elastic scattering pdf for an incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getCutoffElasticPDF(
+                                   const double incoming_energy ) const -> ArrayView
+{
+  return d_mapped_file->getIndexedArray<double>( "cutoff_elastic_pdf", incoming_energy );
+}
+
+// Return if there is moment preserving data
+bool MappedElectronPhotonRelaxationDataContainer::hasMomentPreservingData() const
+{
+  return d_mapped_file->getKeys<double>( "moment_preserving_elastic_discrete_angles" ).size() > 0;
+}
+
+// Return the moment preserving cross section reductions
+auto MappedElectronPhotonRelaxationDataContainer::getMomentPreservingCrossSectionReduction() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "moment_preserving_cross_section_reductions" );
+}
+
+// Return the moment preserving elastic discrete angles for an incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getMomentPreservingElasticDiscreteAngles(
+                                   const double incoming_energy ) const -> ArrayView
+{
+  return d_mapped_file->getIndexedArray<double>( "moment_preserving_elastic_discrete_angles", incoming_energy );
+}
+
+// Return the moment preserving elastic weights for an incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getMomentPreservingElasticWeights(
+                                   const double incoming_energy ) const -> ArrayView
+{
+  return d_mapped_file->getIndexedArray<double>( "moment_preserving_elastic_weights", incoming_energy );
+}
+
+// Return the electroionization energy grid for the recoil electron spectrum for a subshell
+auto MappedElectronPhotonRelaxationDataContainer::getElectroionizationEnergyGrid(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "electroionization_energy_grid", subshell );
+}
+
+// Return the electroionization recoil interpolation policy
+std::string MappedElectronPhotonRelaxationDataContainer::getElectroionizationInterpPolicy() const
+{
+  return d_mapped_file->getString( "electroionization_interp" );
+}
+
+// Return the electroionization recoil energy for a subshell and incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getElectroionizationRecoilEnergy(
+                                   const unsigned subshell,
+                                   const double incoming_energy ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>(
+                        this->getSubshellEntryName( "electroionization_recoil_energy", subshell ),
+                        incoming_energy );
+}
+
+// Return the electroionization recoil energy pdf for a subshell and incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getElectroionizationRecoilPDF(
+                                   const unsigned subshell,
+                                   const double incoming_energy ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>(
+                        this->getSubshellEntryName( "electroionization_recoil_pdf", subshell ),
+                        incoming_energy );
+}
+
+// Return if there is electroionization outgoing energy data
+bool MappedElectronPhotonRelaxationDataContainer::hasElectroionizationOutgoingEnergyData() const
+{
+  Utility::ArrayView<const unsigned> subshells = this->getSubshells();
+
+  for( size_t i = 0; i < subshells.size(); ++i )
+  {
+    std::string entry_name =
+      this->getSubshellEntryName( "electroionization_outgoing_energy",
+                                  subshells[i] );
+
+    if( d_mapped_file->hasEntry( entry_name + "/keys" ) )
+      return true;
+  }
+
+  return false;
+}
+
+// Return the electroionization outgoing energy for a subshell and incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingEnergy(
+                                   const unsigned subshell,
+                                   const double incoming_energy ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>(
+                        this->getSubshellEntryName( "electroionization_outgoing_energy", subshell ),
+                        incoming_energy );
+}
+
+// Return the electroionization outgoing energy pdf for a subshell and incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingPDF(
+                                   const unsigned subshell,
+                                   const double incoming_energy ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>(
+                        this->getSubshellEntryName( "electroionization_outgoing_pdf", subshell ),
+                        incoming_energy );
+}
+
+// Return the bremsstrahlung energy grid for the secondary photon spectrum
+auto MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungEnergyGrid() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "bremsstrahlung_energy_grid" );
+}
+
+// Return the bremsstrahlung photon interpolation policy
+std::string MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonInterpPolicy() const
+{
+  return d_mapped_file->getString( "bremsstrahlung_photon_interp" );
+}
+
+// Return the bremsstrahlung photon energy for an incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonEnergy(
+                                   const double incoming_energy ) const -> ArrayView
+{
+  return d_mapped_file->getIndexedArray<double>( "bremsstrahlung_photon_energy", incoming_energy );
+}
+
+// Return the bremsstrahlung photon energy pdf for an incoming energy
+auto MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonPDF(
+                                   const double incoming_energy ) const -> ArrayView
+{
+  return d_mapped_file->getIndexedArray<double>( "bremsstrahlung_photon_pdf", incoming_energy );
+}
+
+// Return the atomic excitation average energy loss energy grid
+auto MappedElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyGrid() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "atomic_excitation_energy_grid" );
+}
+
+// Return the atomic excitation average energy loss interpolation policy
+std::string MappedElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLossInterpPolicy() const
+{
+  return d_mapped_file->getString( "atomic_excitation_energy_loss_interp" );
+}
+
+// Return the atomic excitation average energy loss
+auto MappedElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLoss() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "atomic_excitation_energy_loss" );
+}
+
+// Return the electron energy grid
+auto MappedElectronPhotonRelaxationDataContainer::getElectronEnergyGrid() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "electron_energy_grid" );
+}
+
+// Return the electron cross section interpolation policy
+std::string MappedElectronPhotonRelaxationDataContainer::getElectronCrossSectionInterpPolicy() const
+{
+  return d_mapped_file->getString( "electron_cross_section_interp" );
+}
+
+// Return the total electron cross section
+auto MappedElectronPhotonRelaxationDataContainer::getTotalElectronCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "total_electron_cross_section" );
+}
+
+// Return the elastic electron cross section below mu = 0.999999
+auto MappedElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "cutoff_elastic_cross_section" );
+}
+
+// Return the cutoff elastic cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "cutoff_elastic_cross_section_threshold_index" );
+}
+
+// Return the screened Rutherford elastic electron cross section
+auto MappedElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "screened_rutherford_elastic_cross_section" );
+}
+
+// Return the screened Rutherford elastic cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "screened_rutherford_elastic_cross_section_threshold_index" );
+}
+
+// Return the total elastic electron cross section
+auto MappedElectronPhotonRelaxationDataContainer::getTotalElasticCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "total_elastic_cross_section" );
+}
+
+// Return the total elastic cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getTotalElasticCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "total_elastic_cross_section_threshold_index" );
+}
+
+// Return the electroionization electron cross section for a subshell
+auto MappedElectronPhotonRelaxationDataContainer::getElectroionizationCrossSection(
+                                         const unsigned subshell ) const -> ArrayView
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedArray<double>( "electroionization_subshell_cross_section", subshell );
+}
+
+// Return the electroionization cross section threshold energy bin index for a subshell
+unsigned MappedElectronPhotonRelaxationDataContainer::getElectroionizationCrossSectionThresholdEnergyIndex(const unsigned subshell ) const
+{
+  // Make sure the subshell is valid
+  testPrecondition( this->isValidSubshell( subshell ) );
+
+  return d_mapped_file->getIndexedValue<unsigned>( "electroionization_subshell_cross_section_threshold_index", subshell );
+}
+
+// Return the bremsstrahlung electron cross section
+auto MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "bremsstrahlung_cross_section" );
+}
+
+// Return the bremsstrahlung cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "bremsstrahlung_cross_section_threshold_index" );
+}
+
+// Return the atomic excitation electron cross section
+auto MappedElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSection() const -> ArrayView
+{
+  return d_mapped_file->getArray<double>( "atomic_excitation_cross_section" );
+}
+
+// Return the atomic excitation cross section threshold energy bin index
+unsigned MappedElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSectionThresholdEnergyIndex() const
+{
+  return d_mapped_file->getValue<unsigned>( "atomic_excitation_cross_section_threshold_index" );
+}
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_MappedElectronPhotonRelaxationDataContainer.cpp
+//---------------------------------------------------------------------------//
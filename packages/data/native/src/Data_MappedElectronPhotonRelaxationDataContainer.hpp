@@ -0,0 +1,439 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_MappedElectronPhotonRelaxationDataContainer.hpp
+//! \author Alex Robinson
+//! \brief  The memory-mapped electron-photon-relaxation data container decl.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_MAPPED_ELECTRON_PHOTON_RELAXATION_DATA_CONTAINER_HPP
+#define DATA_MAPPED_ELECTRON_PHOTON_RELAXATION_DATA_CONTAINER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "Data_NativeMappedDataFile.hpp"
+#include "Utility_ArrayView.hpp"
+
+namespace Data{
+
+/*! The memory-mapped electron-photon-relaxation data container
+ *
+ * \details This container provides read-only access to electron-photon-
+ * relaxation data that has been saved to a native mapped data file (see
+ * Data::ElectronPhotonRelaxationDataContainer::saveToMappedFile). The file
+ * is mapped into memory and all arrays are returned as views of the mapped
+ * data so constructing the container does not deserialize or copy any
+ * arrays. All processes on a node that load the same file share one copy of
+ * the data. The member functions mirror the member functions of the
+ * Data::ElectronPhotonRelaxationDataContainer. Data that the archivable
+ * container returns as a map of arrays is accessed one array at a time (the
+ * keys are the corresponding energy grid).
+ *
+ * \note The MonteCarlo photoatom and electroatom factories (and the native
+ * reaction and distribution factories that they use) only accept the
+ * archivable Data::ElectronPhotonRelaxationDataContainer, so this container
+ * cannot be used in a simulation yet. There is also no memory-mapped
+ * version of the Data::AdjointElectronPhotonRelaxationDataContainer. Both
+ * are out of scope of the mapped data format for now.
+ */
+class MappedElectronPhotonRelaxationDataContainer
+{
+
+public:
+
+  //! The array view type
+  typedef Utility::ArrayView<const double> ArrayView;
+
+  //! Constructor
+  MappedElectronPhotonRelaxationDataContainer(
+                          const boost::filesystem::path& file_name_with_path );
+
+  //! Destructor
+  ~MappedElectronPhotonRelaxationDataContainer()
+  { /* ... */ }
+
+  //! Return the mapped data file
+  const NativeMappedDataFile& getMappedFile() const;
+
+//---------------------------------------------------------------------------//
+// GET NOTES
+//---------------------------------------------------------------------------//
+
+  //! Data table notes
+  std::string getNotes() const;
+
+//---------------------------------------------------------------------------//
+// GET TABLE DATA
+//---------------------------------------------------------------------------//
+
+  //! Return the atomic number
+  unsigned getAtomicNumber() const;
+
+  //! Return the atomic weight
+  double getAtomicWeight() const;
+
+  //! Return the minimum photon energy
+  double getMinPhotonEnergy() const;
+
+  //! Return the maximum photon energy
+  double getMaxPhotonEnergy() const;
+
+  //! Return the minimum electron energy
+  double getMinElectronEnergy() const;
+
+  //! Return the maximum electron energy
+  double getMaxElectronEnergy() const;
+
+  //! Return the occupation number evaluation tolerance
+  double getOccupationNumberEvaluationTolerance() const;
+
+  //! Return the subshell incoherent evaluation tolerance
+  double getSubshellIncoherentEvaluationTolerance() const;
+
+  //! Return the photon threshold energy nudge factor
+  double getPhotonThresholdEnergyNudgeFactor() const;
+
+  //! Return the upper cutoff scattering angle cosine above which moment preserving elastic scattering is used
+  double getCutoffAngleCosine() const;
+
+  //! Return the number of discrete moment preserving angles
+  unsigned getNumberOfMomentPreservingAngles() const;
+
+  //! Return the electron FullyTabularTwoDDistribution evaluation tolerance
+  double getElectronTabularEvaluationTolerance() const;
+
+  //! Return the photon union energy grid convergence tolerance
+  double getPhotonGridConvergenceTolerance() const;
+
+  //! Return the photon union energy grid absolute difference tolerance
+  double getPhotonGridAbsoluteDifferenceTolerance() const;
+
+  //! Return the photon union energy grid distance tolerance
+  double getPhotonGridDistanceTolerance() const;
+
+  //! Return the electron union energy grid convergence tolerance
+  double getElectronGridConvergenceTolerance() const;
+
+  //! Return the electron union energy grid absolute difference tolerance
+  double getElectronGridAbsoluteDifferenceTolerance() const;
+
+  //! Return the electron union energy grid distance tolerance
+  double getElectronGridDistanceTolerance() const;
+
+  //! Return the bremsstrahlung cross section evaluation tolerance
+  double getBremsstrahlungEvaluationTolerance() const;
+
+  //! Return the bremsstrahlung grid convergence tolerance
+  double getBremsstrahlungGridConvergenceTolerance() const;
+
+  //! Return the bremsstrahlung absolute difference tolerance
+  double getBremsstrahlungAbsoluteDifferenceTolerance() const;
+
+  //! Return the bremsstrahlung distance tolerance
+  double getBremsstrahlungDistanceTolerance() const;
+
+  //! Return the electroionization cross section evaluation tolerance
+  double getElectroionizationEvaluationTolerance() const;
+
+  //! Return the electroionization grid convergence tolerance
+  double getElectroionizationGridConvergenceTolerance() const;
+
+  //! Return the electroionization absolute difference tolerance
+  double getElectroionizationAbsoluteDifferenceTolerance() const;
+
+  //! Return the electroionization distance tolerance
+  double getElectroionizationDistanceTolerance() const;
+
+//---------------------------------------------------------------------------//
+// GET RELAXATION DATA
+//---------------------------------------------------------------------------//
+
+  //! Return the atomic subshells (sorted)
+  Utility::ArrayView<const unsigned> getSubshells() const;
+
+  //! Return the occupancy for a subshell
+  double getSubshellOccupancy( const unsigned subshell ) const;
+
+  //! Return the binding energy for a subshell
+  double getSubshellBindingEnergy( const unsigned subshell ) const;
+
+  //! Return if there is relaxation data
+  bool hasRelaxationData() const;
+
+  //! Return if the subshell has relaxation data
+  bool hasSubshellRelaxationData( const unsigned subshell ) const;
+
+  //! Return the number of transitions that can fill a subshell vacancy
+  unsigned getSubshellRelaxationTransitions( const unsigned subshell ) const;
+
+  //! Return the relaxation vacancies for a subshell (consecutive pairs)
+  Utility::ArrayView<const unsigned> getSubshellRelaxationVacancies(
+                                               const unsigned subshell ) const;
+
+  //! Return the relaxation particle energies for a subshell
+  ArrayView getSubshellRelaxationParticleEnergies(
+                                               const unsigned subshell ) const;
+
+  //! Return the relaxation probabilities for a subshell
+  ArrayView getSubshellRelaxationProbabilities(
+                                               const unsigned subshell ) const;
+
+//---------------------------------------------------------------------------//
+// GET PHOTON DATA
+//---------------------------------------------------------------------------//
+
+  //! Return the Compton profile momentum grid
+  ArrayView getComptonProfileMomentumGrid( const unsigned subshell ) const;
+
+  //! Return the Compton profile for a subshell
+  ArrayView getComptonProfile( const unsigned subshell ) const;
+
+  //! Return the occupation number momentum grid
+  ArrayView getOccupationNumberMomentumGrid( const unsigned subshell ) const;
+
+  //! Return the occupation number for a subshell
+  ArrayView getOccupationNumber( const unsigned subshell ) const;
+
+  //! Return the Waller-Hartree scattering function momentum grid
+  ArrayView getWallerHartreeScatteringFunctionMomentumGrid() const;
+
+  //! Return the Waller-Hartree scattering function
+  ArrayView getWallerHartreeScatteringFunction() const;
+
+  //! Return the Waller-Hartree atomic form factor momentum grid
+  ArrayView getWallerHartreeAtomicFormFactorMomentumGrid() const;
+
+  //! Return the Waller-Hartree atomic form factor
+  ArrayView getWallerHartreeAtomicFormFactor() const;
+
+  //! Return the Waller-Hartree squared atomic form factor squared mom. grid
+  ArrayView getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const;
+
+  //! Return the Waller-Hartree squared atomic form factor
+  ArrayView getWallerHartreeSquaredAtomicFormFactor() const;
+
+  //! Return the photon energy grid
+  ArrayView getPhotonEnergyGrid() const;
+
+  //! Check if there are average heating numbers
+  bool hasAveragePhotonHeatingNumbers() const;
+
+  //! Return the average heating numbers
+  ArrayView getAveragePhotonHeatingNumbers() const;
+
+  //! Return the Waller-Hartree (WH) incoherent photon cross section
+  ArrayView getWallerHartreeIncoherentCrossSection() const;
+
+  //! Return the WH incoherent photon cross section threshold energy bin index
+  unsigned getWallerHartreeIncoherentCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the impluse approx. (IA) incoherent photon cross section
+  ArrayView getImpulseApproxIncoherentCrossSection() const;
+
+  //! Return the IA incoherent photon cross section threshold energy bin index
+  unsigned getImpulseApproxIncoherentCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the subshell Impulse approx. incoherent photon cross section
+  ArrayView getImpulseApproxSubshellIncoherentCrossSection(
+                                               const unsigned subshell ) const;
+
+  //! Return the subshell IA incoherent photon cs threshold energy bin index
+  unsigned getImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex(
+                                               const unsigned subshell ) const;
+
+  //! Return the Waller-Hartree coherent cross section
+  ArrayView getWallerHartreeCoherentCrossSection() const;
+
+  //! Return the Waller-Hartree coherent cs threshold energy bin index
+  unsigned getWallerHartreeCoherentCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the pair production cross section
+  ArrayView getPairProductionCrossSection() const;
+
+  //! Return the pair production cross section threshold energy bin index
+  unsigned getPairProductionCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the triplet production cross section
+  ArrayView getTripletProductionCrossSection() const;
+
+  //! Return the triple production cross section threshold energy bin index
+  unsigned getTripletProductionCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the Photoelectric effect cross section
+  ArrayView getPhotoelectricCrossSection() const;
+
+  //! Return the Photoelectric effect cross section threshold energy bin index
+  unsigned getPhotoelectricCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the Photoelectric effect cross section for a subshell
+  ArrayView getSubshellPhotoelectricCrossSection(
+                                               const unsigned subshell ) const;
+
+  //! Return the subshell Photoelectric effect cross section threshold index
+  unsigned getSubshellPhotoelectricCrossSectionThresholdEnergyIndex(
+                                               const unsigned subshell ) const;
+
+  //! Return the Waller-Hartree total cross section
+  ArrayView getWallerHartreeTotalCrossSection() const;
+
+  //! Return the impulse approx. total cross section
+  ArrayView getImpulseApproxTotalCrossSection() const;
+
+//---------------------------------------------------------------------------//
+// GET ELECTRON DATA
+//---------------------------------------------------------------------------//
+
+  //! Return the electron TwoDInterpPolicy
+  std::string getElectronTwoDInterpPolicy() const;
+
+  //! Return the electron TwoDGridPolicy
+  std::string getElectronTwoDGridPolicy() const;
+
+  //! Return the elastic angular energy grid
+  ArrayView getElasticAngularEnergyGrid() const;
+
+  //! Return the cutoff elastic scattering interpolation policy
+  std::string getCutoffElasticInterpPolicy() const;
+
+  //! Return the cutoff elastic scattering angles for an incoming energy
+  ArrayView getCutoffElasticAngles( const double incoming_energy ) const;
+
+  //! Return the cutoff elastic scattering pdf for an incoming energy
+  ArrayView getCutoffElasticPDF( const double incoming_energy ) const;
+
+  //! Return if there is moment preserving data
+  bool hasMomentPreservingData() const;
+
+  //! Return the moment preserving cross section reductions
+  ArrayView getMomentPreservingCrossSectionReduction() const;
+
+  //! Return the moment preserving elastic discrete angles for an incoming energy
+  ArrayView getMomentPreservingElasticDiscreteAngles(
+                                         const double incoming_energy ) const;
+
+  //! Return the moment preserving elastic weights for an incoming energy
+  ArrayView getMomentPreservingElasticWeights(
+                                         const double incoming_energy ) const;
+
+  //! Return the electroionization energy grid for the recoil electron spectrum for a subshell
+  ArrayView getElectroionizationEnergyGrid( const unsigned subshell ) const;
+
+  //! Return the electroionization recoil interpolation policy
+  std::string getElectroionizationInterpPolicy() const;
+
+  //! Return the electroionization recoil energy for a subshell and incoming energy
+  ArrayView getElectroionizationRecoilEnergy(
+                                         const unsigned subshell,
+                                         const double incoming_energy ) const;
+
+  //! Return the electroionization recoil energy pdf for a subshell and incoming energy
+  ArrayView getElectroionizationRecoilPDF(
+                                         const unsigned subshell,
+                                         const double incoming_energy ) const;
+
+  //! Return if there is electroionization outgoing energy data
+  bool hasElectroionizationOutgoingEnergyData() const;
+
+  //! Return the electroionization outgoing energy for a subshell and incoming energy
+  ArrayView getElectroionizationOutgoingEnergy(
+                                         const unsigned subshell,
+                                         const double incoming_energy ) const;
+
+  //! Return the electroionization outgoing energy pdf for a subshell and incoming energy
+  ArrayView getElectroionizationOutgoingPDF(
+                                         const unsigned subshell,
+                                         const double incoming_energy ) const;
+
+  //! Return the bremsstrahlung energy grid for the secondary photon spectrum
+  ArrayView getBremsstrahlungEnergyGrid() const;
+
+  //! Return the bremsstrahlung photon interpolation policy
+  std::string getBremsstrahlungPhotonInterpPolicy() const;
+
+  //! Return the bremsstrahlung photon energy for an incoming energy
+  ArrayView getBremsstrahlungPhotonEnergy( const double incoming_energy ) const;
+
+  //! Return the bremsstrahlung photon energy pdf for an incoming energy
+  ArrayView getBremsstrahlungPhotonPDF( const double incoming_energy ) const;
+
+  //! Return the atomic excitation average energy loss energy grid
+  ArrayView getAtomicExcitationEnergyGrid() const;
+
+  //! Return the atomic excitation average energy loss interpolation policy
+  std::string getAtomicExcitationEnergyLossInterpPolicy() const;
+
+  //! Return the atomic excitation average energy loss
+  ArrayView getAtomicExcitationEnergyLoss() const;
+
+  //! Return the electron energy grid
+  ArrayView getElectronEnergyGrid() const;
+
+  //! Return the electron cross section interpolation policy
+  std::string getElectronCrossSectionInterpPolicy() const;
+
+  //! Return the total electron cross section
+  ArrayView getTotalElectronCrossSection() const;
+
+  //! Return the elastic electron cross section below mu = 0.999999
+  ArrayView getCutoffElasticCrossSection() const;
+
+  //! Return the cutoff elastic cross section threshold energy bin index
+  unsigned getCutoffElasticCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the screened Rutherford elastic electron cross section
+  ArrayView getScreenedRutherfordElasticCrossSection() const;
+
+  //! Return the screened Rutherford elastic cross section threshold energy bin index
+  unsigned getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the total elastic electron cross section
+  ArrayView getTotalElasticCrossSection() const;
+
+  //! Return the total elastic cross section threshold energy bin index
+  unsigned getTotalElasticCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the electroionization electron cross section for a subshell
+  ArrayView getElectroionizationCrossSection( const unsigned subshell ) const;
+
+  //! Return the electroionization cross section threshold energy bin index for a subshell
+  unsigned getElectroionizationCrossSectionThresholdEnergyIndex(
+                                               const unsigned subshell ) const;
+
+  //! Return the bremsstrahlung electron cross section
+  ArrayView getBremsstrahlungCrossSection() const;
+
+  //! Return the bremsstrahlung cross section threshold energy bin index
+  unsigned getBremsstrahlungCrossSectionThresholdEnergyIndex() const;
+
+  //! Return the atomic excitation electron cross section
+  ArrayView getAtomicExcitationCrossSection() const;
+
+  //! Return the atomic excitation cross section threshold energy bin index
+  unsigned getAtomicExcitationCrossSectionThresholdEnergyIndex() const;
+
+private:
+
+  // Check if a subshell is valid
+  bool isValidSubshell( const unsigned subshell ) const;
+
+  // Return the entry name of subshell electroionization data
+  static std::string getSubshellEntryName( const std::string& name,
+                                           const unsigned subshell );
+
+  // The mapped data file
+  std::unique_ptr<const NativeMappedDataFile> d_mapped_file;
+};
+
+} // end Data namespace
+
+#endif // end DATA_MAPPED_ELECTRON_PHOTON_RELAXATION_DATA_CONTAINER_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_MappedElectronPhotonRelaxationDataContainer.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,321 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_NativeMappedDataFile.cpp
+//! \author Alex Robinson
+//! \brief  The native memory-mapped data file class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cstring>
+
+// POSIX Includes
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// FRENSIE Includes
+#include "Data_NativeMappedDataFile.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Data{
+
+// The unsigned entries are stored as 32-bit integers
+static_assert( sizeof(unsigned) == sizeof(std::uint32_t),
+               "Native mapped data files require 32-bit unsigned ints!" );
+
+// The header must have a fixed size
+static_assert( sizeof(NativeMappedDataFile::FileHeader) == 64,
+               "The native mapped data file header must be 64 bytes!" );
+
+// The entry records must have a fixed size
+static_assert( sizeof(NativeMappedDataFile::EntryRecord) == 40,
+               "The native mapped data file entry records must be 40 "
+               "bytes!" );
+
+// Constructor
+NativeMappedDataFile::NativeMappedDataFile(
+                           const boost::filesystem::path& file_name_with_path )
+  : d_file_name( file_name_with_path ),
+    d_file_size( 0 ),
+    d_data( NULL ),
+    d_header( NULL ),
+    d_entries( NULL )
+{
+  int file_descriptor = ::open( d_file_name.string().c_str(), O_RDONLY );
+
+  TEST_FOR_EXCEPTION( file_descriptor < 0,
+                      std::runtime_error,
+                      "Native mapped data file " << d_file_name.string() <<
+                      " could not be opened!" );
+
+  struct stat file_stats;
+
+  if( ::fstat( file_descriptor, &file_stats ) != 0 )
+  {
+    ::close( file_descriptor );
+
+    THROW_EXCEPTION( std::runtime_error,
+                     "The size of native mapped data file "
+                     << d_file_name.string() << " could not be determined!" );
+  }
+
+  d_file_size = file_stats.st_size;
+
+  if( d_file_size < sizeof(FileHeader) )
+  {
+    ::close( file_descriptor );
+
+    THROW_EXCEPTION( std::runtime_error,
+                     "File " << d_file_name.string() << " is not a native "
+                     "mapped data file (too small)!" );
+  }
+
+  // Map the file read-only. The mapping is shared so that the pages can be
+  // shared by all processes that map the same file.
+  void* mapped_file = ::mmap( NULL,
+                              d_file_size,
+                              PROT_READ,
+                              MAP_SHARED,
+                              file_descriptor,
+                              0 );
+
+  // The mapping remains valid after the file is closed
+  ::close( file_descriptor );
+
+  TEST_FOR_EXCEPTION( mapped_file == MAP_FAILED,
+                      std::runtime_error,
+                      "Native mapped data file " << d_file_name.string() <<
+                      " could not be mapped into memory!" );
+
+  d_data = static_cast<const char*>( mapped_file );
+  d_header = reinterpret_cast<const FileHeader*>( d_data );
+
+  try{
+    this->validate();
+  }
+  catch( ... )
+  {
+    ::munmap( const_cast<char*>( d_data ), d_file_size );
+
+    throw;
+  }
+
+  d_entries =
+    reinterpret_cast<const EntryRecord*>( d_data+d_header->entry_table_offset );
+}
+
+// Destructor
+NativeMappedDataFile::~NativeMappedDataFile()
+{
+  ::munmap( const_cast<char*>( d_data ), d_file_size );
+}
+
+// Validate the mapped file
+void NativeMappedDataFile::validate() const
+{
+  TEST_FOR_EXCEPTION( std::memcmp( d_header->magic,
+                                   NativeMappedDataFile::getMagicString(),
+                                   sizeof(d_header->magic) ) != 0,
+                      std::runtime_error,
+                      "File " << d_file_name.string() << " is not a native "
+                      "mapped data file!" );
+
+  TEST_FOR_EXCEPTION( d_header->byte_order_mark !=
+                      NativeMappedDataFile::getByteOrderMark(),
+                      std::runtime_error,
+                      "Native mapped data file " << d_file_name.string() <<
+                      " was created on a machine with a different byte "
+                      "order!" );
+
+  TEST_FOR_EXCEPTION( d_header->version !=
+                      NativeMappedDataFile::getFormatVersion(),
+                      std::runtime_error,
+                      "Native mapped data file " << d_file_name.string() <<
+                      " has an unsupported format version ("
+                      << d_header->version << ")!" );
+
+  TEST_FOR_EXCEPTION( d_header->file_size != d_file_size,
+                      std::runtime_error,
+                      "Native mapped data file " << d_file_name.string() <<
+                      " has been truncated!" );
+
+  TEST_FOR_EXCEPTION( d_header->entry_table_offset < sizeof(FileHeader) ||
+                      d_header->entry_table_offset > d_file_size ||
+                      d_header->entry_table_offset % alignof(EntryRecord) != 0 ||
+                      d_header->number_of_entries >
+                      (d_file_size - d_header->entry_table_offset)/
+                      sizeof(EntryRecord),
+                      std::runtime_error,
+                      "The entry table of native mapped data file "
+                      << d_file_name.string() << " is corrupt!" );
+
+  const EntryRecord* entries =
+    reinterpret_cast<const EntryRecord*>( d_data+d_header->entry_table_offset );
+
+  for( size_t i = 0; i < d_header->number_of_entries; ++i )
+  {
+    const EntryRecord& entry = entries[i];
+
+    size_t element_size;
+
+    switch( entry.type )
+    {
+      case DOUBLE_ENTRY: element_size = sizeof(double); break;
+      case UNSIGNED_ENTRY: element_size = sizeof(unsigned); break;
+      case SIZE_ENTRY: element_size = sizeof(std::uint64_t); break;
+      case CHAR_ENTRY: element_size = sizeof(char); break;
+      default:
+      {
+        THROW_EXCEPTION( std::runtime_error,
+                         "Entry " << i << " of native mapped data file "
+                         << d_file_name.string() << " has an unknown type ("
+                         << entry.type << ")!" );
+      }
+    }
+
+    TEST_FOR_EXCEPTION( entry.name_offset < d_header->string_table_offset ||
+                        entry.name_offset > d_file_size ||
+                        entry.name_length > d_file_size - entry.name_offset,
+                        std::runtime_error,
+                        "The name of entry " << i << " of native mapped "
+                        "data file " << d_file_name.string() <<
+                        " is corrupt!" );
+
+    TEST_FOR_EXCEPTION( entry.data_offset > d_file_size ||
+                        entry.data_offset % element_size != 0 ||
+                        entry.number_of_elements >
+                        (d_file_size - entry.data_offset)/element_size,
+                        std::runtime_error,
+                        "The data of entry " << i << " of native mapped "
+                        "data file " << d_file_name.string() <<
+                        " is corrupt!" );
+  }
+}
+
+// Return the file name
+const boost::filesystem::path& NativeMappedDataFile::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the size of the mapped file (bytes)
+size_t NativeMappedDataFile::getFileSize() const
+{
+  return d_file_size;
+}
+
+// Return the number of entries
+size_t NativeMappedDataFile::getNumberOfEntries() const
+{
+  return d_header->number_of_entries;
+}
+
+// Check if an entry exists
+bool NativeMappedDataFile::hasEntry( const std::string& name ) const
+{
+  return this->findEntry( name ) != NULL;
+}
+
+// Return the number of elements in an entry
+size_t NativeMappedDataFile::getNumberOfElements(
+                                                const std::string& name ) const
+{
+  const EntryRecord* entry = this->findEntry( name );
+
+  TEST_FOR_EXCEPTION( entry == NULL,
+                      std::runtime_error,
+                      "Entry " << name << " could not be found in native "
+                      "mapped data file " << d_file_name.string() << "!" );
+
+  return entry->number_of_elements;
+}
+
+// Return a string entry
+std::string NativeMappedDataFile::getString( const std::string& name ) const
+{
+  Utility::ArrayView<const char> characters = this->getArray<char>( name );
+
+  return std::string( characters.begin(), characters.end() );
+}
+
+// Find the entry record with the desired name
+/*! \details The entry records are sorted by name so a binary search can be
+ * used. The names are compared in place so no memory is allocated.
+ */
+const NativeMappedDataFile::EntryRecord*
+NativeMappedDataFile::findEntry( const std::string& name ) const
+{
+  const EntryRecord* entries_end = d_entries + d_header->number_of_entries;
+
+  const EntryRecord* entry =
+    std::lower_bound( d_entries, entries_end, name,
+                      [this]( const EntryRecord& record,
+                              const std::string& searched_name )
+                      {
+                        return searched_name.compare( 0, searched_name.size(),
+                                                      d_data + record.name_offset,
+                                                      record.name_length ) > 0;
+                      } );
+
+  if( entry != entries_end &&
+      name.compare( 0, name.size(),
+                    d_data + entry->name_offset,
+                    entry->name_length ) == 0 )
+    return entry;
+  else
+    return NULL;
+}
+
+// Find the entry record with the desired name (throw if not found)
+const NativeMappedDataFile::EntryRecord& NativeMappedDataFile::getEntry(
+                                                  const std::string& name,
+                                                  const EntryType type ) const
+{
+  const EntryRecord* entry = this->findEntry( name );
+
+  TEST_FOR_EXCEPTION( entry == NULL,
+                      std::runtime_error,
+                      "Entry " << name << " could not be found in native "
+                      "mapped data file " << d_file_name.string() << "!" );
+
+  TEST_FOR_EXCEPTION( entry->type != type,
+                      std::runtime_error,
+                      "Entry " << name << " of native mapped data file "
+                      << d_file_name.string() << " does not have the "
+                      "requested type!" );
+
+  return *entry;
+}
+
+// The magic string that starts every native mapped data file
+const char* NativeMappedDataFile::getMagicString()
+{
+  return "FRNSMAP";
+}
+
+// The current native mapped data file format version
+std::uint32_t NativeMappedDataFile::getFormatVersion()
+{
+  return 1u;
+}
+
+// The byte order mark
+std::uint32_t NativeMappedDataFile::getByteOrderMark()
+{
+  return 0x01020304u;
+}
+
+// The data block alignment (bytes)
+size_t NativeMappedDataFile::getDataAlignment()
+{
+  return 64;
+}
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_NativeMappedDataFile.cpp
+//---------------------------------------------------------------------------//
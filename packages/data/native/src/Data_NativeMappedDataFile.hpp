@@ -0,0 +1,224 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_NativeMappedDataFile.hpp
+//! \author Alex Robinson
+//! \brief  The native memory-mapped data file class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_NATIVE_MAPPED_DATA_FILE_HPP
+#define DATA_NATIVE_MAPPED_DATA_FILE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "Utility_ArrayView.hpp"
+
+namespace Data{
+
+/*! The native memory-mapped data file
+ *
+ * \details A native mapped data file is a flat binary file of named,
+ * contiguous arrays. The file is mapped read-only into memory so that the
+ * arrays can be accessed through views without deserializing or copying
+ * them. Because the mapping is shared, all processes on a node that open
+ * the same file share a single copy of the data through the page cache.
+ *
+ * The file layout is a fixed size header, a table of entry records sorted by
+ * entry name, a string table with the entry names and the data blocks. Every
+ * data block starts on a 64 byte boundary. Indexed arrays (e.g. data that
+ * is stored in a std::map<unsigned,std::vector<double> > by the archivable
+ * data containers) are stored as three entries: name/keys, name/offsets and
+ * name/values. Indexed values (e.g. a std::map<unsigned,double>) are stored
+ * as two entries: name/keys and name/values. Native mapped data files are
+ * created with the Data::NativeMappedDataFileWriter.
+ */
+class NativeMappedDataFile
+{
+
+public:
+
+  //! The entry types
+  enum EntryType : std::uint32_t
+  {
+    DOUBLE_ENTRY = 0,
+    UNSIGNED_ENTRY = 1,
+    SIZE_ENTRY = 2,
+    CHAR_ENTRY = 3
+  };
+
+  //! The file header
+  struct FileHeader
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order_mark;
+    std::uint64_t number_of_entries;
+    std::uint64_t entry_table_offset;
+    std::uint64_t string_table_offset;
+    std::uint64_t file_size;
+    std::uint64_t reserved[2];
+  };
+
+  //! The entry record
+  struct EntryRecord
+  {
+    std::uint64_t name_offset;
+    std::uint64_t name_length;
+    std::uint64_t data_offset;
+    std::uint64_t number_of_elements;
+    std::uint32_t type;
+    std::uint32_t reserved;
+  };
+
+  //! The type traits of an entry value type
+  template<typename T>
+  struct EntryTypeTraits;
+
+  //! Constructor
+  NativeMappedDataFile( const boost::filesystem::path& file_name_with_path );
+
+  //! Destructor
+  ~NativeMappedDataFile();
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the size of the mapped file (bytes)
+  size_t getFileSize() const;
+
+  //! Return the number of entries
+  size_t getNumberOfEntries() const;
+
+  //! Check if an entry exists
+  bool hasEntry( const std::string& name ) const;
+
+  //! Return the number of elements in an entry
+  size_t getNumberOfElements( const std::string& name ) const;
+
+  //! Return a view of an array entry
+  template<typename T>
+  Utility::ArrayView<const T> getArray( const std::string& name ) const;
+
+  //! Return a single value entry
+  template<typename T>
+  T getValue( const std::string& name ) const;
+
+  //! Return a string entry
+  std::string getString( const std::string& name ) const;
+
+  //! Return the keys of an indexed array or indexed value entry
+  template<typename KeyType>
+  Utility::ArrayView<const KeyType> getKeys( const std::string& name ) const;
+
+  //! Check if an indexed array or indexed value entry has a key
+  template<typename KeyType>
+  bool hasKey( const std::string& name, const KeyType key ) const;
+
+  //! Return a view of the array stored with a key in an indexed array entry
+  template<typename T, typename KeyType>
+  Utility::ArrayView<const T> getIndexedArray( const std::string& name,
+                                               const KeyType key ) const;
+
+  //! Return the value stored with a key in an indexed value entry
+  template<typename T, typename KeyType>
+  T getIndexedValue( const std::string& name, const KeyType key ) const;
+
+  //! The magic string that starts every native mapped data file
+  static const char* getMagicString();
+
+  //! The current native mapped data file format version
+  static std::uint32_t getFormatVersion();
+
+  //! The byte order mark
+  static std::uint32_t getByteOrderMark();
+
+  //! The data block alignment (bytes)
+  static size_t getDataAlignment();
+
+private:
+
+  // Copy constructor
+  NativeMappedDataFile( const NativeMappedDataFile& other );
+
+  // Assignment operator
+  NativeMappedDataFile& operator=( const NativeMappedDataFile& other );
+
+  // Validate the mapped file
+  void validate() const;
+
+  // Find the entry record with the desired name
+  const EntryRecord* findEntry( const std::string& name ) const;
+
+  // Find the entry record with the desired name (throw if not found)
+  const EntryRecord& getEntry( const std::string& name,
+                               const EntryType type ) const;
+
+  // Return the index of a key in an indexed entry
+  template<typename KeyType>
+  size_t getKeyIndex( const std::string& name, const KeyType key ) const;
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The mapped file size
+  size_t d_file_size;
+
+  // The start of the mapped file
+  const char* d_data;
+
+  // The file header
+  const FileHeader* d_header;
+
+  // The entry records (sorted by name)
+  const EntryRecord* d_entries;
+};
+
+//! The type traits of a double entry
+template<>
+struct NativeMappedDataFile::EntryTypeTraits<double>
+{
+  static const EntryType type = DOUBLE_ENTRY;
+};
+
+//! The type traits of an unsigned entry
+template<>
+struct NativeMappedDataFile::EntryTypeTraits<unsigned>
+{
+  static const EntryType type = UNSIGNED_ENTRY;
+};
+
+//! The type traits of a size entry
+template<>
+struct NativeMappedDataFile::EntryTypeTraits<std::uint64_t>
+{
+  static const EntryType type = SIZE_ENTRY;
+};
+
+//! The type traits of a char entry
+template<>
+struct NativeMappedDataFile::EntryTypeTraits<char>
+{
+  static const EntryType type = CHAR_ENTRY;
+};
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Data_NativeMappedDataFile_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end DATA_NATIVE_MAPPED_DATA_FILE_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_NativeMappedDataFile.hpp
+//---------------------------------------------------------------------------//
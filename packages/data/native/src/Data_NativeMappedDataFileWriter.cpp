@@ -0,0 +1,196 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_NativeMappedDataFileWriter.cpp
+//! \author Alex Robinson
+//! \brief  The native memory-mapped data file writer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+#include <cstring>
+
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+
+// FRENSIE Includes
+#include "Data_NativeMappedDataFileWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Data{
+
+// Add a string entry
+void NativeMappedDataFileWriter::addString( const std::string& name,
+                                            const std::string& string )
+{
+  this->addEntry( name,
+                  NativeMappedDataFile::CHAR_ENTRY,
+                  string.size(),
+                  string.data(),
+                  string.size() );
+}
+
+// Add an entry
+void NativeMappedDataFileWriter::addEntry(
+                                const std::string& name,
+                                const NativeMappedDataFile::EntryType type,
+                                const size_t number_of_elements,
+                                const char* bytes,
+                                const size_t number_of_bytes )
+{
+  // Make sure that the name is valid
+  testPrecondition( name.size() > 0 );
+
+  TEST_FOR_EXCEPTION( d_entries.find( name ) != d_entries.end(),
+                      std::runtime_error,
+                      "Entry " << name << " has already been added to the "
+                      "native mapped data file!" );
+
+  Entry& entry = d_entries[name];
+
+  entry.type = type;
+  entry.number_of_elements = number_of_elements;
+  entry.bytes.assign( bytes, bytes+number_of_bytes );
+}
+
+// Check if an entry has been added
+bool NativeMappedDataFileWriter::hasEntry( const std::string& name ) const
+{
+  return d_entries.find( name ) != d_entries.end();
+}
+
+// Return the number of entries that have been added
+size_t NativeMappedDataFileWriter::getNumberOfEntries() const
+{
+  return d_entries.size();
+}
+
+// Write the native mapped data file
+/*! \details The file is first written to a temporary file which is then
+ * renamed. Processes that have the old file mapped will continue to see the
+ * old (unmodified) data.
+ */
+void NativeMappedDataFileWriter::write(
+                         const boost::filesystem::path& file_name_with_path,
+                         const bool overwrite ) const
+{
+  TEST_FOR_EXCEPTION( !overwrite &&
+                      boost::filesystem::exists( file_name_with_path ),
+                      std::runtime_error,
+                      "Native mapped data file "
+                      << file_name_with_path.string() << " already exists!" );
+
+  const size_t alignment = NativeMappedDataFile::getDataAlignment();
+
+  auto align = [alignment]( const size_t offset ) -> size_t
+  { return ((offset + alignment - 1)/alignment)*alignment; };
+
+  // Lay out the file
+  NativeMappedDataFile::FileHeader header;
+  std::memset( &header, 0, sizeof(header) );
+
+  std::memcpy( header.magic,
+               NativeMappedDataFile::getMagicString(),
+               sizeof(header.magic) );
+
+  header.version = NativeMappedDataFile::getFormatVersion();
+  header.byte_order_mark = NativeMappedDataFile::getByteOrderMark();
+  header.number_of_entries = d_entries.size();
+  header.entry_table_offset = sizeof(header);
+  header.string_table_offset = header.entry_table_offset +
+    d_entries.size()*sizeof(NativeMappedDataFile::EntryRecord);
+
+  std::vector<NativeMappedDataFile::EntryRecord> entry_records;
+  entry_records.reserve( d_entries.size() );
+
+  size_t name_offset = header.string_table_offset;
+
+  for( auto&& entry : d_entries )
+  {
+    NativeMappedDataFile::EntryRecord entry_record;
+    std::memset( &entry_record, 0, sizeof(entry_record) );
+
+    entry_record.name_offset = name_offset;
+    entry_record.name_length = entry.first.size();
+    entry_record.number_of_elements = entry.second.number_of_elements;
+    entry_record.type = entry.second.type;
+
+    name_offset += entry.first.size();
+
+    entry_records.push_back( entry_record );
+  }
+
+  // Every data block starts on an aligned offset after the string table
+  size_t data_offset = align( name_offset );
+
+  {
+    size_t entry_index = 0;
+
+    for( auto&& entry : d_entries )
+    {
+      entry_records[entry_index].data_offset = data_offset;
+
+      data_offset = align( data_offset + entry.second.bytes.size() );
+
+      ++entry_index;
+    }
+  }
+
+  header.file_size = data_offset;
+
+  // Write the file
+  boost::filesystem::path tmp_file_name_with_path = file_name_with_path;
+  tmp_file_name_with_path += ".tmp";
+
+  {
+    std::ofstream file( tmp_file_name_with_path.string(),
+                        std::ios::binary | std::ios::trunc );
+
+    TEST_FOR_EXCEPTION( !file.good(),
+                        std::runtime_error,
+                        "Native mapped data file "
+                        << tmp_file_name_with_path.string() <<
+                        " could not be created!" );
+
+    file.write( reinterpret_cast<const char*>( &header ), sizeof(header) );
+
+    file.write( reinterpret_cast<const char*>( entry_records.data() ),
+                entry_records.size()*sizeof(NativeMappedDataFile::EntryRecord) );
+
+    for( auto&& entry : d_entries )
+      file.write( entry.first.data(), entry.first.size() );
+
+    const std::vector<char> padding( alignment, '\0' );
+
+    size_t current_offset = name_offset;
+    size_t entry_index = 0;
+
+    for( auto&& entry : d_entries )
+    {
+      const size_t entry_offset = entry_records[entry_index].data_offset;
+
+      file.write( padding.data(), entry_offset - current_offset );
+      file.write( entry.second.bytes.data(), entry.second.bytes.size() );
+
+      current_offset = entry_offset + entry.second.bytes.size();
+      ++entry_index;
+    }
+
+    file.write( padding.data(), header.file_size - current_offset );
+
+    TEST_FOR_EXCEPTION( !file.good(),
+                        std::runtime_error,
+                        "Native mapped data file "
+                        << tmp_file_name_with_path.string() <<
+                        " could not be written!" );
+  }
+
+  boost::filesystem::rename( tmp_file_name_with_path, file_name_with_path );
+}
+
+} // end Data namespace
+
+//---------------------------------------------------------------------------//
+// end Data_NativeMappedDataFileWriter.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,190 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_NativeMappedDataFileWriter.hpp
+//! \author Alex Robinson
+//! \brief  The native memory-mapped data file writer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_NATIVE_MAPPED_DATA_FILE_WRITER_HPP
+#define DATA_NATIVE_MAPPED_DATA_FILE_WRITER_HPP
+
+// Std Lib Includes
+#include <string>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+// FRENSIE Includes
+#include "Data_NativeMappedDataFile.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_Set.hpp"
+
+namespace Data{
+
+/*! The native memory-mapped data file writer
+ *
+ * \details The entries are buffered in memory until the file is written.
+ * See Data::NativeMappedDataFile for a description of the file layout.
+ */
+class NativeMappedDataFileWriter
+{
+
+public:
+
+  //! Constructor
+  NativeMappedDataFileWriter()
+  { /* ... */ }
+
+  //! Destructor
+  ~NativeMappedDataFileWriter()
+  { /* ... */ }
+
+  //! Add an array entry
+  template<typename T>
+  void addArray( const std::string& name, const std::vector<T>& array );
+
+  //! Add a set entry (stored as a sorted array)
+  template<typename T>
+  void addArray( const std::string& name, const std::set<T>& set );
+
+  //! Add a single value entry
+  template<typename T>
+  void addValue( const std::string& name, const T value );
+
+  //! Add a string entry
+  void addString( const std::string& name, const std::string& string );
+
+  //! Add an indexed array entry
+  template<typename KeyType, typename T>
+  void addIndexedArrays( const std::string& name,
+                         const std::map<KeyType,std::vector<T> >& arrays );
+
+  //! Add an indexed value entry
+  template<typename KeyType, typename T>
+  void addIndexedValues( const std::string& name,
+                         const std::map<KeyType,T>& values );
+
+  //! Check if an entry has been added
+  bool hasEntry( const std::string& name ) const;
+
+  //! Return the number of entries that have been added
+  size_t getNumberOfEntries() const;
+
+  //! Write the native mapped data file
+  void write( const boost::filesystem::path& file_name_with_path,
+              const bool overwrite = false ) const;
+
+private:
+
+  // The buffered entry
+  struct Entry
+  {
+    NativeMappedDataFile::EntryType type;
+    size_t number_of_elements;
+    std::vector<char> bytes;
+  };
+
+  // Add an entry
+  void addEntry( const std::string& name,
+                 const NativeMappedDataFile::EntryType type,
+                 const size_t number_of_elements,
+                 const char* bytes,
+                 const size_t number_of_bytes );
+
+  // The buffered entries (sorted by name)
+  std::map<std::string,Entry> d_entries;
+};
+
+// Add an array entry
+template<typename T>
+inline void NativeMappedDataFileWriter::addArray( const std::string& name,
+                                                  const std::vector<T>& array )
+{
+  this->addEntry( name,
+                  NativeMappedDataFile::EntryTypeTraits<T>::type,
+                  array.size(),
+                  reinterpret_cast<const char*>( array.data() ),
+                  array.size()*sizeof(T) );
+}
+
+// Add a set entry (stored as a sorted array)
+template<typename T>
+inline void NativeMappedDataFileWriter::addArray( const std::string& name,
+                                                  const std::set<T>& set )
+{
+  this->addArray( name, std::vector<T>( set.begin(), set.end() ) );
+}
+
+// Add a single value entry
+template<typename T>
+inline void NativeMappedDataFileWriter::addValue( const std::string& name,
+                                                  const T value )
+{
+  this->addEntry( name,
+                  NativeMappedDataFile::EntryTypeTraits<T>::type,
+                  1,
+                  reinterpret_cast<const char*>( &value ),
+                  sizeof(T) );
+}
+
+// Add an indexed array entry
+template<typename KeyType, typename T>
+void NativeMappedDataFileWriter::addIndexedArrays(
+                              const std::string& name,
+                              const std::map<KeyType,std::vector<T> >& arrays )
+{
+  std::vector<KeyType> keys;
+  keys.reserve( arrays.size() );
+
+  std::vector<std::uint64_t> offsets( 1, 0 );
+  offsets.reserve( arrays.size()+1 );
+
+  std::vector<T> values;
+
+  for( auto&& key_array_pair : arrays )
+  {
+    keys.push_back( key_array_pair.first );
+
+    values.insert( values.end(),
+                   key_array_pair.second.begin(),
+                   key_array_pair.second.end() );
+
+    offsets.push_back( values.size() );
+  }
+
+  this->addArray( name + "/keys", keys );
+  this->addArray( name + "/offsets", offsets );
+  this->addArray( name + "/values", values );
+}
+
+// Add an indexed value entry
+template<typename KeyType, typename T>
+void NativeMappedDataFileWriter::addIndexedValues(
+                                             const std::string& name,
+                                             const std::map<KeyType,T>& values )
+{
+  std::vector<KeyType> keys;
+  keys.reserve( values.size() );
+
+  std::vector<T> flat_values;
+  flat_values.reserve( values.size() );
+
+  for( auto&& key_value_pair : values )
+  {
+    keys.push_back( key_value_pair.first );
+    flat_values.push_back( key_value_pair.second );
+  }
+
+  this->addArray( name + "/keys", keys );
+  this->addArray( name + "/values", flat_values );
+}
+
+} // end Data namespace
+
+#endif // end DATA_NATIVE_MAPPED_DATA_FILE_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_NativeMappedDataFileWriter.hpp
+//---------------------------------------------------------------------------//
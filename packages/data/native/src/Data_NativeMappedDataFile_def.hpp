@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Data_NativeMappedDataFile_def.hpp
+//! \author Alex Robinson
+//! \brief  The native memory-mapped data file class template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_NATIVE_MAPPED_DATA_FILE_DEF_HPP
+#define DATA_NATIVE_MAPPED_DATA_FILE_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ToStringTraits.hpp"
+
+namespace Data{
+
+// Return a view of an array entry
+template<typename T>
+Utility::ArrayView<const T> NativeMappedDataFile::getArray(
+                                                const std::string& name ) const
+{
+  const EntryRecord& entry =
+    this->getEntry( name, EntryTypeTraits<T>::type );
+
+  const T* array_start =
+    reinterpret_cast<const T*>( d_data + entry.data_offset );
+
+  return Utility::ArrayView<const T>( array_start, entry.number_of_elements );
+}
+
+// Return a single value entry
+template<typename T>
+T NativeMappedDataFile::getValue( const std::string& name ) const
+{
+  Utility::ArrayView<const T> value = this->getArray<T>( name );
+
+  TEST_FOR_EXCEPTION( value.size() != 1,
+                      std::runtime_error,
+                      "Entry " << name << " of native mapped data file "
+                      << d_file_name.string() << " is not a single value!" );
+
+  return value.front();
+}
+
+// Return the keys of an indexed array or indexed value entry
+template<typename KeyType>
+inline Utility::ArrayView<const KeyType> NativeMappedDataFile::getKeys(
+                                                const std::string& name ) const
+{
+  return this->getArray<KeyType>( name + "/keys" );
+}
+
+// Check if an indexed array or indexed value entry has a key
+template<typename KeyType>
+bool NativeMappedDataFile::hasKey( const std::string& name,
+                                   const KeyType key ) const
+{
+  if( !this->hasEntry( name + "/keys" ) )
+    return false;
+
+  Utility::ArrayView<const KeyType> keys = this->getKeys<KeyType>( name );
+
+  return std::binary_search( keys.begin(), keys.end(), key );
+}
+
+// Return a view of the array stored with a key in an indexed array entry
+template<typename T, typename KeyType>
+Utility::ArrayView<const T> NativeMappedDataFile::getIndexedArray(
+                                                      const std::string& name,
+                                                      const KeyType key ) const
+{
+  const size_t key_index = this->getKeyIndex( name, key );
+
+  Utility::ArrayView<const std::uint64_t> offsets =
+    this->getArray<std::uint64_t>( name + "/offsets" );
+
+  Utility::ArrayView<const T> values = this->getArray<T>( name + "/values" );
+
+  TEST_FOR_EXCEPTION( offsets.size() != this->getKeys<KeyType>( name ).size()+1,
+                      std::runtime_error,
+                      "The offsets of indexed entry " << name << " of "
+                      "native mapped data file " << d_file_name.string() <<
+                      " are corrupt!" );
+
+  TEST_FOR_EXCEPTION( offsets[key_index+1] > values.size() ||
+                      offsets[key_index] > offsets[key_index+1],
+                      std::runtime_error,
+                      "The offsets of indexed entry " << name << " of "
+                      "native mapped data file " << d_file_name.string() <<
+                      " are corrupt!" );
+
+  return values( offsets[key_index],
+                 offsets[key_index+1] - offsets[key_index] );
+}
+
+// Return the value stored with a key in an indexed value entry
+template<typename T, typename KeyType>
+T NativeMappedDataFile::getIndexedValue( const std::string& name,
+                                         const KeyType key ) const
+{
+  const size_t key_index = this->getKeyIndex( name, key );
+
+  Utility::ArrayView<const T> values = this->getArray<T>( name + "/values" );
+
+  TEST_FOR_EXCEPTION( values.size() != this->getKeys<KeyType>( name ).size(),
+                      std::runtime_error,
+                      "The values of indexed entry " << name << " of "
+                      "native mapped data file " << d_file_name.string() <<
+                      " are corrupt!" );
+
+  return values[key_index];
+}
+
+// Return the index of a key in an indexed entry
+template<typename KeyType>
+size_t NativeMappedDataFile::getKeyIndex( const std::string& name,
+                                          const KeyType key ) const
+{
+  Utility::ArrayView<const KeyType> keys = this->getKeys<KeyType>( name );
+
+  const KeyType* key_it = std::lower_bound( keys.begin(), keys.end(), key );
+
+  TEST_FOR_EXCEPTION( key_it == keys.end() || *key_it != key,
+                      std::runtime_error,
+                      "Key " << Utility::toString( key ) << " could not be "
+                      "found in indexed entry " << name << " of native "
+                      "mapped data file " << d_file_name.string() << "!" );
+
+  return key_it - keys.begin();
+}
+
+} // end Data namespace
+
+#endif // end DATA_NATIVE_MAPPED_DATA_FILE_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Data_NativeMappedDataFile_def.hpp
+//---------------------------------------------------------------------------//
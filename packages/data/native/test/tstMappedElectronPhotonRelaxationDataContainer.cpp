@@ -0,0 +1,382 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstMappedElectronPhotonRelaxationDataContainer.cpp
+//! \author Alex Robinson
+//! \brief  Memory-mapped electron-photon-relaxation data container tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "Data_ElectronPhotonRelaxationVolatileDataContainer.hpp"
+#include "Data_MappedElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+const std::string test_file_name( "test_mapped_epr_data_container.fmap" );
+
+std::unique_ptr<const Data::MappedElectronPhotonRelaxationDataContainer>
+mapped_data_container;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the test data container
+void createTestDataContainer(
+                Data::ElectronPhotonRelaxationVolatileDataContainer& container )
+{
+  container.setNotes( "This is a test data table. Do not use it for "
+                      "anything other than tests!" );
+
+  // Table data
+  container.setAtomicNumber( 1u );
+  container.setAtomicWeight( 1.0 );
+  container.setMinPhotonEnergy( 0.001 );
+  container.setMaxPhotonEnergy( 20.0 );
+  container.setMinElectronEnergy( 1.0e-5 );
+  container.setMaxElectronEnergy( 1.0e5 );
+  container.setOccupationNumberEvaluationTolerance( 1e-3 );
+  container.setSubshellIncoherentEvaluationTolerance( 1e-3 );
+  container.setPhotonThresholdEnergyNudgeFactor( 1.0001 );
+  container.setCutoffAngleCosine( 0.9 );
+  container.setNumberOfMomentPreservingAngles( 2 );
+  container.setElectronTabularEvaluationTolerance( 1e-7 );
+  container.setPhotonGridConvergenceTolerance( 0.001 );
+  container.setPhotonGridAbsoluteDifferenceTolerance( 1e-42 );
+  container.setPhotonGridDistanceTolerance( 1e-15 );
+  container.setElectronGridConvergenceTolerance( 0.002 );
+  container.setElectronGridAbsoluteDifferenceTolerance( 1e-41 );
+  container.setElectronGridDistanceTolerance( 1e-14 );
+  container.setBremsstrahlungEvaluationTolerance( 0.003 );
+  container.setBremsstrahlungGridConvergenceTolerance( 0.004 );
+  container.setBremsstrahlungAbsoluteDifferenceTolerance( 1e-40 );
+  container.setBremsstrahlungDistanceTolerance( 1e-13 );
+  container.setElectroionizationEvaluationTolerance( 0.005 );
+  container.setElectroionizationGridConvergenceTolerance( 0.006 );
+  container.setElectroionizationAbsoluteDifferenceTolerance( 1e-39 );
+  container.setElectroionizationDistanceTolerance( 1e-12 );
+
+  // Relaxation data
+  container.setSubshells( std::set<unsigned>( {1, 3} ) );
+  container.setSubshellOccupancy( 1, 1.0 );
+  container.setSubshellOccupancy( 3, 2.0 );
+  container.setSubshellBindingEnergy( 1, 1.361e-5 );
+  container.setSubshellBindingEnergy( 3, 1.0e-6 );
+  container.setSubshellRelaxationTransitions( 1, 2 );
+  container.setSubshellRelaxationVacancies( 1, std::vector<std::pair<unsigned,unsigned> >( {std::make_pair( 3u, 0u ), std::make_pair( 3u, 3u )} ) );
+  container.setSubshellRelaxationParticleEnergies( 1, std::vector<double>( {1e-5, 5e-6} ) );
+  container.setSubshellRelaxationProbabilities( 1, std::vector<double>( {0.25, 0.75} ) );
+
+  // Photon data
+  container.setComptonProfileMomentumGrid( 1, std::vector<double>( {-1.0, 0.0, 1.0} ) );
+  container.setComptonProfile( 1, std::vector<double>( {1e-6, 1.0, 1e-6} ) );
+  container.setComptonProfileMomentumGrid( 3, std::vector<double>( {-1.0, 1.0} ) );
+  container.setComptonProfile( 3, std::vector<double>( {1e-6, 1e-6} ) );
+  container.setOccupationNumberMomentumGrid( 1, std::vector<double>( {-1.0, 0.0, 1.0} ) );
+  container.setOccupationNumber( 1, std::vector<double>( {0.0, 0.5, 1.0} ) );
+  container.setWallerHartreeScatteringFunctionMomentumGrid( std::vector<double>( {1.0, 30.0} ) );
+  container.setWallerHartreeScatteringFunction( std::vector<double>( {1e-30, 1.0} ) );
+  container.setWallerHartreeAtomicFormFactorMomentumGrid( std::vector<double>( {1.0, 30.0} ) );
+  container.setWallerHartreeAtomicFormFactor( std::vector<double>( {1.0, 1e-30} ) );
+  container.setWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid( std::vector<double>( {1.0, 900.0} ) );
+  container.setWallerHartreeSquaredAtomicFormFactor( std::vector<double>( {1.0, 1e-60} ) );
+  container.setPhotonEnergyGrid( std::vector<double>( {0.001, 1.0, 20.0} ) );
+  container.setHasAveragePhotonHeatingNumbers( true );
+  container.setAveragePhotonHeatingNumbers( std::vector<double>( {1.0, 2.0, 3.0} ) );
+  container.setWallerHartreeIncoherentCrossSection( std::vector<double>( {1e-6, 1e-3, 1.0} ) );
+  container.setWallerHartreeIncoherentCrossSectionThresholdEnergyIndex( 0 );
+  container.setImpulseApproxIncoherentCrossSection( std::vector<double>( {1e-3, 1.0} ) );
+  container.setImpulseApproxIncoherentCrossSectionThresholdEnergyIndex( 1 );
+  container.setImpulseApproxSubshellIncoherentCrossSection( 1, std::vector<double>( {1e-3, 1.0} ) );
+  container.setImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex( 1, 1 );
+  container.setWallerHartreeCoherentCrossSection( std::vector<double>( {1e-6, 1e-3, 1.0} ) );
+  container.setWallerHartreeCoherentCrossSectionThresholdEnergyIndex( 0 );
+  container.setPairProductionCrossSection( std::vector<double>( {1.0} ) );
+  container.setPairProductionCrossSectionThresholdEnergyIndex( 2 );
+  container.setTripletProductionCrossSection( std::vector<double>( {2.0} ) );
+  container.setTripletProductionCrossSectionThresholdEnergyIndex( 2 );
+  container.setPhotoelectricCrossSection( std::vector<double>( {3.0, 2.0, 1.0} ) );
+  container.setPhotoelectricCrossSectionThresholdEnergyIndex( 0 );
+  container.setSubshellPhotoelectricCrossSection( 1, std::vector<double>( {3.0, 2.0, 1.0} ) );
+  container.setSubshellPhotoelectricCrossSectionThresholdEnergyIndex( 1, 0 );
+  container.setWallerHartreeTotalCrossSection( std::vector<double>( {4.0, 5.0, 6.0} ) );
+  container.setImpulseApproxTotalCrossSection( std::vector<double>( {7.0, 8.0, 9.0} ) );
+
+  // Electron data
+  container.setElectronTwoDInterpPolicy( "Lin-Lin-Lin" );
+  container.setElectronTwoDGridPolicy( "Unit-base Correlated" );
+  container.setElasticAngularEnergyGrid( std::vector<double>( {1.0, 2.0} ) );
+  container.setCutoffElasticInterpPolicy( "Lin-Lin" );
+
+  std::map<double,std::vector<double> > elastic_angles, elastic_pdf;
+  elastic_angles[1.0] = std::vector<double>( {-1.0, 0.0, 0.9} );
+  elastic_angles[2.0] = std::vector<double>( {-1.0, 0.9} );
+  elastic_pdf[1.0] = std::vector<double>( {0.1, 0.2, 0.7} );
+  elastic_pdf[2.0] = std::vector<double>( {0.5, 0.5} );
+
+  container.setCutoffElasticAngles( elastic_angles );
+  container.setCutoffElasticPDF( elastic_pdf );
+  container.setMomentPreservingCrossSectionReduction( std::vector<double>( {0.5, 0.6} ) );
+  container.setMomentPreservingElasticDiscreteAngles( 1.0, std::vector<double>( {0.91, 0.95} ) );
+  container.setMomentPreservingElasticWeights( 1.0, std::vector<double>( {0.4, 0.6} ) );
+  container.setMomentPreservingElasticDiscreteAngles( 2.0, std::vector<double>( {0.92, 0.96} ) );
+  container.setMomentPreservingElasticWeights( 2.0, std::vector<double>( {0.3, 0.7} ) );
+  container.setElectroionizationEnergyGrid( 1, std::vector<double>( {1.0, 2.0} ) );
+  container.setElectroionizationInterpPolicy( "Lin-Lin" );
+  container.setElectroionizationRecoilEnergyAtIncomingEnergy( 1, 1.0, std::vector<double>( {0.01, 0.001, 0.0001} ) );
+  container.setElectroionizationRecoilPDFAtIncomingEnergy( 1, 1.0, std::vector<double>( {1.0, 2.0, 5.0} ) );
+  container.setElectroionizationRecoilEnergyAtIncomingEnergy( 1, 2.0, std::vector<double>( {0.02, 0.002} ) );
+  container.setElectroionizationRecoilPDFAtIncomingEnergy( 1, 2.0, std::vector<double>( {1.0, 3.0} ) );
+  container.setBremsstrahlungEnergyGrid( std::vector<double>( {1.0, 2.0} ) );
+  container.setBremsstrahlungPhotonInterpPolicy( "Lin-Lin" );
+  container.setBremsstrahlungPhotonEnergyAtIncomingEnergy( 1.0, std::vector<double>( {0.01, 0.1, 1.0} ) );
+  container.setBremsstrahlungPhotonPDFAtIncomingEnergy( 1.0, std::vector<double>( {1.0, 2.0, 5.0} ) );
+  container.setBremsstrahlungPhotonEnergyAtIncomingEnergy( 2.0, std::vector<double>( {0.02, 2.0} ) );
+  container.setBremsstrahlungPhotonPDFAtIncomingEnergy( 2.0, std::vector<double>( {1.0, 7.0} ) );
+  container.setAtomicExcitationEnergyGrid( std::vector<double>( {1.0, 2.0} ) );
+  container.setAtomicExcitationEnergyLossInterpPolicy( "Lin-Lin" );
+  container.setAtomicExcitationEnergyLoss( std::vector<double>( {0.1, 0.2} ) );
+  container.setElectronEnergyGrid( std::vector<double>( {1e-5, 1.0, 1e5} ) );
+  container.setElectronCrossSectionInterpPolicy( "Lin-Lin" );
+  container.setTotalElectronCrossSection( std::vector<double>( {1.0, 2.0, 3.0} ) );
+  container.setCutoffElasticCrossSection( std::vector<double>( {4.0, 5.0, 6.0} ) );
+  container.setCutoffElasticCrossSectionThresholdEnergyIndex( 0 );
+  container.setScreenedRutherfordElasticCrossSection( std::vector<double>( {7.0, 8.0} ) );
+  container.setScreenedRutherfordElasticCrossSectionThresholdEnergyIndex( 1 );
+  container.setTotalElasticCrossSection( std::vector<double>( {9.0, 10.0, 11.0} ) );
+  container.setTotalElasticCrossSectionThresholdEnergyIndex( 0 );
+  container.setElectroionizationCrossSection( 1, std::vector<double>( {12.0} ) );
+  container.setElectroionizationCrossSectionThresholdEnergyIndex( 1, 2 );
+  container.setBremsstrahlungCrossSection( std::vector<double>( {13.0, 14.0, 15.0} ) );
+  container.setBremsstrahlungCrossSectionThresholdEnergyIndex( 0 );
+  container.setAtomicExcitationCrossSection( std::vector<double>( {16.0, 17.0} ) );
+  container.setAtomicExcitationCrossSectionThresholdEnergyIndex( 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a container can be converted to the mapped format and loaded
+FRENSIE_UNIT_TEST( MappedElectronPhotonRelaxationDataContainer, constructor )
+{
+  Data::ElectronPhotonRelaxationVolatileDataContainer data_container;
+
+  createTestDataContainer( data_container );
+
+  FRENSIE_REQUIRE_NO_THROW( data_container.saveToMappedFile( test_file_name, true ) );
+
+  FRENSIE_REQUIRE_NO_THROW( mapped_data_container.reset( new Data::MappedElectronPhotonRelaxationDataContainer( test_file_name ) ) );
+
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getMappedFile().getFileName().string(),
+                       test_file_name );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the table data can be returned
+FRENSIE_UNIT_TEST( MappedElectronPhotonRelaxationDataContainer, table_data )
+{
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getNotes(),
+                       "This is a test data table. Do not use it for "
+                       "anything other than tests!" );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getAtomicNumber(), 1u );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getAtomicWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getMinPhotonEnergy(), 0.001 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getMaxPhotonEnergy(), 20.0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getMinElectronEnergy(), 1.0e-5 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getMaxElectronEnergy(), 1.0e5 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getOccupationNumberEvaluationTolerance(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellIncoherentEvaluationTolerance(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPhotonThresholdEnergyNudgeFactor(), 1.0001 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getCutoffAngleCosine(), 0.9 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getNumberOfMomentPreservingAngles(), 2 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectronTabularEvaluationTolerance(), 1e-7 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPhotonGridConvergenceTolerance(), 0.001 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPhotonGridAbsoluteDifferenceTolerance(), 1e-42 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPhotonGridDistanceTolerance(), 1e-15 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectronGridConvergenceTolerance(), 0.002 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectronGridAbsoluteDifferenceTolerance(), 1e-41 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectronGridDistanceTolerance(), 1e-14 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungEvaluationTolerance(), 0.003 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungGridConvergenceTolerance(), 0.004 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungAbsoluteDifferenceTolerance(), 1e-40 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungDistanceTolerance(), 1e-13 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationEvaluationTolerance(), 0.005 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationGridConvergenceTolerance(), 0.006 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationAbsoluteDifferenceTolerance(), 1e-39 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationDistanceTolerance(), 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the relaxation data can be returned
+FRENSIE_UNIT_TEST( MappedElectronPhotonRelaxationDataContainer,
+                   relaxation_data )
+{
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshells(),
+                       std::vector<unsigned>( {1, 3} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellOccupancy( 1 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellOccupancy( 3 ), 2.0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellBindingEnergy( 1 ), 1.361e-5 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellBindingEnergy( 3 ), 1.0e-6 );
+  FRENSIE_CHECK( mapped_data_container->hasRelaxationData() );
+  FRENSIE_CHECK( mapped_data_container->hasSubshellRelaxationData( 1 ) );
+  FRENSIE_CHECK( !mapped_data_container->hasSubshellRelaxationData( 3 ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellRelaxationTransitions( 1 ), 2 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellRelaxationVacancies( 1 ),
+                       std::vector<unsigned>( {3, 0, 3, 3} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellRelaxationParticleEnergies( 1 ),
+                       std::vector<double>( {1e-5, 5e-6} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellRelaxationProbabilities( 1 ),
+                       std::vector<double>( {0.25, 0.75} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the photon data can be returned
+FRENSIE_UNIT_TEST( MappedElectronPhotonRelaxationDataContainer, photon_data )
+{
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getComptonProfileMomentumGrid( 1 ),
+                       std::vector<double>( {-1.0, 0.0, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getComptonProfile( 1 ),
+                       std::vector<double>( {1e-6, 1.0, 1e-6} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getComptonProfileMomentumGrid( 3 ),
+                       std::vector<double>( {-1.0, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getComptonProfile( 3 ),
+                       std::vector<double>( {1e-6, 1e-6} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getOccupationNumberMomentumGrid( 1 ),
+                       std::vector<double>( {-1.0, 0.0, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getOccupationNumber( 1 ),
+                       std::vector<double>( {0.0, 0.5, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeScatteringFunctionMomentumGrid(),
+                       std::vector<double>( {1.0, 30.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeScatteringFunction(),
+                       std::vector<double>( {1e-30, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeAtomicFormFactorMomentumGrid(),
+                       std::vector<double>( {1.0, 30.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeAtomicFormFactor(),
+                       std::vector<double>( {1.0, 1e-30} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid(),
+                       std::vector<double>( {1.0, 900.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeSquaredAtomicFormFactor(),
+                       std::vector<double>( {1.0, 1e-60} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPhotonEnergyGrid(),
+                       std::vector<double>( {0.001, 1.0, 20.0} ) );
+  FRENSIE_CHECK( mapped_data_container->hasAveragePhotonHeatingNumbers() );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getAveragePhotonHeatingNumbers(),
+                       std::vector<double>( {1.0, 2.0, 3.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeIncoherentCrossSection(),
+                       std::vector<double>( {1e-6, 1e-3, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeIncoherentCrossSectionThresholdEnergyIndex(), 0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getImpulseApproxIncoherentCrossSection(),
+                       std::vector<double>( {1e-3, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getImpulseApproxIncoherentCrossSectionThresholdEnergyIndex(), 1 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getImpulseApproxSubshellIncoherentCrossSection( 1 ),
+                       std::vector<double>( {1e-3, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex( 1 ), 1 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeCoherentCrossSection(),
+                       std::vector<double>( {1e-6, 1e-3, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeCoherentCrossSectionThresholdEnergyIndex(), 0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPairProductionCrossSection(),
+                       std::vector<double>( {1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPairProductionCrossSectionThresholdEnergyIndex(), 2 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getTripletProductionCrossSection(),
+                       std::vector<double>( {2.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getTripletProductionCrossSectionThresholdEnergyIndex(), 2 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPhotoelectricCrossSection(),
+                       std::vector<double>( {3.0, 2.0, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getPhotoelectricCrossSectionThresholdEnergyIndex(), 0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellPhotoelectricCrossSection( 1 ),
+                       std::vector<double>( {3.0, 2.0, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getSubshellPhotoelectricCrossSectionThresholdEnergyIndex( 1 ), 0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getWallerHartreeTotalCrossSection(),
+                       std::vector<double>( {4.0, 5.0, 6.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getImpulseApproxTotalCrossSection(),
+                       std::vector<double>( {7.0, 8.0, 9.0} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the electron data can be returned
+FRENSIE_UNIT_TEST( MappedElectronPhotonRelaxationDataContainer, electron_data )
+{
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectronTwoDInterpPolicy(),
+                       "Lin-Lin-Lin" );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectronTwoDGridPolicy(),
+                       "Unit-base Correlated" );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElasticAngularEnergyGrid(),
+                       std::vector<double>( {1.0, 2.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getCutoffElasticInterpPolicy(),
+                       "Lin-Lin" );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getCutoffElasticAngles( 1.0 ),
+                       std::vector<double>( {-1.0, 0.0, 0.9} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getCutoffElasticAngles( 2.0 ),
+                       std::vector<double>( {-1.0, 0.9} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getCutoffElasticPDF( 1.0 ),
+                       std::vector<double>( {0.1, 0.2, 0.7} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getCutoffElasticPDF( 2.0 ),
+                       std::vector<double>( {0.5, 0.5} ) );
+  FRENSIE_CHECK( mapped_data_container->hasMomentPreservingData() );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getMomentPreservingCrossSectionReduction(),
+                       std::vector<double>( {0.5, 0.6} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getMomentPreservingElasticDiscreteAngles( 2.0 ),
+                       std::vector<double>( {0.92, 0.96} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getMomentPreservingElasticWeights( 1.0 ),
+                       std::vector<double>( {0.4, 0.6} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationEnergyGrid( 1 ),
+                       std::vector<double>( {1.0, 2.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationInterpPolicy(),
+                       "Lin-Lin" );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationRecoilEnergy( 1, 1.0 ),
+                       std::vector<double>( {0.01, 0.001, 0.0001} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationRecoilEnergy( 1, 2.0 ),
+                       std::vector<double>( {0.02, 0.002} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationRecoilPDF( 1, 2.0 ),
+                       std::vector<double>( {1.0, 3.0} ) );
+  FRENSIE_CHECK( !mapped_data_container->hasElectroionizationOutgoingEnergyData() );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungEnergyGrid(),
+                       std::vector<double>( {1.0, 2.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungPhotonInterpPolicy(),
+                       "Lin-Lin" );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungPhotonEnergy( 1.0 ),
+                       std::vector<double>( {0.01, 0.1, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungPhotonPDF( 2.0 ),
+                       std::vector<double>( {1.0, 7.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getAtomicExcitationEnergyGrid(),
+                       std::vector<double>( {1.0, 2.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getAtomicExcitationEnergyLossInterpPolicy(),
+                       "Lin-Lin" );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getAtomicExcitationEnergyLoss(),
+                       std::vector<double>( {0.1, 0.2} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectronEnergyGrid(),
+                       std::vector<double>( {1e-5, 1.0, 1e5} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectronCrossSectionInterpPolicy(),
+                       "Lin-Lin" );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getTotalElectronCrossSection(),
+                       std::vector<double>( {1.0, 2.0, 3.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getCutoffElasticCrossSection(),
+                       std::vector<double>( {4.0, 5.0, 6.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getCutoffElasticCrossSectionThresholdEnergyIndex(), 0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getScreenedRutherfordElasticCrossSection(),
+                       std::vector<double>( {7.0, 8.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex(), 1 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getTotalElasticCrossSection(),
+                       std::vector<double>( {9.0, 10.0, 11.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getTotalElasticCrossSectionThresholdEnergyIndex(), 0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationCrossSection( 1 ),
+                       std::vector<double>( {12.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getElectroionizationCrossSectionThresholdEnergyIndex( 1 ), 2 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungCrossSection(),
+                       std::vector<double>( {13.0, 14.0, 15.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getBremsstrahlungCrossSectionThresholdEnergyIndex(), 0 );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getAtomicExcitationCrossSection(),
+                       std::vector<double>( {16.0, 17.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_data_container->getAtomicExcitationCrossSectionThresholdEnergyIndex(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstMappedElectronPhotonRelaxationDataContainer.cpp
+//---------------------------------------------------------------------------//
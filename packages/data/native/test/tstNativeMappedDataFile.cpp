@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeMappedDataFile.cpp
+//! \author Alex Robinson
+//! \brief  Native memory-mapped data file class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <memory>
+
+// FRENSIE Includes
+#include "Data_NativeMappedDataFileWriter.hpp"
+#include "Data_NativeMappedDataFile.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+const std::string test_file_name( "test_native_mapped_data_file.fmap" );
+
+std::unique_ptr<const Data::NativeMappedDataFile> mapped_file;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a mapped data file can be written
+FRENSIE_UNIT_TEST( NativeMappedDataFile, write )
+{
+  Data::NativeMappedDataFileWriter writer;
+
+  writer.addString( "notes", "test notes" );
+  writer.addValue( "atomic_number", 82u );
+  writer.addValue( "atomic_weight", 207.2 );
+  writer.addArray( "energy_grid", std::vector<double>( {1.0, 2.0, 3.0} ) );
+  writer.addArray( "subshells", std::set<unsigned>( {6, 1, 3} ) );
+  writer.addArray( "empty", std::vector<double>() );
+
+  std::map<unsigned,std::vector<double> > subshell_arrays;
+  subshell_arrays[1] = std::vector<double>( {1.0, 2.0} );
+  subshell_arrays[3] = std::vector<double>( {3.0} );
+  subshell_arrays[6] = std::vector<double>( {4.0, 5.0, 6.0} );
+
+  writer.addIndexedArrays( "subshell_arrays", subshell_arrays );
+
+  std::map<double,std::vector<double> > energy_arrays;
+  energy_arrays[1e-5] = std::vector<double>( {-1.0, 1.0} );
+  energy_arrays[1e5] = std::vector<double>( {-1.0, 0.0, 1.0} );
+
+  writer.addIndexedArrays( "energy_arrays", energy_arrays );
+
+  std::map<unsigned,double> subshell_values;
+  subshell_values[1] = 2.0;
+  subshell_values[6] = 4.0;
+
+  writer.addIndexedValues( "subshell_values", subshell_values );
+
+  FRENSIE_CHECK( writer.hasEntry( "notes" ) );
+  FRENSIE_CHECK( writer.hasEntry( "subshell_arrays/offsets" ) );
+  FRENSIE_CHECK( !writer.hasEntry( "subshell_arrays" ) );
+  FRENSIE_CHECK_EQUAL( writer.getNumberOfEntries(), 14 );
+
+  // Entries can only be added once
+  FRENSIE_CHECK_THROW( writer.addValue( "atomic_number", 1u ),
+                       std::runtime_error );
+
+  FRENSIE_REQUIRE_NO_THROW( writer.write( test_file_name, true ) );
+
+  // The file will not be overwritten unless requested
+  FRENSIE_CHECK_THROW( writer.write( test_file_name, false ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a mapped data file can be opened
+FRENSIE_UNIT_TEST( NativeMappedDataFile, constructor )
+{
+  FRENSIE_REQUIRE_NO_THROW( mapped_file.reset( new Data::NativeMappedDataFile( test_file_name ) ) );
+
+  FRENSIE_CHECK_EQUAL( mapped_file->getFileName().string(), test_file_name );
+  FRENSIE_CHECK_EQUAL( mapped_file->getNumberOfEntries(), 14 );
+  FRENSIE_CHECK_EQUAL( mapped_file->getFileSize() %
+                       Data::NativeMappedDataFile::getDataAlignment(),
+                       0 );
+
+  // Files that are not native mapped data files are rejected
+  {
+    std::ofstream bad_file( "test_bad_native_mapped_data_file.fmap" );
+
+    bad_file << "This is not a native mapped data file. It is only a file "
+             << "that is large enough to contain a header.";
+  }
+
+  FRENSIE_CHECK_THROW( Data::NativeMappedDataFile( "test_bad_native_mapped_data_file.fmap" ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_THROW( Data::NativeMappedDataFile( "dummy_file.fmap" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the entries can be returned
+FRENSIE_UNIT_TEST( NativeMappedDataFile, getArray )
+{
+  FRENSIE_CHECK( mapped_file->hasEntry( "energy_grid" ) );
+  FRENSIE_CHECK( !mapped_file->hasEntry( "energy" ) );
+  FRENSIE_CHECK( !mapped_file->hasEntry( "energy_grids" ) );
+
+  FRENSIE_CHECK_EQUAL( mapped_file->getNumberOfElements( "energy_grid" ), 3 );
+  FRENSIE_CHECK_EQUAL( mapped_file->getArray<double>( "energy_grid" ),
+                       std::vector<double>( {1.0, 2.0, 3.0} ) );
+  FRENSIE_CHECK_EQUAL( mapped_file->getArray<unsigned>( "subshells" ),
+                       std::vector<unsigned>( {1, 3, 6} ) );
+  FRENSIE_CHECK_EQUAL( mapped_file->getArray<double>( "empty" ).size(), 0 );
+
+  // The arrays are aligned
+  FRENSIE_CHECK_EQUAL( reinterpret_cast<uintptr_t>( mapped_file->getArray<double>( "energy_grid" ).data() ) %
+                       Data::NativeMappedDataFile::getDataAlignment(),
+                       0 );
+
+  FRENSIE_CHECK_EQUAL( mapped_file->getValue<unsigned>( "atomic_number" ),
+                       82u );
+  FRENSIE_CHECK_EQUAL( mapped_file->getValue<double>( "atomic_weight" ),
+                       207.2 );
+  FRENSIE_CHECK_EQUAL( mapped_file->getString( "notes" ), "test notes" );
+
+  // The requested type must match the stored type
+  FRENSIE_CHECK_THROW( mapped_file->getArray<unsigned>( "energy_grid" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( mapped_file->getValue<double>( "energy_grid" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( mapped_file->getArray<double>( "dummy" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the indexed entries can be returned
+FRENSIE_UNIT_TEST( NativeMappedDataFile, getIndexedArray )
+{
+  FRENSIE_CHECK_EQUAL( mapped_file->getKeys<unsigned>( "subshell_arrays" ),
+                       std::vector<unsigned>( {1, 3, 6} ) );
+  FRENSIE_CHECK( mapped_file->hasKey( "subshell_arrays", 3u ) );
+  FRENSIE_CHECK( !mapped_file->hasKey( "subshell_arrays", 2u ) );
+  FRENSIE_CHECK( !mapped_file->hasKey( "dummy", 2u ) );
+
+  FRENSIE_CHECK_EQUAL( (mapped_file->getIndexedArray<double>( "subshell_arrays", 1u )),
+                       std::vector<double>( {1.0, 2.0} ) );
+  FRENSIE_CHECK_EQUAL( (mapped_file->getIndexedArray<double>( "subshell_arrays", 3u )),
+                       std::vector<double>( {3.0} ) );
+  FRENSIE_CHECK_EQUAL( (mapped_file->getIndexedArray<double>( "subshell_arrays", 6u )),
+                       std::vector<double>( {4.0, 5.0, 6.0} ) );
+  FRENSIE_CHECK_THROW( (mapped_file->getIndexedArray<double>( "subshell_arrays", 2u )),
+                       std::runtime_error );
+
+  FRENSIE_CHECK_EQUAL( (mapped_file->getIndexedArray<double>( "energy_arrays", 1e-5 )),
+                       std::vector<double>( {-1.0, 1.0} ) );
+  FRENSIE_CHECK_EQUAL( (mapped_file->getIndexedArray<double>( "energy_arrays", 1e5 )),
+                       std::vector<double>( {-1.0, 0.0, 1.0} ) );
+
+  FRENSIE_CHECK_EQUAL( (mapped_file->getIndexedValue<double>( "subshell_values", 1u )),
+                       2.0 );
+  FRENSIE_CHECK_EQUAL( (mapped_file->getIndexedValue<double>( "subshell_values", 6u )),
+                       4.0 );
+  FRENSIE_CHECK_THROW( (mapped_file->getIndexedValue<double>( "subshell_values", 3u )),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNativeMappedDataFile.cpp
+//---------------------------------------------------------------------------//
@@ -38,7 +38,9 @@ namespace DataGen{
  * well as set the minumum nudged outgoing energy for secondary distributions.
  * The max energy nudge value must be greater than zero to avoid an invalid
  * outgoing energy grid at the max incoming energy (each outgoing energy grid
- * must have at least two distinct points).
+ * must have at least two distinct points). The outgoing energy grids are
+ * refined in parallel, so the forward evaluators must be safe to call from
+ * multiple threads.
  */
 template<typename TwoDInterpPolicy>
 AdjointElectronGridGenerator<TwoDInterpPolicy>::AdjointElectronGridGenerator(
@@ -131,6 +133,9 @@ AdjointElectronGridGenerator<TwoDInterpPolicy>::AdjointElectronGridGenerator(
   // Replace the lower and upper bins with the min and max electron energies
   d_integration_points.front() = d_min_outgoing_energy;
   d_integration_points.back() = d_max_outgoing_energy;
+
+  // The adjoint pdf evaluations are independent and expensive
+  this->setParallelRefinementModeOn();
 }
 
 // Get the min incoming energy
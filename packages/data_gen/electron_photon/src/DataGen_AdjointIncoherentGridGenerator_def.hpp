@@ -39,7 +39,9 @@ namespace DataGen{
  * the max energy nudge value should be greater than the binding energy and
  * the energy to max energy nudge value should be greater than or equal to
  * the binding energy since the cross section goes to zero when the energy is 
- * equal to the max energy minus the binding energy.
+ * equal to the max energy minus the binding energy. The max energy grids
+ * are refined in parallel (see
+ * Utility::TwoDGridGenerator::setParallelRefinementModeOn).
  */
 template<typename TwoDInterpPolicy>
 AdjointIncoherentGridGenerator<TwoDInterpPolicy>::AdjointIncoherentGridGenerator(
@@ -62,6 +64,9 @@ AdjointIncoherentGridGenerator<TwoDInterpPolicy>::AdjointIncoherentGridGenerator
   testPrecondition( max_energy_nudge_value > 0.0 );
   // Make sure the energy to max energy nudge value is valid
   testPrecondition( energy_to_max_energy_nudge_value >= 0.0 );
+
+  // The adjoint cross section evaluations are independent and expensive
+  this->setParallelRefinementModeOn();
 }
 
 // Get the max energy
@@ -17,6 +17,7 @@
 #include "DataGen_ScatteringFunctionEvaluator.hpp"
 #include "DataGen_OccupationNumberEvaluator.hpp"
 #include "DataGen_ComptonProfileGenerator.hpp"
+#include "DataGen_ParallelGridEvaluationHelpers.hpp"
 #include "MonteCarlo_ComptonProfileHelpers.hpp"
 #include "MonteCarlo_ComptonProfileSubshellConverterFactory.hpp"
 #include "MonteCarlo_ElasticElectronScatteringDistributionNativeFactory.hpp"
@@ -1993,22 +1994,23 @@ void ENDLElectronPhotonRelaxationDataGenerator::createCrossSectionOnUnionEnergyG
              std::vector<double>& cross_section,
              unsigned& threshold_index ) const
 {
-  std::vector<double> raw_cross_section( union_energy_grid.size() );
-
-  std::list<double>::const_iterator energy_grid_pt = union_energy_grid.begin();
-
-  unsigned index = 0u;
-
-  while( energy_grid_pt != union_energy_grid.end() )
-  {
-    raw_cross_section[index] =
-      original_cross_section->evaluateIntegratedCrossSection(
-                            *energy_grid_pt,
-                            this->getSubshellIncoherentEvaluationTolerance() );
-
-    ++energy_grid_pt;
-    ++index;
-  }
+  // Evaluate the cross section at every energy grid point. Each evaluation
+  // requires a numerical integration, which is independent of the other grid
+  // points, so the grid points can be evaluated in parallel.
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
+
+  std::vector<double> raw_cross_section( energy_grid.size() );
+
+  const double evaluation_tolerance =
+    this->getSubshellIncoherentEvaluationTolerance();
+
+  DataGen::evaluateAtGridPointsInParallel( energy_grid.size(),
+    [&]( const size_t i ){
+      raw_cross_section[i] =
+        original_cross_section->evaluateIntegratedCrossSection(
+                                        energy_grid[i], evaluation_tolerance );
+    } );
 
   // The subshell incoherent cross section is zero at the threshold energy
   this->populateCrossSection( raw_cross_section,
@@ -0,0 +1,36 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   DataGen_ParallelGridEvaluationHelpers.hpp
+//! \author Alex Robinson
+//! \brief  The parallel grid evaluation helper function declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_GEN_PARALLEL_GRID_EVALUATION_HELPERS_HPP
+#define DATA_GEN_PARALLEL_GRID_EVALUATION_HELPERS_HPP
+
+// Std Lib Includes
+#include <vector>
+
+namespace DataGen{
+
+//! Evaluate a functor at every grid point index using the requested threads
+template<typename IndexFunctor>
+void evaluateAtGridPointsInParallel( const size_t number_of_grid_points,
+                                     IndexFunctor index_functor );
+
+} // end DataGen namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "DataGen_ParallelGridEvaluationHelpers_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end DATA_GEN_PARALLEL_GRID_EVALUATION_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end DataGen_ParallelGridEvaluationHelpers.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,64 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   DataGen_ParallelGridEvaluationHelpers_def.hpp
+//! \author Alex Robinson
+//! \brief  The parallel grid evaluation helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_GEN_PARALLEL_GRID_EVALUATION_HELPERS_DEF_HPP
+#define DATA_GEN_PARALLEL_GRID_EVALUATION_HELPERS_DEF_HPP
+
+// Std Lib Includes
+#include <exception>
+
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+
+namespace DataGen{
+
+// Evaluate a functor at every grid point index using the requested threads
+/*! \details The functor will be called once with every index in
+ * [0,number_of_grid_points). The indices are distributed dynamically over the
+ * number of threads requested through Utility::OpenMPProperties because the
+ * cost of evaluating a grid point (e.g. generating a secondary grid) can vary
+ * greatly across a grid. Each call must only write to the output values
+ * associated with its index and only call const methods of any shared
+ * evaluators. The generated data will then be identical to the data generated
+ * by a serial loop, regardless of the number of threads. Exceptions cannot
+ * propagate out of a parallel region - if any call throws, the exception
+ * thrown at the lowest index will be rethrown once all of the grid points
+ * have been processed.
+ */
+template<typename IndexFunctor>
+void evaluateAtGridPointsInParallel( const size_t number_of_grid_points,
+                                     IndexFunctor index_functor )
+{
+  std::vector<std::exception_ptr> grid_point_exceptions( number_of_grid_points );
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() ) schedule( dynamic, 1 )
+  for( size_t i = 0; i < number_of_grid_points; ++i )
+  {
+    try{
+      index_functor( i );
+    }
+    catch( ... )
+    {
+      grid_point_exceptions[i] = std::current_exception();
+    }
+  }
+
+  for( size_t i = 0; i < grid_point_exceptions.size(); ++i )
+  {
+    if( grid_point_exceptions[i] )
+      std::rethrow_exception( grid_point_exceptions[i] );
+  }
+}
+
+} // end DataGen namespace
+
+#endif // end DATA_GEN_PARALLEL_GRID_EVALUATION_HELPERS_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end DataGen_ParallelGridEvaluationHelpers_def.hpp
+//---------------------------------------------------------------------------//
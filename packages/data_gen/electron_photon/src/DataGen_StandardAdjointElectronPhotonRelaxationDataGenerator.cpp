@@ -17,6 +17,7 @@
 #include "DataGen_ElectronElasticDataEvaluator.hpp"
 #include "DataGen_StandardAdjointElectronPhotonRelaxationDataGenerator.hpp"
 #include "DataGen_AdjointPairProductionEnergyDistributionNormConstantEvaluator.hpp"
+#include "DataGen_ParallelGridEvaluationHelpers.hpp"
 #include "MonteCarlo_ElectroatomicReactionNativeFactory.hpp"
 #include "MonteCarlo_ElectroionizationSubshellElectronScatteringDistributionNativeFactory.hpp"
 #include "MonteCarlo_BremsstrahlungElectronScatteringDistributionNativeFactory.hpp"
@@ -1174,39 +1175,31 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
     grid_generator.createCrossSectionEvaluator(
                            cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
-  // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
-  {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
-
-    // Check if the first max energy grid point is valid. The energy to
-    // max energy nudge value is used to improve convergence time by ignoring
-    // the secondary grid point where the cross section is zero
-    // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() > *energy_grid_it )
-    {
-      // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert( max_energy_grid_it->begin(),
-                                  *energy_grid_it );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
-    }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  // Evaluate the cross section at every energy grid point. The max energy
+  // grid and cross section at each energy grid point only depend on the
+  // energy so the grid points can be evaluated in parallel.
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
+
+  DataGen::evaluateAtGridPointsInParallel( energy_grid.size(),
+    [&]( const size_t i ){
+      grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                          cross_section[i],
+                                                          energy_grid[i],
+                                                          cs_evaluation_wrapper );
+
+      // Check if the first max energy grid point is valid. The energy to
+      // max energy nudge value is used to improve convergence time by
+      // ignoring the secondary grid point where the cross section is zero
+      // (energy = max energy). We must add it back in for the grid to be
+      // usable.
+      if( max_energy_grid[i].front() > energy_grid[i] )
+      {
+        // This operation is inefficient with vectors!!!
+        max_energy_grid[i].insert( max_energy_grid[i].begin(), energy_grid[i] );
+        cross_section[i].insert( cross_section[i].begin(), 0.0 );
+      }
+    } );
 }
 
 // Create the cross section on the union energy grid
@@ -1249,40 +1242,31 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
                   cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
   // Evaluate the cross section at every energy grid point at or above the
-  // threshold energy
-  std::list<double>::const_iterator energy_grid_it = start;
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
-  {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
-
-    // Check if the first max energy grid point is valid. The energy to
-    // max energy nudge value is used to improve convergence time by ignoring
-    // the secondary grid point where the cross section is zero
-    // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() >
-        *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() )
-    {
-      // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert(
-                  max_energy_grid_it->begin(),
-                  *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
-    }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  // threshold energy (in parallel - see the Waller-Hartree overload)
+  const std::vector<double> energy_grid( start, union_energy_grid.end() );
+
+  const double binding_energy = cs_evaluator->getSubshellBindingEnergy();
+
+  DataGen::evaluateAtGridPointsInParallel( energy_grid.size(),
+    [&]( const size_t i ){
+      grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                          cross_section[i],
+                                                          energy_grid[i],
+                                                          cs_evaluation_wrapper );
+
+      // Check if the first max energy grid point is valid. The energy to
+      // max energy nudge value is used to improve convergence time by
+      // ignoring the secondary grid point where the cross section is zero
+      // (energy = max energy). We must add it back in for the grid to be
+      // usable.
+      if( max_energy_grid[i].front() > energy_grid[i] + binding_energy )
+      {
+        // This operation is inefficient with vectors!!!
+        max_energy_grid[i].insert( max_energy_grid[i].begin(),
+                                   energy_grid[i] + binding_energy );
+        cross_section[i].insert( cross_section[i].begin(), 0.0 );
+      }
+    } );
 }
 
 // Create the cross section on the union energy grid
@@ -1312,41 +1296,33 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
     grid_generator.createCrossSectionEvaluator(
                   cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
-  // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
-  {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
-
-    // Check if the first max energy grid point is valid. The energy to
-    // max energy nudge value is used to improve convergence time by ignoring
-    // the secondary grid point where the cross section is zero
-    // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() >
-        *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() )
-    {
-      // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert(
-                  max_energy_grid_it->begin(),
-                  *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
-    }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  // Evaluate the cross section at every energy grid point (in parallel - see
+  // the Waller-Hartree overload)
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
+
+  const double binding_energy = cs_evaluator->getSubshellBindingEnergy();
+
+  DataGen::evaluateAtGridPointsInParallel( energy_grid.size(),
+    [&]( const size_t i ){
+      grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                          cross_section[i],
+                                                          energy_grid[i],
+                                                          cs_evaluation_wrapper );
+
+      // Check if the first max energy grid point is valid. The energy to
+      // max energy nudge value is used to improve convergence time by
+      // ignoring the secondary grid point where the cross section is zero
+      // (energy = max energy). We must add it back in for the grid to be
+      // usable.
+      if( max_energy_grid[i].front() > energy_grid[i] + binding_energy )
+      {
+        // This operation is inefficient with vectors!!!
+        max_energy_grid[i].insert( max_energy_grid[i].begin(),
+                                   energy_grid[i] + binding_energy );
+        cross_section[i].insert( cross_section[i].begin(), 0.0 );
+      }
+    } );
 }
 
 // Create the cross section on the union energy grid
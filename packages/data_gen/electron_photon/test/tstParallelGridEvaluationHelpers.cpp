@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstParallelGridEvaluationHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Parallel grid evaluation helper function unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+#include <cmath>
+
+// FRENSIE Includes
+#include "DataGen_ParallelGridEvaluationHelpers.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a functor can be evaluated at every grid point
+FRENSIE_UNIT_TEST( ParallelGridEvaluationHelpers,
+                   evaluateAtGridPointsInParallel )
+{
+  std::vector<double> grid( 1000 );
+
+  for( size_t i = 0; i < grid.size(); ++i )
+    grid[i] = 1e-3*(i+1);
+
+  std::vector<std::vector<double> > evaluated_grid( grid.size() );
+
+  DataGen::evaluateAtGridPointsInParallel( grid.size(),
+    [&]( const size_t i ){
+      // The amount of work done at each grid point varies
+      for( size_t j = 0; j < i%7+1; ++j )
+        evaluated_grid[i].push_back( std::exp( grid[i]*j ) );
+    } );
+
+  std::vector<std::vector<double> > expected_evaluated_grid( grid.size() );
+
+  for( size_t i = 0; i < grid.size(); ++i )
+  {
+    for( size_t j = 0; j < i%7+1; ++j )
+      expected_evaluated_grid[i].push_back( std::exp( grid[i]*j ) );
+  }
+
+  FRENSIE_CHECK_EQUAL( evaluated_grid, expected_evaluated_grid );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the exception thrown at the lowest grid point index is rethrown
+FRENSIE_UNIT_TEST( ParallelGridEvaluationHelpers,
+                   evaluateAtGridPointsInParallel_exception )
+{
+  std::vector<double> evaluated_grid( 1000, 0.0 );
+
+  std::string exception_message;
+
+  try{
+    DataGen::evaluateAtGridPointsInParallel( evaluated_grid.size(),
+      [&]( const size_t i ){
+        if( i == 100 || i == 500 || i == 900 )
+          throw std::runtime_error( std::to_string( i ) );
+
+        evaluated_grid[i] = 1.0;
+      } );
+  }
+  catch( const std::runtime_error& exception )
+  {
+    exception_message = exception.what();
+  }
+
+  FRENSIE_CHECK_EQUAL( exception_message, "100" );
+
+  // All of the other grid points should still be evaluated
+  FRENSIE_CHECK_EQUAL( evaluated_grid[99], 1.0 );
+  FRENSIE_CHECK_EQUAL( evaluated_grid[100], 0.0 );
+  FRENSIE_CHECK_EQUAL( evaluated_grid[999], 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set the number of threads to use
+  Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstParallelGridEvaluationHelpers.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,162 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_ClosestBoundaryQueryStatistics.cpp
+//! \author Alex Robinson
+//! \brief  Closest boundary query statistics class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <vector>
+
+// FRENSIE Includes
+#include "Geometry_ClosestBoundaryQueryStatistics.hpp"
+
+namespace Geometry{
+
+namespace{
+
+// The statistics of all running threads
+std::vector<ClosestBoundaryQueryStatistics*> thread_statistics;
+
+// The number of evaluated queries from threads that have exited
+unsigned long long retired_evaluated_queries = 0ull;
+
+// The number of safety sphere reuses from threads that have exited
+unsigned long long retired_safety_sphere_reuses = 0ull;
+
+// The number of safety voxel map reuses from threads that have exited
+unsigned long long retired_safety_voxel_map_reuses = 0ull;
+
+} // end anonymous namespace
+
+// Constructor
+ClosestBoundaryQueryStatistics::ClosestBoundaryQueryStatistics()
+  : d_evaluated_queries( 0ull ),
+    d_safety_sphere_reuses( 0ull ),
+    d_safety_voxel_map_reuses( 0ull )
+{
+  #pragma omp critical( closest_boundary_query_statistics_registry )
+  {
+    thread_statistics.push_back( this );
+  }
+}
+
+// Destructor
+ClosestBoundaryQueryStatistics::~ClosestBoundaryQueryStatistics()
+{
+  #pragma omp critical( closest_boundary_query_statistics_registry )
+  {
+    retired_evaluated_queries += d_evaluated_queries;
+    retired_safety_sphere_reuses += d_safety_sphere_reuses;
+    retired_safety_voxel_map_reuses += d_safety_voxel_map_reuses;
+
+    thread_statistics.erase( std::remove( thread_statistics.begin(),
+                                          thread_statistics.end(),
+                                          this ),
+                             thread_statistics.end() );
+  }
+}
+
+// Return the number of evaluated queries (all threads)
+unsigned long long
+ClosestBoundaryQueryStatistics::getNumberOfEvaluatedQueries()
+{
+  unsigned long long evaluated_queries;
+
+  #pragma omp critical( closest_boundary_query_statistics_registry )
+  {
+    evaluated_queries = retired_evaluated_queries;
+
+    for( size_t i = 0; i < thread_statistics.size(); ++i )
+      evaluated_queries += thread_statistics[i]->d_evaluated_queries;
+  }
+
+  return evaluated_queries;
+}
+
+// Return the number of queries avoided with the ray safety sphere
+unsigned long long
+ClosestBoundaryQueryStatistics::getNumberOfSafetySphereReuses()
+{
+  unsigned long long safety_sphere_reuses;
+
+  #pragma omp critical( closest_boundary_query_statistics_registry )
+  {
+    safety_sphere_reuses = retired_safety_sphere_reuses;
+
+    for( size_t i = 0; i < thread_statistics.size(); ++i )
+      safety_sphere_reuses += thread_statistics[i]->d_safety_sphere_reuses;
+  }
+
+  return safety_sphere_reuses;
+}
+
+// Return the number of queries avoided with the safety voxel map
+unsigned long long
+ClosestBoundaryQueryStatistics::getNumberOfSafetyVoxelMapReuses()
+{
+  unsigned long long safety_voxel_map_reuses;
+
+  #pragma omp critical( closest_boundary_query_statistics_registry )
+  {
+    safety_voxel_map_reuses = retired_safety_voxel_map_reuses;
+
+    for( size_t i = 0; i < thread_statistics.size(); ++i )
+    {
+      safety_voxel_map_reuses +=
+        thread_statistics[i]->d_safety_voxel_map_reuses;
+    }
+  }
+
+  return safety_voxel_map_reuses;
+}
+
+// Return the number of avoided queries (all threads)
+unsigned long long ClosestBoundaryQueryStatistics::getNumberOfAvoidedQueries()
+{
+  return ClosestBoundaryQueryStatistics::getNumberOfSafetySphereReuses() +
+    ClosestBoundaryQueryStatistics::getNumberOfSafetyVoxelMapReuses();
+}
+
+// Reset the query counters (all threads)
+void ClosestBoundaryQueryStatistics::resetStatistics()
+{
+  #pragma omp critical( closest_boundary_query_statistics_registry )
+  {
+    retired_evaluated_queries = 0ull;
+    retired_safety_sphere_reuses = 0ull;
+    retired_safety_voxel_map_reuses = 0ull;
+
+    for( size_t i = 0; i < thread_statistics.size(); ++i )
+    {
+      thread_statistics[i]->d_evaluated_queries = 0ull;
+      thread_statistics[i]->d_safety_sphere_reuses = 0ull;
+      thread_statistics[i]->d_safety_voxel_map_reuses = 0ull;
+    }
+  }
+}
+
+// Print the query statistics (all threads)
+void ClosestBoundaryQueryStatistics::printStatistics( std::ostream& os )
+{
+  const unsigned long long safety_sphere_reuses =
+    ClosestBoundaryQueryStatistics::getNumberOfSafetySphereReuses();
+  const unsigned long long safety_voxel_map_reuses =
+    ClosestBoundaryQueryStatistics::getNumberOfSafetyVoxelMapReuses();
+
+  os << "Closest boundary queries: "
+     << ClosestBoundaryQueryStatistics::getNumberOfEvaluatedQueries()
+     << " evaluated, "
+     << safety_sphere_reuses + safety_voxel_map_reuses
+     << " avoided (safety sphere: " << safety_sphere_reuses
+     << ", safety voxel map: " << safety_voxel_map_reuses << ")"
+     << std::endl;
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_ClosestBoundaryQueryStatistics.cpp
+//---------------------------------------------------------------------------//
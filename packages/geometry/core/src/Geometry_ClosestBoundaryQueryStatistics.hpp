@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_ClosestBoundaryQueryStatistics.hpp
+//! \author Alex Robinson
+//! \brief  Closest boundary query statistics class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_CLOSEST_BOUNDARY_QUERY_STATISTICS_HPP
+#define GEOMETRY_CLOSEST_BOUNDARY_QUERY_STATISTICS_HPP
+
+// Std Lib Includes
+#include <iostream>
+
+namespace Geometry{
+
+/*! The closest boundary query statistics class
+ *
+ * Navigators that can avoid a (costly) closest boundary query by reusing a
+ * previously calculated safety distance record every evaluated and every
+ * avoided query. Each thread has its own counters. The counters of every
+ * thread can be queried or reset but only outside of a parallel block.
+ */
+class ClosestBoundaryQueryStatistics
+{
+
+public:
+
+  //! Get the statistics of the calling thread
+  static ClosestBoundaryQueryStatistics& getThreadStatistics();
+
+  //! Return the number of evaluated queries (all threads)
+  static unsigned long long getNumberOfEvaluatedQueries();
+
+  //! Return the number of queries avoided with the ray safety sphere
+  static unsigned long long getNumberOfSafetySphereReuses();
+
+  //! Return the number of queries avoided with the safety voxel map
+  static unsigned long long getNumberOfSafetyVoxelMapReuses();
+
+  //! Return the number of avoided queries (all threads)
+  static unsigned long long getNumberOfAvoidedQueries();
+
+  //! Reset the query counters (all threads)
+  static void resetStatistics();
+
+  //! Print the query statistics (all threads)
+  static void printStatistics( std::ostream& os );
+
+  //! Destructor
+  ~ClosestBoundaryQueryStatistics();
+
+  //! Record an evaluated query
+  void recordEvaluatedQuery();
+
+  //! Record a query that was avoided with the ray safety sphere
+  void recordSafetySphereReuse();
+
+  //! Record a query that was avoided with the safety voxel map
+  void recordSafetyVoxelMapReuse();
+
+private:
+
+  // Constructor
+  ClosestBoundaryQueryStatistics();
+
+  // The number of evaluated queries
+  unsigned long long d_evaluated_queries;
+
+  // The number of queries avoided with the ray safety sphere
+  unsigned long long d_safety_sphere_reuses;
+
+  // The number of queries avoided with the safety voxel map
+  unsigned long long d_safety_voxel_map_reuses;
+};
+
+// Get the statistics of the calling thread
+inline ClosestBoundaryQueryStatistics&
+ClosestBoundaryQueryStatistics::getThreadStatistics()
+{
+  thread_local ClosestBoundaryQueryStatistics statistics;
+
+  return statistics;
+}
+
+// Record an evaluated query
+inline void ClosestBoundaryQueryStatistics::recordEvaluatedQuery()
+{
+  ++d_evaluated_queries;
+}
+
+// Record a query that was avoided with the ray safety sphere
+inline void ClosestBoundaryQueryStatistics::recordSafetySphereReuse()
+{
+  ++d_safety_sphere_reuses;
+}
+
+// Record a query that was avoided with the safety voxel map
+inline void ClosestBoundaryQueryStatistics::recordSafetyVoxelMapReuse()
+{
+  ++d_safety_voxel_map_reuses;
+}
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_CLOSEST_BOUNDARY_QUERY_STATISTICS_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_ClosestBoundaryQueryStatistics.hpp
+//---------------------------------------------------------------------------//
@@ -167,6 +167,9 @@ public:
   //! Check if the model has been initialized
   virtual bool isInitialized() const = 0;  
 
+  //! Enable thread support
+  virtual void enableThreadSupport( const size_t threads ) const;
+
 protected:
 
   //! Initialize the model just-in-time
@@ -196,6 +199,13 @@ inline bool Model::isAdvanced() const
   return false;
 }
 
+// Enable thread support
+/*! \details Models that keep per-thread data (e.g. caches) must override
+ * this method. Only the master thread should call this method.
+ */
+inline void Model::enableThreadSupport( const size_t ) const
+{ /* ... */ }
+
 // Create a raw, heap-allocated navigator
 inline Geometry::Navigator* Model::createNavigatorAdvanced() const
 {
@@ -0,0 +1,164 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_SafetyVoxelMap.cpp
+//! \author Alex Robinson
+//! \brief  Safety voxel map class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_SafetyVoxelMap.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const unsigned SafetyVoxelMap::default_voxels_per_dimension;
+
+// Constructor
+SafetyVoxelMap::SafetyVoxelMap( const double lower_bounds[3],
+                                const double upper_bounds[3],
+                                const unsigned voxels_per_dimension )
+  : d_voxels_per_dimension( voxels_per_dimension )
+{
+  // Make sure the number of voxels is valid
+  testPrecondition( voxels_per_dimension > 0 );
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    // Make sure the bounds are valid
+    testPrecondition( lower_bounds[i] <= upper_bounds[i] );
+
+    d_lower_bounds[i] = lower_bounds[i];
+    d_upper_bounds[i] = upper_bounds[i];
+
+    // Flat dimensions are treated as having a unit width
+    if( upper_bounds[i] > lower_bounds[i] )
+    {
+      d_voxel_widths[i] =
+        (upper_bounds[i] - lower_bounds[i])/voxels_per_dimension;
+    }
+    else
+      d_voxel_widths[i] = 1.0;
+  }
+
+  const size_t number_of_voxels = this->getNumberOfVoxels();
+
+  d_voxel_center_distances.reset( new std::atomic<double>[number_of_voxels] );
+
+  for( size_t i = 0; i < number_of_voxels; ++i )
+    d_voxel_center_distances[i].store( -1.0, std::memory_order_relaxed );
+}
+
+// Return the number of voxels
+size_t SafetyVoxelMap::getNumberOfVoxels() const
+{
+  return (size_t)d_voxels_per_dimension*d_voxels_per_dimension*
+    d_voxels_per_dimension;
+}
+
+// Return the number of voxels that have been evaluated
+size_t SafetyVoxelMap::getNumberOfEvaluatedVoxels() const
+{
+  const size_t number_of_voxels = this->getNumberOfVoxels();
+
+  size_t number_of_evaluated_voxels = 0;
+
+  for( size_t i = 0; i < number_of_voxels; ++i )
+  {
+    if( d_voxel_center_distances[i].load( std::memory_order_relaxed ) >= 0.0 )
+      ++number_of_evaluated_voxels;
+  }
+
+  return number_of_evaluated_voxels;
+}
+
+// Check if a point is inside of the map
+bool SafetyVoxelMap::isPointInMap( const double position[3] ) const
+{
+  return position[0] >= d_lower_bounds[0] &&
+    position[0] <= d_upper_bounds[0] &&
+    position[1] >= d_lower_bounds[1] &&
+    position[1] <= d_upper_bounds[1] &&
+    position[2] >= d_lower_bounds[2] &&
+    position[2] <= d_upper_bounds[2];
+}
+
+// Return a lower bound on the distance to the closest boundary
+/*! \details If the point is outside of the map or if the point is further
+ * than half of the voxel center distance from the voxel center a lower bound
+ * of zero will be returned (no useful bound is available).
+ */
+double SafetyVoxelMap::getDistanceToClosestBoundaryLowerBound(
+                            const double position[3],
+                            const DistanceFunction& distance_function ) const
+{
+  if( !this->isPointInMap( position ) )
+    return 0.0;
+
+  double voxel_center[3];
+
+  const size_t voxel_index =
+    this->calculateVoxelIndexAndCenter( position, voxel_center );
+
+  double voxel_center_distance =
+    d_voxel_center_distances[voxel_index].load( std::memory_order_relaxed );
+
+  // Evaluate the voxel the first time that it is touched
+  if( voxel_center_distance < 0.0 )
+  {
+    voxel_center_distance = distance_function( voxel_center );
+
+    // Make sure the distance is valid
+    testInvariant( voxel_center_distance >= 0.0 );
+
+    d_voxel_center_distances[voxel_index].store( voxel_center_distance,
+                                                 std::memory_order_relaxed );
+  }
+
+  const double displacement[3] = {position[0] - voxel_center[0],
+                                  position[1] - voxel_center[1],
+                                  position[2] - voxel_center[2]};
+
+  const double distance_to_voxel_center =
+    std::sqrt( displacement[0]*displacement[0] +
+               displacement[1]*displacement[1] +
+               displacement[2]*displacement[2] );
+
+  if( distance_to_voxel_center <= 0.5*voxel_center_distance )
+    return voxel_center_distance - distance_to_voxel_center;
+  else
+    return 0.0;
+}
+
+// Calculate the voxel index and center of a point in the map
+size_t SafetyVoxelMap::calculateVoxelIndexAndCenter(
+                                            const double position[3],
+                                            double voxel_center[3] ) const
+{
+  size_t voxel_indices[3];
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    // Points on the upper bound belong to the last voxel
+    voxel_indices[i] =
+      std::min( (unsigned)((position[i] - d_lower_bounds[i])/d_voxel_widths[i]),
+                d_voxels_per_dimension - 1 );
+
+    voxel_center[i] =
+      d_lower_bounds[i] + (voxel_indices[i] + 0.5)*d_voxel_widths[i];
+  }
+
+  return voxel_indices[0] + d_voxels_per_dimension*
+    (voxel_indices[1] + d_voxels_per_dimension*voxel_indices[2]);
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_SafetyVoxelMap.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_SafetyVoxelMap.hpp
+//! \author Alex Robinson
+//! \brief  Safety voxel map class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_SAFETY_VOXEL_MAP_HPP
+#define GEOMETRY_SAFETY_VOXEL_MAP_HPP
+
+// Std Lib Includes
+#include <functional>
+#include <atomic>
+#include <memory>
+
+namespace Geometry{
+
+/*! The safety voxel map class
+ *
+ * The map covers the bounding box of a volume with a coarse uniform voxel
+ * mesh. The distance from the center of each voxel to the closest boundary
+ * of the volume is only evaluated the first time that a point in the voxel
+ * is queried (lazy construction). Since the distance to the closest boundary
+ * is a 1-Lipschitz function of the position, the distance at the voxel
+ * center minus the distance from the point to the voxel center is a lower
+ * bound on the distance from the point to the closest boundary. The voxel
+ * distances are stored atomically so the map can be queried by multiple
+ * threads concurrently (two threads that touch a new voxel at the same time
+ * will both evaluate the same distance). A lower bound is only reported
+ * for points that are within half of the voxel center distance of the voxel
+ * center (the lower bound is then within a factor of three of the actual
+ * distance) - looser bounds would only result in very short steps.
+ */
+class SafetyVoxelMap
+{
+
+public:
+
+  //! The distance to the closest boundary function type
+  typedef std::function<double(const double[3])> DistanceFunction;
+
+  //! The default number of voxels along each dimension
+  static const unsigned default_voxels_per_dimension = 16;
+
+  //! Constructor
+  SafetyVoxelMap( const double lower_bounds[3],
+                  const double upper_bounds[3],
+                  const unsigned voxels_per_dimension =
+                  default_voxels_per_dimension );
+
+  //! Destructor
+  ~SafetyVoxelMap()
+  { /* ... */ }
+
+  //! Return the number of voxels
+  size_t getNumberOfVoxels() const;
+
+  //! Return the number of voxels that have been evaluated
+  size_t getNumberOfEvaluatedVoxels() const;
+
+  //! Check if a point is inside of the map
+  bool isPointInMap( const double position[3] ) const;
+
+  //! Return a lower bound on the distance to the closest boundary
+  double getDistanceToClosestBoundaryLowerBound(
+                         const double position[3],
+                         const DistanceFunction& distance_function ) const;
+
+private:
+
+  // Calculate the voxel index and center of a point in the map
+  size_t calculateVoxelIndexAndCenter( const double position[3],
+                                       double voxel_center[3] ) const;
+
+  // The lower bounds of the map
+  double d_lower_bounds[3];
+
+  // The upper bounds of the map
+  double d_upper_bounds[3];
+
+  // The voxel widths
+  double d_voxel_widths[3];
+
+  // The number of voxels along each dimension
+  unsigned d_voxels_per_dimension;
+
+  // The voxel center distances to the closest boundary (negative if not
+  // evaluated yet)
+  std::unique_ptr<std::atomic<double>[]> d_voxel_center_distances;
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_SAFETY_VOXEL_MAP_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_SafetyVoxelMap.hpp
+//---------------------------------------------------------------------------//
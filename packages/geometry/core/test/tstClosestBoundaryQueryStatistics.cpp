@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstClosestBoundaryQueryStatistics.cpp
+//! \author Alex Robinson
+//! \brief  Closest boundary query statistics unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "Geometry_ClosestBoundaryQueryStatistics.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the query statistics can be recorded
+FRENSIE_UNIT_TEST( ClosestBoundaryQueryStatistics, statistics )
+{
+  Geometry::ClosestBoundaryQueryStatistics::resetStatistics();
+
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfEvaluatedQueries(), 0ull );
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfAvoidedQueries(), 0ull );
+
+  Geometry::ClosestBoundaryQueryStatistics& statistics =
+    Geometry::ClosestBoundaryQueryStatistics::getThreadStatistics();
+
+  statistics.recordEvaluatedQuery();
+  statistics.recordEvaluatedQuery();
+  statistics.recordSafetySphereReuse();
+  statistics.recordSafetySphereReuse();
+  statistics.recordSafetySphereReuse();
+  statistics.recordSafetyVoxelMapReuse();
+
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfEvaluatedQueries(), 2ull );
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfSafetySphereReuses(), 3ull );
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfSafetyVoxelMapReuses(), 1ull );
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfAvoidedQueries(), 4ull );
+
+  std::ostringstream oss;
+
+  Geometry::ClosestBoundaryQueryStatistics::printStatistics( oss );
+
+  FRENSIE_CHECK( oss.str().find( "2 evaluated, 4 avoided" ) != std::string::npos );
+
+  Geometry::ClosestBoundaryQueryStatistics::resetStatistics();
+
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfEvaluatedQueries(), 0ull );
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfAvoidedQueries(), 0ull );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the statistics of every thread are combined
+FRENSIE_UNIT_TEST( ClosestBoundaryQueryStatistics, statistics_threads )
+{
+  Geometry::ClosestBoundaryQueryStatistics::resetStatistics();
+
+  #pragma omp parallel num_threads( 4 )
+  {
+    Geometry::ClosestBoundaryQueryStatistics& statistics =
+      Geometry::ClosestBoundaryQueryStatistics::getThreadStatistics();
+
+    #pragma omp for
+    for( int i = 0; i < 100; ++i )
+    {
+      statistics.recordEvaluatedQuery();
+      statistics.recordSafetySphereReuse();
+    }
+  }
+
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfEvaluatedQueries(), 100ull );
+  FRENSIE_CHECK_EQUAL( Geometry::ClosestBoundaryQueryStatistics::getNumberOfAvoidedQueries(), 100ull );
+
+  Geometry::ClosestBoundaryQueryStatistics::resetStatistics();
+}
+
+//---------------------------------------------------------------------------//
+// end tstClosestBoundaryQueryStatistics.cpp
+//---------------------------------------------------------------------------//
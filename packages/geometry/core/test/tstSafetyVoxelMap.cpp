@@ -0,0 +1,178 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstSafetyVoxelMap.cpp
+//! \author Alex Robinson
+//! \brief  Safety voxel map unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_SafetyVoxelMap.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+// The number of distance function evaluations
+size_t number_of_evaluations = 0;
+
+// The distance to the closest boundary of the unit cube [0,1]^3
+double distanceToUnitCubeBoundary( const double position[3] )
+{
+  ++number_of_evaluations;
+
+  double distance = 1.0;
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    distance = std::min( distance, std::fabs( position[i] ) );
+    distance = std::min( distance, std::fabs( 1.0 - position[i] ) );
+  }
+
+  return distance;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the number of voxels can be returned
+FRENSIE_UNIT_TEST( SafetyVoxelMap, getNumberOfVoxels )
+{
+  const double lower_bounds[3] = {0.0, 0.0, 0.0};
+  const double upper_bounds[3] = {1.0, 1.0, 1.0};
+
+  Geometry::SafetyVoxelMap default_map( lower_bounds, upper_bounds );
+
+  FRENSIE_CHECK_EQUAL( default_map.getNumberOfVoxels(), 16*16*16 );
+  FRENSIE_CHECK_EQUAL( default_map.getNumberOfEvaluatedVoxels(), 0 );
+
+  Geometry::SafetyVoxelMap map( lower_bounds, upper_bounds, 4 );
+
+  FRENSIE_CHECK_EQUAL( map.getNumberOfVoxels(), 64 );
+  FRENSIE_CHECK_EQUAL( map.getNumberOfEvaluatedVoxels(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a point is in the map
+FRENSIE_UNIT_TEST( SafetyVoxelMap, isPointInMap )
+{
+  const double lower_bounds[3] = {0.0, 0.0, 0.0};
+  const double upper_bounds[3] = {1.0, 1.0, 1.0};
+
+  Geometry::SafetyVoxelMap map( lower_bounds, upper_bounds, 4 );
+
+  double position[3] = {0.5, 0.5, 0.5};
+
+  FRENSIE_CHECK( map.isPointInMap( position ) );
+
+  position[2] = 1.0;
+
+  FRENSIE_CHECK( map.isPointInMap( position ) );
+
+  position[2] = 1.5;
+
+  FRENSIE_CHECK( !map.isPointInMap( position ) );
+
+  position[2] = 0.5;
+  position[0] = -0.1;
+
+  FRENSIE_CHECK( !map.isPointInMap( position ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a lower bound on the distance to the closest boundary can be
+// returned
+FRENSIE_UNIT_TEST( SafetyVoxelMap, getDistanceToClosestBoundaryLowerBound )
+{
+  const double lower_bounds[3] = {0.0, 0.0, 0.0};
+  const double upper_bounds[3] = {1.0, 1.0, 1.0};
+
+  Geometry::SafetyVoxelMap map( lower_bounds, upper_bounds, 4 );
+
+  number_of_evaluations = 0;
+
+  // The voxel center is (0.375,0.375,0.375)
+  double position[3] = {0.4, 0.375, 0.375};
+
+  double lower_bound = map.getDistanceToClosestBoundaryLowerBound(
+                                       position, distanceToUnitCubeBoundary );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_bound, 0.35, 1e-12 );
+  FRENSIE_CHECK_LESS_OR_EQUAL( lower_bound,
+                               distanceToUnitCubeBoundary( position ) );
+  FRENSIE_CHECK_EQUAL( map.getNumberOfEvaluatedVoxels(), 1 );
+
+  number_of_evaluations = 0;
+
+  // The voxel center distance is reused
+  position[0] = 0.3;
+
+  lower_bound = map.getDistanceToClosestBoundaryLowerBound(
+                                       position, distanceToUnitCubeBoundary );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( lower_bound, 0.3, 1e-12 );
+  FRENSIE_CHECK_EQUAL( number_of_evaluations, 0 );
+  FRENSIE_CHECK_EQUAL( map.getNumberOfEvaluatedVoxels(), 1 );
+
+  // The voxel center (0.125,0.125,0.125) is too close to the boundary
+  position[0] = 0.2;
+  position[1] = 0.2;
+  position[2] = 0.2;
+
+  lower_bound = map.getDistanceToClosestBoundaryLowerBound(
+                                       position, distanceToUnitCubeBoundary );
+
+  FRENSIE_CHECK_EQUAL( lower_bound, 0.0 );
+  FRENSIE_CHECK_EQUAL( number_of_evaluations, 1 );
+  FRENSIE_CHECK_EQUAL( map.getNumberOfEvaluatedVoxels(), 2 );
+
+  // Points outside of the map have no lower bound
+  position[0] = 2.0;
+
+  lower_bound = map.getDistanceToClosestBoundaryLowerBound(
+                                       position, distanceToUnitCubeBoundary );
+
+  FRENSIE_CHECK_EQUAL( lower_bound, 0.0 );
+  FRENSIE_CHECK_EQUAL( number_of_evaluations, 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the lower bound never exceeds the distance to the closest
+// boundary
+FRENSIE_UNIT_TEST( SafetyVoxelMap, getDistanceToClosestBoundaryLowerBound_conservative )
+{
+  const double lower_bounds[3] = {0.0, 0.0, 0.0};
+  const double upper_bounds[3] = {1.0, 1.0, 1.0};
+
+  Geometry::SafetyVoxelMap map( lower_bounds, upper_bounds, 8 );
+
+  for( unsigned i = 0; i <= 20; ++i )
+  {
+    for( unsigned j = 0; j <= 20; ++j )
+    {
+      for( unsigned k = 0; k <= 20; ++k )
+      {
+        const double position[3] = {i/20.0, j/20.0, k/20.0};
+
+        const double lower_bound = map.getDistanceToClosestBoundaryLowerBound(
+                                       position, distanceToUnitCubeBoundary );
+
+        FRENSIE_CHECK_GREATER_OR_EQUAL( lower_bound, 0.0 );
+        FRENSIE_CHECK_LESS_OR_EQUAL( lower_bound,
+                                     distanceToUnitCubeBoundary( position ) );
+      }
+    }
+  }
+
+  FRENSIE_CHECK_EQUAL( map.getNumberOfEvaluatedVoxels(), 512 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstSafetyVoxelMap.cpp
+//---------------------------------------------------------------------------//
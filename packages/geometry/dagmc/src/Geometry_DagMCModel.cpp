@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <exception>
+#include <algorithm>
 #include <unordered_set>
 
 // FRENSIE Includes
@@ -114,6 +115,17 @@ void DagMCModel::initialize( const bool suppress_dagmc_output )
   EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
                            "Unable to extract the reflecting surfaces!" );
 
+  // Build the cell bounding volume hierarchies
+  if( d_model_properties->isNativeBVHRayTracingUsed() )
+  {
+    try{
+      this->buildCellBVHs();
+    }
+    EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
+                             "Unable to build the cell bounding volume "
+                             "hierarchies!" );
+  }
+
   FRENSIE_LOG_NOTIFICATION( "done!" );
   FRENSIE_FLUSH_ALL_LOGS();
 }
@@ -320,6 +332,131 @@ void DagMCModel::extractReflectingSurfaces()
   }
 }
 
+// Build the cell triangle bounding volume hierarchies
+/*! \details The triangles of every surface that bounds a cell are collected
+ * and ordered so that their normals point out of the cell (the triangles of
+ * surfaces with a reverse sense w.r.t. the cell are flipped). Each triangle
+ * is tagged with the handle of the surface that it belongs to. A safety
+ * voxel map that covers the bounding box of the triangles is also created
+ * for every cell (the voxels are only evaluated when they are first queried).
+ */
+void DagMCModel::buildCellBVHs()
+{
+  d_cell_bvhs.clear();
+  d_cell_safety_voxel_maps.clear();
+
+  moab::Interface* moab_instance = d_dagmc->moab_instance();
+
+  moab::Range::const_iterator cell_handle_it = d_cell_handler->begin();
+
+  while( cell_handle_it != d_cell_handler->end() )
+  {
+    std::vector<moab::EntityHandle> surface_handles;
+
+    moab::ErrorCode return_value =
+      moab_instance->get_child_meshsets( *cell_handle_it, surface_handles );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        InvalidDagMCGeometry,
+                        moab::ErrorCodeStr[return_value] );
+
+    std::vector<double> triangle_vertices;
+    std::vector<TriangleBVH::TriangleTag> triangle_tags;
+
+    for( size_t i = 0; i < surface_handles.size(); ++i )
+    {
+      int sense;
+
+      return_value = d_dagmc->surface_sense( *cell_handle_it,
+                                             surface_handles[i],
+                                             sense );
+
+      TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                          InvalidDagMCGeometry,
+                          moab::ErrorCodeStr[return_value] );
+
+      std::vector<moab::EntityHandle> triangle_handles;
+
+      return_value =
+        moab_instance->get_entities_by_type( surface_handles[i],
+                                             moab::MBTRI,
+                                             triangle_handles );
+
+      TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                          InvalidDagMCGeometry,
+                          moab::ErrorCodeStr[return_value] );
+
+      for( size_t j = 0; j < triangle_handles.size(); ++j )
+      {
+        const moab::EntityHandle* connectivity;
+        int number_of_vertices;
+
+        return_value = moab_instance->get_connectivity( triangle_handles[j],
+                                                        connectivity,
+                                                        number_of_vertices );
+
+        TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                            InvalidDagMCGeometry,
+                            moab::ErrorCodeStr[return_value] );
+
+        double coordinates[9];
+
+        return_value =
+          moab_instance->get_coords( connectivity, 3, coordinates );
+
+        TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                            InvalidDagMCGeometry,
+                            moab::ErrorCodeStr[return_value] );
+
+        // Surfaces with a reverse sense point into the cell
+        if( sense == -1 )
+          std::swap_ranges( coordinates+3, coordinates+6, coordinates+6 );
+
+        triangle_vertices.insert( triangle_vertices.end(),
+                                  coordinates,
+                                  coordinates+9 );
+        triangle_tags.push_back( surface_handles[i] );
+
+        // Surfaces that the cell is on both sides of are stored with both
+        // orientations so that they can always be exited
+        if( sense == 0 )
+        {
+          std::swap_ranges( coordinates+3, coordinates+6, coordinates+6 );
+
+          triangle_vertices.insert( triangle_vertices.end(),
+                                    coordinates,
+                                    coordinates+9 );
+          triangle_tags.push_back( surface_handles[i] );
+        }
+      }
+    }
+
+    d_cell_bvhs[*cell_handle_it].reset(
+                       new TriangleBVH( triangle_vertices, triangle_tags ) );
+
+    if( !triangle_vertices.empty() )
+    {
+      double lower_bounds[3] = {triangle_vertices[0],
+                                triangle_vertices[1],
+                                triangle_vertices[2]};
+      double upper_bounds[3] = {triangle_vertices[0],
+                                triangle_vertices[1],
+                                triangle_vertices[2]};
+
+      for( size_t i = 3; i < triangle_vertices.size(); ++i )
+      {
+        lower_bounds[i%3] = std::min( lower_bounds[i%3], triangle_vertices[i] );
+        upper_bounds[i%3] = std::max( upper_bounds[i%3], triangle_vertices[i] );
+      }
+
+      d_cell_safety_voxel_maps[*cell_handle_it].reset(
+                           new SafetyVoxelMap( lower_bounds, upper_bounds ) );
+    }
+
+    ++cell_handle_it;
+  }
+}
+
 // Get the model properties
 const DagMCModelProperties& DagMCModel::getModelProperties() const
 {
@@ -731,6 +868,83 @@ bool DagMCModel::isReflectingSurface( const EntityId surface_id ) const
     d_reflecting_surfaces.left.end();
 }
 
+// Fire a packet of rays from a cell
+/*! \details The positions and directions arrays must store the three
+ * coordinates of each ray and every ray must start in the cell of interest.
+ * If native BVH ray tracing is used the packet will be traced through the
+ * cell hierarchy together (see Geometry::TriangleBVH::fireRays). Otherwise,
+ * each ray will be fired with MOAB. This method is thread safe.
+ */
+void DagMCModel::fireRays( const EntityId cell_id,
+                           const size_t number_of_rays,
+                           const double positions[],
+                           const double directions[],
+                           double distances[],
+                           EntityId surfaces_hit[] ) const
+{
+  // Make sure the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  moab::EntityHandle cell_handle = d_cell_handler->getCellHandle( cell_id );
+
+  const TriangleBVH* cell_bvh = this->getCellBVH( cell_handle );
+
+  if( cell_bvh )
+  {
+    std::vector<size_t> triangles_hit( number_of_rays );
+
+    cell_bvh->fireRays( number_of_rays,
+                        positions,
+                        directions,
+                        distances,
+                        triangles_hit.data() );
+
+    for( size_t i = 0; i < number_of_rays; ++i )
+    {
+      TEST_FOR_EXCEPTION( triangles_hit[i] == TriangleBVH::invalid_triangle,
+                          DagMCGeometryError,
+                          "A packet ray misfired in cell " << cell_id <<
+                          "! Here are the details...\n"
+                          "  Position: " << positions[3*i] << " "
+                          << positions[3*i+1] << " " << positions[3*i+2] <<
+                          "\n  Direction: " << directions[3*i] << " "
+                          << directions[3*i+1] << " " << directions[3*i+2] );
+
+      surfaces_hit[i] = d_surface_handler->getSurfaceId(
+                         cell_bvh->getTriangleTag( triangles_hit[i] ) );
+    }
+  }
+  else
+  {
+    for( size_t i = 0; i < number_of_rays; ++i )
+    {
+      moab::EntityHandle surface_hit_handle;
+
+      moab::ErrorCode return_value =
+        d_dagmc->ray_fire( cell_handle,
+                           positions + 3*i,
+                           directions + 3*i,
+                           surface_hit_handle,
+                           distances[i] );
+
+      TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                          DagMCGeometryError,
+                          moab::ErrorCodeStr[return_value] );
+
+      TEST_FOR_EXCEPTION( surface_hit_handle == 0,
+                          DagMCGeometryError,
+                          "A packet ray misfired in cell " << cell_id <<
+                          "! Here are the details...\n"
+                          "  Position: " << positions[3*i] << " "
+                          << positions[3*i+1] << " " << positions[3*i+2] <<
+                          "\n  Direction: " << directions[3*i] << " "
+                          << directions[3*i+1] << " " << directions[3*i+2] );
+
+      surfaces_hit[i] = d_surface_handler->getSurfaceId( surface_hit_handle );
+    }
+  }
+}
+
 // Create a raw, heap-allocated navigator
 DagMCNavigator* DagMCModel::createNavigatorAdvanced(
     const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const
@@ -973,6 +1187,30 @@ moab::DagMC& DagMCModel::getRawDagMCInstance() const
   return *d_dagmc;
 }
 
+// Return the cell triangle bounding volume hierarchy (NULL if not built)
+const TriangleBVH* DagMCModel::getCellBVH(
+                                  const moab::EntityHandle cell_handle ) const
+{
+  auto cell_bvh_it = d_cell_bvhs.find( cell_handle );
+
+  if( cell_bvh_it != d_cell_bvhs.end() )
+    return cell_bvh_it->second.get();
+  else
+    return NULL;
+}
+
+// Return the cell safety voxel map (NULL if not built)
+const SafetyVoxelMap* DagMCModel::getCellSafetyVoxelMap(
+                                  const moab::EntityHandle cell_handle ) const
+{
+  auto cell_safety_voxel_map_it = d_cell_safety_voxel_maps.find( cell_handle );
+
+  if( cell_safety_voxel_map_it != d_cell_safety_voxel_maps.end() )
+    return cell_safety_voxel_map_it->second.get();
+  else
+    return NULL;
+}
+
 EXPLICIT_CLASS_SAVE_LOAD_INST( DagMCModel );
 
 }  // end Geometry namespace
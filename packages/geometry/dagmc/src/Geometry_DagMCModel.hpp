@@ -23,6 +23,8 @@
 #include "Geometry_DagMCCellHandler.hpp"
 #include "Geometry_DagMCSurfaceHandler.hpp"
 #include "Geometry_DagMCNavigator.hpp"
+#include "Geometry_TriangleBVH.hpp"
+#include "Geometry_SafetyVoxelMap.hpp"
 #include "Geometry_PointLocation.hpp"
 #include "Geometry_AdvancedModel.hpp"
 #include "Utility_JustInTimeInitializer.hpp"
@@ -107,6 +109,14 @@ public:
   //! Check if the surface is a reflecting surface
   bool isReflectingSurface( const EntityId surface_id ) const override;
 
+  //! Fire a packet of rays from a cell
+  void fireRays( const EntityId cell_id,
+                 const size_t number_of_rays,
+                 const double positions[],
+                 const double directions[],
+                 double distances[],
+                 EntityId surfaces_hit[] ) const;
+
   //! Create a raw, heap-allocated navigator
   DagMCNavigator* createNavigatorAdvanced( const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const override;
 
@@ -162,6 +172,9 @@ private:
   // Extract the reflecting surfaces
   void extractReflectingSurfaces();
 
+  // Build the cell triangle bounding volume hierarchies
+  void buildCellBVHs();
+
   // Get the property values associated with a property name
   void getPropertyValues( const std::string& property,
                           PropertyValuesArray& values ) const;
@@ -217,6 +230,13 @@ private:
   //! Return the raw dagmc instance
   moab::DagMC& getRawDagMCInstance() const;
 
+  //! Return the cell triangle bounding volume hierarchy (NULL if not built)
+  const TriangleBVH* getCellBVH( const moab::EntityHandle cell_handle ) const;
+
+  //! Return the cell safety voxel map (NULL if not built)
+  const SafetyVoxelMap* getCellSafetyVoxelMap(
+                                  const moab::EntityHandle cell_handle ) const;
+
   // Save the model to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -253,6 +273,14 @@ private:
   ReflectingSurfaceIdHandleMap;
   ReflectingSurfaceIdHandleMap d_reflecting_surfaces;
 
+  // The cell triangle bounding volume hierarchies
+  std::map<moab::EntityHandle,std::unique_ptr<const TriangleBVH> >
+  d_cell_bvhs;
+
+  // The cell safety voxel maps (filled lazily)
+  std::map<moab::EntityHandle,std::unique_ptr<const SafetyVoxelMap> >
+  d_cell_safety_voxel_maps;
+
   // The model properties
   std::unique_ptr<const DagMCModelProperties> d_model_properties;
 };
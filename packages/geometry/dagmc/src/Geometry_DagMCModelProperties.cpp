@@ -31,6 +31,7 @@ DagMCModelProperties::DagMCModelProperties(
   : d_file_name( filename.filename().string() ),
     d_file_path( filename.parent_path().make_preferred() ),
     d_fast_id_lookup( false ),
+    d_native_bvh_ray_tracing( false ),
     d_termination_cell_property( "termination.cell" ),
     d_reflecting_surface_property( "reflecting.surface" ),
     d_material_property( "material" ),
@@ -105,6 +106,30 @@ void DagMCModelProperties::useStandardIdLookup()
   d_fast_id_lookup = false;
 }
 
+// Check if native BVH ray tracing is used with the model
+bool DagMCModelProperties::isNativeBVHRayTracingUsed() const
+{
+  return d_native_bvh_ray_tracing;
+}
+
+// Use native BVH ray tracing with the model
+/*! \details A triangle bounding volume hierarchy will be built for each cell
+ * when the model is initialized. Ray fires, point location queries and
+ * closest boundary queries will be done with the cell hierarchies instead
+ * of the MOAB OBB trees. The MOAB instance is still used for all topology
+ * queries (e.g. the cell on the other side of a surface).
+ */
+void DagMCModelProperties::useNativeBVHRayTracing()
+{
+  d_native_bvh_ray_tracing = true;
+}
+
+// Use MOAB ray tracing with the model
+void DagMCModelProperties::useMOABRayTracing()
+{
+  d_native_bvh_ray_tracing = false;
+}
+
 // Set the termination cell property name
 void DagMCModelProperties::setTerminationCellPropertyName(
                                                       const std::string& name )
@@ -62,6 +62,15 @@ public:
   //! Use standard id lookup with the model
   void useStandardIdLookup();
 
+  //! Check if native BVH ray tracing is used with the model
+  bool isNativeBVHRayTracingUsed() const;
+
+  //! Use native BVH ray tracing with the model
+  void useNativeBVHRayTracing();
+
+  //! Use MOAB ray tracing with the model
+  void useMOABRayTracing();
+
   //! Set the termination cell property name
   void setTerminationCellPropertyName( const std::string& name );
 
@@ -209,6 +218,9 @@ private:
   // The fast id lookup flag
   bool d_fast_id_lookup;
 
+  // The native BVH ray tracing flag
+  bool d_native_bvh_ray_tracing;
+
   // The termination cell property name
   std::string d_termination_cell_property;
 
@@ -269,6 +281,7 @@ void DagMCModelProperties::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( raw_file_path );
   
   ar & BOOST_SERIALIZATION_NVP( d_fast_id_lookup );
+  ar & BOOST_SERIALIZATION_NVP( d_native_bvh_ray_tracing );
   ar & BOOST_SERIALIZATION_NVP( d_termination_cell_property );
   ar & BOOST_SERIALIZATION_NVP( d_reflecting_surface_property );
   ar & BOOST_SERIALIZATION_NVP( d_material_property );
@@ -306,6 +319,7 @@ void DagMCModelProperties::load( Archive& ar, const unsigned version )
     d_file_path = s_default_path;
   
   ar & BOOST_SERIALIZATION_NVP( d_fast_id_lookup );
+  ar & BOOST_SERIALIZATION_NVP( d_native_bvh_ray_tracing );
   ar & BOOST_SERIALIZATION_NVP( d_termination_cell_property );
   ar & BOOST_SERIALIZATION_NVP( d_reflecting_surface_property );
   ar & BOOST_SERIALIZATION_NVP( d_material_property );
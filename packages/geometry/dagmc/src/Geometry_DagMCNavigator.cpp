@@ -22,6 +22,7 @@ namespace Geometry{
 
 // Initialize static member data
 const double DagMCNavigator::s_boundary_tol = 1e-5;
+const double DagMCNavigator::s_min_reusable_safety_fraction = 0.5;
 
 // Default constructor
 DagMCNavigator::DagMCNavigator()
@@ -270,11 +271,84 @@ auto DagMCNavigator::getCurrentCell() const -> EntityId
 }
 
 // Get the distance from the internal DagMC ray pos. to the nearest boundary in all directions
+/*! \details The result of the last closest boundary query in the current
+ * cell is stored with the internal ray. While the ray stays in the cell the
+ * safety sphere of that query provides a lower bound on the distance to the
+ * closest boundary that only depends on the straight-line displacement of
+ * the ray (not on the path length traveled or on the direction changes since
+ * the query). The lower bound will be returned instead of evaluating a new
+ * query if it is not less than half of the safety sphere radius. If the
+ * native cell hierarchies have been built the cell safety voxel map will be
+ * checked next. A (conservative) distance will always be returned.
+ */
 auto DagMCNavigator::getDistanceToClosestBoundary() -> Length
 {
   // Make sure that the ray is set
   testPrecondition( this->isStateSet() );
 
+  ClosestBoundaryQueryStatistics& query_statistics =
+    ClosestBoundaryQueryStatistics::getThreadStatistics();
+
+  // Reuse the safety sphere of the last query
+  if( d_internal_ray.knowsClosestBoundaryDistance() )
+  {
+    const double safety_distance =
+      d_internal_ray.getClosestBoundaryDistanceLowerBound();
+
+    if( safety_distance >= s_min_reusable_safety_fraction*
+        d_internal_ray.getClosestBoundaryDistance() )
+    {
+      query_statistics.recordSafetySphereReuse();
+
+      return Length::from_value( safety_distance );
+    }
+  }
+
+  const double raw_distance_to_surface =
+    this->getDistanceToClosestBoundaryImpl( query_statistics );
+
+  d_internal_ray.setClosestBoundaryData( raw_distance_to_surface );
+
+  return Length::from_value( raw_distance_to_surface );
+}
+
+// Get the distance to the nearest boundary without the safety sphere
+double DagMCNavigator::getDistanceToClosestBoundaryImpl(
+                      ClosestBoundaryQueryStatistics& query_statistics ) const
+{
+  // Use the native cell hierarchy if it has been built
+  const TriangleBVH* cell_bvh =
+    d_dagmc_model->getCellBVH( d_internal_ray.getCurrentCell() );
+
+  if( cell_bvh )
+  {
+    const SafetyVoxelMap* cell_safety_voxel_map =
+      d_dagmc_model->getCellSafetyVoxelMap( d_internal_ray.getCurrentCell() );
+
+    if( cell_safety_voxel_map )
+    {
+      const double safety_distance =
+        cell_safety_voxel_map->getDistanceToClosestBoundaryLowerBound(
+          d_internal_ray.getPosition(),
+          [cell_bvh]( const double position[3] ){
+            return cell_bvh->getDistanceToClosestBoundary( position ); } );
+
+      if( safety_distance > 0.0 )
+      {
+        query_statistics.recordSafetyVoxelMapReuse();
+
+        return safety_distance;
+      }
+    }
+
+    query_statistics.recordEvaluatedQuery();
+
+    return cell_bvh->getDistanceToClosestBoundary(
+                                               d_internal_ray.getPosition() );
+  }
+
+  query_statistics.recordEvaluatedQuery();
+
   moab::EntityHandle surface_hit_handle;
 
   double raw_distance_to_surface;
@@ -301,7 +375,7 @@ auto DagMCNavigator::getDistanceToClosestBoundary() -> Length
                "  Position: "
                << this->arrayToString( d_internal_ray.getPosition() ) );
 
-  return Length::from_value(raw_distance_to_surface);
+  return raw_distance_to_surface;
 }
 
 // Get the distance from the internal DagMC ray pos. to the nearest boundary
@@ -494,6 +568,16 @@ PointLocation DagMCNavigator::getPointLocationWithCellHandle(
   // Make sure that the direction is valid
   testPrecondition( Utility::isUnitVector( direction ) );
 
+  // Use the native cell hierarchy if it has been built
+  const TriangleBVH* cell_bvh = d_dagmc_model->getCellBVH( cell_handle );
+
+  if( cell_bvh )
+  {
+    return cell_bvh->getPointLocation( Utility::reinterpretAsRaw(position),
+                                       direction,
+                                       s_boundary_tol );
+  }
+
   int test_result;
 
   moab::ErrorCode return_value =
@@ -653,6 +737,37 @@ auto DagMCNavigator::fireRayWithCellHandle(
 
   double raw_distance_to_surface;
 
+  // Use the native cell hierarchy if it has been built. Only the facets that
+  // the ray exits the cell through are considered, which prevents the facet
+  // that the ray is currently on from being hit again (the ray history is
+  // not needed).
+  const TriangleBVH* cell_bvh =
+    d_dagmc_model->getCellBVH( current_cell_handle );
+
+  if( cell_bvh )
+  {
+    size_t triangle_hit;
+
+    const bool hit = cell_bvh->fireRay( Utility::reinterpretAsRaw(position),
+                                        direction,
+                                        raw_distance_to_surface,
+                                        triangle_hit );
+
+    TEST_FOR_EXCEPTION( !hit,
+                        DagMCGeometryError,
+                        "DagMC had a ray misfire! Here are the details...\n"
+                        "  Current Cell: "
+                        << d_dagmc_model->getCellHandler().getCellId( current_cell_handle ) << "\n"
+                        "  Position: "
+                        << this->arrayToString( position ) << "\n"
+                        "  Direction: "
+                        << this->arrayToString( direction ) );
+
+    surface_hit_handle = cell_bvh->getTriangleTag( triangle_hit );
+
+    return Length::from_value(raw_distance_to_surface);
+  }
+
   moab::ErrorCode return_value =
     d_dagmc_model->getRawDagMCInstance().ray_fire( current_cell_handle,
                                                    Utility::reinterpretAsRaw(position),
@@ -20,6 +20,7 @@
 #include "Geometry_DagMCSurfaceHandler.hpp"
 #include "Geometry_DagMCRay.hpp"
 #include "Geometry_Navigator.hpp"
+#include "Geometry_ClosestBoundaryQueryStatistics.hpp"
 
 namespace Geometry{
 
@@ -188,6 +189,10 @@ private:
                                 moab::EntityHandle& surface_hit_handle,
                                 moab::DagMC::RayHistory* history = NULL ) const;
 
+  // Get the distance to the nearest boundary without the safety sphere
+  double getDistanceToClosestBoundaryImpl(
+                     ClosestBoundaryQueryStatistics& query_statistics ) const;
+
   // Set an internal DagMC ray
   void setStateWithCellHandle( const Length x_position,
                                const Length y_position,
@@ -206,6 +211,10 @@ private:
   // The boundary tolerance
   static const double s_boundary_tol;
 
+  // The min fraction of the safety sphere radius that a reused safety
+  // distance must have
+  static const double s_min_reusable_safety_fraction;
+
   // The DagMC model
   std::shared_ptr<const DagMCModel> d_dagmc_model;
 
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "Geometry_DagMCRay.hpp"
 #include "Utility_3DCartesianVectorHelpers.hpp"
@@ -19,7 +22,9 @@ DagMCRay::DagMCRay()
     d_cell_handle( 0 ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_closest_boundary_query_position(),
+    d_closest_boundary_distance( -1.0 )
 { /* ... */ }
 
 // Constructor
@@ -28,7 +33,9 @@ DagMCRay::DagMCRay( const Ray& ray, moab::EntityHandle cell_handle )
     d_cell_handle( cell_handle ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_closest_boundary_query_position(),
+    d_closest_boundary_distance( -1.0 )
 {
   // Make sure the direction is valid
   testPrecondition( Utility::isUnitVector( d_basic_ray->getDirection() ) );
@@ -44,7 +51,9 @@ DagMCRay::DagMCRay( const double position[3],
     d_cell_handle( cell_handle ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_closest_boundary_query_position(),
+    d_closest_boundary_distance( -1.0 )
 {
   // Make sure the direction is valid
   testPrecondition( Utility::isUnitVector( direction ) );
@@ -65,7 +74,9 @@ DagMCRay::DagMCRay( const double x_position,
     d_cell_handle( cell_handle ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_closest_boundary_query_position(),
+    d_closest_boundary_distance( -1.0 )
 {
   // Make sure the direction is valid
   testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
@@ -79,7 +90,9 @@ DagMCRay::DagMCRay( const DagMCRay& ray )
     d_cell_handle( 0 ),
     d_history(),
     d_intersection_distance( -1.0 ),
-    d_intersection_surface_handle( 0 )
+    d_intersection_surface_handle( 0 ),
+    d_closest_boundary_query_position(),
+    d_closest_boundary_distance( -1.0 )
 {
   if( ray.isReady() )
   {
@@ -96,6 +109,15 @@ DagMCRay::DagMCRay( const DagMCRay& ray )
 
       d_intersection_surface_handle = ray.d_intersection_surface_handle;
     }
+
+    if( ray.knowsClosestBoundaryDistance() )
+    {
+      std::copy( ray.d_closest_boundary_query_position,
+                 ray.d_closest_boundary_query_position+3,
+                 d_closest_boundary_query_position );
+
+      d_closest_boundary_distance = ray.d_closest_boundary_distance;
+    }
   }
 }
 
@@ -158,6 +180,7 @@ void DagMCRay::set( const double x_position,
 
   // Reset the extra data
   this->resetIntersectionSurfaceData();
+  this->resetClosestBoundaryData();
   d_history.reset();
 }
 
@@ -174,7 +197,8 @@ void DagMCRay::changeDirection( const double direction[3],
 }
 
 // Change the direction
-/*! \details This method will reset the history.
+/*! \details This method will reset the history. The closest boundary data
+ * is not reset since it does not depend on the direction.
  */
 void DagMCRay::changeDirection( const double x_direction,
                                 const double y_direction,
@@ -269,6 +293,67 @@ void DagMCRay::resetIntersectionSurfaceData()
   d_intersection_distance = -1.0;
 }
 
+// Check if the ray knows the distance to the closest boundary
+bool DagMCRay::knowsClosestBoundaryDistance() const
+{
+  return d_closest_boundary_distance >= 0.0;
+}
+
+// Set the distance to the closest boundary (at the current position)
+void DagMCRay::setClosestBoundaryData( const double distance )
+{
+  // Make sure the ray is ready
+  testPrecondition( this->isReady() );
+  // Make sure the distance is valid
+  testPrecondition( distance >= 0.0 );
+
+  const double* position = d_basic_ray->getPosition();
+
+  std::copy( position, position+3, d_closest_boundary_query_position );
+
+  d_closest_boundary_distance = distance;
+}
+
+// Reset the closest boundary data
+void DagMCRay::resetClosestBoundaryData()
+{
+  d_closest_boundary_distance = -1.0;
+}
+
+// Get the distance to the closest boundary (where it was set)
+double DagMCRay::getClosestBoundaryDistance() const
+{
+  // Make sure the closest boundary distance has been set
+  testPrecondition( this->knowsClosestBoundaryDistance() );
+
+  return d_closest_boundary_distance;
+}
+
+// Get a lower bound on the distance to the closest boundary
+/*! \details The sphere centered at the position where the closest boundary
+ * distance was calculated with a radius equal to that distance does not
+ * intersect the cell boundary (safety sphere). The distance from the current
+ * position to the closest boundary is therefore at least the closest boundary
+ * distance minus the distance from the sphere center, regardless of how the
+ * ray has changed direction since (e.g. after elastic deflections). A
+ * negative value will be returned if the ray has left the safety sphere.
+ */
+double DagMCRay::getClosestBoundaryDistanceLowerBound() const
+{
+  // Make sure the closest boundary distance has been set
+  testPrecondition( this->knowsClosestBoundaryDistance() );
+
+  const double* position = d_basic_ray->getPosition();
+
+  const double displacement[3] =
+    {position[0] - d_closest_boundary_query_position[0],
+     position[1] - d_closest_boundary_query_position[1],
+     position[2] - d_closest_boundary_query_position[2]};
+
+  return d_closest_boundary_distance -
+    Utility::vectorMagnitude( displacement );
+}
+
 // Get the ray history
 const moab::DagMC::RayHistory& DagMCRay::getHistory() const
 {
@@ -282,7 +367,8 @@ moab::DagMC::RayHistory& DagMCRay::getHistory()
 }
 
 // Advance the ray to the intersection surface
-/*! \details This method will reset the intersection data.
+/*! \details This method will reset the intersection data and the closest
+ * boundary data.
  */
 void DagMCRay::advanceToIntersectionSurface(
                                     const moab::EntityHandle next_cell_handle )
@@ -298,6 +384,7 @@ void DagMCRay::advanceToIntersectionSurface(
 
   // Reset the intersection data
   this->resetIntersectionSurfaceData();
+  this->resetClosestBoundaryData();
 }
 
 // Advance the ray a substep
@@ -108,6 +108,21 @@ public:
   //! Get the boundary surface
   moab::EntityHandle getIntersectionSurface() const;
 
+  //! Check if the ray knows the distance to the closest boundary
+  bool knowsClosestBoundaryDistance() const;
+
+  //! Set the distance to the closest boundary (at the current position)
+  void setClosestBoundaryData( const double distance );
+
+  //! Reset the closest boundary data
+  void resetClosestBoundaryData();
+
+  //! Get the distance to the closest boundary (where it was set)
+  double getClosestBoundaryDistance() const;
+
+  //! Get a lower bound on the distance to the closest boundary
+  double getClosestBoundaryDistanceLowerBound() const;
+
   //! Get the ray history
   const moab::DagMC::RayHistory& getHistory() const;
 
@@ -137,6 +152,12 @@ private:
 
   // The boundary surface that will be intersected (0 for not known)
   moab::EntityHandle d_intersection_surface_handle;
+
+  // The position where the distance to the closest boundary was calculated
+  double d_closest_boundary_query_position[3];
+
+  // The distance to the closest boundary (-1 for not known)
+  double d_closest_boundary_distance;
 };
 
 } // end Geometry namespace
@@ -0,0 +1,881 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_TriangleBVH.cpp
+//! \author Alex Robinson
+//! \brief  Triangle bounding volume hierarchy class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_TriangleBVH.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// The max traversal stack depth
+static const unsigned s_max_stack_depth = 256;
+
+// Initialize static member data
+const size_t TriangleBVH::invalid_triangle =
+  std::numeric_limits<size_t>::max();
+
+// Constructor
+/*! \details The triangle vertices array must store the nine vertex
+ * coordinates of each triangle (v0, v1, v2). The vertices of each triangle
+ * must be ordered so that the triangle normal ((v1-v0) x (v2-v0)) points out
+ * of the bounded volume. The leaf size is the max number of triangles that
+ * will be stored in a leaf.
+ */
+TriangleBVH::TriangleBVH( const std::vector<double>& triangle_vertices,
+                          const std::vector<TriangleTag>& triangle_tags,
+                          const unsigned leaf_size )
+  : d_leaf_size( leaf_size ),
+    d_nodes(),
+    d_triangle_tags()
+{
+  TEST_FOR_EXCEPTION( triangle_vertices.size() != 9*triangle_tags.size(),
+                      std::runtime_error,
+                      "The triangle vertices array must store 9 coordinates "
+                      "for each triangle tag!" );
+
+  TEST_FOR_EXCEPTION( leaf_size == 0 || leaf_size > max_leaf_size,
+                      std::runtime_error,
+                      "The leaf size must be in the range [1,"
+                      << max_leaf_size << "]!" );
+
+  TEST_FOR_EXCEPTION( triangle_tags.size() >
+                      std::numeric_limits<uint32_t>::max(),
+                      std::runtime_error,
+                      "Too many triangles have been requested!" );
+
+  const uint32_t number_of_triangles = triangle_tags.size();
+
+  // Calculate the centroid and bounds of each triangle
+  std::vector<double> centroids( 3*number_of_triangles );
+  std::vector<double> lower_bounds( 3*number_of_triangles );
+  std::vector<double> upper_bounds( 3*number_of_triangles );
+
+  for( uint32_t i = 0; i < number_of_triangles; ++i )
+  {
+    const double* vertices = triangle_vertices.data() + 9*i;
+
+    for( unsigned j = 0; j < 3; ++j )
+    {
+      centroids[3*i+j] = (vertices[j] + vertices[3+j] + vertices[6+j])/3.0;
+
+      lower_bounds[3*i+j] =
+        std::min( vertices[j], std::min( vertices[3+j], vertices[6+j] ) );
+
+      upper_bounds[3*i+j] =
+        std::max( vertices[j], std::max( vertices[3+j], vertices[6+j] ) );
+    }
+  }
+
+  // Build the hierarchy (the triangle indices will be reordered so that the
+  // triangles in each leaf are contiguous)
+  std::vector<uint32_t> triangle_indices( number_of_triangles );
+
+  for( uint32_t i = 0; i < number_of_triangles; ++i )
+    triangle_indices[i] = i;
+
+  this->buildNode( triangle_indices,
+                   centroids,
+                   lower_bounds,
+                   upper_bounds,
+                   0,
+                   number_of_triangles );
+
+  // Store the triangles in the leaf order
+  for( unsigned j = 0; j < 3; ++j )
+  {
+    d_vertex_0[j].resize( number_of_triangles );
+    d_edge_1[j].resize( number_of_triangles );
+    d_edge_2[j].resize( number_of_triangles );
+  }
+
+  d_triangle_tags.resize( number_of_triangles );
+
+  for( uint32_t i = 0; i < number_of_triangles; ++i )
+  {
+    const uint32_t triangle = triangle_indices[i];
+
+    const double* vertices = triangle_vertices.data() + 9*triangle;
+
+    for( unsigned j = 0; j < 3; ++j )
+    {
+      d_vertex_0[j][i] = vertices[j];
+      d_edge_1[j][i] = vertices[3+j] - vertices[j];
+      d_edge_2[j][i] = vertices[6+j] - vertices[j];
+    }
+
+    d_triangle_tags[i] = triangle_tags[triangle];
+  }
+}
+
+// Build a node of the hierarchy
+/*! \details The triangle range is split into (up to) four groups by
+ * repeatedly splitting the largest group at the median centroid along the
+ * longest axis of its centroid bounds. Each group becomes a leaf or an
+ * internal child node. The index of the node is returned.
+ */
+uint32_t TriangleBVH::buildNode( std::vector<uint32_t>& triangle_indices,
+                                 const std::vector<double>& centroids,
+                                 const std::vector<double>& lower_bounds,
+                                 const std::vector<double>& upper_bounds,
+                                 const uint32_t begin,
+                                 const uint32_t end )
+{
+  const uint32_t node_index = d_nodes.size();
+
+  d_nodes.push_back( Node() );
+
+  // Split the triangle range into groups
+  uint32_t group_begin[node_width];
+  uint32_t group_end[node_width];
+  unsigned number_of_groups = 1;
+
+  group_begin[0] = begin;
+  group_end[0] = end;
+
+  while( number_of_groups < node_width )
+  {
+    // Find the largest group that must be split
+    int split_group = -1;
+    uint32_t max_group_size = d_leaf_size;
+
+    for( unsigned g = 0; g < number_of_groups; ++g )
+    {
+      if( group_end[g] - group_begin[g] > max_group_size )
+      {
+        split_group = g;
+        max_group_size = group_end[g] - group_begin[g];
+      }
+    }
+
+    if( split_group < 0 )
+      break;
+
+    const uint32_t split_begin = group_begin[split_group];
+    const uint32_t split_end = group_end[split_group];
+
+    // Find the longest axis of the centroid bounds
+    double centroid_lower[3] = {std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::max()};
+    double centroid_upper[3] = {std::numeric_limits<double>::lowest(),
+                                std::numeric_limits<double>::lowest(),
+                                std::numeric_limits<double>::lowest()};
+
+    for( uint32_t i = split_begin; i < split_end; ++i )
+    {
+      for( unsigned j = 0; j < 3; ++j )
+      {
+        const double centroid = centroids[3*triangle_indices[i]+j];
+
+        centroid_lower[j] = std::min( centroid_lower[j], centroid );
+        centroid_upper[j] = std::max( centroid_upper[j], centroid );
+      }
+    }
+
+    unsigned axis = 0;
+
+    for( unsigned j = 1; j < 3; ++j )
+    {
+      if( centroid_upper[j] - centroid_lower[j] >
+          centroid_upper[axis] - centroid_lower[axis] )
+        axis = j;
+    }
+
+    // Split the group at the median centroid
+    const uint32_t split_mid = split_begin + (split_end - split_begin)/2;
+
+    std::nth_element( triangle_indices.begin() + split_begin,
+                      triangle_indices.begin() + split_mid,
+                      triangle_indices.begin() + split_end,
+                      [&centroids, axis]( const uint32_t a, const uint32_t b ){
+                        return centroids[3*a+axis] < centroids[3*b+axis]; } );
+
+    group_end[split_group] = split_mid;
+    group_begin[number_of_groups] = split_mid;
+    group_end[number_of_groups] = split_end;
+
+    ++number_of_groups;
+  }
+
+  // Set the children
+  for( unsigned c = 0; c < node_width; ++c )
+  {
+    if( c >= number_of_groups || group_begin[c] == group_end[c] )
+    {
+      Node& node = d_nodes[node_index];
+
+      for( unsigned j = 0; j < 3; ++j )
+      {
+        node.lower[j][c] = std::numeric_limits<double>::infinity();
+        node.upper[j][c] = -std::numeric_limits<double>::infinity();
+      }
+
+      node.offset[c] = 0;
+      node.count[c] = 0;
+      node.empty[c] = true;
+
+      continue;
+    }
+
+    // Calculate the child bounds (padded to account for round-off)
+    double child_lower[3] = {std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::max()};
+    double child_upper[3] = {std::numeric_limits<double>::lowest(),
+                             std::numeric_limits<double>::lowest(),
+                             std::numeric_limits<double>::lowest()};
+
+    for( uint32_t i = group_begin[c]; i < group_end[c]; ++i )
+    {
+      for( unsigned j = 0; j < 3; ++j )
+      {
+        child_lower[j] = std::min( child_lower[j],
+                                   lower_bounds[3*triangle_indices[i]+j] );
+        child_upper[j] = std::max( child_upper[j],
+                                   upper_bounds[3*triangle_indices[i]+j] );
+      }
+    }
+
+    uint32_t child_offset, child_count;
+
+    if( group_end[c] - group_begin[c] <= d_leaf_size )
+    {
+      child_offset = group_begin[c];
+      child_count = group_end[c] - group_begin[c];
+    }
+    else
+    {
+      // Note: this will invalidate any references to the nodes
+      child_offset = this->buildNode( triangle_indices,
+                                      centroids,
+                                      lower_bounds,
+                                      upper_bounds,
+                                      group_begin[c],
+                                      group_end[c] );
+      child_count = 0;
+    }
+
+    Node& node = d_nodes[node_index];
+
+    for( unsigned j = 0; j < 3; ++j )
+    {
+      node.lower[j][c] =
+        child_lower[j] - 1e-9*(1.0 + std::fabs( child_lower[j] ));
+      node.upper[j][c] =
+        child_upper[j] + 1e-9*(1.0 + std::fabs( child_upper[j] ));
+    }
+
+    node.offset[c] = child_offset;
+    node.count[c] = child_count;
+    node.empty[c] = false;
+  }
+
+  return node_index;
+}
+
+// Return the number of triangles
+size_t TriangleBVH::getNumberOfTriangles() const
+{
+  return d_triangle_tags.size();
+}
+
+// Return the number of nodes
+size_t TriangleBVH::getNumberOfNodes() const
+{
+  return d_nodes.size();
+}
+
+// Return the tag of a triangle
+auto TriangleBVH::getTriangleTag( const size_t triangle ) const -> TriangleTag
+{
+  // Make sure that the triangle is valid
+  testPrecondition( triangle < d_triangle_tags.size() );
+
+  return d_triangle_tags[triangle];
+}
+
+// Return the (outward) unit normal of a triangle
+void TriangleBVH::getTriangleNormal( const size_t triangle,
+                                     double normal[3] ) const
+{
+  // Make sure that the triangle is valid
+  testPrecondition( triangle < d_triangle_tags.size() );
+
+  normal[0] = d_edge_1[1][triangle]*d_edge_2[2][triangle] -
+    d_edge_1[2][triangle]*d_edge_2[1][triangle];
+  normal[1] = d_edge_1[2][triangle]*d_edge_2[0][triangle] -
+    d_edge_1[0][triangle]*d_edge_2[2][triangle];
+  normal[2] = d_edge_1[0][triangle]*d_edge_2[1][triangle] -
+    d_edge_1[1][triangle]*d_edge_2[0][triangle];
+
+  const double norm = std::sqrt( normal[0]*normal[0] +
+                                 normal[1]*normal[1] +
+                                 normal[2]*normal[2] );
+
+  normal[0] /= norm;
+  normal[1] /= norm;
+  normal[2] /= norm;
+}
+
+// Fire a ray and find the closest triangle that the ray exits through
+/*! \details Only triangles that the ray exits the bounded volume through
+ * (direction.normal > 0) will be considered. This prevents the triangle
+ * that a ray was just advanced to from being hit again after the ray enters
+ * the next volume or after it is reflected. If no triangle is hit false will
+ * be returned.
+ */
+bool TriangleBVH::fireRay( const double position[3],
+                           const double direction[3],
+                           double& distance,
+                           size_t& triangle ) const
+{
+  RayData ray;
+
+  this->initializeRayData( position, direction, ray );
+
+  bool exiting;
+
+  return this->findClosestHit( ray, true, distance, triangle, exiting );
+}
+
+// Fire a packet of rays
+/*! \details The positions and directions arrays must store the three
+ * coordinates of each ray. The packet is traversed together: each child
+ * bounding box is tested against every ray in the packet with a single SIMD
+ * loop and the child is only visited if at least one ray hits it. Rays
+ * with similar origins and directions (e.g. rays from the same event queue
+ * and cell) will visit similar nodes so the node data is only loaded once
+ * for the whole packet. The distance will be set to infinity and the
+ * triangle will be set to the invalid triangle index for rays that do not
+ * hit a triangle. Only triangles that the rays exit through are considered
+ * (see TriangleBVH::fireRay).
+ */
+void TriangleBVH::fireRays( const size_t number_of_rays,
+                            const double positions[],
+                            const double directions[],
+                            double distances[],
+                            size_t triangles[] ) const
+{
+  std::vector<RayData> rays( number_of_rays );
+  std::vector<double> ray_origins[3], ray_inverse_directions[3];
+  std::vector<char> ray_child_hits( number_of_rays );
+
+  for( unsigned j = 0; j < 3; ++j )
+  {
+    ray_origins[j].resize( number_of_rays );
+    ray_inverse_directions[j].resize( number_of_rays );
+  }
+
+  for( size_t r = 0; r < number_of_rays; ++r )
+  {
+    this->initializeRayData( positions + 3*r, directions + 3*r, rays[r] );
+
+    for( unsigned j = 0; j < 3; ++j )
+    {
+      ray_origins[j][r] = rays[r].origin[j];
+      ray_inverse_directions[j][r] = rays[r].inverse_direction[j];
+    }
+
+    distances[r] = std::numeric_limits<double>::infinity();
+    triangles[r] = invalid_triangle;
+  }
+
+  if( number_of_rays == 0 )
+    return;
+
+  uint32_t stack[s_max_stack_depth];
+  unsigned stack_size = 0;
+
+  stack[stack_size++] = 0;
+
+  while( stack_size > 0 )
+  {
+    const Node& node = d_nodes[stack[--stack_size]];
+
+    for( unsigned c = 0; c < node_width; ++c )
+    {
+      if( node.empty[c] )
+        continue;
+
+      const double lower_x = node.lower[0][c], upper_x = node.upper[0][c];
+      const double lower_y = node.lower[1][c], upper_y = node.upper[1][c];
+      const double lower_z = node.lower[2][c], upper_z = node.upper[2][c];
+
+      const double* origin_x = ray_origins[0].data();
+      const double* origin_y = ray_origins[1].data();
+      const double* origin_z = ray_origins[2].data();
+      const double* inverse_x = ray_inverse_directions[0].data();
+      const double* inverse_y = ray_inverse_directions[1].data();
+      const double* inverse_z = ray_inverse_directions[2].data();
+      char* child_hits = ray_child_hits.data();
+
+      int any_hit = 0;
+
+      // Test the child bounding box against every ray in the packet
+      #pragma omp simd reduction(|:any_hit)
+      for( size_t r = 0; r < number_of_rays; ++r )
+      {
+        const double tx_0 = (lower_x - origin_x[r])*inverse_x[r];
+        const double tx_1 = (upper_x - origin_x[r])*inverse_x[r];
+        const double ty_0 = (lower_y - origin_y[r])*inverse_y[r];
+        const double ty_1 = (upper_y - origin_y[r])*inverse_y[r];
+        const double tz_0 = (lower_z - origin_z[r])*inverse_z[r];
+        const double tz_1 = (upper_z - origin_z[r])*inverse_z[r];
+
+        const double t_min =
+          std::max( std::max( std::min( tx_0, tx_1 ), std::min( ty_0, ty_1 ) ),
+                    std::max( std::min( tz_0, tz_1 ), 0.0 ) );
+        const double t_max =
+          std::min( std::min( std::max( tx_0, tx_1 ), std::max( ty_0, ty_1 ) ),
+                    std::min( std::max( tz_0, tz_1 ), distances[r] ) );
+
+        child_hits[r] = (t_min <= t_max);
+
+        any_hit |= child_hits[r];
+      }
+
+      if( !any_hit )
+        continue;
+
+      // Leaf child: intersect the triangles with the rays that hit the box
+      if( node.count[c] > 0 )
+      {
+        for( size_t r = 0; r < number_of_rays; ++r )
+        {
+          if( child_hits[r] )
+          {
+            bool exiting;
+
+            this->intersectLeaf( rays[r],
+                                 node.offset[c],
+                                 node.count[c],
+                                 true,
+                                 distances[r],
+                                 triangles[r],
+                                 exiting );
+          }
+        }
+      }
+      // Internal child
+      else
+      {
+        testInvariant( stack_size < s_max_stack_depth );
+
+        stack[stack_size++] = node.offset[c];
+      }
+    }
+  }
+}
+
+// Return the location of a point w.r.t. the bounded volume
+/*! \details A ray is fired from the point in the requested direction and the
+ * orientation of the closest triangle hit is used to determine if the point
+ * is inside of the volume (ray exits through the triangle) or outside of the
+ * volume (ray enters through the triangle or no triangle is hit). If the
+ * point is within the boundary tolerance of the closest triangle the ray
+ * direction decides the location: a ray that is leaving the volume is
+ * outside of it and a ray that is entering the volume is inside of it.
+ * Point on cell will therefore never be returned.
+ */
+PointLocation TriangleBVH::getPointLocation( const double position[3],
+                                             const double direction[3],
+                                             const double boundary_tol ) const
+{
+  RayData ray;
+
+  this->initializeRayData( position, direction, ray );
+
+  double distance;
+  size_t triangle;
+  bool exiting;
+
+  if( !this->findClosestHit( ray, false, distance, triangle, exiting ) )
+    return POINT_OUTSIDE_CELL;
+
+  if( distance < boundary_tol )
+    return (exiting ? POINT_OUTSIDE_CELL : POINT_INSIDE_CELL);
+  else
+    return (exiting ? POINT_INSIDE_CELL : POINT_OUTSIDE_CELL);
+}
+
+// Return the distance to the closest triangle in any direction
+/*! \details If there are no triangles infinity will be returned.
+ */
+double TriangleBVH::getDistanceToClosestBoundary(
+                                             const double position[3] ) const
+{
+  double min_squared_distance = std::numeric_limits<double>::infinity();
+
+  uint32_t stack[s_max_stack_depth];
+  unsigned stack_size = 0;
+
+  stack[stack_size++] = 0;
+
+  while( stack_size > 0 )
+  {
+    const Node& node = d_nodes[stack[--stack_size]];
+
+    // Calculate the squared distance to each child bounding box
+    double child_squared_distances[node_width];
+
+    #pragma omp simd
+    for( unsigned c = 0; c < node_width; ++c )
+    {
+      const double dx = std::max( std::max( node.lower[0][c] - position[0],
+                                            position[0] - node.upper[0][c] ),
+                                  0.0 );
+      const double dy = std::max( std::max( node.lower[1][c] - position[1],
+                                            position[1] - node.upper[1][c] ),
+                                  0.0 );
+      const double dz = std::max( std::max( node.lower[2][c] - position[2],
+                                            position[2] - node.upper[2][c] ),
+                                  0.0 );
+
+      child_squared_distances[c] = dx*dx + dy*dy + dz*dz;
+    }
+
+    for( unsigned c = 0; c < node_width; ++c )
+    {
+      if( node.empty[c] ||
+          child_squared_distances[c] >= min_squared_distance )
+        continue;
+
+      // Leaf child
+      if( node.count[c] > 0 )
+      {
+        for( uint32_t i = 0; i < node.count[c]; ++i )
+        {
+          min_squared_distance =
+            std::min( min_squared_distance,
+                      this->getSquaredDistanceToTriangle( position,
+                                                          node.offset[c]+i ) );
+        }
+      }
+      // Internal child
+      else
+      {
+        testInvariant( stack_size < s_max_stack_depth );
+
+        stack[stack_size++] = node.offset[c];
+      }
+    }
+  }
+
+  return std::sqrt( min_squared_distance );
+}
+
+// Initialize the ray data
+/*! \details Zero direction components are replaced by a tiny value so that
+ * the inverse direction is finite, which keeps the ray-box tests free of
+ * NaNs.
+ */
+void TriangleBVH::initializeRayData( const double position[3],
+                                     const double direction[3],
+                                     RayData& ray )
+{
+  for( unsigned j = 0; j < 3; ++j )
+  {
+    ray.origin[j] = position[j];
+    ray.direction[j] = direction[j];
+
+    if( std::fabs( direction[j] ) > 1e-300 )
+      ray.inverse_direction[j] = 1.0/direction[j];
+    else
+      ray.inverse_direction[j] = std::copysign( 1e300, direction[j] );
+  }
+}
+
+// Find the closest triangle hit by a ray
+/*! \details The children of each node are visited from nearest to farthest
+ * so that the closest hit distance shrinks as quickly as possible.
+ */
+bool TriangleBVH::findClosestHit( const RayData& ray,
+                                  const bool exiting_hits_only,
+                                  double& distance,
+                                  size_t& triangle,
+                                  bool& exiting ) const
+{
+  distance = std::numeric_limits<double>::infinity();
+  triangle = invalid_triangle;
+  exiting = false;
+
+  uint32_t stack[s_max_stack_depth];
+  unsigned stack_size = 0;
+
+  stack[stack_size++] = 0;
+
+  while( stack_size > 0 )
+  {
+    const Node& node = d_nodes[stack[--stack_size]];
+
+    // Test the four child bounding boxes
+    double child_t_min[node_width];
+    int child_hits[node_width];
+
+    #pragma omp simd
+    for( unsigned c = 0; c < node_width; ++c )
+    {
+      const double tx_0 = (node.lower[0][c] - ray.origin[0])*ray.inverse_direction[0];
+      const double tx_1 = (node.upper[0][c] - ray.origin[0])*ray.inverse_direction[0];
+      const double ty_0 = (node.lower[1][c] - ray.origin[1])*ray.inverse_direction[1];
+      const double ty_1 = (node.upper[1][c] - ray.origin[1])*ray.inverse_direction[1];
+      const double tz_0 = (node.lower[2][c] - ray.origin[2])*ray.inverse_direction[2];
+      const double tz_1 = (node.upper[2][c] - ray.origin[2])*ray.inverse_direction[2];
+
+      const double t_min =
+        std::max( std::max( std::min( tx_0, tx_1 ), std::min( ty_0, ty_1 ) ),
+                  std::max( std::min( tz_0, tz_1 ), 0.0 ) );
+      const double t_max =
+        std::min( std::min( std::max( tx_0, tx_1 ), std::max( ty_0, ty_1 ) ),
+                  std::min( std::max( tz_0, tz_1 ), distance ) );
+
+      child_t_min[c] = t_min;
+      child_hits[c] = (!node.empty[c] && t_min <= t_max);
+    }
+
+    // Order the children that were hit from nearest to farthest
+    unsigned ordered_children[node_width];
+    unsigned number_of_hits = 0;
+
+    for( unsigned c = 0; c < node_width; ++c )
+    {
+      if( child_hits[c] )
+      {
+        unsigned i = number_of_hits++;
+
+        while( i > 0 && child_t_min[ordered_children[i-1]] > child_t_min[c] )
+        {
+          ordered_children[i] = ordered_children[i-1];
+          --i;
+        }
+
+        ordered_children[i] = c;
+      }
+    }
+
+    // Intersect the leaf children (nearest first)
+    for( unsigned i = 0; i < number_of_hits; ++i )
+    {
+      const unsigned c = ordered_children[i];
+
+      if( node.count[c] > 0 && child_t_min[c] <= distance )
+      {
+        this->intersectLeaf( ray,
+                             node.offset[c],
+                             node.count[c],
+                             exiting_hits_only,
+                             distance,
+                             triangle,
+                             exiting );
+      }
+    }
+
+    // Push the internal children (farthest first so that the nearest child
+    // is visited next)
+    for( unsigned i = number_of_hits; i > 0; --i )
+    {
+      const unsigned c = ordered_children[i-1];
+
+      if( node.count[c] == 0 && child_t_min[c] <= distance )
+      {
+        testInvariant( stack_size < s_max_stack_depth );
+
+        stack[stack_size++] = node.offset[c];
+      }
+    }
+  }
+
+  return triangle != invalid_triangle;
+}
+
+// Intersect a ray with the triangles of a leaf
+/*! \details The Moller-Trumbore ray-triangle test is done for every triangle
+ * in the leaf with a single SIMD loop. The closest hit data will only be
+ * updated if a triangle is hit before the current closest hit distance.
+ */
+void TriangleBVH::intersectLeaf( const RayData& ray,
+                                 const uint32_t first_triangle,
+                                 const uint32_t number_of_triangles,
+                                 const bool exiting_hits_only,
+                                 double& distance,
+                                 size_t& triangle,
+                                 bool& exiting ) const
+{
+  // Make sure that the leaf is valid
+  testPrecondition( number_of_triangles <= max_leaf_size );
+
+  const double* v0_x = d_vertex_0[0].data() + first_triangle;
+  const double* v0_y = d_vertex_0[1].data() + first_triangle;
+  const double* v0_z = d_vertex_0[2].data() + first_triangle;
+  const double* e1_x = d_edge_1[0].data() + first_triangle;
+  const double* e1_y = d_edge_1[1].data() + first_triangle;
+  const double* e1_z = d_edge_1[2].data() + first_triangle;
+  const double* e2_x = d_edge_2[0].data() + first_triangle;
+  const double* e2_y = d_edge_2[1].data() + first_triangle;
+  const double* e2_z = d_edge_2[2].data() + first_triangle;
+
+  const double d_x = ray.direction[0];
+  const double d_y = ray.direction[1];
+  const double d_z = ray.direction[2];
+
+  double hit_distances[max_leaf_size];
+  int hit_valid[max_leaf_size];
+  int hit_exiting[max_leaf_size];
+
+  #pragma omp simd
+  for( uint32_t k = 0; k < number_of_triangles; ++k )
+  {
+    const double p_x = d_y*e2_z[k] - d_z*e2_y[k];
+    const double p_y = d_z*e2_x[k] - d_x*e2_z[k];
+    const double p_z = d_x*e2_y[k] - d_y*e2_x[k];
+
+    // det = -direction.normal
+    const double det = e1_x[k]*p_x + e1_y[k]*p_y + e1_z[k]*p_z;
+    const double inverse_det = 1.0/det;
+
+    const double s_x = ray.origin[0] - v0_x[k];
+    const double s_y = ray.origin[1] - v0_y[k];
+    const double s_z = ray.origin[2] - v0_z[k];
+
+    const double u = (s_x*p_x + s_y*p_y + s_z*p_z)*inverse_det;
+
+    const double q_x = s_y*e1_z[k] - s_z*e1_y[k];
+    const double q_y = s_z*e1_x[k] - s_x*e1_z[k];
+    const double q_z = s_x*e1_y[k] - s_y*e1_x[k];
+
+    const double v = (d_x*q_x + d_y*q_y + d_z*q_z)*inverse_det;
+    const double t = (e2_x[k]*q_x + e2_y[k]*q_y + e2_z[k]*q_z)*inverse_det;
+
+    hit_distances[k] = t;
+    hit_exiting[k] = (det < 0.0);
+    hit_valid[k] = (det != 0.0 && u >= 0.0 && v >= 0.0 && u + v <= 1.0 &&
+                    t >= 0.0 && (det < 0.0 || !exiting_hits_only));
+  }
+
+  for( uint32_t k = 0; k < number_of_triangles; ++k )
+  {
+    if( hit_valid[k] && hit_distances[k] < distance )
+    {
+      distance = hit_distances[k];
+      triangle = first_triangle + k;
+      exiting = hit_exiting[k];
+    }
+  }
+}
+
+// Return the squared distance from a point to a triangle
+/*! \details The closest point on the triangle is found by determining the
+ * Voronoi region of the triangle that contains the point.
+ */
+double TriangleBVH::getSquaredDistanceToTriangle( const double position[3],
+                                                  const size_t triangle ) const
+{
+  const double a[3] = {d_vertex_0[0][triangle],
+                       d_vertex_0[1][triangle],
+                       d_vertex_0[2][triangle]};
+  const double ab[3] = {d_edge_1[0][triangle],
+                        d_edge_1[1][triangle],
+                        d_edge_1[2][triangle]};
+  const double ac[3] = {d_edge_2[0][triangle],
+                        d_edge_2[1][triangle],
+                        d_edge_2[2][triangle]};
+
+  const double ap[3] = {position[0] - a[0],
+                        position[1] - a[1],
+                        position[2] - a[2]};
+
+  double closest_point[3];
+
+  const double d1 = ab[0]*ap[0] + ab[1]*ap[1] + ab[2]*ap[2];
+  const double d2 = ac[0]*ap[0] + ac[1]*ap[1] + ac[2]*ap[2];
+
+  const double bp[3] = {ap[0] - ab[0], ap[1] - ab[1], ap[2] - ab[2]};
+
+  const double d3 = ab[0]*bp[0] + ab[1]*bp[1] + ab[2]*bp[2];
+  const double d4 = ac[0]*bp[0] + ac[1]*bp[1] + ac[2]*bp[2];
+
+  const double cp[3] = {ap[0] - ac[0], ap[1] - ac[1], ap[2] - ac[2]};
+
+  const double d5 = ab[0]*cp[0] + ab[1]*cp[1] + ab[2]*cp[2];
+  const double d6 = ac[0]*cp[0] + ac[1]*cp[1] + ac[2]*cp[2];
+
+  const double vc = d1*d4 - d3*d2;
+  const double vb = d5*d2 - d1*d6;
+  const double va = d3*d6 - d5*d4;
+
+  // Vertex region a
+  if( d1 <= 0.0 && d2 <= 0.0 )
+  {
+    for( unsigned j = 0; j < 3; ++j )
+      closest_point[j] = a[j];
+  }
+  // Vertex region b
+  else if( d3 >= 0.0 && d4 <= d3 )
+  {
+    for( unsigned j = 0; j < 3; ++j )
+      closest_point[j] = a[j] + ab[j];
+  }
+  // Edge region ab
+  else if( vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0 )
+  {
+    const double v = d1/(d1 - d3);
+
+    for( unsigned j = 0; j < 3; ++j )
+      closest_point[j] = a[j] + v*ab[j];
+  }
+  // Vertex region c
+  else if( d6 >= 0.0 && d5 <= d6 )
+  {
+    for( unsigned j = 0; j < 3; ++j )
+      closest_point[j] = a[j] + ac[j];
+  }
+  // Edge region ac
+  else if( vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0 )
+  {
+    const double w = d2/(d2 - d6);
+
+    for( unsigned j = 0; j < 3; ++j )
+      closest_point[j] = a[j] + w*ac[j];
+  }
+  // Edge region bc
+  else if( va <= 0.0 && d4 - d3 >= 0.0 && d5 - d6 >= 0.0 )
+  {
+    const double w = (d4 - d3)/((d4 - d3) + (d5 - d6));
+
+    for( unsigned j = 0; j < 3; ++j )
+      closest_point[j] = a[j] + ab[j] + w*(ac[j] - ab[j]);
+  }
+  // Face region
+  else
+  {
+    const double denom = 1.0/(va + vb + vc);
+    const double v = vb*denom;
+    const double w = vc*denom;
+
+    for( unsigned j = 0; j < 3; ++j )
+      closest_point[j] = a[j] + v*ab[j] + w*ac[j];
+  }
+
+  const double dx = position[0] - closest_point[0];
+  const double dy = position[1] - closest_point[1];
+  const double dz = position[2] - closest_point[2];
+
+  return dx*dx + dy*dy + dz*dz;
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_TriangleBVH.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,191 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_TriangleBVH.hpp
+//! \author Alex Robinson
+//! \brief  Triangle bounding volume hierarchy class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_TRIANGLE_BVH_HPP
+#define GEOMETRY_TRIANGLE_BVH_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/align/aligned_allocator.hpp>
+
+// FRENSIE Includes
+#include "Geometry_PointLocation.hpp"
+
+namespace Geometry{
+
+/*! The triangle bounding volume hierarchy (BVH) class
+ *
+ * The hierarchy is built over the triangles (facets) that bound a single
+ * volume. The triangle vertices must be ordered so that the triangle normals
+ * (e1 x e2) point out of the volume. Each node of the hierarchy stores the
+ * bounding boxes of its four children in a structure-of-arrays layout so
+ * that the four ray-box tests can be done with a single SIMD loop. The
+ * hierarchy is flattened into a contiguous node array. The triangles are
+ * stored in a structure-of-arrays layout as well (first vertex and two edge
+ * vectors) so that the ray-triangle tests of a leaf can also be vectorized.
+ * Each triangle has a tag (e.g. the handle of the surface that the
+ * triangle belongs to). The hierarchy is immutable once constructed so it
+ * can be queried by multiple threads concurrently.
+ */
+class TriangleBVH
+{
+
+public:
+
+  //! The triangle tag type
+  typedef uint64_t TriangleTag;
+
+  //! The number of children of each node
+  static const unsigned node_width = 4;
+
+  //! The max number of triangles in a leaf
+  static const unsigned max_leaf_size = 16;
+
+  //! The invalid triangle index
+  static const size_t invalid_triangle;
+
+  //! Constructor
+  TriangleBVH( const std::vector<double>& triangle_vertices,
+               const std::vector<TriangleTag>& triangle_tags,
+               const unsigned leaf_size = 4 );
+
+  //! Destructor
+  ~TriangleBVH()
+  { /* ... */ }
+
+  //! Return the number of triangles
+  size_t getNumberOfTriangles() const;
+
+  //! Return the number of nodes
+  size_t getNumberOfNodes() const;
+
+  //! Return the tag of a triangle
+  TriangleTag getTriangleTag( const size_t triangle ) const;
+
+  //! Return the (outward) unit normal of a triangle
+  void getTriangleNormal( const size_t triangle, double normal[3] ) const;
+
+  //! Fire a ray and find the closest triangle that the ray exits through
+  bool fireRay( const double position[3],
+                const double direction[3],
+                double& distance,
+                size_t& triangle ) const;
+
+  //! Fire a packet of rays
+  void fireRays( const size_t number_of_rays,
+                 const double positions[],
+                 const double directions[],
+                 double distances[],
+                 size_t triangles[] ) const;
+
+  //! Return the location of a point w.r.t. the bounded volume
+  PointLocation getPointLocation( const double position[3],
+                                  const double direction[3],
+                                  const double boundary_tol ) const;
+
+  //! Return the distance to the closest triangle in any direction
+  double getDistanceToClosestBoundary( const double position[3] ) const;
+
+private:
+
+  // The hierarchy node (the bounding boxes of the four children are stored
+  // in a structure-of-arrays layout)
+  struct alignas(64) Node
+  {
+    // The lower bounds of the child bounding boxes
+    double lower[3][node_width];
+
+    // The upper bounds of the child bounding boxes
+    double upper[3][node_width];
+
+    // The child node index (internal child) or first triangle index (leaf)
+    uint32_t offset[node_width];
+
+    // The number of triangles in the child (0 for internal and empty
+    // children)
+    uint32_t count[node_width];
+
+    // Records if the child is an empty slot
+    bool empty[node_width];
+  };
+
+  // The ray data used during traversal
+  struct RayData
+  {
+    // The ray origin
+    double origin[3];
+
+    // The ray direction
+    double direction[3];
+
+    // The inverse ray direction
+    double inverse_direction[3];
+  };
+
+  // Build a node of the hierarchy
+  uint32_t buildNode( std::vector<uint32_t>& triangle_indices,
+                      const std::vector<double>& centroids,
+                      const std::vector<double>& lower_bounds,
+                      const std::vector<double>& upper_bounds,
+                      const uint32_t begin,
+                      const uint32_t end );
+
+  // Initialize the ray data
+  static void initializeRayData( const double position[3],
+                                 const double direction[3],
+                                 RayData& ray );
+
+  // Find the closest triangle hit by a ray
+  bool findClosestHit( const RayData& ray,
+                       const bool exiting_hits_only,
+                       double& distance,
+                       size_t& triangle,
+                       bool& exiting ) const;
+
+  // Intersect a ray with the triangles of a leaf
+  void intersectLeaf( const RayData& ray,
+                      const uint32_t first_triangle,
+                      const uint32_t number_of_triangles,
+                      const bool exiting_hits_only,
+                      double& distance,
+                      size_t& triangle,
+                      bool& exiting ) const;
+
+  // Return the squared distance from a point to a triangle
+  double getSquaredDistanceToTriangle( const double position[3],
+                                       const size_t triangle ) const;
+
+  // The leaf size
+  unsigned d_leaf_size;
+
+  // The nodes (the root node is the first node)
+  std::vector<Node,boost::alignment::aligned_allocator<Node,64> > d_nodes;
+
+  // The first vertex of each triangle
+  std::vector<double> d_vertex_0[3];
+
+  // The first edge (v1-v0) of each triangle
+  std::vector<double> d_edge_1[3];
+
+  // The second edge (v2-v0) of each triangle
+  std::vector<double> d_edge_2[3];
+
+  // The triangle tags
+  std::vector<TriangleTag> d_triangle_tags;
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_TRIANGLE_BVH_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_TriangleBVH.hpp
+//---------------------------------------------------------------------------//
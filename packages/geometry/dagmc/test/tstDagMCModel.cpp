@@ -957,6 +957,42 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DagMCModel, archive, TestArchives )
   FRENSIE_CHECK_NO_THROW( navigator = base_model->createNavigator() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a packet of rays can be fired
+FRENSIE_UNIT_TEST( DagMCModel, fireRays )
+{
+  Geometry::DagMCModelProperties bvh_model_properties( *model_properties );
+  bvh_model_properties.useNativeBVHRayTracing();
+
+  std::shared_ptr<Geometry::DagMCModel>
+    moab_model( new Geometry::DagMCModel( *model_properties ) );
+
+  std::shared_ptr<Geometry::DagMCModel>
+    bvh_model( new Geometry::DagMCModel( bvh_model_properties ) );
+
+  const double positions[6] = {-40.0, -40.0, 59.0,
+                               -40.0, -40.0, 59.96};
+  const double directions[6] = {0.0, 0.0, 1.0,
+                                0.0, 0.0, 1.0};
+
+  double distances[2];
+  Geometry::Model::EntityId surfaces_hit[2];
+
+  moab_model->fireRays( 53, 2, positions, directions, distances, surfaces_hit );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distances[0], 1.96, 1e-9 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distances[1], 1.0, 1e-9 );
+  FRENSIE_CHECK_EQUAL( surfaces_hit[0], 242 );
+  FRENSIE_CHECK_EQUAL( surfaces_hit[1], 242 );
+
+  bvh_model->fireRays( 53, 2, positions, directions, distances, surfaces_hit );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( distances[0], 1.96, 1e-9 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distances[1], 1.0, 1e-9 );
+  FRENSIE_CHECK_EQUAL( surfaces_hit[0], 242 );
+  FRENSIE_CHECK_EQUAL( surfaces_hit[1], 242 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
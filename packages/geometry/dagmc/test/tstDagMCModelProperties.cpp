@@ -30,6 +30,7 @@ FRENSIE_UNIT_TEST( DagMCModelProperties, default_properties )
   const Geometry::DagMCModelProperties default_properties( "dummy.h5m" );
 
   FRENSIE_CHECK( !default_properties.isFastIdLookupUsed() );
+  FRENSIE_CHECK( !default_properties.isNativeBVHRayTracingUsed() );
   FRENSIE_CHECK_EQUAL( default_properties.getTerminationCellPropertyName(),
                        "termination.cell" );
   FRENSIE_CHECK_EQUAL( default_properties.getReflectingSurfacePropertyName(),
@@ -98,6 +99,20 @@ FRENSIE_UNIT_TEST( DagMCModelProperties, setIdLookup )
   FRENSIE_CHECK( !properties.isFastIdLookupUsed() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the ray tracing type can be set
+FRENSIE_UNIT_TEST( DagMCModelProperties, setRayTracing )
+{
+  Geometry::DagMCModelProperties properties( "test.h5m" );
+  properties.useNativeBVHRayTracing();
+
+  FRENSIE_CHECK( properties.isNativeBVHRayTracingUsed() );
+
+  properties.useMOABRayTracing();
+
+  FRENSIE_CHECK( !properties.isNativeBVHRayTracingUsed() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the termination cell property name can be set
 FRENSIE_UNIT_TEST( DagMCModelProperties, setTerminationCellPropertyName )
@@ -453,6 +468,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DagMCModelProperties,
     createOArchive( archive_base_name, archive_ostream, oarchive );
 
     Geometry::DagMCModelProperties properties( "dummy.h5m" );
+    properties.useNativeBVHRayTracing();
     properties.setTerminationCellPropertyName( "graveyard" );
     properties.setReflectingSurfacePropertyName( "ref.surf" );
     properties.setMaterialPropertyName( "mat" );
@@ -487,6 +503,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DagMCModelProperties,
 
   FRENSIE_CHECK_EQUAL( properties.getModelFileName(), "dummy.h5m" );
   FRENSIE_CHECK( !properties.isFastIdLookupUsed() );
+  FRENSIE_CHECK( properties.isNativeBVHRayTracingUsed() );
   FRENSIE_CHECK_EQUAL( properties.getTerminationCellPropertyName(),
                        "graveyard" );
   FRENSIE_CHECK_EQUAL( properties.getReflectingSurfacePropertyName(),
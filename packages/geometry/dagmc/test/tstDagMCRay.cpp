@@ -210,6 +210,50 @@ FRENSIE_UNIT_TEST( DagMCRay, advanceSubstep )
   FRENSIE_CHECK_EQUAL( ray.getCurrentCell(), 1 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the closest boundary data can be set
+FRENSIE_UNIT_TEST( DagMCRay, setClosestBoundaryData )
+{
+  Geometry::Ray raw_ray( 1.0, 1.0, 1.0, 0.0, 0.0, 1.0 );
+
+  Geometry::DagMCRay ray( raw_ray, 1 );
+
+  FRENSIE_CHECK( !ray.knowsClosestBoundaryDistance() );
+
+  ray.setClosestBoundaryData( 2.0 );
+
+  FRENSIE_CHECK( ray.knowsClosestBoundaryDistance() );
+  FRENSIE_CHECK_EQUAL( ray.getClosestBoundaryDistance(), 2.0 );
+  FRENSIE_CHECK_EQUAL( ray.getClosestBoundaryDistanceLowerBound(), 2.0 );
+
+  // The lower bound only depends on the displacement from the query position
+  ray.setIntersectionSurfaceData( 10, 3.0 );
+  ray.advanceSubstep( 0.5 );
+
+  FRENSIE_CHECK_EQUAL( ray.getClosestBoundaryDistanceLowerBound(), 1.5 );
+
+  ray.changeDirection( 0.0, 0.0, -1.0 );
+
+  FRENSIE_CHECK( ray.knowsClosestBoundaryDistance() );
+
+  ray.setIntersectionSurfaceData( 10, 3.0 );
+  ray.advanceSubstep( 0.5 );
+
+  FRENSIE_CHECK_EQUAL( ray.getClosestBoundaryDistance(), 2.0 );
+  FRENSIE_CHECK_EQUAL( ray.getClosestBoundaryDistanceLowerBound(), 2.0 );
+
+  // The closest boundary data is reset when the cell changes
+  ray.advanceToIntersectionSurface( 2 );
+
+  FRENSIE_CHECK( !ray.knowsClosestBoundaryDistance() );
+
+  // The closest boundary data is reset when the ray is set
+  ray.setClosestBoundaryData( 1.0 );
+  ray.set( raw_ray, 1 );
+
+  FRENSIE_CHECK( !ray.knowsClosestBoundaryDistance() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstDagMCRay.cpp
 //---------------------------------------------------------------------------//
@@ -0,0 +1,297 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstTriangleBVH.cpp
+//! \author Alex Robinson
+//! \brief  Triangle bounding volume hierarchy unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_TriangleBVH.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+// The unit cube [0,1]^3 (two triangles per face, face index tags)
+std::unique_ptr<const Geometry::TriangleBVH> cube_bvh;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the unit cube triangles (outward normals)
+void createUnitCubeTriangles( std::vector<double>& triangle_vertices,
+                              std::vector<Geometry::TriangleBVH::TriangleTag>&
+                              triangle_tags )
+{
+  double corners[8][3];
+
+  for( unsigned i = 0; i < 8; ++i )
+  {
+    corners[i][0] = (i & 1);
+    corners[i][1] = ((i >> 1) & 1);
+    corners[i][2] = ((i >> 2) & 1);
+  }
+
+  // Face corners: -z, +z, -y, +y, -x, +x
+  const unsigned faces[6][4] = {{0,2,3,1},
+                                {4,5,7,6},
+                                {0,1,5,4},
+                                {2,6,7,3},
+                                {0,4,6,2},
+                                {1,3,7,5}};
+
+  for( unsigned f = 0; f < 6; ++f )
+  {
+    const unsigned triangles[2][3] = {{faces[f][0], faces[f][1], faces[f][2]},
+                                      {faces[f][0], faces[f][2], faces[f][3]}};
+
+    for( unsigned t = 0; t < 2; ++t )
+    {
+      for( unsigned v = 0; v < 3; ++v )
+      {
+        for( unsigned j = 0; j < 3; ++j )
+          triangle_vertices.push_back( corners[triangles[t][v]][j] );
+      }
+
+      triangle_tags.push_back( f );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the hierarchy can be constructed
+FRENSIE_UNIT_TEST( TriangleBVH, constructor )
+{
+  std::vector<double> triangle_vertices;
+  std::vector<Geometry::TriangleBVH::TriangleTag> triangle_tags;
+
+  createUnitCubeTriangles( triangle_vertices, triangle_tags );
+
+  std::unique_ptr<Geometry::TriangleBVH> bvh;
+
+  FRENSIE_CHECK_NO_THROW( bvh.reset( new Geometry::TriangleBVH( triangle_vertices, triangle_tags, 1 ) ) );
+  FRENSIE_CHECK_EQUAL( bvh->getNumberOfTriangles(), 12 );
+  FRENSIE_CHECK( bvh->getNumberOfNodes() > 1 );
+
+  FRENSIE_CHECK_NO_THROW( bvh.reset( new Geometry::TriangleBVH( triangle_vertices, triangle_tags, 16 ) ) );
+  FRENSIE_CHECK_EQUAL( bvh->getNumberOfTriangles(), 12 );
+  FRENSIE_CHECK_EQUAL( bvh->getNumberOfNodes(), 1 );
+
+  // Invalid leaf size
+  FRENSIE_CHECK_THROW( Geometry::TriangleBVH( triangle_vertices, triangle_tags, 0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Geometry::TriangleBVH( triangle_vertices, triangle_tags, 17 ),
+                       std::runtime_error );
+
+  // Inconsistent vertices and tags
+  triangle_tags.pop_back();
+
+  FRENSIE_CHECK_THROW( Geometry::TriangleBVH( triangle_vertices, triangle_tags ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the triangle normals can be returned
+FRENSIE_UNIT_TEST( TriangleBVH, getTriangleNormal )
+{
+  const double face_normals[6][3] = {{0.0, 0.0, -1.0},
+                                     {0.0, 0.0, 1.0},
+                                     {0.0, -1.0, 0.0},
+                                     {0.0, 1.0, 0.0},
+                                     {-1.0, 0.0, 0.0},
+                                     {1.0, 0.0, 0.0}};
+
+  for( size_t i = 0; i < cube_bvh->getNumberOfTriangles(); ++i )
+  {
+    double normal[3];
+
+    cube_bvh->getTriangleNormal( i, normal );
+
+    const Geometry::TriangleBVH::TriangleTag face =
+      cube_bvh->getTriangleTag( i );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( normal[0], face_normals[face][0], 1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], face_normals[face][1], 1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( normal[2], face_normals[face][2], 1e-15 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a ray can be fired
+FRENSIE_UNIT_TEST( TriangleBVH, fireRay )
+{
+  double position[3] = {0.5, 0.25, 0.75};
+  double direction[3] = {1.0, 0.0, 0.0};
+  double distance;
+  size_t triangle;
+
+  FRENSIE_REQUIRE( cube_bvh->fireRay( position, direction, distance, triangle ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.5, 1e-15 );
+  FRENSIE_CHECK_EQUAL( cube_bvh->getTriangleTag( triangle ), 5 );
+
+  direction[0] = 0.0;
+  direction[2] = -1.0;
+
+  FRENSIE_REQUIRE( cube_bvh->fireRay( position, direction, distance, triangle ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 0.75, 1e-15 );
+  FRENSIE_CHECK_EQUAL( cube_bvh->getTriangleTag( triangle ), 0 );
+
+  // Only exiting triangles are hit: a ray entering the cube through the
+  // -x face exits through the +x face
+  position[0] = -1.0;
+  direction[0] = 1.0;
+  direction[2] = 0.0;
+
+  FRENSIE_REQUIRE( cube_bvh->fireRay( position, direction, distance, triangle ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 2.0, 1e-15 );
+  FRENSIE_CHECK_EQUAL( cube_bvh->getTriangleTag( triangle ), 5 );
+
+  // A ray on the -x face moving into the cube must not hit the -x face
+  position[0] = 0.0;
+
+  FRENSIE_REQUIRE( cube_bvh->fireRay( position, direction, distance, triangle ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distance, 1.0, 1e-15 );
+  FRENSIE_CHECK_EQUAL( cube_bvh->getTriangleTag( triangle ), 5 );
+
+  // A ray that misses the cube
+  position[0] = 2.0;
+
+  FRENSIE_CHECK( !cube_bvh->fireRay( position, direction, distance, triangle ) );
+  FRENSIE_CHECK_EQUAL( triangle, Geometry::TriangleBVH::invalid_triangle );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a packet of rays can be fired
+FRENSIE_UNIT_TEST( TriangleBVH, fireRays )
+{
+  const size_t number_of_rays = 64;
+
+  std::vector<double> positions( 3*number_of_rays );
+  std::vector<double> directions( 3*number_of_rays );
+
+  for( size_t i = 0; i < number_of_rays; ++i )
+  {
+    const double mu = -1.0 + (2.0*i + 1.0)/number_of_rays;
+    const double phi = 2.399963229728653*i;
+
+    positions[3*i] = 0.1 + 0.8*i/number_of_rays;
+    positions[3*i+1] = 0.9 - 0.8*i/number_of_rays;
+    positions[3*i+2] = 0.5;
+
+    directions[3*i] = std::sqrt( 1.0 - mu*mu )*std::cos( phi );
+    directions[3*i+1] = std::sqrt( 1.0 - mu*mu )*std::sin( phi );
+    directions[3*i+2] = mu;
+  }
+
+  std::vector<double> distances( number_of_rays );
+  std::vector<size_t> triangles( number_of_rays );
+
+  cube_bvh->fireRays( number_of_rays,
+                      positions.data(),
+                      directions.data(),
+                      distances.data(),
+                      triangles.data() );
+
+  for( size_t i = 0; i < number_of_rays; ++i )
+  {
+    double distance;
+    size_t triangle;
+
+    FRENSIE_REQUIRE( cube_bvh->fireRay( &positions[3*i],
+                                        &directions[3*i],
+                                        distance,
+                                        triangle ) );
+
+    FRENSIE_CHECK_EQUAL( distances[i], distance );
+    FRENSIE_CHECK_EQUAL( triangles[i], triangle );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the location of a point can be returned
+FRENSIE_UNIT_TEST( TriangleBVH, getPointLocation )
+{
+  double position[3] = {0.5, 0.5, 0.5};
+  double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( cube_bvh->getPointLocation( position, direction, 1e-5 ),
+                       Geometry::POINT_INSIDE_CELL );
+
+  position[0] = -0.5;
+
+  FRENSIE_CHECK_EQUAL( cube_bvh->getPointLocation( position, direction, 1e-5 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+
+  position[0] = 1.5;
+
+  FRENSIE_CHECK_EQUAL( cube_bvh->getPointLocation( position, direction, 1e-5 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+
+  // The direction is used on the boundary
+  position[0] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( cube_bvh->getPointLocation( position, direction, 1e-5 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+
+  direction[0] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( cube_bvh->getPointLocation( position, direction, 1e-5 ),
+                       Geometry::POINT_INSIDE_CELL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the closest boundary can be returned
+FRENSIE_UNIT_TEST( TriangleBVH, getDistanceToClosestBoundary )
+{
+  double position[3] = {0.5, 0.5, 0.5};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cube_bvh->getDistanceToClosestBoundary( position ),
+                                   0.5,
+                                   1e-15 );
+
+  position[0] = 0.9;
+  position[2] = 0.2;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cube_bvh->getDistanceToClosestBoundary( position ),
+                                   0.1,
+                                   1e-12 );
+
+  position[0] = 2.0;
+  position[1] = 2.0;
+  position[2] = 2.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cube_bvh->getDistanceToClosestBoundary( position ),
+                                   std::sqrt( 3.0 ),
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> triangle_vertices;
+  std::vector<Geometry::TriangleBVH::TriangleTag> triangle_tags;
+
+  createUnitCubeTriangles( triangle_vertices, triangle_tags );
+
+  cube_bvh.reset( new Geometry::TriangleBVH( triangle_vertices,
+                                             triangle_tags,
+                                             1 ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstTriangleBVH.cpp
+//---------------------------------------------------------------------------//
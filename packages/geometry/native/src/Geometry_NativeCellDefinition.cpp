@@ -0,0 +1,316 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeCellDefinition.cpp
+//! \author Alex Robinson
+//! \brief  Native cell definition class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+// FRENSIE Includes
+#include "Geometry_NativeCellDefinition.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Default constructor (empty definition)
+NativeCellDefinition::NativeCellDefinition()
+  : d_definition(),
+    d_surface_ids(),
+    d_program(),
+    d_simple( true ),
+    d_simple_senses()
+{ /* ... */ }
+
+// Constructor
+NativeCellDefinition::NativeCellDefinition( const std::string& definition )
+  : d_definition( definition ),
+    d_surface_ids(),
+    d_program(),
+    d_simple( true ),
+    d_simple_senses()
+{
+  this->compile();
+}
+
+// Return the definition string
+const std::string& NativeCellDefinition::getDefinition() const
+{
+  return d_definition;
+}
+
+// Return the unique surface ids that appear in the definition
+/*! \details The surface ids are stored in the order that they first appear
+ * in the definition. The surface senses array that is passed to the
+ * evaluate method must use the same ordering.
+ */
+auto NativeCellDefinition::getSurfaceIds() const -> const std::vector<EntityId>&
+{
+  return d_surface_ids;
+}
+
+// Check if the definition only contains intersections
+bool NativeCellDefinition::isSimple() const
+{
+  return d_simple;
+}
+
+// Return the required sense of each surface (simple definitions only)
+const std::vector<int>& NativeCellDefinition::getSimpleDefinitionSenses() const
+{
+  // Make sure that the definition is simple
+  testPrecondition( d_simple );
+
+  return d_simple_senses;
+}
+
+// Evaluate the definition
+/*! \details The surface senses array must store the sense of each surface
+ * returned by the getSurfaceIds method (in the same order).
+ */
+bool NativeCellDefinition::evaluate( const int surface_senses[] ) const
+{
+  if( d_program.empty() )
+    return false;
+
+  if( d_simple )
+  {
+    for( size_t i = 0; i < d_simple_senses.size(); ++i )
+    {
+      if( surface_senses[i] != d_simple_senses[i] )
+        return false;
+    }
+
+    return true;
+  }
+
+  bool stack[s_max_stack_depth];
+  unsigned stack_size = 0;
+
+  for( size_t i = 0; i < d_program.size(); ++i )
+  {
+    const Token& token = d_program[i];
+
+    switch( token.type )
+    {
+    case HALF_SPACE_TOKEN:
+      stack[stack_size++] = (surface_senses[token.surface] == token.sense);
+      break;
+
+    case INTERSECTION_TOKEN:
+      --stack_size;
+      stack[stack_size-1] = stack[stack_size-1] && stack[stack_size];
+      break;
+
+    case UNION_TOKEN:
+      --stack_size;
+      stack[stack_size-1] = stack[stack_size-1] || stack[stack_size];
+      break;
+    }
+  }
+
+  // Make sure that the program was valid
+  testPostcondition( stack_size == 1 );
+
+  return stack[0];
+}
+
+// Compile the definition
+/*! \details The definition is converted to a postfix program using the
+ * shunting-yard algorithm. The intersection and union operators have equal
+ * precedence and are left associative.
+ */
+void NativeCellDefinition::compile()
+{
+  // Split the definition into tokens
+  std::string spaced_definition;
+
+  for( size_t i = 0; i < d_definition.size(); ++i )
+  {
+    const char c = d_definition[i];
+
+    if( c == '(' || c == ')' )
+    {
+      spaced_definition += ' ';
+      spaced_definition += c;
+      spaced_definition += ' ';
+    }
+    else
+      spaced_definition += c;
+  }
+
+  std::istringstream iss( spaced_definition );
+  std::string token_string;
+
+  std::vector<char> operator_stack;
+  bool previous_was_operand = false;
+  unsigned stack_depth = 0, max_stack_depth = 0;
+
+  // Add an operator to the program
+  auto add_operator = [this, &stack_depth]( const char op ){
+    Token token;
+    token.type = (op == 'n' ? INTERSECTION_TOKEN : UNION_TOKEN);
+    token.surface = 0;
+    token.sense = 0;
+
+    if( op == 'u' )
+      d_simple = false;
+
+    TEST_FOR_EXCEPTION( stack_depth < 2,
+                        std::runtime_error,
+                        "The cell definition (" << d_definition <<
+                        ") is invalid!" );
+
+    d_program.push_back( token );
+    --stack_depth;
+  };
+
+  // Add an operator to the operator stack (equal precedence, left assoc.)
+  auto push_operator = [&operator_stack, &add_operator]( const char op ){
+    while( !operator_stack.empty() && operator_stack.back() != '(' )
+    {
+      add_operator( operator_stack.back() );
+      operator_stack.pop_back();
+    }
+
+    operator_stack.push_back( op );
+  };
+
+  while( iss >> token_string )
+  {
+    if( token_string == "n" || token_string == "u" )
+    {
+      TEST_FOR_EXCEPTION( !previous_was_operand,
+                          std::runtime_error,
+                          "The cell definition (" << d_definition <<
+                          ") is invalid - operator " << token_string <<
+                          " must follow a surface or a closing "
+                          "parenthesis!" );
+
+      push_operator( token_string[0] );
+
+      previous_was_operand = false;
+    }
+    else if( token_string == "(" )
+    {
+      // Implicit intersection
+      if( previous_was_operand )
+        push_operator( 'n' );
+
+      operator_stack.push_back( '(' );
+
+      previous_was_operand = false;
+    }
+    else if( token_string == ")" )
+    {
+      TEST_FOR_EXCEPTION( !previous_was_operand,
+                          std::runtime_error,
+                          "The cell definition (" << d_definition <<
+                          ") is invalid - empty or incomplete "
+                          "parenthetical expression!" );
+
+      while( !operator_stack.empty() && operator_stack.back() != '(' )
+      {
+        add_operator( operator_stack.back() );
+        operator_stack.pop_back();
+      }
+
+      TEST_FOR_EXCEPTION( operator_stack.empty(),
+                          std::runtime_error,
+                          "The cell definition (" << d_definition <<
+                          ") is invalid - unbalanced parentheses!" );
+
+      operator_stack.pop_back();
+
+      previous_was_operand = true;
+    }
+    else
+    {
+      // Half-space
+      char* end;
+      const long long signed_id = std::strtoll( token_string.c_str(), &end, 10 );
+
+      TEST_FOR_EXCEPTION( *end != '\0' || signed_id == 0,
+                          std::runtime_error,
+                          "The cell definition (" << d_definition <<
+                          ") is invalid - unknown token " << token_string <<
+                          "!" );
+
+      // Implicit intersection
+      if( previous_was_operand )
+        push_operator( 'n' );
+
+      const EntityId surface_id =
+        (signed_id < 0 ? -signed_id : signed_id);
+
+      std::vector<EntityId>::const_iterator surface_id_it =
+        std::find( d_surface_ids.begin(), d_surface_ids.end(), surface_id );
+
+      Token token;
+      token.type = HALF_SPACE_TOKEN;
+      token.sense = (signed_id < 0 ? -1 : 1);
+
+      if( surface_id_it == d_surface_ids.end() )
+      {
+        token.surface = d_surface_ids.size();
+
+        d_surface_ids.push_back( surface_id );
+        d_simple_senses.push_back( token.sense );
+      }
+      else
+      {
+        token.surface = surface_id_it - d_surface_ids.begin();
+
+        // A surface that appears with both senses requires the full program
+        if( d_simple_senses[token.surface] != token.sense )
+          d_simple = false;
+      }
+
+      d_program.push_back( token );
+
+      ++stack_depth;
+
+      max_stack_depth = std::max( max_stack_depth, stack_depth );
+
+      previous_was_operand = true;
+    }
+  }
+
+  TEST_FOR_EXCEPTION( !previous_was_operand,
+                      std::runtime_error,
+                      "The cell definition (" << d_definition <<
+                      ") is invalid - it must end with a surface or a "
+                      "closing parenthesis!" );
+
+  while( !operator_stack.empty() )
+  {
+    TEST_FOR_EXCEPTION( operator_stack.back() == '(',
+                        std::runtime_error,
+                        "The cell definition (" << d_definition <<
+                        ") is invalid - unbalanced parentheses!" );
+
+    add_operator( operator_stack.back() );
+    operator_stack.pop_back();
+  }
+
+  TEST_FOR_EXCEPTION( max_stack_depth > s_max_stack_depth,
+                      std::runtime_error,
+                      "The cell definition (" << d_definition <<
+                      ") is too deeply nested (max evaluation stack depth "
+                      "is " << s_max_stack_depth << ")!" );
+
+  // Make sure that the program is valid
+  testPostcondition( stack_depth == 1 );
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeCellDefinition.cpp
+//---------------------------------------------------------------------------//
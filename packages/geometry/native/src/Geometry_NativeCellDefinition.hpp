@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeCellDefinition.hpp
+//! \author Alex Robinson
+//! \brief  Native cell definition class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_CELL_DEFINITION_HPP
+#define GEOMETRY_NATIVE_CELL_DEFINITION_HPP
+
+// Std Lib Includes
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// FRENSIE Includes
+#include "Geometry_Navigator.hpp"
+
+namespace Geometry{
+
+/*! The native cell definition class
+ *
+ * A cell is defined by a logical combination of surface half-spaces (the
+ * same format that is used by the legacy Geometry::BooleanCellFunctor
+ * class). Each half-space is a signed surface id (e.g. -1 is the negative
+ * side of surface 1). The half-spaces can be combined with intersection ("n")
+ * and union ("u") operators and grouped with parentheses. Adjacent
+ * half-spaces with no operator between them are intersected. Operators with
+ * no parentheses are evaluated from left to right, e.g.
+ * "-1 n 2 n ( -3 u 4 )". The definition is compiled into a postfix program
+ * that is evaluated with the senses of the surfaces at a point.
+ */
+class NativeCellDefinition
+{
+
+public:
+
+  //! The entity id type
+  typedef Navigator::EntityId EntityId;
+
+  //! Default constructor (empty definition)
+  NativeCellDefinition();
+
+  //! Constructor
+  NativeCellDefinition( const std::string& definition );
+
+  //! Destructor
+  ~NativeCellDefinition()
+  { /* ... */ }
+
+  //! Return the definition string
+  const std::string& getDefinition() const;
+
+  //! Return the unique surface ids that appear in the definition
+  const std::vector<EntityId>& getSurfaceIds() const;
+
+  //! Check if the definition only contains intersections
+  bool isSimple() const;
+
+  //! Return the required sense of each surface (simple definitions only)
+  const std::vector<int>& getSimpleDefinitionSenses() const;
+
+  //! Evaluate the definition
+  bool evaluate( const int surface_senses[] ) const;
+
+private:
+
+  // The postfix program token types
+  enum TokenType{
+    HALF_SPACE_TOKEN = 0,
+    INTERSECTION_TOKEN,
+    UNION_TOKEN
+  };
+
+  // The postfix program token
+  struct Token
+  {
+    // The token type
+    TokenType type;
+
+    // The unique surface index (half-space tokens only)
+    uint32_t surface;
+
+    // The required sense (half-space tokens only)
+    int sense;
+  };
+
+  // The max evaluation stack depth
+  static const unsigned s_max_stack_depth = 64;
+
+  // Compile the definition
+  void compile();
+
+  // The definition string
+  std::string d_definition;
+
+  // The unique surface ids
+  std::vector<EntityId> d_surface_ids;
+
+  // The postfix program
+  std::vector<Token> d_program;
+
+  // Records if the definition only contains intersections
+  bool d_simple;
+
+  // The required sense of each unique surface (simple definitions only)
+  std::vector<int> d_simple_senses;
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_NATIVE_CELL_DEFINITION_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeCellDefinition.hpp
+//---------------------------------------------------------------------------//
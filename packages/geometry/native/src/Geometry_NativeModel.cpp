@@ -0,0 +1,860 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel.cpp
+//! \author Alex Robinson
+//! \brief  Native model class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // Must be included first
+#include "Geometry_NativeModel.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const size_t NativeModel::s_invalid_index =
+  std::numeric_limits<size_t>::max();
+
+const double NativeModel::s_boundary_tol = 1e-9;
+
+// Constructor
+NativeModel::NativeModel( const std::string& name )
+  : d_name( name ),
+    d_thread_cell_neighbors( 1 )
+{ /* ... */ }
+
+// Add a surface to the model
+void NativeModel::addSurface( const EntityId surface_id,
+                              const QuadricSurface& surface )
+{
+  TEST_FOR_EXCEPTION( surface_id == Model::invalidSurfaceId(),
+                      InvalidNativeGeometry,
+                      "The surface id " << surface_id << " is reserved!" );
+
+  TEST_FOR_EXCEPTION( this->doesSurfaceExist( surface_id ),
+                      InvalidNativeGeometry,
+                      "Surface " << surface_id << " has already been added "
+                      "to the model!" );
+
+  d_surface_id_index_map[surface_id] = d_surfaces.size();
+
+  d_surface_ids.push_back( surface_id );
+  d_surfaces.push_back( surface );
+  d_reflecting_surface_flags.push_back( false );
+  d_surface_cells.resize( d_surfaces.size() );
+}
+
+// Add a cell to the model
+/*! \details The definition must only reference surfaces that have already
+ * been added to the model (see Geometry::NativeCellDefinition for the
+ * definition format).
+ */
+void NativeModel::addCell( const EntityId cell_id,
+                           const std::string& cell_definition )
+{
+  TEST_FOR_EXCEPTION( cell_id == Model::invalidCellId(),
+                      InvalidNativeGeometry,
+                      "The cell id " << cell_id << " is reserved!" );
+
+  TEST_FOR_EXCEPTION( this->doesCellExist( cell_id ),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " has already been added to the "
+                      "model!" );
+
+  CellData cell;
+
+  try{
+    cell.definition = NativeCellDefinition( cell_definition );
+  }
+  EXCEPTION_CATCH_RETHROW_AS( std::runtime_error,
+                              InvalidNativeGeometry,
+                              "Cell " << cell_id << " has an invalid "
+                              "definition!" );
+
+  cell.bounded = false;
+
+  d_cell_id_index_map[cell_id] = d_cells.size();
+
+  d_cell_ids.push_back( cell_id );
+  d_cell_definitions.push_back( cell_definition );
+  d_cells.push_back( cell );
+
+  try{
+    this->assignCellSurfaceIndices( d_cells.size()-1 );
+  }
+  catch( ... )
+  {
+    d_cell_id_index_map.erase( cell_id );
+    d_cell_ids.pop_back();
+    d_cell_definitions.pop_back();
+    d_cells.pop_back();
+
+    throw;
+  }
+
+  // The cell neighbors that have been learned are no longer complete
+  this->resetThreadCellNeighbors( d_thread_cell_neighbors.size() );
+}
+
+// Set the cell material
+void NativeModel::setCellMaterial( const EntityId cell_id,
+                                   const MaterialId material_id,
+                                   const Density density )
+{
+  TEST_FOR_EXCEPTION( !this->doesCellExist( cell_id ),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " does not exist!" );
+
+  d_cell_material_ids[cell_id] = material_id;
+  d_cell_densities[cell_id] = density;
+}
+
+// Set a termination cell
+void NativeModel::setTerminationCell( const EntityId cell_id )
+{
+  TEST_FOR_EXCEPTION( !this->doesCellExist( cell_id ),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " does not exist!" );
+
+  d_termination_cells.insert( cell_id );
+}
+
+// Set a reflecting surface
+void NativeModel::setReflectingSurface( const EntityId surface_id )
+{
+  TEST_FOR_EXCEPTION( !this->doesSurfaceExist( surface_id ),
+                      InvalidNativeGeometry,
+                      "Surface " << surface_id << " does not exist!" );
+
+  d_reflecting_surfaces.insert( surface_id );
+
+  d_reflecting_surface_flags[this->getSurfaceIndex( surface_id )] = true;
+}
+
+// Set the cell bounding box (used to cull the cell)
+/*! \details The bounding box must contain the entire cell. Point location
+ * queries for points outside of the box will not evaluate the cell
+ * definition.
+ */
+void NativeModel::setCellBoundingBox( const EntityId cell_id,
+                                      const Length lower_bounds[3],
+                                      const Length upper_bounds[3] )
+{
+  TEST_FOR_EXCEPTION( !this->doesCellExist( cell_id ),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " does not exist!" );
+
+  BoundingBox bounding_box;
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    TEST_FOR_EXCEPTION( lower_bounds[i] >= upper_bounds[i],
+                        InvalidNativeGeometry,
+                        "The bounding box of cell " << cell_id << " is "
+                        "invalid!" );
+
+    bounding_box[i] = lower_bounds[i].value();
+    bounding_box[i+3] = upper_bounds[i].value();
+  }
+
+  d_cell_bounding_boxes[cell_id] = bounding_box;
+
+  CellData& cell = d_cells[this->getCellIndex( cell_id )];
+
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    cell.lower_bounds[i] = bounding_box[i];
+    cell.upper_bounds[i] = bounding_box[i+3];
+  }
+
+  cell.bounded = true;
+}
+
+// Set the cell volume
+void NativeModel::setCellVolume( const EntityId cell_id, const Volume volume )
+{
+  TEST_FOR_EXCEPTION( !this->doesCellExist( cell_id ),
+                      InvalidNativeGeometry,
+                      "Cell " << cell_id << " does not exist!" );
+
+  TEST_FOR_EXCEPTION( volume <= 0.0*VolumeUnit(),
+                      InvalidNativeGeometry,
+                      "The volume of cell " << cell_id << " must be "
+                      "positive!" );
+
+  d_cell_volumes[cell_id] = volume;
+}
+
+// Set the surface area
+void NativeModel::setSurfaceArea( const EntityId surface_id, const Area area )
+{
+  TEST_FOR_EXCEPTION( !this->doesSurfaceExist( surface_id ),
+                      InvalidNativeGeometry,
+                      "Surface " << surface_id << " does not exist!" );
+
+  TEST_FOR_EXCEPTION( area <= 0.0*AreaUnit(),
+                      InvalidNativeGeometry,
+                      "The area of surface " << surface_id << " must be "
+                      "positive!" );
+
+  d_surface_areas[surface_id] = area;
+}
+
+// Add a cell estimator
+void NativeModel::addCellEstimator( const EstimatorId estimator_id,
+                                    const EstimatorType estimator_type,
+                                    const ParticleType particle_type,
+                                    const CellIdArray& cells )
+{
+  TEST_FOR_EXCEPTION( d_cell_estimator_data.count( estimator_id ) ||
+                      d_surface_estimator_data.count( estimator_id ),
+                      InvalidNativeGeometry,
+                      "Estimator " << estimator_id << " has already been "
+                      "added to the model!" );
+
+  TEST_FOR_EXCEPTION( !isCellEstimator( estimator_type ),
+                      InvalidNativeGeometry,
+                      "Estimator " << estimator_id << " is not a cell "
+                      "estimator!" );
+
+  for( size_t i = 0; i < cells.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( !this->doesCellExist( cells[i] ),
+                        InvalidNativeGeometry,
+                        "Estimator " << estimator_id << " references cell "
+                        << cells[i] << ", which does not exist!" );
+  }
+
+  d_cell_estimator_data[estimator_id] =
+    std::make_tuple( estimator_type, particle_type, cells );
+}
+
+// Add a surface estimator
+void NativeModel::addSurfaceEstimator( const EstimatorId estimator_id,
+                                       const EstimatorType estimator_type,
+                                       const ParticleType particle_type,
+                                       const SurfaceIdArray& surfaces )
+{
+  TEST_FOR_EXCEPTION( d_cell_estimator_data.count( estimator_id ) ||
+                      d_surface_estimator_data.count( estimator_id ),
+                      InvalidNativeGeometry,
+                      "Estimator " << estimator_id << " has already been "
+                      "added to the model!" );
+
+  TEST_FOR_EXCEPTION( !isSurfaceEstimator( estimator_type ),
+                      InvalidNativeGeometry,
+                      "Estimator " << estimator_id << " is not a surface "
+                      "estimator!" );
+
+  for( size_t i = 0; i < surfaces.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( !this->doesSurfaceExist( surfaces[i] ),
+                        InvalidNativeGeometry,
+                        "Estimator " << estimator_id << " references "
+                        "surface " << surfaces[i] << ", which does not "
+                        "exist!" );
+  }
+
+  d_surface_estimator_data[estimator_id] =
+    std::make_tuple( estimator_type, particle_type, surfaces );
+}
+
+// Get a surface
+const QuadricSurface& NativeModel::getSurface(
+                                           const EntityId surface_id ) const
+{
+  // Make sure that the surface exists
+  testPrecondition( this->doesSurfaceExist( surface_id ) );
+
+  return d_surfaces[this->getSurfaceIndex( surface_id )];
+}
+
+// Get a cell definition
+const NativeCellDefinition& NativeModel::getCellDefinition(
+                                              const EntityId cell_id ) const
+{
+  // Make sure that the cell exists
+  testPrecondition( this->doesCellExist( cell_id ) );
+
+  return d_cells[this->getCellIndex( cell_id )].definition;
+}
+
+// Get the model name
+std::string NativeModel::getName() const
+{
+  return d_name;
+}
+
+// Check if the model has cell estimator data
+bool NativeModel::hasCellEstimatorData() const
+{
+  return !d_cell_estimator_data.empty();
+}
+
+// Check if the model has surface estimator data
+bool NativeModel::hasSurfaceEstimatorData() const
+{
+  return !d_surface_estimator_data.empty();
+}
+
+// Get the material ids
+void NativeModel::getMaterialIds( MaterialIdSet& material_ids ) const
+{
+  for( CellIdMatIdMap::const_iterator cell_it = d_cell_material_ids.begin();
+       cell_it != d_cell_material_ids.end();
+       ++cell_it )
+  {
+    material_ids.insert( cell_it->second );
+  }
+}
+
+// Get the problem cells
+void NativeModel::getCells( CellIdSet& cell_set,
+                            const bool include_void_cells,
+                            const bool include_termination_cells ) const
+{
+  for( size_t i = 0; i < d_cell_ids.size(); ++i )
+  {
+    const EntityId cell_id = d_cell_ids[i];
+
+    if( this->isTerminationCell( cell_id ) )
+    {
+      if( include_termination_cells )
+        cell_set.insert( cell_id );
+    }
+    else if( this->isVoidCell( cell_id ) )
+    {
+      if( include_void_cells )
+        cell_set.insert( cell_id );
+    }
+    else
+      cell_set.insert( cell_id );
+  }
+}
+
+// Get the cell material ids
+void NativeModel::getCellMaterialIds(
+                                     CellIdMatIdMap& cell_id_mat_id_map ) const
+{
+  cell_id_mat_id_map.insert( d_cell_material_ids.begin(),
+                             d_cell_material_ids.end() );
+}
+
+// Get the cell densities
+void NativeModel::getCellDensities(
+                                  CellIdDensityMap& cell_id_density_map ) const
+{
+  cell_id_density_map.insert( d_cell_densities.begin(),
+                              d_cell_densities.end() );
+}
+
+// Get the cell estimator data
+void NativeModel::getCellEstimatorData(
+                          CellEstimatorIdDataMap& estimator_id_data_map ) const
+{
+  estimator_id_data_map.insert( d_cell_estimator_data.begin(),
+                                d_cell_estimator_data.end() );
+}
+
+// Check if a cell exists
+bool NativeModel::doesCellExist( const EntityId cell_id ) const
+{
+  return d_cell_id_index_map.find( cell_id ) != d_cell_id_index_map.end();
+}
+
+// Check if the cell is a termination cell
+bool NativeModel::isTerminationCell( const EntityId cell_id ) const
+{
+  return d_termination_cells.find( cell_id ) != d_termination_cells.end();
+}
+
+// Check if the cell is a void cell
+bool NativeModel::isVoidCell( const EntityId cell_id ) const
+{
+  return d_cell_material_ids.find( cell_id ) == d_cell_material_ids.end();
+}
+
+// Get the cell volume
+/*! \details The cell volume must be set with the setCellVolume method (cell
+ * volumes are not calculated).
+ */
+auto NativeModel::getCellVolume( const EntityId cell_id ) const -> Volume
+{
+  std::map<EntityId,Volume>::const_iterator cell_it =
+    d_cell_volumes.find( cell_id );
+
+  TEST_FOR_EXCEPTION( cell_it == d_cell_volumes.end(),
+                      InvalidNativeGeometry,
+                      "The volume of cell " << cell_id << " has not been "
+                      "set!" );
+
+  return cell_it->second;
+}
+
+// Get the problem surfaces
+void NativeModel::getSurfaces( SurfaceIdSet& surface_set ) const
+{
+  surface_set.insert( d_surface_ids.begin(), d_surface_ids.end() );
+}
+
+// Get the surface estimator data
+void NativeModel::getSurfaceEstimatorData(
+                       SurfaceEstimatorIdDataMap& estimator_id_data_map ) const
+{
+  estimator_id_data_map.insert( d_surface_estimator_data.begin(),
+                                d_surface_estimator_data.end() );
+}
+
+// Check if the surface exists
+bool NativeModel::doesSurfaceExist( const EntityId surface_id ) const
+{
+  return d_surface_id_index_map.find( surface_id ) !=
+    d_surface_id_index_map.end();
+}
+
+// Get the surface area
+/*! \details The surface area must be set with the setSurfaceArea method
+ * (surface areas are not calculated).
+ */
+auto NativeModel::getSurfaceArea( const EntityId surface_id ) const -> Area
+{
+  std::map<EntityId,Area>::const_iterator surface_it =
+    d_surface_areas.find( surface_id );
+
+  TEST_FOR_EXCEPTION( surface_it == d_surface_areas.end(),
+                      InvalidNativeGeometry,
+                      "The area of surface " << surface_id << " has not "
+                      "been set!" );
+
+  return surface_it->second;
+}
+
+// Check if the surface is a reflecting surface
+bool NativeModel::isReflectingSurface( const EntityId surface_id ) const
+{
+  return d_reflecting_surfaces.find( surface_id ) !=
+    d_reflecting_surfaces.end();
+}
+
+// Create a raw, heap-allocated navigator
+NativeNavigator* NativeModel::createNavigatorAdvanced(
+       const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const
+{
+  return new NativeNavigator( this->shared_from_this(),
+                              advance_complete_callback );
+}
+
+// Create a raw, heap-allocated navigator
+NativeNavigator* NativeModel::createNavigatorAdvanced() const
+{
+  return new NativeNavigator( this->shared_from_this() );
+}
+
+// Check if the model has been initialized
+/*! \details A native model is always initialized (the model data is
+ * rebuilt when it is loaded from an archive).
+ */
+bool NativeModel::isInitialized() const
+{
+  return true;
+}
+
+// Initialize the model just-in-time
+void NativeModel::initializeJustInTime()
+{ /* ... */ }
+
+// Enable thread support
+/*! \details Each thread will learn the cell neighbors independently. The
+ * neighbors that have already been learned will be discarded. Only the
+ * master thread should call this method.
+ */
+void NativeModel::enableThreadSupport( const size_t threads ) const
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure a valid number of threads has been requested
+  testPrecondition( threads > 0 );
+
+  this->resetThreadCellNeighbors( threads );
+}
+
+// Reset the cell neighbors of every thread
+void NativeModel::resetThreadCellNeighbors( const size_t threads ) const
+{
+  d_thread_cell_neighbors.assign( threads, CellNeighbors( d_cells.size() ) );
+}
+
+// Return the index of a cell
+size_t NativeModel::getCellIndex( const EntityId cell_id ) const
+{
+  std::unordered_map<EntityId,size_t>::const_iterator cell_it =
+    d_cell_id_index_map.find( cell_id );
+
+  if( cell_it != d_cell_id_index_map.end() )
+    return cell_it->second;
+  else
+    return s_invalid_index;
+}
+
+// Return the index of a surface
+size_t NativeModel::getSurfaceIndex( const EntityId surface_id ) const
+{
+  std::unordered_map<EntityId,size_t>::const_iterator surface_it =
+    d_surface_id_index_map.find( surface_id );
+
+  if( surface_it != d_surface_id_index_map.end() )
+    return surface_it->second;
+  else
+    return s_invalid_index;
+}
+
+// Get the location of a point w.r.t. a cell
+/*! \details The direction is used to determine the location of points that
+ * are on a surface of the cell (POINT_ON_CELL is never returned).
+ */
+PointLocation NativeModel::getPointLocationWithCellIndex(
+                                             const double position[3],
+                                             const double direction[3],
+                                             const size_t cell_index ) const
+{
+  const CellData& cell = d_cells[cell_index];
+
+  // Cull the cell using its bounding box
+  if( cell.bounded )
+  {
+    for( unsigned i = 0; i < 3; ++i )
+    {
+      if( position[i] < cell.lower_bounds[i] - s_boundary_tol ||
+          position[i] > cell.upper_bounds[i] + s_boundary_tol )
+        return POINT_OUTSIDE_CELL;
+    }
+  }
+
+  const size_t number_of_surfaces = cell.surface_indices.size();
+
+  // Intersection-only cells can exit as soon as a sense does not match
+  if( cell.definition.isSimple() )
+  {
+    const std::vector<int>& required_senses =
+      cell.definition.getSimpleDefinitionSenses();
+
+    for( size_t i = 0; i < number_of_surfaces; ++i )
+    {
+      const int sense =
+        d_surfaces[cell.surface_indices[i]].getSense( position,
+                                                      direction,
+                                                      s_boundary_tol );
+
+      if( sense != required_senses[i] )
+        return POINT_OUTSIDE_CELL;
+    }
+
+    return POINT_INSIDE_CELL;
+  }
+  else
+  {
+    thread_local std::vector<int> senses;
+
+    senses.resize( number_of_surfaces );
+
+    for( size_t i = 0; i < number_of_surfaces; ++i )
+    {
+      senses[i] =
+        d_surfaces[cell.surface_indices[i]].getSense( position,
+                                                      direction,
+                                                      s_boundary_tol );
+    }
+
+    if( cell.definition.evaluate( senses.data() ) )
+      return POINT_INSIDE_CELL;
+    else
+      return POINT_OUTSIDE_CELL;
+  }
+}
+
+// Find the index of the cell that contains the ray
+size_t NativeModel::findCellIndexContainingRay(
+                                            const double position[3],
+                                            const double direction[3] ) const
+{
+  for( size_t i = 0; i < d_cells.size(); ++i )
+  {
+    if( this->getPointLocationWithCellIndex( position, direction, i ) ==
+        POINT_INSIDE_CELL )
+      return i;
+  }
+
+  return s_invalid_index;
+}
+
+// Find the index of the cell on the other side of a boundary surface
+/*! \details The cells that have previously been entered from the cell (by
+ * the calling thread) will be checked first, followed by the cells that
+ * reference the boundary surface. All remaining cells will be checked last.
+ * The cell that is found will be cached as a neighbor of the cell. Threads
+ * that thread support has not been enabled for will not use the cache.
+ */
+size_t NativeModel::findBoundaryCellIndex( const double position[3],
+                                           const double direction[3],
+                                           const size_t cell_index,
+                                           const size_t surface_index ) const
+{
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+
+  // A thread without its own cell neighbors uses an empty neighbor list
+  std::vector<size_t> uncached_neighbors;
+
+  std::vector<size_t>& neighbors =
+    (thread_id < d_thread_cell_neighbors.size() ?
+     d_thread_cell_neighbors[thread_id][cell_index] :
+     uncached_neighbors);
+
+  // Check the cached neighbors
+  for( size_t i = 0; i < neighbors.size(); ++i )
+  {
+    if( this->getPointLocationWithCellIndex( position,
+                                             direction,
+                                             neighbors[i] ) ==
+        POINT_INSIDE_CELL )
+      return neighbors[i];
+  }
+
+  size_t boundary_cell_index = s_invalid_index;
+
+  // Check the other cells that reference the surface
+  const std::vector<size_t>& surface_cells = d_surface_cells[surface_index];
+
+  for( size_t i = 0; i < surface_cells.size(); ++i )
+  {
+    const size_t test_cell_index = surface_cells[i];
+
+    if( test_cell_index == cell_index ||
+        std::find( neighbors.begin(), neighbors.end(), test_cell_index ) !=
+        neighbors.end() )
+      continue;
+
+    if( this->getPointLocationWithCellIndex( position,
+                                             direction,
+                                             test_cell_index ) ==
+        POINT_INSIDE_CELL )
+    {
+      boundary_cell_index = test_cell_index;
+
+      break;
+    }
+  }
+
+  // Check all remaining cells
+  if( boundary_cell_index == s_invalid_index )
+  {
+    for( size_t i = 0; i < d_cells.size(); ++i )
+    {
+      if( i == cell_index ||
+          std::find( neighbors.begin(), neighbors.end(), i ) !=
+          neighbors.end() )
+        continue;
+
+      if( this->getPointLocationWithCellIndex( position, direction, i ) ==
+          POINT_INSIDE_CELL )
+      {
+        boundary_cell_index = i;
+
+        break;
+      }
+    }
+  }
+
+  if( boundary_cell_index != s_invalid_index )
+    neighbors.push_back( boundary_cell_index );
+
+  return boundary_cell_index;
+}
+
+// Fire a ray from inside of a cell
+/*! \details If the ray starts on a surface its index should be passed in so
+ * that the zero distance intersection with the surface is ignored. If the
+ * ray does not hit a surface of the cell, infinity will be returned and the
+ * surface index hit will be set to the invalid index.
+ */
+double NativeModel::fireRayWithCellIndex( const double position[3],
+                                          const double direction[3],
+                                          const size_t cell_index,
+                                          const size_t on_surface_index,
+                                          size_t& surface_index_hit ) const
+{
+  const CellData& cell = d_cells[cell_index];
+
+  const size_t number_of_surfaces = cell.surface_indices.size();
+  const size_t* surface_indices = cell.surface_indices.data();
+
+  double ray_position[3] = {position[0], position[1], position[2]};
+  size_t ray_surface_index = on_surface_index;
+  double distance_traveled = 0.0;
+
+  // Each quadric surface can be crossed at most twice
+  for( size_t crossings = 0; crossings <= 2*number_of_surfaces; ++crossings )
+  {
+    double distance = std::numeric_limits<double>::infinity();
+
+    surface_index_hit = s_invalid_index;
+
+    for( size_t i = 0; i < number_of_surfaces; ++i )
+    {
+      const size_t surface_index = surface_indices[i];
+
+      const double surface_distance =
+        d_surfaces[surface_index].getDistance( ray_position,
+                                               direction,
+                                               surface_index ==
+                                               ray_surface_index );
+
+      if( surface_distance < distance )
+      {
+        distance = surface_distance;
+        surface_index_hit = surface_index;
+      }
+    }
+
+    if( surface_index_hit == s_invalid_index )
+      return std::numeric_limits<double>::infinity();
+
+    distance_traveled += distance;
+
+    // Crossing any surface of an intersection-only cell exits the cell
+    if( cell.definition.isSimple() )
+      break;
+
+    // Crossing a surface of a cell with unions may not exit the cell
+    ray_position[0] += distance*direction[0];
+    ray_position[1] += distance*direction[1];
+    ray_position[2] += distance*direction[2];
+
+    if( this->getPointLocationWithCellIndex( ray_position,
+                                             direction,
+                                             cell_index ) ==
+        POINT_OUTSIDE_CELL )
+      break;
+
+    ray_surface_index = surface_index_hit;
+  }
+
+  return distance_traveled;
+}
+
+// Get the distance to the closest boundary of a cell
+/*! \details The distance is exact for planes, spheres and axis-aligned
+ * cylinders (see QuadricSurface::getDistanceToClosestPoint).
+ */
+double NativeModel::getDistanceToClosestBoundaryWithCellIndex(
+                                              const double position[3],
+                                              const size_t cell_index ) const
+{
+  const CellData& cell = d_cells[cell_index];
+
+  double distance = std::numeric_limits<double>::infinity();
+
+  for( size_t i = 0; i < cell.surface_indices.size(); ++i )
+  {
+    distance = std::min( distance,
+                         d_surfaces[cell.surface_indices[i]].getDistanceToClosestPoint( position ) );
+  }
+
+  return distance;
+}
+
+// Assign the surface indices of the cell
+void NativeModel::assignCellSurfaceIndices( const size_t cell_index )
+{
+  CellData& cell = d_cells[cell_index];
+
+  const std::vector<EntityId>& surface_ids =
+    cell.definition.getSurfaceIds();
+
+  cell.surface_indices.resize( surface_ids.size() );
+
+  for( size_t i = 0; i < surface_ids.size(); ++i )
+  {
+    const size_t surface_index = this->getSurfaceIndex( surface_ids[i] );
+
+    TEST_FOR_EXCEPTION( surface_index == s_invalid_index,
+                        InvalidNativeGeometry,
+                        "Cell " << d_cell_ids[cell_index] << " references "
+                        "surface " << surface_ids[i] << ", which does not "
+                        "exist!" );
+
+    cell.surface_indices[i] = surface_index;
+  }
+
+  for( size_t i = 0; i < cell.surface_indices.size(); ++i )
+    d_surface_cells[cell.surface_indices[i]].push_back( cell_index );
+}
+
+// Rebuild the cell data and the entity index maps
+void NativeModel::rebuildIndices()
+{
+  d_surface_id_index_map.clear();
+  d_reflecting_surface_flags.assign( d_surfaces.size(), false );
+  d_surface_cells.clear();
+  d_surface_cells.resize( d_surfaces.size() );
+
+  for( size_t i = 0; i < d_surface_ids.size(); ++i )
+  {
+    d_surface_id_index_map[d_surface_ids[i]] = i;
+
+    if( this->isReflectingSurface( d_surface_ids[i] ) )
+      d_reflecting_surface_flags[i] = true;
+  }
+
+  d_cell_id_index_map.clear();
+  d_cells.clear();
+  d_cells.resize( d_cell_ids.size() );
+
+  for( size_t i = 0; i < d_cell_ids.size(); ++i )
+  {
+    d_cell_id_index_map[d_cell_ids[i]] = i;
+
+    CellData& cell = d_cells[i];
+
+    cell.definition = NativeCellDefinition( d_cell_definitions[i] );
+
+    std::map<EntityId,BoundingBox>::const_iterator bounding_box_it =
+      d_cell_bounding_boxes.find( d_cell_ids[i] );
+
+    if( bounding_box_it != d_cell_bounding_boxes.end() )
+    {
+      for( unsigned j = 0; j < 3; ++j )
+      {
+        cell.lower_bounds[j] = bounding_box_it->second[j];
+        cell.upper_bounds[j] = bounding_box_it->second[j+3];
+      }
+
+      cell.bounded = true;
+    }
+    else
+      cell.bounded = false;
+
+    this->assignCellSurfaceIndices( i );
+  }
+
+  // The cell neighbors that have been learned may no longer be valid
+  this->resetThreadCellNeighbors( d_thread_cell_neighbors.size() );
+}
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( NativeModel );
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_IMPLEMENT( NativeModel, Geometry );
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,376 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel.hpp
+//! \author Alex Robinson
+//! \brief  Native model class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_MODEL_HPP
+#define GEOMETRY_NATIVE_MODEL_HPP
+
+// Std Lib Includes
+#include <string>
+#include <stdexcept>
+#include <memory>
+#include <array>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "Geometry_QuadricSurface.hpp"
+#include "Geometry_NativeCellDefinition.hpp"
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_PointLocation.hpp"
+#include "Geometry_AdvancedModel.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Array.hpp"
+#include "Utility_Tuple.hpp"
+
+namespace Geometry{
+
+/*! The native geometry model
+ *
+ * A native model is a constructive solid geometry model that is built from
+ * quadric surfaces (see Geometry::QuadricSurface) and cells that are defined
+ * by logical combinations of the surface half-spaces (see
+ * Geometry::NativeCellDefinition). The surface and cell definitions follow
+ * the conventions of the legacy Geometry::Surface and Geometry::Cell classes
+ * but no external geometry library is required. The surfaces of the model
+ * are stored contiguously and the surfaces that bound each cell are stored
+ * as indices into the surface array so that no virtual dispatch occurs when
+ * a ray is fired. An optional bounding box can be assigned to each cell,
+ * which will be used to cull the cell during point location queries. The
+ * cells that can be entered from each cell are learned (per thread) as rays
+ * cross cell boundaries, which reduces the number of cells that must be
+ * tested after each boundary crossing. The learned neighbors are owned by
+ * the model - Geometry::NativeModel::enableThreadSupport must be called
+ * before the model is used by more than one thread. Surfaces must be added to the model
+ * before the cells that reference them.
+ */
+class NativeModel : public AdvancedModel,
+                    public std::enable_shared_from_this<NativeModel>
+{
+
+public:
+
+  //! Constructor
+  NativeModel( const std::string& name = "native" );
+
+  //! Destructor
+  ~NativeModel()
+  { /* ... */ }
+
+  //! Add a surface to the model
+  void addSurface( const EntityId surface_id, const QuadricSurface& surface );
+
+  //! Add a cell to the model
+  void addCell( const EntityId cell_id, const std::string& cell_definition );
+
+  //! Set the cell material
+  void setCellMaterial( const EntityId cell_id,
+                        const MaterialId material_id,
+                        const Density density );
+
+  //! Set a termination cell
+  void setTerminationCell( const EntityId cell_id );
+
+  //! Set a reflecting surface
+  void setReflectingSurface( const EntityId surface_id );
+
+  //! Set the cell bounding box (used to cull the cell)
+  void setCellBoundingBox( const EntityId cell_id,
+                           const Length lower_bounds[3],
+                           const Length upper_bounds[3] );
+
+  //! Set the cell volume
+  void setCellVolume( const EntityId cell_id, const Volume volume );
+
+  //! Set the surface area
+  void setSurfaceArea( const EntityId surface_id, const Area area );
+
+  //! Add a cell estimator
+  void addCellEstimator( const EstimatorId estimator_id,
+                         const EstimatorType estimator_type,
+                         const ParticleType particle_type,
+                         const CellIdArray& cells );
+
+  //! Add a surface estimator
+  void addSurfaceEstimator( const EstimatorId estimator_id,
+                            const EstimatorType estimator_type,
+                            const ParticleType particle_type,
+                            const SurfaceIdArray& surfaces );
+
+  //! Get a surface
+  const QuadricSurface& getSurface( const EntityId surface_id ) const;
+
+  //! Get a cell definition
+  const NativeCellDefinition& getCellDefinition( const EntityId cell_id ) const;
+
+  //! Get the model name
+  std::string getName() const override;
+
+  //! Check if the model has cell estimator data
+  bool hasCellEstimatorData() const override;
+
+  //! Check if the model has surface estimator data
+  bool hasSurfaceEstimatorData() const override;
+
+  //! Get the material ids
+  void getMaterialIds( MaterialIdSet& material_ids ) const override;
+
+  //! Get the problem cells
+  void getCells( CellIdSet& cell_set,
+                 const bool include_void_cells,
+                 const bool include_termination_cells ) const override;
+
+  //! Get the cell material ids
+  void getCellMaterialIds( CellIdMatIdMap& cell_id_mat_id_map ) const override;
+
+  //! Get the cell densities
+  void getCellDensities( CellIdDensityMap& cell_id_density_map ) const override;
+
+  //! Get the cell estimator data
+  void getCellEstimatorData( CellEstimatorIdDataMap& estimator_id_data_map ) const override;
+
+  //! Check if a cell exists
+  bool doesCellExist( const EntityId cell_id ) const override;
+
+  //! Check if the cell is a termination cell
+  bool isTerminationCell( const EntityId cell_id ) const override;
+
+  //! Check if the cell is a void cell
+  bool isVoidCell( const EntityId cell_id ) const override;
+
+  //! Get the cell volume
+  Volume getCellVolume( const EntityId cell_id ) const override;
+
+  //! Get the problem surfaces
+  void getSurfaces( SurfaceIdSet& surface_set ) const override;
+
+  //! Get the surface estimator data
+  void getSurfaceEstimatorData( SurfaceEstimatorIdDataMap& estimator_id_data_map ) const override;
+
+  //! Check if the surface exists
+  bool doesSurfaceExist( const EntityId surface_id ) const override;
+
+  //! Get the surface area
+  Area getSurfaceArea( const EntityId surface_id ) const override;
+
+  //! Check if the surface is a reflecting surface
+  bool isReflectingSurface( const EntityId surface_id ) const override;
+
+  //! Create a raw, heap-allocated navigator
+  NativeNavigator* createNavigatorAdvanced( const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const override;
+
+  //! Create a raw, heap-allocated navigator
+  NativeNavigator* createNavigatorAdvanced() const override;
+
+  //! Check if the model has been initialized
+  bool isInitialized() const final override;
+
+  //! Enable thread support
+  void enableThreadSupport( const size_t threads ) const override;
+
+protected:
+
+  //! Initialize the model just-in-time
+  void initializeJustInTime() final override;
+
+private:
+
+  // The cell data
+  struct CellData
+  {
+    // The cell definition
+    NativeCellDefinition definition;
+
+    // The indices of the surfaces in the definition (definition order)
+    std::vector<size_t> surface_indices;
+
+    // The bounding box lower bounds (only used if the cell is bounded)
+    double lower_bounds[3];
+
+    // The bounding box upper bounds (only used if the cell is bounded)
+    double upper_bounds[3];
+
+    // Records if a bounding box has been set
+    bool bounded;
+  };
+
+  // The cell bounding box type (lower x, y, z, upper x, y, z)
+  typedef std::array<double,6> BoundingBox;
+
+  // The cell neighbors type (the neighbor cell indices of each cell)
+  typedef std::vector<std::vector<size_t> > CellNeighbors;
+
+  // Reset the cell neighbors of every thread
+  void resetThreadCellNeighbors( const size_t threads ) const;
+
+  // Return the index of a cell
+  size_t getCellIndex( const EntityId cell_id ) const;
+
+  // Return the id of a cell
+  EntityId getCellId( const size_t cell_index ) const;
+
+  // Return the index of a surface
+  size_t getSurfaceIndex( const EntityId surface_id ) const;
+
+  // Return the id of a surface
+  EntityId getSurfaceId( const size_t surface_index ) const;
+
+  // Return the surface with the desired index
+  const QuadricSurface& getSurfaceWithIndex( const size_t surface_index ) const;
+
+  // Check if the surface with the desired index is a reflecting surface
+  bool isReflectingSurfaceIndex( const size_t surface_index ) const;
+
+  // Get the location of a point w.r.t. a cell
+  PointLocation getPointLocationWithCellIndex( const double position[3],
+                                               const double direction[3],
+                                               const size_t cell_index ) const;
+
+  // Find the index of the cell that contains the ray
+  size_t findCellIndexContainingRay( const double position[3],
+                                     const double direction[3] ) const;
+
+  // Find the index of the cell on the other side of a boundary surface
+  size_t findBoundaryCellIndex( const double position[3],
+                                const double direction[3],
+                                const size_t cell_index,
+                                const size_t surface_index ) const;
+
+  // Fire a ray from inside of a cell
+  double fireRayWithCellIndex( const double position[3],
+                               const double direction[3],
+                               const size_t cell_index,
+                               const size_t on_surface_index,
+                               size_t& surface_index_hit ) const;
+
+  // Get the distance to the closest boundary of a cell
+  double getDistanceToClosestBoundaryWithCellIndex(
+                                             const double position[3],
+                                             const size_t cell_index ) const;
+
+  // Assign the surface indices of the cell
+  void assignCellSurfaceIndices( const size_t cell_index );
+
+  // Rebuild the cell data and the entity index maps
+  void rebuildIndices();
+
+  // Save the model to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the model from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // Declare the NativeNavigator as a friend
+  friend class NativeNavigator;
+
+  // The invalid index
+  static const size_t s_invalid_index;
+
+  // The boundary tolerance
+  static const double s_boundary_tol;
+
+  // The model name
+  std::string d_name;
+
+  // The surface ids
+  std::vector<EntityId> d_surface_ids;
+
+  // The surfaces (stored contiguously)
+  std::vector<QuadricSurface> d_surfaces;
+
+  // The cell ids
+  std::vector<EntityId> d_cell_ids;
+
+  // The cell definitions
+  std::vector<std::string> d_cell_definitions;
+
+  // The cell material ids
+  CellIdMatIdMap d_cell_material_ids;
+
+  // The cell densities
+  CellIdDensityMap d_cell_densities;
+
+  // The termination cells
+  CellIdSet d_termination_cells;
+
+  // The reflecting surfaces
+  SurfaceIdSet d_reflecting_surfaces;
+
+  // The cell bounding boxes
+  std::map<EntityId,BoundingBox> d_cell_bounding_boxes;
+
+  // The cell volumes
+  std::map<EntityId,Volume> d_cell_volumes;
+
+  // The surface areas
+  std::map<EntityId,Area> d_surface_areas;
+
+  // The cell estimator data
+  CellEstimatorIdDataMap d_cell_estimator_data;
+
+  // The surface estimator data
+  SurfaceEstimatorIdDataMap d_surface_estimator_data;
+
+  // The surface id index map
+  std::unordered_map<EntityId,size_t> d_surface_id_index_map;
+
+  // The cell id index map
+  std::unordered_map<EntityId,size_t> d_cell_id_index_map;
+
+  // The reflecting surface flags (surface index order)
+  std::vector<char> d_reflecting_surface_flags;
+
+  // The cell data (cell index order)
+  std::vector<CellData> d_cells;
+
+  // The indices of the cells that reference each surface
+  std::vector<std::vector<size_t> > d_surface_cells;
+
+  // The cell neighbors that have been learned by each thread
+  mutable std::vector<CellNeighbors> d_thread_cell_neighbors;
+};
+
+//! The invalid native geometry error
+class InvalidNativeGeometry : public std::runtime_error
+{
+
+public:
+
+  InvalidNativeGeometry( const std::string& what_arg )
+    : std::runtime_error( what_arg )
+  { /* ... */ }
+};
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( NativeModel, Geometry, 0 );
+BOOST_SERIALIZATION_ENABLE_SHARED_FROM_THIS( Geometry::NativeModel );
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( NativeModel, Geometry );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry, NativeModel );
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Geometry_NativeModel_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end GEOMETRY_NATIVE_MODEL_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel.hpp
+//---------------------------------------------------------------------------//
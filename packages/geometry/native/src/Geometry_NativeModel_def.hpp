@@ -0,0 +1,98 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeModel_def.hpp
+//! \author Alex Robinson
+//! \brief  Native model class template and inline definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_NATIVE_MODEL_DEF_HPP
+#define GEOMETRY_NATIVE_MODEL_DEF_HPP
+
+namespace Geometry{
+
+// Return the id of a cell
+inline auto NativeModel::getCellId( const size_t cell_index ) const -> EntityId
+{
+  return d_cell_ids[cell_index];
+}
+
+// Return the id of a surface
+inline auto NativeModel::getSurfaceId( const size_t surface_index ) const
+  -> EntityId
+{
+  return d_surface_ids[surface_index];
+}
+
+// Return the surface with the desired index
+inline const QuadricSurface& NativeModel::getSurfaceWithIndex(
+                                             const size_t surface_index ) const
+{
+  return d_surfaces[surface_index];
+}
+
+// Check if the surface with the desired index is a reflecting surface
+inline bool NativeModel::isReflectingSurfaceIndex(
+                                             const size_t surface_index ) const
+{
+  return d_reflecting_surface_flags[surface_index];
+}
+
+// Save the model to an archive
+template<typename Archive>
+void NativeModel::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class first
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( AdvancedModel );
+
+  // Save the model definition - the indices will be rebuilt
+  ar & BOOST_SERIALIZATION_NVP( d_name );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_definitions );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_material_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_densities );
+  ar & BOOST_SERIALIZATION_NVP( d_termination_cells );
+  ar & BOOST_SERIALIZATION_NVP( d_reflecting_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_bounding_boxes );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_volumes );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_areas );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_estimator_data );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_estimator_data );
+}
+
+// Load the model from an archive
+template<typename Archive>
+void NativeModel::load( Archive& ar, const unsigned version )
+{
+  // Load the base class first
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( AdvancedModel );
+
+  // Load the model definition
+  ar & BOOST_SERIALIZATION_NVP( d_name );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_definitions );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_material_ids );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_densities );
+  ar & BOOST_SERIALIZATION_NVP( d_termination_cells );
+  ar & BOOST_SERIALIZATION_NVP( d_reflecting_surfaces );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_bounding_boxes );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_volumes );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_areas );
+  ar & BOOST_SERIALIZATION_NVP( d_cell_estimator_data );
+  ar & BOOST_SERIALIZATION_NVP( d_surface_estimator_data );
+
+  // Rebuild the indices
+  this->rebuildIndices();
+}
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_NATIVE_MODEL_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeModel_def.hpp
+//---------------------------------------------------------------------------//
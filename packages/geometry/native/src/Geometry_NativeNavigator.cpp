@@ -0,0 +1,523 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_NativeNavigator.cpp
+//! \author Alex Robinson
+//! \brief  The native navigator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_NativeNavigator.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_3DCartesianVectorHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Default constructor
+NativeNavigator::NativeNavigator()
+  : Navigator(),
+    d_native_model(),
+    d_position{0.0, 0.0, 0.0},
+    d_direction{0.0, 0.0, 1.0},
+    d_cell_index( NativeModel::s_invalid_index ),
+    d_on_surface_index( NativeModel::s_invalid_index ),
+    d_intersection_surface_index( NativeModel::s_invalid_index ),
+    d_distance_to_intersection_surface( 0.0 ),
+    d_intersection_surface_known( false )
+{ /* ... */ }
+
+// Constructor
+NativeNavigator::NativeNavigator(
+          const std::shared_ptr<const NativeModel>& native_model,
+          const Navigator::AdvanceCompleteCallback& advance_complete_callback )
+  : Navigator( advance_complete_callback ),
+    d_native_model( native_model ),
+    d_position{0.0, 0.0, 0.0},
+    d_direction{0.0, 0.0, 1.0},
+    d_cell_index( NativeModel::s_invalid_index ),
+    d_on_surface_index( NativeModel::s_invalid_index ),
+    d_intersection_surface_index( NativeModel::s_invalid_index ),
+    d_distance_to_intersection_surface( 0.0 ),
+    d_intersection_surface_known( false )
+{
+  // Make sure that the native model is valid
+  testPrecondition( native_model.get() );
+}
+
+// Copy constructor
+/*! \details This constructor should only be used within the clone method. The
+ * Navigator::AdvanceCompleteCallback will also be copied
+ */
+NativeNavigator::NativeNavigator( const NativeNavigator& other )
+  : Navigator( other ),
+    d_native_model( other.d_native_model ),
+    d_position{other.d_position[0], other.d_position[1], other.d_position[2]},
+    d_direction{other.d_direction[0],
+                other.d_direction[1],
+                other.d_direction[2]},
+    d_cell_index( other.d_cell_index ),
+    d_on_surface_index( other.d_on_surface_index ),
+    d_intersection_surface_index( other.d_intersection_surface_index ),
+    d_distance_to_intersection_surface( other.d_distance_to_intersection_surface ),
+    d_intersection_surface_known( other.d_intersection_surface_known )
+{ /* ... */ }
+
+// Get the point location w.r.t. a given cell
+PointLocation NativeNavigator::getPointLocation(
+                                             const Length position[3],
+                                             const double direction[3],
+                                             const EntityId cell_id ) const
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( direction ) );
+
+  const size_t cell_index = d_native_model->getCellIndex( cell_id );
+
+  TEST_FOR_EXCEPTION( cell_index == NativeModel::s_invalid_index,
+                      NativeGeometryError,
+                      "Cell " << cell_id << " does not exist!" );
+
+  return d_native_model->getPointLocationWithCellIndex(
+                                          Utility::reinterpretAsRaw(position),
+                                          direction,
+                                          cell_index );
+}
+
+// Get the surface normal at a point on the surface
+/*! \details The dot product of the normal and the direction will be
+ * positive defined.
+ */
+void NativeNavigator::getSurfaceNormal( const EntityId surface_id,
+                                        const Length position[3],
+                                        const double direction[3],
+                                        double normal[3] ) const
+{
+  // Make sure that the surface exists
+  testPrecondition( d_native_model->doesSurfaceExist( surface_id ) );
+
+  this->getSurfaceNormalWithSurfaceIndex(
+                          d_native_model->getSurfaceIndex( surface_id ),
+                          Utility::reinterpretAsRaw(position),
+                          direction,
+                          normal );
+}
+
+// Get the surface normal at a point on a surface with a known index
+void NativeNavigator::getSurfaceNormalWithSurfaceIndex(
+                                            const size_t surface_index,
+                                            const double position[3],
+                                            const double direction[3],
+                                            double normal[3] ) const
+{
+  d_native_model->getSurfaceWithIndex( surface_index ).getUnitNormal(
+                                                            position, normal );
+
+  if( normal[0]*direction[0] + normal[1]*direction[1] +
+      normal[2]*direction[2] < 0.0 )
+  {
+    normal[0] = -normal[0];
+    normal[1] = -normal[1];
+    normal[2] = -normal[2];
+  }
+}
+
+// Find the cell that contains a given ray
+auto NativeNavigator::findCellContainingRay( const Length position[3],
+                                             const double direction[3],
+                                             CellIdSet& found_cell_cache ) const
+  -> EntityId
+{
+  // Test the cells in the cache first
+  CellIdSet::const_iterator cell_cache_it, cell_cache_end;
+  cell_cache_it = found_cell_cache.begin();
+  cell_cache_end = found_cell_cache.end();
+
+  while( cell_cache_it != cell_cache_end )
+  {
+    PointLocation test_point_location =
+      this->getPointLocation( position, direction, *cell_cache_it );
+
+    if( test_point_location == POINT_INSIDE_CELL )
+      return *cell_cache_it;
+
+    ++cell_cache_it;
+  }
+
+  // Check all other cells
+  EntityId found_cell =
+    this->findCellContainingRay( position, direction );
+
+  // Add the new cell to the cache
+  found_cell_cache.insert( found_cell );
+
+  return found_cell;
+}
+
+// Find the cell that contains a given ray
+auto NativeNavigator::findCellContainingRay( const Length position[3],
+                                             const double direction[3] ) const
+  -> EntityId
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( direction ) );
+
+  const size_t cell_index =
+    d_native_model->findCellIndexContainingRay(
+                                          Utility::reinterpretAsRaw(position),
+                                          direction );
+
+  TEST_FOR_EXCEPTION( cell_index == NativeModel::s_invalid_index,
+                      NativeGeometryError,
+                      "Could not find the cell that contains the point "
+                      << this->arrayToString( position ) << " in the native "
+                      "model!" );
+
+  return d_native_model->getCellId( cell_index );
+}
+
+// Check if an internal ray has been set
+bool NativeNavigator::isStateSet() const
+{
+  return d_cell_index != NativeModel::s_invalid_index;
+}
+
+// Set the internal ray with unknown starting cell
+void NativeNavigator::setState( const Length x_position,
+                                const Length y_position,
+                                const Length z_position,
+                                const double x_direction,
+                                const double y_direction,
+                                const double z_direction )
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  const Length position[3] = {x_position, y_position, z_position};
+  const double direction[3] = {x_direction, y_direction, z_direction};
+
+  const EntityId cell_id = this->findCellContainingRay( position, direction );
+
+  this->setStateWithCellIndex( x_position, y_position, z_position,
+                               x_direction, y_direction, z_direction,
+                               d_native_model->getCellIndex( cell_id ) );
+}
+
+// Set the internal ray with known starting cell
+void NativeNavigator::setState( const Length x_position,
+                                const Length y_position,
+                                const Length z_position,
+                                const double x_direction,
+                                const double y_direction,
+                                const double z_direction,
+                                const EntityId start_cell )
+{
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+  // Make sure that the cell exists
+  testPrecondition( d_native_model->doesCellExist( start_cell ) );
+
+  this->setStateWithCellIndex( x_position, y_position, z_position,
+                               x_direction, y_direction, z_direction,
+                               d_native_model->getCellIndex( start_cell ) );
+}
+
+// Set the internal ray with a known cell index
+void NativeNavigator::setStateWithCellIndex( const Length x_position,
+                                             const Length y_position,
+                                             const Length z_position,
+                                             const double x_direction,
+                                             const double y_direction,
+                                             const double z_direction,
+                                             const size_t cell_index )
+{
+  d_position[0] = x_position.value();
+  d_position[1] = y_position.value();
+  d_position[2] = z_position.value();
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  d_cell_index = cell_index;
+  d_on_surface_index = NativeModel::s_invalid_index;
+  d_intersection_surface_known = false;
+
+  // Fire the ray so that the intersection data is set
+  Navigator::fireRay();
+}
+
+// Get the internal ray position
+auto NativeNavigator::getPosition() const -> const Length*
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return Utility::reinterpretAsQuantity<Length>( d_position );
+}
+
+// Get the internal ray direction
+const double* NativeNavigator::getDirection() const
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_direction;
+}
+
+// Get the cell that contains the internal ray
+auto NativeNavigator::getCurrentCell() const -> EntityId
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_native_model->getCellId( d_cell_index );
+}
+
+// Get the distance from the internal ray pos. to the nearest boundary in all directions
+auto NativeNavigator::getDistanceToClosestBoundary() -> Length
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return Length::from_value(
+         d_native_model->getDistanceToClosestBoundaryWithCellIndex(
+                                                   d_position, d_cell_index ) );
+}
+
+// Fire the internal ray through the geometry
+/*! \details If the ray does not hit a surface of the current cell,
+ * infinity will be returned and the surface hit will be set to the invalid
+ * surface id.
+ */
+auto NativeNavigator::fireRay( EntityId* surface_hit ) -> Length
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  // Check if the ray has already been fired
+  if( !d_intersection_surface_known )
+  {
+    d_distance_to_intersection_surface =
+      d_native_model->fireRayWithCellIndex( d_position,
+                                            d_direction,
+                                            d_cell_index,
+                                            d_on_surface_index,
+                                            d_intersection_surface_index );
+
+    d_intersection_surface_known = true;
+  }
+
+  if( surface_hit != NULL )
+  {
+    if( d_intersection_surface_index != NativeModel::s_invalid_index )
+    {
+      *surface_hit =
+        d_native_model->getSurfaceId( d_intersection_surface_index );
+    }
+    else
+      *surface_hit = Navigator::invalidSurfaceId();
+  }
+
+  return Length::from_value( d_distance_to_intersection_surface );
+}
+
+// Advance the internal ray to the cell boundary
+/*! \details Upon reaching the boundary the internal ray will enter the
+ * boundary cell if the boundary surface is not a reflecting surface. The
+ * ray will be reflected at the boundary if a reflecting surface is
+ * encountered. This method will return true if a reflecting boundary
+ * was encountered. If the surface normal at the intersection point is
+ * required an array can be passed to the method.
+ */
+bool NativeNavigator::advanceToCellBoundaryImpl( double* surface_normal,
+                                                 Length& distance_traveled )
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+  // Make sure that the intersection surface is known
+  testPrecondition( d_intersection_surface_known );
+
+  TEST_FOR_EXCEPTION( d_intersection_surface_index ==
+                      NativeModel::s_invalid_index,
+                      NativeGeometryError,
+                      "The ray in cell "
+                      << d_native_model->getCellId( d_cell_index ) <<
+                      " cannot be advanced to a boundary because it does not "
+                      "intersect one! Here are the details...\n"
+                      "  Position: " << this->arrayToString( d_position ) <<
+                      "\n  Direction: " << this->arrayToString( d_direction ) );
+
+  bool reflecting_boundary = false;
+
+  const size_t intersection_surface_index = d_intersection_surface_index;
+
+  distance_traveled = Length::from_value( d_distance_to_intersection_surface );
+
+  // Advance the ray to the cell boundary
+  d_position[0] += d_distance_to_intersection_surface*d_direction[0];
+  d_position[1] += d_distance_to_intersection_surface*d_direction[1];
+  d_position[2] += d_distance_to_intersection_surface*d_direction[2];
+
+  d_on_surface_index = intersection_surface_index;
+  d_intersection_surface_known = false;
+
+  double local_surface_normal[3];
+
+  this->getSurfaceNormalWithSurfaceIndex( intersection_surface_index,
+                                          d_position,
+                                          d_direction,
+                                          local_surface_normal );
+
+  if( surface_normal != NULL )
+  {
+    surface_normal[0] = local_surface_normal[0];
+    surface_normal[1] = local_surface_normal[1];
+    surface_normal[2] = local_surface_normal[2];
+  }
+
+  // Reflect the ray if a reflecting surface is encountered
+  if( d_native_model->isReflectingSurfaceIndex( intersection_surface_index ) )
+  {
+    double reflected_direction[3];
+
+    Utility::reflectUnitVector( d_direction,
+                                local_surface_normal,
+                                reflected_direction );
+
+    d_direction[0] = reflected_direction[0];
+    d_direction[1] = reflected_direction[1];
+    d_direction[2] = reflected_direction[2];
+
+    reflecting_boundary = true;
+  }
+  // Pass into the next cell if a normal surface is encountered
+  else
+  {
+    const size_t next_cell_index =
+      d_native_model->findBoundaryCellIndex( d_position,
+                                             d_direction,
+                                             d_cell_index,
+                                             intersection_surface_index );
+
+    TEST_FOR_EXCEPTION( next_cell_index == NativeModel::s_invalid_index,
+                        NativeGeometryError,
+                        "Could not find the cell on the other side of "
+                        "surface "
+                        << d_native_model->getSurfaceId( intersection_surface_index ) <<
+                        " (current cell is "
+                        << d_native_model->getCellId( d_cell_index ) <<
+                        ")! Here are the details...\n"
+                        "  Position: " << this->arrayToString( d_position ) <<
+                        "\n  Direction: "
+                        << this->arrayToString( d_direction ) );
+
+    d_cell_index = next_cell_index;
+  }
+
+  // Fire the ray so that the new intersection data is set
+  Navigator::fireRay();
+
+  return reflecting_boundary;
+}
+
+// Advance the internal ray by a substep (less than distance to boundary)
+/*! \details The substep distance must be less than the distance to the
+ * intersection surface.
+ */
+void NativeNavigator::advanceBySubstepImpl( const Length substep_distance )
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+  // Make sure that the substep distance is valid
+  testPrecondition( substep_distance.value() >= 0.0 );
+
+  if( substep_distance.value() > 0.0 )
+  {
+    d_position[0] += substep_distance.value()*d_direction[0];
+    d_position[1] += substep_distance.value()*d_direction[1];
+    d_position[2] += substep_distance.value()*d_direction[2];
+
+    d_on_surface_index = NativeModel::s_invalid_index;
+
+    if( d_intersection_surface_known )
+      d_distance_to_intersection_surface -= substep_distance.value();
+  }
+}
+
+// Change the internal ray direction
+void NativeNavigator::changeDirection( const double x_direction,
+                                       const double y_direction,
+                                       const double z_direction )
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+  // Make sure that the direction is valid
+  testPrecondition( Utility::isUnitVector( x_direction, y_direction, z_direction ) );
+
+  d_direction[0] = x_direction;
+  d_direction[1] = y_direction;
+  d_direction[2] = z_direction;
+
+  d_intersection_surface_known = false;
+
+  // A ray on a boundary that now points out of the cell crosses the boundary
+  // immediately
+  if( d_on_surface_index != NativeModel::s_invalid_index )
+  {
+    if( d_native_model->getPointLocationWithCellIndex( d_position,
+                                                       d_direction,
+                                                       d_cell_index ) ==
+        POINT_OUTSIDE_CELL )
+    {
+      d_intersection_surface_index = d_on_surface_index;
+      d_distance_to_intersection_surface = 0.0;
+      d_intersection_surface_known = true;
+    }
+  }
+
+  // Fire the ray so that the new intersection data is set
+  Navigator::fireRay();
+}
+
+// Clone the navigator
+NativeNavigator* NativeNavigator::clone(
+               const AdvanceCompleteCallback& advance_complete_callback ) const
+{
+  NativeNavigator* clone_navigator =
+    new NativeNavigator( d_native_model, advance_complete_callback );
+
+  // Copy the internal ray
+  for( unsigned i = 0; i < 3; ++i )
+  {
+    clone_navigator->d_position[i] = d_position[i];
+    clone_navigator->d_direction[i] = d_direction[i];
+  }
+
+  clone_navigator->d_cell_index = d_cell_index;
+  clone_navigator->d_on_surface_index = d_on_surface_index;
+  clone_navigator->d_intersection_surface_index =
+    d_intersection_surface_index;
+  clone_navigator->d_distance_to_intersection_surface =
+    d_distance_to_intersection_surface;
+  clone_navigator->d_intersection_surface_known =
+    d_intersection_surface_known;
+
+  return clone_navigator;
+}
+
+// Clone the navigator
+NativeNavigator* NativeNavigator::clone() const
+{
+  return new NativeNavigator( *this );
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_NativeNavigator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,268 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_QuadricSurface.cpp
+//! \author Alex Robinson
+//! \brief  Quadric surface class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // Must be included first
+#include "Geometry_QuadricSurface.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Default constructor (the x = 0 plane)
+QuadricSurface::QuadricSurface()
+  : QuadricSurface( 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0 )
+{ /* ... */ }
+
+// General surface constructor
+/*! \details The surface is defined by ax^2+by^2+cz^2+dxy+eyz+fxz+gx+hy+jz+k
+ * = 0.
+ */
+QuadricSurface::QuadricSurface( const double a,
+                                const double b,
+                                const double c,
+                                const double d,
+                                const double e,
+                                const double f,
+                                const double g,
+                                const double h,
+                                const double j,
+                                const double k )
+  : d_coefficients{a, b, c, d, e, f, g, h, j, k},
+    d_type( GENERAL_SURFACE ),
+    d_axis( 0 )
+{
+  TEST_FOR_EXCEPTION( a == 0.0 && b == 0.0 && c == 0.0 &&
+                      d == 0.0 && e == 0.0 && f == 0.0 &&
+                      g == 0.0 && h == 0.0 && j == 0.0,
+                      std::runtime_error,
+                      "The surface must have at least one non-constant "
+                      "term!" );
+
+  this->classify();
+}
+
+// Create a general plane (n_x*x + n_y*y + n_z*z - d = 0)
+QuadricSurface QuadricSurface::createPlane( const double n_x,
+                                            const double n_y,
+                                            const double n_z,
+                                            const double d )
+{
+  return QuadricSurface( 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, n_x, n_y, n_z, -d );
+}
+
+// Create a plane normal to the x-axis
+QuadricSurface QuadricSurface::createXPlane( const double x )
+{
+  return QuadricSurface::createPlane( 1.0, 0.0, 0.0, x );
+}
+
+// Create a plane normal to the y-axis
+QuadricSurface QuadricSurface::createYPlane( const double y )
+{
+  return QuadricSurface::createPlane( 0.0, 1.0, 0.0, y );
+}
+
+// Create a plane normal to the z-axis
+QuadricSurface QuadricSurface::createZPlane( const double z )
+{
+  return QuadricSurface::createPlane( 0.0, 0.0, 1.0, z );
+}
+
+// Create a sphere
+/*! \details Points inside of the sphere have a negative sense.
+ */
+QuadricSurface QuadricSurface::createSphere( const double x,
+                                             const double y,
+                                             const double z,
+                                             const double radius )
+{
+  // Make sure that the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return QuadricSurface( 1.0, 1.0, 1.0, 0.0, 0.0, 0.0,
+                         -2.0*x, -2.0*y, -2.0*z,
+                         x*x + y*y + z*z - radius*radius );
+}
+
+// Create a cylinder parallel to the x-axis
+/*! \details Points inside of the cylinder have a negative sense.
+ */
+QuadricSurface QuadricSurface::createXCylinder( const double y,
+                                                const double z,
+                                                const double radius )
+{
+  // Make sure that the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return QuadricSurface( 0.0, 1.0, 1.0, 0.0, 0.0, 0.0,
+                         0.0, -2.0*y, -2.0*z,
+                         y*y + z*z - radius*radius );
+}
+
+// Create a cylinder parallel to the y-axis
+/*! \details Points inside of the cylinder have a negative sense.
+ */
+QuadricSurface QuadricSurface::createYCylinder( const double x,
+                                                const double z,
+                                                const double radius )
+{
+  // Make sure that the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return QuadricSurface( 1.0, 0.0, 1.0, 0.0, 0.0, 0.0,
+                         -2.0*x, 0.0, -2.0*z,
+                         x*x + z*z - radius*radius );
+}
+
+// Create a cylinder parallel to the z-axis
+/*! \details Points inside of the cylinder have a negative sense.
+ */
+QuadricSurface QuadricSurface::createZCylinder( const double x,
+                                                const double y,
+                                                const double radius )
+{
+  // Make sure that the radius is valid
+  testPrecondition( radius > 0.0 );
+
+  return QuadricSurface( 1.0, 1.0, 0.0, 0.0, 0.0, 0.0,
+                         -2.0*x, -2.0*y, 0.0,
+                         x*x + y*y - radius*radius );
+}
+
+// Return the unit normal at a point on the surface (positive side)
+void QuadricSurface::getUnitNormal( const double position[3],
+                                    double normal[3] ) const
+{
+  this->evaluateGradient( position, normal );
+
+  const double norm = std::sqrt( normal[0]*normal[0] +
+                                 normal[1]*normal[1] +
+                                 normal[2]*normal[2] );
+
+  // Make sure that the normal is defined at the point
+  testPostcondition( norm > 0.0 );
+
+  normal[0] /= norm;
+  normal[1] /= norm;
+  normal[2] /= norm;
+}
+
+// Return the distance to the surface in any direction
+/*! \details The distance is exact for planes, spheres and axis-aligned
+ * cylinders. The first order estimate of the distance (the surface equation
+ * value divided by the gradient norm) is returned for all other surfaces.
+ */
+double QuadricSurface::getDistanceToClosestPoint(
+                                             const double position[3] ) const
+{
+  switch( d_type )
+  {
+  case SPHERE_SURFACE:
+  {
+    const double a = d_coefficients[0];
+
+    double squared_distance_to_center = 0.0;
+    double squared_center_norm = 0.0;
+
+    for( unsigned i = 0; i < 3; ++i )
+    {
+      const double center = -d_coefficients[6+i]/(2.0*a);
+
+      squared_distance_to_center +=
+        (position[i] - center)*(position[i] - center);
+      squared_center_norm += center*center;
+    }
+
+    const double radius =
+      std::sqrt( squared_center_norm - d_coefficients[9]/a );
+
+    return std::fabs( std::sqrt( squared_distance_to_center ) - radius );
+  }
+
+  case CYLINDER_SURFACE:
+  {
+    const double a = d_coefficients[(d_axis+1)%3];
+
+    double squared_distance_to_axis = 0.0;
+    double squared_center_norm = 0.0;
+
+    for( unsigned i = 0; i < 3; ++i )
+    {
+      if( i == d_axis )
+        continue;
+
+      const double center = -d_coefficients[6+i]/(2.0*a);
+
+      squared_distance_to_axis +=
+        (position[i] - center)*(position[i] - center);
+      squared_center_norm += center*center;
+    }
+
+    const double radius =
+      std::sqrt( squared_center_norm - d_coefficients[9]/a );
+
+    return std::fabs( std::sqrt( squared_distance_to_axis ) - radius );
+  }
+
+  default:
+  {
+    double gradient[3];
+
+    this->evaluateGradient( position, gradient );
+
+    const double gradient_norm = std::sqrt( gradient[0]*gradient[0] +
+                                            gradient[1]*gradient[1] +
+                                            gradient[2]*gradient[2] );
+
+    if( gradient_norm > 0.0 )
+      return std::fabs( this->evaluate( position ) )/gradient_norm;
+    else
+      return 0.0;
+  }
+  }
+}
+
+// Classify the surface
+void QuadricSurface::classify()
+{
+  const double* c = d_coefficients;
+
+  d_type = GENERAL_SURFACE;
+  d_axis = 0;
+
+  // No cross terms
+  if( c[3] == 0.0 && c[4] == 0.0 && c[5] == 0.0 )
+  {
+    if( c[0] == 0.0 && c[1] == 0.0 && c[2] == 0.0 )
+      d_type = PLANE_SURFACE;
+    else if( c[0] == c[1] && c[1] == c[2] )
+      d_type = SPHERE_SURFACE;
+    else
+    {
+      for( unsigned i = 0; i < 3; ++i )
+      {
+        const unsigned j = (i+1)%3, k = (i+2)%3;
+
+        if( c[i] == 0.0 && c[6+i] == 0.0 && c[j] != 0.0 && c[j] == c[k] )
+        {
+          d_type = CYLINDER_SURFACE;
+          d_axis = i;
+        }
+      }
+    }
+  }
+}
+
+EXPLICIT_CLASS_SAVE_LOAD_INST( QuadricSurface );
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_QuadricSurface.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,321 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_QuadricSurface.hpp
+//! \author Alex Robinson
+//! \brief  Quadric surface class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_QUADRIC_SURFACE_HPP
+#define GEOMETRY_QUADRIC_SURFACE_HPP
+
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// Boost Includes
+#include <boost/serialization/array.hpp>
+
+// FRENSIE Includes
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+
+namespace Geometry{
+
+/*! The quadric surface class
+ *
+ * The surface is defined by the general second order equation
+ * ax^2+by^2+cz^2+dxy+eyz+fxz+gx+hy+jz+k = 0 (the same definition that is
+ * used by the legacy Geometry::Surface class). A point is on the positive
+ * side of the surface if the surface equation evaluates to a positive value.
+ * This class is a simple value type with no virtual functions so that the
+ * surfaces of a cell can be stored contiguously and the distance to every
+ * surface can be calculated without any dispatch overhead.
+ */
+class QuadricSurface
+{
+
+public:
+
+  //! Default constructor (the x = 0 plane)
+  QuadricSurface();
+
+  //! General surface constructor
+  QuadricSurface( const double a,
+                  const double b,
+                  const double c,
+                  const double d,
+                  const double e,
+                  const double f,
+                  const double g,
+                  const double h,
+                  const double j,
+                  const double k );
+
+  //! Destructor
+  ~QuadricSurface()
+  { /* ... */ }
+
+  //! Create a general plane (n_x*x + n_y*y + n_z*z - d = 0)
+  static QuadricSurface createPlane( const double n_x,
+                                     const double n_y,
+                                     const double n_z,
+                                     const double d );
+
+  //! Create a plane normal to the x-axis
+  static QuadricSurface createXPlane( const double x );
+
+  //! Create a plane normal to the y-axis
+  static QuadricSurface createYPlane( const double y );
+
+  //! Create a plane normal to the z-axis
+  static QuadricSurface createZPlane( const double z );
+
+  //! Create a sphere
+  static QuadricSurface createSphere( const double x,
+                                      const double y,
+                                      const double z,
+                                      const double radius );
+
+  //! Create a cylinder parallel to the x-axis
+  static QuadricSurface createXCylinder( const double y,
+                                         const double z,
+                                         const double radius );
+
+  //! Create a cylinder parallel to the y-axis
+  static QuadricSurface createYCylinder( const double x,
+                                         const double z,
+                                         const double radius );
+
+  //! Create a cylinder parallel to the z-axis
+  static QuadricSurface createZCylinder( const double x,
+                                         const double y,
+                                         const double radius );
+
+  //! Check if the surface is planar
+  bool isPlanar() const;
+
+  //! Return the surface coefficients (a,b,c,d,e,f,g,h,j,k)
+  const double* getCoefficients() const;
+
+  //! Evaluate the surface equation at a point
+  double evaluate( const double position[3] ) const;
+
+  //! Evaluate the surface equation gradient at a point
+  void evaluateGradient( const double position[3],
+                         double gradient[3] ) const;
+
+  //! Return the sense of a point w.r.t. the surface (-1 or +1)
+  int getSense( const double position[3],
+                const double direction[3],
+                const double tolerance ) const;
+
+  //! Return the unit normal at a point on the surface (positive side)
+  void getUnitNormal( const double position[3], double normal[3] ) const;
+
+  //! Return the distance to the surface along a direction
+  double getDistance( const double position[3],
+                      const double direction[3],
+                      const bool on_surface ) const;
+
+  //! Return the distance to the surface in any direction
+  double getDistanceToClosestPoint( const double position[3] ) const;
+
+private:
+
+  // The surface types
+  enum Type{
+    GENERAL_SURFACE = 0,
+    PLANE_SURFACE,
+    SPHERE_SURFACE,
+    CYLINDER_SURFACE
+  };
+
+  // Classify the surface
+  void classify();
+
+  // Save the surface to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the surface from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The surface coefficients
+  double d_coefficients[10];
+
+  // The surface type (used for the closest point distance)
+  Type d_type;
+
+  // The cylinder axis (only used with cylinders)
+  unsigned d_axis;
+};
+
+// Check if the surface is planar
+inline bool QuadricSurface::isPlanar() const
+{
+  return d_type == PLANE_SURFACE;
+}
+
+// Return the surface coefficients (a,b,c,d,e,f,g,h,j,k)
+inline const double* QuadricSurface::getCoefficients() const
+{
+  return d_coefficients;
+}
+
+// Evaluate the surface equation at a point
+inline double QuadricSurface::evaluate( const double position[3] ) const
+{
+  const double x = position[0], y = position[1], z = position[2];
+
+  return x*(d_coefficients[0]*x + d_coefficients[3]*y +
+            d_coefficients[5]*z + d_coefficients[6]) +
+    y*(d_coefficients[1]*y + d_coefficients[4]*z + d_coefficients[7]) +
+    z*(d_coefficients[2]*z + d_coefficients[8]) + d_coefficients[9];
+}
+
+// Evaluate the surface equation gradient at a point
+inline void QuadricSurface::evaluateGradient( const double position[3],
+                                              double gradient[3] ) const
+{
+  const double x = position[0], y = position[1], z = position[2];
+
+  gradient[0] = 2.0*d_coefficients[0]*x + d_coefficients[3]*y +
+    d_coefficients[5]*z + d_coefficients[6];
+  gradient[1] = 2.0*d_coefficients[1]*y + d_coefficients[3]*x +
+    d_coefficients[4]*z + d_coefficients[7];
+  gradient[2] = 2.0*d_coefficients[2]*z + d_coefficients[4]*y +
+    d_coefficients[5]*x + d_coefficients[8];
+}
+
+// Return the sense of a point w.r.t. the surface (-1 or +1)
+/*! \details If the point is within the tolerance of the surface the
+ * direction will be used to determine the sense (the side of the surface
+ * that the direction points to).
+ */
+inline int QuadricSurface::getSense( const double position[3],
+                                     const double direction[3],
+                                     const double tolerance ) const
+{
+  const double value = this->evaluate( position );
+
+  double gradient[3];
+
+  this->evaluateGradient( position, gradient );
+
+  const double gradient_norm = std::sqrt( gradient[0]*gradient[0] +
+                                          gradient[1]*gradient[1] +
+                                          gradient[2]*gradient[2] );
+
+  // The first order estimate of the distance to the surface is used to
+  // determine if the point is on the surface
+  if( std::fabs( value ) <= tolerance*gradient_norm )
+  {
+    const double projection = gradient[0]*direction[0] +
+      gradient[1]*direction[1] + gradient[2]*direction[2];
+
+    if( projection != 0.0 )
+      return (projection > 0.0 ? 1 : -1);
+  }
+
+  return (value >= 0.0 ? 1 : -1);
+}
+
+// Return the distance to the surface along a direction
+/*! \details If the point is on the surface the zero root of the
+ * intersection equation will be ignored. If the surface is not hit
+ * infinity will be returned.
+ */
+inline double QuadricSurface::getDistance( const double position[3],
+                                           const double direction[3],
+                                           const bool on_surface ) const
+{
+  const double u = direction[0], v = direction[1], w = direction[2];
+
+  double gradient[3];
+
+  this->evaluateGradient( position, gradient );
+
+  // Intersection equation: A*t^2 + B*t + C = 0
+  const double A = u*(d_coefficients[0]*u + d_coefficients[3]*v +
+                      d_coefficients[5]*w) +
+    v*(d_coefficients[1]*v + d_coefficients[4]*w) + d_coefficients[2]*w*w;
+
+  const double B = gradient[0]*u + gradient[1]*v + gradient[2]*w;
+
+  const double C = (on_surface ? 0.0 : this->evaluate( position ));
+
+  const double inf = std::numeric_limits<double>::infinity();
+
+  if( A == 0.0 )
+  {
+    if( B == 0.0 )
+      return inf;
+
+    const double t = -C/B;
+
+    return (t > 0.0 ? t : inf);
+  }
+
+  if( on_surface )
+  {
+    const double t = -B/A;
+
+    return (t > 0.0 ? t : inf);
+  }
+
+  const double discriminant = B*B - 4.0*A*C;
+
+  if( discriminant < 0.0 )
+    return inf;
+
+  // Use the numerically stable form of the roots
+  const double q = -0.5*(B + std::copysign( std::sqrt( discriminant ), B ));
+
+  double t_1 = q/A;
+  double t_2 = (q != 0.0 ? C/q : t_1);
+
+  if( t_1 > t_2 )
+    std::swap( t_1, t_2 );
+
+  if( t_1 > 0.0 )
+    return t_1;
+  else if( t_2 > 0.0 )
+    return t_2;
+  else
+    return inf;
+}
+
+// Save the surface to an archive
+template<typename Archive>
+void QuadricSurface::save( Archive& ar, const unsigned version ) const
+{
+  ar & boost::serialization::make_nvp( "d_coefficients", d_coefficients );
+}
+
+// Load the surface from an archive
+template<typename Archive>
+void QuadricSurface::load( Archive& ar, const unsigned version )
+{
+  ar & boost::serialization::make_nvp( "d_coefficients", d_coefficients );
+
+  this->classify();
+}
+
+} // end Geometry namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( QuadricSurface, Geometry, 0 );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry, QuadricSurface );
+
+#endif // end GEOMETRY_QUADRIC_SURFACE_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_QuadricSurface.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,127 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeCellDefinition.cpp
+//! \author Alex Robinson
+//! \brief  Native cell definition class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "Geometry_NativeCellDefinition.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a definition can be constructed
+FRENSIE_UNIT_TEST( NativeCellDefinition, constructor )
+{
+  FRENSIE_CHECK_NO_THROW( Geometry::NativeCellDefinition( "-1 n 2 n -3" ) );
+  FRENSIE_CHECK_NO_THROW( Geometry::NativeCellDefinition( "-1 2 (-3 u 4)" ) );
+  FRENSIE_CHECK_NO_THROW( Geometry::NativeCellDefinition( "-2 n -5 n 3 n ( 4 n 5 n (8 u 9) u (10 u -11) n 6 )" ) );
+
+  // Invalid definitions
+  FRENSIE_CHECK_THROW( Geometry::NativeCellDefinition( "-1 n" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Geometry::NativeCellDefinition( "n -1" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Geometry::NativeCellDefinition( "-1 n n 2" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Geometry::NativeCellDefinition( "-1 n ( 2 u 3" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Geometry::NativeCellDefinition( "-1 n 2 u 3 )" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Geometry::NativeCellDefinition( "-1 n ()" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Geometry::NativeCellDefinition( "-1 x 2" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( Geometry::NativeCellDefinition( "0 n 2" ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface ids can be returned
+FRENSIE_UNIT_TEST( NativeCellDefinition, getSurfaceIds )
+{
+  Geometry::NativeCellDefinition definition( "-3 n 1 n (3 u -7) n 1" );
+
+  FRENSIE_CHECK_EQUAL( definition.getDefinition(), "-3 n 1 n (3 u -7) n 1" );
+  FRENSIE_CHECK_EQUAL( definition.getSurfaceIds(),
+                       std::vector<Geometry::NativeCellDefinition::EntityId>( {3, 1, 7} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a definition is simple
+FRENSIE_UNIT_TEST( NativeCellDefinition, isSimple )
+{
+  FRENSIE_CHECK( Geometry::NativeCellDefinition( "-1 n 2 n -3" ).isSimple() );
+  FRENSIE_CHECK( Geometry::NativeCellDefinition( "-1 2 (-3 4)" ).isSimple() );
+  FRENSIE_CHECK( !Geometry::NativeCellDefinition( "-1 u 2" ).isSimple() );
+  FRENSIE_CHECK( !Geometry::NativeCellDefinition( "-1 n 1" ).isSimple() );
+
+  FRENSIE_CHECK_EQUAL( Geometry::NativeCellDefinition( "-1 n 2 n -3" ).getSimpleDefinitionSenses(),
+                       std::vector<int>( {-1, 1, -1} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a definition can be evaluated
+FRENSIE_UNIT_TEST( NativeCellDefinition, evaluate )
+{
+  Geometry::NativeCellDefinition simple_definition( "-1 n 2 n -3" );
+
+  int senses[4] = {-1, 1, -1, 0};
+
+  FRENSIE_CHECK( simple_definition.evaluate( senses ) );
+
+  senses[1] = -1;
+
+  FRENSIE_CHECK( !simple_definition.evaluate( senses ) );
+
+  // Operators are evaluated from left to right
+  Geometry::NativeCellDefinition definition( "-1 u 2 n -3" );
+
+  senses[0] = -1; senses[1] = -1; senses[2] = 1;
+
+  FRENSIE_CHECK( !definition.evaluate( senses ) );
+
+  senses[2] = -1;
+
+  FRENSIE_CHECK( definition.evaluate( senses ) );
+
+  senses[0] = 1; senses[1] = 1;
+
+  FRENSIE_CHECK( definition.evaluate( senses ) );
+
+  // Parentheses
+  Geometry::NativeCellDefinition nested_definition( "-1 u (2 n -3)" );
+
+  senses[0] = -1; senses[1] = -1; senses[2] = 1;
+
+  FRENSIE_CHECK( nested_definition.evaluate( senses ) );
+
+  senses[0] = 1;
+
+  FRENSIE_CHECK( !nested_definition.evaluate( senses ) );
+
+  senses[1] = 1; senses[2] = -1;
+
+  FRENSIE_CHECK( nested_definition.evaluate( senses ) );
+
+  // Implicit intersection
+  Geometry::NativeCellDefinition implicit_definition( "-1 (2 u -3) 4" );
+
+  senses[0] = -1; senses[1] = -1; senses[2] = -1; senses[3] = 1;
+
+  FRENSIE_CHECK( implicit_definition.evaluate( senses ) );
+
+  senses[3] = -1;
+
+  FRENSIE_CHECK( !implicit_definition.evaluate( senses ) );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNativeCellDefinition.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,390 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeModel.cpp
+//! \author Alex Robinson
+//! \brief  Native model class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "Geometry_NativeModel.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+// A sphere (cell 1) inside of a box (cell 2) inside of a sphere (cell 3)
+std::shared_ptr<Geometry::NativeModel> model;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the test model
+std::shared_ptr<Geometry::NativeModel> createTestModel()
+{
+  std::shared_ptr<Geometry::NativeModel>
+    test_model( new Geometry::NativeModel( "test" ) );
+
+  test_model->addSurface( 1, Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 1.0 ) );
+  test_model->addSurface( 2, Geometry::QuadricSurface::createXPlane( -2.0 ) );
+  test_model->addSurface( 3, Geometry::QuadricSurface::createXPlane( 2.0 ) );
+  test_model->addSurface( 4, Geometry::QuadricSurface::createYPlane( -2.0 ) );
+  test_model->addSurface( 5, Geometry::QuadricSurface::createYPlane( 2.0 ) );
+  test_model->addSurface( 6, Geometry::QuadricSurface::createZPlane( -2.0 ) );
+  test_model->addSurface( 7, Geometry::QuadricSurface::createZPlane( 2.0 ) );
+  test_model->addSurface( 8, Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 10.0 ) );
+
+  test_model->addCell( 1, "-1" );
+  test_model->addCell( 2, "1 n 2 n -3 n 4 n -5 n 6 n -7" );
+  test_model->addCell( 3, "-8 n (-2 u 3 u -4 u 5 u -6 u 7)" );
+  test_model->addCell( 4, "8" );
+
+  test_model->setCellMaterial( 1, 1, 1.0*Geometry::Model::DensityUnit() );
+  test_model->setCellMaterial( 2, 2, 2.0*Geometry::Model::DensityUnit() );
+  test_model->setTerminationCell( 4 );
+  test_model->setReflectingSurface( 7 );
+
+  Geometry::Model::Length lower_bounds[3] =
+    {-1.0*boost::units::cgs::centimeter,
+     -1.0*boost::units::cgs::centimeter,
+     -1.0*boost::units::cgs::centimeter};
+
+  Geometry::Model::Length upper_bounds[3] =
+    {1.0*boost::units::cgs::centimeter,
+     1.0*boost::units::cgs::centimeter,
+     1.0*boost::units::cgs::centimeter};
+
+  test_model->setCellBoundingBox( 1, lower_bounds, upper_bounds );
+  test_model->setCellVolume( 1, 4.0/3*M_PI*Geometry::Model::VolumeUnit() );
+  test_model->setSurfaceArea( 1, 4.0*M_PI*Geometry::AdvancedModel::AreaUnit() );
+
+  test_model->addCellEstimator( 0,
+                                Geometry::CELL_TRACK_LENGTH_FLUX_ESTIMATOR,
+                                Geometry::NEUTRON,
+                                Geometry::Model::CellIdArray( {1, 2} ) );
+  test_model->addSurfaceEstimator( 1,
+                                   Geometry::SURFACE_CURRENT_ESTIMATOR,
+                                   Geometry::PHOTON,
+                                   Geometry::AdvancedModel::SurfaceIdArray( {1} ) );
+
+  return test_model;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the model name can be returned
+FRENSIE_UNIT_TEST( NativeModel, getName )
+{
+  FRENSIE_CHECK_EQUAL( model->getName(), "test" );
+  FRENSIE_CHECK_EQUAL( Geometry::NativeModel().getName(), "native" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid entities are rejected
+FRENSIE_UNIT_TEST( NativeModel, invalid_entities )
+{
+  Geometry::NativeModel test_model;
+
+  test_model.addSurface( 1, Geometry::QuadricSurface::createXPlane( 0.0 ) );
+
+  // Duplicate surface
+  FRENSIE_CHECK_THROW( test_model.addSurface( 1, Geometry::QuadricSurface::createXPlane( 1.0 ) ),
+                       Geometry::InvalidNativeGeometry );
+
+  // Unknown surface
+  FRENSIE_CHECK_THROW( test_model.addCell( 1, "-1 n 2" ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK( !test_model.doesCellExist( 1 ) );
+
+  // Invalid definition
+  FRENSIE_CHECK_THROW( test_model.addCell( 1, "-1 n" ),
+                       Geometry::InvalidNativeGeometry );
+
+  test_model.addCell( 1, "-1" );
+
+  // Duplicate cell
+  FRENSIE_CHECK_THROW( test_model.addCell( 1, "1" ),
+                       Geometry::InvalidNativeGeometry );
+
+  // Unknown cell or surface properties
+  FRENSIE_CHECK_THROW( test_model.setTerminationCell( 2 ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( test_model.setReflectingSurface( 2 ),
+                       Geometry::InvalidNativeGeometry );
+
+  // Unset volume and area
+  FRENSIE_CHECK_THROW( test_model.getCellVolume( 1 ),
+                       Geometry::InvalidNativeGeometry );
+  FRENSIE_CHECK_THROW( test_model.getSurfaceArea( 1 ),
+                       Geometry::InvalidNativeGeometry );
+
+  // Invalid estimator type
+  FRENSIE_CHECK_THROW( test_model.addCellEstimator( 0, Geometry::SURFACE_FLUX_ESTIMATOR, Geometry::NEUTRON, Geometry::Model::CellIdArray( {1} ) ),
+                       Geometry::InvalidNativeGeometry );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the model has cell estimator data
+FRENSIE_UNIT_TEST( NativeModel, hasCellEstimatorData )
+{
+  FRENSIE_CHECK( model->hasCellEstimatorData() );
+  FRENSIE_CHECK( !Geometry::NativeModel().hasCellEstimatorData() );
+}
+
+//---------------------------------------------------------------------------//
+// Check if the model has surface estimator data
+FRENSIE_UNIT_TEST( NativeModel, hasSurfaceEstimatorData )
+{
+  FRENSIE_CHECK( model->hasSurfaceEstimatorData() );
+  FRENSIE_CHECK( !Geometry::NativeModel().hasSurfaceEstimatorData() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the material ids can be returned
+FRENSIE_UNIT_TEST( NativeModel, getMaterialIds )
+{
+  Geometry::Model::MaterialIdSet material_ids;
+
+  model->getMaterialIds( material_ids );
+
+  FRENSIE_CHECK_EQUAL( material_ids, Geometry::Model::MaterialIdSet( {1, 2} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cells can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCells )
+{
+  Geometry::Model::CellIdSet cells;
+
+  model->getCells( cells, true, true );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 3, 4} ) );
+
+  cells.clear();
+
+  model->getCells( cells, false, true );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 4} ) );
+
+  cells.clear();
+
+  model->getCells( cells, true, false );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2, 3} ) );
+
+  cells.clear();
+
+  model->getCells( cells, false, false );
+
+  FRENSIE_CHECK_EQUAL( cells, Geometry::Model::CellIdSet( {1, 2} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell material ids and densities can be returned
+FRENSIE_UNIT_TEST( NativeModel, getCellMaterialIds_getCellDensities )
+{
+  Geometry::Model::CellIdMatIdMap cell_id_mat_id_map;
+
+  model->getCellMaterialIds( cell_id_mat_id_map );
+
+  FRENSIE_REQUIRE_EQUAL( cell_id_mat_id_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map[1], 1 );
+  FRENSIE_CHECK_EQUAL( cell_id_mat_id_map[2], 2 );
+
+  Geometry::Model::CellIdDensityMap cell_id_density_map;
+
+  model->getCellDensities( cell_id_density_map );
+
+  FRENSIE_REQUIRE_EQUAL( cell_id_density_map.size(), 2 );
+  FRENSIE_CHECK_EQUAL( cell_id_density_map[1],
+                       1.0*Geometry::Model::DensityUnit() );
+  FRENSIE_CHECK_EQUAL( cell_id_density_map[2],
+                       2.0*Geometry::Model::DensityUnit() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the estimator data can be returned
+FRENSIE_UNIT_TEST( NativeModel, getEstimatorData )
+{
+  Geometry::Model::CellEstimatorIdDataMap cell_estimator_data;
+
+  model->getCellEstimatorData( cell_estimator_data );
+
+  FRENSIE_REQUIRE_EQUAL( cell_estimator_data.size(), 1 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( cell_estimator_data[0] ),
+                       Geometry::CELL_TRACK_LENGTH_FLUX_ESTIMATOR );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>( cell_estimator_data[0] ),
+                       Geometry::NEUTRON );
+  FRENSIE_CHECK_EQUAL( Utility::get<2>( cell_estimator_data[0] ),
+                       Geometry::Model::CellIdArray( {1, 2} ) );
+
+  Geometry::AdvancedModel::SurfaceEstimatorIdDataMap surface_estimator_data;
+
+  model->getSurfaceEstimatorData( surface_estimator_data );
+
+  FRENSIE_REQUIRE_EQUAL( surface_estimator_data.size(), 1 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>( surface_estimator_data[1] ),
+                       Geometry::SURFACE_CURRENT_ESTIMATOR );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>( surface_estimator_data[1] ),
+                       Geometry::PHOTON );
+  FRENSIE_CHECK_EQUAL( Utility::get<2>( surface_estimator_data[1] ),
+                       Geometry::AdvancedModel::SurfaceIdArray( {1} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check the cell properties
+FRENSIE_UNIT_TEST( NativeModel, cell_properties )
+{
+  FRENSIE_CHECK( model->doesCellExist( 1 ) );
+  FRENSIE_CHECK( model->doesCellExist( 4 ) );
+  FRENSIE_CHECK( !model->doesCellExist( 5 ) );
+
+  FRENSIE_CHECK( !model->isTerminationCell( 1 ) );
+  FRENSIE_CHECK( model->isTerminationCell( 4 ) );
+
+  FRENSIE_CHECK( !model->isVoidCell( 1 ) );
+  FRENSIE_CHECK( model->isVoidCell( 3 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getCellVolume( 1 ),
+                                   4.0/3*M_PI*Geometry::Model::VolumeUnit(),
+                                   1e-15 );
+
+  FRENSIE_CHECK_EQUAL( model->getCellDefinition( 3 ).getDefinition(),
+                       "-8 n (-2 u 3 u -4 u 5 u -6 u 7)" );
+}
+
+//---------------------------------------------------------------------------//
+// Check the surface properties
+FRENSIE_UNIT_TEST( NativeModel, surface_properties )
+{
+  Geometry::AdvancedModel::SurfaceIdSet surfaces;
+
+  model->getSurfaces( surfaces );
+
+  FRENSIE_CHECK_EQUAL( surfaces, Geometry::AdvancedModel::SurfaceIdSet( {1, 2, 3, 4, 5, 6, 7, 8} ) );
+
+  FRENSIE_CHECK( model->doesSurfaceExist( 8 ) );
+  FRENSIE_CHECK( !model->doesSurfaceExist( 9 ) );
+
+  FRENSIE_CHECK( model->isReflectingSurface( 7 ) );
+  FRENSIE_CHECK( !model->isReflectingSurface( 1 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( model->getSurfaceArea( 1 ),
+                                   4.0*M_PI*Geometry::AdvancedModel::AreaUnit(),
+                                   1e-15 );
+
+  FRENSIE_CHECK( model->getSurface( 1 ).getCoefficients()[0] == 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model is initialized
+FRENSIE_UNIT_TEST( NativeModel, isInitialized )
+{
+  FRENSIE_CHECK( model->isInitialized() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a navigator can be created
+FRENSIE_UNIT_TEST( NativeModel, createNavigator )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  FRENSIE_CHECK( navigator.get() != NULL );
+
+  navigator = model->createNavigator( [](const Geometry::Navigator::Length distance){ std::cout << "advanced " << distance << std::endl; } );
+
+  FRENSIE_CHECK( navigator.get() != NULL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the model can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( NativeModel, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_native_model" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<Geometry::Model> shared_model = createTestModel();
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( shared_model ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived model
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<Geometry::Model> shared_model;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( shared_model ) );
+
+  FRENSIE_CHECK_EQUAL( shared_model->getName(), "test" );
+  FRENSIE_CHECK( shared_model->isInitialized() );
+  FRENSIE_CHECK( shared_model->isAdvanced() );
+  FRENSIE_CHECK( shared_model->doesCellExist( 3 ) );
+  FRENSIE_CHECK( shared_model->isTerminationCell( 4 ) );
+  FRENSIE_CHECK( shared_model->isVoidCell( 3 ) );
+  FRENSIE_CHECK( shared_model->hasCellEstimatorData() );
+
+  std::shared_ptr<Geometry::AdvancedModel> advanced_model =
+    std::dynamic_pointer_cast<Geometry::AdvancedModel>( shared_model );
+
+  FRENSIE_REQUIRE( advanced_model.get() != NULL );
+  FRENSIE_CHECK( advanced_model->isReflectingSurface( 7 ) );
+  FRENSIE_CHECK( advanced_model->hasSurfaceEstimatorData() );
+
+  // The rebuilt model must be navigable
+  std::shared_ptr<Geometry::Navigator> navigator =
+    shared_model->createNavigator();
+
+  navigator->setState( 0.0*boost::units::cgs::centimeter,
+                       0.0*boost::units::cgs::centimeter,
+                       0.0*boost::units::cgs::centimeter,
+                       1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(),
+                                   1.0*boost::units::cgs::centimeter,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  model = createTestModel();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstNativeModel.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,395 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNativeNavigator.cpp
+//! \author Alex Robinson
+//! \brief  Native navigator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_NativeModel.hpp"
+#include "Geometry_NativeNavigator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+// A sphere (cell 1) inside of a box (cell 2) inside of a sphere (cell 3)
+std::shared_ptr<const Geometry::NativeModel> model;
+
+// The centimeter unit
+const Geometry::Navigator::Length cm = 1.0*boost::units::cgs::centimeter;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the point location w.r.t. a cell can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getPointLocation )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  Geometry::Navigator::Length position[3] = {0.5*cm, 0.0*cm, 0.0*cm};
+  double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 1 ),
+                       Geometry::POINT_INSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 2 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+
+  // The direction is used on a boundary
+  position[0] = 1.0*cm;
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 1 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 2 ),
+                       Geometry::POINT_INSIDE_CELL );
+
+  direction[0] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 1 ),
+                       Geometry::POINT_INSIDE_CELL );
+
+  // Cell with unions
+  position[0] = 5.0*cm;
+
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 3 ),
+                       Geometry::POINT_INSIDE_CELL );
+  FRENSIE_CHECK_EQUAL( navigator->getPointLocation( position, direction, 2 ),
+                       Geometry::POINT_OUTSIDE_CELL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface normal can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getSurfaceNormal )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  Geometry::Navigator::Length position[3] = {0.0*cm, 1.0*cm, 0.0*cm};
+  double direction[3] = {0.0, 1.0, 0.0};
+  double normal[3];
+
+  navigator->getSurfaceNormal( 1, position, direction, normal );
+
+  FRENSIE_CHECK_SMALL( normal[0], 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], 1.0, 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[2], 1e-15 );
+
+  // The normal is oriented with the direction
+  direction[1] = -1.0;
+
+  navigator->getSurfaceNormal( 1, position, direction, normal );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], -1.0, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell containing a ray can be found
+FRENSIE_UNIT_TEST( NativeNavigator, findCellContainingRay )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  Geometry::Navigator::Length position[3] = {0.0*cm, 0.0*cm, 0.0*cm};
+  double direction[3] = {0.0, 0.0, 1.0};
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction ), 1 );
+
+  position[2] = 1.5*cm;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction ), 2 );
+
+  position[2] = 5.0*cm;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction ), 3 );
+
+  position[2] = 15.0*cm;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction ), 4 );
+
+  // Use a cache
+  Geometry::Navigator::CellIdSet found_cell_cache;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction, found_cell_cache ), 4 );
+  FRENSIE_CHECK_EQUAL( found_cell_cache.size(), 1 );
+
+  position[2] = 0.0*cm;
+
+  FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( position, direction, found_cell_cache ), 1 );
+  FRENSIE_CHECK_EQUAL( found_cell_cache.size(), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be set
+FRENSIE_UNIT_TEST( NativeNavigator, setState )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  FRENSIE_CHECK( !navigator->isStateSet() );
+
+  navigator->setState( 1.5*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK( navigator->isStateSet() );
+  FRENSIE_CHECK_EQUAL( navigator->getPosition()[0], 1.5*cm );
+  FRENSIE_CHECK_EQUAL( navigator->getPosition()[1], 0.0*cm );
+  FRENSIE_CHECK_EQUAL( navigator->getPosition()[2], 0.0*cm );
+  FRENSIE_CHECK_EQUAL( navigator->getDirection()[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( navigator->getDirection()[1], 0.0 );
+  FRENSIE_CHECK_EQUAL( navigator->getDirection()[2], 0.0 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+
+  navigator->setState( 0.0*cm, 0.0*cm, 0.0*cm, 0.0, 0.0, 1.0, 1 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the closest boundary can be returned
+FRENSIE_UNIT_TEST( NativeNavigator, getDistanceToClosestBoundary )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.25*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDistanceToClosestBoundary(),
+                                   0.75*cm,
+                                   1e-15 );
+
+  navigator->setState( 1.75*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDistanceToClosestBoundary(),
+                                   0.25*cm,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be fired
+FRENSIE_UNIT_TEST( NativeNavigator, fireRay )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.0*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   1.0*cm,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 1 );
+
+  navigator->setState( 3.0*cm, 0.0*cm, 0.0*cm, -1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   1.0*cm,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 3 );
+
+  // The ray crosses internal surfaces of a cell with unions
+  navigator->setState( -5.0*cm, 3.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay( &surface_hit ),
+                                   (5.0 + std::sqrt( 91.0 ))*cm,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( surface_hit, 8 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be advanced through the model
+FRENSIE_UNIT_TEST( NativeNavigator, advanceToCellBoundary )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.5*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  double normal[3];
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary( normal ) );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[0], 1.0*cm, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[0], 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(), 1.0*cm, 1e-15 );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(), 8.0*cm, 1e-15 );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 4 );
+  FRENSIE_CHECK( model->isTerminationCell( navigator->getCurrentCell() ) );
+
+  // Cross the same boundaries again (the cached neighbors will be used)
+  navigator->setState( 0.0*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 3 );
+
+  // Reenter the box from its boundary
+  navigator->changeDirection( -1.0, 0.0, 0.0 );
+
+  Geometry::Navigator::EntityId surface_hit;
+
+  FRENSIE_CHECK_EQUAL( navigator->fireRay( &surface_hit ), 0.0*cm );
+  FRENSIE_CHECK_EQUAL( surface_hit, 3 );
+
+  FRENSIE_CHECK( !navigator->advanceToCellBoundary() );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(), 1.0*cm, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that each thread can advance an internal ray through the model
+FRENSIE_UNIT_TEST( NativeNavigator, advanceToCellBoundary_threads )
+{
+  model->enableThreadSupport( 4 );
+
+  std::vector<Geometry::Navigator::EntityId> cells( 100*3 );
+
+  #pragma omp parallel num_threads( 4 )
+  {
+    std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+    #pragma omp for
+    for( int i = 0; i < 100; ++i )
+    {
+      navigator->setState( 0.0*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+      navigator->advanceToCellBoundary();
+      cells[3*i] = navigator->getCurrentCell();
+
+      navigator->advanceToCellBoundary();
+      cells[3*i+1] = navigator->getCurrentCell();
+
+      navigator->advanceToCellBoundary();
+      cells[3*i+2] = navigator->getCurrentCell();
+    }
+  }
+
+  for( size_t i = 0; i < 100; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( cells[3*i], 2 );
+    FRENSIE_CHECK_EQUAL( cells[3*i+1], 3 );
+    FRENSIE_CHECK_EQUAL( cells[3*i+2], 4 );
+  }
+
+  model->enableThreadSupport( 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray is reflected at a reflecting surface
+FRENSIE_UNIT_TEST( NativeNavigator, advanceToCellBoundary_reflecting )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.0*cm, 1.5*cm, 1.5*cm, 0.0, 0.0, 1.0 );
+
+  double normal[3];
+
+  FRENSIE_CHECK( navigator->advanceToCellBoundary( normal ) );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[2], 2.0*cm, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[2], 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getDirection()[2], -1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(), 4.0*cm, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray can be advanced by a substep
+FRENSIE_UNIT_TEST( NativeNavigator, advanceBySubstep )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.0*cm, 0.0*cm, 0.0*cm, 0.0, 1.0, 0.0 );
+
+  navigator->advanceBySubstep( 0.5*cm );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->getPosition()[1], 0.5*cm, 1e-15 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(), 0.5*cm, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the internal ray direction can be changed
+FRENSIE_UNIT_TEST( NativeNavigator, changeDirection )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 1.5*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(), 0.5*cm, 1e-15 );
+
+  navigator->changeDirection( -1.0, 0.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getDirection()[0], -1.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(), 0.5*cm, 1e-15 );
+
+  navigator->changeDirection( 0.0, 1.0, 0.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( navigator->fireRay(), 2.0*cm, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the navigator can be cloned
+FRENSIE_UNIT_TEST( NativeNavigator, clone )
+{
+  std::shared_ptr<Geometry::Navigator> navigator = model->createNavigator();
+
+  navigator->setState( 0.5*cm, 0.0*cm, 0.0*cm, 1.0, 0.0, 0.0 );
+
+  navigator->advanceToCellBoundary();
+
+  std::unique_ptr<Geometry::Navigator> navigator_clone( navigator->clone() );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 2 );
+  FRENSIE_CHECK_EQUAL( navigator_clone->getPosition()[0],
+                       navigator->getPosition()[0] );
+  FRENSIE_CHECK_EQUAL( navigator_clone->fireRay(), navigator->fireRay() );
+
+  navigator_clone.reset( navigator->clone( [](const Geometry::Navigator::Length distance){ std::cout << "advanced " << distance << std::endl; } ) );
+
+  FRENSIE_CHECK_EQUAL( navigator_clone->getCurrentCell(), 2 );
+  FRENSIE_CHECK_EQUAL( navigator_clone->fireRay(), navigator->fireRay() );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::shared_ptr<Geometry::NativeModel>
+    test_model( new Geometry::NativeModel );
+
+  test_model->addSurface( 1, Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 1.0 ) );
+  test_model->addSurface( 2, Geometry::QuadricSurface::createXPlane( -2.0 ) );
+  test_model->addSurface( 3, Geometry::QuadricSurface::createXPlane( 2.0 ) );
+  test_model->addSurface( 4, Geometry::QuadricSurface::createYPlane( -2.0 ) );
+  test_model->addSurface( 5, Geometry::QuadricSurface::createYPlane( 2.0 ) );
+  test_model->addSurface( 6, Geometry::QuadricSurface::createZPlane( -2.0 ) );
+  test_model->addSurface( 7, Geometry::QuadricSurface::createZPlane( 2.0 ) );
+  test_model->addSurface( 8, Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 10.0 ) );
+
+  test_model->addCell( 1, "-1" );
+  test_model->addCell( 2, "1 n 2 n -3 n 4 n -5 n 6 n -7" );
+  test_model->addCell( 3, "-8 n (-2 u 3 u -4 u 5 u -6 u 7)" );
+  test_model->addCell( 4, "8" );
+
+  test_model->setTerminationCell( 4 );
+  test_model->setReflectingSurface( 7 );
+
+  model = test_model;
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstNativeNavigator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,281 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstQuadricSurface.cpp
+//! \author Alex Robinson
+//! \brief  Quadric surface class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Geometry_QuadricSurface.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a surface can be constructed
+FRENSIE_UNIT_TEST( QuadricSurface, constructor )
+{
+  FRENSIE_CHECK_NO_THROW( Geometry::QuadricSurface( 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0 ) );
+
+  // A surface must have at least one non-constant term
+  FRENSIE_CHECK_THROW( Geometry::QuadricSurface( 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check if a surface is planar
+FRENSIE_UNIT_TEST( QuadricSurface, isPlanar )
+{
+  FRENSIE_CHECK( Geometry::QuadricSurface::createXPlane( 1.0 ).isPlanar() );
+  FRENSIE_CHECK( Geometry::QuadricSurface::createPlane( 1.0, 1.0, 0.0, 2.0 ).isPlanar() );
+  FRENSIE_CHECK( !Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 1.0 ).isPlanar() );
+  FRENSIE_CHECK( !Geometry::QuadricSurface::createZCylinder( 0.0, 0.0, 1.0 ).isPlanar() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the surface equation can be evaluated
+FRENSIE_UNIT_TEST( QuadricSurface, evaluate )
+{
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 1.0, 1.0, 1.0, 2.0 );
+
+  double position[3] = {1.0, 1.0, 1.0};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.evaluate( position ), -4.0, 1e-15 );
+
+  position[0] = 3.0;
+
+  FRENSIE_CHECK_SMALL( sphere.evaluate( position ), 1e-15 );
+
+  position[0] = 4.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.evaluate( position ), 5.0, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sense of a point can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getSense )
+{
+  Geometry::QuadricSurface plane =
+    Geometry::QuadricSurface::createXPlane( 1.0 );
+
+  double position[3] = {0.0, 0.0, 0.0};
+  double direction[3] = {1.0, 0.0, 0.0};
+
+  FRENSIE_CHECK_EQUAL( plane.getSense( position, direction, 1e-9 ), -1 );
+
+  position[0] = 2.0;
+
+  FRENSIE_CHECK_EQUAL( plane.getSense( position, direction, 1e-9 ), 1 );
+
+  // The direction is used on the surface
+  position[0] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( plane.getSense( position, direction, 1e-9 ), 1 );
+
+  direction[0] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( plane.getSense( position, direction, 1e-9 ), -1 );
+
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 1.0 );
+
+  position[0] = 1.0 - 1e-12;
+
+  FRENSIE_CHECK_EQUAL( sphere.getSense( position, direction, 1e-9 ), -1 );
+
+  direction[0] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getSense( position, direction, 1e-9 ), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unit normal can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getUnitNormal )
+{
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 2.0 );
+
+  double position[3] = {0.0, 2.0, 0.0};
+  double normal[3];
+
+  sphere.getUnitNormal( position, normal );
+
+  FRENSIE_CHECK_SMALL( normal[0], 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[1], 1.0, 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[2], 1e-15 );
+
+  Geometry::QuadricSurface plane =
+    Geometry::QuadricSurface::createPlane( -1.0, 0.0, 0.0, 1.0 );
+
+  plane.getUnitNormal( position, normal );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( normal[0], -1.0, 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[1], 1e-15 );
+  FRENSIE_CHECK_SMALL( normal[2], 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the surface can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getDistance )
+{
+  const double inf = std::numeric_limits<double>::infinity();
+
+  // Plane
+  Geometry::QuadricSurface plane =
+    Geometry::QuadricSurface::createZPlane( 2.0 );
+
+  double position[3] = {0.0, 0.0, 0.0};
+  double direction[3] = {0.0, 0.0, 1.0};
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( plane.getDistance( position, direction, false ),
+                                   2.0,
+                                   1e-15 );
+
+  direction[2] = -1.0;
+
+  FRENSIE_CHECK_EQUAL( plane.getDistance( position, direction, false ), inf );
+
+  // Sphere (from inside)
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 2.0 );
+
+  position[0] = 1.0;
+  direction[0] = 1.0;
+  direction[2] = 0.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction, false ),
+                                   1.0,
+                                   1e-15 );
+
+  // Sphere (from outside)
+  position[0] = -3.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction, false ),
+                                   1.0,
+                                   1e-15 );
+
+  // Sphere (from the surface - the zero root is ignored)
+  position[0] = -2.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistance( position, direction, true ),
+                                   4.0,
+                                   1e-15 );
+
+  position[0] = 2.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getDistance( position, direction, true ), inf );
+
+  // Sphere (miss)
+  position[0] = -3.0;
+  position[1] = 3.0;
+
+  FRENSIE_CHECK_EQUAL( sphere.getDistance( position, direction, false ), inf );
+
+  // Cylinder
+  Geometry::QuadricSurface cylinder =
+    Geometry::QuadricSurface::createZCylinder( 0.0, 0.0, 1.0 );
+
+  position[0] = 0.0;
+  position[1] = 0.0;
+  direction[0] = 0.0;
+  direction[2] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( cylinder.getDistance( position, direction, false ), inf );
+
+  direction[0] = 1.0/std::sqrt( 2.0 );
+  direction[2] = 1.0/std::sqrt( 2.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cylinder.getDistance( position, direction, false ),
+                                   std::sqrt( 2.0 ),
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distance to the closest point can be returned
+FRENSIE_UNIT_TEST( QuadricSurface, getDistanceToClosestPoint )
+{
+  double position[3] = {1.0, 2.0, 3.0};
+
+  Geometry::QuadricSurface plane =
+    Geometry::QuadricSurface::createPlane( 0.0, 3.0, 4.0, 5.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( plane.getDistanceToClosestPoint( position ),
+                                   2.6,
+                                   1e-15 );
+
+  Geometry::QuadricSurface sphere =
+    Geometry::QuadricSurface::createSphere( 1.0, 2.0, 1.0, 1.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( sphere.getDistanceToClosestPoint( position ),
+                                   1.0,
+                                   1e-15 );
+
+  Geometry::QuadricSurface cylinder =
+    Geometry::QuadricSurface::createYCylinder( 1.0, 0.0, 5.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( cylinder.getDistanceToClosestPoint( position ),
+                                   2.0,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a surface can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( QuadricSurface, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_quadric_surface" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    Geometry::QuadricSurface surface =
+      Geometry::QuadricSurface::createSphere( 1.0, 2.0, 3.0, 4.0 );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( surface ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived surface
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  Geometry::QuadricSurface surface;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( surface ) );
+
+  double position[3] = {1.0, 2.0, 8.0};
+
+  FRENSIE_CHECK( !surface.isPlanar() );
+  FRENSIE_CHECK_FLOATING_EQUALITY( surface.getDistanceToClosestPoint( position ),
+                                   1.0,
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstQuadricSurface.cpp
+//---------------------------------------------------------------------------//
@@ -57,6 +57,12 @@ public:
   virtual void reduceData( const Utility::Communicator& comm,
                            const int root_process ) = 0;
 
+  //! Capture the source data that will be saved to an archive
+  virtual void takeArchiveSnapshot() = 0;
+
+  //! Release the source data that was captured for an archive
+  virtual void releaseArchiveSnapshot() = 0;
+
   //! Print a summary of the source data
   virtual void printSummary( std::ostream& os ) const = 0;
 
@@ -170,6 +170,43 @@ void ParticleSourceComponent::reduceData( const Utility::Communicator& comm,
   }
 }
 
+// Capture the sampling statistics that will be saved to an archive
+/*! \details Only the master thread should call this method. Until the
+ * captured statistics are released they will be saved instead of the current
+ * statistics.
+ */
+void ParticleSourceComponent::takeArchiveSnapshot()
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  std::unique_ptr<ArchiveSnapshot> snapshot( new ArchiveSnapshot );
+
+  this->mergeLocalStartCellCaches( snapshot->start_cell_cache );
+
+  snapshot->number_of_trials = this->reduceLocalTrialCounters();
+  snapshot->number_of_samples = this->reduceLocalSampleCounters();
+
+  d_archive_snapshot = std::move( snapshot );
+
+  // Capture the derived class data
+  this->takeArchiveSnapshotImpl();
+}
+
+// Release the sampling statistics that were captured for an archive
+/*! \details Only the master thread should call this method.
+ */
+void ParticleSourceComponent::releaseArchiveSnapshot()
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_archive_snapshot.reset();
+
+  // Release the derived class data
+  this->releaseArchiveSnapshotImpl();
+}
+
 // Sample a particle state
 /*! \details If MonteCarlo::ParticleSourceComponent::enableThreadSupport has
  * been called, this method is thread-safe.
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <memory>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -73,6 +74,12 @@ public:
   void reduceData( const Utility::Communicator& comm,
                    const int root_process );
 
+  //! Capture the sampling statistics that will be saved to an archive
+  void takeArchiveSnapshot();
+
+  //! Release the sampling statistics that were captured for an archive
+  void releaseArchiveSnapshot();
+
   //! Sample a particle state
   void sampleParticleState( ParticleBank& bank,
                             const unsigned long long history );
@@ -128,6 +135,12 @@ protected:
   virtual void reduceDataImpl( const Utility::Communicator& comm,
                                const int root_process ) = 0;
 
+  //! Capture the sampling statistics that will be saved to an archive
+  virtual void takeArchiveSnapshotImpl() = 0;
+
+  //! Release the sampling statistics that were captured for an archive
+  virtual void releaseArchiveSnapshotImpl() = 0;
+
   /*! \brief Return the number of particle states that will be sampled for the
    * given history number
    */
@@ -240,6 +253,17 @@ private:
 
   // The number of valid samples
   std::vector<Counter> d_number_of_samples;
+
+  // The sampling statistics that are updated during a simulation
+  struct ArchiveSnapshot
+  {
+    CellIdSet start_cell_cache;
+    Counter number_of_trials;
+    Counter number_of_samples;
+  };
+
+  // The sampling statistics captured for an archive
+  std::unique_ptr<const ArchiveSnapshot> d_archive_snapshot;
 };
 
 // Save the data to an archive
@@ -252,16 +276,25 @@ void ParticleSourceComponent::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( d_model );
 
   CellIdSet start_cell_cache;
-  this->mergeLocalStartCellCaches( start_cell_cache );
+  Counter number_of_trials, number_of_samples;
+
+  // Use the captured sampling statistics if there are any
+  if( d_archive_snapshot )
+  {
+    start_cell_cache = d_archive_snapshot->start_cell_cache;
+    number_of_trials = d_archive_snapshot->number_of_trials;
+    number_of_samples = d_archive_snapshot->number_of_samples;
+  }
+  else
+  {
+    this->mergeLocalStartCellCaches( start_cell_cache );
+
+    number_of_trials = this->reduceLocalTrialCounters();
+    number_of_samples = this->reduceLocalSampleCounters();
+  }
 
   ar & BOOST_SERIALIZATION_NVP( start_cell_cache );
-
-  Counter number_of_trials = this->reduceLocalTrialCounters();
-
   ar & BOOST_SERIALIZATION_NVP( number_of_trials );
-
-  Counter number_of_samples = this->reduceLocalSampleCounters();
-
   ar & BOOST_SERIALIZATION_NVP( number_of_samples );
 }
 
@@ -79,6 +79,24 @@ void StandardParticleSource::reduceData( const Utility::Communicator& comm,
     d_components[i]->reduceData( comm, root_process );
 }
 
+// Capture the source data that will be saved to an archive
+/*! \details Only the master thread should call this method.
+ */
+void StandardParticleSource::takeArchiveSnapshot()
+{
+  for( size_t i = 0; i < d_components.size(); ++i )
+    d_components[i]->takeArchiveSnapshot();
+}
+
+// Release the source data that was captured for an archive
+/*! \details Only the master thread should call this method.
+ */
+void StandardParticleSource::releaseArchiveSnapshot()
+{
+  for( size_t i = 0; i < d_components.size(); ++i )
+    d_components[i]->releaseArchiveSnapshot();
+}
+
 // Print a summary of the source data
 /*! \details Only the master thread should call this method.
  */
@@ -46,6 +46,12 @@ public:
   void reduceData( const Utility::Communicator& comm,
                            const int root_process ) final override;
 
+  //! Capture the source data that will be saved to an archive
+  void takeArchiveSnapshot() final override;
+
+  //! Release the source data that was captured for an archive
+  void releaseArchiveSnapshot() final override;
+
   //! Print a summary of the source data
   void printSummary( std::ostream& os ) const final override;
 
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <functional>
+#include <memory>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSourceComponent.hpp"
@@ -103,6 +104,12 @@ protected:
   void reduceDataImpl( const Utility::Communicator& comm,
                        const int root_process ) final override;
 
+  //! Capture the sampling statistics that will be saved to an archive
+  void takeArchiveSnapshotImpl() final override;
+
+  //! Release the sampling statistics that were captured for an archive
+  void releaseArchiveSnapshotImpl() final override;
+
   /*! \brief Return the number of particle states that will be sampled for the 
    * given history number
    */
@@ -210,6 +217,16 @@ private:
 
   // The dimension samples counters
   std::vector<DimensionCounterMap> d_dimension_sample_counters;
+
+  // The dimension counters that are updated during a simulation
+  struct ArchiveSnapshot
+  {
+    DimensionCounterMap dimension_trial_counters;
+    DimensionCounterMap dimension_sample_counters;
+  };
+
+  // The dimension counters captured for an archive
+  std::unique_ptr<const ArchiveSnapshot> d_archive_snapshot;
 };
 
 //! The standard neutron source component
@@ -222,6 +222,37 @@ void StandardParticleSourceComponent<ParticleStateType>::resetDataImpl()
   this->initializeDimensionTrialCounters();
 }
 
+// Capture the sampling statistics that will be saved to an archive
+/*! \details Only the master thread should call this method.
+ */
+template<typename ParticleStateType>
+void StandardParticleSourceComponent<ParticleStateType>::takeArchiveSnapshotImpl()
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  std::unique_ptr<ArchiveSnapshot> snapshot( new ArchiveSnapshot );
+
+  this->reduceAllLocalDimensionTrialCounters(
+                                         snapshot->dimension_trial_counters );
+  this->reduceAllLocalDimensionSampleCounters(
+                                        snapshot->dimension_sample_counters );
+
+  d_archive_snapshot = std::move( snapshot );
+}
+
+// Release the sampling statistics that were captured for an archive
+/*! \details Only the master thread should call this method.
+ */
+template<typename ParticleStateType>
+void StandardParticleSourceComponent<ParticleStateType>::releaseArchiveSnapshotImpl()
+{
+  // Make sure only the root process calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_archive_snapshot.reset();
+}
+
 // Reduce the sampling statistics on the root process
 /*! \details Only the master thread should call this method.
  */
@@ -536,14 +567,21 @@ void StandardParticleSourceComponent<ParticleStateType>::save( Archive& ar, cons
   // Save the local data
   ar & BOOST_SERIALIZATION_NVP( d_particle_distribution );
 
-  DimensionCounterMap dimension_trial_counters;
-  this->reduceAllLocalDimensionTrialCounters( dimension_trial_counters );
+  DimensionCounterMap dimension_trial_counters, dimension_sample_counters;
+
+  // Use the captured dimension counters if there are any
+  if( d_archive_snapshot )
+  {
+    dimension_trial_counters = d_archive_snapshot->dimension_trial_counters;
+    dimension_sample_counters = d_archive_snapshot->dimension_sample_counters;
+  }
+  else
+  {
+    this->reduceAllLocalDimensionTrialCounters( dimension_trial_counters );
+    this->reduceAllLocalDimensionSampleCounters( dimension_sample_counters );
+  }
   
   ar & BOOST_SERIALIZATION_NVP( dimension_trial_counters );
-
-  DimensionCounterMap dimension_sample_counters;
-  this->reduceAllLocalDimensionSampleCounters( dimension_sample_counters );
-
   ar & BOOST_SERIALIZATION_NVP( dimension_sample_counters );
 }
 
@@ -126,6 +126,14 @@ double Atom<AtomCore>::getAtomicWeight() const
   return d_atomic_weight;
 }
 
+// Return the energy grid searcher
+template<typename AtomCore>
+inline const Utility::HashBasedGridSearcher<double>&
+Atom<AtomCore>::getGridSearcher() const
+{
+  return d_core.getGridSearcher();
+}
+
 // Return the total cross section at the desired energy
 template<typename AtomCore>
 inline double Atom<AtomCore>::getTotalCrossSection( const double energy ) const
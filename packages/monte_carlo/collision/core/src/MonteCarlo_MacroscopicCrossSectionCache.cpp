@@ -0,0 +1,163 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_MacroscopicCrossSectionCache.cpp
+//! \author Alex Robinson
+//! \brief  Macroscopic cross section cache class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_MacroscopicCrossSectionCache.hpp"
+
+namespace MonteCarlo{
+
+namespace{
+
+// The last key that was created
+unsigned long long last_key = 0ull;
+
+// The caches of all running threads
+std::vector<MacroscopicCrossSectionCache*> thread_caches;
+
+// The number of hits from caches of threads that have exited
+unsigned long long retired_hits = 0ull;
+
+// The number of misses from caches of threads that have exited
+unsigned long long retired_misses = 0ull;
+
+} // end anonymous namespace
+
+// Constructor
+MacroscopicCrossSectionCache::MacroscopicCrossSectionCache()
+  : d_key( 0ull ),
+    d_energy( 0.0 ),
+    d_total_cross_section( 0.0 ),
+    d_absorption_cross_section( 0.0 ),
+    d_cumulative_cross_sections(),
+    d_total_cross_section_cached( false ),
+    d_absorption_cross_section_cached( false ),
+    d_cumulative_cross_sections_cached( false ),
+    d_hits( 0ull ),
+    d_misses( 0ull )
+{
+  #pragma omp critical( macroscopic_cross_section_cache_registry )
+  {
+    thread_caches.push_back( this );
+  }
+}
+
+// Destructor
+MacroscopicCrossSectionCache::~MacroscopicCrossSectionCache()
+{
+  #pragma omp critical( macroscopic_cross_section_cache_registry )
+  {
+    retired_hits += d_hits;
+    retired_misses += d_misses;
+
+    thread_caches.erase( std::remove( thread_caches.begin(),
+                                      thread_caches.end(),
+                                      this ),
+                         thread_caches.end() );
+  }
+}
+
+// Create a new cache key
+/*! \details A key of zero will never be returned (a new cache is not current
+ * for any key).
+ */
+unsigned long long MacroscopicCrossSectionCache::createKey()
+{
+  unsigned long long key;
+
+  #pragma omp critical( macroscopic_cross_section_cache_registry )
+  {
+    key = ++last_key;
+  }
+
+  return key;
+}
+
+// Return the number of cache hits (all threads)
+unsigned long long MacroscopicCrossSectionCache::getNumberOfHits()
+{
+  unsigned long long hits;
+
+  #pragma omp critical( macroscopic_cross_section_cache_registry )
+  {
+    hits = retired_hits;
+
+    for( size_t i = 0; i < thread_caches.size(); ++i )
+      hits += thread_caches[i]->d_hits;
+  }
+
+  return hits;
+}
+
+// Return the number of cache misses (all threads)
+unsigned long long MacroscopicCrossSectionCache::getNumberOfMisses()
+{
+  unsigned long long misses;
+
+  #pragma omp critical( macroscopic_cross_section_cache_registry )
+  {
+    misses = retired_misses;
+
+    for( size_t i = 0; i < thread_caches.size(); ++i )
+      misses += thread_caches[i]->d_misses;
+  }
+
+  return misses;
+}
+
+// Return the cache hit rate (all threads)
+/*! \details If the cache has not been used a hit rate of zero will be
+ * returned.
+ */
+double MacroscopicCrossSectionCache::getHitRate()
+{
+  const unsigned long long hits = MacroscopicCrossSectionCache::getNumberOfHits();
+  const unsigned long long lookups =
+    hits + MacroscopicCrossSectionCache::getNumberOfMisses();
+
+  if( lookups > 0ull )
+    return hits/(double)lookups;
+  else
+    return 0.0;
+}
+
+// Reset the cache hit and miss counters (all threads)
+void MacroscopicCrossSectionCache::resetStatistics()
+{
+  #pragma omp critical( macroscopic_cross_section_cache_registry )
+  {
+    retired_hits = 0ull;
+    retired_misses = 0ull;
+
+    for( size_t i = 0; i < thread_caches.size(); ++i )
+    {
+      thread_caches[i]->d_hits = 0ull;
+      thread_caches[i]->d_misses = 0ull;
+    }
+  }
+}
+
+// Print the cache statistics (all threads)
+void MacroscopicCrossSectionCache::printStatistics( std::ostream& os )
+{
+  const unsigned long long hits = MacroscopicCrossSectionCache::getNumberOfHits();
+  const unsigned long long misses =
+    MacroscopicCrossSectionCache::getNumberOfMisses();
+
+  os << "Macroscopic cross section cache: "
+     << hits << " hits, " << misses << " misses (hit rate: "
+     << MacroscopicCrossSectionCache::getHitRate() << ")" << std::endl;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_MacroscopicCrossSectionCache.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,264 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_MacroscopicCrossSectionCache.hpp
+//! \author Alex Robinson
+//! \brief  Macroscopic cross section cache class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_MACROSCOPIC_CROSS_SECTION_CACHE_HPP
+#define MONTE_CARLO_MACROSCOPIC_CROSS_SECTION_CACHE_HPP
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+/*! The macroscopic cross section cache class
+ *
+ * Each thread has its own cache, which stores the macroscopic cross sections
+ * that were last evaluated for a single (material, energy) pair. Every
+ * object that uses the cache must acquire a unique key (materials that
+ * are used in multiple cells share the key). The cache hit and miss counters
+ * of every thread can be queried or reset but only outside of a parallel
+ * block.
+ */
+class MacroscopicCrossSectionCache
+{
+
+public:
+
+  //! Get the cache of the calling thread
+  static MacroscopicCrossSectionCache& getThreadCache();
+
+  //! Create a new cache key
+  static unsigned long long createKey();
+
+  //! Return the number of cache hits (all threads)
+  static unsigned long long getNumberOfHits();
+
+  //! Return the number of cache misses (all threads)
+  static unsigned long long getNumberOfMisses();
+
+  //! Return the cache hit rate (all threads)
+  static double getHitRate();
+
+  //! Reset the cache hit and miss counters (all threads)
+  static void resetStatistics();
+
+  //! Print the cache statistics (all threads)
+  static void printStatistics( std::ostream& os );
+
+  //! Destructor
+  ~MacroscopicCrossSectionCache();
+
+  //! Check if the cached values were evaluated for the key and energy
+  bool isCurrent( const unsigned long long key, const double energy ) const;
+
+  //! Make the cache current for the key and energy (discard cached values)
+  void makeCurrent( const unsigned long long key, const double energy );
+
+  //! Check if the total cross section has been cached
+  bool isTotalCrossSectionCached() const;
+
+  //! Return the cached total cross section
+  double getTotalCrossSection() const;
+
+  //! Cache the total cross section
+  void cacheTotalCrossSection( const double cross_section );
+
+  //! Check if the absorption cross section has been cached
+  bool isAbsorptionCrossSectionCached() const;
+
+  //! Return the cached absorption cross section
+  double getAbsorptionCrossSection() const;
+
+  //! Cache the absorption cross section
+  void cacheAbsorptionCrossSection( const double cross_section );
+
+  //! Check if the cumulative constituent total cross sections have been cached
+  bool areCumulativeCrossSectionsCached() const;
+
+  //! Return the cached cumulative constituent total cross sections
+  const std::vector<double>& getCumulativeCrossSections() const;
+
+  //! Return the cumulative cross section array that will be cached
+  std::vector<double>& getCumulativeCrossSectionsToCache();
+
+  //! Indicate that the cumulative cross sections have been cached
+  void cacheCumulativeCrossSections();
+
+  //! Record a cache hit
+  void recordHit();
+
+  //! Record a cache miss
+  void recordMiss();
+
+private:
+
+  // Constructor
+  MacroscopicCrossSectionCache();
+
+  // The key of the object that the cached values belong to
+  unsigned long long d_key;
+
+  // The energy that the cached values were evaluated at
+  double d_energy;
+
+  // The cached total cross section
+  double d_total_cross_section;
+
+  // The cached absorption cross section
+  double d_absorption_cross_section;
+
+  // The cached cumulative constituent total cross sections
+  std::vector<double> d_cumulative_cross_sections;
+
+  // The total cross section cached flag
+  bool d_total_cross_section_cached;
+
+  // The absorption cross section cached flag
+  bool d_absorption_cross_section_cached;
+
+  // The cumulative cross sections cached flag
+  bool d_cumulative_cross_sections_cached;
+
+  // The number of hits
+  unsigned long long d_hits;
+
+  // The number of misses
+  unsigned long long d_misses;
+};
+
+// Get the cache of the calling thread
+inline MacroscopicCrossSectionCache&
+MacroscopicCrossSectionCache::getThreadCache()
+{
+  thread_local MacroscopicCrossSectionCache cache;
+
+  return cache;
+}
+
+// Check if the cached values were evaluated for the key and energy
+inline bool MacroscopicCrossSectionCache::isCurrent(
+                                                const unsigned long long key,
+                                                const double energy ) const
+{
+  return d_key == key && d_energy == energy;
+}
+
+// Make the cache current for the key and energy (discard cached values)
+inline void MacroscopicCrossSectionCache::makeCurrent(
+                                                const unsigned long long key,
+                                                const double energy )
+{
+  d_key = key;
+  d_energy = energy;
+
+  d_total_cross_section_cached = false;
+  d_absorption_cross_section_cached = false;
+  d_cumulative_cross_sections_cached = false;
+}
+
+// Check if the total cross section has been cached
+inline bool MacroscopicCrossSectionCache::isTotalCrossSectionCached() const
+{
+  return d_total_cross_section_cached;
+}
+
+// Return the cached total cross section
+inline double MacroscopicCrossSectionCache::getTotalCrossSection() const
+{
+  // Make sure the total cross section has been cached
+  testPrecondition( d_total_cross_section_cached );
+
+  return d_total_cross_section;
+}
+
+// Cache the total cross section
+inline void MacroscopicCrossSectionCache::cacheTotalCrossSection(
+                                                  const double cross_section )
+{
+  d_total_cross_section = cross_section;
+  d_total_cross_section_cached = true;
+}
+
+// Check if the absorption cross section has been cached
+inline bool MacroscopicCrossSectionCache::isAbsorptionCrossSectionCached() const
+{
+  return d_absorption_cross_section_cached;
+}
+
+// Return the cached absorption cross section
+inline double MacroscopicCrossSectionCache::getAbsorptionCrossSection() const
+{
+  // Make sure the absorption cross section has been cached
+  testPrecondition( d_absorption_cross_section_cached );
+
+  return d_absorption_cross_section;
+}
+
+// Cache the absorption cross section
+inline void MacroscopicCrossSectionCache::cacheAbsorptionCrossSection(
+                                                  const double cross_section )
+{
+  d_absorption_cross_section = cross_section;
+  d_absorption_cross_section_cached = true;
+}
+
+// Check if the cumulative constituent total cross sections have been cached
+inline bool MacroscopicCrossSectionCache::areCumulativeCrossSectionsCached() const
+{
+  return d_cumulative_cross_sections_cached;
+}
+
+// Return the cached cumulative constituent total cross sections
+inline const std::vector<double>&
+MacroscopicCrossSectionCache::getCumulativeCrossSections() const
+{
+  // Make sure the cumulative cross sections have been cached
+  testPrecondition( d_cumulative_cross_sections_cached );
+
+  return d_cumulative_cross_sections;
+}
+
+// Return the cumulative cross section array that will be cached
+/*! \details The array memory is reused between cache updates.
+ */
+inline std::vector<double>&
+MacroscopicCrossSectionCache::getCumulativeCrossSectionsToCache()
+{
+  d_cumulative_cross_sections_cached = false;
+
+  return d_cumulative_cross_sections;
+}
+
+// Indicate that the cumulative cross sections have been cached
+inline void MacroscopicCrossSectionCache::cacheCumulativeCrossSections()
+{
+  d_cumulative_cross_sections_cached = true;
+}
+
+// Record a cache hit
+inline void MacroscopicCrossSectionCache::recordHit()
+{
+  ++d_hits;
+}
+
+// Record a cache miss
+inline void MacroscopicCrossSectionCache::recordMiss()
+{
+  ++d_misses;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_MACROSCOPIC_CROSS_SECTION_CACHE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_MacroscopicCrossSectionCache.hpp
+//---------------------------------------------------------------------------//
@@ -16,6 +16,9 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_UnionizedEnergyGridMode.hpp"
+#include "MonteCarlo_MacroscopicCrossSectionCache.hpp"
+#include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_QuantityTraits.hpp"
@@ -98,6 +101,23 @@ public:
   //! Get the reaction types
   void getReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
+  //! Construct the unionized energy grid
+  void unionizeEnergyGrid( const UnionizedEnergyGridMode mode,
+                           const double min_energy,
+                           const double max_energy );
+
+  //! Return the unionized energy grid mode
+  UnionizedEnergyGridMode getUnionizedEnergyGridMode() const;
+
+  //! Return the unionized energy grid
+  const std::vector<double>& getUnionizedEnergyGrid() const;
+
+  //! Get the scattering center energy grid points in an energy range
+  void getScatteringCenterEnergyGridPoints(
+                                   const double min_energy,
+                                   const double max_energy,
+                                   std::vector<double>& energy_grid ) const;
+
   //! Collide with a scattering center
   virtual void collideAnalogue( ParticleStateType& particle,
                                 ParticleBank& bank ) const;
@@ -141,6 +161,9 @@ protected:
   //! Return the scattering center at the desired index
   const ScatteringCenter& getScatteringCenter( const size_t index ) const;
 
+  //! Return the scattering center number density at the desired index
+  double getScatteringCenterNumberDensity( const size_t index ) const;
+
 private:
 
   // Get the atomic weight from an atom pointer
@@ -150,6 +173,32 @@ private:
   // Sample the atom that is collided with
   size_t sampleCollisionScatteringCenter( const double energy ) const;
 
+  // Sample the atom that is collided with using the cumulative cross sections
+  size_t sampleCollisionScatteringCenter(
+           const std::vector<double>& cumulative_total_cross_sections ) const;
+
+  // Get the macroscopic cross section cache (current for the energy)
+  MacroscopicCrossSectionCache& getCrossSectionCache(
+                                                   const double energy ) const;
+
+  // Cache the cumulative scattering center total cross sections
+  void cacheCumulativeCrossSections( const double energy,
+                                     MacroscopicCrossSectionCache& cache ) const;
+
+  // Sample the atom that is collided with using the unionized cross sections
+  size_t sampleCollisionScatteringCenterUnionized( const double energy ) const;
+
+  // Check if an energy can be looked up on the unionized energy grid
+  bool isEnergyWithinUnionizedEnergyGrid( const double energy ) const;
+
+  // Return the scattering center energy grid indices for the energy
+  const unsigned* getUnionizedEnergyGridIndices( const double energy ) const;
+
+  // Evaluate a cross section that is stored on the unionized energy grid
+  double evaluateOnUnionizedEnergyGrid(
+                      const double energy,
+                      const std::vector<double>& cross_section ) const;
+
   // The ScatteringCenter::getTotalCrossSection function wrapper
   static MicroscopicCrossSectionEvaluationFunctor s_total_cs_evaluation_functor;
   // The ScatteringCenter::getAbsorptionCrossSection function wrapper
@@ -167,9 +216,40 @@ private:
   // The scattering center names that make up the material
   std::map<std::string,size_t> d_scattering_center_names;
 
-  // The getMacroscopicTotalCrossSection function wrapper
+  // The macroscopic cross section cache key
+  unsigned long long d_cache_key;
+
+  // The getMacroscopicTotalCrossSection function wrapper (no unionization)
   MacroscopicCrossSectionEvaluationFunctor
   d_macroscopic_total_cs_evaluation_functor;
+
+  // The unionized energy grid mode
+  UnionizedEnergyGridMode d_unionized_energy_grid_mode;
+
+  // The unionized energy grid
+  std::shared_ptr<const std::vector<double> > d_unionized_energy_grid;
+
+  // The unionized energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_unionized_energy_grid_searcher;
+
+  // The scattering center energy grid indices of each unionized energy grid
+  // bin (only stored in hashed mode - the indices of each bin are stored
+  // contiguously)
+  std::vector<unsigned> d_unionized_energy_grid_indices;
+
+  // The macroscopic total cross section on the unionized energy grid (only
+  // stored in full mode)
+  std::vector<double> d_unionized_total_cross_section;
+
+  // The macroscopic absorption cross section on the unionized energy grid
+  // (only stored in full mode)
+  std::vector<double> d_unionized_absorption_cross_section;
+
+  // The cumulative scattering center macroscopic total cross sections on the
+  // unionized energy grid (only stored in full mode - the cross sections
+  // at each energy grid point are stored contiguously)
+  std::vector<double> d_unionized_cumulative_cross_sections;
 };
 
 } // end MonteCarlo namespace
@@ -9,9 +9,15 @@
 #ifndef MONTE_CARLO_MATERIAL_DEF_HPP
 #define MONTE_CARLO_MATERIAL_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "MonteCarlo_MaterialHelpers.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_StandardHashBasedGridSearcher.hpp"
+#include "Utility_InterpolationPolicy.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -45,10 +51,19 @@ Material<ScatteringCenter>::Material(
     d_number_density( density ),
     d_scattering_centers( scattering_center_fractions.size() ),
     d_scattering_center_names(),
+    d_cache_key( MacroscopicCrossSectionCache::createKey() ),
     d_macroscopic_total_cs_evaluation_functor(
-                 std::bind<double>( &ThisType::getMacroscopicTotalCrossSection,
+                 std::bind<double>( &ThisType::getMacroscopicCrossSection,
                                     std::cref(*this),
-                                    std::placeholders::_1 ) )
+                                    std::placeholders::_1,
+                                    std::cref(s_total_cs_evaluation_functor) ) ),
+    d_unionized_energy_grid_mode( NO_UNIONIZED_ENERGY_GRID ),
+    d_unionized_energy_grid( new std::vector<double> ),
+    d_unionized_energy_grid_searcher(),
+    d_unionized_energy_grid_indices(),
+    d_unionized_total_cross_section(),
+    d_unionized_absorption_cross_section(),
+    d_unionized_cumulative_cross_sections()
 {
   // Make sure the id is valid
   testPrecondition( ThisType::isIdValid( id ) );
@@ -176,23 +191,307 @@ double Material<ScatteringCenter>::getScatteringCenterNumberDensity( const std::
   return Utility::get<0>( d_scattering_centers[index] );
 }
 
+// Construct the unionized energy grid
+/*! \details The unionized energy grid is the union of the scattering center
+ * energy grid points that fall within the min and max energy (and within the
+ * energy range covered by every scattering center). Every scattering center
+ * cross section is therefore interpolated within a single scattering center
+ * energy grid bin between any two unionized energy grid points. In hashed
+ * mode the scattering center energy grid bin indices of each unionized
+ * energy grid bin are stored (double indexing) so that a lookup only
+ * requires a single grid search - the scattering center cross sections are
+ * still evaluated with their native interpolation. In full mode the
+ * cumulative scattering center total cross sections and the macroscopic
+ * absorption cross section are stored on the unionized energy grid instead
+ * (the memory requirement is proportional to the number of scattering
+ * centers). This is exact for scattering centers with lin-lin cross
+ * sections. The macroscopic total cross section and the collision scattering
+ * center are always evaluated from the same data. Any previously constructed
+ * unionized energy grid will be discarded.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::unionizeEnergyGrid(
+                                          const UnionizedEnergyGridMode mode,
+                                          const double min_energy,
+                                          const double max_energy )
+{
+  // Make sure the energy bounds are valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( min_energy < max_energy );
+
+  // Values cached with the previous key may be inconsistent with the new grid
+  d_cache_key = MacroscopicCrossSectionCache::createKey();
+
+  d_unionized_energy_grid_mode = NO_UNIONIZED_ENERGY_GRID;
+  d_unionized_energy_grid.reset( new std::vector<double> );
+  d_unionized_energy_grid_searcher.reset();
+  d_unionized_energy_grid_indices.clear();
+  d_unionized_total_cross_section.clear();
+  d_unionized_absorption_cross_section.clear();
+  d_unionized_cumulative_cross_sections.clear();
+
+  if( mode == NO_UNIONIZED_ENERGY_GRID )
+    return;
+
+  const size_t number_of_scattering_centers = d_scattering_centers.size();
+
+  // Determine the energy range covered by every scattering center
+  double lower_energy = min_energy;
+  double upper_energy = max_energy;
+
+  for( size_t j = 0; j < number_of_scattering_centers; ++j )
+  {
+    const Utility::HashBasedGridSearcher<double>& grid_searcher =
+      Utility::get<1>( d_scattering_centers[j] )->getGridSearcher();
+
+    lower_energy = std::max( lower_energy, grid_searcher.getGridPoint( 0 ) );
+    upper_energy = std::min( upper_energy, grid_searcher.getGridPoint(
+                                grid_searcher.getNumberOfGridPoints() - 1 ) );
+  }
+
+  TEST_FOR_EXCEPTION( lower_energy >= upper_energy,
+                      std::runtime_error,
+                      "Could not construct the unionized energy grid for "
+                      "material " << d_id << " because the scattering center "
+                      "energy grids do not overlap the energy range ["
+                      << min_energy << "," << max_energy << "]!" );
+
+  // Merge the scattering center energy grid points
+  std::shared_ptr<std::vector<double> > energy_grid( new std::vector<double> );
+
+  this->getScatteringCenterEnergyGridPoints( lower_energy,
+                                             upper_energy,
+                                             *energy_grid );
+
+  if( energy_grid->empty() || energy_grid->front() != lower_energy )
+    energy_grid->insert( energy_grid->begin(), lower_energy );
+
+  if( energy_grid->back() != upper_energy )
+    energy_grid->push_back( upper_energy );
+
+  // Find the scattering center energy grid bin of each unionized energy grid
+  // bin - the bin centers are searched to avoid ambiguity at shared points
+  std::vector<unsigned> energy_grid_indices(
+                     (energy_grid->size()-1)*number_of_scattering_centers );
+
+  for( size_t i = 0; i < energy_grid->size()-1; ++i )
+  {
+    const double bin_center_energy =
+      0.5*((*energy_grid)[i] + (*energy_grid)[i+1]);
+
+    for( size_t j = 0; j < number_of_scattering_centers; ++j )
+    {
+      energy_grid_indices[i*number_of_scattering_centers+j] =
+        Utility::get<1>( d_scattering_centers[j] )->getGridSearcher().findLowerBinIndex( bin_center_energy );
+    }
+  }
+
+  if( mode == HASHED_UNIONIZED_ENERGY_GRID )
+    d_unionized_energy_grid_indices.swap( energy_grid_indices );
+
+  // Evaluate the macroscopic and cumulative scattering center cross sections
+  // on the grid
+  else
+  {
+    d_unionized_total_cross_section.resize( energy_grid->size() );
+    d_unionized_absorption_cross_section.resize( energy_grid->size() );
+    d_unionized_cumulative_cross_sections.resize(
+                            energy_grid->size()*number_of_scattering_centers );
+
+    for( size_t i = 0; i < energy_grid->size(); ++i )
+    {
+      // The last grid point is the upper bound of the last bin
+      const unsigned* scattering_center_indices =
+        &energy_grid_indices[std::min( i, energy_grid->size()-2 )*
+                             number_of_scattering_centers];
+
+      const size_t offset = i*number_of_scattering_centers;
+
+      double partial_total_cs = 0.0;
+      double absorption_cs = 0.0;
+
+      for( size_t j = 0; j < number_of_scattering_centers; ++j )
+      {
+        const ScatteringCenter& scattering_center =
+          *Utility::get<1>( d_scattering_centers[j] );
+
+        partial_total_cs += Utility::get<0>( d_scattering_centers[j] )*
+          scattering_center.getTotalCrossSection(
+                                               (*energy_grid)[i],
+                                               scattering_center_indices[j] );
+
+        absorption_cs += Utility::get<0>( d_scattering_centers[j] )*
+          scattering_center.getAbsorptionCrossSection(
+                                               (*energy_grid)[i],
+                                               scattering_center_indices[j] );
+
+        d_unionized_cumulative_cross_sections[offset+j] = partial_total_cs;
+      }
+
+      // The total cross section must be consistent with the cumulative cross
+      // sections
+      d_unionized_total_cross_section[i] = partial_total_cs;
+      d_unionized_absorption_cross_section[i] = absorption_cs;
+    }
+  }
+
+  d_unionized_energy_grid = energy_grid;
+
+  d_unionized_energy_grid_searcher.reset(
+           new Utility::StandardHashBasedGridSearcher<std::vector<double>,false>(
+                                             d_unionized_energy_grid,
+                                             d_unionized_energy_grid->size() ) );
+
+  d_unionized_energy_grid_mode = mode;
+
+  FRENSIE_LOG_NOTIFICATION( "Material " << d_id << " unionized energy grid "
+                            "constructed (" << mode << ", "
+                            << d_unionized_energy_grid->size() << " points)" );
+}
+
+// Return the unionized energy grid mode
+template<typename ScatteringCenter>
+UnionizedEnergyGridMode Material<ScatteringCenter>::getUnionizedEnergyGridMode() const
+{
+  return d_unionized_energy_grid_mode;
+}
+
+// Return the unionized energy grid
+/*! \details The grid will be empty if it has not been constructed.
+ */
+template<typename ScatteringCenter>
+const std::vector<double>& Material<ScatteringCenter>::getUnionizedEnergyGrid() const
+{
+  return *d_unionized_energy_grid;
+}
+
+// Get the scattering center energy grid points in an energy range
+/*! \details The sorted, unique grid points of every scattering center that
+ * fall inside of [min_energy,max_energy] will be stored. Any cross section
+ * that is interpolated on the scattering center grids will be monotonic
+ * between these points.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::getScatteringCenterEnergyGridPoints(
+                                     const double min_energy,
+                                     const double max_energy,
+                                     std::vector<double>& energy_grid ) const
+{
+  // Make sure the energy bounds are valid
+  testPrecondition( min_energy <= max_energy );
+
+  energy_grid.clear();
+
+  for( size_t j = 0; j < d_scattering_centers.size(); ++j )
+  {
+    const Utility::HashBasedGridSearcher<double>& grid_searcher =
+      Utility::get<1>( d_scattering_centers[j] )->getGridSearcher();
+
+    for( size_t k = 0; k < grid_searcher.getNumberOfGridPoints(); ++k )
+    {
+      const double grid_point = grid_searcher.getGridPoint( k );
+
+      if( grid_point >= min_energy && grid_point <= max_energy )
+        energy_grid.push_back( grid_point );
+    }
+  }
+
+  std::sort( energy_grid.begin(), energy_grid.end() );
+
+  energy_grid.erase( std::unique( energy_grid.begin(), energy_grid.end() ),
+                     energy_grid.end() );
+}
+
 // Return the macroscopic total cross section (1/cm)
+/*! \details The cross section that was last evaluated by the calling thread
+ * will be reused if the material and energy have not changed. Unless the
+ * full unionized energy grid is used the cumulative scattering center total
+ * cross sections will also be cached (for sampling the collision scattering
+ * center).
+ */
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicTotalCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection( energy,
-                                           s_total_cs_evaluation_functor );
+  MacroscopicCrossSectionCache& cache = this->getCrossSectionCache( energy );
+
+  if( cache.isTotalCrossSectionCached() )
+    cache.recordHit();
+  else
+  {
+    cache.recordMiss();
+
+    if( d_unionized_energy_grid_mode == FULL_UNIONIZED_ENERGY_GRID &&
+        this->isEnergyWithinUnionizedEnergyGrid( energy ) )
+    {
+      cache.cacheTotalCrossSection( this->evaluateOnUnionizedEnergyGrid(
+                                         energy,
+                                         d_unionized_total_cross_section ) );
+    }
+    else
+    {
+      if( !cache.areCumulativeCrossSectionsCached() )
+        this->cacheCumulativeCrossSections( energy, cache );
+
+      cache.cacheTotalCrossSection(
+                                  cache.getCumulativeCrossSections().back() );
+    }
+  }
+
+  return cache.getTotalCrossSection();
 }
 
 // Return the macroscopic absorption cross section (1/cm)
+/*! \details The cross section that was last evaluated by the calling thread
+ * will be reused if the material and energy have not changed.
+ */
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicAbsorptionCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection(
-                                          energy,
-                                          s_absorption_cs_evaluation_functor );
+  MacroscopicCrossSectionCache& cache = this->getCrossSectionCache( energy );
+
+  if( cache.isAbsorptionCrossSectionCached() )
+    cache.recordHit();
+  else
+  {
+    cache.recordMiss();
+
+    if( this->isEnergyWithinUnionizedEnergyGrid( energy ) )
+    {
+      if( d_unionized_energy_grid_mode == FULL_UNIONIZED_ENERGY_GRID )
+      {
+        cache.cacheAbsorptionCrossSection( this->evaluateOnUnionizedEnergyGrid(
+                                      energy,
+                                      d_unionized_absorption_cross_section ) );
+      }
+      else
+      {
+        const unsigned* scattering_center_indices =
+          this->getUnionizedEnergyGridIndices( energy );
+
+        double absorption_cs = 0.0;
+
+        for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+        {
+          absorption_cs += Utility::get<0>( d_scattering_centers[i] )*
+            Utility::get<1>( d_scattering_centers[i] )->getAbsorptionCrossSection(
+                                              energy,
+                                              scattering_center_indices[i] );
+        }
+
+        cache.cacheAbsorptionCrossSection( absorption_cs );
+      }
+    }
+    else
+    {
+      cache.cacheAbsorptionCrossSection( this->getMacroscopicCrossSection(
+                                      energy,
+                                      s_absorption_cs_evaluation_functor ) );
+    }
+  }
+
+  return cache.getAbsorptionCrossSection();
 }
 
 // Return the macroscopic cross section (1/cm) for a specific reaction
@@ -356,6 +655,15 @@ const ScatteringCenter& Material<ScatteringCenter>::getScatteringCenter( const s
   return *Utility::get<1>( d_scattering_centers[index] );
 }
 
+// Return the scattering center number density at the desired index
+template<typename ScatteringCenter>
+double Material<ScatteringCenter>::getScatteringCenterNumberDensity( const size_t index ) const
+{
+  testPrecondition( index < d_scattering_centers.size() );
+
+  return Utility::get<0>( d_scattering_centers[index] );
+}
+
 // Get the atomic weight from an atom pointer
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getAtomicWeightFromPair(
@@ -405,13 +713,237 @@ size_t Material<ScatteringCenter>::sampleCollisionScatteringCenterImpl(
 }
 
 // Sample the atom that is collided with
+/*! \details The scattering center total cross sections that were last
+ * evaluated by the calling thread will be reused if the material and energy
+ * have not changed.
+ */
 template<typename ScatteringCenter>
 size_t Material<ScatteringCenter>::sampleCollisionScatteringCenter( const double energy ) const
 {
-  return this->sampleCollisionScatteringCenterImpl(
-                                     energy,
-                                     d_macroscopic_total_cs_evaluation_functor,
-                                     s_total_cs_evaluation_functor );
+  if( d_unionized_energy_grid_mode == FULL_UNIONIZED_ENERGY_GRID &&
+      this->isEnergyWithinUnionizedEnergyGrid( energy ) )
+  {
+    return this->sampleCollisionScatteringCenterUnionized( energy );
+  }
+  else
+  {
+    MacroscopicCrossSectionCache& cache = this->getCrossSectionCache( energy );
+
+    if( cache.areCumulativeCrossSectionsCached() )
+      cache.recordHit();
+    else
+    {
+      cache.recordMiss();
+
+      this->cacheCumulativeCrossSections( energy, cache );
+    }
+
+    return this->sampleCollisionScatteringCenter(
+                                         cache.getCumulativeCrossSections() );
+  }
+}
+
+// Sample the atom that is collided with using the cumulative cross sections
+template<typename ScatteringCenter>
+size_t Material<ScatteringCenter>::sampleCollisionScatteringCenter(
+            const std::vector<double>& cumulative_total_cross_sections ) const
+{
+  // Make sure the cumulative cross sections are valid
+  testPrecondition( cumulative_total_cross_sections.size() ==
+                    d_scattering_centers.size() );
+
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    cumulative_total_cross_sections.back();
+
+  const size_t collision_scattering_center_index =
+    std::upper_bound( cumulative_total_cross_sections.begin(),
+                      cumulative_total_cross_sections.end(),
+                      scaled_random_number ) -
+    cumulative_total_cross_sections.begin();
+
+  // Make sure a collision index was found
+  testPostcondition( collision_scattering_center_index <
+                     d_scattering_centers.size() );
+
+  return collision_scattering_center_index;
+}
+
+// Get the macroscopic cross section cache (current for the energy)
+template<typename ScatteringCenter>
+inline MacroscopicCrossSectionCache&
+Material<ScatteringCenter>::getCrossSectionCache( const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( !QT::isnaninf( energy ) );
+  testPrecondition( energy > 0.0 );
+
+  MacroscopicCrossSectionCache& cache =
+    MacroscopicCrossSectionCache::getThreadCache();
+
+  if( !cache.isCurrent( d_cache_key, energy ) )
+    cache.makeCurrent( d_cache_key, energy );
+
+  return cache;
+}
+
+// Cache the cumulative scattering center total cross sections
+/*! \details The last cumulative cross section is identical to the value
+ * returned by getMacroscopicCrossSection with the total cross section
+ * evaluation functor. If the hashed unionized energy grid can be used the
+ * scattering center energy grids will not be searched.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::cacheCumulativeCrossSections(
+                                   const double energy,
+                                   MacroscopicCrossSectionCache& cache ) const
+{
+  std::vector<double>& cumulative_cross_sections =
+    cache.getCumulativeCrossSectionsToCache();
+
+  cumulative_cross_sections.resize( d_scattering_centers.size() );
+
+  double partial_total_cs = 0.0;
+
+  if( d_unionized_energy_grid_mode == HASHED_UNIONIZED_ENERGY_GRID &&
+      this->isEnergyWithinUnionizedEnergyGrid( energy ) )
+  {
+    const unsigned* scattering_center_indices =
+      this->getUnionizedEnergyGridIndices( energy );
+
+    for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+    {
+      partial_total_cs += Utility::get<0>( d_scattering_centers[i] )*
+        Utility::get<1>( d_scattering_centers[i] )->getTotalCrossSection(
+                                              energy,
+                                              scattering_center_indices[i] );
+
+      cumulative_cross_sections[i] = partial_total_cs;
+    }
+  }
+  else
+  {
+    for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+    {
+      partial_total_cs += Utility::get<0>( d_scattering_centers[i] )*
+        s_total_cs_evaluation_functor( *Utility::get<1>( d_scattering_centers[i] ),
+                                       energy );
+
+      cumulative_cross_sections[i] = partial_total_cs;
+    }
+  }
+
+  cache.cacheCumulativeCrossSections();
+}
+
+// Sample the atom that is collided with using the unionized cross sections
+/*! \details The cumulative scattering center cross sections at the
+ * bounding grid points are interpolated as they are searched. The energy grid
+ * only needs to be searched once. The last interpolated cumulative cross
+ * section is identical to the macroscopic total cross section.
+ */
+template<typename ScatteringCenter>
+size_t Material<ScatteringCenter>::sampleCollisionScatteringCenterUnionized(
+                                                    const double energy ) const
+{
+  const size_t energy_index =
+    d_unionized_energy_grid_searcher->findLowerBinIndexIncludingUpperBound(
+                                                                      energy );
+
+  const double lower_energy = (*d_unionized_energy_grid)[energy_index];
+  const double upper_energy = (*d_unionized_energy_grid)[energy_index+1];
+
+  const double* lower_cumulative_cs =
+    &d_unionized_cumulative_cross_sections[energy_index*d_scattering_centers.size()];
+  const double* upper_cumulative_cs =
+    lower_cumulative_cs + d_scattering_centers.size();
+
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    Utility::LinLin::interpolate( lower_energy,
+                                  upper_energy,
+                                  energy,
+                                  lower_cumulative_cs[d_scattering_centers.size()-1],
+                                  upper_cumulative_cs[d_scattering_centers.size()-1] );
+
+  size_t collision_scattering_center_index =
+    std::numeric_limits<size_t>::max();
+
+  for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+  {
+    const double partial_total_cs =
+      Utility::LinLin::interpolate( lower_energy,
+                                    upper_energy,
+                                    energy,
+                                    lower_cumulative_cs[i],
+                                    upper_cumulative_cs[i] );
+
+    if( scaled_random_number < partial_total_cs )
+    {
+      collision_scattering_center_index = i;
+
+      break;
+    }
+  }
+
+  // Make sure a collision index was found
+  testPostcondition( collision_scattering_center_index !=
+		     std::numeric_limits<size_t>::max() );
+
+  return collision_scattering_center_index;
+}
+
+// Check if an energy can be looked up on the unionized energy grid
+template<typename ScatteringCenter>
+inline bool Material<ScatteringCenter>::isEnergyWithinUnionizedEnergyGrid(
+                                                    const double energy ) const
+{
+  if( d_unionized_energy_grid_mode != NO_UNIONIZED_ENERGY_GRID )
+    return d_unionized_energy_grid_searcher->isValueWithinGridBounds( energy );
+  else
+    return false;
+}
+
+// Return the scattering center energy grid indices for the energy
+/*! \details The indices are only stored in hashed mode.
+ */
+template<typename ScatteringCenter>
+inline const unsigned*
+Material<ScatteringCenter>::getUnionizedEnergyGridIndices(
+                                                    const double energy ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyWithinUnionizedEnergyGrid( energy ) );
+  // Make sure the indices have been stored
+  testPrecondition( d_unionized_energy_grid_mode ==
+                    HASHED_UNIONIZED_ENERGY_GRID );
+
+  const size_t energy_index =
+    d_unionized_energy_grid_searcher->findLowerBinIndexIncludingUpperBound(
+                                                                      energy );
+
+  return &d_unionized_energy_grid_indices[energy_index*d_scattering_centers.size()];
+}
+
+// Evaluate a cross section that is stored on the unionized energy grid
+template<typename ScatteringCenter>
+inline double Material<ScatteringCenter>::evaluateOnUnionizedEnergyGrid(
+                              const double energy,
+                              const std::vector<double>& cross_section ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( this->isEnergyWithinUnionizedEnergyGrid( energy ) );
+
+  const size_t energy_index =
+    d_unionized_energy_grid_searcher->findLowerBinIndexIncludingUpperBound(
+                                                                      energy );
+
+  return Utility::LinLin::interpolate(
+                                 (*d_unionized_energy_grid)[energy_index],
+                                 (*d_unionized_energy_grid)[energy_index+1],
+                                 energy,
+                                 cross_section[energy_index],
+                                 cross_section[energy_index+1] );
 }
 
 } // end MonteCarlo namespace
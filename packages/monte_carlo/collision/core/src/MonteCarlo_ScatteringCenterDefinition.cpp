@@ -33,7 +33,8 @@ ScatteringCenterDefinition::ScatteringCenterDefinition(
   : d_name( name ),
     d_zaid( zaid ),
     d_atomic_weight_ratio(),
-    d_temperature()
+    d_temperature(),
+    d_doppler_broadening_temperature()
 {
   // White space characters are not allowed in scattering center names
   TEST_FOR_EXCEPTION( d_name.empty(),
@@ -102,6 +103,39 @@ double ScatteringCenterDefinition::getAtomicWeightRatio() const
   return d_atomic_weight_ratio.value();
 }
 
+// Check if a Doppler broadening temperature has been set
+/*! \details If the Doppler broadening temperature is set the nuclear data
+ * of the scattering center will be Doppler broadened on-the-fly from the
+ * evaluation temperature to the Doppler broadening temperature (instead of
+ * loading a separate data table for every temperature of interest).
+ */
+bool ScatteringCenterDefinition::isDopplerBroadeningTemperatureSet() const
+{
+  return d_doppler_broadening_temperature != boost::none;
+}
+
+// Set the Doppler broadening temperature (MeV)
+void ScatteringCenterDefinition::setDopplerBroadeningTemperature(
+                                                     const double temperature )
+{
+  TEST_FOR_EXCEPTION( temperature <= 0.0,
+                      std::runtime_error,
+                      "The Doppler broadening temperature must be greater "
+                      "than 0.0!" );
+
+  d_doppler_broadening_temperature = temperature;
+}
+
+// Get the Doppler broadening temperature (MeV)
+double ScatteringCenterDefinition::getDopplerBroadeningTemperature() const
+{
+  TEST_FOR_EXCEPTION( !this->isDopplerBroadeningTemperatureSet(),
+                      std::runtime_error,
+                      "The Doppler broadening temperature has not been set!" );
+
+  return d_doppler_broadening_temperature.value();
+}
+
 // Check if there are photoatomic data properties
 bool ScatteringCenterDefinition::hasPhotoatomicDataProperties() const
 {
@@ -755,6 +789,12 @@ void ScatteringCenterDefinition::toStream( std::ostream& os ) const
 
   os << indent << "zaid: " << d_zaid << "\n";
 
+  if( this->isDopplerBroadeningTemperatureSet() )
+  {
+    os << indent << "Doppler broadening temperature: "
+       << d_doppler_broadening_temperature.value() << " MeV\n";
+  }
+
   Details::atomicDataPropertiesToStreamImpl( os, "photoatomic data", indent, d_zaid, d_photoatomic_data_properties );
   Details::atomicDataPropertiesToStreamImpl( os, "adjoint photoatomic data", indent, d_zaid, d_adjoint_photoatomic_data_properties );
   Details::atomicDataPropertiesToStreamImpl( os, "electroatomic data", indent, d_zaid, d_electroatomic_data_properties );
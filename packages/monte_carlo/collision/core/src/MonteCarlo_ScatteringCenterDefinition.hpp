@@ -70,6 +70,15 @@ public:
   //! Get the atomic weight ratio override
   double getAtomicWeightRatio() const;
 
+  //! Check if a Doppler broadening temperature has been set
+  bool isDopplerBroadeningTemperatureSet() const;
+
+  //! Set the Doppler broadening temperature (MeV)
+  void setDopplerBroadeningTemperature( const double temperature );
+
+  //! Get the Doppler broadening temperature (MeV)
+  double getDopplerBroadeningTemperature() const;
+
   //! Check if there are photoatomic data properties
   bool hasPhotoatomicDataProperties() const;
 
@@ -256,6 +265,9 @@ private:
   // The scattering center temperature
   boost::optional<Data::NuclearDataProperties::Energy> d_temperature;
 
+  // The Doppler broadening temperature (MeV)
+  boost::optional<double> d_doppler_broadening_temperature;
+
   // The photoatomic data properties
   std::shared_ptr<const Data::PhotoatomicDataProperties> d_photoatomic_data_properties;
 
@@ -330,6 +342,7 @@ void ScatteringCenterDefinition::save( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_thermal_nuclear_data_properties );
   ar & BOOST_SERIALIZATION_NVP( d_photonuclear_data_properties );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_photonuclear_data_properties );
+  ar & BOOST_SERIALIZATION_NVP( d_doppler_broadening_temperature );
 }
 
 // Load the object from an archive
@@ -351,11 +364,17 @@ void ScatteringCenterDefinition::load( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_thermal_nuclear_data_properties );
   ar & BOOST_SERIALIZATION_NVP( d_photonuclear_data_properties );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_photonuclear_data_properties );
+
+  // The Doppler broadening temperature was added in version 1
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_doppler_broadening_temperature );
+  else
+    d_doppler_broadening_temperature = boost::none;
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ScatteringCenterDefinition, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ScatteringCenterDefinition, MonteCarlo, 1 );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, ScatteringCenterDefinition );
 
 #endif // end MONTE_CARLO_SCATTERING_CENTER_DEFINITION_HPP
@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstMacroscopicCrossSectionCache.cpp
+//! \author Alex Robinson
+//! \brief  Macroscopic cross section cache unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_MacroscopicCrossSectionCache.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that unique keys can be created
+FRENSIE_UNIT_TEST( MacroscopicCrossSectionCache, createKey )
+{
+  unsigned long long key_a = MonteCarlo::MacroscopicCrossSectionCache::createKey();
+  unsigned long long key_b = MonteCarlo::MacroscopicCrossSectionCache::createKey();
+
+  FRENSIE_CHECK( key_a > 0ull );
+  FRENSIE_CHECK( key_b > 0ull );
+  FRENSIE_CHECK( key_a != key_b );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cache can be made current for a key and energy
+FRENSIE_UNIT_TEST( MacroscopicCrossSectionCache, makeCurrent )
+{
+  unsigned long long key = MonteCarlo::MacroscopicCrossSectionCache::createKey();
+
+  MonteCarlo::MacroscopicCrossSectionCache& cache =
+    MonteCarlo::MacroscopicCrossSectionCache::getThreadCache();
+
+  FRENSIE_CHECK( !cache.isCurrent( key, 1.0 ) );
+
+  cache.makeCurrent( key, 1.0 );
+
+  FRENSIE_CHECK( cache.isCurrent( key, 1.0 ) );
+  FRENSIE_CHECK( !cache.isCurrent( key, 2.0 ) );
+  FRENSIE_CHECK( !cache.isCurrent( key+1, 1.0 ) );
+  FRENSIE_CHECK( !cache.isTotalCrossSectionCached() );
+  FRENSIE_CHECK( !cache.isAbsorptionCrossSectionCached() );
+  FRENSIE_CHECK( !cache.areCumulativeCrossSectionsCached() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that cross sections can be cached
+FRENSIE_UNIT_TEST( MacroscopicCrossSectionCache, cacheCrossSections )
+{
+  unsigned long long key = MonteCarlo::MacroscopicCrossSectionCache::createKey();
+
+  MonteCarlo::MacroscopicCrossSectionCache& cache =
+    MonteCarlo::MacroscopicCrossSectionCache::getThreadCache();
+
+  cache.makeCurrent( key, 1.0 );
+
+  cache.cacheTotalCrossSection( 3.0 );
+
+  FRENSIE_CHECK( cache.isTotalCrossSectionCached() );
+  FRENSIE_CHECK_EQUAL( cache.getTotalCrossSection(), 3.0 );
+
+  cache.cacheAbsorptionCrossSection( 0.5 );
+
+  FRENSIE_CHECK( cache.isAbsorptionCrossSectionCached() );
+  FRENSIE_CHECK_EQUAL( cache.getAbsorptionCrossSection(), 0.5 );
+
+  std::vector<double>& cumulative_cross_sections =
+    cache.getCumulativeCrossSectionsToCache();
+
+  cumulative_cross_sections.assign( {1.0, 2.5, 3.0} );
+
+  FRENSIE_CHECK( !cache.areCumulativeCrossSectionsCached() );
+
+  cache.cacheCumulativeCrossSections();
+
+  FRENSIE_CHECK( cache.areCumulativeCrossSectionsCached() );
+  FRENSIE_CHECK_EQUAL( cache.getCumulativeCrossSections(),
+                       std::vector<double>( {1.0, 2.5, 3.0} ) );
+
+  // Changing the energy must discard the cached values
+  cache.makeCurrent( key, 2.0 );
+
+  FRENSIE_CHECK( !cache.isTotalCrossSectionCached() );
+  FRENSIE_CHECK( !cache.isAbsorptionCrossSectionCached() );
+  FRENSIE_CHECK( !cache.areCumulativeCrossSectionsCached() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cache statistics of every thread are recorded
+FRENSIE_UNIT_TEST( MacroscopicCrossSectionCache, statistics )
+{
+  MonteCarlo::MacroscopicCrossSectionCache::resetStatistics();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfHits(), 0ull );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfMisses(), 0ull );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getHitRate(), 0.0 );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  #pragma omp parallel num_threads( threads )
+  {
+    MonteCarlo::MacroscopicCrossSectionCache& cache =
+      MonteCarlo::MacroscopicCrossSectionCache::getThreadCache();
+
+    cache.recordMiss();
+    cache.recordHit();
+    cache.recordHit();
+    cache.recordHit();
+  }
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfHits(),
+                       3ull*threads );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfMisses(),
+                       threads );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::MacroscopicCrossSectionCache::getHitRate(),
+                                   0.75,
+                                   1e-15 );
+
+  std::ostringstream oss;
+
+  MonteCarlo::MacroscopicCrossSectionCache::printStatistics( oss );
+
+  FRENSIE_CHECK( oss.str().find( "hit rate" ) != std::string::npos );
+
+  MonteCarlo::MacroscopicCrossSectionCache::resetStatistics();
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfHits(), 0ull );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfMisses(), 0ull );
+}
+
+//---------------------------------------------------------------------------//
+// end tstMacroscopicCrossSectionCache.cpp
+//---------------------------------------------------------------------------//
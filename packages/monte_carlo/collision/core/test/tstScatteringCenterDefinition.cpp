@@ -453,6 +453,26 @@ FRENSIE_UNIT_TEST( ScatteringCenterDefintion, setAtomicWeightRatio )
   FRENSIE_CHECK_FLOATING_EQUALITY( definition.getAtomicWeight(), 1.0, 1e-15 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the Doppler broadening temperature can be set
+FRENSIE_UNIT_TEST( ScatteringCenterDefinition,
+                   setDopplerBroadeningTemperature )
+{
+  MonteCarlo::ScatteringCenterDefinition definition( "U238-900K", 92238 );
+
+  FRENSIE_CHECK( !definition.isDopplerBroadeningTemperatureSet() );
+  FRENSIE_CHECK_THROW( definition.getDopplerBroadeningTemperature(),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( definition.setDopplerBroadeningTemperature( 0.0 ),
+                       std::runtime_error );
+
+  definition.setDopplerBroadeningTemperature( 7.7556e-8 );
+
+  FRENSIE_CHECK( definition.isDopplerBroadeningTemperatureSet() );
+  FRENSIE_CHECK_EQUAL( definition.getDopplerBroadeningTemperature(),
+                       7.7556e-8 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that photoatomic data properties can be set
 FRENSIE_UNIT_TEST( ScatteringCenterDefinition, setPhotoatomicDataProperties )
@@ -1262,6 +1282,8 @@ FRENSIE_UNIT_TEST( ScatteringCenterDefinition, toStream )
     h1_definition.setDataProperties( properties );
   }
 
+  h1_definition.setDopplerBroadeningTemperature( 2.53010e-8 );
+
   FRENSIE_CHECK_NO_THROW( std::cout << h_definition << std::endl; );
   FRENSIE_CHECK_NO_THROW( std::cout << h1_definition << std::endl; );
 }
@@ -1290,6 +1312,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ScatteringCenterDefinition,
     
     MonteCarlo::ScatteringCenterDefinition h1_definition( "H1-293.1K", 1001 );
     h1_definition.setAtomicWeight( 1.0 );
+    h1_definition.setDopplerBroadeningTemperature( 2.53010e-8 );
 
     {
       std::shared_ptr<const Data::PhotoatomicDataProperties> properties(
@@ -1432,6 +1455,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ScatteringCenterDefinition,
   FRENSIE_CHECK_EQUAL( h_definition.getName(), "H" );
   FRENSIE_CHECK_EQUAL( h_definition.getZAID(), Data::ZAID(1000) );
   FRENSIE_CHECK( !h_definition.isAtomicWeightSet() );
+  FRENSIE_CHECK( !h_definition.isDopplerBroadeningTemperatureSet() );
   FRENSIE_REQUIRE( h_definition.hasPhotoatomicDataProperties() );
   FRENSIE_REQUIRE( h_definition.hasAdjointPhotoatomicDataProperties() );
   FRENSIE_REQUIRE( h_definition.hasElectroatomicDataProperties() );
@@ -1447,6 +1471,9 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ScatteringCenterDefinition,
   FRENSIE_CHECK_EQUAL( h1_definition.getZAID(), Data::ZAID(1001) );
   FRENSIE_REQUIRE( h1_definition.isAtomicWeightSet() );
   FRENSIE_CHECK_EQUAL( h1_definition.getAtomicWeight(), 1.0 );
+  FRENSIE_REQUIRE( h1_definition.isDopplerBroadeningTemperatureSet() );
+  FRENSIE_CHECK_EQUAL( h1_definition.getDopplerBroadeningTemperature(),
+                       2.53010e-8 );
   FRENSIE_REQUIRE( h1_definition.hasPhotoatomicDataProperties() );
   FRENSIE_REQUIRE( h1_definition.hasAdjointPhotoatomicDataProperties() );
   FRENSIE_REQUIRE( h1_definition.hasElectroatomicDataProperties() );
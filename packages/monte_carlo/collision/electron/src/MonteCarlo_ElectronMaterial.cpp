@@ -8,17 +8,26 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <limits>
+#include <cmath>
 
 // FRENSIE Includes
 #include "MonteCarlo_ElectronMaterial.hpp"
 #include "MonteCarlo_MaterialHelpers.hpp"
+#include "MonteCarlo_GoudsmitSaundersonMultipleScatteringHelpers.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const size_t ElectronMaterial::s_condensed_history_grid_points_per_decade = 20;
+const size_t ElectronMaterial::s_max_legendre_order = 128;
+
 // Constructor
 ElectronMaterial::ElectronMaterial(
                             const MaterialId id,
@@ -33,6 +42,501 @@ ElectronMaterial::ElectronMaterial(
               electroatom_names )
 { /* ... */ }
 
+// Construct the condensed history data
+/*! \details The elastic and atomic excitation reactions of every electroatom
+ * will be treated as condensed history (continuous) reactions. The elastic
+ * transport cross sections (used to construct the Goudsmit-Saunderson
+ * multiple scattering distribution) and the restricted stopping power (from
+ * the atomic excitation energy loss) are tabulated on a log spaced energy
+ * grid between the min and max energy. The moment preserving and hybrid
+ * elastic reactions have a discrete angular distribution that cannot be
+ * condensed - an exception will be thrown if either is present.
+ */
+void ElectronMaterial::constructCondensedHistoryData( const double min_energy,
+                                                      const double max_energy )
+{
+  // Make sure the energies are valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( max_energy > min_energy );
+
+  // Make sure that all of the elastic reactions can be condensed
+  for( size_t j = 0; j < this->getNumberOfScatteringCenters(); ++j )
+  {
+    const Electroatom::ConstReactionMap& scattering_reactions =
+      this->getScatteringCenter( j ).getCore().getScatteringReactions();
+
+    Electroatom::ConstReactionMap::const_iterator reaction_it =
+      scattering_reactions.begin();
+
+    while( reaction_it != scattering_reactions.end() )
+    {
+      TEST_FOR_EXCEPTION( reaction_it->first == HYBRID_ELASTIC_ELECTROATOMIC_REACTION ||
+                          reaction_it->first == MOMENT_PRESERVING_ELASTIC_ELECTROATOMIC_REACTION,
+                          std::runtime_error,
+                          "The condensed history data for material "
+                          << this->getId() << " cannot be constructed "
+                          "because electroatom "
+                          << this->getScatteringCenter( j ).getAtomName() <<
+                          " uses the " << reaction_it->first << " reaction!" );
+
+      ++reaction_it;
+    }
+  }
+
+  // Create the energy grid
+  const double energy_grid_decades = std::log10( max_energy/min_energy );
+
+  const size_t energy_grid_bins = std::max( (size_t)std::ceil(
+        energy_grid_decades*s_condensed_history_grid_points_per_decade ),
+                                            (size_t)1 );
+
+  d_condensed_history_energy_grid.resize( energy_grid_bins+1 );
+
+  for( size_t i = 0; i <= energy_grid_bins; ++i )
+  {
+    d_condensed_history_energy_grid[i] = min_energy*
+      std::pow( 10.0, i*energy_grid_decades/energy_grid_bins );
+  }
+
+  d_condensed_history_energy_grid.back() = max_energy;
+
+  // Calculate the macroscopic elastic transport cross sections
+  d_transport_cross_sections.clear();
+  d_transport_cross_sections.resize(
+                                  d_condensed_history_energy_grid.size(),
+                                  std::vector<double>( s_max_legendre_order+1,
+                                                       0.0 ) );
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < d_condensed_history_energy_grid.size(); ++i )
+  {
+    const double energy = d_condensed_history_energy_grid[i];
+
+    std::vector<double> atomic_transport_cross_sections;
+
+    for( size_t j = 0; j < this->getNumberOfScatteringCenters(); ++j )
+    {
+      const Electroatom::ConstReactionMap& scattering_reactions =
+        this->getScatteringCenter( j ).getCore().getScatteringReactions();
+
+      Electroatom::ConstReactionMap::const_iterator reaction_it =
+        scattering_reactions.begin();
+
+      while( reaction_it != scattering_reactions.end() )
+      {
+        if( reaction_it->first != ATOMIC_EXCITATION_ELECTROATOMIC_REACTION &&
+            ThisType::isCondensedHistoryReaction( reaction_it->first ) &&
+            reaction_it->second->getCrossSection( energy ) > 0.0 )
+        {
+          const ElectroatomicReaction& reaction = *reaction_it->second;
+
+          calculateElasticTransportCrossSections(
+                          [&reaction, energy]( const double angle_cosine ){
+                            return reaction.getDifferentialCrossSection(
+                                                  energy, angle_cosine ); },
+                          s_max_legendre_order,
+                          atomic_transport_cross_sections );
+
+          const double number_density =
+            this->getScatteringCenterNumberDensity( j );
+
+          for( size_t l = 0; l <= s_max_legendre_order; ++l )
+          {
+            d_transport_cross_sections[i][l] +=
+              number_density*atomic_transport_cross_sections[l];
+          }
+        }
+
+        ++reaction_it;
+      }
+    }
+  }
+
+  // Calculate the restricted stopping power (the atomic excitation energy
+  // loss is deterministic so a single probe electron is sufficient)
+  d_restricted_stopping_power.clear();
+  d_restricted_stopping_power.resize( d_condensed_history_energy_grid.size(),
+                                      0.0 );
+
+  for( size_t i = 0; i < d_condensed_history_energy_grid.size(); ++i )
+  {
+    const double energy = d_condensed_history_energy_grid[i];
+
+    for( size_t j = 0; j < this->getNumberOfScatteringCenters(); ++j )
+    {
+      const Electroatom::ConstReactionMap& scattering_reactions =
+        this->getScatteringCenter( j ).getCore().getScatteringReactions();
+
+      Electroatom::ConstReactionMap::const_iterator reaction_it =
+        scattering_reactions.find( ATOMIC_EXCITATION_ELECTROATOMIC_REACTION );
+
+      if( reaction_it != scattering_reactions.end() )
+      {
+        const double cross_section =
+          reaction_it->second->getCrossSection( energy );
+
+        if( cross_section > 0.0 )
+        {
+          ElectronState probe( 0 );
+          probe.setEnergy( energy );
+          probe.setDirection( 0.0, 0.0, 1.0 );
+
+          ParticleBank probe_bank;
+          Data::SubshellType shell_of_interaction;
+
+          reaction_it->second->react( probe, probe_bank, shell_of_interaction );
+
+          d_restricted_stopping_power[i] +=
+            this->getScatteringCenterNumberDensity( j )*cross_section*
+            (energy - probe.getEnergy());
+        }
+      }
+    }
+  }
+}
+
+// Check if the condensed history data has been constructed
+bool ElectronMaterial::hasCondensedHistoryData() const
+{
+  return !d_condensed_history_energy_grid.empty();
+}
+
+// Return the macroscopic hard collision cross section (1/cm)
+/*! \details The hard collision cross section is the macroscopic total
+ * cross section minus the cross sections of the condensed history reactions.
+ */
+double ElectronMaterial::getMacroscopicHardCollisionCrossSection(
+                                                   const double energy ) const
+{
+  return this->getMacroscopicCrossSection(
+                                 energy,
+                                 &ThisType::getAtomicHardCollisionCrossSection );
+}
+
+// Return the macroscopic condensed elastic cross section (1/cm)
+double ElectronMaterial::getMacroscopicCondensedElasticCrossSection(
+                                                   const double energy ) const
+{
+  // Make sure the condensed history data has been constructed
+  testPrecondition( this->hasCondensedHistoryData() );
+
+  double interpolation_fraction;
+
+  const size_t bin_index =
+    this->findCondensedHistoryEnergyBin( energy, interpolation_fraction );
+
+  return ThisType::interpolateCondensedHistoryData(
+                               d_transport_cross_sections[bin_index][0],
+                               d_transport_cross_sections[bin_index+1][0],
+                               interpolation_fraction );
+}
+
+// Return the restricted stopping power (MeV/cm)
+double ElectronMaterial::getRestrictedStoppingPower( const double energy ) const
+{
+  // Make sure the condensed history data has been constructed
+  testPrecondition( this->hasCondensedHistoryData() );
+
+  double interpolation_fraction;
+
+  const size_t bin_index =
+    this->findCondensedHistoryEnergyBin( energy, interpolation_fraction );
+
+  return ThisType::interpolateCondensedHistoryData(
+                                      d_restricted_stopping_power[bin_index],
+                                      d_restricted_stopping_power[bin_index+1],
+                                      interpolation_fraction );
+}
+
+// Return the max condensed history step length (cm)
+/*! \details The max step length is the path length over which the
+ * continuous energy loss will be approximately equal to the max energy loss
+ * fraction times the energy. If there is no continuous energy loss the
+ * max double value will be returned.
+ */
+double ElectronMaterial::getMaxCondensedHistoryStepLength(
+                                  const double energy,
+                                  const double max_energy_loss_fraction ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure the max energy loss fraction is valid
+  testPrecondition( max_energy_loss_fraction > 0.0 );
+  testPrecondition( max_energy_loss_fraction < 1.0 );
+
+  const double stopping_power = this->getRestrictedStoppingPower( energy );
+
+  if( stopping_power > 0.0 )
+    return max_energy_loss_fraction*energy/stopping_power;
+  else
+    return std::numeric_limits<double>::max();
+}
+
+// Return the energy after continuous slowing down along a path (MeV)
+/*! \details The energy loss is calculated with the stopping power evaluated
+ * at the estimated midpoint energy of the path, which is second order
+ * accurate in the path length.
+ */
+double ElectronMaterial::getEnergyAfterContinuousSlowingDown(
+                                               const double energy,
+                                               const double path_length ) const
+{
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure the path length is valid
+  testPrecondition( path_length >= 0.0 );
+
+  const double initial_stopping_power =
+    this->getRestrictedStoppingPower( energy );
+
+  if( initial_stopping_power <= 0.0 )
+    return energy;
+
+  const double midpoint_energy =
+    energy - 0.5*path_length*initial_stopping_power;
+
+  if( midpoint_energy <= 0.0 )
+    return 0.0;
+
+  const double final_energy = energy -
+    path_length*this->getRestrictedStoppingPower( midpoint_energy );
+
+  return std::max( final_energy, 0.0 );
+}
+
+// Sample a multiple scattering angle cosine along a path
+double ElectronMaterial::sampleMultipleScatteringAngleCosine(
+                                               const double energy,
+                                               const double path_length ) const
+{
+  // Make sure the condensed history data has been constructed
+  testPrecondition( this->hasCondensedHistoryData() );
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+  // Make sure the path length is valid
+  testPrecondition( path_length >= 0.0 );
+
+  double interpolation_fraction;
+
+  const size_t bin_index =
+    this->findCondensedHistoryEnergyBin( energy, interpolation_fraction );
+
+  std::vector<double> transport_cross_sections( s_max_legendre_order+1 );
+
+  for( size_t l = 0; l <= s_max_legendre_order; ++l )
+  {
+    transport_cross_sections[l] =
+      ThisType::interpolateCondensedHistoryData(
+                                 d_transport_cross_sections[bin_index][l],
+                                 d_transport_cross_sections[bin_index+1][l],
+                                 interpolation_fraction );
+  }
+
+  if( transport_cross_sections[0] <= 0.0 )
+    return 1.0;
+
+  return sampleGoudsmitSaundersonAngleCosine( transport_cross_sections,
+                                              path_length );
+}
+
+// Collide with a scattering center (hard collisions only)
+/*! \details Only the reactions that are not treated as condensed history
+ * reactions can be sampled. If an absorption reaction is sampled the
+ * electron will be killed.
+ */
+void ElectronMaterial::collideHardAnalogue( ParticleStateType& particle,
+                                            ParticleBank& bank ) const
+{
+  const double hard_collision_cross_section =
+    this->getMacroscopicHardCollisionCrossSection( particle.getEnergy() );
+
+  if( hard_collision_cross_section <= 0.0 )
+    return;
+
+  const size_t atom_index = this->sampleCollisionScatteringCenterImpl(
+                      particle.getEnergy(),
+                      [hard_collision_cross_section]( const double ){
+                        return hard_collision_cross_section; },
+                      &ThisType::getAtomicHardCollisionCrossSection );
+
+  const Electroatom& atom = this->getScatteringCenter( atom_index );
+
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    ThisType::getAtomicHardCollisionCrossSection( atom, particle.getEnergy() );
+
+  double partial_cross_section = 0.0;
+
+  Data::SubshellType subshell_vacancy = Data::UNKNOWN_SUBSHELL;
+
+  // Check if an absorption reaction occurs
+  const Electroatom::ConstReactionMap& absorption_reactions =
+    atom.getCore().getAbsorptionReactions();
+
+  Electroatom::ConstReactionMap::const_iterator reaction_it =
+    absorption_reactions.begin();
+
+  while( reaction_it != absorption_reactions.end() )
+  {
+    partial_cross_section +=
+      reaction_it->second->getCrossSection( particle.getEnergy() );
+
+    if( scaled_random_number < partial_cross_section )
+    {
+      reaction_it->second->react( particle, bank, subshell_vacancy );
+
+      atom.relaxAtom( subshell_vacancy, particle, bank );
+
+      // Set the particle as gone regardless of the reaction that occurred
+      particle.setAsGone();
+
+      return;
+    }
+
+    ++reaction_it;
+  }
+
+  // Sample a hard scattering reaction
+  const Electroatom::ConstReactionMap& scattering_reactions =
+    atom.getCore().getScatteringReactions();
+
+  Electroatom::ConstReactionMap::const_iterator sampled_reaction_it =
+    scattering_reactions.end();
+
+  reaction_it = scattering_reactions.begin();
+
+  while( reaction_it != scattering_reactions.end() )
+  {
+    if( !ThisType::isCondensedHistoryReaction( reaction_it->first ) )
+    {
+      sampled_reaction_it = reaction_it;
+
+      partial_cross_section +=
+        reaction_it->second->getCrossSection( particle.getEnergy() );
+
+      if( scaled_random_number < partial_cross_section )
+        break;
+    }
+
+    ++reaction_it;
+  }
+
+  // Make sure a reaction was found
+  testInvariant( sampled_reaction_it != scattering_reactions.end() );
+
+  sampled_reaction_it->second->react( particle, bank, subshell_vacancy );
+
+  // Relax the atom
+  atom.relaxAtom( subshell_vacancy, particle, bank );
+}
+
+// Check if a reaction type is treated as a condensed history reaction
+bool ElectronMaterial::isCondensedHistoryReaction(
+                                              const ReactionEnumType reaction )
+{
+  switch( reaction )
+  {
+    case COUPLED_ELASTIC_ELECTROATOMIC_REACTION:
+    case HYBRID_ELASTIC_ELECTROATOMIC_REACTION:
+    case DECOUPLED_ELASTIC_ELECTROATOMIC_REACTION:
+    case CUTOFF_ELASTIC_ELECTROATOMIC_REACTION:
+    case SCREENED_RUTHERFORD_ELASTIC_ELECTROATOMIC_REACTION:
+    case MOMENT_PRESERVING_ELASTIC_ELECTROATOMIC_REACTION:
+    case ATOMIC_EXCITATION_ELECTROATOMIC_REACTION:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Return the atomic hard collision cross section
+double ElectronMaterial::getAtomicHardCollisionCrossSection(
+                                                      const Electroatom& atom,
+                                                      const double energy )
+{
+  double cross_section = 0.0;
+
+  const Electroatom::ConstReactionMap& absorption_reactions =
+    atom.getCore().getAbsorptionReactions();
+
+  Electroatom::ConstReactionMap::const_iterator reaction_it =
+    absorption_reactions.begin();
+
+  while( reaction_it != absorption_reactions.end() )
+  {
+    cross_section += reaction_it->second->getCrossSection( energy );
+
+    ++reaction_it;
+  }
+
+  const Electroatom::ConstReactionMap& scattering_reactions =
+    atom.getCore().getScatteringReactions();
+
+  reaction_it = scattering_reactions.begin();
+
+  while( reaction_it != scattering_reactions.end() )
+  {
+    if( !ThisType::isCondensedHistoryReaction( reaction_it->first ) )
+      cross_section += reaction_it->second->getCrossSection( energy );
+
+    ++reaction_it;
+  }
+
+  return cross_section;
+}
+
+// Find the condensed history energy grid bin and interpolation fraction
+/*! \details Energies outside of the grid will be moved to the closest grid
+ * boundary. The interpolation fraction is calculated in log(energy).
+ */
+size_t ElectronMaterial::findCondensedHistoryEnergyBin(
+                                         const double energy,
+                                         double& interpolation_fraction ) const
+{
+  // Make sure the condensed history data has been constructed
+  testPrecondition( this->hasCondensedHistoryData() );
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  if( energy <= d_condensed_history_energy_grid.front() )
+  {
+    interpolation_fraction = 0.0;
+
+    return 0;
+  }
+  else if( energy >= d_condensed_history_energy_grid.back() )
+  {
+    interpolation_fraction = 1.0;
+
+    return d_condensed_history_energy_grid.size()-2;
+  }
+  else
+  {
+    const size_t bin_index = std::min<size_t>(
+                      Utility::Search::binaryLowerBoundIndex(
+                                     d_condensed_history_energy_grid.begin(),
+                                     d_condensed_history_energy_grid.end(),
+                                     energy ),
+                      d_condensed_history_energy_grid.size()-2 );
+
+    interpolation_fraction =
+      std::log( energy/d_condensed_history_energy_grid[bin_index] )/
+      std::log( d_condensed_history_energy_grid[bin_index+1]/
+                d_condensed_history_energy_grid[bin_index] );
+
+    return bin_index;
+  }
+}
+
+// Interpolate a condensed history quantity
+double ElectronMaterial::interpolateCondensedHistoryData(
+                                           const double lower_value,
+                                           const double upper_value,
+                                           const double interpolation_fraction )
+{
+  return lower_value + interpolation_fraction*(upper_value - lower_value);
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 // FRENSIE Includes
 #include "MonteCarlo_Electroatom.hpp"
@@ -31,6 +32,9 @@ class ElectronMaterial : public Material<Electroatom>
   // Typedef for the base type
   typedef Material<Electroatom> BaseType;
 
+  // Typedef for this type
+  typedef ElectronMaterial ThisType;
+
 public:
 
   //! The scattering center type
@@ -61,6 +65,74 @@ public:
   //! Destructor
   ~ElectronMaterial()
   { /* ... */ }
+
+  //! Construct the condensed history data
+  void constructCondensedHistoryData( const double min_energy,
+                                      const double max_energy );
+
+  //! Check if the condensed history data has been constructed
+  bool hasCondensedHistoryData() const;
+
+  //! Return the macroscopic hard collision cross section (1/cm)
+  double getMacroscopicHardCollisionCrossSection( const double energy ) const;
+
+  //! Return the macroscopic condensed elastic cross section (1/cm)
+  double getMacroscopicCondensedElasticCrossSection( const double energy ) const;
+
+  //! Return the restricted stopping power (MeV/cm)
+  double getRestrictedStoppingPower( const double energy ) const;
+
+  //! Return the max condensed history step length (cm)
+  double getMaxCondensedHistoryStepLength(
+                                   const double energy,
+                                   const double max_energy_loss_fraction ) const;
+
+  //! Return the energy after continuous slowing down along a path (MeV)
+  double getEnergyAfterContinuousSlowingDown( const double energy,
+                                              const double path_length ) const;
+
+  //! Sample a multiple scattering angle cosine along a path
+  double sampleMultipleScatteringAngleCosine( const double energy,
+                                              const double path_length ) const;
+
+  //! Collide with a scattering center (hard collisions only)
+  void collideHardAnalogue( ParticleStateType& particle,
+                            ParticleBank& bank ) const;
+
+  //! Check if a reaction type is treated as a condensed history reaction
+  static bool isCondensedHistoryReaction( const ReactionEnumType reaction );
+
+private:
+
+  // Return the atomic hard collision cross section
+  static double getAtomicHardCollisionCrossSection( const Electroatom& atom,
+                                                    const double energy );
+
+  // Find the condensed history energy grid bin and interpolation fraction
+  size_t findCondensedHistoryEnergyBin( const double energy,
+                                        double& interpolation_fraction ) const;
+
+  // Interpolate a condensed history quantity
+  static double interpolateCondensedHistoryData(
+                                          const double lower_value,
+                                          const double upper_value,
+                                          const double interpolation_fraction );
+
+  // The number of condensed history energy grid points per decade
+  static const size_t s_condensed_history_grid_points_per_decade;
+
+  // The max Legendre order of the condensed elastic transport cross sections
+  static const size_t s_max_legendre_order;
+
+  // The condensed history energy grid (log spaced)
+  std::vector<double> d_condensed_history_energy_grid;
+
+  // The macroscopic elastic transport cross sections at each energy grid
+  // point (the zeroth order cross section is the elastic cross section)
+  std::vector<std::vector<double> > d_transport_cross_sections;
+
+  // The restricted stopping power at each energy grid point
+  std::vector<double> d_restricted_stopping_power;
 };
 
 } // end MonteCarlo namespace
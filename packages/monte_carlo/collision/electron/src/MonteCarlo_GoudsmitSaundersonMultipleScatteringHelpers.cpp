@@ -0,0 +1,402 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_GoudsmitSaundersonMultipleScatteringHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Goudsmit-Saunderson multiple scattering helper definitions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_GoudsmitSaundersonMultipleScatteringHelpers.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+namespace{
+
+// The smallest 1-mu value in the transport cross section integration grid
+const double min_transport_integration_grid_value = 1e-12;
+
+// The 1-mu value where the integration grid switches from log to linear
+const double transport_integration_grid_switch_value = 1e-2;
+
+// The number of log spaced integration grid points per decade
+const size_t transport_integration_grid_points_per_decade = 100;
+
+// The number of linear integration grid points per Legendre order
+const size_t transport_integration_grid_points_per_order = 8;
+
+// The min number of linear integration grid points
+const size_t min_linear_transport_integration_grid_points = 256;
+
+// The number of log spaced sampling grid points
+const size_t sampling_grid_points = 256;
+
+// The smallest sampling grid 1-mu value relative to the mean 1-mu value
+const double relative_min_sampling_grid_value = 1e-3;
+
+// The Goudsmit-Saunderson coefficient convergence tolerance
+const double coefficient_tolerance = 1e-6;
+
+// Calculate the Legendre polynomial complements (1-P_l(1-t))
+/*! \details The complements are calculated directly from t=1-mu with the
+ * Bonnet recursion relation rewritten in terms of the complements, which
+ * avoids the cancellation that occurs close to mu=1 when 1-P_l(mu) is
+ * calculated from P_l(mu).
+ */
+void calculateLegendrePolynomialComplements( const double t,
+                                             std::vector<double>& complements )
+{
+  complements[0] = 0.0;
+
+  if( complements.size() > 1 )
+    complements[1] = t;
+
+  for( size_t l = 1; l+1 < complements.size(); ++l )
+  {
+    complements[l+1] = ((2*l+1)*(t + complements[l]*(1.0 - t)) -
+                        l*complements[l-1])/(l+1);
+  }
+}
+
+// Calculate the coefficients of the scattered electron distribution
+/*! \details The coefficient of order l is (exp(-s*sigma_l)-p_0)/(1-p_0),
+ * where p_0 = exp(-s*sigma_el) is the probability that the electron does
+ * not scatter. The method returns true if the coefficients drop below the
+ * convergence tolerance before the max Legendre order is reached.
+ */
+bool calculateGoudsmitSaundersonCoefficients(
+                           const std::vector<double>& transport_cross_sections,
+                           const double path_length,
+                           std::vector<double>& coefficients,
+                           double& unscattered_probability )
+{
+  unscattered_probability =
+    std::exp( -path_length*transport_cross_sections[0] );
+
+  coefficients.assign( 1, 1.0 );
+
+  // The electron cannot scatter
+  if( unscattered_probability >= 1.0 )
+    return true;
+
+  for( size_t l = 1; l < transport_cross_sections.size(); ++l )
+  {
+    coefficients.push_back(
+           (std::exp( -path_length*transport_cross_sections[l] ) -
+            unscattered_probability)/(1.0 - unscattered_probability) );
+
+    if( std::fabs( coefficients.back() ) < coefficient_tolerance )
+      return true;
+  }
+
+  return false;
+}
+
+// Evaluate the transport cross section integrands at a 1-mu value
+void evaluateTransportIntegrand(
+       const std::function<double(const double)>& differential_cross_section,
+       const double t,
+       std::vector<double>& complements,
+       std::vector<double>& integrand )
+{
+  const double dcs = differential_cross_section( std::max( 1.0 - t, -1.0 ) );
+
+  calculateLegendrePolynomialComplements( t, complements );
+
+  integrand[0] = dcs;
+
+  for( size_t l = 1; l < integrand.size(); ++l )
+    integrand[l] = complements[l]*dcs;
+}
+
+// Evaluate the scattered electron distribution series
+double evaluateGoudsmitSaundersonSeries( const std::vector<double>& coefficients,
+                                         const double t,
+                                         std::vector<double>& complements )
+{
+  complements.resize( coefficients.size() );
+
+  calculateLegendrePolynomialComplements( t, complements );
+
+  double value = 0.0;
+
+  for( size_t l = 0; l < coefficients.size(); ++l )
+    value += (l + 0.5)*coefficients[l]*(1.0 - complements[l]);
+
+  return value;
+}
+
+// Evaluate the small angle scattered electron distribution
+/*! \details When the series does not converge (very short paths) the 1-mu
+ * values of the scattered electrons are assumed to be exponentially
+ * distributed (the small angle limit of a Gaussian angular distribution).
+ * The mean 1-mu value is preserved.
+ */
+double evaluateSmallAngleDistribution( const double mean, const double t )
+{
+  return std::exp( -t/mean )/(mean*(1.0 - std::exp( -2.0/mean )));
+}
+
+// Sample from the small angle scattered electron distribution
+double sampleSmallAngleDistribution( const double mean )
+{
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  const double t =
+    -mean*std::log( 1.0 - random_number*(1.0 - std::exp( -2.0/mean )) );
+
+  return std::max( 1.0 - t, -1.0 );
+}
+
+} // end anonymous namespace
+
+// Calculate the elastic transport cross sections of a differential cs
+/*! \details The differential cross section must be with respect to the
+ * scattering angle cosine. The transport cross section of order l is the
+ * integral of (1-P_l(mu)) times the differential cross section. The zeroth
+ * order transport cross section is always zero so the zeroth element of the
+ * array will store the integrated cross section instead. The integrals are
+ * calculated with Simpson's rule on a grid in 1-mu that is logarithmic
+ * close to mu=1 (where elastic scattering is strongly peaked) and fine enough
+ * at large angles to resolve the oscillations of the max order Legendre
+ * polynomial.
+ */
+void calculateElasticTransportCrossSections(
+       const std::function<double(const double)>& differential_cross_section,
+       const size_t max_legendre_order,
+       std::vector<double>& transport_cross_sections )
+{
+  // Make sure the max Legendre order is valid
+  testPrecondition( max_legendre_order > 0 );
+
+  // Create the integration grid (1-mu)
+  std::vector<double> grid( 1, 0.0 );
+
+  const double log_grid_decades =
+    std::log10( transport_integration_grid_switch_value/
+                min_transport_integration_grid_value );
+
+  const size_t log_grid_points = (size_t)std::ceil(
+           log_grid_decades*transport_integration_grid_points_per_decade );
+
+  for( size_t i = 0; i <= log_grid_points; ++i )
+  {
+    grid.push_back( min_transport_integration_grid_value*
+                    std::pow( 10.0, i*log_grid_decades/log_grid_points ) );
+  }
+
+  const size_t linear_grid_points =
+    std::max( (size_t)std::ceil( (2.0 - transport_integration_grid_switch_value)*
+                                 transport_integration_grid_points_per_order*
+                                 max_legendre_order ),
+              min_linear_transport_integration_grid_points );
+
+  for( size_t i = 1; i <= linear_grid_points; ++i )
+  {
+    grid.push_back( transport_integration_grid_switch_value +
+                    i*(2.0 - transport_integration_grid_switch_value)/
+                    linear_grid_points );
+  }
+
+  // Integrate the differential cross section moments
+  transport_cross_sections.assign( max_legendre_order+1, 0.0 );
+
+  std::vector<double> complements( max_legendre_order+1 );
+  std::vector<double> left_integrand( max_legendre_order+1 );
+  std::vector<double> mid_integrand( max_legendre_order+1 );
+  std::vector<double> right_integrand( max_legendre_order+1 );
+
+  evaluateTransportIntegrand( differential_cross_section,
+                              grid.front(),
+                              complements,
+                              left_integrand );
+
+  for( size_t j = 1; j < grid.size(); ++j )
+  {
+    evaluateTransportIntegrand( differential_cross_section,
+                                0.5*(grid[j-1] + grid[j]),
+                                complements,
+                                mid_integrand );
+
+    evaluateTransportIntegrand( differential_cross_section,
+                                grid[j],
+                                complements,
+                                right_integrand );
+
+    const double grid_spacing = grid[j] - grid[j-1];
+
+    for( size_t l = 0; l <= max_legendre_order; ++l )
+    {
+      transport_cross_sections[l] += grid_spacing/6.0*
+        (left_integrand[l] + 4.0*mid_integrand[l] + right_integrand[l]);
+    }
+
+    left_integrand.swap( right_integrand );
+  }
+}
+
+// Evaluate the Goudsmit-Saunderson multiple scattering PDF
+/*! \details The transport cross sections must be macroscopic and stored in
+ * the format returned by the calculateElasticTransportCrossSections method
+ * (the zeroth element stores the elastic cross section). The delta function
+ * at mu=1 from the electrons that do not scatter is not included (the
+ * integral of the returned PDF is the probability that the electron scatters
+ * at least once). If the Legendre series does not converge with the
+ * available transport cross sections (very short paths) the small angle
+ * limit of the distribution will be evaluated instead.
+ */
+double evaluateGoudsmitSaundersonPDF(
+                           const std::vector<double>& transport_cross_sections,
+                           const double path_length,
+                           const double scattering_angle_cosine )
+{
+  // Make sure the transport cross sections are valid
+  testPrecondition( transport_cross_sections.size() > 1 );
+  // Make sure the path length is valid
+  testPrecondition( path_length >= 0.0 );
+  // Make sure the scattering angle cosine is valid
+  testPrecondition( scattering_angle_cosine >= -1.0 );
+  testPrecondition( scattering_angle_cosine <= 1.0 );
+
+  std::vector<double> coefficients;
+  double unscattered_probability;
+
+  const bool converged =
+    calculateGoudsmitSaundersonCoefficients( transport_cross_sections,
+                                             path_length,
+                                             coefficients,
+                                             unscattered_probability );
+
+  if( unscattered_probability >= 1.0 )
+    return 0.0;
+
+  const double t = 1.0 - scattering_angle_cosine;
+
+  if( converged )
+  {
+    std::vector<double> complements;
+
+    return (1.0 - unscattered_probability)*
+      evaluateGoudsmitSaundersonSeries( coefficients, t, complements );
+  }
+  else
+  {
+    return (1.0 - unscattered_probability)*
+      evaluateSmallAngleDistribution( 1.0 - coefficients[1], t );
+  }
+}
+
+// Sample a Goudsmit-Saunderson multiple scattering angle cosine
+/*! \details The transport cross sections must be macroscopic and stored in
+ * the format returned by the calculateElasticTransportCrossSections method.
+ * The electron will not be deflected with the probability that it does not
+ * scatter. Otherwise, the Legendre series of the scattered electron
+ * distribution is tabulated on a grid in 1-mu that is scaled by the mean
+ * 1-mu value and the angle cosine is sampled from the tabulated CDF (any
+ * negative values from the truncation of the series are ignored). If the
+ * series does not converge with the available transport cross sections (very
+ * short paths) the angle cosine will be sampled from the small angle limit of
+ * the distribution instead.
+ */
+double sampleGoudsmitSaundersonAngleCosine(
+                           const std::vector<double>& transport_cross_sections,
+                           const double path_length )
+{
+  // Make sure the transport cross sections are valid
+  testPrecondition( transport_cross_sections.size() > 1 );
+  // Make sure the path length is valid
+  testPrecondition( path_length >= 0.0 );
+
+  std::vector<double> coefficients;
+  double unscattered_probability;
+
+  const bool converged =
+    calculateGoudsmitSaundersonCoefficients( transport_cross_sections,
+                                             path_length,
+                                             coefficients,
+                                             unscattered_probability );
+
+  // Check if the electron is not scattered
+  if( Utility::RandomNumberGenerator::getRandomNumber<double>() <
+      unscattered_probability )
+    return 1.0;
+
+  const double mean = 1.0 - coefficients[1];
+
+  if( mean <= 0.0 )
+    return 1.0;
+
+  if( !converged )
+    return sampleSmallAngleDistribution( mean );
+
+  // Tabulate the scattered electron distribution CDF
+  std::vector<double> grid( sampling_grid_points+1 );
+  std::vector<double> cdf( sampling_grid_points+1 );
+  std::vector<double> complements;
+
+  const double min_grid_value =
+    std::max( relative_min_sampling_grid_value*mean,
+              min_transport_integration_grid_value );
+
+  const double log_grid_range = std::log( 2.0/min_grid_value );
+
+  grid[0] = 0.0;
+  cdf[0] = 0.0;
+
+  double previous_pdf = std::max(
+           evaluateGoudsmitSaundersonSeries( coefficients, 0.0, complements ),
+           0.0 );
+
+  for( size_t i = 1; i <= sampling_grid_points; ++i )
+  {
+    grid[i] = min_grid_value*
+      std::exp( (i-1)*log_grid_range/(sampling_grid_points-1) );
+
+    const double pdf = std::max(
+        evaluateGoudsmitSaundersonSeries( coefficients, grid[i], complements ),
+        0.0 );
+
+    cdf[i] = cdf[i-1] + 0.5*(pdf + previous_pdf)*(grid[i] - grid[i-1]);
+
+    previous_pdf = pdf;
+  }
+
+  if( cdf.back() <= 0.0 )
+    return sampleSmallAngleDistribution( mean );
+
+  // Sample from the tabulated CDF
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*cdf.back();
+
+  const size_t bin_index =
+    std::min<size_t>( Utility::Search::binaryLowerBoundIndex(
+                                                      cdf.begin(),
+                                                      cdf.end(),
+                                                      scaled_random_number ),
+                      sampling_grid_points-1 );
+
+  double t = grid[bin_index];
+
+  if( cdf[bin_index+1] > cdf[bin_index] )
+  {
+    t += (scaled_random_number - cdf[bin_index])/
+      (cdf[bin_index+1] - cdf[bin_index])*
+      (grid[bin_index+1] - grid[bin_index]);
+  }
+
+  return std::max( 1.0 - t, -1.0 );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_GoudsmitSaundersonMultipleScatteringHelpers.cpp
+//---------------------------------------------------------------------------//
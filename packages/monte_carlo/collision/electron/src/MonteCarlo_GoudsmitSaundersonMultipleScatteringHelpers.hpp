@@ -0,0 +1,41 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_GoudsmitSaundersonMultipleScatteringHelpers.hpp
+//! \author Alex Robinson
+//! \brief  Goudsmit-Saunderson multiple scattering helper declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_GOUDSMIT_SAUNDERSON_MULTIPLE_SCATTERING_HELPERS_HPP
+#define MONTE_CARLO_GOUDSMIT_SAUNDERSON_MULTIPLE_SCATTERING_HELPERS_HPP
+
+// Std Lib Includes
+#include <functional>
+#include <vector>
+
+namespace MonteCarlo{
+
+//! Calculate the elastic transport cross sections of a differential cs
+void calculateElasticTransportCrossSections(
+       const std::function<double(const double)>& differential_cross_section,
+       const size_t max_legendre_order,
+       std::vector<double>& transport_cross_sections );
+
+//! Evaluate the Goudsmit-Saunderson multiple scattering PDF
+double evaluateGoudsmitSaundersonPDF(
+                           const std::vector<double>& transport_cross_sections,
+                           const double path_length,
+                           const double scattering_angle_cosine );
+
+//! Sample a Goudsmit-Saunderson multiple scattering angle cosine
+double sampleGoudsmitSaundersonAngleCosine(
+                           const std::vector<double>& transport_cross_sections,
+                           const double path_length );
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_GOUDSMIT_SAUNDERSON_MULTIPLE_SCATTERING_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_GoudsmitSaundersonMultipleScatteringHelpers.hpp
+//---------------------------------------------------------------------------//
@@ -275,6 +275,104 @@ FRENSIE_UNIT_TEST( ElectronMaterial, collideSurvivalBias )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check if a reaction type is treated as a condensed history reaction
+FRENSIE_UNIT_TEST( ElectronMaterial, isCondensedHistoryReaction )
+{
+  FRENSIE_CHECK( MonteCarlo::ElectronMaterial::isCondensedHistoryReaction(
+                          MonteCarlo::CUTOFF_ELASTIC_ELECTROATOMIC_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::ElectronMaterial::isCondensedHistoryReaction(
+                          MonteCarlo::COUPLED_ELASTIC_ELECTROATOMIC_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::ElectronMaterial::isCondensedHistoryReaction(
+                        MonteCarlo::ATOMIC_EXCITATION_ELECTROATOMIC_REACTION ) );
+  FRENSIE_CHECK( !MonteCarlo::ElectronMaterial::isCondensedHistoryReaction(
+                           MonteCarlo::BREMSSTRAHLUNG_ELECTROATOMIC_REACTION ) );
+  FRENSIE_CHECK( !MonteCarlo::ElectronMaterial::isCondensedHistoryReaction(
+                  MonteCarlo::TOTAL_ELECTROIONIZATION_ELECTROATOMIC_REACTION ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the condensed history data can be constructed
+FRENSIE_UNIT_TEST( ElectronMaterial, constructCondensedHistoryData )
+{
+  FRENSIE_CHECK( !material->hasCondensedHistoryData() );
+
+  material->constructCondensedHistoryData( 1e-3, 1.0 );
+
+  FRENSIE_CHECK( material->hasCondensedHistoryData() );
+
+  // The hard collision cross section does not include the condensed reactions
+  const double energy = 1e-2;
+
+  double expected_cross_section =
+    material->getMacroscopicTotalCrossSection( energy ) -
+    material->getMacroscopicReactionCrossSection(
+                      energy,
+                      MonteCarlo::CUTOFF_ELASTIC_ELECTROATOMIC_REACTION ) -
+    material->getMacroscopicReactionCrossSection(
+                      energy,
+                      MonteCarlo::ATOMIC_EXCITATION_ELECTROATOMIC_REACTION );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                 material->getMacroscopicHardCollisionCrossSection( energy ),
+                 expected_cross_section,
+                 1e-12 );
+
+  // The condensed elastic cross section is integrated from the elastic
+  // differential cross section
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+              material->getMacroscopicCondensedElasticCrossSection( 1e-3 ),
+              material->getMacroscopicReactionCrossSection(
+                         1e-3,
+                         MonteCarlo::CUTOFF_ELASTIC_ELECTROATOMIC_REACTION ),
+              1e-3 );
+
+  // The continuous energy loss is limited by the max energy loss fraction
+  const double stopping_power = material->getRestrictedStoppingPower( energy );
+
+  FRENSIE_CHECK( stopping_power > 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+             material->getMaxCondensedHistoryStepLength( energy, 0.05 ),
+             0.05*energy/stopping_power,
+             1e-12 );
+
+  FRENSIE_CHECK_EQUAL(
+           material->getEnergyAfterContinuousSlowingDown( energy, 0.0 ),
+           energy );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+           material->getEnergyAfterContinuousSlowingDown(
+               energy,
+               material->getMaxCondensedHistoryStepLength( energy, 0.05 ) ),
+           0.95*energy,
+           1e-2 );
+
+  // The multiple scattering angle cosine is valid
+  const double angle_cosine =
+    material->sampleMultipleScatteringAngleCosine(
+               energy,
+               material->getMaxCondensedHistoryStepLength( energy, 0.05 ) );
+
+  FRENSIE_CHECK_GREATER_OR_EQUAL( angle_cosine, -1.0 );
+  FRENSIE_CHECK_LESS_OR_EQUAL( angle_cosine, 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a electron can have a hard collision with the material
+FRENSIE_UNIT_TEST( ElectronMaterial, collideHardAnalogue )
+{
+  MonteCarlo::ParticleBank bank;
+
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 1e-2 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+
+  // Only bremsstrahlung and electroionization reactions can occur (energy
+  // is always lost)
+  material->collideHardAnalogue( electron, bank );
+
+  FRENSIE_CHECK( electron.getEnergy() < 1e-2 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
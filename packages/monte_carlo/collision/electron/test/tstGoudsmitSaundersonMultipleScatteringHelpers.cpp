@@ -0,0 +1,299 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstGoudsmitSaundersonMultipleScatteringHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Goudsmit-Saunderson multiple scattering helper unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_GoudsmitSaundersonMultipleScatteringHelpers.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+// The screening parameter of the screened Rutherford test distribution
+const double screening_parameter = 1e-2;
+
+// The screened Rutherford differential cross section (normalized to one)
+double screenedRutherfordDifferentialCrossSection( const double mu )
+{
+  const double a = 2.0*screening_parameter;
+
+  return a*(2.0 + a)/(2.0*(1.0 - mu + a)*(1.0 - mu + a));
+}
+
+// The screened Rutherford transport cross sections (normalized to one)
+std::vector<double> screened_rutherford_transport_cross_sections;
+
+// Integrate a function of the scattering angle cosine (Simpson's rule on a
+// grid in 1-mu that is logarithmic close to mu=1)
+template<typename Function>
+double integrateOverAngleCosine( const Function& function )
+{
+  double integral = 0.0;
+
+  const size_t intervals = 20000;
+  const double min_t = 1e-10;
+  const double log_range = std::log( 2.0/min_t );
+
+  double previous_t = 0.0;
+
+  for( size_t i = 0; i <= intervals; ++i )
+  {
+    const double t = min_t*std::exp( i*log_range/intervals );
+    const double mid_t = 0.5*(t + previous_t);
+
+    integral += (t - previous_t)/6.0*( function( 1.0 - previous_t ) +
+                                       4.0*function( 1.0 - mid_t ) +
+                                       function( 1.0 - t ) );
+
+    previous_t = t;
+  }
+
+  return integral;
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the transport cross sections of an isotropic distribution can be
+// calculated
+FRENSIE_UNIT_TEST( GoudsmitSaundersonMultipleScatteringHelpers,
+                   calculateElasticTransportCrossSections_isotropic )
+{
+  std::vector<double> transport_cross_sections;
+
+  MonteCarlo::calculateElasticTransportCrossSections(
+                                 []( const double mu ){ return 1.0; },
+                                 16,
+                                 transport_cross_sections );
+
+  FRENSIE_REQUIRE_EQUAL( transport_cross_sections.size(), 17 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[0], 2.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[1], 2.0, 1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[2], 2.0, 1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[16], 2.0, 1e-6 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the transport cross sections of a linearly anisotropic
+// distribution can be calculated
+FRENSIE_UNIT_TEST( GoudsmitSaundersonMultipleScatteringHelpers,
+                   calculateElasticTransportCrossSections_linear )
+{
+  std::vector<double> transport_cross_sections;
+
+  MonteCarlo::calculateElasticTransportCrossSections(
+                                 []( const double mu ){ return 0.5*(1.0+mu); },
+                                 4,
+                                 transport_cross_sections );
+
+  FRENSIE_REQUIRE_EQUAL( transport_cross_sections.size(), 5 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[0], 1.0, 1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[1], 2.0/3, 1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[2], 1.0, 1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[4], 1.0, 1e-6 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the transport cross sections of a forward peaked distribution can
+// be calculated
+FRENSIE_UNIT_TEST( GoudsmitSaundersonMultipleScatteringHelpers,
+                   calculateElasticTransportCrossSections_peaked )
+{
+  const std::vector<double>& transport_cross_sections =
+    screened_rutherford_transport_cross_sections;
+
+  const double a = 2.0*screening_parameter;
+
+  // sigma_1 = a(2+a)/2*[ln((2+a)/a) - 2/(2+a)]
+  const double expected_sigma_1 =
+    a*(2.0 + a)/2.0*(std::log( (2.0 + a)/a ) - 2.0/(2.0 + a));
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[0], 1.0, 1e-6 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( transport_cross_sections[1],
+                                   expected_sigma_1,
+                                   1e-6 );
+
+  // The transport cross sections approach the elastic cross section
+  FRENSIE_CHECK( transport_cross_sections[2] > transport_cross_sections[1] );
+  FRENSIE_CHECK( transport_cross_sections.back() > 0.9 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the Goudsmit-Saunderson PDF can be evaluated
+FRENSIE_UNIT_TEST( GoudsmitSaundersonMultipleScatteringHelpers,
+                   evaluateGoudsmitSaundersonPDF )
+{
+  const std::vector<double>& transport_cross_sections =
+    screened_rutherford_transport_cross_sections;
+
+  const double path_length = 20.0;
+
+  const double unscattered_probability =
+    std::exp( -path_length*transport_cross_sections[0] );
+
+  // The integral of the PDF is the probability of scattering
+  double integral = integrateOverAngleCosine(
+    [&]( const double mu ){
+      return MonteCarlo::evaluateGoudsmitSaundersonPDF(
+                        transport_cross_sections, path_length, mu ); } );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( integral,
+                                   1.0 - unscattered_probability,
+                                   1e-4 );
+
+  // The mean angle cosine is exp(-s*sigma_1)
+  double mean_angle_cosine = integrateOverAngleCosine(
+    [&]( const double mu ){
+      return mu*MonteCarlo::evaluateGoudsmitSaundersonPDF(
+                        transport_cross_sections, path_length, mu ); } );
+
+  mean_angle_cosine += unscattered_probability;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   mean_angle_cosine,
+                   std::exp( -path_length*transport_cross_sections[1] ),
+                   1e-4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the small angle Goudsmit-Saunderson PDF can be evaluated
+FRENSIE_UNIT_TEST( GoudsmitSaundersonMultipleScatteringHelpers,
+                   evaluateGoudsmitSaundersonPDF_small_angle )
+{
+  // The series will not converge with only two transport cross sections
+  std::vector<double> transport_cross_sections( 3 );
+  transport_cross_sections[0] =
+    screened_rutherford_transport_cross_sections[0];
+  transport_cross_sections[1] =
+    screened_rutherford_transport_cross_sections[1];
+  transport_cross_sections[2] =
+    screened_rutherford_transport_cross_sections[2];
+
+  const double path_length = 0.5;
+
+  const double unscattered_probability =
+    std::exp( -path_length*transport_cross_sections[0] );
+
+  double integral = integrateOverAngleCosine(
+    [&]( const double mu ){
+      return MonteCarlo::evaluateGoudsmitSaundersonPDF(
+                        transport_cross_sections, path_length, mu ); } );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( integral,
+                                   1.0 - unscattered_probability,
+                                   1e-4 );
+
+  // The mean angle cosine is preserved
+  double mean_angle_cosine = integrateOverAngleCosine(
+    [&]( const double mu ){
+      return mu*MonteCarlo::evaluateGoudsmitSaundersonPDF(
+                        transport_cross_sections, path_length, mu ); } );
+
+  mean_angle_cosine += unscattered_probability;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   mean_angle_cosine,
+                   std::exp( -path_length*transport_cross_sections[1] ),
+                   1e-4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a Goudsmit-Saunderson angle cosine can be sampled
+FRENSIE_UNIT_TEST( GoudsmitSaundersonMultipleScatteringHelpers,
+                   sampleGoudsmitSaundersonAngleCosine )
+{
+  const std::vector<double>& transport_cross_sections =
+    screened_rutherford_transport_cross_sections;
+
+  const double path_length = 2.0;
+
+  const double unscattered_probability =
+    std::exp( -path_length*transport_cross_sections[0] );
+
+  // The electron does not scatter
+  std::vector<double> fake_stream( 1 );
+  fake_stream[0] = unscattered_probability*0.5;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::sampleGoudsmitSaundersonAngleCosine(
+                                                     transport_cross_sections,
+                                                     path_length ),
+                       1.0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // Sample the scattered electron distribution at stratified points
+  const size_t samples = 1000;
+
+  fake_stream.resize( 2*samples );
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    fake_stream[2*i] = unscattered_probability;
+    fake_stream[2*i+1] = (i + 0.5)/samples;
+  }
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  double mean_angle_cosine = 0.0;
+  double previous_angle_cosine = 1.0;
+
+  for( size_t i = 0; i < samples; ++i )
+  {
+    const double angle_cosine =
+      MonteCarlo::sampleGoudsmitSaundersonAngleCosine(
+                                                     transport_cross_sections,
+                                                     path_length );
+
+    FRENSIE_CHECK_LESS_OR_EQUAL( angle_cosine, previous_angle_cosine );
+    FRENSIE_CHECK_GREATER_OR_EQUAL( angle_cosine, -1.0 );
+
+    mean_angle_cosine += angle_cosine/samples;
+    previous_angle_cosine = angle_cosine;
+  }
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // The mean angle cosine of the scattered electrons
+  const double expected_mean_angle_cosine =
+    (std::exp( -path_length*transport_cross_sections[1] ) -
+     unscattered_probability)/(1.0 - unscattered_probability);
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( mean_angle_cosine,
+                                   expected_mean_angle_cosine,
+                                   1e-3 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  MonteCarlo::calculateElasticTransportCrossSections(
+                                    &screenedRutherfordDifferentialCrossSection,
+                                    128,
+                                    screened_rutherford_transport_cross_sections );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstGoudsmitSaundersonMultipleScatteringHelpers.cpp
+//---------------------------------------------------------------------------//
@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_FilledElectronGeometryModel.hpp"
 #include "MonteCarlo_ElectroatomFactory.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
 
 namespace MonteCarlo{
 
@@ -34,6 +35,26 @@ void FilledElectronGeometryModel::loadScatteringCenters(
   electroatom_factory.createElectroatomMap( scattering_center_name_map );
 }
   
+// Process a newly created material
+void FilledElectronGeometryModel::processNewMaterial(
+                                  MaterialType& material,
+                                  const SimulationProperties& properties ) const
+{
+  this->unionizeMaterialEnergyGrid( material, properties );
+
+  if( properties.isCondensedHistoryModeOn() )
+  {
+    try{
+      material.constructCondensedHistoryData(
+                                       properties.getMinElectronEnergy(),
+                                       properties.getMaxElectronEnergy() );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Could not construct the condensed history data "
+                             "of material " << material.getId() << "!" );
+  }
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -200,6 +200,14 @@ public:
   template<typename ParticleStateType>
   const std::vector<double>& getCriticalLineEnergies() const;
 
+  //! Check if a majorant cross section has been constructed for the given particle type
+  template<typename ParticleStateType>
+  bool hasMajorantCrossSection() const;
+
+  //! Get the majorant macroscopic cross section for the given particle type
+  template<typename ParticleStateType>
+  double getMajorantCrossSection( const double energy ) const;
+
   //! Get the unfilled geometry model
   const Geometry::Model& getUnfilledModel() const;
 
@@ -187,6 +187,20 @@ const std::vector<double>& FilledGeometryModel::getCriticalLineEnergies() const
   return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getCriticalLineEnergies();
 }
 
+// Check if a majorant cross section has been constructed for the given particle type
+template<typename ParticleStateType>
+bool FilledGeometryModel::hasMajorantCrossSection() const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::hasMajorantCrossSection();
+}
+
+// Get the majorant macroscopic cross section for the given particle type
+template<typename ParticleStateType>
+double FilledGeometryModel::getMajorantCrossSection( const double energy ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getMajorantCrossSection( energy );
+}
+
 // Save the object to an archive
 template<typename Archive>
 void FilledGeometryModel::save( Archive& ar, const unsigned version ) const
@@ -33,6 +33,14 @@ void FilledNeutronGeometryModel::loadScatteringCenters(
   nuclide_factory.createNuclideMap( scattering_center_name_map );
 }
   
+// Process a newly created material
+void FilledNeutronGeometryModel::processNewMaterial(
+                                  MaterialType& material,
+                                  const SimulationProperties& properties ) const
+{
+  this->unionizeMaterialEnergyGrid( material, properties );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
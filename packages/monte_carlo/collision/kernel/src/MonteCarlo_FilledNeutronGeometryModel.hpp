@@ -58,6 +58,10 @@ protected:
        const SimulationProperties& properties,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const final override;
+
+  //! Process a newly created material
+  void processNewMaterial( MaterialType& material,
+                           const SimulationProperties& properties ) const final override;
 };
   
 } // end MonteCarlo namespace
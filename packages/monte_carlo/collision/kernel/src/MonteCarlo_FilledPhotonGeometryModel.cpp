@@ -88,6 +88,14 @@ double FilledPhotonGeometryModel::getMacroscopicReactionCrossSectionQuick(
                                                             energy, reaction );
 }
   
+// Process a newly created material
+void FilledPhotonGeometryModel::processNewMaterial(
+                                  MaterialType& material,
+                                  const SimulationProperties& properties ) const
+{
+  this->unionizeMaterialEnergyGrid( material, properties );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
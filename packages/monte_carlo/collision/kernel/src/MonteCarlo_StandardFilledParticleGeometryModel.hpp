@@ -123,6 +123,12 @@ public:
                                 const double energy,
                                 const ReactionEnumType reaction ) const;
 
+  //! Check if a majorant cross section has been constructed
+  bool hasMajorantCrossSection() const;
+
+  //! Get the majorant macroscopic cross section
+  double getMajorantCrossSection( const double energy ) const;
+
   //! Get the unfilled model
   const Geometry::Model& getUnfilledModel() const;
   
@@ -168,6 +174,14 @@ protected:
   virtual void processLoadedScatteringCenters(
                    const ScatteringCenterNameMap& scattering_centers );
 
+  //! Process a newly created material
+  virtual void processNewMaterial( MaterialType& material,
+                                   const SimulationProperties& properties ) const;
+
+  //! Construct the unionized energy grid of a material
+  void unionizeMaterialEnergyGrid( MaterialType& material,
+                                   const SimulationProperties& properties ) const;
+
 private:
 
   // Add a material to the collision kernel
@@ -175,6 +189,17 @@ private:
                     const std::vector<Geometry::Model::EntityId>&
                     cells_containing_material );
 
+  // Construct the majorant cross section
+  void constructMajorantCrossSection(
+             const SimulationProperties& properties,
+             const std::vector<Geometry::Model::EntityId>& material_cells );
+
+  // Check if the unfilled model has reflecting surfaces
+  bool doesUnfilledModelHaveReflectingSurfaces() const;
+
+  // The number of majorant energy bins per decade
+  static const size_t s_majorant_bins_per_decade;
+
   // The unfilled model
   std::shared_ptr<const Geometry::Model> d_unfilled_model;
 
@@ -191,7 +216,13 @@ private:
   typedef std::unordered_map<Geometry::Model::EntityId,std::shared_ptr<const MaterialType> >
   CellIdMaterialMap;
 
-  CellIdMaterialMap d_cell_id_material_map;  
+  CellIdMaterialMap d_cell_id_material_map;
+
+  // The majorant cross section energy grid
+  std::vector<double> d_majorant_energy_grid;
+
+  // The majorant macroscopic cross section of each majorant energy bin
+  std::vector<double> d_majorant_cross_section;
 };
   
 } // end MonteCarlo namespace
@@ -9,7 +9,14 @@
 #ifndef MONTE_CARLO_STANDARD_FILLED_PARTICLE_GEOMETRY_MODEL_DEF_HPP
 #define MONTE_CARLO_STANDARD_FILLED_PARTICLE_GEOMETRY_MODEL_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
 // FRENSIE Includes
+#include "Geometry_AdvancedModel.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_ToStringTraits.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
@@ -17,6 +24,10 @@
 
 namespace MonteCarlo{
 
+// Initialize static member data
+template<typename Material>
+const size_t StandardFilledParticleGeometryModel<Material>::s_majorant_bins_per_decade = 100;
+
 // Default constructor
 template<typename Material>
 StandardFilledParticleGeometryModel<Material>::StandardFilledParticleGeometryModel()
@@ -125,11 +136,17 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
           Utility::get<1>( material_definition[i] );
       }
 
-      new_material.reset( new MaterialType( material_id,
-                                            density,
-                                            d_scattering_center_name_map,
-                                            scattering_center_fractions,
-                                            scattering_center_names ) );
+      std::shared_ptr<MaterialType> material(
+                                new MaterialType( material_id,
+                                                  density,
+                                                  d_scattering_center_name_map,
+                                                  scattering_center_fractions,
+                                                  scattering_center_names ) );
+
+      // Process the new material
+      this->processNewMaterial( *material, properties );
+
+      new_material = material;
     }
 
     material_name_cell_ids_map[material_name].push_back( cell_id );
@@ -148,6 +165,132 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
     
     ++material_name_it;
   }
+
+  // Construct the majorant cross section that will be used by delta tracking
+  if( properties.isDeltaTrackingModeOn() )
+  {
+    std::vector<Geometry::Model::EntityId> material_cells;
+
+    for( auto&& material_name_cell_ids : material_name_cell_ids_map )
+      material_cells.push_back( material_name_cell_ids.second.front() );
+
+    this->constructMajorantCrossSection( properties, material_cells );
+  }
+}
+
+// Construct the majorant cross section
+/*! \details The majorant cross section is the max total forward macroscopic
+ * cross section of all materials in the model. It is stored as a
+ * piecewise-constant function of energy on a logarithmically spaced energy
+ * grid that spans the min and max particle energies that are set in the
+ * simulation properties. The material total cross sections are interpolated
+ * on the scattering center energy grids, which means that the max over each
+ * interval between consecutive scattering center grid points is attained at
+ * one of the interval end points. The value stored for each energy bin is
+ * therefore the max of the material cross sections evaluated at the bin
+ * boundaries and at every scattering center grid point inside of the bin,
+ * which is an upper bound of the material cross sections in the bin. Only one
+ * cell containing each material needs to be passed in. A majorant cross
+ * section will not be constructed if the model has reflecting surfaces (delta
+ * tracking flights cannot be reflected).
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::constructMajorantCrossSection(
+             const SimulationProperties& properties,
+             const std::vector<Geometry::Model::EntityId>& material_cells )
+{
+  d_majorant_energy_grid.clear();
+  d_majorant_cross_section.clear();
+
+  // A void model doesn't need a majorant cross section
+  if( material_cells.empty() )
+    return;
+
+  if( this->doesUnfilledModelHaveReflectingSurfaces() )
+  {
+    FRENSIE_LOG_NOTIFICATION( ParticleStateType::type << " majorant cross "
+                              "section not constructed because the model has "
+                              "reflecting surfaces" );
+
+    return;
+  }
+
+  const double min_energy =
+    properties.template getMinParticleEnergy<ParticleStateType>();
+
+  const double max_energy =
+    properties.template getMaxParticleEnergy<ParticleStateType>();
+
+  // Create a logarithmically spaced energy grid
+  const size_t number_of_bins =
+    std::max( (size_t)std::ceil( s_majorant_bins_per_decade*
+                                 std::log10( max_energy/min_energy ) ),
+              (size_t)1 );
+
+  d_majorant_energy_grid.resize( number_of_bins+1 );
+
+  d_majorant_energy_grid.front() = min_energy;
+
+  for( size_t i = 1; i < number_of_bins; ++i )
+  {
+    d_majorant_energy_grid[i] = min_energy*
+      std::pow( max_energy/min_energy, i/(double)number_of_bins );
+  }
+
+  d_majorant_energy_grid.back() = max_energy;
+
+  // Evaluate the majorant cross section of each bin
+  d_majorant_cross_section.resize( number_of_bins, 0.0 );
+
+  std::vector<double> material_energy_grid;
+
+  for( auto&& cell : material_cells )
+  {
+    // Evaluate the cross section at the bin boundaries
+    for( size_t i = 0; i < d_majorant_energy_grid.size(); ++i )
+    {
+      const double cross_section =
+        this->getMacroscopicTotalForwardCrossSection(
+                                            cell, d_majorant_energy_grid[i] );
+
+      if( i > 0 )
+      {
+        d_majorant_cross_section[i-1] =
+          std::max( d_majorant_cross_section[i-1], cross_section );
+      }
+
+      if( i < number_of_bins )
+      {
+        d_majorant_cross_section[i] =
+          std::max( d_majorant_cross_section[i], cross_section );
+      }
+    }
+
+    // Evaluate the cross section at the material grid points in each bin
+    this->getMaterial( cell )->getScatteringCenterEnergyGridPoints(
+                                                      min_energy,
+                                                      max_energy,
+                                                      material_energy_grid );
+
+    for( auto&& energy : material_energy_grid )
+    {
+      const size_t bin_index =
+        std::min( (size_t)Utility::Search::binaryLowerBoundIndex(
+                                                d_majorant_energy_grid.begin(),
+                                                d_majorant_energy_grid.end(),
+                                                energy ),
+                  number_of_bins-1 );
+
+      d_majorant_cross_section[bin_index] =
+        std::max( d_majorant_cross_section[bin_index],
+                  this->getMacroscopicTotalForwardCrossSection( cell,
+                                                                energy ) );
+    }
+  }
+
+  FRENSIE_LOG_NOTIFICATION( ParticleStateType::type << " majorant cross "
+                            "section constructed ("
+                            << d_majorant_energy_grid.size() << " points)" );
 }
 
 // Add a material to the collision kernel
@@ -197,6 +340,36 @@ void StandardFilledParticleGeometryModel<Material>::processLoadedScatteringCente
                                                const ScatteringCenterNameMap& )
 { /* ... */ }
 
+// Process a newly created material
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::processNewMaterial(
+                                                MaterialType&,
+                                                const SimulationProperties& ) const
+{ /* ... */ }
+
+// Construct the unionized energy grid of a material
+/*! \details The unionized energy grid will span the min and max particle
+ * energies that are set in the simulation properties.
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::unionizeMaterialEnergyGrid(
+                                  MaterialType& material,
+                                  const SimulationProperties& properties ) const
+{
+  if( properties.getUnionizedEnergyGridMode() != NO_UNIONIZED_ENERGY_GRID )
+  {
+    try{
+      material.unionizeEnergyGrid(
+                properties.getUnionizedEnergyGridMode(),
+                properties.template getMinParticleEnergy<ParticleStateType>(),
+                properties.template getMaxParticleEnergy<ParticleStateType>() );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Could not unionize the energy grid of material "
+                             << material.getId() << "!" );
+  }
+}
+
 // Check if the entire model is void
 template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isVoid() const
@@ -379,6 +552,65 @@ double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCros
                                                             energy, reaction );
 }
 
+// Check if the unfilled model has reflecting surfaces
+template<typename Material>
+bool StandardFilledParticleGeometryModel<Material>::doesUnfilledModelHaveReflectingSurfaces() const
+{
+  // Only advanced models can have reflecting surfaces
+  if( d_unfilled_model->isAdvanced() )
+  {
+    const Geometry::AdvancedModel& advanced_model =
+      dynamic_cast<const Geometry::AdvancedModel&>( *d_unfilled_model );
+
+    Geometry::AdvancedModel::SurfaceIdSet surfaces;
+
+    advanced_model.getSurfaces( surfaces );
+
+    for( auto&& surface : surfaces )
+    {
+      if( advanced_model.isReflectingSurface( surface ) )
+        return true;
+    }
+  }
+
+  return false;
+}
+
+// Check if a majorant cross section has been constructed
+template<typename Material>
+bool StandardFilledParticleGeometryModel<Material>::hasMajorantCrossSection() const
+{
+  return !d_majorant_cross_section.empty();
+}
+
+// Get the majorant macroscopic cross section
+/*! \details The majorant cross section is only constructed when delta
+ * tracking mode has been requested. Energies outside of the majorant energy
+ * grid will be assigned the majorant cross section of the first or last
+ * energy bin.
+ */
+template<typename Material>
+inline double StandardFilledParticleGeometryModel<Material>::getMajorantCrossSection(
+                                                   const double energy ) const
+{
+  // Make sure that the majorant cross section has been constructed
+  testPrecondition( this->hasMajorantCrossSection() );
+
+  if( energy <= d_majorant_energy_grid.front() )
+    return d_majorant_cross_section.front();
+  else if( energy >= d_majorant_energy_grid.back() )
+    return d_majorant_cross_section.back();
+  else
+  {
+    const size_t bin_index =
+      Utility::Search::binaryLowerBoundIndex( d_majorant_energy_grid.begin(),
+                                              d_majorant_energy_grid.end(),
+                                              energy );
+
+    return d_majorant_cross_section[bin_index];
+  }
+}
+
 // Get the unfilled model
 template<typename Material>
 const Geometry::Model& StandardFilledParticleGeometryModel<Material>::getUnfilledModel() const
@@ -71,9 +71,11 @@ DetailedNeutronFissionReaction::DetailedNeutronFissionReaction(
   testPrecondition( delayed_neutron_emission_distribution.get() );
 }
 
-// Simulate the reaction
-void DetailedNeutronFissionReaction::react( NeutronState& neutron,
-					    ParticleBank& bank ) const
+// Simulate the reaction with a target at the desired temperature (MeV)
+void DetailedNeutronFissionReaction::reactAtTemperature(
+                                             NeutronState& neutron,
+                                             ParticleBank& bank,
+                                             const double temperature ) const
 {
   neutron.incrementCollisionNumber();
 
@@ -86,15 +88,17 @@ void DetailedNeutronFissionReaction::react( NeutronState& neutron,
     std::shared_ptr<NeutronState> new_neutron(
 				    new NeutronState( neutron, true, false ) );
 
-    d_delayed_neutron_emission_distribution->scatterParticle(
-						      *new_neutron,
-						      this->getTemperature() );
+    d_delayed_neutron_emission_distribution->scatterParticle( *new_neutron,
+                                                              temperature );
 
     bank.push( new_neutron, this->getReactionType() );
   }
 
   // Create the additional prompt neutrons
-  NeutronFissionReaction::reactImplementation( neutron, bank, false );
+  NeutronFissionReaction::reactImplementation( neutron,
+                                               bank,
+                                               temperature,
+                                               false );
 }
 
 } // end MonteCarlo namespace
@@ -62,8 +62,10 @@ public:
   ~DetailedNeutronFissionReaction()
   { /* ... */ }
 
-  //! Simulate the reaction
-  void react( NeutronState& neutron, ParticleBank& bank ) const final override;
+  //! Simulate the reaction with a target at the desired temperature (MeV)
+  void reactAtTemperature( NeutronState& neutron,
+                           ParticleBank& bank,
+                           const double temperature ) const final override;
 
 private:
 
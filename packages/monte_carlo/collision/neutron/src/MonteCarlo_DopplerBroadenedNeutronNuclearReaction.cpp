@@ -0,0 +1,241 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DopplerBroadenedNeutronNuclearReaction.cpp
+//! \author Alex Robinson
+//! \brief  The Doppler broadened neutron nuclear reaction class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_DopplerBroadenedNeutronNuclearReaction.hpp"
+#include "MonteCarlo_DopplerBroadeningHelpers.hpp"
+#include "Utility_InterpolationPolicy.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+DopplerBroadenedNeutronNuclearReaction::DopplerBroadenedNeutronNuclearReaction(
+       const std::shared_ptr<const NeutronNuclearReaction>& base_reaction,
+       const std::shared_ptr<const std::vector<double> >& energy_grid,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const double atomic_weight_ratio,
+       const double temperature,
+       const double max_broadening_energy )
+  : d_base_reaction( base_reaction ),
+    d_energy_grid( energy_grid ),
+    d_grid_searcher( grid_searcher ),
+    d_atomic_weight_ratio( atomic_weight_ratio ),
+    d_temperature( temperature ),
+    d_max_broadening_energy( max_broadening_energy ),
+    d_broadened_nodal_cross_sections()
+{
+  // Make sure the base reaction is valid
+  testPrecondition( base_reaction.get() );
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.get() );
+  testPrecondition( energy_grid->size() > 1 );
+  // Make sure the grid searcher is valid
+  testPrecondition( grid_searcher.get() );
+  // Make sure the atomic weight ratio is valid
+  testPrecondition( atomic_weight_ratio > 0.0 );
+  // Make sure the temperature is valid
+  testPrecondition( temperature > base_reaction->getTemperature() );
+  // Make sure the max broadening energy is valid
+  testPrecondition( max_broadening_energy >= 0.0 );
+
+  // Create the (empty) broadened cross section cache
+  const size_t number_of_cached_grid_points =
+    std::lower_bound( energy_grid->begin(),
+                      energy_grid->end(),
+                      max_broadening_energy ) - energy_grid->begin();
+
+  std::vector<std::atomic<double> >
+    broadened_nodal_cross_sections( number_of_cached_grid_points );
+
+  for( size_t i = 0; i < broadened_nodal_cross_sections.size(); ++i )
+  {
+    broadened_nodal_cross_sections[i].store(
+                               std::numeric_limits<double>::quiet_NaN(),
+                               std::memory_order_relaxed );
+  }
+
+  d_broadened_nodal_cross_sections.swap( broadened_nodal_cross_sections );
+}
+
+// Test if the energy falls within the energy grid
+bool DopplerBroadenedNeutronNuclearReaction::isEnergyWithinEnergyGrid(
+                                                   const double energy ) const
+{
+  return d_base_reaction->isEnergyWithinEnergyGrid( energy );
+}
+
+// Return the threshold energy
+double DopplerBroadenedNeutronNuclearReaction::getThresholdEnergy() const
+{
+  return d_base_reaction->getThresholdEnergy();
+}
+
+// Return the max energy
+double DopplerBroadenedNeutronNuclearReaction::getMaxEnergy() const
+{
+  return d_base_reaction->getMaxEnergy();
+}
+
+// Return the cross section at the given energy
+double DopplerBroadenedNeutronNuclearReaction::getCrossSection(
+                                                   const double energy ) const
+{
+  if( energy >= d_max_broadening_energy )
+    return d_base_reaction->getCrossSection( energy );
+  else
+  {
+    // Make sure the energy is valid
+    testPrecondition( d_grid_searcher->isValueWithinGridBounds( energy ) );
+
+    return this->getCrossSection(
+                          energy, d_grid_searcher->findLowerBinIndex( energy ) );
+  }
+}
+
+// Return the cross section at the given energy (efficient)
+double DopplerBroadenedNeutronNuclearReaction::getCrossSection(
+                                               const double energy,
+                                               const size_t bin_index ) const
+{
+  // Make sure the bin index is valid
+  testPrecondition( bin_index < d_energy_grid->size() - 1 );
+  testPrecondition( (*d_energy_grid)[bin_index] <= energy );
+  testPrecondition( (*d_energy_grid)[bin_index+1] >= energy );
+
+  if( energy >= d_max_broadening_energy )
+    return d_base_reaction->getCrossSection( energy, bin_index );
+  else
+  {
+    return Utility::LinLin::interpolate(
+                         (*d_energy_grid)[bin_index],
+                         (*d_energy_grid)[bin_index+1],
+                         energy,
+                         this->getBroadenedNodalCrossSection( bin_index ),
+                         this->getBroadenedNodalCrossSection( bin_index+1 ) );
+  }
+}
+
+// Return the reaction Q value
+double DopplerBroadenedNeutronNuclearReaction::getQValue() const
+{
+  return d_base_reaction->getQValue();
+}
+
+// Return the number of particles emitted from the rxn at the given energy
+unsigned DopplerBroadenedNeutronNuclearReaction::getNumberOfEmittedParticles(
+                                                   const double energy ) const
+{
+  return d_base_reaction->getNumberOfEmittedParticles( energy );
+}
+
+// Return the average number of particles emitted from the rxn
+double DopplerBroadenedNeutronNuclearReaction::getAverageNumberOfEmittedParticles(
+                                                   const double energy ) const
+{
+  return d_base_reaction->getAverageNumberOfEmittedParticles( energy );
+}
+
+// Return the reaction type
+NuclearReactionType
+DopplerBroadenedNeutronNuclearReaction::getReactionType() const
+{
+  return d_base_reaction->getReactionType();
+}
+
+// Return the temperature (in MeV) at which the reaction occurs
+double DopplerBroadenedNeutronNuclearReaction::getTemperature() const
+{
+  return d_temperature;
+}
+
+// Return the max broadening energy
+double DopplerBroadenedNeutronNuclearReaction::getMaxBroadeningEnergy() const
+{
+  return d_max_broadening_energy;
+}
+
+// Simulate the reaction
+void DopplerBroadenedNeutronNuclearReaction::react( NeutronState& neutron,
+                                                    ParticleBank& bank ) const
+{
+  d_base_reaction->reactAtTemperature( neutron, bank, d_temperature );
+}
+
+// Simulate the reaction with a target at the desired temperature (MeV)
+void DopplerBroadenedNeutronNuclearReaction::reactAtTemperature(
+                                             NeutronState& neutron,
+                                             ParticleBank& bank,
+                                             const double temperature ) const
+{
+  d_base_reaction->reactAtTemperature( neutron, bank, temperature );
+}
+
+// Return the head of the energy grid
+const double*
+DopplerBroadenedNeutronNuclearReaction::getEnergyGridHead() const
+{
+  return d_energy_grid->data();
+}
+
+// Return the cross section of the base reaction at an energy grid point
+double DopplerBroadenedNeutronNuclearReaction::getBaseNodalCrossSection(
+                                               const size_t grid_index ) const
+{
+  return d_base_reaction->getCrossSection(
+                   (*d_energy_grid)[grid_index],
+                   std::min( grid_index, d_energy_grid->size() - 2 ) );
+}
+
+// Return the broadened cross section at an energy grid point
+/*! \details The broadened cross section at a grid point is only evaluated
+ * once. If two threads request an uncached grid point at the same time both
+ * will evaluate it and store the same value.
+ */
+double DopplerBroadenedNeutronNuclearReaction::getBroadenedNodalCrossSection(
+                                               const size_t grid_index ) const
+{
+  if( grid_index < d_broadened_nodal_cross_sections.size() )
+  {
+    double cross_section =
+      d_broadened_nodal_cross_sections[grid_index].load(
+                                                   std::memory_order_relaxed );
+
+    if( std::isnan( cross_section ) )
+    {
+      cross_section = evaluateDopplerBroadenedCrossSection(
+                *d_energy_grid,
+                [this]( const size_t i ){
+                  return this->getBaseNodalCrossSection( i );
+                },
+                d_atomic_weight_ratio,
+                d_temperature - d_base_reaction->getTemperature(),
+                (*d_energy_grid)[grid_index] );
+
+      d_broadened_nodal_cross_sections[grid_index].store(
+                                                   cross_section,
+                                                   std::memory_order_relaxed );
+    }
+
+    return cross_section;
+  }
+  else
+    return this->getBaseNodalCrossSection( grid_index );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DopplerBroadenedNeutronNuclearReaction.cpp
+//---------------------------------------------------------------------------//
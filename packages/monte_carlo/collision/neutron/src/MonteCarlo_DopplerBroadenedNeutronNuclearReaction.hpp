@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DopplerBroadenedNeutronNuclearReaction.hpp
+//! \author Alex Robinson
+//! \brief  The Doppler broadened neutron nuclear reaction class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DOPPLER_BROADENED_NEUTRON_NUCLEAR_REACTION_HPP
+#define MONTE_CARLO_DOPPLER_BROADENED_NEUTRON_NUCLEAR_REACTION_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+#include <atomic>
+
+// FRENSIE Includes
+#include "MonteCarlo_NeutronNuclearReaction.hpp"
+#include "Utility_HashBasedGridSearcher.hpp"
+
+namespace MonteCarlo{
+
+/*! The Doppler broadened neutron nuclear reaction class
+ * \details This class wraps a reaction that is tabulated at a lower target
+ * temperature and Doppler broadens its cross section on-the-fly to a higher
+ * target temperature (see MonteCarlo::evaluateDopplerBroadenedCrossSection).
+ * The tabulated data of the wrapped reaction is shared by every temperature.
+ * The broadened cross section is evaluated at the energy grid points that
+ * bracket the energy of interest and then lin-lin interpolated, which keeps
+ * the sum of the broadened cross sections consistent with broadened total
+ * cross sections tabulated on the same grid. Each broadened grid point value
+ * is cached the first time that it is evaluated so that the broadening
+ * kernel is only integrated once per grid point and temperature. Only the
+ * grid points below the max broadening energy are cached. The cache can be
+ * filled concurrently by multiple threads. Above the max broadening energy the cross
+ * section of the wrapped reaction is returned. The outgoing particles are
+ * sampled from the wrapped reaction using the broadened temperature.
+ */
+class DopplerBroadenedNeutronNuclearReaction : public NeutronNuclearReaction
+{
+
+public:
+
+  //! Constructor
+  DopplerBroadenedNeutronNuclearReaction(
+       const std::shared_ptr<const NeutronNuclearReaction>& base_reaction,
+       const std::shared_ptr<const std::vector<double> >& energy_grid,
+       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+       grid_searcher,
+       const double atomic_weight_ratio,
+       const double temperature,
+       const double max_broadening_energy );
+
+  //! Destructor
+  ~DopplerBroadenedNeutronNuclearReaction()
+  { /* ... */ }
+
+  //! Test if the energy falls within the energy grid
+  bool isEnergyWithinEnergyGrid( const double energy ) const override;
+
+  //! Return the threshold energy
+  double getThresholdEnergy() const override;
+
+  //! Return the max energy
+  double getMaxEnergy() const override;
+
+  //! Return the cross section at the given energy
+  double getCrossSection( const double energy ) const override;
+
+  //! Return the cross section at the given energy (efficient)
+  double getCrossSection( const double energy,
+                          const size_t bin_index ) const override;
+
+  //! Return the reaction Q value
+  double getQValue() const override;
+
+  //! Return the number of particles emitted from the rxn at the given energy
+  unsigned getNumberOfEmittedParticles( const double energy ) const override;
+
+  //! Return the average number of particles emitted from the rxn
+  double getAverageNumberOfEmittedParticles( const double energy ) const override;
+
+  //! Return the reaction type
+  NuclearReactionType getReactionType() const override;
+
+  //! Return the temperature (in MeV) at which the reaction occurs
+  double getTemperature() const override;
+
+  //! Return the max broadening energy
+  double getMaxBroadeningEnergy() const;
+
+  //! Simulate the reaction
+  void react( NeutronState& neutron, ParticleBank& bank ) const override;
+
+  //! Simulate the reaction with a target at the desired temperature (MeV)
+  void reactAtTemperature( NeutronState& neutron,
+                           ParticleBank& bank,
+                           const double temperature ) const override;
+
+protected:
+
+  //! Return the head of the energy grid
+  const double* getEnergyGridHead() const override;
+
+private:
+
+  // Return the cross section of the base reaction at an energy grid point
+  double getBaseNodalCrossSection( const size_t grid_index ) const;
+
+  // Return the broadened cross section at an energy grid point
+  double getBroadenedNodalCrossSection( const size_t grid_index ) const;
+
+  // The base reaction
+  std::shared_ptr<const NeutronNuclearReaction> d_base_reaction;
+
+  // The energy grid
+  std::shared_ptr<const std::vector<double> > d_energy_grid;
+
+  // The energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_grid_searcher;
+
+  // The atomic weight ratio
+  double d_atomic_weight_ratio;
+
+  // The temperature (MeV)
+  double d_temperature;
+
+  // The max broadening energy
+  double d_max_broadening_energy;
+
+  // The cached broadened cross section at each grid point below the max
+  // broadening energy (NaN if it has not been evaluated yet)
+  mutable std::vector<std::atomic<double> > d_broadened_nodal_cross_sections;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_DOPPLER_BROADENED_NEUTRON_NUCLEAR_REACTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DopplerBroadenedNeutronNuclearReaction.hpp
+//---------------------------------------------------------------------------//
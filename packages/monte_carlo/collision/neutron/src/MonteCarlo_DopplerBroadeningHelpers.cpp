@@ -0,0 +1,254 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DopplerBroadeningHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Doppler broadening helper definitions
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_DopplerBroadeningHelpers.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+namespace{
+
+// The half width of the kernel integration window in units of the reduced
+// relative speed (exp(-25) ~ 1e-11)
+const double kernel_window_half_width = 5.0;
+
+// Calculate the kernel moments H_n = int_a^b t^n exp(-t^2) dt, n = 0,...,4
+/*! \details The moments are calculated from the tail integrals
+ * F_n(a) = int_a^inf t^n exp(-t^2) dt, which satisfy the recursion relation
+ * F_n(a) = (n-1)/2*F_{n-2}(a) + a^{n-1}*exp(-a^2)/2.
+ */
+void calculateKernelMoments( const double a, const double b, double moments[5] )
+{
+  const double exp_a = std::exp( -a*a );
+  const double exp_b = std::exp( -b*b );
+
+  moments[0] = 0.5*std::sqrt( Utility::PhysicalConstants::pi )*
+    (std::erfc( a ) - std::erfc( b ));
+  moments[1] = 0.5*(exp_a - exp_b);
+  moments[2] = 0.5*moments[0] + 0.5*(a*exp_a - b*exp_b);
+  moments[3] = moments[1] + 0.5*(a*a*exp_a - b*b*exp_b);
+  moments[4] = 1.5*moments[2] + 0.5*(a*a*a*exp_a - b*b*b*exp_b);
+}
+
+// Integrate the kernel term over a reduced speed interval
+/*! \details The cross section on the interval must be of the form
+ * sigma(y) = c0 + c2*y^2 (lin-lin in energy). The integral
+ * int_{y0}^{y1} y^2*sigma(y)*exp(-(y-x)^2) dy is returned. The second kernel
+ * term (exp(-(y+x)^2)) can be integrated by passing in -x.
+ */
+double integrateKernelTerm( const double y0,
+                            const double y1,
+                            const double x,
+                            const double c0,
+                            const double c2 )
+{
+  double moments[5];
+
+  calculateKernelMoments( y0 - x, y1 - x, moments );
+
+  const double x2 = x*x;
+
+  // int (t+x)^2 exp(-t^2) dt
+  const double second_moment =
+    moments[2] + 2.0*x*moments[1] + x2*moments[0];
+
+  // int (t+x)^4 exp(-t^2) dt
+  const double fourth_moment = moments[4] + 4.0*x*moments[3] +
+    6.0*x2*moments[2] + 4.0*x*x2*moments[1] + x2*x2*moments[0];
+
+  return c0*second_moment + c2*fourth_moment;
+}
+
+// Integrate the 1/v kernel term over a reduced speed interval
+/*! \details The cross section on the interval must be of the form
+ * sigma(y) = c1/y. The integral int_{y0}^{y1} y^2*sigma(y)*exp(-(y-x)^2) dy
+ * is returned.
+ */
+double integrateInverseVelocityKernelTerm( const double y0,
+                                           const double y1,
+                                           const double x,
+                                           const double c1 )
+{
+  double moments[5];
+
+  calculateKernelMoments( y0 - x, y1 - x, moments );
+
+  // int (t+x) exp(-t^2) dt
+  return c1*(moments[1] + x*moments[0]);
+}
+
+} // end anonymous namespace
+
+// Evaluate a Doppler broadened cross section
+/*! \details The cross section, which must be lin-lin interpolated on the
+ * energy grid and tabulated at a target temperature T0, is broadened to a
+ * target temperature T0 + dT using the exact free gas kernel (the SIGMA1
+ * method):
+ * sigma(x) = 1/(x^2*sqrt(pi))*int_0^inf y^2*sigma(y)*
+ *            [exp(-(y-x)^2) - exp(-(y+x)^2)] dy,
+ * where x^2 = A*E/(k*dT) and y is the reduced relative speed. The kernel is
+ * integrated analytically on each grid interval within five reduced speed
+ * units of x. Below the first grid point the cross section is extrapolated
+ * as 1/v and above the last grid point it is held constant. Because only
+ * the grid points within the kernel window are visited, the cost of an
+ * evaluation is independent of the size of the energy grid, which allows the
+ * broadening to be done on-the-fly. The temperature difference must be in
+ * units of MeV.
+ */
+double evaluateDopplerBroadenedCrossSection(
+                             const std::vector<double>& energy_grid,
+                             const NodalCrossSectionFunction& cross_section,
+                             const double atomic_weight_ratio,
+                             const double temperature_difference,
+                             const double energy )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  testPrecondition( energy_grid.front() > 0.0 );
+  // Make sure the atomic weight ratio is valid
+  testPrecondition( atomic_weight_ratio > 0.0 );
+  // Make sure the temperature difference is valid
+  testPrecondition( temperature_difference > 0.0 );
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  const double alpha = atomic_weight_ratio/temperature_difference;
+
+  const double x = std::sqrt( alpha*energy );
+
+  const double window_lower_bound =
+    std::max( x - kernel_window_half_width, 0.0 );
+  const double window_upper_bound = x + kernel_window_half_width;
+
+  const double window_lower_energy =
+    window_lower_bound*window_lower_bound/alpha;
+  const double window_upper_energy =
+    window_upper_bound*window_upper_bound/alpha;
+
+  double integral = 0.0;
+
+  // Integrate the 1/v extrapolation below the first grid point
+  if( window_lower_energy < energy_grid.front() )
+  {
+    const double y0 = std::sqrt( alpha*energy_grid.front() );
+    const double y1 = std::min( y0, window_upper_bound );
+    const double c1 = cross_section( 0 )*y0;
+
+    integral +=
+      integrateInverseVelocityKernelTerm( window_lower_bound, y1, x, c1 ) -
+      integrateInverseVelocityKernelTerm( window_lower_bound, y1, -x, c1 );
+  }
+
+  // Integrate the grid intervals that overlap the kernel window
+  size_t start_index;
+
+  if( window_lower_energy <= energy_grid.front() )
+    start_index = 0;
+  else if( window_lower_energy >= energy_grid.back() )
+    start_index = energy_grid.size() - 1;
+  else
+  {
+    start_index = Utility::Search::binaryLowerBoundIndex(
+                                                         energy_grid.begin(),
+                                                         energy_grid.end(),
+                                                         window_lower_energy );
+  }
+
+  double lower_cross_section = cross_section( start_index );
+
+  for( size_t i = start_index; i < energy_grid.size() - 1; ++i )
+  {
+    if( energy_grid[i] >= window_upper_energy )
+      break;
+
+    const double upper_cross_section = cross_section( i+1 );
+
+    const double slope = (upper_cross_section - lower_cross_section)/
+      (energy_grid[i+1] - energy_grid[i]);
+
+    const double c0 = lower_cross_section - slope*energy_grid[i];
+    const double c2 = slope/alpha;
+
+    const double y0 =
+      std::max( std::sqrt( alpha*energy_grid[i] ), window_lower_bound );
+    const double y1 =
+      std::min( std::sqrt( alpha*energy_grid[i+1] ), window_upper_bound );
+
+    integral += integrateKernelTerm( y0, y1, x, c0, c2 ) -
+      integrateKernelTerm( y0, y1, -x, c0, c2 );
+
+    lower_cross_section = upper_cross_section;
+  }
+
+  // Integrate the constant extrapolation above the last grid point
+  if( window_upper_energy > energy_grid.back() )
+  {
+    const double y0 = std::max( std::sqrt( alpha*energy_grid.back() ),
+                                window_lower_bound );
+    const double c0 = cross_section( energy_grid.size() - 1 );
+
+    integral += integrateKernelTerm( y0, window_upper_bound, x, c0, 0.0 ) -
+      integrateKernelTerm( y0, window_upper_bound, -x, c0, 0.0 );
+  }
+
+  return std::max( integral/(x*x*std::sqrt( Utility::PhysicalConstants::pi )),
+                   0.0 );
+}
+
+// Doppler broaden a cross section at the energy grid points
+/*! \details Only the grid points with an energy below the max broadening
+ * energy will be broadened (above this energy the thermal motion of the
+ * target has a negligible effect on the cross section). The grid points are
+ * broadened in parallel.
+ */
+void broadenCrossSection( const std::vector<double>& energy_grid,
+                          const NodalCrossSectionFunction& cross_section,
+                          const double atomic_weight_ratio,
+                          const double temperature_difference,
+                          const double max_broadening_energy,
+                          std::vector<double>& broadened_cross_section )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  // Make sure the atomic weight ratio is valid
+  testPrecondition( atomic_weight_ratio > 0.0 );
+  // Make sure the temperature difference is valid
+  testPrecondition( temperature_difference > 0.0 );
+
+  broadened_cross_section.resize( energy_grid.size() );
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    if( energy_grid[i] < max_broadening_energy )
+    {
+      broadened_cross_section[i] =
+        evaluateDopplerBroadenedCrossSection( energy_grid,
+                                              cross_section,
+                                              atomic_weight_ratio,
+                                              temperature_difference,
+                                              energy_grid[i] );
+    }
+    else
+      broadened_cross_section[i] = cross_section( i );
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DopplerBroadeningHelpers.cpp
+//---------------------------------------------------------------------------//
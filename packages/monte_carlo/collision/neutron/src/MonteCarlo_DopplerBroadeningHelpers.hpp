@@ -0,0 +1,44 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DopplerBroadeningHelpers.hpp
+//! \author Alex Robinson
+//! \brief  Doppler broadening helper declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DOPPLER_BROADENING_HELPERS_HPP
+#define MONTE_CARLO_DOPPLER_BROADENING_HELPERS_HPP
+
+// Std Lib Includes
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace MonteCarlo{
+
+//! The nodal cross section function type (cross section at grid index)
+typedef std::function<double(const size_t)> NodalCrossSectionFunction;
+
+//! Evaluate a Doppler broadened cross section
+double evaluateDopplerBroadenedCrossSection(
+                             const std::vector<double>& energy_grid,
+                             const NodalCrossSectionFunction& cross_section,
+                             const double atomic_weight_ratio,
+                             const double temperature_difference,
+                             const double energy );
+
+//! Doppler broaden a cross section at the energy grid points
+void broadenCrossSection( const std::vector<double>& energy_grid,
+                          const NodalCrossSectionFunction& cross_section,
+                          const double atomic_weight_ratio,
+                          const double temperature_difference,
+                          const double max_broadening_energy,
+                          std::vector<double>& broadened_cross_section );
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_DOPPLER_BROADENING_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DopplerBroadeningHelpers.hpp
+//---------------------------------------------------------------------------//
@@ -187,9 +187,14 @@ void ElasticNeutronNuclearScatteringDistribution::sampleTargetVelocity(
     // Sample the target speed
     target_speed = sampleTargetSpeed( neutron, temperature );
 
+    // Sample the random numbers for the cosine of the angle between the
+    // neutron and target velocity and for the rejection test
+    double random_numbers[2];
+
+    Utility::RandomNumberGenerator::getRandomNumbers( random_numbers, 2 );
+
     // Sample the cosine of the angle between the neutron and target velocity
-    mu_target =
-      2*Utility::RandomNumberGenerator::getRandomNumber<double>() - 1.0;
+    mu_target = 2*random_numbers[0] - 1.0;
 
     // Calculate the acceptance probability
     double acceptance_probability =
@@ -197,8 +202,7 @@ void ElasticNeutronNuclearScatteringDistribution::sampleTargetVelocity(
 	    2*neutron_speed*target_speed*mu_target)/
       (neutron_speed+target_speed);
 
-    if( Utility::RandomNumberGenerator::getRandomNumber<double>() <
-	acceptance_probability )
+    if( random_numbers[1] < acceptance_probability )
       break;
   }
 
@@ -236,17 +240,19 @@ double ElasticNeutronNuclearScatteringDistribution::sampleTargetSpeed(
   double alpha = 1.0/(1.0 + sqrt(Utility::PhysicalConstants::pi)*beta*
 		      neutron.getSpeed()/2);
 
-  // Sample two random numbers
-  double random_number_1 =
-    Utility::RandomNumberGenerator::getRandomNumber<double>();
-  double random_number_2 =
-    Utility::RandomNumberGenerator::getRandomNumber<double>();
+  // Sample two random numbers and the branching random number
+  double random_numbers[3];
+
+  Utility::RandomNumberGenerator::getRandomNumbers( random_numbers, 3 );
+
+  const double random_number_1 = random_numbers[0];
+  const double random_number_2 = random_numbers[1];
 
   // The value sampled from the transformed distributions
   double y;
 
   // With probability alpha, sample from p(y) = y*exp(-y) => C45 from MC Samp
-  if( Utility::RandomNumberGenerator::getRandomNumber<double>() < alpha )
+  if( random_numbers[2] < alpha )
   {
     y = -log(random_number_1*random_number_2);
 
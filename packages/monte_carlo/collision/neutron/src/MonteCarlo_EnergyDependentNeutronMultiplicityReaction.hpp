@@ -74,6 +74,11 @@ public:
   //! Simulate the reaction
   void react( NeutronState& neutron, ParticleBank& bank ) const override;
 
+  //! Simulate the reaction with a target at the desired temperature (MeV)
+  void reactAtTemperature( NeutronState& neutron,
+                           ParticleBank& bank,
+                           const double temperature ) const override;
+
 private:
 
   // The energy grid of the number of secondary particles (of the same type as
@@ -110,7 +110,16 @@ unsigned NeutronFissionReaction::getNumberOfDelayedParticles(
 void NeutronFissionReaction::react( NeutronState& neutron,
 				    ParticleBank& bank ) const
 {
-  this->reactImplementation( neutron, bank, true );
+  this->reactAtTemperature( neutron, bank, this->getTemperature() );
+}
+
+// Simulate the reaction with a target at the desired temperature (MeV)
+void NeutronFissionReaction::reactAtTemperature(
+                                             NeutronState& neutron,
+                                             ParticleBank& bank,
+                                             const double temperature ) const
+{
+  this->reactImplementation( neutron, bank, temperature, true );
 }
 
 // The implementation of the reaction simulation
@@ -121,6 +130,7 @@ void NeutronFissionReaction::react( NeutronState& neutron,
 void NeutronFissionReaction::reactImplementation(
 				  NeutronState& neutron,
 				  ParticleBank& bank,
+                                  const double temperature,
 				  const bool increment_collision_number ) const
 {
   if( increment_collision_number )
@@ -135,9 +145,8 @@ void NeutronFissionReaction::reactImplementation(
     std::shared_ptr<NeutronState> new_neutron(
 				    new NeutronState( neutron, true, false ) );
 
-    d_prompt_neutron_emission_distribution->scatterParticle(
-						      *new_neutron,
-						      this->getTemperature() );
+    d_prompt_neutron_emission_distribution->scatterParticle( *new_neutron,
+                                                             temperature );
 
     bank.push( new_neutron, this->getReactionType() );
   }
@@ -79,13 +79,19 @@ public:
   double getAverageNumberOfDelayedParticles( const double energy ) const;
 
   //! Simulate the reaction
-  virtual void react( NeutronState& neutron, ParticleBank& bank ) const override;
+  void react( NeutronState& neutron, ParticleBank& bank ) const final override;
+
+  //! Simulate the reaction with a target at the desired temperature (MeV)
+  virtual void reactAtTemperature( NeutronState& neutron,
+                                   ParticleBank& bank,
+                                   const double temperature ) const override;
 
 protected:
 
   //! Implementation of the reaction simulation
   void reactImplementation( NeutronState& neutron,
 			    ParticleBank& bank,
+                            const double temperature,
 			    const bool increment_collision_number ) const;
 
 private:
@@ -11,6 +11,17 @@
 
 namespace MonteCarlo{
 
+// Simulate the reaction with a target at the desired temperature (MeV)
+/*! \details Reactions that do not depend on the target temperature can
+ * simply use the default implementation, which ignores the temperature.
+ */
+void NeutronNuclearReaction::reactAtTemperature( NeutronState& neutron,
+                                                 ParticleBank& bank,
+                                                 const double ) const
+{
+  this->react( neutron, bank );
+}
+
 EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<NeutronNuclearReaction,Utility::LinLin,false> );
 EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<NeutronNuclearReaction,Utility::LinLin,true> );
 
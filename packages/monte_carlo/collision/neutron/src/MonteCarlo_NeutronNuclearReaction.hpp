@@ -44,6 +44,11 @@ public:
 
   //! Simulate the reaction
   virtual void react( NeutronState& neutron, ParticleBank& bank ) const = 0;
+
+  //! Simulate the reaction with a target at the desired temperature (MeV)
+  virtual void reactAtTemperature( NeutronState& neutron,
+                                   ParticleBank& bank,
+                                   const double temperature ) const;
 };
 
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardReactionBaseImpl<NeutronNuclearReaction,Utility::LinLin,false> );
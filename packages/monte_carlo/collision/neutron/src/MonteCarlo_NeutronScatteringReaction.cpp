@@ -79,6 +79,15 @@ unsigned NeutronScatteringReaction::getNumberOfEmittedParticles(
 // Simulate the reaction
 void NeutronScatteringReaction::react( NeutronState& neutron,
 				       ParticleBank& bank ) const
+{
+  this->reactAtTemperature( neutron, bank, this->getTemperature() );
+}
+
+// Simulate the reaction with a target at the desired temperature (MeV)
+void NeutronScatteringReaction::reactAtTemperature(
+                                             NeutronState& neutron,
+                                             ParticleBank& bank,
+                                             const double temperature ) const
 {
   neutron.incrementCollisionNumber();
 
@@ -92,16 +101,14 @@ void NeutronScatteringReaction::react( NeutronState& neutron,
     std::shared_ptr<NeutronState> new_neutron(
 				   new NeutronState( neutron, true, false ) );
 
-    d_scattering_distribution->scatterParticle( *new_neutron,
-						this->getTemperature() );
+    d_scattering_distribution->scatterParticle( *new_neutron, temperature );
 
     // Add the new neutron to the bank
     bank.push( new_neutron, this->getReactionType() );
   }
 
   // Scatter the "original" neutron
-  d_scattering_distribution->scatterParticle( neutron,
-					      this->getTemperature() );
+  d_scattering_distribution->scatterParticle( neutron, temperature );
 }
 
 } // end MonteCarlo namespace
@@ -7,12 +7,15 @@
 //---------------------------------------------------------------------------//
 
 // Std Lib Includes
+#include <algorithm>
 #include <stdexcept>
 #include <sstream>
 
 // FRENSIE Includes
 #include "MonteCarlo_Nuclide.hpp"
 #include "MonteCarlo_NeutronAbsorptionReaction.hpp"
+#include "MonteCarlo_DopplerBroadenedNeutronNuclearReaction.hpp"
+#include "MonteCarlo_DopplerBroadeningHelpers.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_SearchAlgorithms.hpp"
@@ -118,6 +121,8 @@ Nuclide::Nuclide(
     d_isomer_number( isomer_number ),
     d_atomic_weight_ratio( atomic_weight_ratio ),
     d_temperature( temperature ),
+    d_energy_grid( energy_grid ),
+    d_grid_searcher( grid_searcher ),
     d_total_reaction(),
     d_total_absorption_reaction()
 {
@@ -172,6 +177,60 @@ Nuclide::Nuclide(
   this->calculateTotalReaction( energy_grid, grid_searcher );
 }
 
+// Doppler broadened nuclide constructor
+/*! \details The nuclide will share the energy grid and the reaction data of
+ * the base nuclide. The reactions of the base nuclide will be wrapped so that
+ * their cross sections are Doppler broadened on-the-fly from the base nuclide
+ * temperature to the desired temperature (see
+ * MonteCarlo::DopplerBroadenedNeutronNuclearReaction). Only the broadened
+ * total and total absorption cross sections, which are used at every
+ * collision site, are tabulated. The temperature must be in units of MeV.
+ */
+Nuclide::Nuclide( const Nuclide& base_nuclide,
+                  const double temperature,
+                  const double max_broadening_energy )
+  : d_name( base_nuclide.d_name ),
+    d_id( base_nuclide.d_id ),
+    d_atomic_number( base_nuclide.d_atomic_number ),
+    d_atomic_mass_number( base_nuclide.d_atomic_mass_number ),
+    d_isomer_number( base_nuclide.d_isomer_number ),
+    d_atomic_weight_ratio( base_nuclide.d_atomic_weight_ratio ),
+    d_temperature( temperature ),
+    d_energy_grid( base_nuclide.d_energy_grid ),
+    d_grid_searcher( base_nuclide.d_grid_searcher ),
+    d_total_reaction(),
+    d_total_absorption_reaction()
+{
+  // Make sure the temperature is valid
+  testPrecondition( temperature > base_nuclide.d_temperature );
+  // Make sure the max broadening energy is valid
+  testPrecondition( max_broadening_energy >= 0.0 );
+
+  this->createDopplerBroadenedReactions( base_nuclide.d_scattering_reactions,
+                                         max_broadening_energy,
+                                         d_scattering_reactions );
+
+  this->createDopplerBroadenedReactions( base_nuclide.d_absorption_reactions,
+                                         max_broadening_energy,
+                                         d_absorption_reactions );
+
+  this->createDopplerBroadenedReactions(
+                                       base_nuclide.d_miscellaneous_reactions,
+                                       max_broadening_energy,
+                                       d_miscellaneous_reactions );
+
+  // Broaden the total absorption cross section
+  this->createDopplerBroadenedTotalReaction(
+                                    *base_nuclide.d_total_absorption_reaction,
+                                    max_broadening_energy,
+                                    d_total_absorption_reaction );
+
+  // Broaden the total cross section
+  this->createDopplerBroadenedTotalReaction( *base_nuclide.d_total_reaction,
+                                             max_broadening_energy,
+                                             d_total_reaction );
+}
+
 // Return the nuclide name
 const std::string& Nuclide::getName() const
 {
@@ -220,18 +279,45 @@ double Nuclide::getTemperature() const
   return d_temperature;
 }
 
+// Return the energy grid searcher
+const Utility::HashBasedGridSearcher<double>& Nuclide::getGridSearcher() const
+{
+  return *d_grid_searcher;
+}
+
 // Return the total cross section at the desired energy
 double Nuclide::getTotalCrossSection( const double energy ) const
 {
   return d_total_reaction->getCrossSection( energy );
 }
 
+// Return the total cross section at the desired energy (efficient)
+/*! \details The energy grid bin must be the bin of the energy grid searcher
+ * grid that the energy falls in.
+ */
+double Nuclide::getTotalCrossSection( const double energy,
+                                      const size_t energy_grid_bin ) const
+{
+  return d_total_reaction->getCrossSection( energy, energy_grid_bin );
+}
+
 // Return the total absorption cross section at the desired energy
 double Nuclide::getAbsorptionCrossSection( const double energy ) const
 {
   return d_total_absorption_reaction->getCrossSection( energy );
 }
 
+// Return the total absorption cross section at the desired energy (efficient)
+/*! \details The energy grid bin must be the bin of the energy grid searcher
+ * grid that the energy falls in.
+ */
+double Nuclide::getAbsorptionCrossSection( const double energy,
+                                           const size_t energy_grid_bin ) const
+{
+  return d_total_absorption_reaction->getCrossSection( energy,
+                                                       energy_grid_bin );
+}
+
 // Return the survival probability at the desired energy
 double Nuclide::getSurvivalProbability( const double energy ) const
 {
@@ -477,6 +563,70 @@ void Nuclide::calculateTotalReaction(
                                                          d_temperature ) );
 }
 
+// Create the Doppler broadened reactions
+void Nuclide::createDopplerBroadenedReactions(
+                                  const ConstReactionMap& base_reactions,
+                                  const double max_broadening_energy,
+                                  ConstReactionMap& broadened_reactions ) const
+{
+  ConstReactionMap::const_iterator reaction_type_pointer =
+    base_reactions.begin();
+
+  while( reaction_type_pointer != base_reactions.end() )
+  {
+    broadened_reactions[reaction_type_pointer->first].reset(
+                          new DopplerBroadenedNeutronNuclearReaction(
+                                                 reaction_type_pointer->second,
+                                                 d_energy_grid,
+                                                 d_grid_searcher,
+                                                 d_atomic_weight_ratio,
+                                                 d_temperature,
+                                                 max_broadening_energy ) );
+
+    ++reaction_type_pointer;
+  }
+}
+
+// Create a Doppler broadened total reaction
+/*! \details The broadened cross section is tabulated on the shared energy
+ * grid. Since the kernel broadening operation is linear, the tabulated
+ * values are equal to the sum of the broadened (nodal) cross sections of the
+ * individual reactions.
+ */
+void Nuclide::createDopplerBroadenedTotalReaction(
+      const NeutronNuclearReaction& base_total_reaction,
+      const double max_broadening_energy,
+      std::unique_ptr<const NeutronNuclearReaction>& broadened_total_reaction ) const
+{
+  std::shared_ptr<std::vector<double> > cross_section(
+                                                    new std::vector<double> );
+
+  const size_t max_bin_index = d_energy_grid->size() - 2;
+
+  NodalCrossSectionFunction base_cross_section =
+    [this, &base_total_reaction, max_bin_index]( const size_t i ){
+      return base_total_reaction.getCrossSection(
+                                              (*d_energy_grid)[i],
+                                              std::min( i, max_bin_index ) );
+    };
+
+  broadenCrossSection( *d_energy_grid,
+                       base_cross_section,
+                       d_atomic_weight_ratio,
+                       d_temperature - base_total_reaction.getTemperature(),
+                       max_broadening_energy,
+                       *cross_section );
+
+  broadened_total_reaction.reset( new NeutronAbsorptionReaction(
+                                           d_energy_grid,
+                                           cross_section,
+                                           0,
+                                           d_grid_searcher,
+                                           base_total_reaction.getReactionType(),
+                                           0.0,
+                                           d_temperature ) );
+}
+
 // Sample a scattering reaction
 // NOTE: The scaled random number must be a random number multiplied by the
 //       total scattering cross section then subtracted by the absorption xs.
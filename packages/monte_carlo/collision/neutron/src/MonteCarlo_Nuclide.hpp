@@ -75,6 +75,11 @@ public:
           const ConstReactionMap& standard_scattering_reactions,
           const ConstReactionMap& standard_absorption_reactions );
 
+  //! Doppler broadened nuclide constructor
+  Nuclide( const Nuclide& base_nuclide,
+           const double temperature,
+           const double max_broadening_energy );
+
   //! Destructor
   virtual ~Nuclide()
   { /* ... */ }
@@ -103,12 +108,23 @@ public:
   //! Return the temperature of the nuclide (in MeV)
   double getTemperature() const;
 
+  //! Return the energy grid searcher
+  const Utility::HashBasedGridSearcher<double>& getGridSearcher() const;
+
   //! Return the total cross section at the desired energy
   double getTotalCrossSection( const double energy ) const;
 
+  //! Return the total cross section at the desired energy (efficient)
+  double getTotalCrossSection( const double energy,
+                               const size_t energy_grid_bin ) const;
+
   //! Return the total absorption cross section at the desired energy
   double getAbsorptionCrossSection( const double energy ) const;
 
+  //! Return the total absorption cross section at the desired energy (efficient)
+  double getAbsorptionCrossSection( const double energy,
+                                    const size_t energy_grid_bin ) const;
+
   //! Return the survival probability at the desired energy
   double getSurvivalProbability( const double energy ) const;
 
@@ -152,6 +168,18 @@ private:
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher );
 
+  // Create the Doppler broadened reactions
+  void createDopplerBroadenedReactions(
+                                   const ConstReactionMap& base_reactions,
+                                   const double max_broadening_energy,
+                                   ConstReactionMap& broadened_reactions ) const;
+
+  // Create a Doppler broadened total reaction
+  void createDopplerBroadenedTotalReaction(
+      const NeutronNuclearReaction& base_total_reaction,
+      const double max_broadening_energy,
+      std::unique_ptr<const NeutronNuclearReaction>& broadened_total_reaction ) const;
+
   // Sample an absorption reaction
   void sampleAbsorptionReaction( const double scaled_random_number,
 				 NeutronState& neutron,
@@ -186,6 +214,13 @@ private:
   // The temperature of the nuclide (MeV)
   double d_temperature;
 
+  // The energy grid
+  std::shared_ptr<const std::vector<double> > d_energy_grid;
+
+  // The energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_grid_searcher;
+
   // The total reaction
   std::unique_ptr<const NeutronNuclearReaction> d_total_reaction;
 
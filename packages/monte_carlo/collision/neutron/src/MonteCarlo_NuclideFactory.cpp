@@ -24,6 +24,7 @@ NuclideFactory::NuclideFactory(
                  const ScatteringCenterDefinitionDatabase& nuclide_definitions,
                  const SimulationProperties& properties,
                  const bool verbose )
+  : d_verbose( verbose )
 {
   FRENSIE_LOG_NOTIFICATION( "Starting to load nuclide data tables ... " );
   FRENSIE_FLUSH_ALL_LOGS();
@@ -69,6 +70,15 @@ NuclideFactory::NuclideFactory(
                                        atomic_weight_ratio,
                                        nuclear_data_properties,
                                        properties );
+
+      if( nuclide_definition.isDopplerBroadeningTemperatureSet() )
+      {
+        this->dopplerBroadenNuclide(
+                       *nuclide_name,
+                       nuclear_data_properties,
+                       nuclide_definition.getDopplerBroadeningTemperature(),
+                       properties );
+      }
     }
     else
     {
@@ -166,6 +176,77 @@ void NuclideFactory::createNuclideFromACETable(
   }
 }
 
+// Doppler broaden a nuclide to the desired temperature
+/*! \details The nuclide that has been created from the data table will be
+ * replaced by a nuclide that Doppler broadens the table data on-the-fly.
+ * Every nuclide that is created from the same table shares the table data
+ * (only the broadened total and total absorption cross sections are stored
+ * for each temperature), which is much less memory intensive than loading a
+ * separate table for every temperature.
+ */
+void NuclideFactory::dopplerBroadenNuclide(
+                            const std::string& nuclide_name,
+                            const Data::NuclearDataProperties& data_properties,
+                            const double temperature,
+                            const SimulationProperties& properties )
+{
+  const double evaluation_temperature =
+    data_properties.evaluationTemperatureInMeV().value();
+
+  // The table data can be used directly
+  if( temperature == evaluation_temperature )
+    return;
+
+  TEST_FOR_EXCEPTION( temperature < evaluation_temperature,
+                      std::runtime_error,
+                      "Nuclide " << nuclide_name << " cannot be Doppler "
+                      "broadened to " << temperature << " MeV because its "
+                      "nuclear data table (" << data_properties.tableName() <<
+                      ") was evaluated at a higher temperature ("
+                      << evaluation_temperature << " MeV)!" );
+
+  TEST_FOR_EXCEPTION( properties.getParticleMode() == NEUTRON_PHOTON_MODE ||
+                      properties.getParticleMode() ==
+                      NEUTRON_PHOTON_ELECTRON_MODE,
+                      std::runtime_error,
+                      "Nuclide " << nuclide_name << " cannot be Doppler "
+                      "broadened on-the-fly because photon production is "
+                      "not currently supported by broadened nuclides!" );
+
+  const std::pair<std::string,double>
+    broadened_nuclide_key( data_properties.tableName(), temperature );
+
+  // Check if the table has already been broadened to this temperature
+  if( d_broadened_nuclide_map.find( broadened_nuclide_key ) ==
+      d_broadened_nuclide_map.end() )
+  {
+    if( d_verbose )
+    {
+      FRENSIE_LOG_PARTIAL_NOTIFICATION( " Doppler broadening "
+                                        << data_properties.tableName() <<
+                                        " to " << temperature << " MeV ... " );
+      FRENSIE_FLUSH_ALL_LOGS();
+    }
+
+    const std::shared_ptr<const Nuclide>& base_nuclide =
+      d_nuclear_table_name_map[Data::NuclearDataProperties::ACE_FILE][data_properties.tableName()];
+
+    d_broadened_nuclide_map[broadened_nuclide_key].reset(
+             new Nuclide( *base_nuclide,
+                          temperature,
+                          properties.getMaxDopplerBroadeningEnergy() ) );
+
+    if( d_verbose )
+    {
+      FRENSIE_LOG_NOTIFICATION( "done." );
+      FRENSIE_FLUSH_ALL_LOGS();
+    }
+  }
+
+  d_nuclide_name_map[nuclide_name] =
+    d_broadened_nuclide_map[broadened_nuclide_key];
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -62,6 +62,13 @@ private:
                             const Data::NuclearDataProperties& data_properties,
                             const SimulationProperties& properties );
 
+  // Doppler broaden a nuclide to the desired temperature
+  void dopplerBroadenNuclide(
+                            const std::string& nuclide_name,
+                            const Data::NuclearDataProperties& data_properties,
+                            const double temperature,
+                            const SimulationProperties& properties );
+
   // The nuclide  map
   NuclideNameMap d_nuclide_name_map;
 
@@ -69,6 +76,11 @@ private:
   std::map<Data::NuclearDataProperties::FileType,NuclideNameMap>
   d_nuclear_table_name_map;
 
+  // The Doppler broadened nuclide map (used to prevent multiple broadenings
+  // of the same table to the same temperature)
+  std::map<std::pair<std::string,double>,NuclideNameMap::mapped_type>
+  d_broadened_nuclide_map;
+
   // Verbose nuclide construction
   bool d_verbose;
 };
@@ -0,0 +1,243 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDopplerBroadenedNeutronNuclearReaction.cpp
+//! \author Alex Robinson
+//! \brief  Doppler broadened neutron nuclear reaction unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_DopplerBroadenedNeutronNuclearReaction.hpp"
+#include "MonteCarlo_NeutronAbsorptionReaction.hpp"
+#include "Utility_StandardHashBasedGridSearcher.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+// The atomic weight ratio of the test target
+const double atomic_weight_ratio = 1.0;
+
+// The broadened temperature (293.6 K in MeV) - the base data is at 0 K
+const double temperature = 2.53010e-8;
+
+// The reduced speed scaling factor
+const double alpha = atomic_weight_ratio/temperature;
+
+// The max broadening energy
+const double max_broadening_energy = 1e-5;
+
+std::shared_ptr<const std::vector<double> > energy_grid;
+
+std::shared_ptr<const MonteCarlo::NeutronNuclearReaction>
+base_constant_reaction;
+
+std::shared_ptr<const MonteCarlo::DopplerBroadenedNeutronNuclearReaction>
+constant_reaction;
+
+std::shared_ptr<const MonteCarlo::DopplerBroadenedNeutronNuclearReaction>
+inverse_velocity_reaction;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// The analytic broadened constant cross section
+double evaluateBroadenedConstantCrossSection( const double cross_section,
+                                              const double x )
+{
+  return cross_section*((1.0 + 0.5/(x*x))*std::erf( x ) +
+                        std::exp( -x*x )/
+                        (x*std::sqrt( Utility::PhysicalConstants::pi )));
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the wrapped reaction properties can be returned
+FRENSIE_UNIT_TEST( DopplerBroadenedNeutronNuclearReaction,
+                   getReactionProperties )
+{
+  FRENSIE_CHECK_EQUAL( constant_reaction->getReactionType(),
+                       MonteCarlo::N__GAMMA_REACTION );
+  FRENSIE_CHECK_EQUAL( constant_reaction->getTemperature(), temperature );
+  FRENSIE_CHECK_EQUAL( constant_reaction->getMaxBroadeningEnergy(),
+                       max_broadening_energy );
+  FRENSIE_CHECK_EQUAL( constant_reaction->getThresholdEnergy(), 1e-11 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( constant_reaction->getMaxEnergy(),
+                                   1e-3,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( constant_reaction->getQValue(), 1.0 );
+  FRENSIE_CHECK_EQUAL( constant_reaction->getNumberOfEmittedParticles( 1e-6 ),
+                       0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a constant cross section is broadened
+FRENSIE_UNIT_TEST( DopplerBroadenedNeutronNuclearReaction,
+                   getCrossSection_constant )
+{
+  std::vector<double> reduced_speeds( {0.5, 1.0, 2.0, 10.0} );
+
+  for( size_t i = 0; i < reduced_speeds.size(); ++i )
+  {
+    const double energy = reduced_speeds[i]*reduced_speeds[i]/alpha;
+
+    // The interpolation error between the grid points is small compared to
+    // the tolerance
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+          constant_reaction->getCrossSection( energy ),
+          evaluateBroadenedConstantCrossSection( 20.0, reduced_speeds[i] ),
+          1e-4 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a 1/v cross section is invariant under broadening
+FRENSIE_UNIT_TEST( DopplerBroadenedNeutronNuclearReaction,
+                   getCrossSection_inverse_velocity )
+{
+  std::vector<double> energies( {1e-10, 1e-9, 1e-8, 2.53e-8, 1e-7, 1e-6} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                     inverse_velocity_reaction->getCrossSection( energies[i] ),
+                     1.0/std::sqrt( energies[i] ),
+                     1e-3 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the base cross section is returned above the max broadening
+// energy
+FRENSIE_UNIT_TEST( DopplerBroadenedNeutronNuclearReaction,
+                   getCrossSection_above_max_broadening_energy )
+{
+  FRENSIE_CHECK_EQUAL( constant_reaction->getCrossSection( 1e-5 ),
+                       base_constant_reaction->getCrossSection( 1e-5 ) );
+  FRENSIE_CHECK_EQUAL( constant_reaction->getCrossSection( 1e-4 ),
+                       base_constant_reaction->getCrossSection( 1e-4 ) );
+  FRENSIE_CHECK_EQUAL( constant_reaction->getCrossSection( 1e-3 ),
+                       base_constant_reaction->getCrossSection( 1e-3 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cached broadened cross sections are reused
+FRENSIE_UNIT_TEST( DopplerBroadenedNeutronNuclearReaction,
+                   getCrossSection_cached )
+{
+  std::vector<double> energies( {1e-10, 3e-9, 2.53e-8, 7e-7} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    const size_t bin_index =
+      std::upper_bound( energy_grid->begin(),
+                        energy_grid->end(),
+                        energies[i] ) - energy_grid->begin() - 1;
+
+    const double cross_section =
+      constant_reaction->getCrossSection( energies[i] );
+
+    FRENSIE_CHECK_EQUAL( constant_reaction->getCrossSection( energies[i] ),
+                         cross_section );
+    FRENSIE_CHECK_EQUAL( constant_reaction->getCrossSection( energies[i],
+                                                             bin_index ),
+                         cross_section );
+  }
+
+  // An energy grid point is the upper node of one bin and the lower node of
+  // the next
+  const double grid_point_cross_section =
+    constant_reaction->getCrossSection( (*energy_grid)[600], 599 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+               constant_reaction->getCrossSection( (*energy_grid)[600], 600 ),
+               grid_point_cross_section,
+               1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // 200 log spaced grid points per decade from 1e-11 MeV to 1e-3 MeV
+  const size_t number_of_grid_points = 8*200 + 1;
+
+  std::shared_ptr<std::vector<double> >
+    tmp_energy_grid( new std::vector<double>( number_of_grid_points ) );
+
+  std::shared_ptr<std::vector<double> >
+    constant_cross_section( new std::vector<double>( number_of_grid_points,
+                                                     20.0 ) );
+
+  std::shared_ptr<std::vector<double> >
+    inverse_velocity_cross_section(
+                           new std::vector<double>( number_of_grid_points ) );
+
+  for( size_t i = 0; i < number_of_grid_points; ++i )
+  {
+    (*tmp_energy_grid)[i] = std::pow( 10.0, -11.0 + i/200.0 );
+    (*inverse_velocity_cross_section)[i] =
+      1.0/std::sqrt( (*tmp_energy_grid)[i] );
+  }
+
+  energy_grid = tmp_energy_grid;
+
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> > grid_searcher(
+         new Utility::StandardHashBasedGridSearcher<std::vector<double>, false>(
+                                                        energy_grid, 100 ) );
+
+  // The base reactions are tabulated at 0 K
+  base_constant_reaction.reset( new MonteCarlo::NeutronAbsorptionReaction(
+                                                   energy_grid,
+                                                   constant_cross_section,
+                                                   0u,
+                                                   grid_searcher,
+                                                   MonteCarlo::N__GAMMA_REACTION,
+                                                   1.0,
+                                                   0.0 ) );
+
+  std::shared_ptr<const MonteCarlo::NeutronNuclearReaction>
+    base_inverse_velocity_reaction( new MonteCarlo::NeutronAbsorptionReaction(
+                                            energy_grid,
+                                            inverse_velocity_cross_section,
+                                            0u,
+                                            grid_searcher,
+                                            MonteCarlo::N__GAMMA_REACTION,
+                                            0.0,
+                                            0.0 ) );
+
+  constant_reaction.reset(
+              new MonteCarlo::DopplerBroadenedNeutronNuclearReaction(
+                                                       base_constant_reaction,
+                                                       energy_grid,
+                                                       grid_searcher,
+                                                       atomic_weight_ratio,
+                                                       temperature,
+                                                       max_broadening_energy ) );
+
+  inverse_velocity_reaction.reset(
+              new MonteCarlo::DopplerBroadenedNeutronNuclearReaction(
+                                                base_inverse_velocity_reaction,
+                                                energy_grid,
+                                                grid_searcher,
+                                                atomic_weight_ratio,
+                                                temperature,
+                                                max_broadening_energy ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDopplerBroadenedNeutronNuclearReaction.cpp
+//---------------------------------------------------------------------------//
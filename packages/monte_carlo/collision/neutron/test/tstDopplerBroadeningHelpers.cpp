@@ -0,0 +1,181 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDopplerBroadeningHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Doppler broadening helper function unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_DopplerBroadeningHelpers.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+// The atomic weight ratio of the test target
+const double atomic_weight_ratio = 1.0;
+
+// The temperature difference (293.6 K in MeV)
+const double temperature_difference = 2.53010e-8;
+
+// The reduced speed scaling factor
+const double alpha = atomic_weight_ratio/temperature_difference;
+
+// The log spaced test energy grid
+std::vector<double> energy_grid;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// The analytic broadened constant cross section
+double evaluateBroadenedConstantCrossSection( const double cross_section,
+                                              const double x )
+{
+  return cross_section*((1.0 + 0.5/(x*x))*std::erf( x ) +
+                        std::exp( -x*x )/
+                        (x*std::sqrt( Utility::PhysicalConstants::pi )));
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a constant cross section can be broadened
+FRENSIE_UNIT_TEST( DopplerBroadeningHelpers,
+                   evaluateDopplerBroadenedCrossSection_constant )
+{
+  MonteCarlo::NodalCrossSectionFunction cross_section =
+    []( const size_t ){ return 20.0; };
+
+  std::vector<double> reduced_speeds( {0.5, 1.0, 2.0, 10.0} );
+
+  for( size_t i = 0; i < reduced_speeds.size(); ++i )
+  {
+    const double energy = reduced_speeds[i]*reduced_speeds[i]/alpha;
+
+    const double broadened_cross_section =
+      MonteCarlo::evaluateDopplerBroadenedCrossSection(
+                                                      energy_grid,
+                                                      cross_section,
+                                                      atomic_weight_ratio,
+                                                      temperature_difference,
+                                                      energy );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+          broadened_cross_section,
+          evaluateBroadenedConstantCrossSection( 20.0, reduced_speeds[i] ),
+          1e-5 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a 1/v cross section is invariant under broadening
+FRENSIE_UNIT_TEST( DopplerBroadeningHelpers,
+                   evaluateDopplerBroadenedCrossSection_inverse_velocity )
+{
+  MonteCarlo::NodalCrossSectionFunction cross_section =
+    []( const size_t i ){ return 1.0/std::sqrt( energy_grid[i] ); };
+
+  std::vector<double> energies( {1e-10, 1e-9, 1e-8, 2.53e-8, 1e-7, 1e-6} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    const double broadened_cross_section =
+      MonteCarlo::evaluateDopplerBroadenedCrossSection(
+                                                      energy_grid,
+                                                      cross_section,
+                                                      atomic_weight_ratio,
+                                                      temperature_difference,
+                                                      energies[i] );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( broadened_cross_section,
+                                     1.0/std::sqrt( energies[i] ),
+                                     1e-3 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a cross section can be broadened at the energy grid points
+FRENSIE_UNIT_TEST( DopplerBroadeningHelpers, broadenCrossSection )
+{
+  // A narrow resonance on a constant background
+  MonteCarlo::NodalCrossSectionFunction cross_section =
+    []( const size_t i ){
+      const double delta = (energy_grid[i] - 1e-6)/5e-8;
+
+      return 10.0 + 1000.0/(1.0 + delta*delta);
+    };
+
+  std::vector<double> broadened_cross_section;
+
+  MonteCarlo::broadenCrossSection( energy_grid,
+                                   cross_section,
+                                   atomic_weight_ratio,
+                                   temperature_difference,
+                                   1e-5,
+                                   broadened_cross_section );
+
+  FRENSIE_REQUIRE_EQUAL( broadened_cross_section.size(), energy_grid.size() );
+
+  double max_cross_section = 0.0;
+  double max_broadened_cross_section = 0.0;
+
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    if( energy_grid[i] < 1e-5 )
+    {
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+              broadened_cross_section[i],
+              MonteCarlo::evaluateDopplerBroadenedCrossSection(
+                                                      energy_grid,
+                                                      cross_section,
+                                                      atomic_weight_ratio,
+                                                      temperature_difference,
+                                                      energy_grid[i] ),
+              1e-15 );
+    }
+    else
+    {
+      FRENSIE_CHECK_EQUAL( broadened_cross_section[i], cross_section( i ) );
+    }
+
+    // Note: at very low energies the broadened background becomes 1/v
+    if( energy_grid[i] > 1e-7 )
+    {
+      max_cross_section = std::max( max_cross_section, cross_section( i ) );
+      max_broadened_cross_section =
+        std::max( max_broadened_cross_section, broadened_cross_section[i] );
+    }
+  }
+
+  // The resonance peak must be lowered by the broadening
+  FRENSIE_CHECK_LESS( max_broadened_cross_section, 0.5*max_cross_section );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // 200 log spaced grid points per decade from 1e-11 MeV to 1e-3 MeV
+  const size_t number_of_grid_points = 8*200 + 1;
+
+  energy_grid.resize( number_of_grid_points );
+
+  for( size_t i = 0; i < number_of_grid_points; ++i )
+    energy_grid[i] = std::pow( 10.0, -11.0 + i/200.0 );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDopplerBroadeningHelpers.cpp
+//---------------------------------------------------------------------------//
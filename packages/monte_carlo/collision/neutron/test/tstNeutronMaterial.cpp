@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "MonteCarlo_NuclideFactory.hpp"
@@ -28,6 +29,10 @@ using boost::units::si::kelvin;
 
 std::shared_ptr<const MonteCarlo::NeutronMaterial> material;
 
+std::shared_ptr<const MonteCarlo::NeutronMaterial> unionized_material;
+
+std::shared_ptr<const MonteCarlo::NeutronMaterial> hashed_unionized_material;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -245,6 +250,170 @@ FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, collideSurvivalBias )
   FRENSIE_CHECK_EQUAL( bank.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cross sections evaluated at the last energy are reused
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, cross_section_cache )
+{
+  MonteCarlo::MacroscopicCrossSectionCache::resetStatistics();
+
+  double cross_section = material->getMacroscopicTotalCrossSection( 3.0e-6 );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfHits(), 0ull );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfMisses(), 1ull );
+
+  FRENSIE_CHECK_EQUAL( material->getMacroscopicTotalCrossSection( 3.0e-6 ),
+                       cross_section );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfHits(), 1ull );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfMisses(), 1ull );
+
+  // The scattering center cross sections are reused when colliding
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 3.0e-6 );
+  neutron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  material->collideAnalogue( neutron, bank );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfHits(), 2ull );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfMisses(), 1ull );
+
+  material->getMacroscopicAbsorptionCrossSection( 3.0e-6 );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfMisses(), 2ull );
+
+  // A different material with the same energy must not use the cache
+  unionized_material->getMacroscopicTotalCrossSection( 3.0e-6 );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfHits(), 2ull );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::MacroscopicCrossSectionCache::getNumberOfMisses(), 3ull );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unionized energy grid can be returned
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, getUnionizedEnergyGrid )
+{
+  FRENSIE_CHECK_EQUAL( material->getUnionizedEnergyGridMode(),
+                       MonteCarlo::NO_UNIONIZED_ENERGY_GRID );
+  FRENSIE_CHECK( material->getUnionizedEnergyGrid().empty() );
+
+  FRENSIE_CHECK_EQUAL( unionized_material->getUnionizedEnergyGridMode(),
+                       MonteCarlo::FULL_UNIONIZED_ENERGY_GRID );
+  FRENSIE_CHECK_EQUAL( hashed_unionized_material->getUnionizedEnergyGridMode(),
+                       MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID );
+
+  const std::vector<double>& unionized_energy_grid =
+    unionized_material->getUnionizedEnergyGrid();
+
+  FRENSIE_CHECK_EQUAL( unionized_energy_grid.front(), 1e-11 );
+  FRENSIE_CHECK_EQUAL( unionized_energy_grid.back(), 20.0 );
+  FRENSIE_CHECK_EQUAL( hashed_unionized_material->getUnionizedEnergyGrid(),
+                       unionized_energy_grid );
+
+  // Every nuclide energy grid point in the energy range must be on the grid
+  const Utility::HashBasedGridSearcher<double>& nuclide_grid_searcher =
+    material->getScatteringCenter( "H-1_293.6K" )->getGridSearcher();
+
+  size_t number_of_missing_grid_points = 0;
+  size_t number_of_grid_points_in_range = 2;
+
+  for( size_t i = 0; i < nuclide_grid_searcher.getNumberOfGridPoints(); ++i )
+  {
+    const double grid_point = nuclide_grid_searcher.getGridPoint( i );
+
+    if( grid_point > 1e-11 && grid_point < 20.0 )
+    {
+      ++number_of_grid_points_in_range;
+
+      if( !std::binary_search( unionized_energy_grid.begin(),
+                               unionized_energy_grid.end(),
+                               grid_point ) )
+        ++number_of_missing_grid_points;
+    }
+  }
+
+  FRENSIE_CHECK_EQUAL( number_of_missing_grid_points, 0 );
+  FRENSIE_CHECK_EQUAL( unionized_energy_grid.size(),
+                       number_of_grid_points_in_range );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unionized macroscopic cross sections can be returned
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen,
+                   getMacroscopicCrossSection_unionized )
+{
+  const std::vector<double> energies( {1.0e-11, 1.03125e-11, 1.0e-8, 3.0e-6,
+                                       1.0e-3, 1.0, 1.5e1, 2.0e1} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+          unionized_material->getMacroscopicTotalCrossSection( energies[i] ),
+          material->getMacroscopicTotalCrossSection( energies[i] ),
+          1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+          unionized_material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+          material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+          1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+          hashed_unionized_material->getMacroscopicTotalCrossSection( energies[i] ),
+          material->getMacroscopicTotalCrossSection( energies[i] ),
+          1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+          hashed_unionized_material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+          material->getMacroscopicAbsorptionCrossSection( energies[i] ),
+          1e-12 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron can collide with a unionized material
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, collideAnalogue_unionized )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 1.0 );
+  neutron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  unionized_material->collideAnalogue( neutron, bank );
+
+  FRENSIE_CHECK_EQUAL( neutron.getWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  neutron.setEnergy( 1.0 );
+
+  hashed_unionized_material->collideAnalogue( neutron, bank );
+
+  FRENSIE_CHECK_EQUAL( neutron.getWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a neutron can collide with a unionized material and survival bias
+FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, collideSurvivalBias_unionized )
+{
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 1.03125e-11 );
+  neutron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  unionized_material->collideSurvivalBias( neutron, bank );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getWeight(), 0.98581348192787, 1e-14 );
+
+  neutron.setEnergy( 1.03125e-11 );
+  neutron.setWeight( 1.0 );
+
+  hashed_unionized_material->collideSurvivalBias( neutron, bank );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( neutron.getWeight(), 0.98581348192787, 1e-14 );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -318,6 +487,34 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                                    nuclide_fractions,
                                                    nuclide_names ) );
 
+  {
+    std::shared_ptr<MonteCarlo::NeutronMaterial> tmp_material(
+               new MonteCarlo::NeutronMaterial( 0,
+                                                -1.0, // mass density (g/cm^3)
+                                                nuclide_map,
+                                                nuclide_fractions,
+                                                nuclide_names ) );
+
+    tmp_material->unionizeEnergyGrid( MonteCarlo::FULL_UNIONIZED_ENERGY_GRID,
+                                      1e-11,
+                                      20.0 );
+
+    unionized_material = tmp_material;
+
+    tmp_material.reset( new MonteCarlo::NeutronMaterial(
+                                                0,
+                                                -1.0, // mass density (g/cm^3)
+                                                nuclide_map,
+                                                nuclide_fractions,
+                                                nuclide_names ) );
+
+    tmp_material->unionizeEnergyGrid( MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID,
+                                      1e-11,
+                                      20.0 );
+
+    hashed_unionized_material = tmp_material;
+  }
+
   // Initialize the random number generator
   Utility::RandomNumberGenerator::createStreams();
 }
@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ArenaParticleBank.cpp
+//! \author Alex Robinson
+//! \brief  Arena particle bank class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <typeinfo>
+
+// FRENSIE Includes
+#include "MonteCarlo_ArenaParticleBank.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_PositronState.hpp"
+#include "MonteCarlo_AdjointPhotonState.hpp"
+#include "MonteCarlo_AdjointPhotonProbeState.hpp"
+#include "MonteCarlo_AdjointElectronState.hpp"
+#include "MonteCarlo_AdjointElectronProbeState.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default Constructor
+ArenaParticleBank::ArenaParticleBank()
+  : ArenaParticleBank( std::make_shared<ParticleStateArena>() )
+{ /* ... */ }
+
+// Constructor
+/*! \details The arena can be shared with other banks that will only be
+ * used by the same thread.
+ */
+ArenaParticleBank::ArenaParticleBank(
+                           const std::shared_ptr<ParticleStateArena>& arena )
+  : ParticleBank(),
+    d_arena( arena ),
+    d_free_nodes()
+{
+  // Make sure that the arena is valid
+  testPrecondition( arena.get() );
+}
+
+// Push a particle to the bank
+/*! \details The bank will take ownership of the particle passed into it. To
+ * ensure that it has ownership it will create a copy of the particle in the
+ * arena.
+ */
+void ArenaParticleBank::push( const ParticleState& particle )
+{
+  BankContainerType& particle_states = this->getParticleStates();
+
+  if( d_free_nodes.empty() )
+    particle_states.push_back( this->createCopy( particle ) );
+  else
+  {
+    d_free_nodes.front() = this->createCopy( particle );
+
+    particle_states.splice( particle_states.end(),
+                            d_free_nodes,
+                            d_free_nodes.begin() );
+  }
+}
+
+// Pop a particle from the bank
+/*! \details The particle state will be returned to the arena and the
+ * container node will be kept for reuse.
+ */
+void ArenaParticleBank::pop()
+{
+  // Make sure the bank is not empty
+  testPrecondition( !this->isEmpty() );
+
+  BankContainerType& particle_states = this->getParticleStates();
+
+  particle_states.front().reset();
+
+  d_free_nodes.splice( d_free_nodes.end(),
+                       particle_states,
+                       particle_states.begin() );
+}
+
+// Return the arena
+const ParticleStateArena& ArenaParticleBank::getArena() const
+{
+  return *d_arena;
+}
+
+// Create a copy of the particle state in the arena
+/*! \details Particle state types that are not known to the bank will be
+ * cloned on the heap.
+ */
+std::shared_ptr<ParticleState> ArenaParticleBank::createCopy(
+                                               const ParticleState& particle )
+{
+  const std::type_info& particle_type = typeid( particle );
+
+  if( particle_type == typeid( PhotonState ) )
+    return this->createCopy<PhotonState>( particle );
+  else if( particle_type == typeid( ElectronState ) )
+    return this->createCopy<ElectronState>( particle );
+  else if( particle_type == typeid( NeutronState ) )
+    return this->createCopy<NeutronState>( particle );
+  else if( particle_type == typeid( PositronState ) )
+    return this->createCopy<PositronState>( particle );
+  else if( particle_type == typeid( AdjointPhotonState ) )
+    return this->createCopy<AdjointPhotonState>( particle );
+  else if( particle_type == typeid( AdjointPhotonProbeState ) )
+    return this->createCopy<AdjointPhotonProbeState>( particle );
+  else if( particle_type == typeid( AdjointElectronState ) )
+    return this->createCopy<AdjointElectronState>( particle );
+  else if( particle_type == typeid( AdjointElectronProbeState ) )
+    return this->createCopy<AdjointElectronProbeState>( particle );
+  else
+    return std::shared_ptr<ParticleState>( particle.clone() );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ArenaParticleBank.cpp
+//---------------------------------------------------------------------------//
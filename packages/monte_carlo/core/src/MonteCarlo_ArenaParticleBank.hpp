@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ArenaParticleBank.hpp
+//! \author Alex Robinson
+//! \brief  Arena particle bank class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ARENA_PARTICLE_BANK_HPP
+#define MONTE_CARLO_ARENA_PARTICLE_BANK_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_ParticleStateArena.hpp"
+
+namespace MonteCarlo{
+
+/*! The arena particle bank class
+ *
+ * The particle states that are copied into this bank (and their shared
+ * pointer control blocks) are stored in a particle state arena instead of
+ * being individually allocated on the heap. The bank container nodes of
+ * popped states are also recycled. The ordering semantics and the sort,
+ * merge and splice behavior are identical to the base class. Because the
+ * arena is not thread safe, a bank (and the states that it has allocated)
+ * should only be used by a single thread.
+ */
+class ArenaParticleBank : public ParticleBank
+{
+
+public:
+
+  //! Default Constructor
+  ArenaParticleBank();
+
+  //! Constructor
+  ArenaParticleBank( const std::shared_ptr<ParticleStateArena>& arena );
+
+  //! Destructor
+  ~ArenaParticleBank()
+  { /* ... */ }
+
+  // Use the base class push methods
+  using ParticleBank::push;
+
+  //! Insert a particle into the bank
+  void push( const ParticleState& particle ) override;
+
+  // Use the base class pop methods
+  using ParticleBank::pop;
+
+  //! Pop the top particle from bank
+  void pop() override;
+
+  //! Return the arena
+  const ParticleStateArena& getArena() const;
+
+private:
+
+  // Create a copy of the particle state in the arena
+  std::shared_ptr<ParticleState> createCopy( const ParticleState& particle );
+
+  // Create a copy of the particle state in the arena
+  template<typename State>
+  std::shared_ptr<ParticleState> createCopy( const ParticleState& particle );
+
+  // The particle state arena
+  std::shared_ptr<ParticleStateArena> d_arena;
+
+  // The recycled bank container nodes
+  BankContainerType d_free_nodes;
+};
+
+// Create a copy of the particle state in the arena
+template<typename State>
+inline std::shared_ptr<ParticleState> ArenaParticleBank::createCopy(
+                                             const ParticleState& particle )
+{
+  return std::allocate_shared<State>( ParticleStateArenaAllocator<State>( d_arena ),
+                                      static_cast<const State&>( particle ),
+                                      false,
+                                      false );
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ARENA_PARTICLE_BANK_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ArenaParticleBank.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,46 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DistributedBatchScheduleType.cpp
+//! \author Alex Robinson
+//! \brief  Distributed batch schedule type helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_DistributedBatchScheduleType.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Convert a MonteCarlo::DistributedBatchScheduleType to a string
+std::string ToStringTraits<MonteCarlo::DistributedBatchScheduleType>::toString( const MonteCarlo::DistributedBatchScheduleType type )
+{
+  switch( type )
+  {
+    case MonteCarlo::STATIC_DISTRIBUTED_BATCH_SCHEDULE:
+      return "Static Distributed Batch Schedule";
+    case MonteCarlo::ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE:
+      return "Adaptive Distributed Batch Schedule";
+    case MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE:
+      return "Work Stealing Distributed Batch Schedule";
+    default:
+    {
+      THROW_EXCEPTION( std::logic_error,
+                       "Unknown distributed batch schedule type "
+                       "encountered!" );
+    }
+  }
+}
+
+// Place the MonteCarlo::DistributedBatchScheduleType in a stream
+void ToStringTraits<MonteCarlo::DistributedBatchScheduleType>::toStream( std::ostream& os, const MonteCarlo::DistributedBatchScheduleType type )
+{
+  os << ToStringTraits<MonteCarlo::DistributedBatchScheduleType>::toString( type );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DistributedBatchScheduleType.cpp
+//---------------------------------------------------------------------------//
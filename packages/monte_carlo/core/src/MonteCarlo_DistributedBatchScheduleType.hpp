@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DistributedBatchScheduleType.hpp
+//! \author Alex Robinson
+//! \brief  Distributed batch schedule type enum and helper function decls.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DISTRIBUTED_BATCH_SCHEDULE_TYPE_HPP
+#define MONTE_CARLO_DISTRIBUTED_BATCH_SCHEDULE_TYPE_HPP
+
+// FRENSIE Includes
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace MonteCarlo{
+
+/*! The distributed batch schedule type enum
+ *
+ * The schedule determines how the histories of a rendezvous batch are
+ * distributed among the processes of a distributed simulation. With the
+ * static schedule the root process hands out batches of a fixed size to
+ * worker processes as they become idle. The adaptive schedule also uses the
+ * root process to hand out batches but the size of each batch is based on the
+ * measured throughput of the worker and the number of histories that remain
+ * in the rendezvous batch. With the work stealing schedule there is no
+ * coordinating process: every process (including the root process) is
+ * assigned an equal range of histories and processes that have completed
+ * their range steal half of the remaining histories from other processes.
+ * Note that with the work stealing schedule the simulation wall time is only
+ * checked between rendezvous batches. When adding a new type the
+ * ToStringTraits methods and the serialization method must be updated.
+ */
+enum DistributedBatchScheduleType
+{
+  STATIC_DISTRIBUTED_BATCH_SCHEDULE = 0,
+  ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE,
+  WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE
+};
+
+} // end MonteCarlo namespace
+
+namespace Utility{
+
+/*! \brief Specialization of Utility::ToStringTraits for
+ * MonteCarlo::DistributedBatchScheduleType
+ * \ingroup to_string_traits
+ */
+template<>
+struct ToStringTraits<MonteCarlo::DistributedBatchScheduleType>
+{
+  //! Convert a MonteCarlo::DistributedBatchScheduleType to a string
+  static std::string toString( const MonteCarlo::DistributedBatchScheduleType type );
+
+  //! Place the MonteCarlo::DistributedBatchScheduleType in a stream
+  static void toStream( std::ostream& os, const MonteCarlo::DistributedBatchScheduleType type );
+};
+
+} // end Utility namespace
+
+namespace std{
+
+//! Stream operator for printing DistributedBatchScheduleType enums
+inline std::ostream& operator<<( std::ostream& os,
+                                 const MonteCarlo::DistributedBatchScheduleType type )
+{
+  os << Utility::toString( type );
+  return os;
+}
+
+} // end std namespace
+
+namespace boost{
+
+namespace serialization{
+
+//! Serialize the MonteCarlo::DistributedBatchScheduleType enum
+template<typename Archive>
+void serialize( Archive& archive,
+                MonteCarlo::DistributedBatchScheduleType& type,
+                const unsigned version )
+{
+  if( Archive::is_saving::value )
+    archive & (int)type;
+  else
+  {
+    int raw_type;
+
+    archive & raw_type;
+
+    switch( raw_type )
+    {
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::STATIC_DISTRIBUTED_BATCH_SCHEDULE, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE, int, type );
+
+      default:
+      {
+        THROW_EXCEPTION( std::logic_error,
+                         "Cannot convert the deserialized raw distributed "
+                         "batch schedule type to its corresponding enum "
+                         "value!" );
+      }
+    }
+  }
+}
+
+} // end serialization namespace
+
+} // end boost namespace
+
+#endif // end MONTE_CARLO_DISTRIBUTED_BATCH_SCHEDULE_TYPE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DistributedBatchScheduleType.hpp
+//---------------------------------------------------------------------------//
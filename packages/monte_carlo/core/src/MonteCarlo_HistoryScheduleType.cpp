@@ -0,0 +1,47 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_HistoryScheduleType.cpp
+//! \author Alex Robinson
+//! \brief  History schedule type helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryScheduleType.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Convert a MonteCarlo::HistoryScheduleType to a string
+std::string ToStringTraits<MonteCarlo::HistoryScheduleType>::toString( const MonteCarlo::HistoryScheduleType type )
+{
+  switch( type )
+  {
+    case MonteCarlo::STATIC_HISTORY_SCHEDULE:
+      return "Static History Schedule";
+    case MonteCarlo::DYNAMIC_HISTORY_SCHEDULE:
+      return "Dynamic History Schedule";
+    case MonteCarlo::GUIDED_HISTORY_SCHEDULE:
+      return "Guided History Schedule";
+    case MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE:
+      return "Work Stealing History Schedule";
+    default:
+    {
+      THROW_EXCEPTION( std::logic_error,
+                       "Unknown history schedule type encountered!" );
+    }
+  }
+}
+
+// Place the MonteCarlo::HistoryScheduleType in a stream
+void ToStringTraits<MonteCarlo::HistoryScheduleType>::toStream( std::ostream& os, const MonteCarlo::HistoryScheduleType type )
+{
+  os << ToStringTraits<MonteCarlo::HistoryScheduleType>::toString( type );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_HistoryScheduleType.cpp
+//---------------------------------------------------------------------------//
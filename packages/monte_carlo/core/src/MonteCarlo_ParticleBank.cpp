@@ -138,6 +138,20 @@ void ParticleBank::splice( ParticleBank& other_bank )
 			    other_bank.d_particle_states );
 }
 
+// Splice the top particle onto the end of another bank
+/*! \details The top particle state will not be copied - ownership of the
+ * state is transferred to the other bank.
+ */
+void ParticleBank::spliceTop( ParticleBank& other_bank )
+{
+  // Make sure the bank is not empty
+  testPrecondition( !this->isEmpty() );
+
+  other_bank.d_particle_states.splice( other_bank.d_particle_states.end(),
+                                       d_particle_states,
+                                       d_particle_states.begin() );
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( ParticleBank );
 
 } // end MonteCarlo namespace
@@ -64,7 +64,7 @@ public:
   void push( std::shared_ptr<State>& particle );
 
   //! Insert a particle into the bank
-  void push( const ParticleState& particle );
+  virtual void push( const ParticleState& particle );
 
   //! Insert a neutron into the bank after an interaction
   template<template<typename> class SmartPointer>
@@ -80,7 +80,7 @@ public:
 		     const int reaction );
 
   //! Pop the top particle from bank
-  void pop();
+  virtual void pop();
 
   //! Pop the top particle from the bank and store it in the smart pointer
   template<template<typename> class SmartPointer>
@@ -99,11 +99,17 @@ public:
   //! Splice the bank with another bank
   virtual void splice( ParticleBank& other_bank );
 
+  //! Splice the top particle onto the end of another bank
+  void spliceTop( ParticleBank& other_bank );
+
 protected:
 
   //! The bank container type
   typedef std::list<std::shared_ptr<ParticleState> > BankContainerType;
 
+  //! Return the particle states
+  BankContainerType& getParticleStates();
+
 private:
 
   // Dereference a smart ptr
@@ -122,6 +128,12 @@ private:
   BankContainerType d_particle_states;
 };
 
+// Return the particle states
+inline ParticleBank::BankContainerType& ParticleBank::getParticleStates()
+{
+  return d_particle_states;
+}
+
 // Dereference a smart pointer
 inline const ParticleState& ParticleBank::dereference(
                              const std::shared_ptr<ParticleState>& pointer )
@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleStateArena.cpp
+//! \author Alex Robinson
+//! \brief  Particle state arena class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleStateArena.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ParticleStateArena::ParticleStateArena( const size_t slots_per_block )
+  : d_slots_per_block( slots_per_block ),
+    d_pools()
+{
+  // Make sure that the number of slots per block is valid
+  testPrecondition( slots_per_block > 0 );
+}
+
+// Destructor
+ParticleStateArena::~ParticleStateArena()
+{
+  for( size_t i = 0; i < d_pools.size(); ++i )
+  {
+    for( size_t j = 0; j < d_pools[i].blocks.size(); ++j )
+      ::operator delete( d_pools[i].blocks[j] );
+  }
+}
+
+// Allocate a slot
+void* ParticleStateArena::allocate( const std::type_info& slot_type,
+                                    const size_t slot_size )
+{
+  Pool& pool = this->getPool( slot_type, slot_size );
+
+  if( !pool.free_slot )
+    this->addBlock( pool );
+
+  void* slot = pool.free_slot;
+
+  // The first bytes of a free slot store the address of the next free slot
+  pool.free_slot = *static_cast<void**>( slot );
+
+  return slot;
+}
+
+// Return a slot to the arena
+void ParticleStateArena::deallocate( void* slot,
+                                     const std::type_info& slot_type,
+                                     const size_t slot_size )
+{
+  // Make sure that the slot is valid
+  testPrecondition( slot != NULL );
+
+  Pool& pool = this->getPool( slot_type, slot_size );
+
+  *static_cast<void**>( slot ) = pool.free_slot;
+
+  pool.free_slot = slot;
+}
+
+// Return the number of slots per block
+size_t ParticleStateArena::getNumberOfSlotsPerBlock() const
+{
+  return d_slots_per_block;
+}
+
+// Return the number of pools (one for each slot type)
+size_t ParticleStateArena::getNumberOfPools() const
+{
+  return d_pools.size();
+}
+
+// Return the number of blocks that have been acquired
+size_t ParticleStateArena::getNumberOfBlocks() const
+{
+  size_t number_of_blocks = 0;
+
+  for( size_t i = 0; i < d_pools.size(); ++i )
+    number_of_blocks += d_pools[i].blocks.size();
+
+  return number_of_blocks;
+}
+
+// Calculate the aligned slot size
+/*! \details Every slot must be able to store the address of the next free
+ * slot and every slot must start on a max_align_t boundary.
+ */
+size_t ParticleStateArena::calculateAlignedSlotSize( const size_t slot_size )
+{
+  const size_t alignment = alignof(std::max_align_t);
+
+  size_t aligned_slot_size =
+    (slot_size > sizeof(void*) ? slot_size : sizeof(void*));
+
+  return ((aligned_slot_size + alignment - 1)/alignment)*alignment;
+}
+
+// Get the pool associated with the slot type
+/*! \details There will only be one pool for each particle state type that
+ * is stored in the arena so a linear search is sufficient.
+ */
+ParticleStateArena::Pool& ParticleStateArena::getPool(
+                                           const std::type_info& slot_type,
+                                           const size_t slot_size )
+{
+  const std::type_index slot_type_index( slot_type );
+
+  for( size_t i = 0; i < d_pools.size(); ++i )
+  {
+    if( d_pools[i].slot_type == slot_type_index )
+      return d_pools[i];
+  }
+
+  Pool pool = { slot_type_index,
+                ParticleStateArena::calculateAlignedSlotSize( slot_size ),
+                NULL,
+                std::vector<unsigned char*>() };
+
+  d_pools.push_back( pool );
+
+  return d_pools.back();
+}
+
+// Add a new block to the pool
+void ParticleStateArena::addBlock( Pool& pool )
+{
+  unsigned char* block = static_cast<unsigned char*>(
+                   ::operator new( pool.slot_size*d_slots_per_block ) );
+
+  pool.blocks.push_back( block );
+
+  // Thread the free slot list through the new block (in address order)
+  for( size_t i = 0; i < d_slots_per_block; ++i )
+  {
+    void* next_slot = (i+1 < d_slots_per_block ?
+                       block + (i+1)*pool.slot_size :
+                       pool.free_slot);
+
+    *reinterpret_cast<void**>( block + i*pool.slot_size ) = next_slot;
+  }
+
+  pool.free_slot = block;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleStateArena.cpp
+//---------------------------------------------------------------------------//
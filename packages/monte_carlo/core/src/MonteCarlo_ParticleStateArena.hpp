@@ -0,0 +1,163 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleStateArena.hpp
+//! \author Alex Robinson
+//! \brief  Particle state arena class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_STATE_ARENA_HPP
+#define MONTE_CARLO_PARTICLE_STATE_ARENA_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <typeinfo>
+#include <typeindex>
+
+namespace MonteCarlo{
+
+/*! The particle state arena class
+ *
+ * Storage is handed out in fixed size slots. Each slot type (i.e. each
+ * particle state type) has its own pool of contiguous blocks so that states
+ * of the same type are stored next to each other in memory - states of
+ * different types that happen to have the same size never share a block. Slots that are
+ * returned to the arena are recycled. The memory that has been acquired by
+ * the arena will only be released when the arena is destroyed. This class is
+ * not thread safe - each thread should have its own arena.
+ */
+class ParticleStateArena
+{
+
+public:
+
+  //! Constructor
+  ParticleStateArena( const size_t slots_per_block = 256 );
+
+  //! Destructor
+  ~ParticleStateArena();
+
+  //! Allocate a slot
+  void* allocate( const std::type_info& slot_type, const size_t slot_size );
+
+  //! Return a slot to the arena
+  void deallocate( void* slot,
+                   const std::type_info& slot_type,
+                   const size_t slot_size );
+
+  //! Return the number of slots per block
+  size_t getNumberOfSlotsPerBlock() const;
+
+  //! Return the number of pools (one for each slot type)
+  size_t getNumberOfPools() const;
+
+  //! Return the number of blocks that have been acquired
+  size_t getNumberOfBlocks() const;
+
+private:
+
+  // The slot pool
+  struct Pool
+  {
+    // The slot type
+    std::type_index slot_type;
+
+    // The (aligned) slot size
+    size_t slot_size;
+
+    // The first free slot
+    void* free_slot;
+
+    // The blocks owned by the pool
+    std::vector<unsigned char*> blocks;
+  };
+
+  // Copy constructor
+  ParticleStateArena( const ParticleStateArena& other_arena );
+
+  // Assignment operator
+  ParticleStateArena& operator=( const ParticleStateArena& other_arena );
+
+  // Calculate the aligned slot size
+  static size_t calculateAlignedSlotSize( const size_t slot_size );
+
+  // Get the pool associated with the slot type
+  Pool& getPool( const std::type_info& slot_type, const size_t slot_size );
+
+  // Add a new block to the pool
+  void addBlock( Pool& pool );
+
+  // The number of slots per block
+  size_t d_slots_per_block;
+
+  // The pools
+  std::vector<Pool> d_pools;
+};
+
+/*! The particle state arena allocator
+ *
+ * This allocator can be used with std::allocate_shared to place a particle
+ * state and its shared pointer control block in a single arena slot. Each
+ * allocator holds a reference to the arena so that the arena will outlive
+ * every state that has been allocated from it.
+ */
+template<typename T>
+class ParticleStateArenaAllocator
+{
+
+public:
+
+  //! The value type
+  typedef T value_type;
+
+  //! Constructor
+  ParticleStateArenaAllocator(
+                          const std::shared_ptr<ParticleStateArena>& arena );
+
+  //! Copy constructor
+  template<typename U>
+  ParticleStateArenaAllocator(
+                        const ParticleStateArenaAllocator<U>& other_allocator );
+
+  //! Allocate storage for n objects
+  T* allocate( const size_t n );
+
+  //! Deallocate storage for n objects
+  void deallocate( T* storage, const size_t n );
+
+  //! Return the arena
+  const std::shared_ptr<ParticleStateArena>& getArena() const;
+
+private:
+
+  // The arena
+  std::shared_ptr<ParticleStateArena> d_arena;
+};
+
+//! Check if two allocators are equal
+template<typename T, typename U>
+bool operator==( const ParticleStateArenaAllocator<T>& lhs,
+                 const ParticleStateArenaAllocator<U>& rhs );
+
+//! Check if two allocators are not equal
+template<typename T, typename U>
+bool operator!=( const ParticleStateArenaAllocator<T>& lhs,
+                 const ParticleStateArenaAllocator<U>& rhs );
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_ParticleStateArena_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_PARTICLE_STATE_ARENA_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleStateArena.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleStateArena_def.hpp
+//! \author Alex Robinson
+//! \brief  Particle state arena class template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_STATE_ARENA_DEF_HPP
+#define MONTE_CARLO_PARTICLE_STATE_ARENA_DEF_HPP
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+template<typename T>
+ParticleStateArenaAllocator<T>::ParticleStateArenaAllocator(
+                           const std::shared_ptr<ParticleStateArena>& arena )
+  : d_arena( arena )
+{
+  // Make sure that the arena is valid
+  testPrecondition( arena.get() );
+}
+
+// Copy constructor
+template<typename T>
+template<typename U>
+ParticleStateArenaAllocator<T>::ParticleStateArenaAllocator(
+                        const ParticleStateArenaAllocator<U>& other_allocator )
+  : d_arena( other_allocator.getArena() )
+{ /* ... */ }
+
+// Allocate storage for n objects
+/*! \details Only single objects are stored in the arena. Requests for
+ * more than one object will be forwarded to the global operator new.
+ */
+template<typename T>
+T* ParticleStateArenaAllocator<T>::allocate( const size_t n )
+{
+  static_assert( alignof(T) <= alignof(std::max_align_t),
+                 "Over-aligned types cannot be stored in the arena!" );
+
+  if( n == 1 )
+    return static_cast<T*>( d_arena->allocate( typeid(T), sizeof(T) ) );
+  else
+    return static_cast<T*>( ::operator new( n*sizeof(T) ) );
+}
+
+// Deallocate storage for n objects
+template<typename T>
+void ParticleStateArenaAllocator<T>::deallocate( T* storage, const size_t n )
+{
+  if( n == 1 )
+    d_arena->deallocate( storage, typeid(T), sizeof(T) );
+  else
+    ::operator delete( storage );
+}
+
+// Return the arena
+template<typename T>
+inline const std::shared_ptr<ParticleStateArena>&
+ParticleStateArenaAllocator<T>::getArena() const
+{
+  return d_arena;
+}
+
+// Check if two allocators are equal
+template<typename T, typename U>
+inline bool operator==( const ParticleStateArenaAllocator<T>& lhs,
+                        const ParticleStateArenaAllocator<U>& rhs )
+{
+  return lhs.getArena() == rhs.getArena();
+}
+
+// Check if two allocators are not equal
+template<typename T, typename U>
+inline bool operator!=( const ParticleStateArenaAllocator<T>& lhs,
+                        const ParticleStateArenaAllocator<U>& rhs )
+{
+  return !(lhs == rhs);
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_STATE_ARENA_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleStateArena_def.hpp
+//---------------------------------------------------------------------------//
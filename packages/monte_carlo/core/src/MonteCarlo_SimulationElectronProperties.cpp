@@ -40,6 +40,9 @@ SimulationElectronProperties::SimulationElectronProperties()
     d_electroionization_interpolation_type( LOGLOGLOG_INTERPOLATION ),
     d_electroionization_sampling_mode( KNOCK_ON_SAMPLING ),
     d_atomic_excitation_mode_on( true ),
+    d_condensed_history_mode_on( false ),
+    d_condensed_history_max_energy_loss_fraction( 0.05 ),
+    d_condensed_history_boundary_skin_depth( 3.0 ),
     d_threshold_weight( 0.0 ),
     d_survival_weight()
 { /* ... */ }
@@ -312,6 +315,69 @@ bool SimulationElectronProperties::isAtomicExcitationModeOn() const
   return d_atomic_excitation_mode_on;
 }
 
+// Set condensed history mode to off (off by default)
+void SimulationElectronProperties::setCondensedHistoryModeOff()
+{
+  d_condensed_history_mode_on = false;
+}
+
+// Set condensed history mode to on (off by default)
+/*! \details In condensed history mode the elastic scattering and the atomic
+ * excitation energy losses will be grouped into condensed history steps
+ * (elastic scattering with a Goudsmit-Saunderson multiple scattering
+ * distribution and atomic excitation with a continuous slowing down
+ * restricted stopping power). Bremsstrahlung and electroionization will still
+ * be simulated as discrete (hard) collisions. The elastic distribution mode
+ * must be coupled, decoupled or cutoff.
+ */
+void SimulationElectronProperties::setCondensedHistoryModeOn()
+{
+  d_condensed_history_mode_on = true;
+}
+
+// Return if condensed history mode is on
+bool SimulationElectronProperties::isCondensedHistoryModeOn() const
+{
+  return d_condensed_history_mode_on;
+}
+
+// Set the max fractional energy loss of a condensed history step
+void SimulationElectronProperties::setCondensedHistoryMaxEnergyLossFraction(
+                                                        const double fraction )
+{
+  // Make sure the fraction is valid
+  testPrecondition( fraction > 0.0 );
+  testPrecondition( fraction < 1.0 );
+
+  d_condensed_history_max_energy_loss_fraction = fraction;
+}
+
+// Return the max fractional energy loss of a condensed history step
+double SimulationElectronProperties::getCondensedHistoryMaxEnergyLossFraction() const
+{
+  return d_condensed_history_max_energy_loss_fraction;
+}
+
+// Set the condensed history boundary skin depth (elastic mfp)
+/*! \details Electrons that are closer to a cell boundary than the skin depth
+ * (in elastic mean free paths) will be transported collision-by-collision
+ * so that boundary crossings are simulated exactly.
+ */
+void SimulationElectronProperties::setCondensedHistoryBoundarySkinDepth(
+                                                      const double skin_depth )
+{
+  // Make sure the skin depth is valid
+  testPrecondition( skin_depth >= 0.0 );
+
+  d_condensed_history_boundary_skin_depth = skin_depth;
+}
+
+// Return the condensed history boundary skin depth (elastic mfp)
+double SimulationElectronProperties::getCondensedHistoryBoundarySkinDepth() const
+{
+  return d_condensed_history_boundary_skin_depth;
+}
+
 // Set the cutoff roulette threshold weight
 void SimulationElectronProperties::setElectronRouletteThresholdWeight(
       const double threshold_weight )
@@ -170,6 +170,29 @@ public:
   //! Return if atomic excitation mode is on
   bool isAtomicExcitationModeOn() const;
 
+  /* ------ Condensed History Properties ------ */
+
+  //! Set condensed history mode to off (off by default)
+  void setCondensedHistoryModeOff();
+
+  //! Set condensed history mode to on (off by default)
+  void setCondensedHistoryModeOn();
+
+  //! Return if condensed history mode is on
+  bool isCondensedHistoryModeOn() const;
+
+  //! Set the max fractional energy loss of a condensed history step
+  void setCondensedHistoryMaxEnergyLossFraction( const double fraction );
+
+  //! Return the max fractional energy loss of a condensed history step
+  double getCondensedHistoryMaxEnergyLossFraction() const;
+
+  //! Set the condensed history boundary skin depth (elastic mfp)
+  void setCondensedHistoryBoundarySkinDepth( const double skin_depth );
+
+  //! Return the condensed history boundary skin depth (elastic mfp)
+  double getCondensedHistoryBoundarySkinDepth() const;
+
   //! Set the cutoff roulette threshold weight
   void setElectronRouletteThresholdWeight( const double threshold_weight );
 
@@ -255,6 +278,16 @@ private:
   // The atomic excitation electron scattering mode (true = on - default, false = off)
   bool d_atomic_excitation_mode_on;
 
+  // The condensed history mode (true = on, false = off - default)
+  bool d_condensed_history_mode_on;
+
+  // The max fractional energy loss of a condensed history step (0.05 - default)
+  double d_condensed_history_max_energy_loss_fraction;
+
+  // The condensed history boundary skin depth in elastic mean free paths
+  // (3.0 - default)
+  double d_condensed_history_boundary_skin_depth;
+
   // The roulette threshold weight
   double d_threshold_weight;
 
@@ -288,13 +321,27 @@ void SimulationElectronProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_atomic_excitation_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  // The condensed history properties were added in version 1
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_max_energy_loss_fraction );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_boundary_skin_depth );
+  }
+  else if( Archive::is_loading::value )
+  {
+    d_condensed_history_mode_on = false;
+    d_condensed_history_max_energy_loss_fraction = 0.05;
+    d_condensed_history_boundary_skin_depth = 3.0;
+  }
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 1 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationElectronProperties, "SimulationElectronProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationElectronProperties );
 
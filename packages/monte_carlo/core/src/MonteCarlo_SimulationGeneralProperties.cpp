@@ -26,7 +26,16 @@ SimulationGeneralProperties::SimulationGeneralProperties()
     d_number_of_batches_per_processor( 1 ),
     d_number_of_snapshots_per_batch( 1 ),
     d_wall_time( Utility::QuantityTraits<double>::inf() ),
-    d_implicit_capture_mode_on( false )
+    d_implicit_capture_mode_on( false ),
+    d_arena_particle_bank_mode_on( false ),
+    d_unionized_energy_grid_mode( NO_UNIONIZED_ENERGY_GRID ),
+    d_history_schedule_type( STATIC_HISTORY_SCHEDULE ),
+    d_history_schedule_chunk_size( 1 ),
+    d_event_based_transport_mode_on( false ),
+    d_distributed_batch_schedule_type( STATIC_DISTRIBUTED_BATCH_SCHEDULE ),
+    d_delta_tracking_mode_on( false ),
+    d_thread_private_moment_accumulation_mode_on( false ),
+    d_counter_based_random_number_generator_mode_on( false )
 { /* ... */ }
 
 // Set the particle mode
@@ -148,6 +157,27 @@ uint64_t SimulationGeneralProperties::getNumberOfBatchesPerProcessor() const
   return d_number_of_batches_per_processor;
 }
 
+// Set the distributed batch schedule type for an MPI configuration
+/*! \details By default the root process hands out batches of a fixed size
+ * to the worker processes (static schedule). When the worker processes run
+ * on heterogeneous nodes or the history cost varies significantly the
+ * adaptive schedule (batch sizes based on the measured worker throughput) or
+ * the work stealing schedule (no coordinating process - the root process
+ * also simulates histories) should be used to reduce the time that
+ * processes spend idle at the end of a rendezvous batch.
+ */
+void SimulationGeneralProperties::setDistributedBatchScheduleType(
+                                     const DistributedBatchScheduleType type )
+{
+  d_distributed_batch_schedule_type = type;
+}
+
+// Return the distributed batch schedule type for an MPI configuration
+DistributedBatchScheduleType SimulationGeneralProperties::getDistributedBatchScheduleType() const
+{
+  return d_distributed_batch_schedule_type;
+}
+
 // Set the number of snapshots per batch
 void SimulationGeneralProperties::setNumberOfSnapshotsPerBatch(
                                            const uint64_t snapshots_per_batch )
@@ -201,6 +231,190 @@ bool SimulationGeneralProperties::isImplicitCaptureModeOn() const
   return d_implicit_capture_mode_on;
 }
 
+// Set arena particle bank mode to on (off by default)
+/*! \details In arena particle bank mode the particle states that are
+ * banked during a history will be stored in a thread-local arena instead of
+ * being individually allocated on the heap.
+ */
+void SimulationGeneralProperties::setArenaParticleBankModeOn()
+{
+  d_arena_particle_bank_mode_on = true;
+}
+
+// Set standard particle bank mode to on (on by default)
+void SimulationGeneralProperties::setStandardParticleBankModeOn()
+{
+  d_arena_particle_bank_mode_on = false;
+}
+
+// Return if arena particle bank mode has been set
+bool SimulationGeneralProperties::isArenaParticleBankModeOn() const
+{
+  return d_arena_particle_bank_mode_on;
+}
+
+// Set the material unionized energy grid mode
+/*! \details By default the materials will not construct a unionized energy
+ * grid. The hashed mode stores the scattering center energy grid indices
+ * associated with each unionized energy grid point (double indexing). The
+ * full mode stores the cumulative scattering center total cross sections
+ * and the macroscopic absorption cross section on the unionized energy grid
+ * instead, which removes the scattering center cross section evaluations from
+ * each lookup (higher memory).
+ */
+void SimulationGeneralProperties::setUnionizedEnergyGridMode(
+                                          const UnionizedEnergyGridMode mode )
+{
+  d_unionized_energy_grid_mode = mode;
+}
+
+// Return the material unionized energy grid mode
+UnionizedEnergyGridMode SimulationGeneralProperties::getUnionizedEnergyGridMode() const
+{
+  return d_unionized_energy_grid_mode;
+}
+
+// Set the history schedule type
+/*! \details By default the histories of a micro batch are divided evenly
+ * among the threads before the micro batch starts (static schedule). When
+ * the history cost varies significantly (e.g. shielding or electron
+ * problems) a dynamic, guided or work stealing schedule should be used to
+ * reduce the time that threads spend idle at the end of a micro batch.
+ */
+void SimulationGeneralProperties::setHistoryScheduleType(
+                                              const HistoryScheduleType type )
+{
+  d_history_schedule_type = type;
+}
+
+// Return the history schedule type
+HistoryScheduleType SimulationGeneralProperties::getHistoryScheduleType() const
+{
+  return d_history_schedule_type;
+}
+
+// Set the history schedule chunk size
+/*! \details The chunk size is the number of histories that a thread will
+ * acquire at once with the dynamic and work stealing schedules and the
+ * minimum number of histories acquired at once with the guided schedule. It
+ * is ignored by the static schedule.
+ */
+void SimulationGeneralProperties::setHistoryScheduleChunkSize(
+                                                   const uint64_t chunk_size )
+{
+  TEST_FOR_EXCEPTION( chunk_size == 0,
+                      std::runtime_error,
+                      "The history schedule chunk size must be greater "
+                      "than 0!" );
+
+  d_history_schedule_chunk_size = chunk_size;
+}
+
+// Return the history schedule chunk size
+uint64_t SimulationGeneralProperties::getHistoryScheduleChunkSize() const
+{
+  return d_history_schedule_chunk_size;
+}
+
+// Set event-based transport mode to on (off by default)
+/*! \details In event-based transport mode the particles of a history are
+ * sorted into queues by particle type and each queue is advanced one event
+ * stage (cross section lookup, distance to collision, ray trace, surface
+ * crossing or collision) at a time. This mode is only used by the
+ * shared-memory particle simulation manager - distributed simulations will
+ * always use history-based transport.
+ */
+void SimulationGeneralProperties::setEventBasedTransportModeOn()
+{
+  d_event_based_transport_mode_on = true;
+}
+
+// Set history-based transport mode to on (on by default)
+void SimulationGeneralProperties::setHistoryBasedTransportModeOn()
+{
+  d_event_based_transport_mode_on = false;
+}
+
+// Return if event-based transport mode has been set
+bool SimulationGeneralProperties::isEventBasedTransportModeOn() const
+{
+  return d_event_based_transport_mode_on;
+}
+
+// Set delta tracking mode to on (off by default)
+/*! \details In delta tracking mode the distance to the next collision site is
+ * sampled using the majorant macroscopic total cross section of the model
+ * and the particle is only located in the model at the tentative collision
+ * sites (cell boundaries are not ray traced). A tentative collision is
+ * accepted as a real collision with probability equal to the ratio of the
+ * cell total macroscopic cross section and the majorant cross section. A
+ * particle type will still be surface tracked if it has forced collision
+ * cells, if it has observers that require surface tracking (e.g. cell
+ * track-length flux estimators or surface estimators) or if the model has
+ * reflecting surfaces. Delta tracking is always history-based.
+ */
+void SimulationGeneralProperties::setDeltaTrackingModeOn()
+{
+  d_delta_tracking_mode_on = true;
+}
+
+// Set surface tracking mode to on (on by default)
+void SimulationGeneralProperties::setSurfaceTrackingModeOn()
+{
+  d_delta_tracking_mode_on = false;
+}
+
+// Return if delta tracking mode has been set
+bool SimulationGeneralProperties::isDeltaTrackingModeOn() const
+{
+  return d_delta_tracking_mode_on;
+}
+
+// Set thread-private moment accumulation mode to on (off by default)
+/*! \details In thread-private moment accumulation mode every estimator that
+ * is added to the event handler will commit history contributions to
+ * per-thread copies of its moments instead of the shared moments (see
+ * MonteCarlo::Estimator::enableThreadPrivateMomentAccumulation).
+ */
+void SimulationGeneralProperties::setThreadPrivateMomentAccumulationModeOn()
+{
+  d_thread_private_moment_accumulation_mode_on = true;
+}
+
+// Set shared moment accumulation mode to on (on by default)
+void SimulationGeneralProperties::setSharedMomentAccumulationModeOn()
+{
+  d_thread_private_moment_accumulation_mode_on = false;
+}
+
+// Return if thread-private moment accumulation mode has been set
+bool SimulationGeneralProperties::isThreadPrivateMomentAccumulationModeOn() const
+{
+  return d_thread_private_moment_accumulation_mode_on;
+}
+
+// Set counter-based random number generator mode to on (off by default)
+/*! \details In counter-based random number generator mode the random
+ * numbers of a history only depend on the history number (see
+ * Utility::RandomNumberGenerator::useCounterBasedGenerator).
+ */
+void SimulationGeneralProperties::setCounterBasedRandomNumberGeneratorModeOn()
+{
+  d_counter_based_random_number_generator_mode_on = true;
+}
+
+// Set linear congruential random number generator mode to on (on by default)
+void SimulationGeneralProperties::setLinearCongruentialRandomNumberGeneratorModeOn()
+{
+  d_counter_based_random_number_generator_mode_on = false;
+}
+
+// Return if counter-based random number generator mode has been set
+bool SimulationGeneralProperties::isCounterBasedRandomNumberGeneratorModeOn() const
+{
+  return d_counter_based_random_number_generator_mode_on;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationGeneralProperties );
 
 } // end MonteCarlo namespace
@@ -17,6 +17,9 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleModeType.hpp"
+#include "MonteCarlo_UnionizedEnergyGridMode.hpp"
+#include "MonteCarlo_HistoryScheduleType.hpp"
+#include "MonteCarlo_DistributedBatchScheduleType.hpp"
 #include "Utility_QuantityTraits.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 
@@ -80,6 +83,12 @@ public:
   //! Return the number of batches for an MPI configuration
   uint64_t getNumberOfBatchesPerProcessor() const;
 
+  //! Set the distributed batch schedule type for an MPI configuration
+  void setDistributedBatchScheduleType( const DistributedBatchScheduleType type );
+
+  //! Return the distributed batch schedule type for an MPI configuration
+  DistributedBatchScheduleType getDistributedBatchScheduleType() const;
+
   //! Set the number of snapshots per batch
   void setNumberOfSnapshotsPerBatch( const uint64_t snapshots_per_batch );
 
@@ -101,6 +110,69 @@ public:
   //! Return if implicit capture mode has been set
   bool isImplicitCaptureModeOn() const;
 
+  //! Set arena particle bank mode to on (off by default)
+  void setArenaParticleBankModeOn();
+
+  //! Set standard particle bank mode to on (on by default)
+  void setStandardParticleBankModeOn();
+
+  //! Return if arena particle bank mode has been set
+  bool isArenaParticleBankModeOn() const;
+
+  //! Set the material unionized energy grid mode
+  void setUnionizedEnergyGridMode( const UnionizedEnergyGridMode mode );
+
+  //! Return the material unionized energy grid mode
+  UnionizedEnergyGridMode getUnionizedEnergyGridMode() const;
+
+  //! Set the history schedule type
+  void setHistoryScheduleType( const HistoryScheduleType type );
+
+  //! Return the history schedule type
+  HistoryScheduleType getHistoryScheduleType() const;
+
+  //! Set the history schedule chunk size
+  void setHistoryScheduleChunkSize( const uint64_t chunk_size );
+
+  //! Return the history schedule chunk size
+  uint64_t getHistoryScheduleChunkSize() const;
+
+  //! Set event-based transport mode to on (off by default)
+  void setEventBasedTransportModeOn();
+
+  //! Set history-based transport mode to on (on by default)
+  void setHistoryBasedTransportModeOn();
+
+  //! Return if event-based transport mode has been set
+  bool isEventBasedTransportModeOn() const;
+
+  //! Set delta tracking mode to on (off by default)
+  void setDeltaTrackingModeOn();
+
+  //! Set surface tracking mode to on (on by default)
+  void setSurfaceTrackingModeOn();
+
+  //! Return if delta tracking mode has been set
+  bool isDeltaTrackingModeOn() const;
+
+  //! Set thread-private moment accumulation mode to on (off by default)
+  void setThreadPrivateMomentAccumulationModeOn();
+
+  //! Set shared moment accumulation mode to on (on by default)
+  void setSharedMomentAccumulationModeOn();
+
+  //! Return if thread-private moment accumulation mode has been set
+  bool isThreadPrivateMomentAccumulationModeOn() const;
+
+  //! Set counter-based random number generator mode to on (off by default)
+  void setCounterBasedRandomNumberGeneratorModeOn();
+
+  //! Set linear congruential random number generator mode to on (on by default)
+  void setLinearCongruentialRandomNumberGeneratorModeOn();
+
+  //! Return if counter-based random number generator mode has been set
+  bool isCounterBasedRandomNumberGeneratorModeOn() const;
+
 private:
 
   // Save the state to an archive
@@ -145,6 +217,33 @@ private:
 
   // The capture mode (true = implicit, false = analogue - default)
   bool d_implicit_capture_mode_on;
+
+  // The particle bank mode (true = arena, false = standard - default)
+  bool d_arena_particle_bank_mode_on;
+
+  // The material unionized energy grid mode
+  UnionizedEnergyGridMode d_unionized_energy_grid_mode;
+
+  // The history schedule type
+  HistoryScheduleType d_history_schedule_type;
+
+  // The history schedule chunk size
+  uint64_t d_history_schedule_chunk_size;
+
+  // The transport mode (true = event-based, false = history-based - default)
+  bool d_event_based_transport_mode_on;
+
+  // The distributed batch schedule type
+  DistributedBatchScheduleType d_distributed_batch_schedule_type;
+
+  // The tracking mode (true = delta tracking, false = surface tracking - default)
+  bool d_delta_tracking_mode_on;
+
+  // The estimator moment accumulation mode (true = thread-private, false = shared - default)
+  bool d_thread_private_moment_accumulation_mode_on;
+
+  // The random number generator mode (true = counter-based, false = linear congruential - default)
+  bool d_counter_based_random_number_generator_mode_on;
 };
 
 // Save the state to an archive
@@ -179,6 +278,31 @@ void SimulationGeneralProperties::save( Archive& ar, const unsigned version ) co
   }
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+
+  // Added in version 1
+  ar & BOOST_SERIALIZATION_NVP( d_arena_particle_bank_mode_on );
+
+  // Added in version 2
+  ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_mode );
+
+  // Added in version 3
+  ar & BOOST_SERIALIZATION_NVP( d_history_schedule_type );
+  ar & BOOST_SERIALIZATION_NVP( d_history_schedule_chunk_size );
+
+  // Added in version 4
+  ar & BOOST_SERIALIZATION_NVP( d_event_based_transport_mode_on );
+
+  // Added in version 5
+  ar & BOOST_SERIALIZATION_NVP( d_distributed_batch_schedule_type );
+
+  // Added in version 6
+  ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_mode_on );
+
+  // Added in version 7
+  ar & BOOST_SERIALIZATION_NVP( d_thread_private_moment_accumulation_mode_on );
+
+  // Added in version 8
+  ar & BOOST_SERIALIZATION_NVP( d_counter_based_random_number_generator_mode_on );
 }
 
 // Load the state to an archive
@@ -203,13 +327,67 @@ void SimulationGeneralProperties::load( Archive& ar, const unsigned version )
     d_wall_time = Utility::QuantityTraits<double>::inf();
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+
+  // The arena particle bank mode was added in version 1
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_arena_particle_bank_mode_on );
+  else
+    d_arena_particle_bank_mode_on = false;
+
+  // The unionized energy grid mode was added in version 2
+  if( version > 1 )
+    ar & BOOST_SERIALIZATION_NVP( d_unionized_energy_grid_mode );
+  else
+    d_unionized_energy_grid_mode = NO_UNIONIZED_ENERGY_GRID;
+
+  // The history schedule was added in version 3
+  if( version > 2 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule_type );
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule_chunk_size );
+  }
+  else
+  {
+    d_history_schedule_type = STATIC_HISTORY_SCHEDULE;
+    d_history_schedule_chunk_size = 1;
+  }
+
+  // The event-based transport mode was added in version 4
+  if( version > 3 )
+    ar & BOOST_SERIALIZATION_NVP( d_event_based_transport_mode_on );
+  else
+    d_event_based_transport_mode_on = false;
+
+  // The distributed batch schedule was added in version 5
+  if( version > 4 )
+    ar & BOOST_SERIALIZATION_NVP( d_distributed_batch_schedule_type );
+  else
+    d_distributed_batch_schedule_type = STATIC_DISTRIBUTED_BATCH_SCHEDULE;
+
+  // The delta tracking mode was added in version 6
+  if( version > 5 )
+    ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_mode_on );
+  else
+    d_delta_tracking_mode_on = false;
+
+  // The thread-private moment accumulation mode was added in version 7
+  if( version > 6 )
+    ar & BOOST_SERIALIZATION_NVP( d_thread_private_moment_accumulation_mode_on );
+  else
+    d_thread_private_moment_accumulation_mode_on = false;
+
+  // The counter-based random number generator mode was added in version 8
+  if( version > 7 )
+    ar & BOOST_SERIALIZATION_NVP( d_counter_based_random_number_generator_mode_on );
+  else
+    d_counter_based_random_number_generator_mode_on = false;
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 8 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationGeneralProperties, "SimulationGeneralProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationGeneralProperties );
 
@@ -25,9 +25,14 @@ SimulationNeutronProperties::SimulationNeutronProperties()
     d_max_neutron_energy( s_absolute_max_neutron_energy ),
     d_num_neutron_hash_grid_bins( 1000 ),
     d_free_gas_threshold( 400.0 ),
+    d_max_doppler_broadening_energy( 0.1 ),
     d_unresolved_resonance_probability_table_mode_on( true ),
     d_threshold_weight( 0.0 ),
-    d_survival_weight()
+    d_survival_weight(),
+    d_power_iteration_mode_on( false ),
+    d_neutrons_per_cycle( 1000 ),
+    d_inactive_cycles( 10 ),
+    d_active_cycles( 50 )
 { /* ... */ }
 
 // Set the minimum neutron energy (MeV)
@@ -106,6 +111,27 @@ double SimulationNeutronProperties::getFreeGasThreshold() const
   return d_free_gas_threshold;
 }
 
+// Set the max on-the-fly Doppler broadening energy (MeV)
+/*! \details Nuclides that are Doppler broadened on-the-fly to a higher
+ * temperature will only have their cross sections broadened below this
+ * energy (the effect of the thermal motion of the target is negligible at
+ * higher energies).
+ */
+void SimulationNeutronProperties::setMaxDopplerBroadeningEnergy(
+                                                          const double energy )
+{
+  // Make sure the energy is valid
+  testPrecondition( energy >= 0.0 );
+
+  d_max_doppler_broadening_energy = energy;
+}
+
+// Return the max on-the-fly Doppler broadening energy (MeV)
+double SimulationNeutronProperties::getMaxDopplerBroadeningEnergy() const
+{
+  return d_max_doppler_broadening_energy;
+}
+
 // Set unresolved resonance probability table mode to on (on by default)
 void SimulationNeutronProperties::setUnresolvedResonanceProbabilityTableModeOn()
 {
@@ -159,6 +185,77 @@ double SimulationNeutronProperties::getNeutronRouletteSurvivalWeight() const
   return d_survival_weight;
 }
 
+// Set power iteration (k-eigenvalue) mode to on (off by default)
+/*! \details In power iteration mode the fission neutrons created in a cycle
+ * will not be transported. Instead, their sites will be banked and used to
+ * sample the source of the next cycle. The particle source will only be used
+ * to sample the source of the first cycle.
+ */
+void SimulationNeutronProperties::setPowerIterationModeOn()
+{
+  d_power_iteration_mode_on = true;
+}
+
+// Set fixed source mode to on (on by default)
+void SimulationNeutronProperties::setFixedSourceModeOn()
+{
+  d_power_iteration_mode_on = false;
+}
+
+// Return if power iteration (k-eigenvalue) mode is on
+bool SimulationNeutronProperties::isPowerIterationModeOn() const
+{
+  return d_power_iteration_mode_on;
+}
+
+// Set the number of neutrons per power iteration cycle
+void SimulationNeutronProperties::setNumberOfNeutronsPerCycle(
+                                                      const uint64_t neutrons )
+{
+  // Make sure the number of neutrons is valid
+  testPrecondition( neutrons > 0 );
+
+  d_neutrons_per_cycle = neutrons;
+}
+
+// Return the number of neutrons per power iteration cycle
+uint64_t SimulationNeutronProperties::getNumberOfNeutronsPerCycle() const
+{
+  return d_neutrons_per_cycle;
+}
+
+// Set the number of inactive power iteration cycles
+/*! \details The observers will only start to collect data once the inactive
+ * cycles have been completed (the fission source must converge first).
+ */
+void SimulationNeutronProperties::setNumberOfInactiveCycles(
+                                                       const unsigned cycles )
+{
+  d_inactive_cycles = cycles;
+}
+
+// Return the number of inactive power iteration cycles
+unsigned SimulationNeutronProperties::getNumberOfInactiveCycles() const
+{
+  return d_inactive_cycles;
+}
+
+// Set the number of active power iteration cycles
+void SimulationNeutronProperties::setNumberOfActiveCycles(
+                                                       const unsigned cycles )
+{
+  // Make sure the number of cycles is valid
+  testPrecondition( cycles > 0 );
+
+  d_active_cycles = cycles;
+}
+
+// Return the number of active power iteration cycles
+unsigned SimulationNeutronProperties::getNumberOfActiveCycles() const
+{
+  return d_active_cycles;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationNeutronProperties );
 
 } // end MonteCarlo namespace
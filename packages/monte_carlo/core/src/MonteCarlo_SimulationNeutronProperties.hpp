@@ -15,6 +15,9 @@
 #include <boost/serialization/version.hpp>
 #include <boost/serialization/export.hpp>
 
+// Std Lib Includes
+#include <cstdint>
+
 // FRENSIE Includes
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 
@@ -66,6 +69,12 @@ public:
   //! Return the free gas thermal treatment temperature threshold
   double getFreeGasThreshold() const;
 
+  //! Set the max on-the-fly Doppler broadening energy (MeV)
+  void setMaxDopplerBroadeningEnergy( const double energy );
+
+  //! Return the max on-the-fly Doppler broadening energy (MeV)
+  double getMaxDopplerBroadeningEnergy() const;
+
   //! Set unresolved resonance probability table mode to on (on by default)
   void setUnresolvedResonanceProbabilityTableModeOn();
 
@@ -87,6 +96,33 @@ public:
   //! Return the cutoff roulette survival weight
   double getNeutronRouletteSurvivalWeight() const;
 
+  //! Set power iteration (k-eigenvalue) mode to on (off by default)
+  void setPowerIterationModeOn();
+
+  //! Set fixed source mode to on (on by default)
+  void setFixedSourceModeOn();
+
+  //! Return if power iteration (k-eigenvalue) mode is on
+  bool isPowerIterationModeOn() const;
+
+  //! Set the number of neutrons per power iteration cycle
+  void setNumberOfNeutronsPerCycle( const uint64_t neutrons );
+
+  //! Return the number of neutrons per power iteration cycle
+  uint64_t getNumberOfNeutronsPerCycle() const;
+
+  //! Set the number of inactive power iteration cycles
+  void setNumberOfInactiveCycles( const unsigned cycles );
+
+  //! Return the number of inactive power iteration cycles
+  unsigned getNumberOfInactiveCycles() const;
+
+  //! Set the number of active power iteration cycles
+  void setNumberOfActiveCycles( const unsigned cycles );
+
+  //! Return the number of active power iteration cycles
+  unsigned getNumberOfActiveCycles() const;
+
 private:
 
   // Save/load the state to an archive
@@ -115,6 +151,9 @@ private:
   // Note: free gas thermal treatment used when energy<threshold*kT (and A > 1)
   double d_free_gas_threshold;
 
+  // The max on-the-fly Doppler broadening energy (MeV)
+  double d_max_doppler_broadening_energy;
+
   // The unresolved resonance probability table mode
   // (true = on - default, false = off)
   bool d_unresolved_resonance_probability_table_mode_on;
@@ -124,6 +163,18 @@ private:
 
   // The roulette survival weight
   double d_survival_weight;
+
+  // The power iteration mode (true = on, false = off - default)
+  bool d_power_iteration_mode_on;
+
+  // The number of neutrons per power iteration cycle
+  uint64_t d_neutrons_per_cycle;
+
+  // The number of inactive power iteration cycles
+  unsigned d_inactive_cycles;
+
+  // The number of active power iteration cycles
+  unsigned d_active_cycles;
 };
 
 // Save/load the state to an archive
@@ -138,13 +189,35 @@ void SimulationNeutronProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_unresolved_resonance_probability_table_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  // Added in version 1
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_max_doppler_broadening_energy );
+  else if( Archive::is_loading::value )
+    d_max_doppler_broadening_energy = 0.1;
+
+  // Added in version 2
+  if( version > 1 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_power_iteration_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_neutrons_per_cycle );
+    ar & BOOST_SERIALIZATION_NVP( d_inactive_cycles );
+    ar & BOOST_SERIALIZATION_NVP( d_active_cycles );
+  }
+  else if( Archive::is_loading::value )
+  {
+    d_power_iteration_mode_on = false;
+    d_neutrons_per_cycle = 1000;
+    d_inactive_cycles = 10;
+    d_active_cycles = 50;
+  }
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationNeutronProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationNeutronProperties, 2 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationNeutronProperties, "SimulationNeutronProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationNeutronProperties );
 
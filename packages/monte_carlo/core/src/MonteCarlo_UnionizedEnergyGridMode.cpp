@@ -0,0 +1,45 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_UnionizedEnergyGridMode.cpp
+//! \author Alex Robinson
+//! \brief  Unionized energy grid mode helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_UnionizedEnergyGridMode.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Convert a MonteCarlo::UnionizedEnergyGridMode to a string
+std::string ToStringTraits<MonteCarlo::UnionizedEnergyGridMode>::toString( const MonteCarlo::UnionizedEnergyGridMode mode )
+{
+  switch( mode )
+  {
+    case MonteCarlo::NO_UNIONIZED_ENERGY_GRID:
+      return "No Unionized Energy Grid";
+    case MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID:
+      return "Hashed Unionized Energy Grid";
+    case MonteCarlo::FULL_UNIONIZED_ENERGY_GRID:
+      return "Full Unionized Energy Grid";
+    default:
+    {
+      THROW_EXCEPTION( std::logic_error,
+                       "Unknown unionized energy grid mode encountered!" );
+    }
+  }
+}
+
+// Place the MonteCarlo::UnionizedEnergyGridMode in a stream
+void ToStringTraits<MonteCarlo::UnionizedEnergyGridMode>::toStream( std::ostream& os, const MonteCarlo::UnionizedEnergyGridMode mode )
+{
+  os << ToStringTraits<MonteCarlo::UnionizedEnergyGridMode>::toString( mode );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_UnionizedEnergyGridMode.cpp
+//---------------------------------------------------------------------------//
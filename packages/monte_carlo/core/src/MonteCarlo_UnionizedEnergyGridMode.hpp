@@ -0,0 +1,112 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_UnionizedEnergyGridMode.hpp
+//! \author Alex Robinson
+//! \brief  Unionized energy grid mode enum and helper function decls.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_UNIONIZED_ENERGY_GRID_MODE_HPP
+#define MONTE_CARLO_UNIONIZED_ENERGY_GRID_MODE_HPP
+
+// FRENSIE Includes
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace MonteCarlo{
+
+/*! The unionized energy grid mode enum
+ *
+ * The unionized grid is the union of the scattering center energy grids. The
+ * hashed mode stores the scattering center energy grid indices at each
+ * unionized grid point (double indexing). The full mode stores the
+ * cumulative scattering center total cross sections instead so that the
+ * macroscopic cross sections and the collision scattering center can be
+ * evaluated without evaluating the microscopic cross sections.
+ * When adding a new type the ToStringTraits methods and the serialization
+ * method must be updated.
+ */
+enum UnionizedEnergyGridMode
+{
+  NO_UNIONIZED_ENERGY_GRID = 0,
+  HASHED_UNIONIZED_ENERGY_GRID,
+  FULL_UNIONIZED_ENERGY_GRID
+};
+
+} // end MonteCarlo namespace
+
+namespace Utility{
+
+/*! \brief Specialization of Utility::ToStringTraits for
+ * MonteCarlo::UnionizedEnergyGridMode
+ * \ingroup to_string_traits
+ */
+template<>
+struct ToStringTraits<MonteCarlo::UnionizedEnergyGridMode>
+{
+  //! Convert a MonteCarlo::UnionizedEnergyGridMode to a string
+  static std::string toString( const MonteCarlo::UnionizedEnergyGridMode mode );
+
+  //! Place the MonteCarlo::UnionizedEnergyGridMode in a stream
+  static void toStream( std::ostream& os, const MonteCarlo::UnionizedEnergyGridMode mode );
+};
+
+} // end Utility namespace
+
+namespace std{
+
+//! Stream operator for printing UnionizedEnergyGridMode enums
+inline std::ostream& operator<<( std::ostream& os,
+                                 const MonteCarlo::UnionizedEnergyGridMode mode )
+{
+  os << Utility::toString( mode );
+  return os;
+}
+
+} // end std namespace
+
+namespace boost{
+
+namespace serialization{
+
+//! Serialize the MonteCarlo::UnionizedEnergyGridMode enum
+template<typename Archive>
+void serialize( Archive& archive,
+                MonteCarlo::UnionizedEnergyGridMode& mode,
+                const unsigned version )
+{
+  if( Archive::is_saving::value )
+    archive & (int)mode;
+  else
+  {
+    int raw_mode;
+
+    archive & raw_mode;
+
+    switch( raw_mode )
+    {
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::NO_UNIONIZED_ENERGY_GRID, int, mode );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID, int, mode );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::FULL_UNIONIZED_ENERGY_GRID, int, mode );
+
+      default:
+      {
+        THROW_EXCEPTION( std::logic_error,
+                         "Cannot convert the deserialized raw unionized "
+                         "energy grid mode to its corresponding enum "
+                         "value!" );
+      }
+    }
+  }
+}
+
+} // end serialization namespace
+
+} // end boost namespace
+
+#endif // end MONTE_CARLO_UNIONIZED_ENERGY_GRID_MODE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_UnionizedEnergyGridMode.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,359 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstArenaParticleBank.cpp
+//! \author Alex Robinson
+//! \brief  Arena particle bank unit test
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ArenaParticleBank.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_PositronState.hpp"
+#include "MonteCarlo_AdjointPhotonProbeState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing functions
+//---------------------------------------------------------------------------//
+bool compareHistoryNumbers( const MonteCarlo::ParticleState& state_a,
+			    const MonteCarlo::ParticleState& state_b )
+{
+  return state_a.getHistoryNumber() < state_b.getHistoryNumber();
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the particle state arena recycles slots
+FRENSIE_UNIT_TEST( ParticleStateArena, allocate_deallocate )
+{
+  MonteCarlo::ParticleStateArena arena( 2 );
+
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfSlotsPerBlock(), 2 );
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfPools(), 0 );
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfBlocks(), 0 );
+
+  void* slot_a = arena.allocate( typeid(MonteCarlo::PhotonState),
+                                 sizeof(MonteCarlo::PhotonState) );
+  void* slot_b = arena.allocate( typeid(MonteCarlo::PhotonState),
+                                 sizeof(MonteCarlo::PhotonState) );
+
+  FRENSIE_CHECK( slot_a != slot_b );
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfPools(), 1 );
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfBlocks(), 1 );
+
+  void* slot_c = arena.allocate( typeid(MonteCarlo::PhotonState),
+                                 sizeof(MonteCarlo::PhotonState) );
+
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfBlocks(), 2 );
+
+  arena.deallocate( slot_b,
+                    typeid(MonteCarlo::PhotonState),
+                    sizeof(MonteCarlo::PhotonState) );
+
+  void* slot_d = arena.allocate( typeid(MonteCarlo::PhotonState),
+                                 sizeof(MonteCarlo::PhotonState) );
+
+  FRENSIE_CHECK( slot_d == slot_b );
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfBlocks(), 2 );
+
+  arena.deallocate( slot_a,
+                    typeid(MonteCarlo::PhotonState),
+                    sizeof(MonteCarlo::PhotonState) );
+  arena.deallocate( slot_c,
+                    typeid(MonteCarlo::PhotonState),
+                    sizeof(MonteCarlo::PhotonState) );
+  arena.deallocate( slot_d,
+                    typeid(MonteCarlo::PhotonState),
+                    sizeof(MonteCarlo::PhotonState) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the particle state arena has a pool for each slot type
+FRENSIE_UNIT_TEST( ParticleStateArena, allocate_by_type )
+{
+  MonteCarlo::ParticleStateArena arena( 2 );
+
+  // The electron and positron slots have the same size but must not share
+  // a pool
+  void* slot_a = arena.allocate( typeid(MonteCarlo::ElectronState),
+                                 sizeof(MonteCarlo::ElectronState) );
+  void* slot_b = arena.allocate( typeid(MonteCarlo::PositronState),
+                                 sizeof(MonteCarlo::ElectronState) );
+
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfPools(), 2 );
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfBlocks(), 2 );
+
+  arena.deallocate( slot_a,
+                    typeid(MonteCarlo::ElectronState),
+                    sizeof(MonteCarlo::ElectronState) );
+
+  // A recycled electron slot is never handed out for a positron
+  void* slot_c = arena.allocate( typeid(MonteCarlo::PositronState),
+                                 sizeof(MonteCarlo::ElectronState) );
+
+  FRENSIE_CHECK( slot_c != slot_a );
+  FRENSIE_CHECK_EQUAL( arena.getNumberOfBlocks(), 2 );
+
+  void* slot_d = arena.allocate( typeid(MonteCarlo::ElectronState),
+                                 sizeof(MonteCarlo::ElectronState) );
+
+  FRENSIE_CHECK( slot_d == slot_a );
+
+  arena.deallocate( slot_b,
+                    typeid(MonteCarlo::PositronState),
+                    sizeof(MonteCarlo::ElectronState) );
+  arena.deallocate( slot_c,
+                    typeid(MonteCarlo::PositronState),
+                    sizeof(MonteCarlo::ElectronState) );
+  arena.deallocate( slot_d,
+                    typeid(MonteCarlo::ElectronState),
+                    sizeof(MonteCarlo::ElectronState) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that particles can be pushed to the particle bank
+FRENSIE_UNIT_TEST( ArenaParticleBank, push )
+{
+  MonteCarlo::ArenaParticleBank bank;
+
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+
+  {
+    MonteCarlo::PhotonState photon( 0ull );
+
+    bank.push( photon );
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank.getArena().getNumberOfPools(), 1 );
+
+  {
+    MonteCarlo::NeutronState neutron( 1ull );
+
+    bank.push( neutron, 0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 2 );
+
+  {
+    std::shared_ptr<MonteCarlo::ElectronState> electron(
+                                       new MonteCarlo::ElectronState( 2ull ) );
+
+    bank.push( electron );
+
+    FRENSIE_CHECK( !electron );
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 3 );
+
+  {
+    MonteCarlo::AdjointPhotonProbeState probe( 3ull );
+
+    bank.push( probe );
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 4 );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 1ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 2ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::ELECTRON );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 3ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(),
+                       MonteCarlo::ADJOINT_PHOTON );
+  FRENSIE_CHECK( dynamic_cast<const MonteCarlo::AdjointPhotonProbeState*>( &bank.top() ) != NULL );
+
+  bank.pop();
+
+  FRENSIE_CHECK( bank.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the arena storage is reused after particles are popped
+FRENSIE_UNIT_TEST( ArenaParticleBank, pop_reuse )
+{
+  std::shared_ptr<MonteCarlo::ParticleStateArena>
+    arena( new MonteCarlo::ParticleStateArena( 4 ) );
+
+  MonteCarlo::ArenaParticleBank bank( arena );
+
+  for( size_t i = 0; i < 100; ++i )
+  {
+    MonteCarlo::PhotonState photon( i );
+
+    bank.push( photon );
+
+    const MonteCarlo::ParticleState& top_particle = bank.top();
+
+    // Pushing more particles must not invalidate the top particle
+    bank.push( photon );
+    bank.push( photon );
+
+    FRENSIE_CHECK_EQUAL( top_particle.getHistoryNumber(), i );
+
+    bank.pop();
+    bank.pop();
+    bank.pop();
+  }
+
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_CHECK_EQUAL( arena->getNumberOfBlocks(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the top particle can be removed from the bank and stored
+FRENSIE_UNIT_TEST( ArenaParticleBank, pop_store )
+{
+  std::shared_ptr<MonteCarlo::ParticleState> particle;
+
+  {
+    MonteCarlo::ArenaParticleBank bank;
+
+    MonteCarlo::PositronState positron( 3ull );
+
+    bank.push( positron );
+
+    bank.pop( particle );
+
+    FRENSIE_CHECK( bank.isEmpty() );
+  }
+
+  FRENSIE_CHECK_EQUAL( particle->getHistoryNumber(), 3ull );
+  FRENSIE_CHECK_EQUAL( particle->getParticleType(), MonteCarlo::POSITRON );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the bank can be sorted
+FRENSIE_UNIT_TEST( ArenaParticleBank, sort )
+{
+  MonteCarlo::ArenaParticleBank bank;
+
+  {
+    MonteCarlo::PhotonState photon( 1ull );
+
+    bank.push( photon );
+  }
+
+  {
+    MonteCarlo::NeutronState neutron( 2ull );
+
+    bank.push( neutron );
+  }
+
+  {
+    MonteCarlo::PositronState positron( 0ull );
+
+    bank.push( positron );
+  }
+
+  FRENSIE_CHECK( !bank.isSorted( compareHistoryNumbers ) );
+
+  bank.sort( compareHistoryNumbers );
+
+  FRENSIE_CHECK( bank.isSorted( compareHistoryNumbers ) );
+  FRENSIE_CHECK_EQUAL( bank.top().getHistoryNumber(), 0ull );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::POSITRON );
+}
+
+//---------------------------------------------------------------------------//
+// Check that banks can be merged
+FRENSIE_UNIT_TEST( ArenaParticleBank, merge )
+{
+  MonteCarlo::ArenaParticleBank bank_a;
+  MonteCarlo::ParticleBank bank_b;
+
+  {
+    MonteCarlo::PhotonState photon( 2ull );
+    bank_a.push( photon );
+  }
+
+  {
+    MonteCarlo::ElectronState electron( 0ull );
+    bank_a.push( electron );
+  }
+
+  {
+    MonteCarlo::NeutronState neutron( 1ull );
+    bank_b.push( neutron );
+  }
+
+  bank_a.sort( compareHistoryNumbers );
+
+  bank_a.merge( bank_b, compareHistoryNumbers );
+
+  FRENSIE_CHECK( bank_a.isSorted( compareHistoryNumbers ) );
+  FRENSIE_CHECK_EQUAL( bank_a.size(), 3 );
+  FRENSIE_CHECK_EQUAL( bank_b.size(), 0 );
+
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 0ull );
+
+  bank_a.pop();
+
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 1ull );
+  FRENSIE_CHECK_EQUAL( bank_a.top().getParticleType(), MonteCarlo::NEUTRON );
+
+  bank_a.pop();
+
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 2ull );
+}
+
+//---------------------------------------------------------------------------//
+// Check that banks can be spliced
+FRENSIE_UNIT_TEST( ArenaParticleBank, splice )
+{
+  MonteCarlo::ParticleBank bank_a;
+
+  {
+    MonteCarlo::ArenaParticleBank bank_b;
+
+    MonteCarlo::PhotonState photon( 2ull );
+    bank_a.push( photon );
+
+    MonteCarlo::NeutronState neutron( 4ull );
+    bank_b.push( neutron );
+
+    MonteCarlo::ElectronState electron( 0ull );
+    bank_b.push( electron );
+
+    bank_a.splice( bank_b );
+
+    FRENSIE_CHECK_EQUAL( bank_b.size(), 0 );
+  }
+
+  // The states allocated by the arena bank must outlive it
+  FRENSIE_CHECK_EQUAL( bank_a.size(), 3 );
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 2ull );
+
+  bank_a.pop();
+
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 4ull );
+  FRENSIE_CHECK_EQUAL( bank_a.top().getParticleType(), MonteCarlo::NEUTRON );
+
+  bank_a.pop();
+
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 0ull );
+  FRENSIE_CHECK_EQUAL( bank_a.top().getParticleType(), MonteCarlo::ELECTRON );
+}
+
+//---------------------------------------------------------------------------//
+// end tstArenaParticleBank.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,126 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDistributedBatchScheduleTypeHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Distributed batch schedule type helper function unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_DistributedBatchScheduleType.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a type can be converted to a string
+FRENSIE_UNIT_TEST( DistributedBatchScheduleType, toString )
+{
+  std::string type_name =
+    Utility::toString( MonteCarlo::STATIC_DISTRIBUTED_BATCH_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_name, "Static Distributed Batch Schedule" );
+
+  type_name = Utility::toString( MonteCarlo::ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_name, "Adaptive Distributed Batch Schedule" );
+
+  type_name = Utility::toString( MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_name, "Work Stealing Distributed Batch Schedule" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a type can be placed in a stream
+FRENSIE_UNIT_TEST( DistributedBatchScheduleType, ostream_operator )
+{
+  std::ostringstream oss;
+
+  oss << MonteCarlo::STATIC_DISTRIBUTED_BATCH_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Static Distributed Batch Schedule" );
+
+  oss.str( "" );
+  oss.clear();
+
+  oss << MonteCarlo::ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Adaptive Distributed Batch Schedule" );
+
+  oss.str( "" );
+  oss.clear();
+
+  oss << MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Work Stealing Distributed Batch Schedule" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a type can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DistributedBatchScheduleType,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_distributed_batch_schedule_type" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::DistributedBatchScheduleType type_1 =
+      MonteCarlo::STATIC_DISTRIBUTED_BATCH_SCHEDULE;
+
+    MonteCarlo::DistributedBatchScheduleType type_2 =
+      MonteCarlo::ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE;
+
+    MonteCarlo::DistributedBatchScheduleType type_3 =
+      MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_1 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_2 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_3 ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived types
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::DistributedBatchScheduleType type_1, type_2, type_3;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_1 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_2 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_3 ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( type_1, MonteCarlo::STATIC_DISTRIBUTED_BATCH_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( type_2, MonteCarlo::ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( type_3, MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE );
+}
+
+//---------------------------------------------------------------------------//
+// end tstDistributedBatchScheduleTypeHelpers.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstHistoryScheduleTypeHelpers.cpp
+//! \author Alex Robinson
+//! \brief  History schedule type helper function unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryScheduleType.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a type can be converted to a string
+FRENSIE_UNIT_TEST( HistoryScheduleType, toString )
+{
+  std::string type_name =
+    Utility::toString( MonteCarlo::STATIC_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_name, "Static History Schedule" );
+
+  type_name = Utility::toString( MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_name, "Dynamic History Schedule" );
+
+  type_name = Utility::toString( MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_name, "Guided History Schedule" );
+
+  type_name = Utility::toString( MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_name, "Work Stealing History Schedule" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a type can be placed in a stream
+FRENSIE_UNIT_TEST( HistoryScheduleType, ostream_operator )
+{
+  std::ostringstream oss;
+
+  oss << MonteCarlo::STATIC_HISTORY_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Static History Schedule" );
+
+  oss.str( "" );
+  oss.clear();
+
+  oss << MonteCarlo::DYNAMIC_HISTORY_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Dynamic History Schedule" );
+
+  oss.str( "" );
+  oss.clear();
+
+  oss << MonteCarlo::GUIDED_HISTORY_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Guided History Schedule" );
+
+  oss.str( "" );
+  oss.clear();
+
+  oss << MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Work Stealing History Schedule" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a type can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( HistoryScheduleType,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_history_schedule_type" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::HistoryScheduleType type_1 =
+      MonteCarlo::STATIC_HISTORY_SCHEDULE;
+
+    MonteCarlo::HistoryScheduleType type_2 =
+      MonteCarlo::DYNAMIC_HISTORY_SCHEDULE;
+
+    MonteCarlo::HistoryScheduleType type_3 =
+      MonteCarlo::GUIDED_HISTORY_SCHEDULE;
+
+    MonteCarlo::HistoryScheduleType type_4 =
+      MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_1 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_2 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_3 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_4 ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived types
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::HistoryScheduleType type_1, type_2, type_3, type_4;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_1 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_2 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_3 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_4 ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( type_1, MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( type_2, MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( type_3, MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( type_4, MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE );
+}
+
+//---------------------------------------------------------------------------//
+// end tstHistoryScheduleTypeHelpers.cpp
+//---------------------------------------------------------------------------//
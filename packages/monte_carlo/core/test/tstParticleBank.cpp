@@ -509,6 +509,48 @@ FRENSIE_UNIT_TEST( ParticleBank, splice )
 		       MonteCarlo::POSITRON );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the top particle can be spliced onto another bank
+FRENSIE_UNIT_TEST( ParticleBank, spliceTop )
+{
+  MonteCarlo::ParticleBank bank_a, bank_b;
+
+  std::shared_ptr<MonteCarlo::PhotonState>
+    photon( new MonteCarlo::PhotonState( 2ull ) );
+
+  const MonteCarlo::ParticleState* raw_photon = photon.get();
+
+  bank_a.push( photon );
+
+  {
+    MonteCarlo::NeutronState neutron( 4ull );
+    bank_a.push( neutron );
+  }
+
+  {
+    MonteCarlo::ElectronState electron( 0ull );
+    bank_b.push( electron );
+  }
+
+  bank_a.spliceTop( bank_b );
+
+  FRENSIE_CHECK_EQUAL( bank_a.size(), 1 );
+  FRENSIE_CHECK_EQUAL( bank_b.size(), 2 );
+
+  FRENSIE_CHECK_EQUAL( bank_a.top().getHistoryNumber(), 4ull );
+  FRENSIE_CHECK_EQUAL( bank_a.top().getParticleType(),
+		       MonteCarlo::NEUTRON );
+
+  FRENSIE_CHECK_EQUAL( bank_b.top().getHistoryNumber(), 0ull );
+
+  bank_b.pop();
+
+  // The state must not have been copied
+  FRENSIE_CHECK( &bank_b.top() == raw_photon );
+  FRENSIE_CHECK_EQUAL( bank_b.top().getParticleType(),
+		       MonteCarlo::PHOTON );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle bank can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleBank, archive, TestArchives )
@@ -53,6 +53,9 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::TWOBS_DISTRIBUTION );
   FRENSIE_CHECK( properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( !properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxEnergyLossFraction(), 0.05 );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryBoundarySkinDepth(), 3.0 );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteSurvivalWeight(), 1e-30 );
 }
@@ -352,6 +355,47 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, setAtomicExcitationModeOffOn )
   FRENSIE_CHECK( properties.isAtomicExcitationModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that condensed history mode can be turned on
+FRENSIE_UNIT_TEST( SimulationElectronProperties, setCondensedHistoryModeOnOff )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryModeOn();
+
+  FRENSIE_CHECK( properties.isCondensedHistoryModeOn() );
+
+  properties.setCondensedHistoryModeOff();
+
+  FRENSIE_CHECK( !properties.isCondensedHistoryModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the condensed history max energy loss fraction can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setCondensedHistoryMaxEnergyLossFraction )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryMaxEnergyLossFraction( 0.1 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxEnergyLossFraction(),
+                       0.1 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the condensed history boundary skin depth can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setCondensedHistoryBoundarySkinDepth )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryBoundarySkinDepth( 1.5 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryBoundarySkinDepth(),
+                       1.5 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the critical line energies can be set
 FRENSIE_UNIT_TEST( SimulationElectronProperties,
@@ -420,6 +464,9 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
     custom_properties.setBremsstrahlungModeOff();
     custom_properties.setBremsstrahlungAngularDistributionFunction( MonteCarlo::DIPOLE_DISTRIBUTION );
     custom_properties.setAtomicExcitationModeOff();
+    custom_properties.setCondensedHistoryModeOn();
+    custom_properties.setCondensedHistoryMaxEnergyLossFraction( 0.1 );
+    custom_properties.setCondensedHistoryBoundarySkinDepth( 1.5 );
     custom_properties.setElectronRouletteThresholdWeight( 1e-15 );
     custom_properties.setElectronRouletteSurvivalWeight( 1e-13 );
 
@@ -460,6 +507,9 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::TWOBS_DISTRIBUTION );
   FRENSIE_CHECK( default_properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( !default_properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryMaxEnergyLossFraction(), 0.05 );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryBoundarySkinDepth(), 3.0 );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteSurvivalWeight(), 1e-30  );
 
@@ -488,6 +538,9 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getBremsstrahlungAngularDistributionFunction(),
                        MonteCarlo::DIPOLE_DISTRIBUTION );
   FRENSIE_CHECK( !custom_properties.isAtomicExcitationModeOn() );
+  FRENSIE_CHECK( custom_properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryMaxEnergyLossFraction(), 0.1 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryBoundarySkinDepth(), 1.5 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteSurvivalWeight(), 1e-13 );
 }
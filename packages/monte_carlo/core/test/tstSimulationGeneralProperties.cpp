@@ -41,6 +41,18 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !properties.isArenaParticleBankModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getUnionizedEnergyGridMode(),
+                       MonteCarlo::NO_UNIONIZED_ENERGY_GRID );
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleChunkSize(), 1 );
+  FRENSIE_CHECK( !properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getDistributedBatchScheduleType(),
+                       MonteCarlo::STATIC_DISTRIBUTED_BATCH_SCHEDULE );
+  FRENSIE_CHECK( !properties.isDeltaTrackingModeOn() );
+  FRENSIE_CHECK( !properties.isThreadPrivateMomentAccumulationModeOn() );
+  FRENSIE_CHECK( !properties.isCounterBasedRandomNumberGeneratorModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -193,6 +205,152 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOnOff )
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that arena particle bank mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setArenaParticleBankModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setArenaParticleBankModeOn();
+
+  FRENSIE_CHECK( properties.isArenaParticleBankModeOn() );
+
+  properties.setStandardParticleBankModeOn();
+
+  FRENSIE_CHECK( !properties.isArenaParticleBankModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the unionized energy grid mode can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setUnionizedEnergyGridMode )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setUnionizedEnergyGridMode( MonteCarlo::FULL_UNIONIZED_ENERGY_GRID );
+
+  FRENSIE_CHECK_EQUAL( properties.getUnionizedEnergyGridMode(),
+                       MonteCarlo::FULL_UNIONIZED_ENERGY_GRID );
+
+  properties.setUnionizedEnergyGridMode( MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID );
+
+  FRENSIE_CHECK_EQUAL( properties.getUnionizedEnergyGridMode(),
+                       MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the history schedule type can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setHistoryScheduleType )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistoryScheduleType( MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  properties.setHistoryScheduleType( MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleType(),
+                       MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the history schedule chunk size can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setHistoryScheduleChunkSize )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistoryScheduleChunkSize( 16 );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleChunkSize(), 16 );
+
+  FRENSIE_CHECK_THROW( properties.setHistoryScheduleChunkSize( 0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that event-based transport mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setEventBasedTransportModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setEventBasedTransportModeOn();
+
+  FRENSIE_CHECK( properties.isEventBasedTransportModeOn() );
+
+  properties.setHistoryBasedTransportModeOn();
+
+  FRENSIE_CHECK( !properties.isEventBasedTransportModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the distributed batch schedule type can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setDistributedBatchScheduleType )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setDistributedBatchScheduleType(
+                            MonteCarlo::ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getDistributedBatchScheduleType(),
+                       MonteCarlo::ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE );
+
+  properties.setDistributedBatchScheduleType(
+                       MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getDistributedBatchScheduleType(),
+                       MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE );
+}
+
+//---------------------------------------------------------------------------//
+// Test that delta tracking mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setDeltaTrackingModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setDeltaTrackingModeOn();
+
+  FRENSIE_CHECK( properties.isDeltaTrackingModeOn() );
+
+  properties.setSurfaceTrackingModeOn();
+
+  FRENSIE_CHECK( !properties.isDeltaTrackingModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that thread-private moment accumulation mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setThreadPrivateMomentAccumulationModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setThreadPrivateMomentAccumulationModeOn();
+
+  FRENSIE_CHECK( properties.isThreadPrivateMomentAccumulationModeOn() );
+
+  properties.setSharedMomentAccumulationModeOn();
+
+  FRENSIE_CHECK( !properties.isThreadPrivateMomentAccumulationModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that counter-based random number generator mode can be turned on/off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setCounterBasedRandomNumberGeneratorModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setCounterBasedRandomNumberGeneratorModeOn();
+
+  FRENSIE_CHECK( properties.isCounterBasedRandomNumberGeneratorModeOn() );
+
+  properties.setLinearCongruentialRandomNumberGeneratorModeOn();
+
+  FRENSIE_CHECK( !properties.isCounterBasedRandomNumberGeneratorModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
@@ -226,6 +384,15 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
     custom_properties.setNumberOfBatchesPerProcessor( 25 );
     custom_properties.setNumberOfSnapshotsPerBatch( 3 );
     custom_properties.setImplicitCaptureModeOn();
+    custom_properties.setArenaParticleBankModeOn();
+    custom_properties.setUnionizedEnergyGridMode( MonteCarlo::FULL_UNIONIZED_ENERGY_GRID );
+    custom_properties.setHistoryScheduleType( MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+    custom_properties.setHistoryScheduleChunkSize( 8 );
+    custom_properties.setEventBasedTransportModeOn();
+    custom_properties.setDistributedBatchScheduleType( MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE );
+    custom_properties.setDeltaTrackingModeOn();
+    custom_properties.setThreadPrivateMomentAccumulationModeOn();
+    custom_properties.setCounterBasedRandomNumberGeneratorModeOn();
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -257,6 +424,18 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !default_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( !default_properties.isArenaParticleBankModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getUnionizedEnergyGridMode(),
+                       MonteCarlo::NO_UNIONIZED_ENERGY_GRID );
+  FRENSIE_CHECK_EQUAL( default_properties.getHistoryScheduleType(),
+                       MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( default_properties.getHistoryScheduleChunkSize(), 1 );
+  FRENSIE_CHECK( !default_properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getDistributedBatchScheduleType(),
+                       MonteCarlo::STATIC_DISTRIBUTED_BATCH_SCHEDULE );
+  FRENSIE_CHECK( !default_properties.isDeltaTrackingModeOn() );
+  FRENSIE_CHECK( !default_properties.isThreadPrivateMomentAccumulationModeOn() );
+  FRENSIE_CHECK( !default_properties.isCounterBasedRandomNumberGeneratorModeOn() );
 
   MonteCarlo::SimulationGeneralProperties custom_properties;
 
@@ -275,6 +454,18 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfBatchesPerProcessor(), 25 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfSnapshotsPerBatch(), 3 );
   FRENSIE_CHECK( custom_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK( custom_properties.isArenaParticleBankModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getUnionizedEnergyGridMode(),
+                       MonteCarlo::FULL_UNIONIZED_ENERGY_GRID );
+  FRENSIE_CHECK_EQUAL( custom_properties.getHistoryScheduleType(),
+                       MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( custom_properties.getHistoryScheduleChunkSize(), 8 );
+  FRENSIE_CHECK( custom_properties.isEventBasedTransportModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getDistributedBatchScheduleType(),
+                       MonteCarlo::WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE );
+  FRENSIE_CHECK( custom_properties.isDeltaTrackingModeOn() );
+  FRENSIE_CHECK( custom_properties.isThreadPrivateMomentAccumulationModeOn() );
+  FRENSIE_CHECK( custom_properties.isCounterBasedRandomNumberGeneratorModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -34,9 +34,14 @@ FRENSIE_UNIT_TEST( SimulationNeutronProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getNumberOfNeutronHashGridBins(), 1000u );
   FRENSIE_CHECK_EQUAL( properties.getAbsoluteMaxNeutronEnergy(), 20.0 );
   FRENSIE_CHECK_EQUAL( properties.getFreeGasThreshold(), 400.0 );
+  FRENSIE_CHECK_EQUAL( properties.getMaxDopplerBroadeningEnergy(), 0.1 );
   FRENSIE_CHECK( properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_SMALL( properties.getNeutronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getNeutronRouletteSurvivalWeight(), 1e-30 );
+  FRENSIE_CHECK( !properties.isPowerIterationModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfNeutronsPerCycle(), 1000 );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfInactiveCycles(), 10u );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfActiveCycles(), 50u );
 }
 
 //---------------------------------------------------------------------------//
@@ -84,6 +89,17 @@ FRENSIE_UNIT_TEST( SimulationNeutronProperties, setFreeGasThreshold )
   FRENSIE_CHECK_EQUAL( properties.getFreeGasThreshold(), 1000.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the max Doppler broadening energy can be set
+FRENSIE_UNIT_TEST( SimulationNeutronProperties, setMaxDopplerBroadeningEnergy )
+{
+  MonteCarlo::SimulationNeutronProperties properties;
+
+  properties.setMaxDopplerBroadeningEnergy( 1e-3 );
+
+  FRENSIE_CHECK_EQUAL( properties.getMaxDopplerBroadeningEnergy(), 1e-3 );
+}
+
 //---------------------------------------------------------------------------//
 // Test that the unresolved resonance probability table mode can be toggled
 FRENSIE_UNIT_TEST( SimulationNeutronProperties,
@@ -130,6 +146,49 @@ FRENSIE_UNIT_TEST( SimulationNeutronProperties,
                        weight );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the power iteration mode can be toggled
+FRENSIE_UNIT_TEST( SimulationNeutronProperties,
+                   setPowerIterationModeOn_setFixedSourceModeOn )
+{
+  MonteCarlo::SimulationNeutronProperties properties;
+
+  properties.setPowerIterationModeOn();
+
+  FRENSIE_CHECK( properties.isPowerIterationModeOn() );
+
+  properties.setFixedSourceModeOn();
+
+  FRENSIE_CHECK( !properties.isPowerIterationModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the number of neutrons per cycle can be set
+FRENSIE_UNIT_TEST( SimulationNeutronProperties, setNumberOfNeutronsPerCycle )
+{
+  MonteCarlo::SimulationNeutronProperties properties;
+
+  properties.setNumberOfNeutronsPerCycle( 100000000 );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfNeutronsPerCycle(), 100000000 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the number of inactive and active cycles can be set
+FRENSIE_UNIT_TEST( SimulationNeutronProperties,
+                   setNumberOfInactiveCycles_setNumberOfActiveCycles )
+{
+  MonteCarlo::SimulationNeutronProperties properties;
+
+  properties.setNumberOfInactiveCycles( 0u );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfInactiveCycles(), 0u );
+
+  properties.setNumberOfActiveCycles( 200u );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfActiveCycles(), 200u );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
@@ -157,9 +216,14 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
     custom_properties.setMaxNeutronEnergy( 15.0 );
     custom_properties.setNumberOfNeutronHashGridBins( 150u );
     custom_properties.setFreeGasThreshold( 1000.0 );
+    custom_properties.setMaxDopplerBroadeningEnergy( 1e-3 );
     custom_properties.setUnresolvedResonanceProbabilityTableModeOff();
     custom_properties.setNeutronRouletteThresholdWeight( 1e-15 );
     custom_properties.setNeutronRouletteSurvivalWeight( 1e-13 );
+    custom_properties.setPowerIterationModeOn();
+    custom_properties.setNumberOfNeutronsPerCycle( 5000 );
+    custom_properties.setNumberOfInactiveCycles( 20u );
+    custom_properties.setNumberOfActiveCycles( 100u );
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -183,9 +247,14 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getAbsoluteMaxNeutronEnergy(), 20.0 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfNeutronHashGridBins(), 1000u );
   FRENSIE_CHECK_EQUAL( default_properties.getFreeGasThreshold(), 400.0 );
+  FRENSIE_CHECK_EQUAL( default_properties.getMaxDopplerBroadeningEnergy(), 0.1 );
   FRENSIE_CHECK( default_properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_SMALL( default_properties.getNeutronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getNeutronRouletteSurvivalWeight(), 1e-30  );
+  FRENSIE_CHECK( !default_properties.isPowerIterationModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfNeutronsPerCycle(), 1000 );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfInactiveCycles(), 10u );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfActiveCycles(), 50u );
 
   MonteCarlo::SimulationNeutronProperties custom_properties;
 
@@ -197,9 +266,14 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getAbsoluteMaxNeutronEnergy(), 20.0 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfNeutronHashGridBins(), 150u );
   FRENSIE_CHECK_EQUAL( custom_properties.getFreeGasThreshold(), 1000.0 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getMaxDopplerBroadeningEnergy(), 1e-3 );
   FRENSIE_CHECK( !custom_properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getNeutronRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNeutronRouletteSurvivalWeight(), 1e-13 );
+  FRENSIE_CHECK( custom_properties.isPowerIterationModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfNeutronsPerCycle(), 5000 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfInactiveCycles(), 20u );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfActiveCycles(), 100u );
 }
 
 //---------------------------------------------------------------------------//
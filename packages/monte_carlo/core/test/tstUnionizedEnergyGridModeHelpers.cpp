@@ -0,0 +1,126 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstUnionizedEnergyGridModeHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Unionized energy grid mode helper function unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_UnionizedEnergyGridMode.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a mode can be converted to a string
+FRENSIE_UNIT_TEST( UnionizedEnergyGridMode, toString )
+{
+  std::string mode_name =
+    Utility::toString( MonteCarlo::NO_UNIONIZED_ENERGY_GRID );
+
+  FRENSIE_CHECK_EQUAL( mode_name, "No Unionized Energy Grid" );
+
+  mode_name = Utility::toString( MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID );
+
+  FRENSIE_CHECK_EQUAL( mode_name, "Hashed Unionized Energy Grid" );
+
+  mode_name = Utility::toString( MonteCarlo::FULL_UNIONIZED_ENERGY_GRID );
+
+  FRENSIE_CHECK_EQUAL( mode_name, "Full Unionized Energy Grid" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a mode can be placed in a stream
+FRENSIE_UNIT_TEST( UnionizedEnergyGridMode, ostream_operator )
+{
+  std::ostringstream oss;
+
+  oss << MonteCarlo::NO_UNIONIZED_ENERGY_GRID;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "No Unionized Energy Grid" );
+
+  oss.str( "" );
+  oss.clear();
+
+  oss << MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Hashed Unionized Energy Grid" );
+
+  oss.str( "" );
+  oss.clear();
+
+  oss << MonteCarlo::FULL_UNIONIZED_ENERGY_GRID;
+
+  FRENSIE_CHECK_EQUAL( oss.str(), "Full Unionized Energy Grid" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a mode can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( UnionizedEnergyGridMode,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_unionized_energy_grid_mode" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::UnionizedEnergyGridMode mode_1 =
+      MonteCarlo::NO_UNIONIZED_ENERGY_GRID;
+
+    MonteCarlo::UnionizedEnergyGridMode mode_2 =
+      MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID;
+
+    MonteCarlo::UnionizedEnergyGridMode mode_3 =
+      MonteCarlo::FULL_UNIONIZED_ENERGY_GRID;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( mode_1 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( mode_2 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( mode_3 ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived modes
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::UnionizedEnergyGridMode mode_1, mode_2, mode_3;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( mode_1 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( mode_2 ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( mode_3 ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( mode_1, MonteCarlo::NO_UNIONIZED_ENERGY_GRID );
+  FRENSIE_CHECK_EQUAL( mode_2, MonteCarlo::HASHED_UNIONIZED_ENERGY_GRID );
+  FRENSIE_CHECK_EQUAL( mode_3, MonteCarlo::FULL_UNIONIZED_ENERGY_GRID );
+}
+
+//---------------------------------------------------------------------------//
+// end tstUnionizedEnergyGridModeHelpers.cpp
+//---------------------------------------------------------------------------//
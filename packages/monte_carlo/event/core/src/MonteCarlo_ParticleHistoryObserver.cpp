@@ -12,6 +12,7 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleHistoryObserver.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_LoggingMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -23,6 +24,12 @@ uint64_t ParticleHistoryObserver::s_num_histories = 0;
 // Initialize the elapsed time
 double ParticleHistoryObserver::s_elapsed_time = 0.0;
 
+// Initialize the number of history contribution slots of each thread
+unsigned ParticleHistoryObserver::s_num_history_contribution_slots = 1u;
+
+// Initialize the history whose contribution slot is selected by each thread
+thread_local uint64_t ParticleHistoryObserver::s_selected_history_number = 0ull;
+
 // Set the number of particle histories that have been observed
 void ParticleHistoryObserver::setNumberOfHistories(
                                                  const uint64_t num_histories )
@@ -49,6 +56,51 @@ double ParticleHistoryObserver::getElapsedTime()
   return s_elapsed_time;
 }
 
+// Set the number of history contribution slots of each thread
+/*! \details Each slot stores the uncommitted contributions of a single
+ * history. A thread only needs more than one slot if it simulates the
+ * particles of several histories together (e.g. event-based transport).
+ * This must be set before the observers enable thread support.
+ */
+void ParticleHistoryObserver::setNumberOfHistoryContributionSlots(
+                                                         const unsigned slots )
+{
+  // Make sure that the number of slots is valid
+  testPrecondition( slots > 0 );
+
+  s_num_history_contribution_slots = slots;
+}
+
+// Get the number of history contribution slots of each thread
+unsigned ParticleHistoryObserver::getNumberOfHistoryContributionSlots()
+{
+  return s_num_history_contribution_slots;
+}
+
+// Select the history contribution slot of the calling thread
+/*! \details The histories that share a thread's slots at the same time
+ * must be consecutive (the slot is the history number modulo the number of
+ * slots). The contributions made by the thread will go to the selected slot
+ * until another slot is selected.
+ */
+void ParticleHistoryObserver::selectHistoryContributionSlot(
+                                                const uint64_t history_number )
+{
+  s_selected_history_number = history_number;
+}
+
+// Get the index of the selected history contribution slot of the thread
+/*! \details The observers must store the uncommitted history contributions
+ * of each thread in (number of threads)*(number of history contribution
+ * slots) buffers, which are indexed by the returned value.
+ */
+unsigned ParticleHistoryObserver::getHistoryContributionSlotIndex()
+{
+  return Utility::OpenMPProperties::getThreadId()*
+    s_num_history_contribution_slots +
+    s_selected_history_number % s_num_history_contribution_slots;
+}
+
 // Log a summary of the data
 void ParticleHistoryObserver::logSummary() const
 {
@@ -59,6 +111,20 @@ void ParticleHistoryObserver::logSummary() const
   FRENSIE_LOG_NOTIFICATION( oss.str() );
 }
 
+// Capture the data that will be saved to an archive
+/*! \details Once a snapshot has been captured the observer will be saved
+ * from the snapshot instead of from its current state until the snapshot is
+ * released. This allows the observer to be saved on another thread while the
+ * simulation continues to update it. Observers that only save data that
+ * does not change during a simulation do not need to capture anything.
+ */
+void ParticleHistoryObserver::takeArchiveSnapshot()
+{ /* ... */ }
+
+// Release the data that was captured for an archive
+void ParticleHistoryObserver::releaseArchiveSnapshot()
+{ /* ... */ }
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleHistoryObserver );
@@ -47,6 +47,15 @@ public:
   //! Set the elapsed time (for analysis of observer data)
   static void setElapsedTime( const double elapsed_time );
 
+  //! Set the number of history contribution slots of each thread
+  static void setNumberOfHistoryContributionSlots( const unsigned slots );
+
+  //! Get the number of history contribution slots of each thread
+  static unsigned getNumberOfHistoryContributionSlots();
+
+  //! Select the history contribution slot of the calling thread
+  static void selectHistoryContributionSlot( const uint64_t history_number );
+
   //! Enable support for multiple threads
   virtual void enableThreadSupport( const unsigned num_threads ) = 0;
 
@@ -73,6 +82,12 @@ public:
   //! Log a summary of the data
   virtual void logSummary() const;
 
+  //! Capture the data that will be saved to an archive
+  virtual void takeArchiveSnapshot();
+
+  //! Release the data that was captured for an archive
+  virtual void releaseArchiveSnapshot();
+
 protected:
 
   //! Get the number of particle histories observed
@@ -81,6 +96,9 @@ protected:
   //! Get the elapsed time (for analysis of observer data)
   static double getElapsedTime();
 
+  //! Get the index of the selected history contribution slot of the thread
+  static unsigned getHistoryContributionSlotIndex();
+
 private:
 
   // Serialize the observer
@@ -96,6 +114,12 @@ private:
 
   // The elapsed time (used for the figure of merit calculation)
   static double s_elapsed_time;
+
+  // The number of history contribution slots of each thread
+  static unsigned s_num_history_contribution_slots;
+
+  // The history whose contribution slot has been selected by each thread
+  static thread_local uint64_t s_selected_history_number;
 };
 
 } // end MonteCarlo namespace
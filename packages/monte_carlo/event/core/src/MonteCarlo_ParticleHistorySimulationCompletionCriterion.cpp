@@ -27,13 +27,17 @@ public:
 
   //! Default constructor
   HistoryCountParticleHistorySimulationCompletionCriterion()
+    : d_archive_snapshot_taken( false ),
+      d_archived_num_completed_histories( 0 )
   { /* ... */ }
   
   //! Constructor
   HistoryCountParticleHistorySimulationCompletionCriterion( const uint64_t history_wall )
     : d_history_wall( history_wall ),
       d_num_completed_histories( 1, 0 ),
-      d_count_histories( false )
+      d_count_histories( false ),
+      d_archive_snapshot_taken( false ),
+      d_archived_num_completed_histories( 0 )
   { /* ... */ }
 
   //! Destructor
@@ -163,6 +167,17 @@ public:
     }
   }
 
+  //! Capture the data that will be saved to an archive
+  void takeArchiveSnapshot() final override
+  {
+    d_archived_num_completed_histories = this->getNumberOfCompletedHistories();
+    d_archive_snapshot_taken = true;
+  }
+
+  //! Release the data that was captured for an archive
+  void releaseArchiveSnapshot() final override
+  { d_archive_snapshot_taken = false; }
+
   //! Get a description of the criterion
   std::string description() const final override
   {
@@ -181,7 +196,9 @@ private:
     ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleHistorySimulationCompletionCriterion );
 
     // Save the local member data
-    uint64_t num_completed_histories = this->getNumberOfCompletedHistories();
+    uint64_t num_completed_histories = d_archive_snapshot_taken ?
+      d_archived_num_completed_histories :
+      this->getNumberOfCompletedHistories();
     
     ar & BOOST_SERIALIZATION_NVP( num_completed_histories );
     ar & BOOST_SERIALIZATION_NVP( d_history_wall );
@@ -221,6 +238,13 @@ private:
 
   // Active flag
   bool d_count_histories;
+
+  // Records if the number of completed histories has been captured for an
+  // archive
+  bool d_archive_snapshot_taken;
+
+  // The number of completed histories captured for an archive
+  uint64_t d_archived_num_completed_histories;
 };
 
 //! The wall time particle history simulation completion criterion
@@ -429,6 +453,20 @@ public:
     d_rhs->reduceData( comm, root_process );
   }
 
+  //! Capture the data that will be saved to an archive
+  void takeArchiveSnapshot() final override
+  {
+    d_lhs->takeArchiveSnapshot();
+    d_rhs->takeArchiveSnapshot();
+  }
+
+  //! Release the data that was captured for an archive
+  void releaseArchiveSnapshot() final override
+  {
+    d_lhs->releaseArchiveSnapshot();
+    d_rhs->releaseArchiveSnapshot();
+  }
+
   //! Get a description of the criterion
   std::string description() const final override
   {
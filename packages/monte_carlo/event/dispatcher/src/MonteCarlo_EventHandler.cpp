@@ -37,7 +37,11 @@ EventHandler::EventHandler()
     d_elapsed_simulation_time( 0.0 ),
     d_estimators(),
     d_particle_trackers(),
-    d_particle_history_observers( {d_simulation_completion_criterion} )
+    d_particle_history_observers( {d_simulation_completion_criterion} ),
+    d_thread_private_moment_accumulation_mode_on( false ),
+    d_archive_snapshot_taken( false ),
+    d_archived_number_of_committed_histories( 0 ),
+    d_archived_elapsed_time( 0.0 )
 { /* ... */ }
 
 // Constructor
@@ -70,7 +74,11 @@ EventHandler::EventHandler(
     d_elapsed_simulation_time( 0.0 ),
     d_estimators(),
     d_particle_trackers(),
-    d_particle_history_observers( {d_simulation_completion_criterion} )
+    d_particle_history_observers( {d_simulation_completion_criterion} ),
+    d_thread_private_moment_accumulation_mode_on( properties.isThreadPrivateMomentAccumulationModeOn() ),
+    d_archive_snapshot_taken( false ),
+    d_archived_number_of_committed_histories( 0 ),
+    d_archived_elapsed_time( 0.0 )
 {
   if( model )
   {
@@ -496,6 +504,24 @@ const ParticleTracker& EventHandler::getParticleTracker( const uint32_t particle
   return *d_particle_trackers.find( particle_tracker_id )->second;
 }
 
+// Check if observers that require surface tracking have been registered
+/*! \details Observers of particle subtrack ending in cell, particle entering
+ * cell, particle leaving cell and particle crossing surface events require
+ * the particle to be ray traced through every cell boundary (e.g. cell
+ * track-length flux estimators and surface estimators). Delta tracking must
+ * not be used with a particle type that has any of these observers.
+ * Collision and global observers do not require surface tracking.
+ */
+bool EventHandler::hasSurfaceTrackingObservers(
+                                       const ParticleType particle_type ) const
+{
+  return
+    this->getParticleSubtrackEndingInCellEventDispatcher().hasObservers( particle_type ) ||
+    this->getParticleEnteringCellEventDispatcher().hasObservers( particle_type ) ||
+    this->getParticleLeavingCellEventDispatcher().hasObservers( particle_type ) ||
+    this->getParticleCrossingSurfaceEventDispatcher().hasObservers( particle_type );
+}
+
 // Enable support for multiple threads
 /*! \details This should only be called after all of the estimators have been
  * added.
@@ -522,6 +548,15 @@ void EventHandler::enableThreadSupport( const unsigned num_threads )
 // Update observers from particle simulation started event
 void EventHandler::updateObserversFromParticleSimulationStartedEvent()
 {
+  // Freeze the observer graph into flat dispatch tables
+  this->getParticleCollidingInCellEventDispatcher().finalize();
+  this->getParticleCrossingSurfaceEventDispatcher().finalize();
+  this->getParticleEnteringCellEventDispatcher().finalize();
+  this->getParticleLeavingCellEventDispatcher().finalize();
+  this->getParticleSubtrackEndingInCellEventDispatcher().finalize();
+  this->getParticleSubtrackEndingGlobalEventDispatcher().finalize();
+  this->getParticleGoneGlobalEventDispatcher().finalize();
+
   d_simulation_completion_criterion->start();
   d_simulation_timer->start();
   d_snapshot_timer->start();
@@ -642,15 +677,73 @@ void EventHandler::resetObserverData()
   }
 }
 
+// Capture the observer data that will be saved to an archive
+/*! \details Until the captured data is released the handler and its
+ * observers will save the captured data instead of their current data. This
+ * allows the handler to be saved while the observers continue to be updated
+ * (e.g. by a rendezvous archive writer thread). Only the master thread
+ * should call this function while no histories are being simulated.
+ */
+void EventHandler::takeArchiveSnapshot()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_archived_number_of_committed_histories =
+    this->getNumberOfCommittedHistories();
+
+  d_archived_elapsed_time = this->getElapsedTime();
+
+  for( auto&& observer : d_particle_history_observers )
+    observer->takeArchiveSnapshot();
+
+  d_archive_snapshot_taken = true;
+}
+
+// Release the observer data that was captured for an archive
+void EventHandler::releaseArchiveSnapshot()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( auto&& observer : d_particle_history_observers )
+    observer->releaseArchiveSnapshot();
+
+  d_archive_snapshot_taken = false;
+}
+
 // Reduce the observer data on all processes in comm and collect on the root
 /*! \details A Snapshot must be taken before the reduction to ensure that the
- * snapshot data stays in sync with the current data.
+ * snapshot data stays in sync with the current data. Creating the reducer
+ * requires collective communication - when the data will be reduced
+ * repeatedly the reducer should be created once and passed to the other
+ * overload.
  */
 void EventHandler::reduceObserverData( const Utility::Communicator& comm,
                                        const int root_process )
 {
   // Make sure only the master thread calls this function
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( comm.size() > 1 )
+  {
+    Utility::HierarchicalReducer reducer( comm, root_process );
+
+    this->reduceObserverData( reducer, comm, root_process );
+  }
+}
+
+// Reduce the observer data on all processes in comm and collect on the root
+/*! \details A Snapshot must be taken before the reduction to ensure that the
+ * snapshot data stays in sync with the current data. The reducer must have
+ * been created from the communicator with the same root process.
+ */
+void EventHandler::reduceObserverData( Utility::HierarchicalReducer& reducer,
+                                       const Utility::Communicator& comm,
+                                       const int root_process )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
   // Make sure that a snapshot has been taken
   testPrecondition( this->getNumberOfCommittedHistoriesSinceLastSnapshot() == 0 );
 
@@ -696,17 +789,7 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
     comm.barrier();
 
     // Reduce the observers
-    ParticleHistoryObservers::iterator it =
-      d_particle_history_observers.begin();
-
-    while( it != d_particle_history_observers.end() )
-    {
-      (*it)->reduceData( comm, root_process );
-
-      comm.barrier();
-
-      ++it;
-    }
+    this->reduceParticleHistoryObserverData( reducer, comm, root_process );
 
     // Reset the snapshot timer (no need to include reduction time)
     this->resetElapsedTimeSinceLastSnapshot();
@@ -715,6 +798,97 @@ void EventHandler::reduceObserverData( const Utility::Communicator& comm,
   }
 }
 
+// Reduce the particle history observer data
+/*! \details The moments of all of the estimators are packed into a single
+ * contiguous buffer, which is summed using a hierarchical (node-local then
+ * inter-node) reduction. The remaining estimator data (e.g. snapshots and
+ * histograms) and the data of the other observers is then reduced by each
+ * observer. The time spent in each stage of the reduction is logged on the
+ * root process.
+ */
+void EventHandler::reduceParticleHistoryObserverData(
+                                         Utility::HierarchicalReducer& reducer,
+                                         const Utility::Communicator& comm,
+                                         const int root_process )
+{
+  std::shared_ptr<Utility::Timer> timer = comm.createTimer();
+
+  // Pack the moments of all estimators (the observers are stored in the
+  // same order on every process)
+  timer->start();
+  
+  std::vector<Estimator*> estimators;
+  std::vector<ParticleHistoryObserver*> other_observers;
+
+  for( auto&& observer : d_particle_history_observers )
+  {
+    Estimator* estimator = dynamic_cast<Estimator*>( observer.get() );
+
+    if( estimator )
+      estimators.push_back( estimator );
+    else
+      other_observers.push_back( observer.get() );
+  }
+
+  std::vector<double> moments;
+
+  for( auto&& estimator : estimators )
+    estimator->packMomentsForReduction( moments );
+
+  timer->stop();
+
+  const double pack_time = timer->elapsed().count();
+
+  // Reduce the packed moments
+  try{
+    reducer.reduceSum( moments );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction in event handler "
+                           "for the estimator moments!" );
+
+  // Unpack the reduced moments
+  timer->start();
+
+  if( comm.rank() == root_process )
+  {
+    size_t offset = 0;
+
+    for( auto&& estimator : estimators )
+      estimator->unpackReducedMoments( moments, offset );
+  }
+
+  timer->stop();
+
+  const double unpack_time = timer->elapsed().count();
+
+  // Reduce the remaining observer data
+  timer->start();
+  
+  for( auto&& estimator : estimators )
+    estimator->completeReduction( comm, root_process );
+
+  for( auto&& observer : other_observers )
+    observer->reduceData( comm, root_process );
+
+  timer->stop();
+
+  if( comm.rank() == root_process )
+  {
+    FRENSIE_LOG_NOTIFICATION( " Observer reduction (s): "
+                              << moments.size() << " moments packed in "
+                              << pack_time << ", "
+                              << "node-local reduction in "
+                              << reducer.getNodeReductionTime() << ", "
+                              << "inter-node (" << reducer.getNumberOfNodes()
+                              << " nodes) reduction in "
+                              << reducer.getInterNodeReductionTime() << ", "
+                              << "unpacked in " << unpack_time << ", "
+                              << "remaining data reduced in "
+                              << timer->elapsed().count() );
+  }
+}
+
 // Get the number of particle histories that have been simulated
 uint64_t EventHandler::getNumberOfCommittedHistories() const
 {
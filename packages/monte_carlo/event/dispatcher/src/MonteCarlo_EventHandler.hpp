@@ -23,12 +23,14 @@
 #include "MonteCarlo_ParticleSubtrackEndingGlobalEventHandler.hpp"
 #include "MonteCarlo_ParticleGoneGlobalEventHandler.hpp"
 #include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_DenseMeshTrackLengthFluxEstimator.hpp"
 #include "MonteCarlo_ParticleTracker.hpp"
 #include "MonteCarlo_ParticleHistorySimulationCompletionCriterion.hpp"
 #include "MonteCarlo_FilledGeometryModel.hpp"
 #include "MonteCarlo_ParticleState.hpp"
 #include "MonteCarlo_SimulationGeneralProperties.hpp"
 #include "Geometry_AdvancedModel.hpp"
+#include "Utility_HierarchicalReducer.hpp"
 #include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
@@ -118,6 +120,9 @@ public:
   //! Return the particle tracker
   const ParticleTracker& getParticleTracker( const ParticleTracker::Id particle_tracker_id ) const;
 
+  //! Check if observers that require surface tracking have been registered
+  bool hasSurfaceTrackingObservers( const ParticleType particle_type ) const;
+
   //! Enable support for multiple threads
   void enableThreadSupport( const unsigned num_threads );
 
@@ -142,10 +147,21 @@ public:
   //! Reset observer data
   void resetObserverData();
 
+  //! Capture the observer data that will be saved to an archive
+  void takeArchiveSnapshot();
+
+  //! Release the observer data that was captured for an archive
+  void releaseArchiveSnapshot();
+
   //! Reduce observer data on all processes in comm and collect on the root
   void reduceObserverData( const Utility::Communicator& comm,
                            const int root_process );
 
+  //! Reduce observer data on all processes in comm and collect on the root
+  void reduceObserverData( Utility::HierarchicalReducer& reducer,
+                           const Utility::Communicator& comm,
+                           const int root_process );
+
   //! Get the number of particle histories that have been committed
   uint64_t getNumberOfCommittedHistories() const;
 
@@ -173,6 +189,12 @@ private:
   // Reset the elapsed time since the last snapshot
   void resetElapsedTimeSinceLastSnapshot();
 
+  // Reduce the particle history observer data
+  void reduceParticleHistoryObserverData(
+                                         Utility::HierarchicalReducer& reducer,
+                                         const Utility::Communicator& comm,
+                                         const int root_process );
+
   // Struct for registering estimator
   template<typename EstimatorType>
   struct EstimatorRegistrationHelper
@@ -190,6 +212,15 @@ private:
           const std::shared_ptr<MeshTrackLengthFluxEstimator<T> >& estimator );
   };
 
+  // Struct for registering estimator
+  template<typename T>
+  struct EstimatorRegistrationHelper<DenseMeshTrackLengthFluxEstimator<T> >
+  {
+    static void registerEstimator(
+     EventHandler& event_handler,
+     const std::shared_ptr<DenseMeshTrackLengthFluxEstimator<T> >& estimator );
+  };
+
   // Add the estimator registration helper as a friend class
   template<typename T>
   friend class EstimatorRegistrationHelper;
@@ -378,11 +409,23 @@ private:
 
   // The observers
   ParticleHistoryObservers d_particle_history_observers;
+
+  // Enable thread-private moment accumulation in the added estimators
+  bool d_thread_private_moment_accumulation_mode_on;
+
+  // Records if the observer data has been captured for an archive
+  bool d_archive_snapshot_taken;
+
+  // The number of committed histories captured for an archive
+  uint64_t d_archived_number_of_committed_histories;
+
+  // The elapsed time captured for an archive
+  double d_archived_elapsed_time;
 };
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( EventHandler, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( EventHandler, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes
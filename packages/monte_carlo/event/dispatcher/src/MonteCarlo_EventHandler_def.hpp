@@ -25,7 +25,8 @@ namespace MonteCarlo{
 /*! \details The estimators will be registered with the appropriate 
  * dispatchers. It is important to pass a pointer to the class that maintains
  * the event tags associated with the observer (so that automatic dispatcher
- * registration can occur).
+ * registration can occur). If thread-private moment accumulation mode was
+ * set in the simulation properties it will be enabled in the estimator.
  */
 template<typename EstimatorType>
 void EventHandler::addEstimator( const std::shared_ptr<EstimatorType>& estimator )
@@ -48,6 +49,9 @@ void EventHandler::addEstimator( const std::shared_ptr<EstimatorType>& estimator
     
     EstimatorRegistrationHelper<EstimatorType>::registerEstimator( *this, estimator );
 
+    if( d_thread_private_moment_accumulation_mode_on )
+      estimator->enableThreadPrivateMomentAccumulation();
+
     // Add the estimator to the map
     d_estimators[estimator->getId()] = estimator;
     
@@ -91,6 +95,16 @@ void EventHandler::EstimatorRegistrationHelper<MeshTrackLengthFluxEstimator<T> >
   event_handler.registerGlobalObserver( estimator, particle_types );
 }
 
+template<typename T>
+void EventHandler::EstimatorRegistrationHelper<DenseMeshTrackLengthFluxEstimator<T> >::registerEstimator(
+      EventHandler& event_handler,
+      const std::shared_ptr<DenseMeshTrackLengthFluxEstimator<T> >& estimator )
+{
+  std::set<ParticleType> particle_types = estimator->getParticleTypes();
+
+  event_handler.registerGlobalObserver( estimator, particle_types );
+}
+
 // Register an observer with the appropriate dispatcher
 template<typename Observer, typename InputEntityId>
 void EventHandler::registerObserver( const std::shared_ptr<Observer>& observer,
@@ -286,17 +300,20 @@ void EventHandler::save( Archive& ar, const unsigned version ) const
   // Save the local data (ignore the model, snapshot counters)
   ar & BOOST_SERIALIZATION_NVP( d_simulation_completion_criterion );
 
-  uint64_t number_of_committed_histories =
+  uint64_t number_of_committed_histories = d_archive_snapshot_taken ?
+    d_archived_number_of_committed_histories :
     this->getNumberOfCommittedHistories();
   
   ar & BOOST_SERIALIZATION_NVP( number_of_committed_histories );
 
-  double elapsed_time = this->getElapsedTime();
+  double elapsed_time = d_archive_snapshot_taken ?
+    d_archived_elapsed_time : this->getElapsedTime();
   
   ar & BOOST_SERIALIZATION_NVP( elapsed_time );
   ar & BOOST_SERIALIZATION_NVP( d_estimators );
   ar & BOOST_SERIALIZATION_NVP( d_particle_trackers );
   ar & BOOST_SERIALIZATION_NVP( d_particle_history_observers );
+  ar & BOOST_SERIALIZATION_NVP( d_thread_private_moment_accumulation_mode_on );
 }
 
 // Load the data to an archive
@@ -341,6 +358,12 @@ void EventHandler::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_estimators );
   ar & BOOST_SERIALIZATION_NVP( d_particle_trackers );
   ar & BOOST_SERIALIZATION_NVP( d_particle_history_observers );
+
+  // The moment accumulation mode was added in version 1
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_thread_private_moment_accumulation_mode_on );
+  else
+    d_thread_private_moment_accumulation_mode_on = false;
 }
 
 } // end MonteCarlo namespace
@@ -19,15 +19,30 @@ void ParticleCollidingInCellEventDispatcher::dispatchParticleCollidingInCellEven
                              const Geometry::Model::EntityId cell_of_collision,
                              const double inverse_total_cross_section )
 {
-  DispatcherMap::iterator it =
-    this->getDispatcherMap().find( cell_of_collision );
-
-  if( it != this->getDispatcherMap().end() )
+  if( this->isFinalized() )
+  {
+    for( auto&& observer : this->getFinalizedObservers(
+                                                cell_of_collision,
+                                                particle.getParticleType() ) )
+    {
+      observer->updateFromParticleCollidingInCellEvent(
+                                               particle,
+                                               cell_of_collision,
+                                               inverse_total_cross_section );
+    }
+  }
+  else
   {
-    it->second->dispatchParticleCollidingInCellEvent(
-						 particle,
-						 cell_of_collision,
-						 inverse_total_cross_section );
+    DispatcherMap::iterator it =
+      this->getDispatcherMap().find( cell_of_collision );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleCollidingInCellEvent(
+                                                 particle,
+                                                 cell_of_collision,
+                                                 inverse_total_cross_section );
+    }
   }
 }
 
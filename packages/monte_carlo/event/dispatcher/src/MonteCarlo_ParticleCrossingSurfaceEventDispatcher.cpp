@@ -19,13 +19,28 @@ void ParticleCrossingSurfaceEventDispatcher::dispatchParticleCrossingSurfaceEven
                               const Geometry::Model::EntityId surface_crossing,
                               const double angle_cosine )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( surface_crossing );
-
-  if( it != this->getDispatcherMap().end() )
+  if( this->isFinalized() )
+  {
+    for( auto&& observer : this->getFinalizedObservers(
+                                                surface_crossing,
+                                                particle.getParticleType() ) )
+    {
+      observer->updateFromParticleCrossingSurfaceEvent( particle,
+                                                        surface_crossing,
+                                                        angle_cosine );
+    }
+  }
+  else
   {
-    it->second->dispatchParticleCrossingSurfaceEvent( particle,
-						      surface_crossing,
-						      angle_cosine );
+    DispatcherMap::iterator it =
+      this->getDispatcherMap().find( surface_crossing );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleCrossingSurfaceEvent( particle,
+                                                        surface_crossing,
+                                                        angle_cosine );
+    }
   }
 }
 
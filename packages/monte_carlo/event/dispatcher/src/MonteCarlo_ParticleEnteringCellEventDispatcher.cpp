@@ -18,10 +18,20 @@ void ParticleEnteringCellEventDispatcher::dispatchParticleEnteringCellEvent(
                                 const ParticleState& particle,
                                 const Geometry::Model::EntityId cell_entering )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( cell_entering );
+  if( this->isFinalized() )
+  {
+    for( auto&& observer : this->getFinalizedObservers(
+                                                cell_entering,
+                                                particle.getParticleType() ) )
+      observer->updateFromParticleEnteringCellEvent( particle, cell_entering );
+  }
+  else
+  {
+    DispatcherMap::iterator it = this->getDispatcherMap().find( cell_entering );
 
-  if( it != this->getDispatcherMap().end() )
-    it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
+    if( it != this->getDispatcherMap().end() )
+      it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
+  }
 }
   
 } // end MonteCarlo namespace
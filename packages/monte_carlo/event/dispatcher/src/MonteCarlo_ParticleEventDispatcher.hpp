@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -23,10 +24,20 @@
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_Map.hpp"
+#include "Utility_ArrayView.hpp"
 
 namespace MonteCarlo{
 
-//! The particle event dispatcher database base class
+/*! The particle event dispatcher database base class
+ * \details Before a simulation starts the dispatcher can be finalized, which
+ * compiles the observers attached to every local dispatcher into flat
+ * dispatch tables. The observers of an entity id and particle type are stored
+ * contiguously as raw pointers and the entity id is converted to a table row
+ * with a direct lookup when the entity ids are dense enough (a binary search
+ * over the sorted entity ids is used otherwise). Events in entities with no
+ * attached observers are rejected without any map lookups. Attaching or
+ * detaching an observer automatically restores the unfinalized state.
+ */
 template<typename Dispatcher>
 class ParticleEventDispatcher
 {
@@ -64,8 +75,21 @@ public:
   //! Detach all observers
   void detachAllObservers();
 
+  //! Check if any observers have been attached for a particle type
+  bool hasObservers( const ParticleType particle_type ) const;
+
+  //! Compile the attached observers into flat dispatch tables
+  void finalize();
+
+  //! Check if the dispatcher has been finalized
+  bool isFinalized() const;
+
 protected:
 
+  //! The finalized observer array view
+  typedef Utility::ArrayView<typename Dispatcher::ObserverType* const>
+  FinalizedObserverArrayView;
+
   // Typedef for the dispatcher map
   typedef typename std::unordered_map<uint64_t,std::unique_ptr<Dispatcher> >
   DispatcherMap;
@@ -73,8 +97,22 @@ protected:
   //! Get the dispatcher map
   DispatcherMap& getDispatcherMap();
 
+  //! Get the finalized observers of an entity for a particle type
+  FinalizedObserverArrayView getFinalizedObservers(
+                                   const uint64_t entity_id,
+                                   const ParticleType particle_type ) const;
+
 private:
 
+  // The max entity id that will be used with a direct lookup table
+  static const uint64_t s_max_dense_entity_id = 1000000;
+
+  // Clear the flat dispatch tables
+  void clearFinalizedTables();
+
+  // Return the flat dispatch table row of an entity (-1 if none)
+  long getFinalizedTableRow( const uint64_t entity_id ) const;
+
   // Serialize the observer
   template<typename Archive>
   void serialize( Archive& ar, const unsigned version );
@@ -82,7 +120,23 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
+  // The dispatcher map
   DispatcherMap d_dispatcher_map;
+
+  // Records if the flat dispatch tables have been compiled
+  bool d_finalized;
+
+  // The sorted entity ids (one per flat dispatch table row)
+  std::vector<uint64_t> d_finalized_entity_ids;
+
+  // The direct entity id to flat dispatch table row lookup (row+1, 0 if none)
+  std::vector<unsigned> d_finalized_dense_entity_rows;
+
+  // The offsets of the observers of each table row and particle type
+  std::vector<unsigned> d_finalized_observer_offsets;
+
+  // The contiguous observers of each table row and particle type
+  std::vector<typename Dispatcher::ObserverType*> d_finalized_observers;
 };
 
 } // end MonteCarlo namespace
@@ -9,19 +9,38 @@
 #ifndef MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 #define MONTE_CARLO_PARTICLE_EVENT_DISPATCHER_DEF_HPP
 
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
 namespace MonteCarlo{
 
 // Constructor
 template<typename Dispatcher>
 ParticleEventDispatcher<Dispatcher>::ParticleEventDispatcher()
-  : d_dispatcher_map()
+  : d_dispatcher_map(),
+    d_finalized( false ),
+    d_finalized_entity_ids(),
+    d_finalized_dense_entity_rows(),
+    d_finalized_observer_offsets(),
+    d_finalized_observers()
 { /* ... */ }
 
+// Initialize static member data
+template<typename Dispatcher>
+const uint64_t ParticleEventDispatcher<Dispatcher>::s_max_dense_entity_id;
+
 // Get the appropriate local dispatcher for the given entity id
 template<typename Dispatcher>
 inline Dispatcher& ParticleEventDispatcher<Dispatcher>::getLocalDispatcher(
                                                      const uint64_t entity_id )
 {
+  // The local dispatcher may be modified by the caller
+  if( d_finalized )
+    this->clearFinalizedTables();
+
   typename DispatcherMap::iterator it = d_dispatcher_map.find( entity_id );
 
   if( it != d_dispatcher_map.end() )
@@ -71,6 +90,9 @@ template<typename Dispatcher>
 inline void ParticleEventDispatcher<Dispatcher>::detachObserver(
            const std::shared_ptr<typename Dispatcher::ObserverType>& observer )
 {
+  if( d_finalized )
+    this->clearFinalizedTables();
+
   typename DispatcherMap::iterator it = d_dispatcher_map.begin();
 
   while( it != d_dispatcher_map.end() )
@@ -86,6 +108,153 @@ template<typename Dispatcher>
 void ParticleEventDispatcher<Dispatcher>::detachAllObservers()
 {
   d_dispatcher_map.clear();
+
+  this->clearFinalizedTables();
+}
+
+// Check if any observers have been attached for a particle type
+template<typename Dispatcher>
+bool ParticleEventDispatcher<Dispatcher>::hasObservers(
+                                       const ParticleType particle_type ) const
+{
+  for( auto&& dispatcher : d_dispatcher_map )
+  {
+    if( dispatcher.second->getNumberOfObservers( particle_type ) > 0 )
+      return true;
+  }
+
+  return false;
+}
+
+// Compile the attached observers into flat dispatch tables
+/*! \details The flat dispatch tables store raw observer pointers. The
+ * observers are kept alive by the local dispatchers, which cannot be
+ * modified without first clearing the flat dispatch tables.
+ */
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::finalize()
+{
+  this->clearFinalizedTables();
+
+  const size_t number_of_particle_types = ParticleType_END - ParticleType_START;
+
+  // Only entities with attached observers are given a table row
+  for( auto&& dispatcher : d_dispatcher_map )
+  {
+    for( int i = ParticleType_START; i < ParticleType_END; ++i )
+    {
+      if( dispatcher.second->getNumberOfObservers( (ParticleType)i ) > 0 )
+      {
+        d_finalized_entity_ids.push_back( dispatcher.first );
+
+        break;
+      }
+    }
+  }
+
+  std::sort( d_finalized_entity_ids.begin(), d_finalized_entity_ids.end() );
+
+  d_finalized_observer_offsets.reserve(
+                  d_finalized_entity_ids.size()*number_of_particle_types + 1 );
+  d_finalized_observer_offsets.push_back( 0 );
+
+  for( auto&& entity_id : d_finalized_entity_ids )
+  {
+    const Dispatcher& dispatcher = *d_dispatcher_map.find( entity_id )->second;
+
+    for( int i = ParticleType_START; i < ParticleType_END; ++i )
+    {
+      dispatcher.appendObservers( (ParticleType)i, d_finalized_observers );
+
+      d_finalized_observer_offsets.push_back( d_finalized_observers.size() );
+    }
+  }
+
+  // Use a direct lookup table when the entity ids are dense enough
+  if( !d_finalized_entity_ids.empty() &&
+      d_finalized_entity_ids.back() <= s_max_dense_entity_id )
+  {
+    d_finalized_dense_entity_rows.resize( d_finalized_entity_ids.back()+1, 0 );
+
+    for( size_t i = 0; i < d_finalized_entity_ids.size(); ++i )
+      d_finalized_dense_entity_rows[d_finalized_entity_ids[i]] = i+1;
+  }
+
+  d_finalized = true;
+}
+
+// Check if the dispatcher has been finalized
+template<typename Dispatcher>
+inline bool ParticleEventDispatcher<Dispatcher>::isFinalized() const
+{
+  return d_finalized;
+}
+
+// Get the finalized observers of an entity for a particle type
+template<typename Dispatcher>
+inline auto ParticleEventDispatcher<Dispatcher>::getFinalizedObservers(
+                                      const uint64_t entity_id,
+                                      const ParticleType particle_type ) const
+  -> FinalizedObserverArrayView
+{
+  // Make sure that the dispatcher has been finalized
+  testPrecondition( d_finalized );
+
+  const long row = this->getFinalizedTableRow( entity_id );
+
+  if( row < 0 )
+    return FinalizedObserverArrayView();
+  else
+  {
+    const size_t offset_index =
+      row*(ParticleType_END - ParticleType_START) +
+      (particle_type - ParticleType_START);
+
+    return FinalizedObserverArrayView(
+          d_finalized_observers.data() +
+          d_finalized_observer_offsets[offset_index],
+          d_finalized_observers.data() +
+          d_finalized_observer_offsets[offset_index+1] );
+  }
+}
+
+// Return the flat dispatch table row of an entity (-1 if none)
+template<typename Dispatcher>
+inline long ParticleEventDispatcher<Dispatcher>::getFinalizedTableRow(
+                                               const uint64_t entity_id ) const
+{
+  if( !d_finalized_dense_entity_rows.empty() )
+  {
+    if( entity_id < d_finalized_dense_entity_rows.size() )
+      return (long)d_finalized_dense_entity_rows[entity_id] - 1;
+    else
+      return -1;
+  }
+  else
+  {
+    std::vector<uint64_t>::const_iterator entity_id_it =
+      std::lower_bound( d_finalized_entity_ids.begin(),
+                        d_finalized_entity_ids.end(),
+                        entity_id );
+
+    if( entity_id_it != d_finalized_entity_ids.end() &&
+        *entity_id_it == entity_id )
+      return entity_id_it - d_finalized_entity_ids.begin();
+    else
+      return -1;
+  }
+}
+
+// Clear the flat dispatch tables
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::clearFinalizedTables()
+{
+  d_finalized = false;
+
+  d_finalized_entity_ids.clear();
+  d_finalized_dense_entity_rows.clear();
+  d_finalized_observer_offsets.clear();
+  d_finalized_observers.clear();
 }
 
 // Get the dispatcher map
@@ -101,6 +270,10 @@ template<typename Archive>
 void ParticleEventDispatcher<Dispatcher>::serialize( Archive& ar, const unsigned version )
 {
   ar & BOOST_SERIALIZATION_NVP( d_dispatcher_map );
+
+  // The flat dispatch tables store raw pointers - they must be recompiled
+  if( Archive::is_loading::value )
+    this->clearFinalizedTables();
 }
 
 } // end MonteCarlo namespace
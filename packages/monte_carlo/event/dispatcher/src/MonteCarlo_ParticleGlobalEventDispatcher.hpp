@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -24,10 +25,16 @@
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_Map.hpp"
+#include "Utility_ArrayView.hpp"
 
 namespace MonteCarlo{
 
-//! The particle global event dispatcher base class
+/*! The particle global event dispatcher base class
+ * \details Before a simulation starts the dispatcher can be finalized, which
+ * compiles the attached observers of each particle type into a flat array of
+ * raw observer pointers. Attaching or detaching an observer automatically
+ * restores the unfinalized state.
+ */
 template<typename Observer>
 class ParticleGlobalEventDispatcher
 {
@@ -60,8 +67,17 @@ public:
   //! Get the number of attached observers
   size_t getNumberOfObservers( const ParticleType particle_type ) const;
 
+  //! Compile the attached observers into flat dispatch tables
+  void finalize();
+
+  //! Check if the dispatcher has been finalized
+  bool isFinalized() const;
+
 protected:
 
+  //! The finalized observer array view
+  typedef Utility::ArrayView<Observer* const> FinalizedObserverArrayView;
+
   // The observer map
   typedef typename std::set<std::shared_ptr<Observer> > ObserverSet;
 
@@ -71,8 +87,15 @@ protected:
   // Get the oberver map
   ObserverSet& getObserverSet( const ParticleType particle_type );
 
+  //! Get the finalized observers for a particle type
+  FinalizedObserverArrayView getFinalizedObservers(
+                                   const ParticleType particle_type ) const;
+
 private:
 
+  // Clear the flat dispatch tables
+  void clearFinalizedTables();
+
   // Serialize the observer
   template<typename Archive>
   void serialize( Archive& ar, const unsigned version );
@@ -80,7 +103,17 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
+  // The particle type observer sets
   std::map<int,ObserverSet> d_observer_sets;
+
+  // Records if the flat dispatch tables have been compiled
+  bool d_finalized;
+
+  // The offsets of the observers of each particle type
+  std::vector<unsigned> d_finalized_observer_offsets;
+
+  // The contiguous observers of each particle type
+  std::vector<Observer*> d_finalized_observers;
 };
 
 } // end MonteCarlo namespace
@@ -17,7 +17,10 @@ namespace MonteCarlo{
 // Constructor
 template<typename Observer>
 ParticleGlobalEventDispatcher<Observer>::ParticleGlobalEventDispatcher()
-  : d_observer_sets()
+  : d_observer_sets(),
+    d_finalized( false ),
+    d_finalized_observer_offsets(),
+    d_finalized_observers()
 { /* ... */ }
 
 // Attach an observer to the dispatcher
@@ -26,6 +29,8 @@ void ParticleGlobalEventDispatcher<Observer>::attachObserver(
                                   const std::set<ParticleType>& particle_types,
                                   const std::shared_ptr<Observer>& observer )
 {
+  this->clearFinalizedTables();
+
   for( auto&& particle_type : particle_types )
     d_observer_sets[particle_type].insert( observer );
 }
@@ -35,6 +40,8 @@ template<typename Observer>
 void ParticleGlobalEventDispatcher<Observer>::attachObserver(
                                     const std::shared_ptr<Observer>& observer )
 {
+  this->clearFinalizedTables();
+
   for( int i = ParticleType_START; i < ParticleType_END; ++i )
     d_observer_sets[i].insert( observer );
 }
@@ -44,6 +51,8 @@ template<typename Observer>
 void ParticleGlobalEventDispatcher<Observer>::detachObserver(
                                     const std::shared_ptr<Observer>& observer )
 {
+  this->clearFinalizedTables();
+
   typename std::map<int,ObserverSet>::iterator particle_observer_sets_it =
     d_observer_sets.begin();
 
@@ -74,6 +83,72 @@ template<typename Observer>
 void ParticleGlobalEventDispatcher<Observer>::detachAllObservers()
 {
   d_observer_sets.clear();
+
+  this->clearFinalizedTables();
+}
+
+// Compile the attached observers into flat dispatch tables
+/*! \details The flat dispatch tables store raw observer pointers. The
+ * observers are kept alive by the observer sets, which cannot be modified
+ * without first clearing the flat dispatch tables.
+ */
+template<typename Observer>
+void ParticleGlobalEventDispatcher<Observer>::finalize()
+{
+  this->clearFinalizedTables();
+
+  d_finalized_observer_offsets.push_back( 0 );
+
+  for( int i = ParticleType_START; i < ParticleType_END; ++i )
+  {
+    typename std::map<int,ObserverSet>::const_iterator
+      particle_observer_sets_it = d_observer_sets.find( i );
+
+    if( particle_observer_sets_it != d_observer_sets.end() )
+    {
+      for( auto&& observer : particle_observer_sets_it->second )
+        d_finalized_observers.push_back( observer.get() );
+    }
+
+    d_finalized_observer_offsets.push_back( d_finalized_observers.size() );
+  }
+
+  d_finalized = true;
+}
+
+// Check if the dispatcher has been finalized
+template<typename Observer>
+inline bool ParticleGlobalEventDispatcher<Observer>::isFinalized() const
+{
+  return d_finalized;
+}
+
+// Get the finalized observers for a particle type
+template<typename Observer>
+inline auto ParticleGlobalEventDispatcher<Observer>::getFinalizedObservers(
+                                      const ParticleType particle_type ) const
+  -> FinalizedObserverArrayView
+{
+  // Make sure that the dispatcher has been finalized
+  testPrecondition( d_finalized );
+
+  const size_t offset_index = particle_type - ParticleType_START;
+
+  return FinalizedObserverArrayView(
+          d_finalized_observers.data() +
+          d_finalized_observer_offsets[offset_index],
+          d_finalized_observers.data() +
+          d_finalized_observer_offsets[offset_index+1] );
+}
+
+// Clear the flat dispatch tables
+template<typename Observer>
+void ParticleGlobalEventDispatcher<Observer>::clearFinalizedTables()
+{
+  d_finalized = false;
+
+  d_finalized_observer_offsets.clear();
+  d_finalized_observers.clear();
 }
 
 // Check if there is an observer set for the particle type
@@ -89,6 +164,10 @@ template<typename Observer>
 inline auto ParticleGlobalEventDispatcher<Observer>::getObserverSet(
                              const ParticleType particle_type ) -> ObserverSet&
 {
+  // The observer set may be modified by the caller
+  if( d_finalized )
+    this->clearFinalizedTables();
+
   return d_observer_sets[particle_type];
 }
 
@@ -98,6 +177,10 @@ template<typename Archive>
 void ParticleGlobalEventDispatcher<Observer>::serialize( Archive& ar, const unsigned version )
 {
   ar & BOOST_SERIALIZATION_NVP( d_observer_sets );
+
+  // The flat dispatch tables store raw pointers - they must be recompiled
+  if( Archive::is_loading::value )
+    this->clearFinalizedTables();
 }
 
 } // end MonteCarlo namespace
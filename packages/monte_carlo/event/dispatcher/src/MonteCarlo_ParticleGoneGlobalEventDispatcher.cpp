@@ -17,7 +17,13 @@ namespace MonteCarlo{
 void ParticleGoneGlobalEventDispatcher::dispatchParticleGoneGlobalEvent(
                                                 const ParticleState& particle )
 {
-  if( this->hasObserverSet( particle.getParticleType() ) )
+  if( this->isFinalized() )
+  {
+    for( auto&& observer :
+           this->getFinalizedObservers( particle.getParticleType() ) )
+      observer->updateFromGlobalParticleGoneEvent( particle );
+  }
+  else if( this->hasObserverSet( particle.getParticleType() ) )
   {
     ObserverSet& observer_set =
       this->getObserverSet( particle.getParticleType() );
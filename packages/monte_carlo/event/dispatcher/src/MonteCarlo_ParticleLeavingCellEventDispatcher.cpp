@@ -18,10 +18,20 @@ void ParticleLeavingCellEventDispatcher::dispatchParticleLeavingCellEvent(
                                  const ParticleState& particle,
 	                         const Geometry::Model::EntityId cell_leaving )
 {
-  DispatcherMap::iterator it = this->getDispatcherMap().find( cell_leaving );
+  if( this->isFinalized() )
+  {
+    for( auto&& observer : this->getFinalizedObservers(
+                                                cell_leaving,
+                                                particle.getParticleType() ) )
+      observer->updateFromParticleLeavingCellEvent( particle, cell_leaving );
+  }
+  else
+  {
+    DispatcherMap::iterator it = this->getDispatcherMap().find( cell_leaving );
 
-  if( it != this->getDispatcherMap().end() )
-    it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+    if( it != this->getDispatcherMap().end() )
+      it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+  }
 }
   
 } // end MonteCarlo namespace
@@ -19,7 +19,17 @@ void ParticleSubtrackEndingGlobalEventDispatcher::dispatchParticleSubtrackEnding
 						 const double start_point[3],
 						 const double end_point[3] )
 {
-  if( this->hasObserverSet( particle.getParticleType() ) )
+  if( this->isFinalized() )
+  {
+    for( auto&& observer :
+           this->getFinalizedObservers( particle.getParticleType() ) )
+    {
+      observer->updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                             start_point,
+                                                             end_point );
+    }
+  }
+  else if( this->hasObserverSet( particle.getParticleType() ) )
   {
     ObserverSet& observer_set =
       this->getObserverSet( particle.getParticleType() );
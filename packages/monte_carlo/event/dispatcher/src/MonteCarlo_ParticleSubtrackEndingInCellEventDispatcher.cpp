@@ -19,14 +19,28 @@ void ParticleSubtrackEndingInCellEventDispatcher::dispatchParticleSubtrackEnding
                               const Geometry::Model::EntityId cell_of_subtrack,
                               const double track_length )
 {
-  DispatcherMap::iterator it =
-    this->getDispatcherMap().find( cell_of_subtrack );
-
-  if( it != this->getDispatcherMap().end() )
+  if( this->isFinalized() )
+  {
+    for( auto&& observer : this->getFinalizedObservers(
+                                                cell_of_subtrack,
+                                                particle.getParticleType() ) )
+    {
+      observer->updateFromParticleSubtrackEndingInCellEvent( particle,
+                                                             cell_of_subtrack,
+                                                             track_length );
+    }
+  }
+  else
   {
-    it->second->dispatchParticleSubtrackEndingInCellEvent( particle,
-							   cell_of_subtrack,
-							   track_length );
+    DispatcherMap::iterator it =
+      this->getDispatcherMap().find( cell_of_subtrack );
+
+    if( it != this->getDispatcherMap().end() )
+    {
+      it->second->dispatchParticleSubtrackEndingInCellEvent( particle,
+                                                             cell_of_subtrack,
+                                                             track_length );
+    }
   }
 }
 
@@ -337,6 +337,45 @@ FRENSIE_UNIT_TEST( EventHandler, addEstimator )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the moment accumulation mode set in the properties will be used
+// by the added estimators
+FRENSIE_UNIT_TEST( EventHandler, addEstimator_thread_private_moments )
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    local_estimator_1( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                      100, 1.0, {1}, {1.0} ) );
+
+  local_estimator_1->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+    local_estimator_2( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                      101, 1.0, {1}, {1.0} ) );
+
+  local_estimator_2->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  {
+    MonteCarlo::SimulationGeneralProperties properties;
+
+    MonteCarlo::EventHandler event_handler( properties );
+
+    event_handler.addEstimator( local_estimator_1 );
+
+    FRENSIE_CHECK( !local_estimator_1->isThreadPrivateMomentAccumulationEnabled() );
+  }
+
+  {
+    MonteCarlo::SimulationGeneralProperties properties;
+    properties.setThreadPrivateMomentAccumulationModeOn();
+
+    MonteCarlo::EventHandler event_handler( properties );
+
+    event_handler.addEstimator( local_estimator_2 );
+
+    FRENSIE_CHECK( local_estimator_2->isThreadPrivateMomentAccumulationEnabled() );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that estimators can be added when a model has been assigned
 FRENSIE_UNIT_TEST( EventHandler, addEstimator_model_set )
@@ -3413,6 +3452,97 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( EventHandler, archive, TestArchives )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the captured observer data is archived until it is released
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( EventHandler, archive_snapshot, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_event_handler_snapshot" );
+  std::ostringstream archive_ostream;
+
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  if( comm->rank() == 0 )
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::EventHandler event_handler;
+
+    event_handler.setSimulationCompletionCriterion( MonteCarlo::ParticleHistorySimulationCompletionCriterion::createHistoryCountCriterion( 2 ) );
+
+    std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+      local_estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                              200, 1.0, {1, 2}, {1.0, 1.0} ) );
+
+    local_estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+    event_handler.addEstimator( local_estimator );
+
+    event_handler.updateObserversFromParticleSimulationStartedEvent();
+
+    std::shared_ptr<const Geometry::Model>
+      local_model( new Geometry::InfiniteMediumModel( 1 ) );
+
+    MonteCarlo::PhotonState photon( 0 );
+    photon.setWeight( 1.0 );
+    photon.setEnergy( 2.0 );
+    photon.setDirection( 1.0, 0.0, 0.0 );
+    photon.embedInModel( local_model );
+
+    event_handler.updateObserversFromParticleCollidingInCellEvent( photon, 1.0 );
+    event_handler.commitObserverHistoryContributions();
+
+    event_handler.takeArchiveSnapshot();
+
+    // This history must not be archived
+    event_handler.updateObserversFromParticleCollidingInCellEvent( photon, 1.0 );
+    event_handler.commitObserverHistoryContributions();
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( event_handler ) );
+
+    event_handler.releaseArchiveSnapshot();
+
+    event_handler.updateObserversFromParticleSimulationStoppedEvent();
+
+    FRENSIE_CHECK_EQUAL( event_handler.getNumberOfCommittedHistories(), 2 );
+  }
+
+  if( comm->rank() == 0 )
+  {
+    // Copy the archive ostream to an istream
+    std::istringstream archive_istream( archive_ostream.str() );
+
+    // Load the archived event handler
+    std::unique_ptr<IArchive> iarchive;
+
+    createIArchive( archive_istream, iarchive );
+
+    MonteCarlo::EventHandler event_handler;
+
+    FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( event_handler ) );
+
+    iarchive.reset();
+
+    FRENSIE_CHECK_EQUAL( event_handler.getNumberOfCommittedHistories(), 1 );
+    FRENSIE_CHECK( !event_handler.isSimulationComplete() );
+
+    Utility::ArrayView<const double> first_moments, second_moments;
+    first_moments = event_handler.getEstimator( 200 ).getEntityBinDataFirstMoments( 1 );
+    second_moments = event_handler.getEstimator( 200 ).getEntityBinDataSecondMoments( 1 );
+
+    FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( {1.0} ) );
+    FRENSIE_CHECK_EQUAL( second_moments, std::vector<double>( {1.0} ) );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
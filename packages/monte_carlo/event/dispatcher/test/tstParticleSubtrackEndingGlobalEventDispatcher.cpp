@@ -72,6 +72,68 @@ FRENSIE_UNIT_TEST( ParticleSubtrackEndingGlobalEventDispatcher,
   FRENSIE_CHECK_EQUAL( dispatcher->getNumberOfObservers( MonteCarlo::NEUTRON ), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the dispatcher can be finalized
+FRENSIE_UNIT_TEST( ParticleSubtrackEndingGlobalEventDispatcher, finalize )
+{
+  std::shared_ptr<MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleSubtrackEndingGlobalEventDispatcher );
+
+  dispatcher->attachObserver( {MonteCarlo::PHOTON}, tracker );
+
+  FRENSIE_CHECK( !dispatcher->isFinalized() );
+
+  dispatcher->finalize();
+
+  FRENSIE_CHECK( dispatcher->isFinalized() );
+
+  double start_point[3] = { 1.0, 1.0, 1.0 };
+  double end_point[3] = { 2.0, 1.0, 1.0 };
+
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setPosition( 2.0, 1.0, 1.0 );
+  electron.setDirection( 1.0, 0.0, 0.0 );
+  electron.setEnergy( 2.5 );
+  electron.setWeight( 1.0 );
+
+  dispatcher->dispatchParticleSubtrackEndingGlobalEvent( electron,
+                                                         start_point,
+                                                         end_point );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setPosition( 2.0, 1.0, 1.0 );
+  photon.setDirection( 1.0, 0.0, 0.0 );
+  photon.setEnergy( 2.5 );
+  photon.setWeight( 1.0 );
+
+  dispatcher->dispatchParticleSubtrackEndingGlobalEvent( photon,
+                                                         start_point,
+                                                         end_point );
+
+  photon.setAsGone();
+
+  tracker->updateFromGlobalParticleGoneEvent( photon );
+
+  MonteCarlo::ParticleTracker::OverallHistoryMap history_map;
+
+  tracker->getHistoryData( history_map );
+
+  // Only the photon subtrack should have been dispatched
+  FRENSIE_REQUIRE( history_map.find( 0 ) != history_map.end() );
+  FRENSIE_CHECK( history_map[0].find( MonteCarlo::PHOTON ) !=
+                 history_map[0].end() );
+  FRENSIE_CHECK( history_map[0].find( MonteCarlo::ELECTRON ) ==
+                 history_map[0].end() );
+
+  // Modifying the observers must restore the unfinalized state
+  dispatcher->detachObserver( tracker );
+
+  FRENSIE_CHECK( !dispatcher->isFinalized() );
+  FRENSIE_CHECK_EQUAL( tracker.use_count(), 1 );
+
+  tracker->resetData();
+}
+
 //---------------------------------------------------------------------------//
 // Check that the dispatcher can update from the global ending event
 FRENSIE_UNIT_TEST( ParticleSubtrackEndingGlobalEventDispatcher,
@@ -94,6 +94,9 @@ FRENSIE_UNIT_TEST( ParticleSubtrackEndingInCellEventDispatcher, manage_observers
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 1 ).getNumberOfObservers( MonteCarlo::ELECTRON ), 0 );
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 1 ).getNumberOfObservers( MonteCarlo::POSITRON ), 0 );
   FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcher( 1 ).getNumberOfObservers( MonteCarlo::NEUTRON ), 0 );
+  FRENSIE_CHECK( dispatcher->hasObservers( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !dispatcher->hasObservers( MonteCarlo::ELECTRON ) );
+  FRENSIE_CHECK( !dispatcher->hasObservers( MonteCarlo::NEUTRON ) );
 
   dispatcher->attachObserver( 0, estimator_1 );
   dispatcher->attachObserver( 1, estimator_1 );
@@ -297,6 +300,100 @@ FRENSIE_UNIT_TEST( ParticleSubtrackEndingInCellEventDispatcher,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a particle subtrack ending in cell event can be dispatched after
+// the dispatcher has been finalized
+FRENSIE_UNIT_TEST( ParticleSubtrackEndingInCellEventDispatcher,
+                   dispatchParticleSubtrackEndingInCellEvent_finalized )
+{
+  estimator_1->resetData();
+  estimator_2->resetData();
+  estimator_3->resetData();
+
+  std::shared_ptr<MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher );
+
+  dispatcher->attachObserver( 0, estimator_1->getParticleTypes(), estimator_1 );
+  dispatcher->attachObserver( 0, estimator_2->getParticleTypes(), estimator_2 );
+  dispatcher->attachObserver( 0, estimator_3->getParticleTypes(), estimator_3 );
+
+  // Cells with no observers should not be added to the dispatch tables
+  dispatcher->getLocalDispatcher( 1 );
+
+  FRENSIE_CHECK( !dispatcher->isFinalized() );
+
+  dispatcher->finalize();
+
+  FRENSIE_CHECK( dispatcher->isFinalized() );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 1.0 );
+
+  dispatcher->dispatchParticleSubtrackEndingInCellEvent( photon, 1, 1.0 );
+  dispatcher->dispatchParticleSubtrackEndingInCellEvent( photon, 2, 1.0 );
+
+  FRENSIE_CHECK( !estimator_1->hasUncommittedHistoryContribution() );
+  FRENSIE_CHECK( !estimator_2->hasUncommittedHistoryContribution() );
+  FRENSIE_CHECK( !estimator_3->hasUncommittedHistoryContribution() );
+
+  dispatcher->dispatchParticleSubtrackEndingInCellEvent( photon, 0, 1.0 );
+
+  FRENSIE_CHECK( estimator_1->hasUncommittedHistoryContribution() );
+  FRENSIE_CHECK( !estimator_2->hasUncommittedHistoryContribution() );
+  FRENSIE_CHECK( !estimator_3->hasUncommittedHistoryContribution() );
+
+  MonteCarlo::ElectronState electron( 0ull );
+  electron.setWeight( 1.0 );
+  electron.setEnergy( 1.0 );
+
+  dispatcher->dispatchParticleSubtrackEndingInCellEvent( electron, 0, 1.0 );
+
+  FRENSIE_CHECK( estimator_2->hasUncommittedHistoryContribution() );
+  FRENSIE_CHECK( estimator_3->hasUncommittedHistoryContribution() );
+
+  estimator_1->commitHistoryContribution();
+  estimator_2->commitHistoryContribution();
+  estimator_3->commitHistoryContribution();
+
+  Utility::ArrayView<const double> first_moments =
+    estimator_1->getEntityBinDataFirstMoments( 0 );
+
+  FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( {1.0} ) );
+
+  first_moments = estimator_1->getEntityBinDataFirstMoments( 1 );
+
+  FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( {0.0} ) );
+
+  first_moments = estimator_2->getEntityBinDataFirstMoments( 0 );
+
+  FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( {1.0} ) );
+
+  first_moments = estimator_3->getEntityBinDataFirstMoments( 0 );
+
+  FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( {-1.0} ) );
+
+  // Modifying the observers must restore the unfinalized state
+  dispatcher->attachObserver( 1, estimator_1->getParticleTypes(), estimator_1 );
+
+  FRENSIE_CHECK( !dispatcher->isFinalized() );
+
+  dispatcher->finalize();
+  dispatcher->detachObserver( estimator_1 );
+
+  FRENSIE_CHECK( !dispatcher->isFinalized() );
+
+  dispatcher->finalize();
+  dispatcher->detachAllObservers();
+
+  FRENSIE_CHECK( !dispatcher->isFinalized() );
+  FRENSIE_CHECK_EQUAL( estimator_1.use_count(), 1 );
+
+  estimator_1->resetData();
+  estimator_2->resetData();
+  estimator_3->resetData();
+}
+
 //---------------------------------------------------------------------------//
 // Check that an event dispatcher can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleSubtrackEndingInCellEventDispatcher,
@@ -136,7 +136,7 @@ private:
                                               WeightAndChargeMultiplier );
 
   // Add info to update tracker
-  void addInfoToUpdateTracker( const unsigned thread_id,
+  void addInfoToUpdateTracker( const unsigned slot_index,
                                const CellIdType cell_id,
                                const double source_weight,
                                const double energy_contribution,
@@ -144,12 +144,12 @@ private:
 
   // Get the entity iterators from the update tracker
   void getCellIteratorFromUpdateTracker(
-                const unsigned thread_id,
+                const unsigned slot_index,
                 typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& start_cell,
                 typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& end_cell ) const;
 
   // Reset the update tracker
-  void resetUpdateTracker( const unsigned thread_id );
+  void resetUpdateTracker( const unsigned slot_index );
 
   // Save the data to an archive
   template<typename Archive>
@@ -164,7 +164,7 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
-  // The entities that have been updated
+  // The entities that have been updated (for each history contribution slot)
   ParallelUpdateTracker d_update_tracker;
 
   // The generic particle state map (avoids having to make a new map for cont.)
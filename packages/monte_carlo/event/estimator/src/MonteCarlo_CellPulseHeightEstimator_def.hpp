@@ -104,7 +104,7 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
   // Make sure that the particle type is assigned
   testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
 
-  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+  unsigned slot_index = this->getHistoryContributionSlotIndex();
 
   double energy_contribution = particle.getWeight()*particle.getEnergy();
 
@@ -112,14 +112,14 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 
   double charge_contribution = particle.getWeight()*particle.getCharge();
 
-  this->addInfoToUpdateTracker( thread_id,
+  this->addInfoToUpdateTracker( slot_index,
                                 cell_entering,
                                 particle.getSourceWeight(),
                                 energy_contribution,
                                 charge_contribution );
 
   // Indicate that there is an uncommitted history contribution
-  this->setHasUncommittedHistoryContribution( thread_id );
+  this->setHasUncommittedHistoryContribution( slot_index );
 }
 
 // Add current history estimator contribution
@@ -135,7 +135,7 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 {
   // Make sure that the particle type is assigned
   testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
-  unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+  unsigned slot_index = this->getHistoryContributionSlotIndex();
 
   double energy_contribution = particle.getWeight()*particle.getEnergy();
 
@@ -145,14 +145,14 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 
   double charge_contribution = -particle.getWeight()*particle.getCharge();
 
-  this->addInfoToUpdateTracker( thread_id,
+  this->addInfoToUpdateTracker( slot_index,
                                 cell_leaving,
                                 particle.getSourceWeight(),
                                 energy_contribution,
                                 charge_contribution );
 
   // Indicate that there is an uncommitted history contribution
-  this->setHasUncommittedHistoryContribution( thread_id );
+  this->setHasUncommittedHistoryContribution( slot_index );
 }
 
 // Add estimator contribution from a portion of the current history
@@ -161,14 +161,17 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContri
 {
   unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
+  // The history contribution slot of the history that is being committed
+  unsigned slot_index = this->getHistoryContributionSlotIndex();
+
   typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator
     cell_data, end_cell_data;
 
-  this->getCellIteratorFromUpdateTracker( thread_id, cell_data, end_cell_data );
+  this->getCellIteratorFromUpdateTracker( slot_index, cell_data, end_cell_data );
 
   double energy_deposition_in_all_cells = 0.0;
   double charge_deposition_in_all_cells = 0.0;
-  double source_weight = d_update_tracker[thread_id].first;
+  double source_weight = d_update_tracker[slot_index].first;
 
   size_t bin_index;
   double bin_contribution;
@@ -241,10 +244,10 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::commitHistoryContri
   }
 
   // Reset the update tracker
-  this->resetUpdateTracker( thread_id );
+  this->resetUpdateTracker( slot_index );
 
   // Reset the has uncommitted history contribution boolean
-  this->unsetHasUncommittedHistoryContribution( thread_id );
+  this->unsetHasUncommittedHistoryContribution( slot_index );
 }
 
 // Print the estimator data
@@ -268,8 +271,10 @@ CellPulseHeightEstimator<ContributionMultiplierPolicy>::enableThreadSupport(
 
   EntityEstimator::enableThreadSupport( num_threads );
 
-  // Add thread support to update tracker
-  d_update_tracker.resize( num_threads );
+  // Add thread support to update tracker (one for each history
+  // contribution slot)
+  d_update_tracker.resize(
+                     num_threads*this->getNumberOfHistoryContributionSlots() );
 
   // Add thread support to the dimension values
   d_dimension_values.resize( num_threads );
@@ -396,16 +401,16 @@ inline double CellPulseHeightEstimator<ContributionMultiplierPolicy>::calculateH
 // Add info to update tracker
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::addInfoToUpdateTracker(
-                                             const unsigned thread_id,
+                                             const unsigned slot_index,
                                              const CellIdType cell_id,
                                              const double source_weight,
                                              const double energy_contribution,
                                              const double charge_contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_update_tracker.size() );
 
-  SerialUpdateTracker& thread_update_tracker = d_update_tracker[thread_id];
+  SerialUpdateTracker& thread_update_tracker = d_update_tracker[slot_index];
 
   auto cell_it = thread_update_tracker.second.find( cell_id );
 
@@ -427,28 +432,28 @@ void CellPulseHeightEstimator<ContributionMultiplierPolicy>::addInfoToUpdateTrac
 // Get the entity iterators from the update tracker
 template<typename ContributionMultiplierPolicy>
 void CellPulseHeightEstimator<ContributionMultiplierPolicy>::getCellIteratorFromUpdateTracker(
-                 const unsigned thread_id,
+                 const unsigned slot_index,
                  typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& start_cell,
                 typename Utility::TupleElement<1,SerialUpdateTracker>::type::const_iterator& end_cell ) const
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_update_tracker.size() );
 
-  start_cell = d_update_tracker[thread_id].second.begin();
-  end_cell = d_update_tracker[thread_id].second.end();
+  start_cell = d_update_tracker[slot_index].second.begin();
+  end_cell = d_update_tracker[slot_index].second.end();
 }
 
 // Reset the update tracker
 template<typename ContributionMultiplierPolicy>
 void
 CellPulseHeightEstimator<ContributionMultiplierPolicy>::resetUpdateTracker(
-                                                     const unsigned thread_id )
+                                                     const unsigned slot_index )
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_update_tracker.size() );
 
-  d_update_tracker[thread_id].first = 0.0;
-  d_update_tracker[thread_id].second.clear();
+  d_update_tracker[slot_index].first = 0.0;
+  d_update_tracker[slot_index].second.clear();
 }
 
 // Save the data to an archive
@@ -0,0 +1,270 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DenseEstimatorMomentsArray.cpp
+//! \author Alex Robinson
+//! \brief  The dense estimator moments array class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_DenseEstimatorMomentsArray.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+DenseEstimatorMomentsArray::DenseEstimatorMomentsArray()
+  : DenseEstimatorMomentsArray( 0, 0 )
+{ /* ... */ }
+
+// Constructor
+DenseEstimatorMomentsArray::DenseEstimatorMomentsArray(
+                                   const size_t number_of_entities,
+                                   const size_t number_of_values_per_entity,
+                                   const bool single_precision_second_moments )
+  : d_number_of_entities( 0 ),
+    d_number_of_values_per_entity( 0 ),
+    d_single_precision_second_moments( single_precision_second_moments ),
+    d_first_moments(),
+    d_second_moments(),
+    d_single_precision_second_moments_array(),
+    d_third_moments(),
+    d_fourth_moments(),
+    d_second_moments_buffer()
+{
+  this->resize( number_of_entities, number_of_values_per_entity );
+}
+
+// Resize the array (all moments will be reset)
+void DenseEstimatorMomentsArray::resize(
+                                    const size_t number_of_entities,
+                                    const size_t number_of_values_per_entity )
+{
+  d_number_of_entities = number_of_entities;
+  d_number_of_values_per_entity = number_of_values_per_entity;
+
+  const size_t size = number_of_entities*number_of_values_per_entity;
+
+  // Release the old memory before allocating the new memory so that the peak
+  // memory usage is not doubled
+  d_first_moments.clear();
+  d_first_moments.shrink_to_fit();
+  d_first_moments.resize( size, 0.0 );
+
+  d_second_moments.clear();
+  d_second_moments.shrink_to_fit();
+
+  d_single_precision_second_moments_array.clear();
+  d_single_precision_second_moments_array.shrink_to_fit();
+
+  if( d_single_precision_second_moments )
+    d_single_precision_second_moments_array.resize( size, 0.0f );
+  else
+    d_second_moments.resize( size, 0.0 );
+
+  d_third_moments.clear();
+  d_third_moments.shrink_to_fit();
+  d_third_moments.resize( size, 0.0 );
+
+  d_fourth_moments.clear();
+  d_fourth_moments.shrink_to_fit();
+  d_fourth_moments.resize( size, 0.0 );
+
+  d_second_moments_buffer.resize( number_of_values_per_entity );
+}
+
+// Return the number of entities
+size_t DenseEstimatorMomentsArray::getNumberOfEntities() const
+{
+  return d_number_of_entities;
+}
+
+// Return the number of values stored for each entity
+size_t DenseEstimatorMomentsArray::getNumberOfValuesPerEntity() const
+{
+  return d_number_of_values_per_entity;
+}
+
+// Return the total number of values stored
+size_t DenseEstimatorMomentsArray::size() const
+{
+  return d_first_moments.size();
+}
+
+// Check if the second moments are stored in single precision
+bool DenseEstimatorMomentsArray::areSecondMomentsSinglePrecision() const
+{
+  return d_single_precision_second_moments;
+}
+
+// Return the memory used to store the moments (bytes)
+size_t DenseEstimatorMomentsArray::getMemoryFootprint() const
+{
+  return d_first_moments.capacity()*sizeof(double) +
+    d_second_moments.capacity()*sizeof(double) +
+    d_single_precision_second_moments_array.capacity()*sizeof(float) +
+    d_third_moments.capacity()*sizeof(double) +
+    d_fourth_moments.capacity()*sizeof(double);
+}
+
+// Get the first moments of an entity
+Utility::ArrayView<const double> DenseEstimatorMomentsArray::getFirstMoments(
+                                             const size_t entity_index ) const
+{
+  // Make sure that the entity index is valid
+  testPrecondition( entity_index < d_number_of_entities );
+
+  return Utility::ArrayView<const double>(
+               d_first_moments.data() + entity_index*d_number_of_values_per_entity,
+               d_number_of_values_per_entity );
+}
+
+// Get the second moments of an entity
+/*! \details If the second moments are stored in single precision they will
+ * be converted to double precision and stored in an internal buffer. The
+ * returned view will only be valid until the next call to this method.
+ */
+Utility::ArrayView<const double> DenseEstimatorMomentsArray::getSecondMoments(
+                                             const size_t entity_index ) const
+{
+  // Make sure that the entity index is valid
+  testPrecondition( entity_index < d_number_of_entities );
+
+  if( d_single_precision_second_moments )
+  {
+    const float* entity_second_moments =
+      d_single_precision_second_moments_array.data() +
+      entity_index*d_number_of_values_per_entity;
+
+    std::copy( entity_second_moments,
+               entity_second_moments + d_number_of_values_per_entity,
+               d_second_moments_buffer.begin() );
+
+    return Utility::ArrayView<const double>( d_second_moments_buffer.data(),
+                                             d_number_of_values_per_entity );
+  }
+  else
+  {
+    return Utility::ArrayView<const double>(
+              d_second_moments.data() + entity_index*d_number_of_values_per_entity,
+              d_number_of_values_per_entity );
+  }
+}
+
+// Get the third moments of an entity
+Utility::ArrayView<const double> DenseEstimatorMomentsArray::getThirdMoments(
+                                             const size_t entity_index ) const
+{
+  // Make sure that the entity index is valid
+  testPrecondition( entity_index < d_number_of_entities );
+
+  return Utility::ArrayView<const double>(
+               d_third_moments.data() + entity_index*d_number_of_values_per_entity,
+               d_number_of_values_per_entity );
+}
+
+// Get the fourth moments of an entity
+Utility::ArrayView<const double> DenseEstimatorMomentsArray::getFourthMoments(
+                                             const size_t entity_index ) const
+{
+  // Make sure that the entity index is valid
+  testPrecondition( entity_index < d_number_of_entities );
+
+  return Utility::ArrayView<const double>(
+              d_fourth_moments.data() + entity_index*d_number_of_values_per_entity,
+              d_number_of_values_per_entity );
+}
+
+// Reset the moments
+void DenseEstimatorMomentsArray::reset()
+{
+  std::fill( d_first_moments.begin(), d_first_moments.end(), 0.0 );
+  std::fill( d_second_moments.begin(), d_second_moments.end(), 0.0 );
+  std::fill( d_single_precision_second_moments_array.begin(),
+             d_single_precision_second_moments_array.end(),
+             0.0f );
+  std::fill( d_third_moments.begin(), d_third_moments.end(), 0.0 );
+  std::fill( d_fourth_moments.begin(), d_fourth_moments.end(), 0.0 );
+}
+
+// Pack the moments into a reduction buffer
+/*! \details The moments will be appended to the buffer (first moments,
+ * second moments, third moments, fourth moments). Single precision second
+ * moments are packed in double precision.
+ */
+void DenseEstimatorMomentsArray::pack( std::vector<double>& moments ) const
+{
+  moments.insert( moments.end(),
+                  d_first_moments.begin(),
+                  d_first_moments.end() );
+
+  if( d_single_precision_second_moments )
+  {
+    moments.insert( moments.end(),
+                    d_single_precision_second_moments_array.begin(),
+                    d_single_precision_second_moments_array.end() );
+  }
+  else
+  {
+    moments.insert( moments.end(),
+                    d_second_moments.begin(),
+                    d_second_moments.end() );
+  }
+
+  moments.insert( moments.end(),
+                  d_third_moments.begin(),
+                  d_third_moments.end() );
+  moments.insert( moments.end(),
+                  d_fourth_moments.begin(),
+                  d_fourth_moments.end() );
+}
+
+// Unpack the reduced moments from a reduction buffer
+/*! \details The moments will be unpacked starting at the offset, which will
+ * be advanced past the moments of this array.
+ */
+void DenseEstimatorMomentsArray::unpack(
+                                    const std::vector<double>& reduced_moments,
+                                    size_t& offset )
+{
+  // Make sure that the reduced moments are valid
+  testPrecondition( offset + 4*d_first_moments.size() <=
+                    reduced_moments.size() );
+
+  const size_t size = d_first_moments.size();
+
+  std::vector<double>::const_iterator moments_it =
+    reduced_moments.begin() + offset;
+
+  std::copy( moments_it, moments_it + size, d_first_moments.begin() );
+  moments_it += size;
+
+  if( d_single_precision_second_moments )
+  {
+    std::copy( moments_it,
+               moments_it + size,
+               d_single_precision_second_moments_array.begin() );
+  }
+  else
+    std::copy( moments_it, moments_it + size, d_second_moments.begin() );
+
+  moments_it += size;
+
+  std::copy( moments_it, moments_it + size, d_third_moments.begin() );
+  moments_it += size;
+
+  std::copy( moments_it, moments_it + size, d_fourth_moments.begin() );
+
+  offset += 4*size;
+}
+
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::DenseEstimatorMomentsArray );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DenseEstimatorMomentsArray.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,201 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DenseEstimatorMomentsArray.hpp
+//! \author Alex Robinson
+//! \brief  The dense estimator moments array class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DENSE_ESTIMATOR_MOMENTS_ARRAY_HPP
+#define MONTE_CARLO_DENSE_ESTIMATOR_MOMENTS_ARRAY_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// Boost Includes
+#include <boost/serialization/version.hpp>
+#include <boost/serialization/vector.hpp>
+
+// FRENSIE Includes
+#include "Utility_ArrayView.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+/*! The dense estimator moments array class
+ * \details This class stores the first four sample moments of a fixed number
+ * of values for each entity of a densely indexed entity set (e.g. the
+ * elements of a mesh). Each moment order is stored in its own contiguous
+ * array (structure-of-arrays layout) with the values of an entity stored
+ * contiguously. Entities must be identified by their index
+ * (0 <= index < number of entities) - mapping from entity ids to indices is
+ * the responsibility of the client. The second moments can optionally be
+ * stored in single precision, which reduces the memory required by 1/8. Single
+ * precision second moments should only be used when the number of histories
+ * is modest since the sums will lose precision as they grow.
+ */
+class DenseEstimatorMomentsArray
+{
+
+public:
+
+  //! Default constructor
+  DenseEstimatorMomentsArray();
+
+  //! Constructor
+  DenseEstimatorMomentsArray( const size_t number_of_entities,
+                              const size_t number_of_values_per_entity,
+                              const bool single_precision_second_moments = false );
+
+  //! Destructor
+  ~DenseEstimatorMomentsArray()
+  { /* ... */ }
+
+  //! Resize the array (all moments will be reset)
+  void resize( const size_t number_of_entities,
+               const size_t number_of_values_per_entity );
+
+  //! Return the number of entities
+  size_t getNumberOfEntities() const;
+
+  //! Return the number of values stored for each entity
+  size_t getNumberOfValuesPerEntity() const;
+
+  //! Return the total number of values stored
+  size_t size() const;
+
+  //! Check if the second moments are stored in single precision
+  bool areSecondMomentsSinglePrecision() const;
+
+  //! Return the memory used to store the moments (bytes)
+  size_t getMemoryFootprint() const;
+
+  //! Add a raw score to the moments of a value of an entity
+  void addRawScore( const size_t entity_index,
+                    const size_t value_index,
+                    const double raw_score );
+
+  //! Add a raw score to the moments using a flattened index
+  void addRawScore( const size_t index, const double raw_score );
+
+  //! Get the first moments of an entity
+  Utility::ArrayView<const double> getFirstMoments( const size_t entity_index ) const;
+
+  //! Get the second moments of an entity
+  Utility::ArrayView<const double> getSecondMoments( const size_t entity_index ) const;
+
+  //! Get the third moments of an entity
+  Utility::ArrayView<const double> getThirdMoments( const size_t entity_index ) const;
+
+  //! Get the fourth moments of an entity
+  Utility::ArrayView<const double> getFourthMoments( const size_t entity_index ) const;
+
+  //! Reset the moments
+  void reset();
+
+  //! Pack the moments into a reduction buffer
+  void pack( std::vector<double>& moments ) const;
+
+  //! Unpack the reduced moments from a reduction buffer
+  void unpack( const std::vector<double>& reduced_moments, size_t& offset );
+
+private:
+
+  // Serialize the array
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_entities );
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_values_per_entity );
+    ar & BOOST_SERIALIZATION_NVP( d_single_precision_second_moments );
+    ar & BOOST_SERIALIZATION_NVP( d_first_moments );
+    ar & BOOST_SERIALIZATION_NVP( d_second_moments );
+    ar & BOOST_SERIALIZATION_NVP( d_single_precision_second_moments_array );
+    ar & BOOST_SERIALIZATION_NVP( d_third_moments );
+    ar & BOOST_SERIALIZATION_NVP( d_fourth_moments );
+
+    if( Archive::is_loading::value )
+      d_second_moments_buffer.resize( d_number_of_values_per_entity );
+  }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The number of entities
+  size_t d_number_of_entities;
+
+  // The number of values stored for each entity
+  size_t d_number_of_values_per_entity;
+
+  // Records if the second moments are stored in single precision
+  bool d_single_precision_second_moments;
+
+  // The first moments
+  std::vector<double> d_first_moments;
+
+  // The second moments (double precision)
+  std::vector<double> d_second_moments;
+
+  // The second moments (single precision)
+  std::vector<float> d_single_precision_second_moments_array;
+
+  // The third moments
+  std::vector<double> d_third_moments;
+
+  // The fourth moments
+  std::vector<double> d_fourth_moments;
+
+  // The single precision second moment conversion buffer
+  mutable std::vector<double> d_second_moments_buffer;
+};
+
+// Add a raw score to the moments using a flattened index
+/*! \details The flattened index is the entity index times the number of
+ * values per entity plus the value index.
+ */
+inline void DenseEstimatorMomentsArray::addRawScore( const size_t index,
+                                                     const double raw_score )
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_first_moments.size() );
+
+  const double raw_score_squared = raw_score*raw_score;
+
+  d_first_moments[index] += raw_score;
+
+  if( d_single_precision_second_moments )
+    d_single_precision_second_moments_array[index] += raw_score_squared;
+  else
+    d_second_moments[index] += raw_score_squared;
+
+  d_third_moments[index] += raw_score_squared*raw_score;
+  d_fourth_moments[index] += raw_score_squared*raw_score_squared;
+}
+
+// Add a raw score to the moments of a value of an entity
+inline void DenseEstimatorMomentsArray::addRawScore(
+                                               const size_t entity_index,
+                                               const size_t value_index,
+                                               const double raw_score )
+{
+  // Make sure that the entity index is valid
+  testPrecondition( entity_index < d_number_of_entities );
+  // Make sure that the value index is valid
+  testPrecondition( value_index < d_number_of_values_per_entity );
+
+  this->addRawScore( entity_index*d_number_of_values_per_entity + value_index,
+                     raw_score );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::DenseEstimatorMomentsArray, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, DenseEstimatorMomentsArray );
+
+#endif // end MONTE_CARLO_DENSE_ESTIMATOR_MOMENTS_ARRAY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DenseEstimatorMomentsArray.hpp
+//---------------------------------------------------------------------------//
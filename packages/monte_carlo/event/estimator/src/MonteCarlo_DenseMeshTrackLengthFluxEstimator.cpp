@@ -0,0 +1,27 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DenseMeshTrackLengthFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  The dense mesh track-length flux estimator instantiations
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_DenseMeshTrackLengthFluxEstimator.hpp"
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightMultipliedDenseMeshTrackLengthFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightAndEnergyMultipliedDenseMeshTrackLengthFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::WeightAndChargeMultipliedDenseMeshTrackLengthFluxEstimator );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DenseMeshTrackLengthFluxEstimator.cpp
+//---------------------------------------------------------------------------//
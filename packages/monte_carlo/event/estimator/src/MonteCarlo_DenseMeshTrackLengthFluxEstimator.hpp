@@ -0,0 +1,406 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DenseMeshTrackLengthFluxEstimator.hpp
+//! \author Alex Robinson
+//! \brief  The dense mesh track-length flux estimator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DENSE_MESH_TRACK_LENGTH_FLUX_ESTIMATOR_HPP
+#define MONTE_CARLO_DENSE_MESH_TRACK_LENGTH_FLUX_ESTIMATOR_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <functional>
+
+// FRENSIE Includes
+#include "MonteCarlo_Estimator.hpp"
+#include "MonteCarlo_DenseEstimatorMomentsArray.hpp"
+#include "MonteCarlo_ParticleSubtrackEndingGlobalEventObserver.hpp"
+#include "MonteCarlo_EstimatorContributionMultiplierPolicy.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "Utility_Mesh.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The dense mesh track-length flux estimator class
+ * \details This estimator produces the same results as the
+ * MonteCarlo::MeshTrackLengthFluxEstimator but it has been designed for
+ * meshes with millions of elements. The moments of every element are stored
+ * in dense arrays that are indexed by element (see
+ * MonteCarlo::DenseEstimatorMomentsArray) instead of in hash maps that are
+ * keyed by element handle. The contributions from the current history are
+ * recorded in a sparse list of touched element bins (one per thread) that is
+ * sorted and merged when the history is committed. The track-length scratch
+ * array is also reused by each thread. The second moments can optionally be
+ * stored in single precision to reduce the memory footprint. Entity bin
+ * snapshots, sample moment histograms and thread-private moment accumulation
+ * are not supported by this estimator.
+ * \ingroup particle_subtrack_ending_global_event
+ */
+template<typename ContributionMultiplierPolicy = WeightMultiplier>
+class DenseMeshTrackLengthFluxEstimator : public Estimator,
+                                          public ParticleSubtrackEndingGlobalEventObserver
+{
+
+public:
+
+  //! Typedef for event tags used for quick dispatcher registering
+  typedef boost::mpl::vector<ParticleSubtrackEndingGlobalEventObserver::EventTag>
+  EventTags;
+
+  //! Constructor
+  DenseMeshTrackLengthFluxEstimator(
+                      const Id id,
+                      const double multiplier,
+                      const std::shared_ptr<const Utility::Mesh>& mesh,
+                      const bool single_precision_second_moments = false );
+
+  //! Destructor
+  ~DenseMeshTrackLengthFluxEstimator()
+  { /* ... */ }
+
+  //! Check if the estimator is a cell estimator
+  bool isCellEstimator() const final override;
+
+  //! Check if the estimator is a surface estimator
+  bool isSurfaceEstimator() const final override;
+
+  //! Check if the estimator is a mesh estimator
+  bool isMeshEstimator() const final override;
+
+  //! Return the entity ids associated with this estimator
+  void getEntityIds( std::set<EntityId>& entity_ids ) const final override;
+
+  //! Check if the entity is assigned to this estimator
+  bool isEntityAssigned( const EntityId entity_id ) const final override;
+
+  //! Return the normalization constant for an entity
+  double getEntityNormConstant( const EntityId entity_id ) const final override;
+
+  //! Return the total normalization constant
+  double getTotalNormConstant() const final override;
+
+  //! Check if the second moments are stored in single precision
+  bool areSecondMomentsSinglePrecision() const;
+
+  //! Return the memory used to store the element moments (bytes)
+  size_t getElementMomentsMemoryFootprint() const;
+
+  //! Enable snapshots on entity bins
+  void enableSnapshotsOnEntityBins() final override;
+
+  //! Check if snapshots have been enabled on entity bins
+  bool areSnapshotsOnEntityBinsEnabled() const final override;
+
+  //! Enable sample moment histograms on entity bins
+  void enableSampleMomentHistogramsOnEntityBins() final override;
+
+  //! Check if sample moment histograms are enabled on entity bins
+  bool areSampleMomentHistogramsOnEntityBinsEnabled() const final override;
+
+  //! Enable thread-private moment accumulation
+  void enableThreadPrivateMomentAccumulation() final override;
+
+  //! Check if thread-private moment accumulation has been enabled
+  bool isThreadPrivateMomentAccumulationEnabled() const final override;
+
+  //! Get the total estimator bin data first moments
+  Utility::ArrayView<const double> getTotalBinDataFirstMoments() const final override;
+
+  //! Get the total estimator bin data second moments
+  Utility::ArrayView<const double> getTotalBinDataSecondMoments() const final override;
+
+  //! Get the total estimator bin data third moments
+  Utility::ArrayView<const double> getTotalBinDataThirdMoments() const final override;
+
+  //! Get the total estimator bin data fourth moments
+  Utility::ArrayView<const double> getTotalBinDataFourthMoments() const final override;
+
+  //! Get the bin data first moments for an entity
+  Utility::ArrayView<const double> getEntityBinDataFirstMoments( const EntityId entity_id ) const final override;
+
+  //! Get the bin data second moments for an entity
+  Utility::ArrayView<const double> getEntityBinDataSecondMoments( const EntityId entity_id ) const final override;
+
+  //! Get the bin data third moments for an entity
+  Utility::ArrayView<const double> getEntityBinDataThirdMoments( const EntityId entity_id ) const final override;
+
+  //! Get the bin data fourth moments for an entity
+  Utility::ArrayView<const double> getEntityBinDataFourthMoments( const EntityId entity_id ) const final override;
+
+  //! Check if total data is available
+  bool isTotalDataAvailable() const final override;
+
+  //! Get the total data first moments
+  Utility::ArrayView<const double> getTotalDataFirstMoments() const final override;
+
+  //! Get the total data second moments
+  Utility::ArrayView<const double> getTotalDataSecondMoments() const final override;
+
+  //! Get the total data third moments
+  Utility::ArrayView<const double> getTotalDataThirdMoments() const final override;
+
+  //! Get the total data fourth moments
+  Utility::ArrayView<const double> getTotalDataFourthMoments() const final override;
+
+  //! Get the total data first moments for an entity
+  Utility::ArrayView<const double> getEntityTotalDataFirstMoments( const EntityId entity_id ) const final override;
+
+  //! Get the total data second moments for an entity
+  Utility::ArrayView<const double> getEntityTotalDataSecondMoments( const EntityId entity_id ) const final override;
+
+  //! Get the total data third moments for an entity
+  Utility::ArrayView<const double> getEntityTotalDataThirdMoments( const EntityId entity_id ) const final override;
+
+  //! Get the total data fourth moments for an entity
+  Utility::ArrayView<const double> getEntityTotalDataFourthMoments( const EntityId entity_id ) const final override;
+
+  //! Get the total moment snapshot history values
+  void getTotalMomentSnapshotHistoryValues(
+                  std::vector<uint64_t>& history_values ) const final override;
+
+  //! Get the total moment snapshot sampling times
+  void getTotalMomentSnapshotSamplingTimes(
+                    std::vector<double>& sampling_times ) const final override;
+
+  //! Get the total data first moment snapshots for a total bin index
+  void getTotalFirstMomentSnapshots(
+                           const size_t response_function_index,
+                           std::vector<double>& moments ) const final override;
+
+  //! Get the total data second moment snapshots for a total bin index
+  void getTotalSecondMomentSnapshots(
+                           const size_t response_function_index,
+                           std::vector<double>& moments ) const final override;
+
+  //! Get the total data third moment snapshots for a total bin index
+  void getTotalThirdMomentSnapshots(
+                           const size_t response_function_index,
+                           std::vector<double>& moments ) const final override;
+
+  //! Get the total data fourth moment snapshots for a total bin index
+  void getTotalFourthMomentSnapshots(
+                           const size_t response_function_index,
+                           std::vector<double>& moments ) const final override;
+
+  //! Add current history estimator contribution
+  void updateFromGlobalParticleSubtrackEndingEvent(
+                                    const ParticleState& particle,
+                                    const double start_point[3],
+				    const double end_point[3] ) final override;
+
+  //! Commit the contribution from the current history to the estimator
+  void commitHistoryContribution() final override;
+
+  //! Take a snapshot (of the moments)
+  void takeSnapshot( const uint64_t num_histories_since_last_snapshot,
+                     const double time_since_last_snapshot ) final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) final override;
+
+  //! Reset estimator data
+  void resetData() final override;
+
+  //! Capture the data that will be saved to an archive
+  void takeArchiveSnapshot() final override;
+
+  //! Release the data that was captured for an archive
+  void releaseArchiveSnapshot() final override;
+
+  //! Print the estimator data summary
+  void printSummary( std::ostream& os ) const final override;
+
+protected:
+
+  //! Default constructor
+  DenseMeshTrackLengthFluxEstimator();
+
+  //! Assign discretization to an estimator dimension
+  void assignDiscretization( const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+                             const bool range_dimension ) final override;
+
+  //! Assign the particle type to the estimator
+  void assignParticleType( const ParticleType particle_type ) final override;
+
+  //! Assign response function to the estimator
+  void assignResponseFunction( const std::shared_ptr<const ParticleResponse>& response_function ) final override;
+
+  //! Pack the estimator moments into a reduction buffer (implementation)
+  void packMoments( std::vector<double>& moments ) const final override;
+
+  //! Unpack the reduced estimator moments (implementation)
+  void unpackMoments( const std::vector<double>& reduced_moments,
+                      size_t& offset ) final override;
+
+  //! Reduce the estimator data that is not packed (e.g. snapshots)
+  void reduceUnpackedData( const Utility::Communicator& comm,
+                           const int root_process ) final override;
+
+private:
+
+  // The per-thread history scratch data
+  struct ThreadScratchData
+  {
+    // The track lengths through the mesh elements of the current subtrack
+    Utility::Mesh::ElementHandleTrackLengthArray track_lengths;
+
+    // The response function values of the current subtrack
+    std::vector<double> response_function_values;
+
+    // The bin indices of the current subtrack (point dimensions)
+    ObserverPhaseSpaceDimensionDiscretization::BinIndexArray bin_indices;
+
+    // The bin indices and weights of the current subtrack (range dimensions)
+    ObserverPhaseSpaceDimensionDiscretization::BinIndexWeightPairArray
+    bin_indices_and_weights;
+
+    // The bin contributions of the current history summed over all elements
+    std::vector<double> bin_totals;
+
+    // The response function contributions of the current history for an
+    // element
+    std::vector<double> element_totals;
+
+    // The response function contributions of the current history summed over
+    // all elements
+    std::vector<double> totals;
+  };
+
+  // Initialize the element data
+  void initializeElementData();
+
+  // Return the index of an element
+  size_t getElementIndex( const EntityId element_handle ) const;
+
+  // Resize the moment arrays
+  void resizeMomentArrays();
+
+  // Check if the element totals are stored separately from the element bins
+  bool areElementTotalsStoredSeparately() const;
+
+  // Get the moments array that stores the element totals
+  const DenseEstimatorMomentsArray& getElementTotalMoments() const;
+
+  // Add current history estimator contribution
+  void updateFromGlobalParticleSubtrackEndingEventNoTimeBinsImpl(
+						 const ParticleState& particle,
+						 const double start_point[3],
+						 const double end_point[3] );
+
+  // Add current history estimator contribution
+  void updateFromGlobalParticleSubtrackEndingEventTimeBinsImpl(
+						 const ParticleState& particle,
+						 const double start_point[3],
+						 const double end_point[3] );
+
+  // Evaluate the response functions
+  void evaluateResponseFunctions( const ParticleState& particle,
+                                  std::vector<double>& values ) const;
+
+  // Assign the update method
+  void assignUpdateMethod();
+
+  // Export the estimator data and mesh as a vtk file
+  void exportAsVtk() const;
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The mesh object
+  std::shared_ptr<const Utility::Mesh> d_mesh;
+
+  // The sorted mesh element handles
+  std::vector<EntityId> d_element_handles;
+
+  // Records if the element handles are contiguous
+  bool d_contiguous_element_handles;
+
+  // The mesh element volumes (indexed by element)
+  std::vector<double> d_element_volumes;
+
+  // The total volume of the mesh
+  double d_total_volume;
+
+  // The estimator moments for each bin of each element
+  DenseEstimatorMomentsArray d_element_bin_moments;
+
+  // The total estimator moments for each element (only used with >1 bin)
+  DenseEstimatorMomentsArray d_element_total_moments;
+
+  // The estimator moments for each bin of the total
+  Estimator::FourEstimatorMomentsCollection d_total_bin_moments;
+
+  // The total estimator moments across all elements and response functions
+  Estimator::FourEstimatorMomentsCollection d_total_moments;
+
+  // The total estimator moment snapshots across all elements and resp. funcs.
+  Estimator::FourEstimatorMomentsCollectionSnapshots d_total_moment_snapshots;
+
+  // The no-time-bins update method is being used
+  bool d_no_time_bins_update_method;
+
+  // The update function
+  typedef std::function<void(const ParticleState&,const double[3],const double[3])> UpdateFunction;
+  UpdateFunction d_update_method;
+
+  // The thread scratch data
+  std::vector<ThreadScratchData> d_thread_scratch_data;
+
+  // The element bins touched by the current history of each history
+  // contribution slot (flattened index)
+  std::vector<std::vector<std::pair<size_t,double> > > d_touched_element_bins;
+
+  // The moments that are updated during a simulation
+  struct ArchiveSnapshot
+  {
+    DenseEstimatorMomentsArray element_bin_moments;
+    DenseEstimatorMomentsArray element_total_moments;
+    Estimator::FourEstimatorMomentsCollection total_bin_moments;
+    Estimator::FourEstimatorMomentsCollection total_moments;
+    Estimator::FourEstimatorMomentsCollectionSnapshots total_moment_snapshots;
+  };
+
+  // The moments captured for an archive
+  std::unique_ptr<const ArchiveSnapshot> d_archive_snapshot;
+};
+
+//! The weight multiplied dense mesh track length flux estimator
+typedef DenseMeshTrackLengthFluxEstimator<WeightMultiplier> WeightMultipliedDenseMeshTrackLengthFluxEstimator;
+
+//! The weight and energy multiplied dense mesh track length flux estimator
+typedef DenseMeshTrackLengthFluxEstimator<WeightAndEnergyMultiplier> WeightAndEnergyMultipliedDenseMeshTrackLengthFluxEstimator;
+
+//! The weight and charge multiplied dense mesh track length flux estimator
+typedef DenseMeshTrackLengthFluxEstimator<WeightAndChargeMultiplier> WeightAndChargeMultipliedDenseMeshTrackLengthFluxEstimator;
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS1_VERSION( DenseMeshTrackLengthFluxEstimator, MonteCarlo, 0 );
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_DenseMeshTrackLengthFluxEstimator_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_DENSE_MESH_TRACK_LENGTH_FLUX_ESTIMATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DenseMeshTrackLengthFluxEstimator.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,1464 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DenseMeshTrackLengthFluxEstimator_def.hpp
+//! \author Alex Robinson
+//! \brief  The dense mesh track-length flux estimator class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DENSE_MESH_TRACK_LENGTH_FLUX_ESTIMATOR_DEF_HPP
+#define MONTE_CARLO_DENSE_MESH_TRACK_LENGTH_FLUX_ESTIMATOR_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+template<typename ContributionMultiplierPolicy>
+DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::DenseMeshTrackLengthFluxEstimator()
+  : d_thread_scratch_data( 1 ),
+    d_touched_element_bins( 1 )
+{ /* ... */ }
+
+// Constructor
+template<typename ContributionMultiplierPolicy>
+DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::DenseMeshTrackLengthFluxEstimator(
+                           const Id id,
+                           const double multiplier,
+                           const std::shared_ptr<const Utility::Mesh>& mesh,
+                           const bool single_precision_second_moments )
+  : Estimator( id, multiplier ),
+    d_mesh( mesh ),
+    d_element_handles(),
+    d_contiguous_element_handles( false ),
+    d_element_volumes(),
+    d_total_volume( 0.0 ),
+    d_element_bin_moments( 0, 0, single_precision_second_moments ),
+    d_element_total_moments( 0, 0, single_precision_second_moments ),
+    d_total_bin_moments( 1 ),
+    d_total_moments( 1 ),
+    d_total_moment_snapshots( 1 ),
+    d_no_time_bins_update_method( true ),
+    d_update_method(),
+    d_thread_scratch_data( 1 ),
+    d_touched_element_bins( 1 )
+{
+  // Make sure that the mesh pointer is valid
+  testPrecondition( mesh.get() );
+
+  this->initializeElementData();
+
+  this->resizeMomentArrays();
+
+  this->assignUpdateMethod();
+}
+
+// Check if the estimator is a cell estimator
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::isCellEstimator() const
+{
+  return false;
+}
+
+// Check if the estimator is a surface estimator
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::isSurfaceEstimator() const
+{
+  return false;
+}
+
+// Check if the estimator is a mesh estimator
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::isMeshEstimator() const
+{
+  return true;
+}
+
+// Return the entity ids associated with this estimator
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityIds(
+                                       std::set<EntityId>& entity_ids ) const
+{
+  entity_ids.insert( d_element_handles.begin(), d_element_handles.end() );
+}
+
+// Check if the entity is assigned to this estimator
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::isEntityAssigned(
+                                           const EntityId entity_id ) const
+{
+  if( d_contiguous_element_handles )
+  {
+    return !d_element_handles.empty() &&
+      entity_id >= d_element_handles.front() &&
+      entity_id <= d_element_handles.back();
+  }
+  else
+  {
+    return std::binary_search( d_element_handles.begin(),
+                               d_element_handles.end(),
+                               entity_id );
+  }
+}
+
+// Return the normalization constant for an entity
+template<typename ContributionMultiplierPolicy>
+double DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityNormConstant(
+                                           const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return d_element_volumes[this->getElementIndex( entity_id )];
+}
+
+// Return the total normalization constant
+template<typename ContributionMultiplierPolicy>
+double DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalNormConstant() const
+{
+  return d_total_volume;
+}
+
+// Check if the second moments are stored in single precision
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::areSecondMomentsSinglePrecision() const
+{
+  return d_element_bin_moments.areSecondMomentsSinglePrecision();
+}
+
+// Return the memory used to store the element moments (bytes)
+template<typename ContributionMultiplierPolicy>
+size_t DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getElementMomentsMemoryFootprint() const
+{
+  return d_element_bin_moments.getMemoryFootprint() +
+    d_element_total_moments.getMemoryFootprint();
+}
+
+// Enable snapshots on entity bins
+/*! \details Snapshots of every element bin would require more memory than
+ * dense mesh estimators are meant to use. Only the estimator total data will
+ * be snapshotted.
+ */
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::enableSnapshotsOnEntityBins()
+{
+  FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                              "Entity bin snapshots cannot be enabled on "
+                              "dense mesh track-length flux estimators. The "
+                              "request for estimator " << this->getId() <<
+                              " will be ignored!" );
+}
+
+// Check if snapshots have been enabled on entity bins
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::areSnapshotsOnEntityBinsEnabled() const
+{
+  return false;
+}
+
+// Enable sample moment histograms on entity bins
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::enableSampleMomentHistogramsOnEntityBins()
+{
+  FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                              "Entity bin sample moment histograms cannot be "
+                              "enabled on dense mesh track-length flux "
+                              "estimators. The request for estimator "
+                              << this->getId() << " will be ignored!" );
+}
+
+// Check if sample moment histograms are enabled on entity bins
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::areSampleMomentHistogramsOnEntityBinsEnabled() const
+{
+  return false;
+}
+
+// Enable thread-private moment accumulation
+/*! \details Thread-private copies of the element moments would multiply the
+ * memory footprint by the number of threads. The element moments are always
+ * shared by all threads.
+ */
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::enableThreadPrivateMomentAccumulation()
+{
+  FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                              "Thread-private moment accumulation cannot be "
+                              "enabled on dense mesh track-length flux "
+                              "estimators. The request for estimator "
+                              << this->getId() << " will be ignored!" );
+}
+
+// Check if thread-private moment accumulation has been enabled
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::isThreadPrivateMomentAccumulationEnabled() const
+{
+  return false;
+}
+
+// Get the total estimator bin data first moments
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalBinDataFirstMoments() const
+{
+  return Utility::ArrayView<const double>(
+                           Utility::getCurrentScores<1>( d_total_bin_moments ),
+                           d_total_bin_moments.size() );
+}
+
+// Get the total estimator bin data second moments
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalBinDataSecondMoments() const
+{
+  return Utility::ArrayView<const double>(
+                           Utility::getCurrentScores<2>( d_total_bin_moments ),
+                           d_total_bin_moments.size() );
+}
+
+// Get the total estimator bin data third moments
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalBinDataThirdMoments() const
+{
+  return Utility::ArrayView<const double>(
+                           Utility::getCurrentScores<3>( d_total_bin_moments ),
+                           d_total_bin_moments.size() );
+}
+
+// Get the total estimator bin data fourth moments
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalBinDataFourthMoments() const
+{
+  return Utility::ArrayView<const double>(
+                           Utility::getCurrentScores<4>( d_total_bin_moments ),
+                           d_total_bin_moments.size() );
+}
+
+// Get the bin data first moments for an entity
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityBinDataFirstMoments(
+                                            const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return d_element_bin_moments.getFirstMoments(
+                                         this->getElementIndex( entity_id ) );
+}
+
+// Get the bin data second moments for an entity
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityBinDataSecondMoments(
+                                            const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return d_element_bin_moments.getSecondMoments(
+                                         this->getElementIndex( entity_id ) );
+}
+
+// Get the bin data third moments for an entity
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityBinDataThirdMoments(
+                                            const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return d_element_bin_moments.getThirdMoments(
+                                         this->getElementIndex( entity_id ) );
+}
+
+// Get the bin data fourth moments for an entity
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityBinDataFourthMoments(
+                                            const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return d_element_bin_moments.getFourthMoments(
+                                         this->getElementIndex( entity_id ) );
+}
+
+// Check if total data is available
+template<typename ContributionMultiplierPolicy>
+bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::isTotalDataAvailable() const
+{
+  return true;
+}
+
+// Get the total data first moments
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalDataFirstMoments() const
+{
+  return Utility::ArrayView<const double>(
+                               Utility::getCurrentScores<1>( d_total_moments ),
+                               d_total_moments.size() );
+}
+
+// Get the total data second moments
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalDataSecondMoments() const
+{
+  return Utility::ArrayView<const double>(
+                               Utility::getCurrentScores<2>( d_total_moments ),
+                               d_total_moments.size() );
+}
+
+// Get the total data third moments
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalDataThirdMoments() const
+{
+  return Utility::ArrayView<const double>(
+                               Utility::getCurrentScores<3>( d_total_moments ),
+                               d_total_moments.size() );
+}
+
+// Get the total data fourth moments
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalDataFourthMoments() const
+{
+  return Utility::ArrayView<const double>(
+                               Utility::getCurrentScores<4>( d_total_moments ),
+                               d_total_moments.size() );
+}
+
+// Get the total data first moments for an entity
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityTotalDataFirstMoments(
+                                            const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return this->getElementTotalMoments().getFirstMoments(
+                                         this->getElementIndex( entity_id ) );
+}
+
+// Get the total data second moments for an entity
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityTotalDataSecondMoments(
+                                            const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return this->getElementTotalMoments().getSecondMoments(
+                                         this->getElementIndex( entity_id ) );
+}
+
+// Get the total data third moments for an entity
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityTotalDataThirdMoments(
+                                            const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return this->getElementTotalMoments().getThirdMoments(
+                                         this->getElementIndex( entity_id ) );
+}
+
+// Get the total data fourth moments for an entity
+template<typename ContributionMultiplierPolicy>
+Utility::ArrayView<const double> DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getEntityTotalDataFourthMoments(
+                                            const EntityId entity_id ) const
+{
+  // Make sure that the entity id is valid
+  TEST_FOR_EXCEPTION( !this->isEntityAssigned( entity_id ),
+                      std::runtime_error,
+                      "Entity " << entity_id << " is not assigned to "
+                      "estimator " << this->getId() << "!" );
+
+  return this->getElementTotalMoments().getFourthMoments(
+                                         this->getElementIndex( entity_id ) );
+}
+
+// Get the total moment snapshot history values
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalMomentSnapshotHistoryValues(
+                                  std::vector<uint64_t>& history_values ) const
+{
+  const std::list<uint64_t>& raw_history_values =
+    d_total_moment_snapshots.getSnapshotIndices();
+
+  history_values.assign( raw_history_values.begin(),
+                         raw_history_values.end() );
+}
+
+// Get the total moment snapshot sampling times
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalMomentSnapshotSamplingTimes(
+                                    std::vector<double>& sampling_times ) const
+{
+  const std::list<double>& raw_sampling_time_values =
+    d_total_moment_snapshots.getSnapshotSamplingTimes();
+
+  sampling_times.assign( raw_sampling_time_values.begin(),
+                         raw_sampling_time_values.end() );
+}
+
+// Get the total data first moment snapshots for a total bin index
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalFirstMomentSnapshots(
+                                          const size_t response_function_index,
+                                          std::vector<double>& moments ) const
+{
+  // Make sure that the response function index is valid
+  TEST_FOR_EXCEPTION( response_function_index >= this->getNumberOfResponseFunctions(),
+                      std::runtime_error,
+                      "The response function index must be less than "
+                      << this->getNumberOfResponseFunctions() << "!" );
+
+  const std::list<double>& moment_snapshots =
+    Utility::getScoreSnapshots<1>( d_total_moment_snapshots,
+                                   response_function_index );
+
+  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+}
+
+// Get the total data second moment snapshots for a total bin index
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalSecondMomentSnapshots(
+                                          const size_t response_function_index,
+                                          std::vector<double>& moments ) const
+{
+  // Make sure that the response function index is valid
+  TEST_FOR_EXCEPTION( response_function_index >= this->getNumberOfResponseFunctions(),
+                      std::runtime_error,
+                      "The response function index must be less than "
+                      << this->getNumberOfResponseFunctions() << "!" );
+
+  const std::list<double>& moment_snapshots =
+    Utility::getScoreSnapshots<2>( d_total_moment_snapshots,
+                                   response_function_index );
+
+  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+}
+
+// Get the total data third moment snapshots for a total bin index
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalThirdMomentSnapshots(
+                                          const size_t response_function_index,
+                                          std::vector<double>& moments ) const
+{
+  // Make sure that the response function index is valid
+  TEST_FOR_EXCEPTION( response_function_index >= this->getNumberOfResponseFunctions(),
+                      std::runtime_error,
+                      "The response function index must be less than "
+                      << this->getNumberOfResponseFunctions() << "!" );
+
+  const std::list<double>& moment_snapshots =
+    Utility::getScoreSnapshots<3>( d_total_moment_snapshots,
+                                   response_function_index );
+
+  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+}
+
+// Get the total data fourth moment snapshots for a total bin index
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getTotalFourthMomentSnapshots(
+                                          const size_t response_function_index,
+                                          std::vector<double>& moments ) const
+{
+  // Make sure that the response function index is valid
+  TEST_FOR_EXCEPTION( response_function_index >= this->getNumberOfResponseFunctions(),
+                      std::runtime_error,
+                      "The response function index must be less than "
+                      << this->getNumberOfResponseFunctions() << "!" );
+
+  const std::list<double>& moment_snapshots =
+    Utility::getScoreSnapshots<4>( d_total_moment_snapshots,
+                                   response_function_index );
+
+  moments.assign( moment_snapshots.begin(), moment_snapshots.end() );
+}
+
+// Add current history estimator contribution
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleSubtrackEndingEvent(
+                                                 const ParticleState& particle,
+                                                 const double start_point[3],
+                                                 const double end_point[3] )
+{
+  // Make sure that the particle type is assigned
+  testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_scratch_data.size() );
+
+  d_update_method( particle, start_point, end_point );
+}
+
+// Add current history estimator contribution
+/*! \details The contributions are only recorded in the touched element bin
+ * list of the selected history contribution slot of the calling thread. The response function values and the bin
+ * indices are the same for every element that is crossed so they are only
+ * calculated once per subtrack.
+ */
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleSubtrackEndingEventNoTimeBinsImpl(
+						 const ParticleState& particle,
+						 const double start_point[3],
+						 const double end_point[3] )
+{
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+
+  const size_t slot_index = this->getHistoryContributionSlotIndex();
+
+  ThreadScratchData& scratch_data = d_thread_scratch_data[thread_id];
+
+  std::vector<std::pair<size_t,double> >& touched_element_bins =
+    d_touched_element_bins[slot_index];
+
+  d_mesh->computeTrackLengths( start_point,
+                               end_point,
+                               scratch_data.track_lengths );
+
+  if( scratch_data.track_lengths.size() > 0 )
+  {
+    ObserverParticleStateWrapper particle_state_wrapper( particle );
+
+    if( this->isPointInObserverPhaseSpace( particle_state_wrapper ) )
+    {
+      const size_t num_bins = this->getNumberOfBins();
+
+      const size_t num_element_values =
+        num_bins*this->getNumberOfResponseFunctions();
+
+      scratch_data.bin_indices.clear();
+
+      this->calculateBinIndicesOfPoint( particle_state_wrapper,
+                                        0,
+                                        scratch_data.bin_indices );
+
+      this->evaluateResponseFunctions( particle,
+                                       scratch_data.response_function_values );
+
+      const double multiplier =
+        ContributionMultiplierPolicy::multiplier( particle );
+
+      for( size_t i = 0; i < scratch_data.track_lengths.size(); ++i )
+      {
+        const double weighted_contribution =
+          Utility::get<2>( scratch_data.track_lengths[i] )*multiplier;
+
+        const size_t element_offset = num_element_values*
+          this->getElementIndex( Utility::get<0>( scratch_data.track_lengths[i] ) );
+
+        for( size_t r = 0; r < scratch_data.response_function_values.size(); ++r )
+        {
+          const double processed_contribution = weighted_contribution*
+            scratch_data.response_function_values[r];
+
+          const size_t bin_index_shift = element_offset + r*num_bins;
+
+          for( size_t j = 0; j < scratch_data.bin_indices.size(); ++j )
+          {
+            touched_element_bins.push_back(
+                     std::make_pair( scratch_data.bin_indices[j] + bin_index_shift,
+                                     processed_contribution ) );
+          }
+        }
+      }
+    }
+
+    // Indicate that there is an uncommitted history contribution
+    if( !this->hasUncommittedHistoryContribution( slot_index ) )
+      this->setHasUncommittedHistoryContribution( slot_index );
+  }
+}
+
+// Add current history estimator contribution
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleSubtrackEndingEventTimeBinsImpl(
+						 const ParticleState& particle,
+						 const double start_point[3],
+						 const double end_point[3] )
+{
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+
+  const size_t slot_index = this->getHistoryContributionSlotIndex();
+
+  ThreadScratchData& scratch_data = d_thread_scratch_data[thread_id];
+
+  std::vector<std::pair<size_t,double> >& touched_element_bins =
+    d_touched_element_bins[slot_index];
+
+  d_mesh->computeTrackLengths( start_point,
+                               end_point,
+                               scratch_data.track_lengths );
+
+  if( scratch_data.track_lengths.size() > 0 )
+  {
+    ObserverParticleStateWrapper particle_state_wrapper( particle );
+
+    const double total_track_length =
+      std::sqrt( (end_point[0]-start_point[0])*(end_point[0]-start_point[0]) +
+                 (end_point[1]-start_point[1])*(end_point[1]-start_point[1]) +
+                 (end_point[2]-start_point[2])*(end_point[2]-start_point[2]) );
+
+    particle_state_wrapper.calculateStateTimesUsingParticleTimeAsEndTime( total_track_length );
+
+    const double start_time = particle_state_wrapper.getStartTime();
+
+    const size_t num_bins = this->getNumberOfBins();
+
+    const size_t num_element_values =
+      num_bins*this->getNumberOfResponseFunctions();
+
+    this->evaluateResponseFunctions( particle,
+                                     scratch_data.response_function_values );
+
+    const double multiplier =
+      ContributionMultiplierPolicy::multiplier( particle );
+
+    for( size_t i = 0; i < scratch_data.track_lengths.size(); ++i )
+    {
+      const double weighted_contribution =
+        Utility::get<2>( scratch_data.track_lengths[i] )*multiplier;
+
+      const auto& element_intersection_point =
+        Utility::get<1>( scratch_data.track_lengths[i] );
+
+      const double distance_to_element_intersection =
+        std::sqrt( (element_intersection_point[0]-start_point[0])*(element_intersection_point[0]-start_point[0]) +
+                   (element_intersection_point[1]-start_point[1])*(element_intersection_point[1]-start_point[1]) +
+                   (element_intersection_point[2]-start_point[2])*(element_intersection_point[2]-start_point[2]) );
+
+      const double track_start_time =
+        start_time + distance_to_element_intersection/particle.getSpeed();
+
+      const double track_end_time = track_start_time +
+        Utility::get<2>( scratch_data.track_lengths[i] )/particle.getSpeed();
+
+      particle_state_wrapper.setStartTime( track_start_time );
+      particle_state_wrapper.setEndTime( track_end_time );
+
+      if( !this->doesRangeIntersectObserverPhaseSpace( particle_state_wrapper ) )
+        continue;
+
+      scratch_data.bin_indices_and_weights.clear();
+
+      this->calculateBinIndicesAndWeightsOfRange(
+                                       particle_state_wrapper,
+                                       0,
+                                       scratch_data.bin_indices_and_weights );
+
+      const size_t element_offset = num_element_values*
+        this->getElementIndex( Utility::get<0>( scratch_data.track_lengths[i] ) );
+
+      for( size_t r = 0; r < scratch_data.response_function_values.size(); ++r )
+      {
+        const size_t bin_index_shift = element_offset + r*num_bins;
+
+        for( size_t j = 0; j < scratch_data.bin_indices_and_weights.size(); ++j )
+        {
+          const double processed_contribution = weighted_contribution*
+            Utility::get<1>( scratch_data.bin_indices_and_weights[j] )*
+            scratch_data.response_function_values[r];
+
+          touched_element_bins.push_back(
+             std::make_pair( Utility::get<0>( scratch_data.bin_indices_and_weights[j] ) + bin_index_shift,
+                             processed_contribution ) );
+        }
+      }
+    }
+
+    // Indicate that there is an uncommitted history contribution
+    if( !this->hasUncommittedHistoryContribution( slot_index ) )
+      this->setHasUncommittedHistoryContribution( slot_index );
+  }
+}
+
+// Commit the contribution from the current history to the estimator
+/*! \details The touched element bin list of the selected history
+ * contribution slot of the calling thread is sorted and the contributions to
+ * the same element bin are combined before the moments are updated. The sort
+ * is stable so that the contributions are summed in the order that they were
+ * made. All shared moments are updated within a single omp critical block.
+ */
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::commitHistoryContribution()
+{
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_scratch_data.size() );
+  // Make sure the history contribution slot index is valid
+  testPrecondition( this->getHistoryContributionSlotIndex() <
+                    d_touched_element_bins.size() );
+
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+
+  const size_t slot_index = this->getHistoryContributionSlotIndex();
+
+  ThreadScratchData& scratch_data = d_thread_scratch_data[thread_id];
+
+  std::vector<std::pair<size_t,double> >& touched_element_bins =
+    d_touched_element_bins[slot_index];
+
+  if( !touched_element_bins.empty() )
+  {
+    const size_t num_bins = this->getNumberOfBins();
+
+    const size_t num_response_funcs = this->getNumberOfResponseFunctions();
+
+    const size_t num_element_values = num_bins*num_response_funcs;
+
+    // Combine the contributions to the same element bin
+    std::stable_sort( touched_element_bins.begin(),
+                      touched_element_bins.end(),
+                      []( const std::pair<size_t,double>& a,
+                          const std::pair<size_t,double>& b )
+                      { return a.first < b.first; } );
+
+    size_t last_unique_index = 0;
+
+    for( size_t i = 1; i < touched_element_bins.size(); ++i )
+    {
+      if( touched_element_bins[i].first ==
+          touched_element_bins[last_unique_index].first )
+      {
+        touched_element_bins[last_unique_index].second +=
+          touched_element_bins[i].second;
+      }
+      else
+      {
+        ++last_unique_index;
+
+        touched_element_bins[last_unique_index] = touched_element_bins[i];
+      }
+    }
+
+    touched_element_bins.resize( last_unique_index+1 );
+
+    // Calculate the bin totals and the totals over all elements
+    scratch_data.bin_totals.assign( num_element_values, 0.0 );
+    scratch_data.totals.assign( num_response_funcs, 0.0 );
+
+    for( auto&& element_bin_data : touched_element_bins )
+    {
+      const size_t bin_index = element_bin_data.first % num_element_values;
+
+      scratch_data.bin_totals[bin_index] += element_bin_data.second;
+
+      scratch_data.totals[this->calculateResponseFunctionIndex( bin_index )] +=
+        element_bin_data.second;
+    }
+
+    const bool element_totals_stored_separately =
+      this->areElementTotalsStoredSeparately();
+
+    scratch_data.element_totals.assign( num_response_funcs, 0.0 );
+
+    // Update the moments
+    #pragma omp critical
+    {
+      size_t current_element_index =
+        touched_element_bins.front().first/num_element_values;
+
+      for( auto&& element_bin_data : touched_element_bins )
+      {
+        d_element_bin_moments.addRawScore( element_bin_data.first,
+                                           element_bin_data.second );
+
+        if( element_totals_stored_separately )
+        {
+          const size_t element_index =
+            element_bin_data.first/num_element_values;
+
+          if( element_index != current_element_index )
+          {
+            for( size_t r = 0; r < num_response_funcs; ++r )
+            {
+              d_element_total_moments.addRawScore( current_element_index,
+                                                   r,
+                                                   scratch_data.element_totals[r] );
+
+              scratch_data.element_totals[r] = 0.0;
+            }
+
+            current_element_index = element_index;
+          }
+
+          scratch_data.element_totals[this->calculateResponseFunctionIndex( element_bin_data.first % num_element_values )] += element_bin_data.second;
+        }
+      }
+
+      if( element_totals_stored_separately )
+      {
+        for( size_t r = 0; r < num_response_funcs; ++r )
+        {
+          d_element_total_moments.addRawScore( current_element_index,
+                                               r,
+                                               scratch_data.element_totals[r] );
+        }
+      }
+
+      for( size_t r = 0; r < num_response_funcs; ++r )
+        d_total_moments.addRawScore( r, scratch_data.totals[r] );
+
+      for( size_t i = 0; i < num_element_values; ++i )
+      {
+        if( scratch_data.bin_totals[i] != 0.0 )
+          d_total_bin_moments.addRawScore( i, scratch_data.bin_totals[i] );
+      }
+    }
+
+    // Reset the touched element bins
+    touched_element_bins.clear();
+  }
+
+  // Unset the uncommitted history contribution flag
+  this->unsetHasUncommittedHistoryContribution( slot_index );
+}
+
+// Take a snapshot (of the moments)
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::takeSnapshot(
+                                const uint64_t num_histories_since_last_snapshot,
+                                const double time_since_last_snapshot )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_total_moment_snapshots.takeSnapshot( num_histories_since_last_snapshot,
+                                         time_since_last_snapshot,
+                                         d_total_moments );
+}
+
+// Enable support for multiple threads
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::enableThreadSupport(
+                                                    const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  Estimator::enableThreadSupport( num_threads );
+
+  d_thread_scratch_data.resize( num_threads );
+
+  d_touched_element_bins.resize(
+                     num_threads*this->getNumberOfHistoryContributionSlots() );
+}
+
+// Reset estimator data
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::resetData()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_element_bin_moments.reset();
+  d_element_total_moments.reset();
+  d_total_bin_moments.reset();
+  d_total_moments.reset();
+  d_total_moment_snapshots.reset();
+
+  for( size_t i = 0; i < d_touched_element_bins.size(); ++i )
+  {
+    d_touched_element_bins[i].clear();
+
+    this->unsetHasUncommittedHistoryContribution( i );
+  }
+}
+
+// Capture the data that will be saved to an archive
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::takeArchiveSnapshot()
+{
+  std::unique_ptr<ArchiveSnapshot> snapshot( new ArchiveSnapshot );
+
+  snapshot->element_bin_moments = d_element_bin_moments;
+  snapshot->element_total_moments = d_element_total_moments;
+  snapshot->total_bin_moments = d_total_bin_moments;
+  snapshot->total_moments = d_total_moments;
+  snapshot->total_moment_snapshots = d_total_moment_snapshots;
+
+  d_archive_snapshot = std::move( snapshot );
+}
+
+// Release the data that was captured for an archive
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::releaseArchiveSnapshot()
+{
+  d_archive_snapshot.reset();
+}
+
+// Pack the estimator moments into a reduction buffer (implementation)
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::packMoments(
+                                           std::vector<double>& moments ) const
+{
+  moments.reserve( moments.size() +
+                   4*(d_element_bin_moments.size() +
+                      d_element_total_moments.size() +
+                      d_total_bin_moments.size() +
+                      d_total_moments.size()) );
+
+  d_element_bin_moments.pack( moments );
+  d_element_total_moments.pack( moments );
+
+  Estimator::packCollection( d_total_bin_moments, moments );
+  Estimator::packCollection( d_total_moments, moments );
+}
+
+// Unpack the reduced estimator moments (implementation)
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::unpackMoments(
+                                    const std::vector<double>& reduced_moments,
+                                    size_t& offset )
+{
+  d_element_bin_moments.unpack( reduced_moments, offset );
+  d_element_total_moments.unpack( reduced_moments, offset );
+
+  Estimator::unpackCollection( reduced_moments, offset, d_total_bin_moments );
+  Estimator::unpackCollection( reduced_moments, offset, d_total_moments );
+}
+
+// Reduce the estimator data that is not packed (e.g. snapshots)
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::reduceUnpackedData(
+                                             const Utility::Communicator& comm,
+                                             const int root_process )
+{
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  // Reduce the total snapshot data
+  try{
+    this->reduceSnapshots( comm, root_process, d_total_moment_snapshots );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction in dense mesh "
+                           "track-length flux estimator " << this->getId() <<
+                           " for total snapshot data!" );
+}
+
+// Print the estimator data summary
+/*! \details The estimator data will also be exported to a vtk file (e.g.
+ * estimator_x.vtk -> x == estimator id).
+ */
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::printSummary(
+                                                       std::ostream& os ) const
+{
+  // Collect some basic statistics regarding the mesh elements
+  std::vector<unsigned long long> num_zero_elements(
+                                  this->getNumberOfResponseFunctions(), 0ull );
+  std::vector<unsigned long long> num_elements_lte_1pc_re(
+                                  this->getNumberOfResponseFunctions(), 0ull );
+  std::vector<unsigned long long> num_elements_lte_5pc_re(
+                                  this->getNumberOfResponseFunctions(), 0ull );
+  std::vector<unsigned long long> num_elements_lte_10pc_re(
+                                  this->getNumberOfResponseFunctions(), 0ull );
+
+  std::vector<double> mean, relative_error, variance_of_variance,
+    figure_of_merit;
+
+  for( auto&& element_handle : d_element_handles )
+  {
+    this->getEntityTotalProcessedData( element_handle,
+                                       mean,
+                                       relative_error,
+                                       variance_of_variance,
+                                       figure_of_merit );
+
+    for( size_t i = 0; i < this->getNumberOfResponseFunctions(); ++i )
+    {
+      if( mean[i] == 0.0 && relative_error[i] == 0.0 )
+        ++num_zero_elements[i];
+      else
+      {
+        if( relative_error[i] <= 0.10 )
+          ++num_elements_lte_10pc_re[i];
+        if( relative_error[i] <= 0.05 )
+          ++num_elements_lte_5pc_re[i];
+        if( relative_error[i] <= 0.01 )
+          ++num_elements_lte_1pc_re[i];
+      }
+    }
+  }
+
+  const size_t num_mesh_elements = d_element_handles.size();
+
+  os << d_mesh->getMeshTypeName() << " dense track-length flux estimator "
+     << this->getId() << ":\n"
+     << "  " << d_mesh->getMeshElementTypeName() << "s: "
+     << num_mesh_elements << "\n"
+     << "  element moments memory (MB): "
+     << this->getElementMomentsMemoryFootprint()/1048576.0 << "\n";
+
+  // Print the percentage of elements with no hits
+  os << "  % of " << d_mesh->getMeshElementTypeName()
+     << " with no hits (per response func.): ";
+
+  for( size_t i = 0; i < this->getNumberOfResponseFunctions(); ++i )
+    os << (double)num_zero_elements[i]/num_mesh_elements*100 << " ";
+
+  os << "\n";
+
+  // Print the percentage of elements with <= 10% relative error
+  os << "  % of " << d_mesh->getMeshElementTypeName()
+     << " with <= 10% RE (per response func.): ";
+
+  for( size_t i = 0; i < this->getNumberOfResponseFunctions(); ++i )
+    os << (double)num_elements_lte_10pc_re[i]/num_mesh_elements*100 << " ";
+
+  os << "\n";
+
+  // Print the percentage of elements with <= 5% relative error
+  os << "  % of " << d_mesh->getMeshElementTypeName()
+     << " with <= 5% RE (per response func.): ";
+
+  for( size_t i = 0; i < this->getNumberOfResponseFunctions(); ++i )
+    os << (double)num_elements_lte_5pc_re[i]/num_mesh_elements*100 << " ";
+
+  os << "\n";
+
+  // Print the percentage of elements with <= 1% relative error
+  os << "  % of " << d_mesh->getMeshElementTypeName()
+     << " with <= 1% RE (per response func.): ";
+
+  for( size_t i = 0; i < this->getNumberOfResponseFunctions(); ++i )
+    os << (double)num_elements_lte_1pc_re[i]/num_mesh_elements*100 << " ";
+
+  os << std::endl;
+
+  this->exportAsVtk();
+}
+
+// Export the estimator data and mesh as a vtk file
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::exportAsVtk() const
+{
+  Utility::Mesh::TagNameSet tag_name_set( {"mean: ", "relative_error: ", "fom: ", "total_mean: ", "total_relative_error: ", "total_vov: ", "total_fom: "} );
+
+  Utility::Mesh::MeshElementHandleDataMap element_data_map;
+
+  std::vector<double> mean, relative_error, variance_of_variance,
+    figure_of_merit;
+
+  for( auto&& element_handle : d_element_handles )
+  {
+    auto& element_data = element_data_map[element_handle];
+
+    // Assign the bin data
+    this->getEntityBinProcessedData( element_handle,
+                                     mean,
+                                     relative_error,
+                                     variance_of_variance,
+                                     figure_of_merit );
+
+    auto& entity_bin_mean_data = element_data["mean: "];
+    entity_bin_mean_data.resize( mean.size() );
+
+    auto& entity_bin_re_data = element_data["relative_error: "];
+    entity_bin_re_data.resize( relative_error.size() );
+
+    auto& entity_bin_fom_data = element_data["fom: "];
+    entity_bin_fom_data.resize( figure_of_merit.size() );
+
+    for( size_t i = 0; i < mean.size(); ++i )
+    {
+      const std::string bin_name = this->getBinName( i );
+
+      entity_bin_mean_data[i] = std::make_pair( bin_name, mean[i] );
+      entity_bin_re_data[i] = std::make_pair( bin_name, relative_error[i] );
+      entity_bin_fom_data[i] = std::make_pair( bin_name, figure_of_merit[i] );
+    }
+
+    // Assign the total data
+    this->getEntityTotalProcessedData( element_handle,
+                                       mean,
+                                       relative_error,
+                                       variance_of_variance,
+                                       figure_of_merit );
+
+    auto& entity_total_mean_data = element_data["total_mean: "];
+    entity_total_mean_data.resize( mean.size() );
+
+    auto& entity_total_re_data = element_data["total_relative_error: "];
+    entity_total_re_data.resize( relative_error.size() );
+
+    auto& entity_total_vov_data = element_data["total_vov: "];
+    entity_total_vov_data.resize( variance_of_variance.size() );
+
+    auto& entity_total_fom_data = element_data["total_fom: "];
+    entity_total_fom_data.resize( figure_of_merit.size() );
+
+    for( size_t i = 0; i < mean.size(); ++i )
+    {
+      const std::string& response_function_name =
+        this->getResponseFunctionName( i );
+
+      entity_total_mean_data[i] =
+        std::make_pair( response_function_name, mean[i] );
+      entity_total_re_data[i] =
+        std::make_pair( response_function_name, relative_error[i] );
+      entity_total_vov_data[i] =
+        std::make_pair( response_function_name, variance_of_variance[i] );
+      entity_total_fom_data[i] =
+        std::make_pair( response_function_name, figure_of_merit[i] );
+    }
+  }
+
+  std::string output_name( "estimator_" );
+  output_name += Utility::toString( this->getId() );
+  output_name += ".vtk";
+
+  d_mesh->exportData( output_name, tag_name_set, element_data_map );
+}
+
+// Assign discretization to an estimator dimension
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::assignDiscretization(
+  const std::shared_ptr<const ObserverPhaseSpaceDimensionDiscretization>& bins,
+  const bool range_dimension )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( bins->getDimension() == OBSERVER_COSINE_DIMENSION )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                bins->getDimensionName() <<
+                                " bins cannot be set for dense mesh "
+                                "track-length flux estimators. The bins "
+                                "requested for estimator " << this->getId() <<
+                                " will be ignored!" );
+  }
+  else
+  {
+    if( bins->getDimension() == OBSERVER_TIME_DIMENSION )
+    {
+      Estimator::assignDiscretization( bins, true );
+
+      d_no_time_bins_update_method = false;
+
+      this->assignUpdateMethod();
+    }
+    else
+      Estimator::assignDiscretization( bins, false );
+
+    this->resizeMomentArrays();
+  }
+}
+
+// Assign the particle type to the estimator
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::assignParticleType(
+                                            const ParticleType particle_type )
+{
+  if( this->getNumberOfAssignedParticleTypes() != 0 )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                "Mesh track-length flux estimators can only "
+                                "have one particle type contribute. Since "
+                                "estimator " << this->getId() << " already "
+                                "has a particle type assigned the requested "
+                                "particle type of " << particle_type <<
+                                " will be ignored!" );
+  }
+  else
+    Estimator::assignParticleType( particle_type );
+}
+
+// Assign response function to the estimator
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::assignResponseFunction(
+             const std::shared_ptr<const ParticleResponse>& response_function )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( !response_function->isSpatiallyUniform() )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "Estimator",
+                                "only spatially uniform response functions "
+                                "can be assigned to mesh track-length "
+                                "estimators. Estimator " << this->getId() <<
+                                " will ignore response function "
+                                << response_function->getName() << "!" );
+  }
+  else
+  {
+    Estimator::assignResponseFunction( response_function );
+
+    this->resizeMomentArrays();
+  }
+}
+
+// Initialize the element data
+/*! \details The element handles are sorted so that the index of an element
+ * can be found with a binary search. When the handles are contiguous (e.g.
+ * structured hex meshes) the index is simply the offset from the first handle.
+ */
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::initializeElementData()
+{
+  d_element_handles.assign( d_mesh->getStartElementHandleIterator(),
+                            d_mesh->getEndElementHandleIterator() );
+
+  std::sort( d_element_handles.begin(), d_element_handles.end() );
+
+  // Make sure that there is at least one element
+  TEST_FOR_EXCEPTION( d_element_handles.empty(),
+                      std::runtime_error,
+                      "The mesh assigned to estimator " << this->getId() <<
+                      " does not have any elements!" );
+
+  // Make sure that the element handles are unique
+  TEST_FOR_EXCEPTION( std::adjacent_find( d_element_handles.begin(),
+                                          d_element_handles.end() ) !=
+                      d_element_handles.end(),
+                      std::runtime_error,
+                      "The mesh assigned to estimator " << this->getId() <<
+                      " has duplicate element handles!" );
+
+  d_contiguous_element_handles =
+    (d_element_handles.back() - d_element_handles.front() ==
+     d_element_handles.size() - 1);
+
+  // Store the element volumes in element index order
+  Utility::Mesh::ElementHandleVolumeMap element_volumes;
+
+  d_mesh->getElementVolumes( element_volumes );
+
+  d_element_volumes.resize( d_element_handles.size() );
+  d_total_volume = 0.0;
+
+  for( size_t i = 0; i < d_element_handles.size(); ++i )
+  {
+    d_element_volumes[i] = element_volumes.find( d_element_handles[i] )->second;
+
+    d_total_volume += d_element_volumes[i];
+  }
+}
+
+// Return the index of an element
+template<typename ContributionMultiplierPolicy>
+inline size_t DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getElementIndex(
+                                        const EntityId element_handle ) const
+{
+  // Make sure that the element is assigned to this estimator
+  testPrecondition( this->isEntityAssigned( element_handle ) );
+
+  if( d_contiguous_element_handles )
+    return element_handle - d_element_handles.front();
+  else
+  {
+    return std::lower_bound( d_element_handles.begin(),
+                             d_element_handles.end(),
+                             element_handle ) - d_element_handles.begin();
+  }
+}
+
+// Resize the moment arrays
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::resizeMomentArrays()
+{
+  const size_t num_response_funcs = this->getNumberOfResponseFunctions();
+
+  const size_t num_element_values =
+    this->getNumberOfBins()*num_response_funcs;
+
+  d_element_bin_moments.resize( d_element_handles.size(), num_element_values );
+
+  // When there is only one bin per response function the element totals are
+  // identical to the element bin data and do not need to be stored
+  if( this->areElementTotalsStoredSeparately() )
+  {
+    d_element_total_moments.resize( d_element_handles.size(),
+                                    num_response_funcs );
+  }
+  else
+    d_element_total_moments.resize( 0, 0 );
+
+  d_total_bin_moments.resize( num_element_values );
+  d_total_moments.resize( num_response_funcs );
+  d_total_moment_snapshots.resize( num_response_funcs );
+}
+
+// Check if the element totals are stored separately from the element bins
+template<typename ContributionMultiplierPolicy>
+inline bool DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::areElementTotalsStoredSeparately() const
+{
+  return this->getNumberOfBins() > 1;
+}
+
+// Get the moments array that stores the element totals
+template<typename ContributionMultiplierPolicy>
+inline const DenseEstimatorMomentsArray& DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::getElementTotalMoments() const
+{
+  if( this->areElementTotalsStoredSeparately() )
+    return d_element_total_moments;
+  else
+    return d_element_bin_moments;
+}
+
+// Evaluate the response functions
+template<typename ContributionMultiplierPolicy>
+inline void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::evaluateResponseFunctions(
+                                          const ParticleState& particle,
+                                          std::vector<double>& values ) const
+{
+  values.resize( this->getNumberOfResponseFunctions() );
+
+  for( size_t r = 0; r < values.size(); ++r )
+    values[r] = this->evaluateResponseFunction( particle, r );
+}
+
+// Save the data to an archive
+template<typename ContributionMultiplierPolicy>
+template<typename Archive>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Estimator );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingGlobalEventObserver );
+
+  // Use the captured moments if there are any
+  const ArchiveSnapshot* snapshot = d_archive_snapshot.get();
+
+  const DenseEstimatorMomentsArray& element_bin_moments =
+    snapshot ? snapshot->element_bin_moments : d_element_bin_moments;
+
+  const DenseEstimatorMomentsArray& element_total_moments =
+    snapshot ? snapshot->element_total_moments : d_element_total_moments;
+
+  const Estimator::FourEstimatorMomentsCollection& total_bin_moments =
+    snapshot ? snapshot->total_bin_moments : d_total_bin_moments;
+
+  const Estimator::FourEstimatorMomentsCollection& total_moments =
+    snapshot ? snapshot->total_moments : d_total_moments;
+
+  const Estimator::FourEstimatorMomentsCollectionSnapshots&
+    total_moment_snapshots = snapshot ? snapshot->total_moment_snapshots :
+    d_total_moment_snapshots;
+
+  // Save the local data
+  ar & BOOST_SERIALIZATION_NVP( d_mesh );
+  ar & BOOST_SERIALIZATION_NVP( d_element_handles );
+  ar & BOOST_SERIALIZATION_NVP( d_contiguous_element_handles );
+  ar & BOOST_SERIALIZATION_NVP( d_element_volumes );
+  ar & BOOST_SERIALIZATION_NVP( d_total_volume );
+  ar & boost::serialization::make_nvp( "d_element_bin_moments",
+                                       element_bin_moments );
+  ar & boost::serialization::make_nvp( "d_element_total_moments",
+                                       element_total_moments );
+  ar & boost::serialization::make_nvp( "d_total_bin_moments",
+                                       total_bin_moments );
+  ar & boost::serialization::make_nvp( "d_total_moments", total_moments );
+  ar & boost::serialization::make_nvp( "d_total_moment_snapshots",
+                                       total_moment_snapshots );
+  ar & BOOST_SERIALIZATION_NVP( d_no_time_bins_update_method );
+}
+
+// Load the data from an archive
+template<typename ContributionMultiplierPolicy>
+template<typename Archive>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Estimator );
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( ParticleSubtrackEndingGlobalEventObserver );
+
+  // Load the local data
+  ar & BOOST_SERIALIZATION_NVP( d_mesh );
+  ar & BOOST_SERIALIZATION_NVP( d_element_handles );
+  ar & BOOST_SERIALIZATION_NVP( d_contiguous_element_handles );
+  ar & BOOST_SERIALIZATION_NVP( d_element_volumes );
+  ar & BOOST_SERIALIZATION_NVP( d_total_volume );
+  ar & BOOST_SERIALIZATION_NVP( d_element_bin_moments );
+  ar & BOOST_SERIALIZATION_NVP( d_element_total_moments );
+  ar & BOOST_SERIALIZATION_NVP( d_total_bin_moments );
+  ar & BOOST_SERIALIZATION_NVP( d_total_moments );
+  ar & BOOST_SERIALIZATION_NVP( d_total_moment_snapshots );
+  ar & BOOST_SERIALIZATION_NVP( d_no_time_bins_update_method );
+
+  // The thread scratch data must be reinitialized after a load
+  d_thread_scratch_data.clear();
+  d_thread_scratch_data.resize( 1 );
+
+  d_touched_element_bins.clear();
+  d_touched_element_bins.resize( 1 );
+
+  this->assignUpdateMethod();
+}
+
+// Assign the update method
+template<typename ContributionMultiplierPolicy>
+void DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::assignUpdateMethod()
+{
+  if( d_no_time_bins_update_method )
+  {
+    d_update_method = std::bind<void>( &DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleSubtrackEndingEventNoTimeBinsImpl,
+                                       std::ref( *this ),
+                                       std::placeholders::_1,
+                                       std::placeholders::_2,
+                                       std::placeholders::_3 );
+  }
+  else
+  {
+    d_update_method = std::bind<void>( &DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGlobalParticleSubtrackEndingEventTimeBinsImpl,
+                                       std::ref( *this ),
+                                       std::placeholders::_1,
+                                       std::placeholders::_2,
+                                       std::placeholders::_3 );
+  }
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightMultipliedDenseMeshTrackLengthFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndEnergyMultipliedDenseMeshTrackLengthFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndEnergyMultiplier> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( WeightAndChargeMultipliedDenseMeshTrackLengthFluxEstimator, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightAndChargeMultiplier> );
+
+#endif // end MONTE_CARLO_DENSE_MESH_TRACK_LENGTH_FLUX_ESTIMATOR_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DenseMeshTrackLengthFluxEstimator_def.hpp
+//---------------------------------------------------------------------------//
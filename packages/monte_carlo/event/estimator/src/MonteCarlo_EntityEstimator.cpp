@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_EntityEstimator.hpp"
@@ -34,7 +37,9 @@ EntityEstimator::EntityEstimator( const Id id,
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_thread_private_moments_enabled( false ),
+    d_thread_private_moments()
 { /* ... */ }
 
 // Return the entity ids associated with this estimator
@@ -189,6 +194,9 @@ void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snap
 {
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // Bring the estimator moments up-to-date before taking the snapshot
+  this->mergeThreadPrivateMoments();
   
   if( d_entity_bin_snapshots_enabled )
   {
@@ -529,6 +537,44 @@ void EntityEstimator::getTotalBinSampleMomentHistogram(
     histogram = d_estimator_total_bin_histograms[bin_index];
 }
 
+// Enable thread-private moment accumulation
+/*! \details When thread-private moment accumulation is enabled each thread
+ * will commit its history contributions to a private copy of the estimator
+ * moments instead of committing them to the shared moments within an omp
+ * critical block. The private copies are merged (in thread order) when a
+ * snapshot is taken or when the estimator data is reduced. This method must be
+ * called before the thread support is enabled. Note that the memory required
+ * to store the estimator moments will scale with the number of threads.
+ */
+void EntityEstimator::enableThreadPrivateMomentAccumulation()
+{
+  d_thread_private_moments_enabled = true;
+}
+
+// Check if thread-private moment accumulation has been enabled
+bool EntityEstimator::isThreadPrivateMomentAccumulationEnabled() const
+{
+  return d_thread_private_moments_enabled;
+}
+
+// Enable support for multiple threads
+void EntityEstimator::enableThreadSupport( const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  Estimator::enableThreadSupport( num_threads );
+
+  if( d_thread_private_moments_enabled && num_threads > 1 )
+    this->initializeThreadPrivateMoments( num_threads );
+  else
+  {
+    this->mergeThreadPrivateMoments();
+
+    d_thread_private_moments.clear();
+  }
+}
+
 // Reset the estimator data
 void EntityEstimator::resetData()
 {
@@ -562,155 +608,176 @@ void EntityEstimator::resetData()
         histogram.reset();
     }
   }
+
+  // Reset the thread-private data
+  for( auto&& thread_moments : d_thread_private_moments )
+  {
+    thread_moments.estimator_total_bin_data.reset();
+
+    for( auto&& entity_data : thread_moments.entity_estimator_moments_map )
+      entity_data.second.reset();
+
+    for( auto&& histogram : thread_moments.estimator_total_bin_histograms )
+      histogram.reset();
+
+    for( auto&& entity_data : thread_moments.entity_estimator_histograms_map )
+    {
+      for( auto&& histogram : entity_data.second )
+        histogram.reset();
+    }
+
+    thread_moments.updated = false;
+  }
+}
+
+// Capture the data that will be saved to an archive
+/*! \details The moments, moment snapshots and histograms will be copied.
+ * Thread-private moments are not saved so they are not captured.
+ */
+void EntityEstimator::takeArchiveSnapshot()
+{
+  std::unique_ptr<ArchiveSnapshot> snapshot( new ArchiveSnapshot );
+
+  snapshot->estimator_total_bin_data = d_estimator_total_bin_data;
+  snapshot->entity_estimator_moments_map = d_entity_estimator_moments_map;
+  snapshot->estimator_total_bin_data_snapshots =
+    d_estimator_total_bin_data_snapshots;
+  snapshot->entity_estimator_moments_snapshots_map =
+    d_entity_estimator_moments_snapshots_map;
+  snapshot->estimator_total_bin_histograms = d_estimator_total_bin_histograms;
+  snapshot->entity_estimator_histograms_map =
+    d_entity_estimator_histograms_map;
+
+  d_archive_snapshot = std::move( snapshot );
+}
+
+// Release the data that was captured for an archive
+void EntityEstimator::releaseArchiveSnapshot()
+{
+  d_archive_snapshot.reset();
 }
 
-// Reduce estimator data on all processes and collect on the root process
-void EntityEstimator::reduceData( const Utility::Communicator& comm,
-                                  const int root_process )
+// Pack the estimator moments into a reduction buffer (implementation)
+void EntityEstimator::packMoments( std::vector<double>& moments ) const
+{
+  this->packEntityCollectionMap( d_entity_estimator_moments_map, moments );
+
+  Estimator::packCollection( d_estimator_total_bin_data, moments );
+}
+
+// Unpack the reduced estimator moments (implementation)
+void EntityEstimator::unpackMoments( const std::vector<double>& reduced_moments,
+                                     size_t& offset )
+{
+  this->unpackEntityCollectionMap( reduced_moments,
+                                   offset,
+                                   d_entity_estimator_moments_map );
+
+  Estimator::unpackCollection( reduced_moments,
+                               offset,
+                               d_estimator_total_bin_data );
+}
+
+// Reduce the estimator data that is not packed (e.g. snapshots)
+void EntityEstimator::reduceUnpackedData( const Utility::Communicator& comm,
+                                          const int root_process )
 {
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
-  // Only do the reduction if there is more than one process
-  if( comm.size() > 1 )
+  if( d_entity_bin_snapshots_enabled )
   {
-    // Reduce the entity bin data
+    // Reduce the entity bin snapshot data
     try{
-      this->reduceEntityCollectionMaps( comm, root_process, d_entity_estimator_moments_map );
+      this->reduceEntitySnapshotMaps( comm, root_process, d_entity_estimator_moments_snapshots_map );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in entity bin "
+                             "Unable to perform mpi reduction in entity "
                              "estimator " << this->getId() << " for entity "
-                             "bin data!" );
-
-    comm.barrier();
+                             "bin snapshot data!" );
 
-    // Reduce bin data of total
+    // Reduce the total bin snapshot data
     try{
-      this->reduceCollection( comm, root_process, d_estimator_total_bin_data );
+      this->reduceSnapshots( comm, root_process, d_estimator_total_bin_data_snapshots );
     }
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Unable to perform mpi reduction in entity "
-                             "estimator " << this->getId() << " for total bin "
-                             "data!" );
+                             "estimator " << this->getId() << " for total "
+                             "bin snapshot data!" );
+  }
 
-    if( d_entity_bin_snapshots_enabled )
-    {
-      // Reduce the entity bin snapshot data
-      try{
-        this->reduceEntitySnapshotMaps( comm, root_process, d_entity_estimator_moments_snapshots_map );
-      }
-      EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                               "Unable to perform mpi reduction in entity "
-                               "estimator " << this->getId() << " for entity "
-                               "bin snapshot data!" );
-
-      // Reduce the total bin snapshot data
-      try{
-        this->reduceSnapshots( comm, root_process, d_estimator_total_bin_data_snapshots );
-      }
-      EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                               "Unable to perform mpi reduction in entity "
-                               "estimator " << this->getId() << " for total "
-                               "bin snapshot data!" );
+  if( d_entity_bin_histograms_enabled )
+  {
+    // Reduce the entity bin histogram data
+    try{
+      this->reduceEntityHistogramMaps( comm, root_process, d_entity_estimator_histograms_map );
     }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in entity "
+                             "estimator " << this->getId() << " for entity "
+                             "bin histogram data!" );
 
-    if( d_entity_bin_histograms_enabled )
-    {
-      // Reduce the entity bin histogram data
-      try{
-        this->reduceEntityHistogramMaps( comm, root_process, d_entity_estimator_histograms_map );
-      }
-      EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                               "Unable to perform mpi reduction in entity "
-                               "estimator " << this->getId() << " for entity "
-                               "bin histogram data!" );
-
-      // Reduce the total bin histogram data
-      try{
-        this->reduceHistogramArrays( comm, root_process, d_estimator_total_bin_histograms );
-      }
-      EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                               "Unable to perform mpi reduction in entity "
-                               "estimator " << this->getId() << " for total "
-                               "bin histogram data!" );
+    // Reduce the total bin histogram data
+    try{
+      this->reduceHistogramArrays( comm, root_process, d_estimator_total_bin_histograms );
     }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in entity "
+                             "estimator " << this->getId() << " for total "
+                             "bin histogram data!" );
   }
-
-  Estimator::reduceData( comm, root_process );
 }
 
-// Reduce the entity collection maps
-void EntityEstimator::reduceEntityCollectionMaps(
-                    const Utility::Communicator& comm,
-                    const int root_process,
-                    EntityEstimatorMomentsCollectionMap& collection_map ) const
+// Pack the moments of the entity collection map into a reduction buffer
+/*! \details The entity collections are packed in order of increasing entity
+ * id since the map iteration order is not guaranteed to be the same on
+ * every process.
+ */
+void EntityEstimator::packEntityCollectionMap(
+                   const EntityEstimatorMomentsCollectionMap& collection_map,
+                   std::vector<double>& moments ) const
 {
-  // Gather all of the entity data on the root process
-  if( comm.rank() == root_process )
-  {
-    std::vector<EntityEstimatorMomentsCollectionMap>
-      gathered_entity_data( comm.size() );
+  std::vector<EntityId> entity_ids;
 
-    std::vector<Utility::Communicator::Request> gathered_requests;
+  EntityEstimator::getSortedEntityIds( collection_map, entity_ids );
 
-    for( size_t i = 0; i < comm.size(); ++i )
-    {
-      if( i != root_process )
-      {
-        gathered_requests.push_back(
-                    Utility::ireceive( comm, i, 0, gathered_entity_data[i] ) );
-      }
-    }
-
-    std::vector<Utility::Communicator::Status>
-      gathered_statuses( gathered_requests.size() );
-    
-    Utility::wait( gathered_requests, gathered_statuses );
-    
-    this->reduceEntityCollections( gathered_entity_data,
-                                   root_process,
-                                   collection_map );
+  for( auto&& entity_id : entity_ids )
+  {
+    Estimator::packCollection( collection_map.find( entity_id )->second,
+                               moments );
   }
-  else
-    Utility::send( comm, root_process, 0, collection_map );
 }
 
-// Reduce the entity moments
-void EntityEstimator::reduceEntityCollections(
-                    const std::vector<EntityEstimatorMomentsCollectionMap>&
-                    other_entity_estimator_moments_maps,
-                    const size_t root_index,
+// Unpack the reduced moments of the entity collection map
+void EntityEstimator::unpackEntityCollectionMap(
+                    const std::vector<double>& reduced_moments,
+                    size_t& offset,
                     EntityEstimatorMomentsCollectionMap& collection_map ) const
 {
-  // Reduce the data that was on each process
-  for( auto&& entity_data : collection_map )
-  {
-    // Don't double count data on this process (j starts from 1)
-    for( size_t j = 0; j < other_entity_estimator_moments_maps.size(); ++j )
-    {
-      if( j != root_index )
-      {
-        const EntityEstimatorMomentsCollectionMap::value_type&
-          other_entity_data = *other_entity_estimator_moments_maps[j].find( entity_data.first );
+  std::vector<EntityId> entity_ids;
 
-        for( size_t i = 0; i < entity_data.second.size(); ++i )
-        {
-          Utility::getCurrentScore<1>( entity_data.second, i ) +=
-            Utility::getCurrentScore<1>( other_entity_data.second, i );
+  EntityEstimator::getSortedEntityIds( collection_map, entity_ids );
+
+  for( auto&& entity_id : entity_ids )
+  {
+    Estimator::unpackCollection( reduced_moments,
+                                 offset,
+                                 collection_map.find( entity_id )->second );
+  }
+}
 
-          Utility::getCurrentScore<2>( entity_data.second, i ) +=
-            Utility::getCurrentScore<2>( other_entity_data.second, i );
+// Get the sorted entity ids of an entity collection map
+void EntityEstimator::getSortedEntityIds(
+                    const EntityEstimatorMomentsCollectionMap& collection_map,
+                    std::vector<EntityId>& entity_ids )
+{
+  entity_ids.clear();
+  entity_ids.reserve( collection_map.size() );
 
-          Utility::getCurrentScore<3>( entity_data.second, i ) +=
-            Utility::getCurrentScore<3>( other_entity_data.second, i );
+  for( auto&& entity_data : collection_map )
+    entity_ids.push_back( entity_data.first );
 
-          Utility::getCurrentScore<4>( entity_data.second, i ) +=
-            Utility::getCurrentScore<4>( other_entity_data.second, i );
-        }
-      }
-    }
-  }
+  std::sort( entity_ids.begin(), entity_ids.end() );
 }
 
 // Reduce the entity snapshot maps
@@ -1032,13 +1099,21 @@ void EntityEstimator::commitHistoryContributionToBinOfEntity(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  FourEstimatorMomentsCollection& entity_estimator_moments =
-    d_entity_estimator_moments_map.find( entity_id )->second;
-
-  // Update the moments
-  #pragma omp critical
+  if( this->areThreadPrivateMomentsUsed() )
+  {
+    // Update the thread-private moments (no synchronization required)
+    this->getThreadPrivateMoments().entity_estimator_moments_map.find( entity_id )->second.addRawScore( bin_index, contribution );
+  }
+  else
   {
-    entity_estimator_moments.addRawScore( bin_index, contribution );
+    FourEstimatorMomentsCollection& entity_estimator_moments =
+      d_entity_estimator_moments_map.find( entity_id )->second;
+
+    // Update the moments
+    #pragma omp critical
+    {
+      entity_estimator_moments.addRawScore( bin_index, contribution );
+    }
   }
 
   this->addHistoryContributionToEntityBinHistogram( entity_id,
@@ -1061,13 +1136,21 @@ void EntityEstimator::addHistoryContributionToEntityBinHistogram(
 
   if( d_entity_bin_histograms_enabled )
   {
-    Utility::SampleMomentHistogram<double>& histogram =
-      d_entity_estimator_histograms_map.find( entity_id )->second[bin_index];
-
-    // Update the histogram
-    #pragma omp critical
+    if( this->areThreadPrivateMomentsUsed() )
     {
-      histogram.addRawScore( contribution );
+      // Update the thread-private histogram
+      this->getThreadPrivateMoments().entity_estimator_histograms_map.find( entity_id )->second[bin_index].addRawScore( contribution );
+    }
+    else
+    {
+      Utility::SampleMomentHistogram<double>& histogram =
+        d_entity_estimator_histograms_map.find( entity_id )->second[bin_index];
+
+      // Update the histogram
+      #pragma omp critical
+      {
+        histogram.addRawScore( contribution );
+      }
     }
   }
 }
@@ -1082,10 +1165,18 @@ void EntityEstimator::commitHistoryContributionToBinOfTotal(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  // Update the moments
-  #pragma omp critical
+  if( this->areThreadPrivateMomentsUsed() )
   {
-    d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    // Update the thread-private moments (no synchronization required)
+    this->getThreadPrivateMoments().estimator_total_bin_data.addRawScore( bin_index, contribution );
+  }
+  else
+  {
+    // Update the moments
+    #pragma omp critical
+    {
+      d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    }
   }
 
   this->addHistoryContributionToTotalBinHistogram( bin_index, contribution );
@@ -1103,16 +1194,153 @@ void EntityEstimator::addHistoryContributionToTotalBinHistogram(
 
   if( d_entity_bin_histograms_enabled )
   {
-    Utility::SampleMomentHistogram<double>& histogram =
-      d_estimator_total_bin_histograms[bin_index];
+    if( this->areThreadPrivateMomentsUsed() )
+    {
+      // Update the thread-private histogram
+      this->getThreadPrivateMoments().estimator_total_bin_histograms[bin_index].addRawScore( contribution );
+    }
+    else
+    {
+      Utility::SampleMomentHistogram<double>& histogram =
+        d_estimator_total_bin_histograms[bin_index];
 
-    #pragma omp critical
+      #pragma omp critical
+      {
+        histogram.addRawScore( contribution );
+      }
+    }
+  }
+}
+
+// Check if the thread-private moments are being used
+bool EntityEstimator::areThreadPrivateMomentsUsed() const
+{
+  return !d_thread_private_moments.empty();
+}
+
+// Merge the thread-private moments into the estimator moments
+/*! \details The thread-private moments are always merged in thread order so
+ * that the merged moments do not depend on the order in which the threads
+ * completed their histories. The thread-private moments will be reset after
+ * the merge.
+ */
+void EntityEstimator::mergeThreadPrivateMoments()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( auto&& thread_moments : d_thread_private_moments )
+  {
+    if( !thread_moments.updated )
+      continue;
+
+    d_estimator_total_bin_data.mergeCollections( thread_moments.estimator_total_bin_data );
+    thread_moments.estimator_total_bin_data.reset();
+
+    for( auto&& entity_data : thread_moments.entity_estimator_moments_map )
     {
-      histogram.addRawScore( contribution );
+      d_entity_estimator_moments_map.find( entity_data.first )->second.mergeCollections( entity_data.second );
+
+      entity_data.second.reset();
+    }
+
+    if( d_entity_bin_histograms_enabled )
+    {
+      for( size_t i = 0; i < d_estimator_total_bin_histograms.size(); ++i )
+      {
+        d_estimator_total_bin_histograms[i].mergeHistograms( thread_moments.estimator_total_bin_histograms[i] );
+
+        thread_moments.estimator_total_bin_histograms[i].reset();
+      }
+
+      for( auto&& entity_data : thread_moments.entity_estimator_histograms_map )
+      {
+        SampleMomentHistogramArray& entity_histograms =
+          d_entity_estimator_histograms_map.find( entity_data.first )->second;
+
+        for( size_t i = 0; i < entity_histograms.size(); ++i )
+        {
+          entity_histograms[i].mergeHistograms( entity_data.second[i] );
+
+          entity_data.second[i].reset();
+        }
+      }
     }
+
+    thread_moments.updated = false;
   }
 }
 
+// Initialize the thread-private moments
+void EntityEstimator::initializeThreadPrivateMoments( const unsigned num_threads )
+{
+  // Make sure the number of threads is valid
+  testPrecondition( num_threads > 0 );
+
+  // Merge any outstanding contributions before the containers are rebuilt
+  this->mergeThreadPrivateMoments();
+
+  d_thread_private_moments.resize( num_threads );
+
+  for( auto&& thread_moments : d_thread_private_moments )
+  {
+    thread_moments.estimator_total_bin_data = d_estimator_total_bin_data;
+    thread_moments.estimator_total_bin_data.reset();
+
+    thread_moments.entity_estimator_moments_map =
+      d_entity_estimator_moments_map;
+
+    for( auto&& entity_data : thread_moments.entity_estimator_moments_map )
+      entity_data.second.reset();
+
+    if( d_entity_bin_histograms_enabled )
+    {
+      thread_moments.estimator_total_bin_histograms =
+        d_estimator_total_bin_histograms;
+
+      for( auto&& histogram : thread_moments.estimator_total_bin_histograms )
+        histogram.reset();
+
+      thread_moments.entity_estimator_histograms_map =
+        d_entity_estimator_histograms_map;
+
+      for( auto&& entity_data : thread_moments.entity_estimator_histograms_map )
+      {
+        for( auto&& histogram : entity_data.second )
+          histogram.reset();
+      }
+    }
+    else
+    {
+      thread_moments.estimator_total_bin_histograms.clear();
+      thread_moments.entity_estimator_histograms_map.clear();
+    }
+
+    thread_moments.updated = false;
+  }
+}
+
+// Get the thread-private moments of the calling thread
+/*! \details The thread-private moments will be marked as updated.
+ */
+auto EntityEstimator::getThreadPrivateMoments() -> ThreadPrivateMoments&
+{
+  // Make sure the thread-private moments are being used
+  testPrecondition( this->areThreadPrivateMomentsUsed() );
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_private_moments.size() );
+
+  ThreadPrivateMoments& thread_moments =
+    d_thread_private_moments[Utility::OpenMPProperties::getThreadId()];
+
+  // Only write the flag when necessary to avoid invalidating shared lines
+  if( !thread_moments.updated )
+    thread_moments.updated = true;
+
+  return thread_moments;
+}
+
 // Print the estimator data
 void EntityEstimator::printImplementation(
 					 std::ostream& os,
@@ -1338,7 +1566,7 @@ void EntityEstimator::resizeEstimatorTotalHistograms()
   }
 }
 
-EXPLICIT_CLASS_SERIALIZE_INST( EntityEstimator );
+EXPLICIT_CLASS_SAVE_LOAD_INST( EntityEstimator );
 
 } // end MonteCarlo namespace
 
@@ -184,12 +184,23 @@ public:
       const size_t bin_index,
       Utility::SampleMomentHistogram<double>& histogram ) const final override;
 
+  //! Enable thread-private moment accumulation
+  void enableThreadPrivateMomentAccumulation() final override;
+
+  //! Check if thread-private moment accumulation has been enabled
+  bool isThreadPrivateMomentAccumulationEnabled() const final override;
+
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) override;
+
   //! Reset estimator data
   void resetData() override;
 
-  //! Reduce estimator data on all processes and collect on the root process
-  void reduceData( const Utility::Communicator& comm,
-                   const int root_process ) override;
+  //! Capture the data that will be saved to an archive
+  void takeArchiveSnapshot() override;
+
+  //! Release the data that was captured for an archive
+  void releaseArchiveSnapshot() override;
 
 protected:
 
@@ -222,6 +233,23 @@ protected:
   void commitHistoryContributionToBinOfTotal( const size_t bin_index,
 					      const double contribution );
 
+  //! Check if the thread-private moments are being used
+  bool areThreadPrivateMomentsUsed() const;
+
+  //! Merge the thread-private moments into the estimator moments
+  void mergeThreadPrivateMoments() override;
+
+  //! Pack the estimator moments into a reduction buffer (implementation)
+  void packMoments( std::vector<double>& moments ) const override;
+
+  //! Unpack the reduced estimator moments (implementation)
+  void unpackMoments( const std::vector<double>& reduced_moments,
+                      size_t& offset ) override;
+
+  //! Reduce the estimator data that is not packed (e.g. snapshots)
+  void reduceUnpackedData( const Utility::Communicator& comm,
+                           const int root_process ) override;
+
   //! Print the estimator data
   virtual void printImplementation( std::ostream& os,
 				    const std::string& entity_type ) const;
@@ -232,10 +260,15 @@ protected:
   //! Get the bin data for an entity
   const Estimator::FourEstimatorMomentsCollection& getEntityBinData( const EntityId entity_id ) const;
 
-  //! Reduce the entity collection maps
-  void reduceEntityCollectionMaps(
-                   const Utility::Communicator& comm,
-                   const int root_process,
+  //! Pack the moments of the entity collection map into a reduction buffer
+  void packEntityCollectionMap(
+                  const EntityEstimatorMomentsCollectionMap& collection_map,
+                  std::vector<double>& moments ) const;
+
+  //! Unpack the reduced moments of the entity collection map
+  void unpackEntityCollectionMap(
+                   const std::vector<double>& reduced_moments,
+                   size_t& offset,
                    EntityEstimatorMomentsCollectionMap& collection_map ) const;
 
   //! Reduce the entity snapshot maps
@@ -258,6 +291,25 @@ protected:
 
 private:
 
+  // The thread-private estimator moments
+  struct ThreadPrivateMoments
+  {
+    // The estimator moments for each bin of the total
+    FourEstimatorMomentsCollection estimator_total_bin_data;
+
+    // The estimator moments for each bin and each entity
+    EntityEstimatorMomentsCollectionMap entity_estimator_moments_map;
+
+    // The sample moment histograms for each bin of the total
+    SampleMomentHistogramArray estimator_total_bin_histograms;
+
+    // The sample moment histograms for each bin and each entity
+    EntityEstimatorSampleMomentHistogramArrayMap entity_estimator_histograms_map;
+
+    // Records if the moments have been updated since the last merge
+    bool updated;
+  };
+
   // Initialize entity estimator moments map
   template<typename InputEntityId>
   void initializeEntityEstimatorMomentsMap(
@@ -302,6 +354,12 @@ private:
   // Resize the estimator total histograms
   void resizeEstimatorTotalHistograms();
 
+  // Initialize the thread-private moments
+  void initializeThreadPrivateMoments( const unsigned num_threads );
+
+  // Get the thread-private moments of the calling thread
+  ThreadPrivateMoments& getThreadPrivateMoments();
+
   // Add contribution to entity bin histogram
   void addHistoryContributionToEntityBinHistogram( const EntityId entity_id,
                                                    const size_t bin_index,
@@ -311,12 +369,10 @@ private:
   void addHistoryContributionToTotalBinHistogram( const size_t bin_index,
                                                   const double contribution );
 
-  // Reduce the entity collections
-  void reduceEntityCollections(
-                   const std::vector<EntityEstimatorMomentsCollectionMap>&
-                   other_entity_estimator_moments_maps,
-                   const size_t root_index,
-                   EntityEstimatorMomentsCollectionMap& collection_map ) const;
+  // Get the sorted entity ids of an entity collection map
+  static void getSortedEntityIds(
+                   const EntityEstimatorMomentsCollectionMap& collection_map,
+                   std::vector<EntityId>& entity_ids );
 
   // Reduce the entity snapshots
   void reduceEntitySnapshots(
@@ -347,9 +403,15 @@ private:
   void printEntityNormConstants( std::ostream& os,
 				 const std::string& entity_type ) const;
 
-  // Serialize the entity estimator
+  // Save the entity estimator
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the entity estimator
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version );
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
@@ -389,11 +451,31 @@ private:
 
   // The entity normalization constants (surface areas or cell volumes)
   EntityNormConstMap d_entity_norm_constants_map;
+
+  // Bool that records if thread-private moment accumulation has been enabled
+  bool d_thread_private_moments_enabled;
+
+  // The thread-private moments (only used with multiple threads)
+  std::vector<ThreadPrivateMoments> d_thread_private_moments;
+
+  // The data that is updated during a simulation
+  struct ArchiveSnapshot
+  {
+    FourEstimatorMomentsCollection estimator_total_bin_data;
+    EntityEstimatorMomentsCollectionMap entity_estimator_moments_map;
+    FourEstimatorMomentsCollectionSnapshots estimator_total_bin_data_snapshots;
+    EntityEstimatorMomentsCollectionSnapshotsMap entity_estimator_moments_snapshots_map;
+    SampleMomentHistogramArray estimator_total_bin_histograms;
+    EntityEstimatorSampleMomentHistogramArrayMap entity_estimator_histograms_map;
+  };
+
+  // The data captured for an archive
+  std::unique_ptr<const ArchiveSnapshot> d_archive_snapshot;
 };
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( EntityEstimator, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( EntityEstimator, MonteCarlo, 1 );
 
 //---------------------------------------------------------------------------//
 // Template Includes.
@@ -36,7 +36,9 @@ EntityEstimator::EntityEstimator(
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_thread_private_moments_enabled( false ),
+    d_thread_private_moments()
 {
   TEST_FOR_EXCEPTION( entity_ids.empty(),
                       std::runtime_error,
@@ -76,7 +78,9 @@ EntityEstimator::EntityEstimator( const Id id,
     d_entity_bin_histograms_enabled( false ),
     d_estimator_total_bin_histograms(),
     d_entity_estimator_histograms_map(),
-    d_entity_norm_constants_map()
+    d_entity_norm_constants_map(),
+    d_thread_private_moments_enabled( false ),
+    d_thread_private_moments()
 {
   TEST_FOR_EXCEPTION( entity_ids.empty(),
                       std::runtime_error,
@@ -155,14 +159,74 @@ void EntityEstimator::initializeEntityNormConstantsMap(
   }
 }
 
-// Serialize the entity estimator
+// Save the entity estimator
+/*! \details If the data that is updated during a simulation has been
+ * captured (see EntityEstimator::takeArchiveSnapshot) it will be saved
+ * instead of the current data.
+ */
 template<typename Archive>
-void EntityEstimator::serialize( Archive& ar, const unsigned version )
+void EntityEstimator::save( Archive& ar, const unsigned version ) const
 {
-  // Serialize the base class data
+  // Save the base class data
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Estimator );
 
-  // Serialize the local data
+  const ArchiveSnapshot* snapshot = d_archive_snapshot.get();
+
+  const FourEstimatorMomentsCollection& estimator_total_bin_data =
+    snapshot ? snapshot->estimator_total_bin_data : d_estimator_total_bin_data;
+
+  const EntityEstimatorMomentsCollectionMap& entity_estimator_moments_map =
+    snapshot ? snapshot->entity_estimator_moments_map :
+    d_entity_estimator_moments_map;
+
+  const FourEstimatorMomentsCollectionSnapshots&
+    estimator_total_bin_data_snapshots = snapshot ?
+    snapshot->estimator_total_bin_data_snapshots :
+    d_estimator_total_bin_data_snapshots;
+
+  const EntityEstimatorMomentsCollectionSnapshotsMap&
+    entity_estimator_moments_snapshots_map = snapshot ?
+    snapshot->entity_estimator_moments_snapshots_map :
+    d_entity_estimator_moments_snapshots_map;
+
+  const SampleMomentHistogramArray& estimator_total_bin_histograms =
+    snapshot ? snapshot->estimator_total_bin_histograms :
+    d_estimator_total_bin_histograms;
+
+  const EntityEstimatorSampleMomentHistogramArrayMap&
+    entity_estimator_histograms_map = snapshot ?
+    snapshot->entity_estimator_histograms_map :
+    d_entity_estimator_histograms_map;
+
+  // Save the local data
+  ar & BOOST_SERIALIZATION_NVP( d_total_norm_constant );
+  ar & BOOST_SERIALIZATION_NVP( d_supplied_norm_constants );
+  ar & boost::serialization::make_nvp( "d_estimator_total_bin_data",
+                                       estimator_total_bin_data );
+  ar & boost::serialization::make_nvp( "d_entity_estimator_moments_map",
+                                       entity_estimator_moments_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_bin_snapshots_enabled );
+  ar & boost::serialization::make_nvp( "d_estimator_total_bin_data_snapshots",
+                                       estimator_total_bin_data_snapshots );
+  ar & boost::serialization::make_nvp( "d_entity_estimator_moments_snapshots_map",
+                                       entity_estimator_moments_snapshots_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_bin_histograms_enabled );
+  ar & boost::serialization::make_nvp( "d_estimator_total_bin_histograms",
+                                       estimator_total_bin_histograms );
+  ar & boost::serialization::make_nvp( "d_entity_estimator_histograms_map",
+                                       entity_estimator_histograms_map );
+  ar & BOOST_SERIALIZATION_NVP( d_entity_norm_constants_map );
+  ar & BOOST_SERIALIZATION_NVP( d_thread_private_moments_enabled );
+}
+
+// Load the entity estimator
+template<typename Archive>
+void EntityEstimator::load( Archive& ar, const unsigned version )
+{
+  // Load the base class data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Estimator );
+
+  // Load the local data
   ar & BOOST_SERIALIZATION_NVP( d_total_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_supplied_norm_constants );
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_data );
@@ -174,12 +238,21 @@ void EntityEstimator::serialize( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_histograms );
   ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_histograms_map );
   ar & BOOST_SERIALIZATION_NVP( d_entity_norm_constants_map );
+
+  // Thread-private moment accumulation was added in version 1
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_thread_private_moments_enabled );
+  else
+    d_thread_private_moments_enabled = false;
+
+  // The thread-private moments must be reinitialized after a load
+  d_thread_private_moments.clear();
 }
 
 } // end MonteCarlo namespace
 
 BOOST_SERIALIZATION_ASSUME_ABSTRACT_CLASS( EntityEstimator, MonteCarlo );
-EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, EntityEstimator );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, EntityEstimator );
 
 #endif // end MONTE_CARLO_ENTITY_ESTIMATOR_DEF_HPP
 
@@ -205,20 +205,27 @@ void Estimator::setCosineCutoffValue( const double )
 }
 
 // Check if the estimator has uncommitted history contributions
+/*! \details The slot index must be calculated in the same way as
+ * ParticleHistoryObserver::getHistoryContributionSlotIndex (with a single
+ * history contribution slot per thread the slot index is the thread id).
+ */
 bool Estimator::hasUncommittedHistoryContribution(
-					       const unsigned thread_id ) const
+					       const unsigned slot_index ) const
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_has_uncommitted_history_contribution.size());
 
-  return d_has_uncommitted_history_contribution[thread_id];
+  return d_has_uncommitted_history_contribution[slot_index];
 }
 
 // Check if the estimator has uncommitted history contributions
+/*! \details Only the selected history contribution slot of the calling
+ * thread will be checked.
+ */
 bool Estimator::hasUncommittedHistoryContribution() const
 {
   return this->hasUncommittedHistoryContribution(
-				    Utility::OpenMPProperties::getThreadId() );
+                                     this->getHistoryContributionSlotIndex() );
 }
 
 // Enable support for multiple threads
@@ -227,17 +234,148 @@ void Estimator::enableThreadSupport( const unsigned num_threads )
   // Make sure only the master thread calls this function
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
 
-  d_has_uncommitted_history_contribution.resize( num_threads, false );
+  d_has_uncommitted_history_contribution.resize(
+            num_threads*this->getNumberOfHistoryContributionSlots(), false );
 }
 
 // Reduce estimator data on all processes and collect on the root process
+/*! \details The estimator moments are packed into a single buffer, which is
+ * summed using a hierarchical (node-local then inter-node) reduction. When
+ * the data of multiple estimators must be reduced it is more efficient to
+ * pack the moments of all of the estimators into a single buffer (see
+ * MonteCarlo::EventHandler::reduceObserverData). The reducer created by this
+ * method is only used once - when the data will be reduced repeatedly the
+ * reducer should be created once and passed to the other overload.
+ */
 void Estimator::reduceData( const Utility::Communicator& comm,
                             const int root_process )
 {
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  // Only do the reduction if there is more than one process
+  if( comm.size() > 1 )
+  {
+    Utility::HierarchicalReducer reducer( comm, root_process );
+
+    this->reduceData( reducer, comm, root_process );
+  }
+  else
+  {
+    this->mergeThreadPrivateMoments();
+
+    this->completeReduction( comm, root_process );
+  }
+}
+
+// Reduce estimator data on all processes and collect on the root process
+/*! \details The reducer must have been created from the communicator with
+ * the same root process. This method must be called by all processes in the
+ * communicator.
+ */
+void Estimator::reduceData( Utility::HierarchicalReducer& reducer,
+                            const Utility::Communicator& comm,
+                            const int root_process )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  // Only do the reduction if there is more than one process
+  if( comm.size() > 1 )
+  {
+    std::vector<double> moments;
+
+    this->packMomentsForReduction( moments );
+
+    try{
+      reducer.reduceSum( moments );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform mpi reduction in estimator "
+                             << d_id << " for the moment data!" );
+
+    if( comm.rank() == root_process )
+    {
+      size_t offset = 0;
+      
+      this->unpackReducedMoments( moments, offset );
+    }
+  }
+  else
+    this->mergeThreadPrivateMoments();
+
+  this->completeReduction( comm, root_process );
+}
+
+// Pack the estimator moments into a reduction buffer
+/*! \details The thread-private moments will be merged before the moments
+ * are packed. The moments will be appended to the buffer.
+ */
+void Estimator::packMomentsForReduction( std::vector<double>& moments )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // Bring the estimator moments up-to-date before packing them
+  this->mergeThreadPrivateMoments();
+
+  this->packMoments( moments );
+}
+
+// Unpack the reduced estimator moments from a reduction buffer
+/*! \details The moments will be unpacked starting at the offset, which will
+ * be advanced past the moments of this estimator.
+ */
+void Estimator::unpackReducedMoments(
+                                    const std::vector<double>& reduced_moments,
+                                    size_t& offset )
+{
+  // Make sure that the offset is valid
+  testPrecondition( offset <= reduced_moments.size() );
+
+  this->unpackMoments( reduced_moments, offset );
+}
+
+// Reduce the estimator data that is not packed and complete the reduction
+/*! \details This must be called after the packed moments have been reduced
+ * and unpacked on the root process. The data on all non-root processes will
+ * be reset.
+ */
+void Estimator::completeReduction( const Utility::Communicator& comm,
+                                   const int root_process )
+{
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  if( comm.size() > 1 )
+    this->reduceUnpackedData( comm, root_process );
+
   if( comm.rank() != root_process )
     this->resetData();
 }
 
+// Merge the thread-private moments into the estimator moments
+void Estimator::mergeThreadPrivateMoments()
+{ /* ... */ }
+
+// Pack the estimator moments into a reduction buffer (implementation)
+void Estimator::packMoments( std::vector<double>& moments ) const
+{ /* ... */ }
+
+// Unpack the reduced estimator moments (implementation)
+void Estimator::unpackMoments( const std::vector<double>& reduced_moments,
+                               size_t& offset )
+{ /* ... */ }
+
+// Reduce the estimator data that is not packed (e.g. snapshots)
+void Estimator::reduceUnpackedData( const Utility::Communicator& comm,
+                                    const int root_process )
+{ /* ... */ }
+
 // Log a summary of the data
 void Estimator::logSummary() const
 {
@@ -1007,12 +1145,12 @@ size_t Estimator::getNumberOfAssignedParticleTypes() const
  * to the estimator.
  */
 void Estimator::setHasUncommittedHistoryContribution(
-						     const unsigned thread_id )
+						     const unsigned slot_index )
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_has_uncommitted_history_contribution.size());
 
-  d_has_uncommitted_history_contribution[thread_id] = true;
+  d_has_uncommitted_history_contribution[slot_index] = true;
 }
 
 // Unset the has uncommited history contribution flag
@@ -1020,113 +1158,50 @@ void Estimator::setHasUncommittedHistoryContribution(
  * committed to the estimator
  */
 void Estimator::unsetHasUncommittedHistoryContribution(
-						     const unsigned thread_id )
+						     const unsigned slot_index )
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_has_uncommitted_history_contribution.size());
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_has_uncommitted_history_contribution.size());
 
-  d_has_uncommitted_history_contribution[thread_id] = false;
+  d_has_uncommitted_history_contribution[slot_index] = false;
 }
 
-// Reduce a single collection
-void Estimator::reduceCollection(
-                              const Utility::Communicator& comm,
-                              const int root_process,
-                              TwoEstimatorMomentsCollection& collection ) const
+// Pack the moments of a collection into a reduction buffer
+void Estimator::packCollection( const TwoEstimatorMomentsCollection& collection,
+                                std::vector<double>& moments )
 {
-  // Make sure the root process is valid
-  testPrecondition( root_process < comm.size() );
-
-  // Reduce the first moments
-  std::vector<double> reduced_first_moments;
-
-  this->reduceCollectionAndReturnReducedMoments<1>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_first_moments );
-  comm.barrier();
-  
-  // Reduce the second moments
-  std::vector<double> reduced_second_moments;
-      
-  this->reduceCollectionAndReturnReducedMoments<2>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_second_moments );
-
-  // The root process will store the reduced moments
-  if( comm.rank() == root_process )
-  {
-    for( size_t i = 0; i < collection.size(); ++i )
-    {
-      Utility::getCurrentScore<1>( collection, i ) = reduced_first_moments[i];
-      
-      Utility::getCurrentScore<2>( collection, i ) = reduced_second_moments[i];
-    }
-  }
-
-  comm.barrier();
+  Estimator::packCollectionMoments<1>( collection, moments );
+  Estimator::packCollectionMoments<2>( collection, moments );
 }
 
-// Reduce a single collection
-void Estimator::reduceCollection(
-                             const Utility::Communicator& comm,
-                             const int root_process,
-                             FourEstimatorMomentsCollection& collection ) const
+// Pack the moments of a collection into a reduction buffer
+void Estimator::packCollection( const FourEstimatorMomentsCollection& collection,
+                                std::vector<double>& moments )
 {
-  // Make sure the root process is valid
-  testPrecondition( root_process < comm.size() );
-
-  // Reduce the first moments
-  std::vector<double> reduced_first_moments;
-
-  this->reduceCollectionAndReturnReducedMoments<1>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_first_moments );
-  comm.barrier();
-  
-  // Reduce the second moments
-  std::vector<double> reduced_second_moments;
-      
-  this->reduceCollectionAndReturnReducedMoments<2>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_second_moments );
-
-  comm.barrier();
-
-  // Reduce the third moments
-  std::vector<double> reduced_third_moments;
-
-  this->reduceCollectionAndReturnReducedMoments<3>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_third_moments );
-
-  comm.barrier();
-
-  // Reduce the fourth moments
-  std::vector<double> reduced_fourth_moments;
-
-  this->reduceCollectionAndReturnReducedMoments<4>( comm,
-                                                    root_process,
-                                                    collection,
-                                                    reduced_fourth_moments );
+  Estimator::packCollectionMoments<1>( collection, moments );
+  Estimator::packCollectionMoments<2>( collection, moments );
+  Estimator::packCollectionMoments<3>( collection, moments );
+  Estimator::packCollectionMoments<4>( collection, moments );
+}
 
-  // The root process will store the reduced moments
-  if( comm.rank() == root_process )
-  {
-    for( size_t i = 0; i < collection.size(); ++i )
-    {
-      Utility::getCurrentScore<1>( collection, i ) = reduced_first_moments[i];
-      Utility::getCurrentScore<2>( collection, i ) = reduced_second_moments[i];
-      Utility::getCurrentScore<3>( collection, i ) = reduced_third_moments[i];
-      Utility::getCurrentScore<4>( collection, i ) = reduced_fourth_moments[i];
-    }
-  }
+// Unpack the reduced moments of a collection from a reduction buffer
+void Estimator::unpackCollection( const std::vector<double>& reduced_moments,
+                                  size_t& offset,
+                                  TwoEstimatorMomentsCollection& collection )
+{
+  Estimator::unpackCollectionMoments<1>( reduced_moments, offset, collection );
+  Estimator::unpackCollectionMoments<2>( reduced_moments, offset, collection );
+}
 
-  comm.barrier();
+// Unpack the reduced moments of a collection from a reduction buffer
+void Estimator::unpackCollection( const std::vector<double>& reduced_moments,
+                                  size_t& offset,
+                                  FourEstimatorMomentsCollection& collection )
+{
+  Estimator::unpackCollectionMoments<1>( reduced_moments, offset, collection );
+  Estimator::unpackCollectionMoments<2>( reduced_moments, offset, collection );
+  Estimator::unpackCollectionMoments<3>( reduced_moments, offset, collection );
+  Estimator::unpackCollectionMoments<4>( reduced_moments, offset, collection );
 }
 
 // Reduce snapshots
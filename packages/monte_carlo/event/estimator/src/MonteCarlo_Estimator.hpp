@@ -31,6 +31,7 @@
 #include "Utility_SampleMomentCollection.hpp"
 #include "Utility_SampleMomentCollectionSnapshots.hpp"
 #include "Utility_SampleMomentHistogram.hpp"
+#include "Utility_HierarchicalReducer.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_List.hpp"
@@ -134,6 +135,12 @@ public:
   //! Check if sample moment histograms are enabled on on entity bins
   virtual bool areSampleMomentHistogramsOnEntityBinsEnabled() const = 0;
 
+  //! Enable thread-private moment accumulation
+  virtual void enableThreadPrivateMomentAccumulation() = 0;
+
+  //! Check if thread-private moment accumulation has been enabled
+  virtual bool isThreadPrivateMomentAccumulationEnabled() const = 0;
+
   //! Get the total estimator bin data first moments
   virtual Utility::ArrayView<const double> getTotalBinDataFirstMoments() const = 0;
 
@@ -438,7 +445,7 @@ public:
   virtual void setCosineCutoffValue( const double cosine_cutoff );
 
   //! Check if the estimator has uncommitted history contributions
-  bool hasUncommittedHistoryContribution( const unsigned thread_id ) const;
+  bool hasUncommittedHistoryContribution( const unsigned slot_index ) const;
 
   //! Check if the estimator has uncommitted history contributions
   bool hasUncommittedHistoryContribution() const final override;
@@ -448,7 +455,23 @@ public:
 
   //! Reduce estimator data on all processes and collect on the root process
   void reduceData( const Utility::Communicator& comm,
-                   const int root_process ) override;
+                   const int root_process ) final override;
+
+  //! Reduce estimator data on all processes and collect on the root process
+  void reduceData( Utility::HierarchicalReducer& reducer,
+                   const Utility::Communicator& comm,
+                   const int root_process );
+
+  //! Pack the estimator moments into a reduction buffer
+  void packMomentsForReduction( std::vector<double>& moments );
+
+  //! Unpack the reduced estimator moments from a reduction buffer
+  void unpackReducedMoments( const std::vector<double>& reduced_moments,
+                             size_t& offset );
+
+  //! Reduce the estimator data that is not packed and complete the reduction
+  void completeReduction( const Utility::Communicator& comm,
+                          const int root_process );
 
   //! Log a summary of the data
   void logSummary() const final override;
@@ -474,22 +497,42 @@ protected:
   const std::shared_ptr<const std::vector<double> >& getSampleMomentHistogramBins();
 
   //! Set the has uncommitted history contribution flag
-  void setHasUncommittedHistoryContribution( const unsigned thread_id );
+  void setHasUncommittedHistoryContribution( const unsigned slot_index );
 
   //! Unset the has uncommitted history contribution flag
-  void unsetHasUncommittedHistoryContribution( const unsigned thread_id );
+  void unsetHasUncommittedHistoryContribution( const unsigned slot_index );
+
+  //! Merge the thread-private moments into the estimator moments
+  virtual void mergeThreadPrivateMoments();
 
-  //! Reduce a single collection
-  void reduceCollection(
-                      const Utility::Communicator& comm,
-                      const int root_process,
-                      TwoEstimatorMomentsCollection& collection ) const;
+  //! Pack the estimator moments into a reduction buffer (implementation)
+  virtual void packMoments( std::vector<double>& moments ) const;
 
-  //! Reduce a single collection
-  void reduceCollection(
-                      const Utility::Communicator& comm,
-                      const int root_process,
-                      FourEstimatorMomentsCollection& collection ) const;
+  //! Unpack the reduced estimator moments (implementation)
+  virtual void unpackMoments( const std::vector<double>& reduced_moments,
+                              size_t& offset );
+
+  //! Reduce the estimator data that is not packed (e.g. snapshots)
+  virtual void reduceUnpackedData( const Utility::Communicator& comm,
+                                   const int root_process );
+
+  //! Pack the moments of a collection into a reduction buffer
+  static void packCollection( const TwoEstimatorMomentsCollection& collection,
+                              std::vector<double>& moments );
+
+  //! Pack the moments of a collection into a reduction buffer
+  static void packCollection( const FourEstimatorMomentsCollection& collection,
+                              std::vector<double>& moments );
+
+  //! Unpack the reduced moments of a collection from a reduction buffer
+  static void unpackCollection( const std::vector<double>& reduced_moments,
+                                size_t& offset,
+                                TwoEstimatorMomentsCollection& collection );
+
+  //! Unpack the reduced moments of a collection from a reduction buffer
+  static void unpackCollection( const std::vector<double>& reduced_moments,
+                                size_t& offset,
+                                FourEstimatorMomentsCollection& collection );
 
   //! Reduce snapshots
   void reduceSnapshots(
@@ -605,13 +648,17 @@ private:
                        double& variance_of_variance,
                        double& figure_of_merit ) const;
 
-  // Reduce a single collection and return the reduced moments
+  // Pack the moments of order N of a collection into a reduction buffer
+  template<size_t N, typename Collection>
+  static void packCollectionMoments( const Collection& collection,
+                                     std::vector<double>& moments );
+
+  // Unpack the reduced moments of order N of a collection
   template<size_t N, typename Collection>
-  void reduceCollectionAndReturnReducedMoments(
-                                  const Utility::Communicator& comm,
-                                  const int root_process,
-                                  const Collection& collection,
-                                  std::vector<double>& reduced_moments ) const;
+  static void unpackCollectionMoments(
+                                   const std::vector<double>& reduced_moments,
+                                   size_t& offset,
+                                   Collection& collection );
 
   // Save the data to an archive
   template<typename Archive>
@@ -644,7 +691,8 @@ private:
   // The sample moment histogram bins
   std::shared_ptr<const std::vector<double> > d_sample_moment_histogram_bins;
 
-  // Records if there is an uncommitted history contribution for a thread
+  // Records if there is an uncommitted history contribution for a history
+  // contribution slot
   // Note: uint8_t is used instead of bool deliberately due to a
   //       unusual thread safety issue that was encountered with
   //       std::vector<bool>.
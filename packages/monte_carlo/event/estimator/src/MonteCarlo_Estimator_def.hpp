@@ -39,30 +39,31 @@ void Estimator::calculateBinIndicesOfPoint(
     bin_indices[i] += response_function_index*this->getNumberOfBins();
 }
 
-// Reduce a single collection and return the reduced moments
+// Pack the moments of order N of a collection into a reduction buffer
 template<size_t N, typename Collection>
-void Estimator::reduceCollectionAndReturnReducedMoments(
-                             const Utility::Communicator& comm,
-                             const int root_process,
-                             const Collection& collection,
-                             std::vector<double>& reduced_moments ) const
+void Estimator::packCollectionMoments( const Collection& collection,
+                                       std::vector<double>& moments )
 {
-  // Make sure the root process is valid
-  testPrecondition( root_process < comm.size() );
-
-  // Resize the reduced moments array
-  reduced_moments.resize( collection.size() );
-
-  try{
-    Utility::reduce( comm,
-                     Utility::ArrayView<const double>( Utility::getCurrentScores<N>( collection ), collection.size() ),
-                     Utility::arrayView( reduced_moments ),
-                     std::plus<double>(),
-                     root_process );
-  }
-  EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                           "Unable to perform mpi reduction over moments of "
-                           "order " << N << " for estimator " << d_id << "!" );
+  const double* scores = Utility::getCurrentScores<N>( collection );
+
+  moments.insert( moments.end(), scores, scores + collection.size() );
+}
+
+// Unpack the reduced moments of order N of a collection
+template<size_t N, typename Collection>
+void Estimator::unpackCollectionMoments(
+                                    const std::vector<double>& reduced_moments,
+                                    size_t& offset,
+                                    Collection& collection )
+{
+  // Make sure that the reduced moments are valid
+  testPrecondition( offset + collection.size() <= reduced_moments.size() );
+
+  std::copy( reduced_moments.begin() + offset,
+             reduced_moments.begin() + offset + collection.size(),
+             Utility::getCurrentScores<N>( collection ) );
+
+  offset += collection.size();
 }
 
 // Save the data to an archive
@@ -30,7 +30,8 @@ StandardEntityEstimator::StandardEntityEstimator(
     d_entity_total_estimator_moment_snapshots_map(),
     d_total_estimator_histograms( 1 ),
     d_entity_total_estimator_histograms_map(),
-    d_update_tracker( 1 )
+    d_update_tracker( 1 ),
+    d_thread_private_total_moments()
 { /* ... */ }
 
 // Check if total data is available
@@ -133,6 +134,9 @@ void StandardEntityEstimator::takeSnapshot( const uint64_t num_histories_since_l
 {
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // Bring the estimator moments up-to-date before taking the snapshot
+  this->mergeThreadPrivateMoments();
   
   d_total_estimator_moment_snapshots.takeSnapshot( num_histories_since_last_snapshot,
                                                    time_since_last_snapshot,
@@ -428,6 +432,9 @@ void StandardEntityEstimator::commitHistoryContribution()
   // Thread id
   size_t thread_id = Utility::OpenMPProperties::getThreadId();
 
+  // The history contribution slot of the history that is being committed
+  size_t slot_index = this->getHistoryContributionSlotIndex();
+
   // Number of bins per response function
   size_t num_bins = this->getNumberOfBins();
 
@@ -443,17 +450,24 @@ void StandardEntityEstimator::commitHistoryContribution()
   // The bin totals over all entities
   BinContributionMap bin_totals;
 
+  // Mark the thread-private total moments as updated
+  if( this->areThreadPrivateMomentsUsed() )
+  {
+    if( !d_thread_private_total_moments[thread_id].updated )
+      d_thread_private_total_moments[thread_id].updated = true;
+  }
+
   // Get the entities with updated data
   typename SerialUpdateTracker::const_iterator entity, end_entity;
 
-  this->getEntityIteratorFromUpdateTracker( thread_id, entity, end_entity );
+  this->getEntityIteratorFromUpdateTracker( slot_index, entity, end_entity );
 
   while( entity != end_entity )
   {
     // Process each updated bin
     BinContributionMap::const_iterator bin_data, end_bin_data;
 
-    this->getBinIteratorFromUpdateTrackerIterator( thread_id,
+    this->getBinIteratorFromUpdateTrackerIterator( slot_index,
                                                    entity,
                                                    bin_data,
                                                    end_bin_data );
@@ -512,10 +526,10 @@ void StandardEntityEstimator::commitHistoryContribution()
   }
 
   // Reset the update tracker
-  this->resetUpdateTracker( thread_id );
+  this->resetUpdateTracker( slot_index );
 
   // Unset the uncommitted history contribution flag
-  this->unsetHasUncommittedHistoryContribution( thread_id );
+  this->unsetHasUncommittedHistoryContribution( slot_index );
 }
 
 // Enable support for multiple threads
@@ -526,8 +540,16 @@ void StandardEntityEstimator::enableThreadSupport( const unsigned num_threads )
 
   EntityEstimator::enableThreadSupport( num_threads );
 
-  // Add thread support to update tracker
-  d_update_tracker.resize( num_threads );
+  // Add thread support to update tracker (one for each history
+  // contribution slot)
+  d_update_tracker.resize(
+                     num_threads*this->getNumberOfHistoryContributionSlots() );
+
+  // Add thread support to the total moments
+  if( this->areThreadPrivateMomentsUsed() )
+    this->initializeThreadPrivateTotalMoments( num_threads );
+  else
+    d_thread_private_total_moments.clear();
 }
 
 // Reset the estimator data
@@ -570,79 +592,132 @@ void StandardEntityEstimator::resetData()
 
     this->unsetHasUncommittedHistoryContribution( i );
   }
+
+  // Reset the thread-private total moments
+  for( auto&& thread_moments : d_thread_private_total_moments )
+  {
+    thread_moments.total_estimator_moments.reset();
+
+    for( auto&& entity_data : thread_moments.entity_total_estimator_moments_map )
+      entity_data.second.reset();
+
+    for( auto&& histogram : thread_moments.total_estimator_histograms )
+      histogram.reset();
+
+    for( auto&& entity_data : thread_moments.entity_total_estimator_histograms_map )
+    {
+      for( auto&& histogram : entity_data.second )
+        histogram.reset();
+    }
+
+    thread_moments.updated = false;
+  }
 }
 
-// Reduce estimator data on all processes and collect on the root process
-void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
-                                          const int root_process )
+// Capture the data that will be saved to an archive
+void StandardEntityEstimator::takeArchiveSnapshot()
 {
-  // Make sure only the root thread calls this
-  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
-  // Make sure the root process is valid
-  testPrecondition( root_process < comm.size() );
+  EntityEstimator::takeArchiveSnapshot();
+
+  std::unique_ptr<ArchiveSnapshot> snapshot( new ArchiveSnapshot );
+
+  snapshot->total_estimator_moments = d_total_estimator_moments;
+  snapshot->entity_total_estimator_moments_map =
+    d_entity_total_estimator_moments_map;
+  snapshot->total_estimator_moment_snapshots =
+    d_total_estimator_moment_snapshots;
+  snapshot->entity_total_estimator_moment_snapshots_map =
+    d_entity_total_estimator_moment_snapshots_map;
+  snapshot->total_estimator_histograms = d_total_estimator_histograms;
+  snapshot->entity_total_estimator_histograms_map =
+    d_entity_total_estimator_histograms_map;
+
+  d_archive_snapshot = std::move( snapshot );
+}
 
-  // Only do the reduction if there is more than one process
-  if( comm.size() > 1 )
-  {
-    // Reduce the entity data
-    try{
-      this->reduceEntityCollectionMaps( comm, root_process, d_entity_total_estimator_moments_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in "
-                             "standard entity estimator " << this->getId() <<
-                             " for entity total data!" );
+// Release the data that was captured for an archive
+void StandardEntityEstimator::releaseArchiveSnapshot()
+{
+  EntityEstimator::releaseArchiveSnapshot();
 
-    comm.barrier();
+  d_archive_snapshot.reset();
+}
 
-    // Reduce the total data
-    try{
-      this->reduceCollection( comm, root_process, d_total_estimator_moments );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in "
-                             "standard entity estimator " << this->getId() <<
-                             " for total data!" );
-
-    // Reduce the entity snapshot data
-    try{
-      this->reduceEntitySnapshotMaps( comm, root_process, d_entity_total_estimator_moment_snapshots_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in "
-                             "standard entity estimator " << this->getId() <<
-                             " for entity total snapshot data!" );
-
-    // Reduce the total snapshot data
-    try{
-      this->reduceSnapshots( comm, root_process, d_total_estimator_moment_snapshots );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in "
-                             "standard entity estimator " << this->getId() <<
-                             " for total snapshot data!" );
-
-    // Reduce the entity histogram data
-    try{
-      this->reduceEntityHistogramMaps( comm, root_process, d_entity_total_estimator_histograms_map );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in "
-                             "standard entity estimator " << this->getId() <<
-                             " for entity total histograms!" );
-
-    // Reduce the total histogram data
-    try{
-      this->reduceHistogramArrays( comm, root_process, d_total_estimator_histograms );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Unable to perform mpi reduction in "
-                             "standard entity estimator " << this->getId() <<
-                             " for total histograms!" );
+// Pack the estimator moments into a reduction buffer (implementation)
+void StandardEntityEstimator::packMoments( std::vector<double>& moments ) const
+{
+  this->packEntityCollectionMap( d_entity_total_estimator_moments_map,
+                                 moments );
+
+  Estimator::packCollection( d_total_estimator_moments, moments );
+
+  // Pack the bin data
+  EntityEstimator::packMoments( moments );
+}
+
+// Unpack the reduced estimator moments (implementation)
+void StandardEntityEstimator::unpackMoments(
+                                    const std::vector<double>& reduced_moments,
+                                    size_t& offset )
+{
+  this->unpackEntityCollectionMap( reduced_moments,
+                                   offset,
+                                   d_entity_total_estimator_moments_map );
+
+  Estimator::unpackCollection( reduced_moments,
+                               offset,
+                               d_total_estimator_moments );
+
+  // Unpack the bin data
+  EntityEstimator::unpackMoments( reduced_moments, offset );
+}
+
+// Reduce the estimator data that is not packed (e.g. snapshots)
+void StandardEntityEstimator::reduceUnpackedData(
+                                             const Utility::Communicator& comm,
+                                             const int root_process )
+{
+  // Make sure the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  // Reduce the entity snapshot data
+  try{
+    this->reduceEntitySnapshotMaps( comm, root_process, d_entity_total_estimator_moment_snapshots_map );
   }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction in "
+                           "standard entity estimator " << this->getId() <<
+                           " for entity total snapshot data!" );
+
+  // Reduce the total snapshot data
+  try{
+    this->reduceSnapshots( comm, root_process, d_total_estimator_moment_snapshots );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction in "
+                           "standard entity estimator " << this->getId() <<
+                           " for total snapshot data!" );
+
+  // Reduce the entity histogram data
+  try{
+    this->reduceEntityHistogramMaps( comm, root_process, d_entity_total_estimator_histograms_map );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction in "
+                           "standard entity estimator " << this->getId() <<
+                           " for entity total histograms!" );
+
+  // Reduce the total histogram data
+  try{
+    this->reduceHistogramArrays( comm, root_process, d_total_estimator_histograms );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to perform mpi reduction in "
+                           "standard entity estimator " << this->getId() <<
+                           " for total histograms!" );
 
   // Reduce the bin data
-  EntityEstimator::reduceData( comm, root_process );
+  EntityEstimator::reduceUnpackedData( comm, root_process );
 }
 
 // Assign entities
@@ -770,15 +845,15 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
 		   const ObserverParticleStateWrapper& particle_state_wrapper,
                    const double contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+  // Make sure the history contribution slot index is valid
+  testPrecondition( this->getHistoryContributionSlotIndex() <
 		    d_update_tracker.size() );
   // Make sure the entity is assigned to the estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
   // Make sure that the particle type is assigned
   testPrecondition( this->isParticleTypeAssigned( particle_state_wrapper.getParticleState().getParticleType() ) );
 
-  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+  const size_t slot_index = this->getHistoryContributionSlotIndex();
 
   // Only add the contribution if the particle state is in the phase space
   if( this->isPointInObserverPhaseSpace( particle_state_wrapper ) )
@@ -798,7 +873,7 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
 
       for( size_t i = 0; i < bin_indices.size(); ++i )
       {
-        this->addInfoToUpdateTracker( thread_id,
+        this->addInfoToUpdateTracker( slot_index,
                                       entity_id,
                                       bin_indices[i],
                                       processed_contribution );
@@ -809,8 +884,8 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
   }
 
   // Indicate that there is an uncommitted history contribution
-  if( !this->hasUncommittedHistoryContribution( thread_id ) )
-    this->setHasUncommittedHistoryContribution( thread_id );
+  if( !this->hasUncommittedHistoryContribution( slot_index ) )
+    this->setHasUncommittedHistoryContribution( slot_index );
 }
 
 // Add estimator contribution from a range of the current history
@@ -822,15 +897,15 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
                    const ObserverParticleStateWrapper& particle_state_wrapper,
                    const double contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+  // Make sure the history contribution slot index is valid
+  testPrecondition( this->getHistoryContributionSlotIndex() <
 		    d_update_tracker.size() );
   // Make sure the entity is assigned to the estimator
   testPrecondition( this->isEntityAssigned( entity_id ) );
   // Make sure that the particle type is assigned
   testPrecondition( this->isParticleTypeAssigned( particle_state_wrapper.getParticleState().getParticleType() ) );
 
-  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
+  const size_t slot_index = this->getHistoryContributionSlotIndex();
 
   // Only add the contribution if the particle state is in the phase space
   if( this->doesRangeIntersectObserverPhaseSpace( particle_state_wrapper ) )
@@ -856,7 +931,7 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
         const size_t complete_bin_index =
           Utility::get<0>( bin_indices_and_weights[i] ) + bin_index_shift;
 
-        this->addInfoToUpdateTracker( thread_id,
+        this->addInfoToUpdateTracker( slot_index,
                                       entity_id,
                                       complete_bin_index,
                                       processed_contribution );
@@ -865,8 +940,8 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
   }
 
   // Indicate that there is an uncommitted history contribution
-  if( !this->hasUncommittedHistoryContribution( thread_id ) )
-    this->setHasUncommittedHistoryContribution( thread_id );
+  if( !this->hasUncommittedHistoryContribution( slot_index ) )
+    this->setHasUncommittedHistoryContribution( slot_index );
 }
 
 // Get the total estimator data
@@ -925,14 +1000,22 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEntity(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Estimator::FourEstimatorMomentsCollection&
-    entity_total_estimator_moments_collection =
-    d_entity_total_estimator_moments_map.find( entity_id )->second;
-
-  // Update the moments
-  #pragma omp critical
+  if( this->areThreadPrivateMomentsUsed() )
   {
-    entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
+    // Update the thread-private moments (no synchronization required)
+    d_thread_private_total_moments[Utility::OpenMPProperties::getThreadId()].entity_total_estimator_moments_map.find( entity_id )->second.addRawScore( response_function_index, contribution );
+  }
+  else
+  {
+    Estimator::FourEstimatorMomentsCollection&
+      entity_total_estimator_moments_collection =
+      d_entity_total_estimator_moments_map.find( entity_id )->second;
+
+    // Update the moments
+    #pragma omp critical
+    {
+      entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
+    }
   }
 
   this->addHistoryContributionToEntityBinHistogram( entity_id, response_function_index, contribution );
@@ -952,13 +1035,21 @@ void StandardEntityEstimator::addHistoryContributionToEntityBinHistogram(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Utility::SampleMomentHistogram<double>& histogram =
-    d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index];
-
-  // Update the histogram
-  #pragma omp critical
+  if( this->areThreadPrivateMomentsUsed() )
+  {
+    // Update the thread-private histogram
+    d_thread_private_total_moments[Utility::OpenMPProperties::getThreadId()].entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index].addRawScore( contribution );
+  }
+  else
   {
-    histogram.addRawScore( contribution );
+    Utility::SampleMomentHistogram<double>& histogram =
+      d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index];
+
+    // Update the histogram
+    #pragma omp critical
+    {
+      histogram.addRawScore( contribution );
+    }
   }
 }  
 
@@ -973,10 +1064,18 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEstimator(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  // Update the moments
-  #pragma omp critical
+  if( this->areThreadPrivateMomentsUsed() )
+  {
+    // Update the thread-private moments (no synchronization required)
+    d_thread_private_total_moments[Utility::OpenMPProperties::getThreadId()].total_estimator_moments.addRawScore( response_function_index, contribution );
+  }
+  else
   {
-    d_total_estimator_moments.addRawScore( response_function_index, contribution );
+    // Update the moments
+    #pragma omp critical
+    {
+      d_total_estimator_moments.addRawScore( response_function_index, contribution );
+    }
   }
 
   this->addHistoryContributionToTotalBinHistogram( response_function_index,
@@ -994,28 +1093,36 @@ void StandardEntityEstimator::addHistoryContributionToTotalBinHistogram(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Utility::SampleMomentHistogram<double>& histogram =
-    d_total_estimator_histograms[response_function_index];
-  
-  // Update the histogram
-  #pragma omp critical
+  if( this->areThreadPrivateMomentsUsed() )
+  {
+    // Update the thread-private histogram
+    d_thread_private_total_moments[Utility::OpenMPProperties::getThreadId()].total_estimator_histograms[response_function_index].addRawScore( contribution );
+  }
+  else
   {
-    histogram.addRawScore( contribution );
+    Utility::SampleMomentHistogram<double>& histogram =
+      d_total_estimator_histograms[response_function_index];
+  
+    // Update the histogram
+    #pragma omp critical
+    {
+      histogram.addRawScore( contribution );
+    }
   }
 }
 
 // Add info to update tracker
 void StandardEntityEstimator::addInfoToUpdateTracker(
-						    const size_t thread_id,
+						    const size_t slot_index,
 						    const EntityId entity_id,
 						    const size_t bin_index,
 						    const double contribution )
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_update_tracker.size() );
 
   BinContributionMap& thread_entity_bin_contribution_map =
-    d_update_tracker[thread_id][entity_id];
+    d_update_tracker[slot_index][entity_id];
 
   BinContributionMap::iterator entity_bin_data =
     thread_entity_bin_contribution_map.find( bin_index );
@@ -1028,37 +1135,128 @@ void StandardEntityEstimator::addInfoToUpdateTracker(
 
 // Get the bin iterator from an update tracker iterator
 void StandardEntityEstimator::getEntityIteratorFromUpdateTracker(
-              const size_t thread_id,
+              const size_t slot_index,
 	      typename SerialUpdateTracker::const_iterator& start_entity,
 	      typename SerialUpdateTracker::const_iterator& end_entity ) const
 {
-  // Make sure the thread is is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_update_tracker.size() );
 
-  start_entity = d_update_tracker[thread_id].begin();
-  end_entity = d_update_tracker[thread_id].end();
+  start_entity = d_update_tracker[slot_index].begin();
+  end_entity = d_update_tracker[slot_index].end();
 }
 
 // Get the bin iterator from an update tracker iterator
 void StandardEntityEstimator::getBinIteratorFromUpdateTrackerIterator(
-           const size_t thread_id,
+           const size_t slot_index,
 	   const typename SerialUpdateTracker::const_iterator& entity_iterator,
 	   BinContributionMap::const_iterator& start_bin,
 	   BinContributionMap::const_iterator& end_bin ) const
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
+  // Make sure the slot index is valid
+  testPrecondition( slot_index < d_update_tracker.size() );
   // Make sure the entity iterator is valid
-  testPrecondition( entity_iterator != d_update_tracker[thread_id].end() );
+  testPrecondition( entity_iterator != d_update_tracker[slot_index].end() );
 
   start_bin = entity_iterator->second.begin();
   end_bin = entity_iterator->second.end();
 }
 
 // Reset the update tracker
-void StandardEntityEstimator::resetUpdateTracker( const size_t thread_id )
+void StandardEntityEstimator::resetUpdateTracker( const size_t slot_index )
+{
+  d_update_tracker[slot_index].clear();
+}
+
+// Merge the thread-private moments into the estimator moments
+/*! \details The thread-private total moments are merged in thread order
+ * before the entity bin moments are merged by the base class.
+ */
+void StandardEntityEstimator::mergeThreadPrivateMoments()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  for( size_t i = 0; i < d_thread_private_total_moments.size(); ++i )
+  {
+    ThreadPrivateTotalMoments& thread_moments =
+      d_thread_private_total_moments[i];
+
+    if( !thread_moments.updated )
+      continue;
+
+    d_total_estimator_moments.mergeCollections( thread_moments.total_estimator_moments );
+    thread_moments.total_estimator_moments.reset();
+
+    for( auto&& entity_data : thread_moments.entity_total_estimator_moments_map )
+    {
+      d_entity_total_estimator_moments_map.find( entity_data.first )->second.mergeCollections( entity_data.second );
+
+      entity_data.second.reset();
+    }
+
+    for( size_t j = 0; j < d_total_estimator_histograms.size(); ++j )
+    {
+      d_total_estimator_histograms[j].mergeHistograms( thread_moments.total_estimator_histograms[j] );
+
+      thread_moments.total_estimator_histograms[j].reset();
+    }
+
+    for( auto&& entity_data : thread_moments.entity_total_estimator_histograms_map )
+    {
+      SampleMomentHistogramArray& entity_histograms =
+        d_entity_total_estimator_histograms_map.find( entity_data.first )->second;
+
+      for( size_t j = 0; j < entity_histograms.size(); ++j )
+      {
+        entity_histograms[j].mergeHistograms( entity_data.second[j] );
+
+        entity_data.second[j].reset();
+      }
+    }
+
+    thread_moments.updated = false;
+  }
+
+  EntityEstimator::mergeThreadPrivateMoments();
+}
+
+// Initialize the thread-private total moments
+void StandardEntityEstimator::initializeThreadPrivateTotalMoments(
+                                                   const unsigned num_threads )
 {
-  d_update_tracker[thread_id].clear();
+  // Make sure the number of threads is valid
+  testPrecondition( num_threads > 0 );
+
+  d_thread_private_total_moments.resize( num_threads );
+
+  for( auto&& thread_moments : d_thread_private_total_moments )
+  {
+    thread_moments.total_estimator_moments = d_total_estimator_moments;
+    thread_moments.total_estimator_moments.reset();
+
+    thread_moments.entity_total_estimator_moments_map =
+      d_entity_total_estimator_moments_map;
+
+    for( auto&& entity_data : thread_moments.entity_total_estimator_moments_map )
+      entity_data.second.reset();
+
+    thread_moments.total_estimator_histograms = d_total_estimator_histograms;
+
+    for( auto&& histogram : thread_moments.total_estimator_histograms )
+      histogram.reset();
+
+    thread_moments.entity_total_estimator_histograms_map =
+      d_entity_total_estimator_histograms_map;
+
+    for( auto&& entity_data : thread_moments.entity_total_estimator_histograms_map )
+    {
+      for( auto&& histogram : entity_data.second )
+        histogram.reset();
+    }
+
+    thread_moments.updated = false;
+  }
 }
 
 EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::StandardEntityEstimator );
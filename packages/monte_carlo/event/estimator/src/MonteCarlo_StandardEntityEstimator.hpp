@@ -22,7 +22,9 @@ namespace MonteCarlo{
  * threads. However, the commitHistoryContribution member function call should
  * only appear within an omp critical block. Use the enable thread support
  * member function to set up an instance of this class for the requested number
- * of threads. The classes default initialization is for a single thread.
+ * of threads. The classes default initialization is for a single thread. If
+ * thread-private moment accumulation has been enabled the committed history
+ * contributions will only be visible after a snapshot has been taken.
  */
 class StandardEntityEstimator : public EntityEstimator
 {
@@ -185,9 +187,11 @@ public:
   //! Reset estimator data
   void resetData() final override;
 
-  //! Reduce estimator data on all processes and collect on the root process
-  void reduceData( const Utility::Communicator& comm,
-                   const int root_process ) final override;
+  //! Capture the data that will be saved to an archive
+  void takeArchiveSnapshot() final override;
+
+  //! Release the data that was captured for an archive
+  void releaseArchiveSnapshot() final override;
 
 protected:
 
@@ -229,8 +233,41 @@ protected:
   const Estimator::FourEstimatorMomentsCollection&
   getEntityTotalData( const EntityId entity_id ) const;
 
+  //! Merge the thread-private moments into the estimator moments
+  void mergeThreadPrivateMoments() override;
+
+  //! Pack the estimator moments into a reduction buffer (implementation)
+  void packMoments( std::vector<double>& moments ) const final override;
+
+  //! Unpack the reduced estimator moments (implementation)
+  void unpackMoments( const std::vector<double>& reduced_moments,
+                      size_t& offset ) final override;
+
+  //! Reduce the estimator data that is not packed (e.g. snapshots)
+  void reduceUnpackedData( const Utility::Communicator& comm,
+                           const int root_process ) final override;
+
 private:
 
+  // The thread-private estimator total moments
+  struct ThreadPrivateTotalMoments
+  {
+    // The total estimator moments across all entities and response functions
+    Estimator::FourEstimatorMomentsCollection total_estimator_moments;
+
+    // The total estimator moments for each entity and response functions
+    EntityEstimatorMomentsCollectionMap entity_total_estimator_moments_map;
+
+    // The sample moment histograms across all entities and response functions
+    SampleMomentHistogramArray total_estimator_histograms;
+
+    // The total estimator moment histograms for each entity and response func.
+    EntityEstimatorSampleMomentHistogramArrayMap entity_total_estimator_histograms_map;
+
+    // Records if the moments have been updated since the last merge
+    bool updated;
+  };
+
   // Resize the entity total estimator moments map collections
   void resizeEntityTotalEstimatorMomentsMapCollections();
 
@@ -261,26 +298,29 @@ private:
   void initializeMomentsMaps( const std::vector<InputEntityId>& entity_ids );
 
   // Add info to update tracker
-  void addInfoToUpdateTracker( const size_t thread_id,
+  void addInfoToUpdateTracker( const size_t slot_index,
                                const EntityId entity_id,
                                const size_t bin_index,
                                const double contribution );
 
   // Get entity iterators from update tracker
   void getEntityIteratorFromUpdateTracker(
-	      const size_t thread_id,
+	      const size_t slot_index,
 	      typename SerialUpdateTracker::const_iterator& start_entity,
 	      typename SerialUpdateTracker::const_iterator& end_entity ) const;
 
   // Get the bin iterator from an update tracker iterator
   void getBinIteratorFromUpdateTrackerIterator(
-	   const size_t thread_id,
+	   const size_t slot_index,
 	   const typename SerialUpdateTracker::const_iterator& entity_iterator,
 	   BinContributionMap::const_iterator& start_bin,
 	   BinContributionMap::const_iterator& end_bin ) const;
 
   // Reset the update tracker
-  void resetUpdateTracker( const size_t thread_id );
+  void resetUpdateTracker( const size_t slot_index );
+
+  // Initialize the thread-private total moments
+  void initializeThreadPrivateTotalMoments( const unsigned num_threads );
 
   // Save the data to an archive
   template<typename Archive>
@@ -313,8 +353,26 @@ private:
   // The total estimator moment histograms for each entity and response func.
   EntityEstimatorSampleMomentHistogramArrayMap d_entity_total_estimator_histograms_map;
 
-  // The entities/bins that have been updated
+  // The entities/bins that have been updated (for each history contribution
+  // slot)
   ParallelUpdateTracker d_update_tracker;
+
+  // The thread-private total moments (only used with multiple threads)
+  std::vector<ThreadPrivateTotalMoments> d_thread_private_total_moments;
+
+  // The total data that is updated during a simulation
+  struct ArchiveSnapshot
+  {
+    Estimator::FourEstimatorMomentsCollection total_estimator_moments;
+    EntityEstimatorMomentsCollectionMap entity_total_estimator_moments_map;
+    Estimator::FourEstimatorMomentsCollectionSnapshots total_estimator_moment_snapshots;
+    EntityEstimatorMomentsCollectionSnapshotsMap entity_total_estimator_moment_snapshots_map;
+    SampleMomentHistogramArray total_estimator_histograms;
+    EntityEstimatorSampleMomentHistogramArrayMap entity_total_estimator_histograms_map;
+  };
+
+  // The total data captured for an archive
+  std::unique_ptr<const ArchiveSnapshot> d_archive_snapshot;
 };
 
 } // end MonteCarlo namespace
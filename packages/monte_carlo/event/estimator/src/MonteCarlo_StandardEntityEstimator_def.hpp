@@ -77,19 +77,58 @@ void StandardEntityEstimator::initializeMomentsMaps(
 }
 
 // Save the data to an archive
+/*! \details If the total data that is updated during a simulation has been
+ * captured (see StandardEntityEstimator::takeArchiveSnapshot) it will be
+ * saved instead of the current total data.
+ */
 template<typename Archive>
 void StandardEntityEstimator::save( Archive& ar, const unsigned version ) const
 {
   // Save the base class data
   ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( EntityEstimator );
 
+  const ArchiveSnapshot* snapshot = d_archive_snapshot.get();
+
+  const Estimator::FourEstimatorMomentsCollection& total_estimator_moments =
+    snapshot ? snapshot->total_estimator_moments : d_total_estimator_moments;
+
+  const EntityEstimatorMomentsCollectionMap&
+    entity_total_estimator_moments_map = snapshot ?
+    snapshot->entity_total_estimator_moments_map :
+    d_entity_total_estimator_moments_map;
+
+  const Estimator::FourEstimatorMomentsCollectionSnapshots&
+    total_estimator_moment_snapshots = snapshot ?
+    snapshot->total_estimator_moment_snapshots :
+    d_total_estimator_moment_snapshots;
+
+  const EntityEstimatorMomentsCollectionSnapshotsMap&
+    entity_total_estimator_moment_snapshots_map = snapshot ?
+    snapshot->entity_total_estimator_moment_snapshots_map :
+    d_entity_total_estimator_moment_snapshots_map;
+
+  const SampleMomentHistogramArray& total_estimator_histograms =
+    snapshot ? snapshot->total_estimator_histograms :
+    d_total_estimator_histograms;
+
+  const EntityEstimatorSampleMomentHistogramArrayMap&
+    entity_total_estimator_histograms_map = snapshot ?
+    snapshot->entity_total_estimator_histograms_map :
+    d_entity_total_estimator_histograms_map;
+
   // Save the local data
-  ar & BOOST_SERIALIZATION_NVP( d_total_estimator_moments );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moments_map );
-  ar & BOOST_SERIALIZATION_NVP( d_total_estimator_moment_snapshots );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_moment_snapshots_map );
-  ar & BOOST_SERIALIZATION_NVP( d_total_estimator_histograms );
-  ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_histograms_map );
+  ar & boost::serialization::make_nvp( "d_total_estimator_moments",
+                                       total_estimator_moments );
+  ar & boost::serialization::make_nvp( "d_entity_total_estimator_moments_map",
+                                       entity_total_estimator_moments_map );
+  ar & boost::serialization::make_nvp( "d_total_estimator_moment_snapshots",
+                                       total_estimator_moment_snapshots );
+  ar & boost::serialization::make_nvp( "d_entity_total_estimator_moment_snapshots_map",
+                                       entity_total_estimator_moment_snapshots_map );
+  ar & boost::serialization::make_nvp( "d_total_estimator_histograms",
+                                       total_estimator_histograms );
+  ar & boost::serialization::make_nvp( "d_entity_total_estimator_histograms_map",
+                                       entity_total_estimator_histograms_map );
 }
 
 // Load the data from an archive
@@ -109,6 +148,7 @@ void StandardEntityEstimator::load( Archive& ar, const unsigned version )
 
   // Initialize the thread data
   d_update_tracker.resize( 1 );
+  d_thread_private_total_moments.clear();
 }
 
 } // end MonteCarlo namespace
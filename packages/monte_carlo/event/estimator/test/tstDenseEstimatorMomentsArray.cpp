@@ -0,0 +1,243 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDenseEstimatorMomentsArray.cpp
+//! \author Alex Robinson
+//! \brief  Dense estimator moments array unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_DenseEstimatorMomentsArray.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the array can be constructed
+FRENSIE_UNIT_TEST( DenseEstimatorMomentsArray, constructor )
+{
+  MonteCarlo::DenseEstimatorMomentsArray moments( 10, 4 );
+
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfEntities(), 10 );
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfValuesPerEntity(), 4 );
+  FRENSIE_CHECK_EQUAL( moments.size(), 40 );
+  FRENSIE_CHECK( !moments.areSecondMomentsSinglePrecision() );
+  FRENSIE_CHECK_EQUAL( moments.getMemoryFootprint(), 4*40*sizeof(double) );
+
+  for( size_t i = 0; i < 10; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( moments.getFirstMoments( i ),
+                         std::vector<double>( 4, 0.0 ) );
+    FRENSIE_CHECK_EQUAL( moments.getSecondMoments( i ),
+                         std::vector<double>( 4, 0.0 ) );
+    FRENSIE_CHECK_EQUAL( moments.getThirdMoments( i ),
+                         std::vector<double>( 4, 0.0 ) );
+    FRENSIE_CHECK_EQUAL( moments.getFourthMoments( i ),
+                         std::vector<double>( 4, 0.0 ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the array can be constructed with single precision second
+// moments
+FRENSIE_UNIT_TEST( DenseEstimatorMomentsArray,
+                   constructor_single_precision_second_moments )
+{
+  MonteCarlo::DenseEstimatorMomentsArray moments( 10, 4, true );
+
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfEntities(), 10 );
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfValuesPerEntity(), 4 );
+  FRENSIE_CHECK_EQUAL( moments.size(), 40 );
+  FRENSIE_CHECK( moments.areSecondMomentsSinglePrecision() );
+  FRENSIE_CHECK_EQUAL( moments.getMemoryFootprint(),
+                       3*40*sizeof(double) + 40*sizeof(float) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the array can be resized
+FRENSIE_UNIT_TEST( DenseEstimatorMomentsArray, resize )
+{
+  MonteCarlo::DenseEstimatorMomentsArray moments( 10, 4 );
+
+  moments.addRawScore( 0, 0, 1.0 );
+
+  moments.resize( 5, 2 );
+
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfEntities(), 5 );
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfValuesPerEntity(), 2 );
+  FRENSIE_CHECK_EQUAL( moments.size(), 10 );
+  FRENSIE_CHECK_EQUAL( moments.getFirstMoments( 0 ),
+                       std::vector<double>( 2, 0.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that raw scores can be added
+FRENSIE_UNIT_TEST( DenseEstimatorMomentsArray, addRawScore )
+{
+  MonteCarlo::DenseEstimatorMomentsArray moments( 3, 2 );
+
+  moments.addRawScore( 0, 0, 1.0 );
+  moments.addRawScore( 0, 0, 2.0 );
+  moments.addRawScore( 1, 1, 0.5 );
+  moments.addRawScore( 5, 3.0 );
+
+  FRENSIE_CHECK_EQUAL( moments.getFirstMoments( 0 ),
+                       std::vector<double>( {3.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getSecondMoments( 0 ),
+                       std::vector<double>( {5.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getThirdMoments( 0 ),
+                       std::vector<double>( {9.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getFourthMoments( 0 ),
+                       std::vector<double>( {17.0, 0.0} ) );
+
+  FRENSIE_CHECK_EQUAL( moments.getFirstMoments( 1 ),
+                       std::vector<double>( {0.0, 0.5} ) );
+  FRENSIE_CHECK_EQUAL( moments.getSecondMoments( 1 ),
+                       std::vector<double>( {0.0, 0.25} ) );
+  FRENSIE_CHECK_EQUAL( moments.getThirdMoments( 1 ),
+                       std::vector<double>( {0.0, 0.125} ) );
+  FRENSIE_CHECK_EQUAL( moments.getFourthMoments( 1 ),
+                       std::vector<double>( {0.0, 0.0625} ) );
+
+  FRENSIE_CHECK_EQUAL( moments.getFirstMoments( 2 ),
+                       std::vector<double>( {0.0, 3.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getSecondMoments( 2 ),
+                       std::vector<double>( {0.0, 9.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getThirdMoments( 2 ),
+                       std::vector<double>( {0.0, 27.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getFourthMoments( 2 ),
+                       std::vector<double>( {0.0, 81.0} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that raw scores can be added when the second moments are stored in
+// single precision
+FRENSIE_UNIT_TEST( DenseEstimatorMomentsArray,
+                   addRawScore_single_precision_second_moments )
+{
+  MonteCarlo::DenseEstimatorMomentsArray moments( 3, 2, true );
+
+  moments.addRawScore( 0, 0, 1.0 );
+  moments.addRawScore( 0, 0, 2.0 );
+  moments.addRawScore( 1, 1, 0.1 );
+
+  FRENSIE_CHECK_EQUAL( moments.getFirstMoments( 0 ),
+                       std::vector<double>( {3.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getSecondMoments( 0 ),
+                       std::vector<double>( {5.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getThirdMoments( 0 ),
+                       std::vector<double>( {9.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getFourthMoments( 0 ),
+                       std::vector<double>( {17.0, 0.0} ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( moments.getSecondMoments( 1 ),
+                                   std::vector<double>( {0.0, 0.01} ),
+                                   1e-7 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the moments can be reset
+FRENSIE_UNIT_TEST( DenseEstimatorMomentsArray, reset )
+{
+  MonteCarlo::DenseEstimatorMomentsArray moments( 3, 2 );
+
+  moments.addRawScore( 0, 0, 1.0 );
+  moments.addRawScore( 2, 1, 2.0 );
+
+  moments.reset();
+
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfEntities(), 3 );
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfValuesPerEntity(), 2 );
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( moments.getFirstMoments( i ),
+                         std::vector<double>( 2, 0.0 ) );
+    FRENSIE_CHECK_EQUAL( moments.getSecondMoments( i ),
+                         std::vector<double>( 2, 0.0 ) );
+    FRENSIE_CHECK_EQUAL( moments.getThirdMoments( i ),
+                         std::vector<double>( 2, 0.0 ) );
+    FRENSIE_CHECK_EQUAL( moments.getFourthMoments( i ),
+                         std::vector<double>( 2, 0.0 ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the array can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DenseEstimatorMomentsArray,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_dense_estimator_moments_array" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::DenseEstimatorMomentsArray moments( 3, 2 );
+    moments.addRawScore( 0, 0, 1.0 );
+    moments.addRawScore( 2, 1, 2.0 );
+
+    MonteCarlo::DenseEstimatorMomentsArray sp_moments( 3, 2, true );
+    sp_moments.addRawScore( 0, 0, 1.0 );
+    sp_moments.addRawScore( 2, 1, 2.0 );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( moments ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( sp_moments ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived distributions
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::DenseEstimatorMomentsArray moments, sp_moments;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( moments ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( sp_moments ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfEntities(), 3 );
+  FRENSIE_CHECK_EQUAL( moments.getNumberOfValuesPerEntity(), 2 );
+  FRENSIE_CHECK( !moments.areSecondMomentsSinglePrecision() );
+  FRENSIE_CHECK_EQUAL( moments.getFirstMoments( 0 ),
+                       std::vector<double>( {1.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( moments.getFourthMoments( 2 ),
+                       std::vector<double>( {0.0, 16.0} ) );
+
+  FRENSIE_CHECK_EQUAL( sp_moments.getNumberOfEntities(), 3 );
+  FRENSIE_CHECK_EQUAL( sp_moments.getNumberOfValuesPerEntity(), 2 );
+  FRENSIE_CHECK( sp_moments.areSecondMomentsSinglePrecision() );
+  FRENSIE_CHECK_EQUAL( sp_moments.getSecondMoments( 0 ),
+                       std::vector<double>( {1.0, 0.0} ) );
+  FRENSIE_CHECK_EQUAL( sp_moments.getSecondMoments( 2 ),
+                       std::vector<double>( {0.0, 4.0} ) );
+}
+
+//---------------------------------------------------------------------------//
+// end tstDenseEstimatorMomentsArray.cpp
+//---------------------------------------------------------------------------//
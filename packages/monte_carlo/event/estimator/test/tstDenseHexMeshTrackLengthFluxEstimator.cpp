@@ -0,0 +1,631 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDenseHexMeshTrackLengthFluxEstimator.cpp
+//! \author Alex Robinson
+//! \brief  DenseMeshTrackLengthFluxEstimator class unit tests (hex mesh)
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <random>
+
+// FRENSIE Includes
+#include "MonteCarlo_DenseMeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_ParticleState.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+typedef std::tuple<MonteCarlo::WeightMultiplier,
+                   MonteCarlo::WeightAndEnergyMultiplier,
+                   MonteCarlo::WeightAndChargeMultiplier
+                  > MultiplierPolicies;
+
+//---------------------------------------------------------------------------//
+// Testing Structs
+//---------------------------------------------------------------------------//
+
+// A particle subtrack
+struct Subtrack
+{
+  double start_point[3];
+  double end_point[3];
+  double energy;
+  double weight;
+};
+
+// The subtracks of a particle history
+typedef std::vector<Subtrack> History;
+
+//---------------------------------------------------------------------------//
+// Testing variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const Utility::Mesh> hex_mesh;
+
+std::vector<History> histories;
+
+// The time of every particle at the end of a subtrack
+const double subtrack_end_time = 1.5e-10;
+
+//---------------------------------------------------------------------------//
+// Testing functions
+//---------------------------------------------------------------------------//
+
+// Set the estimator discretization
+void setDiscretization( MonteCarlo::Estimator& estimator,
+                        const bool use_time_bins )
+{
+  std::vector<double> energy_bin_boundaries( {0.0, 0.1, 0.5, 1.0} );
+
+  estimator.setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                                       energy_bin_boundaries );
+
+  if( use_time_bins )
+  {
+    std::vector<double> time_bin_boundaries( {0.0, 5e-11, 1e-10, 1.5e-10} );
+
+    estimator.setDiscretization<MonteCarlo::OBSERVER_TIME_DIMENSION>(
+                                                         time_bin_boundaries );
+  }
+
+  std::vector<MonteCarlo::ParticleType> particle_types( 1, MonteCarlo::PHOTON );
+
+  estimator.setParticleTypes( particle_types );
+}
+
+// Simulate a history
+template<typename Observer>
+void simulateHistory( Observer& estimator, const History& history )
+{
+  MonteCarlo::PhotonState particle( 0 );
+  particle.setTime( subtrack_end_time );
+
+  for( auto&& subtrack : history )
+  {
+    particle.setEnergy( subtrack.energy );
+    particle.setWeight( subtrack.weight );
+
+    estimator.updateFromGlobalParticleSubtrackEndingEvent(
+                                                         particle,
+                                                         subtrack.start_point,
+                                                         subtrack.end_point );
+  }
+
+  estimator.commitHistoryContribution();
+}
+
+// Check that the dense estimator data matches the reference estimator data
+#define CHECK_ESTIMATOR_DATA( dense_estimator, estimator, tol, second_moment_tol ) \
+  {                                                                     \
+    FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getTotalBinDataFirstMoments(), \
+                                     (estimator).getTotalBinDataFirstMoments(), \
+                                     tol );                             \
+    FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getTotalBinDataSecondMoments(), \
+                                     (estimator).getTotalBinDataSecondMoments(), \
+                                     tol );                             \
+    FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getTotalBinDataThirdMoments(), \
+                                     (estimator).getTotalBinDataThirdMoments(), \
+                                     tol );                             \
+    FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getTotalBinDataFourthMoments(), \
+                                     (estimator).getTotalBinDataFourthMoments(), \
+                                     tol );                             \
+    FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getTotalDataFirstMoments(), \
+                                     (estimator).getTotalDataFirstMoments(), \
+                                     tol );                             \
+    FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getTotalDataSecondMoments(), \
+                                     (estimator).getTotalDataSecondMoments(), \
+                                     tol );                             \
+    FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getTotalDataThirdMoments(), \
+                                     (estimator).getTotalDataThirdMoments(), \
+                                     tol );                             \
+    FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getTotalDataFourthMoments(), \
+                                     (estimator).getTotalDataFourthMoments(), \
+                                     tol );                             \
+                                                                        \
+    std::set<uint64_t> entity_ids;                                      \
+    (estimator).getEntityIds( entity_ids );                             \
+                                                                        \
+    for( auto&& entity_id : entity_ids )                                \
+    {                                                                   \
+      FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getEntityBinDataFirstMoments( entity_id ), \
+                                       (estimator).getEntityBinDataFirstMoments( entity_id ), \
+                                       tol );                           \
+      FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getEntityBinDataSecondMoments( entity_id ), \
+                                       (estimator).getEntityBinDataSecondMoments( entity_id ), \
+                                       second_moment_tol );             \
+      FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getEntityBinDataThirdMoments( entity_id ), \
+                                       (estimator).getEntityBinDataThirdMoments( entity_id ), \
+                                       tol );                           \
+      FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getEntityBinDataFourthMoments( entity_id ), \
+                                       (estimator).getEntityBinDataFourthMoments( entity_id ), \
+                                       tol );                           \
+      FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getEntityTotalDataFirstMoments( entity_id ), \
+                                       (estimator).getEntityTotalDataFirstMoments( entity_id ), \
+                                       tol );                           \
+      FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getEntityTotalDataSecondMoments( entity_id ), \
+                                       (estimator).getEntityTotalDataSecondMoments( entity_id ), \
+                                       second_moment_tol );             \
+      FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getEntityTotalDataThirdMoments( entity_id ), \
+                                       (estimator).getEntityTotalDataThirdMoments( entity_id ), \
+                                       tol );                           \
+      FRENSIE_CHECK_FLOATING_EQUALITY( (dense_estimator).getEntityTotalDataFourthMoments( entity_id ), \
+                                       (estimator).getEntityTotalDataFourthMoments( entity_id ), \
+                                       tol );                           \
+    }                                                                   \
+  }
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the estimator is a mesh type estimator
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            check_type,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+    new MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>(
+                                                                  0,
+                                                                  1.0,
+                                                                  hex_mesh ) );
+
+  FRENSIE_CHECK( !estimator->isCellEstimator() );
+  FRENSIE_CHECK( !estimator->isSurfaceEstimator() );
+  FRENSIE_CHECK( estimator->isMeshEstimator() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the mesh elements are assigned to the estimator
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            getEntityIds,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+    new MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>(
+                                                                  0,
+                                                                  1.0,
+                                                                  hex_mesh ) );
+
+  std::set<uint64_t> entity_ids;
+  estimator->getEntityIds( entity_ids );
+
+  FRENSIE_CHECK_EQUAL( entity_ids,
+                       std::set<uint64_t>( {0, 1, 2, 3, 4, 5, 6, 7} ) );
+
+  for( uint64_t i = 0; i < 8; ++i )
+  {
+    FRENSIE_CHECK( estimator->isEntityAssigned( i ) );
+    FRENSIE_CHECK_EQUAL( estimator->getEntityNormConstant( i ), 1.0 );
+  }
+
+  FRENSIE_CHECK( !estimator->isEntityAssigned( 8 ) );
+  FRENSIE_CHECK_THROW( estimator->getEntityNormConstant( 8 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalNormConstant(), 8.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that estimator bins can be set
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            setDiscretization,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+    new MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>(
+                                                                  0,
+                                                                  1.0,
+                                                                  hex_mesh ) );
+
+  std::vector<double> energy_bin_boundaries( {0.0, 0.1, 1.0} );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+						       energy_bin_boundaries );
+
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfBins(), 2 );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ).size(),
+                       2 );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 0 ).size(),
+                       1 );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments().size(), 2 );
+
+  std::vector<double> time_bin_boundaries( {0.0, 1.0, 2.0} );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_TIME_DIMENSION>(
+							 time_bin_boundaries );
+
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfBins(), 4 );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 7 ).size(),
+                       4 );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments().size(), 4 );
+
+  // Make sure cosine bins cannot be set
+  std::vector<double> cosine_bin_boundaries( {-1.0, 0.0, 1.0} );
+
+  estimator->setDiscretization<MonteCarlo::OBSERVER_COSINE_DIMENSION>(
+						       cosine_bin_boundaries );
+
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfBins( MonteCarlo::OBSERVER_COSINE_DIMENSION ),
+                       1 );
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfBins(), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the unsupported features are ignored
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            unsupported_features,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator(
+    new MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>(
+                                                                  0,
+                                                                  1.0,
+                                                                  hex_mesh ) );
+
+  estimator->enableSnapshotsOnEntityBins();
+  estimator->enableSampleMomentHistogramsOnEntityBins();
+  estimator->enableThreadPrivateMomentAccumulation();
+
+  FRENSIE_CHECK( !estimator->areSnapshotsOnEntityBinsEnabled() );
+  FRENSIE_CHECK( !estimator->areSampleMomentHistogramsOnEntityBinsEnabled() );
+  FRENSIE_CHECK( !estimator->isThreadPrivateMomentAccumulationEnabled() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the dense estimator data matches the standard mesh estimator
+// data
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            updateFromGlobalParticleSubtrackEndingEvent,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    dense_estimator( 0, 2.0, hex_mesh );
+
+  MonteCarlo::MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    estimator( 1, 2.0, hex_mesh );
+
+  setDiscretization( dense_estimator, false );
+  setDiscretization( estimator, false );
+
+  FRENSIE_CHECK( !dense_estimator.hasUncommittedHistoryContribution() );
+
+  MonteCarlo::PhotonState particle( 0 );
+  particle.setEnergy( 1.0 );
+  particle.setTime( subtrack_end_time );
+  particle.setWeight( 1.0 );
+
+  dense_estimator.updateFromGlobalParticleSubtrackEndingEvent(
+                                                  particle,
+                                                  histories.front().front().start_point,
+                                                  histories.front().front().end_point );
+
+  FRENSIE_CHECK( dense_estimator.hasUncommittedHistoryContribution() );
+
+  dense_estimator.commitHistoryContribution();
+
+  FRENSIE_CHECK( !dense_estimator.hasUncommittedHistoryContribution() );
+
+  dense_estimator.resetData();
+
+  for( auto&& history : histories )
+  {
+    simulateHistory( dense_estimator, history );
+    simulateHistory( estimator, history );
+  }
+
+  CHECK_ESTIMATOR_DATA( dense_estimator, estimator, 1e-12, 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the dense estimator data matches the standard mesh estimator
+// data when time bins are used
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            updateFromGlobalParticleSubtrackEndingEvent_time_bins,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    dense_estimator( 0, 2.0, hex_mesh );
+
+  MonteCarlo::MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    estimator( 1, 2.0, hex_mesh );
+
+  setDiscretization( dense_estimator, true );
+  setDiscretization( estimator, true );
+
+  for( auto&& history : histories )
+  {
+    simulateHistory( dense_estimator, history );
+    simulateHistory( estimator, history );
+  }
+
+  CHECK_ESTIMATOR_DATA( dense_estimator, estimator, 1e-12, 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the dense estimator data matches the standard mesh estimator
+// data when the second moments are stored in single precision
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            updateFromGlobalParticleSubtrackEndingEvent_single_precision,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    dense_estimator( 0, 2.0, hex_mesh, true );
+
+  MonteCarlo::MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    estimator( 1, 2.0, hex_mesh );
+
+  MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    double_precision_dense_estimator( 2, 2.0, hex_mesh );
+
+  setDiscretization( dense_estimator, false );
+  setDiscretization( estimator, false );
+  setDiscretization( double_precision_dense_estimator, false );
+
+  FRENSIE_CHECK( dense_estimator.areSecondMomentsSinglePrecision() );
+  FRENSIE_CHECK( !double_precision_dense_estimator.areSecondMomentsSinglePrecision() );
+  FRENSIE_CHECK( dense_estimator.getElementMomentsMemoryFootprint() <
+                 double_precision_dense_estimator.getElementMomentsMemoryFootprint() );
+
+  for( auto&& history : histories )
+  {
+    simulateHistory( dense_estimator, history );
+    simulateHistory( estimator, history );
+  }
+
+  CHECK_ESTIMATOR_DATA( dense_estimator, estimator, 1e-12, 1e-6 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the estimator data can be reset
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            resetData,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    dense_estimator( 0, 2.0, hex_mesh );
+
+  MonteCarlo::MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    estimator( 1, 2.0, hex_mesh );
+
+  setDiscretization( dense_estimator, true );
+  setDiscretization( estimator, true );
+
+  for( auto&& history : histories )
+    simulateHistory( dense_estimator, history );
+
+  dense_estimator.resetData();
+
+  CHECK_ESTIMATOR_DATA( dense_estimator, estimator, 1e-15, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the dense estimator data matches the standard mesh estimator
+// data when multiple threads are used
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            updateFromGlobalParticleSubtrackEndingEvent_thread_safe,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    dense_estimator( 0, 2.0, hex_mesh );
+
+  MonteCarlo::MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    estimator( 1, 2.0, hex_mesh );
+
+  setDiscretization( dense_estimator, true );
+  setDiscretization( estimator, true );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  dense_estimator.enableThreadSupport( threads );
+
+  #pragma omp parallel for num_threads( threads )
+  for( size_t i = 0; i < histories.size(); ++i )
+    simulateHistory( dense_estimator, histories[i] );
+
+  for( auto&& history : histories )
+    simulateHistory( estimator, history );
+
+  CHECK_ESTIMATOR_DATA( dense_estimator, estimator, 1e-12, 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the snapshot history values can be retrieved
+FRENSIE_UNIT_TEST_TEMPLATE( DenseHexMeshTrackLengthFluxEstimator,
+                            takeSnapshot,
+                            MultiplierPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, ContributionMultiplierPolicy );
+
+  MonteCarlo::DenseMeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>
+    dense_estimator( 0, 2.0, hex_mesh );
+
+  setDiscretization( dense_estimator, false );
+
+  simulateHistory( dense_estimator, histories[0] );
+
+  dense_estimator.takeSnapshot( 1, 1.0 );
+
+  std::vector<uint64_t> history_values;
+  std::vector<double> sampling_times;
+
+  dense_estimator.getTotalMomentSnapshotHistoryValues( history_values );
+  dense_estimator.getTotalMomentSnapshotSamplingTimes( sampling_times );
+
+  FRENSIE_CHECK_EQUAL( history_values, std::vector<uint64_t>( {1} ) );
+  FRENSIE_CHECK_EQUAL( sampling_times, std::vector<double>( {1.0} ) );
+
+  std::vector<double> moments;
+
+  dense_estimator.getTotalFirstMomentSnapshots( 0, moments );
+
+  FRENSIE_CHECK_EQUAL( moments.size(), 1 );
+  FRENSIE_CHECK_EQUAL( moments.front(),
+                       dense_estimator.getTotalDataFirstMoments().front() );
+
+  FRENSIE_CHECK_THROW( dense_estimator.getTotalFirstMomentSnapshots( 1, moments ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an estimator can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DenseHexMeshTrackLengthFluxEstimator,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_dense_hex_mesh_track_length_flux_estimator" );
+  std::ostringstream archive_ostream;
+
+  MonteCarlo::MeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>
+    reference_estimator( 1, 2.0, hex_mesh );
+
+  setDiscretization( reference_estimator, true );
+
+  for( auto&& history : histories )
+    simulateHistory( reference_estimator, history );
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> >
+      estimator( new MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier>( 0, 2.0, hex_mesh ) );
+
+    std::shared_ptr<MonteCarlo::Estimator> estimator_base = estimator;
+
+    setDiscretization( *estimator, true );
+
+    for( auto&& history : histories )
+      simulateHistory( *estimator, history );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( estimator ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( estimator_base ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived distributions
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<MonteCarlo::DenseMeshTrackLengthFluxEstimator<MonteCarlo::WeightMultiplier> > estimator;
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator_base;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( estimator ) );
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( estimator_base ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK( estimator.get() == estimator_base.get() );
+  FRENSIE_CHECK_EQUAL( estimator->getId(), 0 );
+  FRENSIE_CHECK_EQUAL( estimator->getMultiplier(), 2.0 );
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfBins(), 9 );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalNormConstant(), 8.0 );
+
+  CHECK_ESTIMATOR_DATA( *estimator, reference_estimator, 1e-12, 1e-12 );
+
+  // The loaded estimator must still be able to collect data
+  simulateHistory( *estimator, histories.front() );
+  simulateHistory( reference_estimator, histories.front() );
+
+  CHECK_ESTIMATOR_DATA( *estimator, reference_estimator, 1e-12, 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+  // Set up a basic mesh
+  std::vector<double> x_planes( {0, 1, 2} ),
+    y_planes( {0, 1, 2} ),
+    z_planes( {0, 1, 2} );
+
+  hex_mesh.reset( new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  // Create a reproducible set of histories
+  std::mt19937 generator( 1 );
+  std::uniform_real_distribution<double> position_distribution( 0.05, 1.95 );
+  std::uniform_real_distribution<double> energy_distribution( 0.0, 1.0 );
+  std::uniform_real_distribution<double> weight_distribution( 0.5, 1.5 );
+  std::uniform_int_distribution<int> subtrack_distribution( 1, 5 );
+
+  histories.resize( 100 );
+
+  for( auto&& history : histories )
+  {
+    history.resize( subtrack_distribution( generator ) );
+
+    for( auto&& subtrack : history )
+    {
+      for( size_t i = 0; i < 3; ++i )
+      {
+        subtrack.start_point[i] = position_distribution( generator );
+        subtrack.end_point[i] = position_distribution( generator );
+      }
+
+      subtrack.energy = energy_distribution( generator );
+      subtrack.weight = weight_distribution( generator );
+    }
+  }
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDenseHexMeshTrackLengthFluxEstimator.cpp
+//---------------------------------------------------------------------------//
@@ -2941,6 +2941,55 @@ FRENSIE_UNIT_TEST( EntityEstimator, reduceData )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that the estimator data can be reduced repeatedly with one reducer
+FRENSIE_UNIT_TEST( EntityEstimator, reduceData_reducer )
+{
+  std::shared_ptr<TestEntityEstimator> entity_estimator;
+  initializeEntityEstimator( entity_estimator, true );
+
+  size_t num_estimator_bins = entity_estimator->getNumberOfBins()*
+    entity_estimator->getNumberOfResponseFunctions();
+
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  Utility::HierarchicalReducer reducer( *comm, 0 );
+
+  unsigned procs = comm->size();
+
+  for( size_t reduction = 0; reduction < 2; ++reduction )
+  {
+    for( size_t i = 0; i < num_estimator_bins; ++i )
+    {
+      entity_estimator->commitHistoryContributionToBinOfEntity( 0, i, 1.0 );
+      entity_estimator->commitHistoryContributionToBinOfTotal( i, 2.0 );
+    }
+
+    comm->barrier();
+
+    entity_estimator->reduceData( reducer, *comm, 0 );
+  }
+
+  if( comm->rank() == 0 )
+  {
+    Utility::ArrayView<const double> first_moments =
+      entity_estimator->getTotalBinDataFirstMoments();
+
+    Utility::ArrayView<const double> second_moments =
+      entity_estimator->getTotalBinDataSecondMoments();
+
+    FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( 24, 4*procs ) );
+    FRENSIE_CHECK_EQUAL( second_moments, std::vector<double>( 24, 8*procs ) );
+
+    first_moments = entity_estimator->getEntityBinDataFirstMoments( 0 );
+    second_moments = entity_estimator->getEntityBinDataSecondMoments( 0 );
+
+    FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( 24, 2*procs ) );
+    FRENSIE_CHECK_EQUAL( second_moments, std::vector<double>( 24, 2*procs ) );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
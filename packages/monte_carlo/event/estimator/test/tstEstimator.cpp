@@ -74,6 +74,14 @@ public:
   bool areSampleMomentHistogramsOnEntityBinsEnabled() const final override
   { return false; }
 
+  //! Enable thread-private moment accumulation
+  void enableThreadPrivateMomentAccumulation() final override
+  { /* ... */ }
+
+  //! Check if thread-private moment accumulation has been enabled
+  bool isThreadPrivateMomentAccumulationEnabled() const final override
+  { return false; }
+
   //! Get the total estimator bin data first moments
   Utility::ArrayView<const double> getTotalBinDataFirstMoments() const final override
   { return Utility::ArrayView<const double>(); }
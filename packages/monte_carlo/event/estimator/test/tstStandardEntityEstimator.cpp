@@ -2354,6 +2354,130 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that history contributions can be accumulated in thread-private
+// moments
+FRENSIE_UNIT_TEST( StandardEntityEstimator,
+                   commitHistoryContribution_thread_private_moments )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  estimator->enableSampleMomentHistogramsOnEntityBins();
+
+  FRENSIE_CHECK( !estimator->isThreadPrivateMomentAccumulationEnabled() );
+
+  estimator->enableThreadPrivateMomentAccumulation();
+
+  FRENSIE_CHECK( estimator->isThreadPrivateMomentAccumulationEnabled() );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  // Enable thread support
+  estimator->enableThreadSupport( threads );
+
+  #pragma omp parallel num_threads( threads )
+  {
+    // bin 0 (E=0, Mu=0, T=0, Col=0)
+    MonteCarlo::PhotonState particle( 0ull );
+    MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-6 );
+
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+
+    // Commit the contributions
+    estimator->commitHistoryContribution();
+  }
+
+  for( unsigned i = 0; i < threads; ++i )
+  {
+    FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution( i ) );
+  }
+
+  // The thread-private moments are merged when a snapshot is taken
+  estimator->takeSnapshot( threads, 1.0 );
+
+  // Check the total bin data moments
+  std::vector<double> expected_total_bin_first_moments( 32, 0.0 );
+  expected_total_bin_first_moments[0] = 2.0*threads;
+  expected_total_bin_first_moments[16] = 2.0*threads;
+
+  std::vector<double> expected_total_bin_second_moments( 32, 0.0 );
+  expected_total_bin_second_moments[0] = 4.0*threads;
+  expected_total_bin_second_moments[16] = 4.0*threads;
+
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataFirstMoments(),
+                       expected_total_bin_first_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalBinDataSecondMoments(),
+                       expected_total_bin_second_moments );
+
+  // Check the entity bin data moments
+  std::vector<double> expected_entity_bin_moments( 32, 0.0 );
+  expected_entity_bin_moments[0] = threads;
+  expected_entity_bin_moments[16] = threads;
+
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 0 ),
+                       expected_entity_bin_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 0 ),
+                       expected_entity_bin_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataFirstMoments( 1 ),
+                       expected_entity_bin_moments );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityBinDataSecondMoments( 1 ),
+                       expected_entity_bin_moments );
+
+  // Check the entity total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 0 ),
+                       std::vector<double>( 2, threads ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFourthMoments( 0 ),
+                       std::vector<double>( 2, threads ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFirstMoments( 1 ),
+                       std::vector<double>( 2, threads ) );
+  FRENSIE_CHECK_EQUAL( estimator->getEntityTotalDataFourthMoments( 1 ),
+                       std::vector<double>( 2, threads ) );
+
+  // Check the total data moments
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                       std::vector<double>( 2, 2.0*threads ) );
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataSecondMoments(),
+                       std::vector<double>( 2, 4.0*threads ) );
+
+  // Check the histograms
+  Utility::SampleMomentHistogram<double> histogram;
+
+  estimator->getEntityBinSampleMomentHistogram( 0, 0, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+
+  estimator->getTotalBinSampleMomentHistogram( 16, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+
+  estimator->getEntityTotalSampleMomentHistogram( 1, 1, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+
+  estimator->getTotalSampleMomentHistogram( 0, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+
+  // A second snapshot should not merge the contributions again
+  estimator->takeSnapshot( 0, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                       std::vector<double>( 2, 2.0*threads ) );
+
+  // Reset the estimator data
+  estimator->resetData();
+
+  FRENSIE_CHECK_EQUAL( estimator->getTotalDataFirstMoments(),
+                       std::vector<double>( 2, 0.0 ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a snapshot of the estimator state can be made
 FRENSIE_UNIT_TEST( StandardEntityEstimator, takeSnapshot_no_bin_snapshots )
@@ -273,6 +273,19 @@ void ParticleTracker::printSummary( std::ostream& os ) const
   os << std::endl;
 }
 
+// Capture the data that will be saved to an archive
+void ParticleTracker::takeArchiveSnapshot()
+{
+  d_archived_history_number_map.reset(
+                               new OverallHistoryMap( d_history_number_map ) );
+}
+
+// Release the data that was captured for an archive
+void ParticleTracker::releaseArchiveSnapshot()
+{
+  d_archived_history_number_map.reset();
+}
+
 // Get the data map
 void ParticleTracker::getHistoryData( OverallHistoryMap& history_map ) const
 {
@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_PARTICLE_TRACKER_HPP
 #define MONTE_CARLO_PARTICLE_TRACKER_HPP
 
+// Std Lib Includes
+#include <memory>
+
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
 #include <boost/serialization/version.hpp>
@@ -125,6 +128,12 @@ public:
   //! Print a summary of the data
   void printSummary( std::ostream& os ) const final override;
 
+  //! Capture the data that will be saved to an archive
+  void takeArchiveSnapshot() final override;
+
+  //! Release the data that was captured for an archive
+  void releaseArchiveSnapshot() final override;
+
   //! Get the data map
   void getHistoryData( OverallHistoryMap& history_map ) const;
 
@@ -158,6 +167,9 @@ private:
 
   // The tracked history info
   OverallHistoryMap d_history_number_map;
+
+  // The tracked history info captured for an archive
+  std::unique_ptr<const OverallHistoryMap> d_archived_history_number_map;
 };
 
 // Save the estimator data
@@ -172,7 +184,12 @@ void ParticleTracker::save( Archive& ar, const unsigned version ) const
   // Save the local data
   ar & BOOST_SERIALIZATION_NVP( d_id );
   ar & BOOST_SERIALIZATION_NVP( d_histories_to_track );
-  ar & BOOST_SERIALIZATION_NVP( d_history_number_map );
+
+  const OverallHistoryMap& history_number_map = d_archived_history_number_map ?
+    *d_archived_history_number_map : d_history_number_map;
+
+  ar & boost::serialization::make_nvp( "d_history_number_map",
+                                       history_number_map );
 }
 
 // Load the estimator data
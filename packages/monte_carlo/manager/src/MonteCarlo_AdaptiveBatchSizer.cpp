@@ -0,0 +1,109 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_AdaptiveBatchSizer.cpp
+//! \author Alex Robinson
+//! \brief  Adaptive batch sizer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_AdaptiveBatchSizer.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+AdaptiveBatchSizer::AdaptiveBatchSizer( const unsigned number_of_workers,
+                                        const uint64_t base_batch_size,
+                                        const uint64_t min_batch_size )
+  : d_worker_throughputs( number_of_workers, 0.0 ),
+    d_base_batch_size( base_batch_size ),
+    d_min_batch_size( min_batch_size )
+{
+  // Make sure the number of workers is valid
+  testPrecondition( number_of_workers > 0 );
+  // Make sure the batch sizes are valid
+  testPrecondition( min_batch_size > 0 );
+  testPrecondition( base_batch_size >= min_batch_size );
+}
+
+// Return the number of workers
+unsigned AdaptiveBatchSizer::getNumberOfWorkers() const
+{
+  return d_worker_throughputs.size();
+}
+
+// Record the measured throughput of a worker (histories/s)
+/*! \details Throughputs that are not positive (e.g. reported by a worker
+ * that has not completed a batch yet) will be ignored.
+ */
+void AdaptiveBatchSizer::recordWorkerThroughput( const unsigned worker_id,
+                                                 const double throughput )
+{
+  // Make sure the worker id is valid
+  testPrecondition( worker_id < d_worker_throughputs.size() );
+
+  if( throughput > 0.0 )
+    d_worker_throughputs[worker_id] = throughput;
+}
+
+// Return the throughput of a worker (histories/s)
+double AdaptiveBatchSizer::getWorkerThroughput( const unsigned worker_id ) const
+{
+  // Make sure the worker id is valid
+  testPrecondition( worker_id < d_worker_throughputs.size() );
+
+  return d_worker_throughputs[worker_id];
+}
+
+// Calculate the size of the next batch that will be assigned to a worker
+/*! \details The returned batch size will never be less than the min batch
+ * size or greater than the number of remaining histories.
+ */
+uint64_t AdaptiveBatchSizer::calculateBatchSize(
+                                    const unsigned worker_id,
+                                    const uint64_t remaining_histories ) const
+{
+  // Make sure the worker id is valid
+  testPrecondition( worker_id < d_worker_throughputs.size() );
+
+  uint64_t batch_size;
+
+  if( d_worker_throughputs[worker_id] > 0.0 )
+  {
+    double total_throughput = 0.0;
+    unsigned measured_workers = 0;
+
+    for( size_t i = 0; i < d_worker_throughputs.size(); ++i )
+    {
+      if( d_worker_throughputs[i] > 0.0 )
+      {
+        total_throughput += d_worker_throughputs[i];
+        ++measured_workers;
+      }
+    }
+
+    // Assume that the unmeasured workers have the mean throughput
+    total_throughput *= d_worker_throughputs.size()/(double)measured_workers;
+
+    batch_size = (uint64_t)std::ceil( 0.5*remaining_histories*
+                                      d_worker_throughputs[worker_id]/
+                                      total_throughput );
+  }
+  else
+    batch_size = d_base_batch_size;
+
+  batch_size = std::max( batch_size, d_min_batch_size );
+
+  return std::min( batch_size, remaining_histories );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_AdaptiveBatchSizer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,75 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_AdaptiveBatchSizer.hpp
+//! \author Alex Robinson
+//! \brief  Adaptive batch sizer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_ADAPTIVE_BATCH_SIZER_HPP
+#define MONTE_CARLO_ADAPTIVE_BATCH_SIZER_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <cstdint>
+
+namespace MonteCarlo{
+
+/*! The adaptive batch sizer class
+ *
+ * The size of the batch that is assigned to a worker is proportional to the
+ * measured throughput (histories/s) of the worker relative to the combined
+ * throughput of all workers. Only half of the worker's share of the
+ * remaining histories is assigned at once (guided self-scheduling) so that
+ * the batch sizes decrease as the end of the rendezvous batch approaches,
+ * which keeps the tail of the rendezvous batch short. Workers that have not
+ * reported a throughput yet are assigned the base batch size and are assumed
+ * to have the mean throughput of the workers that have reported.
+ */
+class AdaptiveBatchSizer
+{
+
+public:
+
+  //! Constructor
+  AdaptiveBatchSizer( const unsigned number_of_workers,
+                      const uint64_t base_batch_size,
+                      const uint64_t min_batch_size );
+
+  //! Destructor
+  ~AdaptiveBatchSizer()
+  { /* ... */ }
+
+  //! Return the number of workers
+  unsigned getNumberOfWorkers() const;
+
+  //! Record the measured throughput of a worker (histories/s)
+  void recordWorkerThroughput( const unsigned worker_id,
+                               const double throughput );
+
+  //! Return the throughput of a worker (histories/s)
+  double getWorkerThroughput( const unsigned worker_id ) const;
+
+  //! Calculate the size of the next batch that will be assigned to a worker
+  uint64_t calculateBatchSize( const unsigned worker_id,
+                               const uint64_t remaining_histories ) const;
+
+private:
+
+  // The measured worker throughputs (0.0 = not measured)
+  std::vector<double> d_worker_throughputs;
+
+  // The base batch size
+  uint64_t d_base_batch_size;
+
+  // The minimum batch size
+  uint64_t d_min_batch_size;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_ADAPTIVE_BATCH_SIZER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_AdaptiveBatchSizer.hpp
+//---------------------------------------------------------------------------//
@@ -9,13 +9,29 @@
 #ifndef MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_HPP
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_HPP
 
+// Std Lib Includes
+#include <utility>
+
 // FRENSIE Includes
 #include "MonteCarlo_StandardParticleSimulationManager.hpp"
+#include "MonteCarlo_ProcessLoadBalanceTelemetry.hpp"
 #include "Utility_Communicator.hpp"
+#include "Utility_HierarchicalReducer.hpp"
 
 namespace MonteCarlo{
 
-//! The batched distributed standard particle simulation manager
+/*! The batched distributed standard particle simulation manager
+ *
+ * The histories of each rendezvous batch are distributed among the
+ * processes using the distributed batch schedule set in the simulation
+ * properties. With the static and adaptive schedules the root process
+ * coordinates the worker processes and does not simulate any histories.
+ * With the work stealing schedule every process simulates histories and
+ * idle processes steal histories directly from other processes. The batches
+ * and histories completed by each process, and the fraction of the wall time
+ * that each process spends simulating histories (utilization), are reported
+ * in the simulation summary.
+ */
 template<ParticleModeType mode>
 class BatchedDistributedStandardParticleSimulationManager : public StandardParticleSimulationManager<mode>
 {
@@ -63,17 +79,29 @@ protected:
 
 private:
 
+  // The steal request message tag
+  static const int s_steal_request_tag = 1;
+
+  // The steal reply message tag
+  static const int s_steal_reply_tag = 2;
+
+  // The rendezvous batch complete message tag
+  static const int s_rendezvous_batch_complete_tag = 3;
+
   // Coorindate workers
   void coordinateWorkers();
 
   // Tell workers to stop working
   void stopWorkersAndRecordWork( const bool simulation_complete,
                                  const bool rendezvous_required,
-                                 const uint64_t batch_number );
+                                 const uint64_t assigned_histories );
 
   // Check for idle worker
   bool isIdleWorkerPresent( Utility::Communicator::Status& idle_worker_info );
 
+  // Receive the idle worker message (worker throughput)
+  double receiveIdleWorkerMessage( const Utility::Communicator::Status& idle_worker_info );
+
   // Assign work to idle worker
   void assignWorkToIdleWorker( const Utility::Communicator::Status& idle_worker_info,
                                const std::pair<uint64_t,uint64_t>& task );
@@ -81,11 +109,54 @@ private:
   // Complete assigned work
   void work();
 
+  // Share the work of each rendezvous batch with all processes
+  void shareWork();
+
+  // Complete a rendezvous batch using work stealing
+  void runWorkStealingRendezvousBatch( const uint64_t start_history,
+                                       const uint64_t end_history );
+
+  // Service the pending steal requests from other processes
+  void serviceStealRequests( std::pair<uint64_t,uint64_t>& history_range );
+
+  // Steal histories from another process
+  bool stealHistories( std::pair<uint64_t,uint64_t>& history_range );
+
+  // Wait for all processes to complete the rendezvous batch
+  void waitForRendezvousBatchCompletion(
+                           std::pair<uint64_t,uint64_t>& history_range );
+
+  // Run a simulation batch and record the work (return the busy time)
+  double runAndRecordSimulationBatch( const uint64_t batch_start_history,
+                                      const uint64_t batch_end_history );
+
+  // Gather the process load balance telemetry on the root process
+  void gatherProcessLoadBalanceTelemetry( const double wall_time );
+
   // The communicator
   std::shared_ptr<const Utility::Communicator> d_comm;
 
+  // The observer data reducer (created once since it requires collective
+  // communication)
+  std::unique_ptr<Utility::HierarchicalReducer> d_observer_data_reducer;
+
+  // The distributed batch schedule type
+  DistributedBatchScheduleType d_schedule_type;
+
   // The number of batches per rendezvous
   uint64_t d_batches_per_rendezvous;
+
+  // The number of batches completed by this process
+  uint64_t d_batches_completed;
+
+  // The number of histories completed by this process
+  uint64_t d_histories_completed;
+
+  // The time that this process has spent simulating histories (s)
+  double d_busy_time;
+
+  // The process load balance telemetry (only valid on the root process)
+  ProcessLoadBalanceTelemetry d_process_load_balance_telemetry;
 };
   
 } // end MonteCarlo namespace
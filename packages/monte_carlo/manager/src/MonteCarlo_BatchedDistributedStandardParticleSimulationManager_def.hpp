@@ -9,7 +9,12 @@
 #ifndef MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 
+// Std Lib Includes
+#include <array>
+#include <algorithm>
+
 // FRENSIE Includes
+#include "MonteCarlo_AdaptiveBatchSizer.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -41,16 +46,33 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                                              rendezvous_number,
                                              use_single_rendezvous_file ),
   d_comm( comm ),
-  d_batches_per_rendezvous( 0 )
+  d_observer_data_reducer(),
+  d_schedule_type( properties->getDistributedBatchScheduleType() ),
+  d_batches_per_rendezvous( 0 ),
+  d_batches_completed( 0 ),
+  d_histories_completed( 0 ),
+  d_busy_time( 0.0 ),
+  d_process_load_balance_telemetry()
 {
   // Make sure that the communicator pointer is valid
   testPrecondition( comm.get() );
   // Make sure that the communicator is not a serial communicator
   testPrecondition( comm->size() > 1 );
 
-  // Calculate the batch size
-  d_batches_per_rendezvous =
-    properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
+  d_observer_data_reducer.reset( new Utility::HierarchicalReducer( *comm, 0 ) );
+
+  // Calculate the number of batches per rendezvous (the root process only
+  // simulates histories with the work stealing schedule)
+  if( d_schedule_type == WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE )
+  {
+    d_batches_per_rendezvous =
+      properties->getNumberOfBatchesPerProcessor()*comm->size();
+  }
+  else
+  {
+    d_batches_per_rendezvous =
+      properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
+  }
 
   // Calculate the batch size
   uint64_t batch_size =
@@ -114,11 +136,25 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
   // The simulation has started
   this->registerSimulationStartedEvent();
 
-  if( d_comm->rank() == 0 )
+  d_batches_completed = 0;
+  d_histories_completed = 0;
+  d_busy_time = 0.0;
+
+  std::shared_ptr<Utility::Timer> wall_timer = d_comm->createTimer();
+
+  wall_timer->start();
+
+  if( d_schedule_type == WORK_STEALING_DISTRIBUTED_BATCH_SCHEDULE )
+    this->shareWork();
+  else if( d_comm->rank() == 0 )
     this->coordinateWorkers();
   else
     this->work();
 
+  wall_timer->stop();
+
+  this->gatherProcessLoadBalanceTelemetry( wall_timer->elapsed().count() );
+
   d_comm->barrier();
 
   // The simulation has finished
@@ -135,58 +171,91 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
 }
 
 // Coorindate workers
+/*! \details With the static schedule every batch of a rendezvous batch has
+ * the same size (the last batch is assigned any remaining histories). With
+ * the adaptive schedule the batch size is calculated from the throughput
+ * that the idle worker measured for its previous batch.
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorkers()
 {
   // The current batch number
   uint64_t batch_number = 0;
 
+  // The number of histories assigned in the current rendezvous batch
+  uint64_t assigned_histories = 0;
+
   // The batch info (start history, end history + 1)
   std::pair<uint64_t,uint64_t> task;
 
   // The idle worker info
   Utility::Communicator::Status idle_worker_info;
 
+  // The adaptive batch sizer (the min batch size is a quarter of the base
+  // batch size)
+  AdaptiveBatchSizer batch_sizer( d_comm->size()-1,
+                                  this->getBatchSize(),
+                                  std::max( this->getBatchSize()/4,
+                                            (uint64_t)1 ) );
+
   bool rendezvous_required = false;
   
   while( true )
   {
     if( this->isSimulationComplete() )
     {
-      this->stopWorkersAndRecordWork( true, rendezvous_required, batch_number );
+      this->stopWorkersAndRecordWork( true, rendezvous_required, assigned_histories );
 
       break;
     }
-    else if( batch_number == d_batches_per_rendezvous )
+    else if( assigned_histories == this->getRendezvousBatchSize() )
     {
-      this->stopWorkersAndRecordWork( false, true, batch_number );
+      this->stopWorkersAndRecordWork( false, true, assigned_histories );
       
       // The rendezvous is complete
       rendezvous_required = false;
       
-      // Reset the batch number
+      // Reset the batch number and the assigned histories
       batch_number = 0;
+      assigned_histories = 0;
       
       continue;
     }
     else if( this->isIdleWorkerPresent( idle_worker_info ) )
     {
-      // Set the batch start history
-      task.first = this->getNextHistory() + batch_number*this->getBatchSize();
-      
-      task.second = task.first + this->getBatchSize();
+      const double worker_throughput =
+        this->receiveIdleWorkerMessage( idle_worker_info );
 
-      // Check if the size of the last batch is correct
-      if( batch_number == d_batches_per_rendezvous - 1 )
+      const uint64_t remaining_histories =
+        this->getRendezvousBatchSize() - assigned_histories;
+
+      uint64_t batch_size;
+
+      if( d_schedule_type == ADAPTIVE_DISTRIBUTED_BATCH_SCHEDULE )
       {
-        task.second += this->getRendezvousBatchSize() -
-          d_batches_per_rendezvous*this->getBatchSize();
+        const unsigned worker_id = idle_worker_info.source()-1;
+
+        batch_sizer.recordWorkerThroughput( worker_id, worker_throughput );
+
+        batch_size =
+          batch_sizer.calculateBatchSize( worker_id, remaining_histories );
       }
+      // Check if the size of the last batch is correct
+      else if( batch_number == d_batches_per_rendezvous - 1 )
+        batch_size = remaining_histories;
+      else
+        batch_size = this->getBatchSize();
+      
+      // Set the batch start history
+      task.first = this->getNextHistory() + assigned_histories;
+      
+      task.second = task.first + batch_size;
 
       this->assignWorkToIdleWorker( idle_worker_info, task );
 
-      // Increment the batch number
+      // Increment the batch number and the assigned histories
       ++batch_number;
+      assigned_histories += batch_size;
 
       // A rendezvous is required
       rendezvous_required = true;
@@ -199,10 +268,10 @@ template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRecordWork(
                                                 const bool simulation_complete,
                                                 const bool rendezvous_required,
-                                                const uint64_t batch_number )
+                                                const uint64_t assigned_histories )
 {
   // The idle worker messages
-  std::vector<int> idle_worker_messages( d_comm->size()-1 );
+  std::vector<double> idle_worker_messages( d_comm->size()-1 );
   
   // The request for each worker
   std::vector<Utility::Communicator::Request> requests;
@@ -248,10 +317,7 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRe
   Utility::wait( requests, statuses );
 
   // Increment the next history
-  if( batch_number == d_batches_per_rendezvous )
-    this->incrementNextHistory( this->getRendezvousBatchSize() );
-  else
-    this->incrementNextHistory( batch_number*this->getBatchSize() );
+  this->incrementNextHistory( assigned_histories );
 
   // Rendezvous after rendezvous batch completed
   if( !simulation_complete )
@@ -268,7 +334,7 @@ bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPres
 {
   // Probe for an idle worker
   try{
-    idle_worker_info = Utility::iprobe<int>( *d_comm );
+    idle_worker_info = Utility::iprobe<double>( *d_comm, 0 );
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "Unable to probe for idle worker on root "
@@ -277,14 +343,17 @@ bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPres
   return idle_worker_info.hasMessageDetails();
 }
 
-// Assign work to idle worker
+// Receive the idle worker message (worker throughput)
+/*! \details The idle worker message is the throughput (histories/s) that
+ * the worker measured for its previous batch (0.0 if the worker has not
+ * completed a batch yet).
+ */
 template<ParticleModeType mode>
-void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorker(
-                         const Utility::Communicator::Status& idle_worker_info,
-                         const std::pair<uint64_t,uint64_t>& task )
+double BatchedDistributedStandardParticleSimulationManager<mode>::receiveIdleWorkerMessage(
+                        const Utility::Communicator::Status& idle_worker_info )
 {
   // Contact the idle worker
-  int idle_worker_message;
+  double idle_worker_message;
   
   try{
     Utility::receive( *d_comm,
@@ -297,6 +366,15 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdle
                            "worker process "
                            << idle_worker_info.source() << "!" );
 
+  return idle_worker_message;
+}
+
+// Assign work to idle worker
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorker(
+                         const Utility::Communicator::Status& idle_worker_info,
+                         const std::pair<uint64_t,uint64_t>& task )
+{
   // Assign the task to the worker
   try{
     Utility::send( *d_comm,
@@ -316,7 +394,8 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::work()
 {
   std::pair<uint64_t,uint64_t> task;
 
-  int idle_message = 1;
+  // The throughput of the previous batch (histories/s)
+  double idle_message = 0.0;
   
   while( true )
   {
@@ -338,7 +417,15 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::work()
 
     // Run the simulation batch
     if( task.first != task.second )
-      this->runSimulationBatch( task.first, task.second );
+    {
+      const double busy_time =
+        this->runAndRecordSimulationBatch( task.first, task.second );
+
+      if( busy_time > 0.0 )
+        idle_message = (task.second - task.first)/busy_time;
+      else
+        idle_message = 0.0;
+    }
     else
     {
       // Rendezvous with the root process
@@ -352,12 +439,374 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::work()
   }
 }
 
+// Share the work of each rendezvous batch with all processes
+/*! \details The root process decides if another rendezvous batch is required
+ * and broadcasts the start history of the rendezvous batch. The simulation
+ * wall time is therefore only checked between rendezvous batches.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::shareWork()
+{
+  while( true )
+  {
+    int simulation_complete = 0;
+
+    if( d_comm->rank() == 0 )
+      simulation_complete = this->isSimulationComplete();
+
+    uint64_t start_history = this->getNextHistory();
+    
+    try{
+      Utility::broadcast( *d_comm, simulation_complete, 0 );
+      Utility::broadcast( *d_comm, start_history, 0 );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Process " << d_comm->rank() << " unable to "
+                             "receive the rendezvous batch info from the "
+                             "root process!" );
+
+    if( simulation_complete )
+      break;
+
+    this->runWorkStealingRendezvousBatch(
+                      start_history,
+                      start_history + this->getRendezvousBatchSize() );
+
+    if( d_comm->rank() == 0 )
+      this->incrementNextHistory( this->getRendezvousBatchSize() );
+
+    this->rendezvous();
+  }
+}
+
+// Complete a rendezvous batch using work stealing
+/*! \details Every process is assigned an equal range of the rendezvous batch
+ * histories. A process simulates batches from the front of its range and
+ * services steal requests between batches by giving away the back half of
+ * the histories that remain in its range. Once the range of a process is
+ * empty it will attempt to steal histories from the other processes (in
+ * rank order starting with the next process). A process that fails to steal
+ * from every other process is done - histories are only ever moved to a
+ * process that will simulate them so no histories can be lost.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::runWorkStealingRendezvousBatch(
+                                                  const uint64_t start_history,
+                                                  const uint64_t end_history )
+{
+  // Make sure the history range is valid
+  testPrecondition( start_history <= end_history );
+
+  const uint64_t number_of_processes = d_comm->size();
+  const uint64_t rank = d_comm->rank();
+  
+  const uint64_t histories_per_process =
+    (end_history - start_history)/number_of_processes;
+  
+  const uint64_t extra_histories =
+    (end_history - start_history)%number_of_processes;
+
+  // The history range of this process (the first processes are assigned one
+  // extra history)
+  std::pair<uint64_t,uint64_t> history_range;
+  
+  history_range.first = start_history + rank*histories_per_process +
+    std::min( rank, extra_histories );
+
+  history_range.second = history_range.first + histories_per_process;
+
+  if( rank < extra_histories )
+    ++history_range.second;
+
+  while( true )
+  {
+    this->serviceStealRequests( history_range );
+
+    if( history_range.first < history_range.second )
+    {
+      const uint64_t batch_start_history = history_range.first;
+      
+      history_range.first = std::min( history_range.first + this->getBatchSize(),
+                                      history_range.second );
+
+      this->runAndRecordSimulationBatch( batch_start_history,
+                                         history_range.first );
+    }
+    else if( !this->stealHistories( history_range ) )
+      break;
+  }
+
+  this->waitForRendezvousBatchCompletion( history_range );
+}
+
+// Service the pending steal requests from other processes
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::serviceStealRequests(
+                                std::pair<uint64_t,uint64_t>& history_range )
+{
+  Utility::Communicator::Status steal_request_info;
+  
+  while( true )
+  {
+    try{
+      steal_request_info = Utility::iprobe<int>( *d_comm,
+                                                 d_comm->anySourceValue(),
+                                                 s_steal_request_tag );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Process " << d_comm->rank() << " unable to "
+                             "probe for steal requests!" );
+
+    if( !steal_request_info.hasMessageDetails() )
+      break;
+
+    int steal_request;
+
+    try{
+      Utility::receive( *d_comm,
+                        steal_request_info.source(),
+                        s_steal_request_tag,
+                        steal_request );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Process " << d_comm->rank() << " unable to "
+                             "receive steal request from process "
+                             << steal_request_info.source() << "!" );
+
+    // Give away the back half of the remaining histories
+    std::array<uint64_t,2> stolen_range;
+
+    stolen_range[1] = history_range.second;
+    stolen_range[0] = history_range.second -
+      (history_range.second - history_range.first)/2;
+
+    history_range.second = stolen_range[0];
+
+    try{
+      Utility::send( *d_comm,
+                     steal_request_info.source(),
+                     s_steal_reply_tag,
+                     Utility::arrayViewOfConst( stolen_range ) );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Process " << d_comm->rank() << " unable to "
+                             "send steal reply to process "
+                             << steal_request_info.source() << "!" );
+  }
+}
+
+// Steal histories from another process
+/*! \details Steal requests from other processes are serviced while waiting
+ * for a steal reply so that two processes that attempt to steal from each
+ * other cannot deadlock. True will be returned if histories were stolen.
+ */
+template<ParticleModeType mode>
+bool BatchedDistributedStandardParticleSimulationManager<mode>::stealHistories(
+                                std::pair<uint64_t,uint64_t>& history_range )
+{
+  for( int i = 1; i < d_comm->size(); ++i )
+  {
+    const int victim = (d_comm->rank() + i)%d_comm->size();
+
+    int steal_request = 1;
+
+    try{
+      Utility::send( *d_comm, victim, s_steal_request_tag, steal_request );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Process " << d_comm->rank() << " unable to "
+                             "send steal request to process " << victim
+                             << "!" );
+
+    // Wait for the steal reply
+    while( true )
+    {
+      Utility::Communicator::Status steal_reply_info;
+      
+      try{
+        steal_reply_info =
+          Utility::iprobe<uint64_t>( *d_comm, victim, s_steal_reply_tag );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Process " << d_comm->rank() << " unable to "
+                               "probe for steal reply from process "
+                               << victim << "!" );
+
+      if( steal_reply_info.hasMessageDetails() )
+        break;
+      
+      this->serviceStealRequests( history_range );
+    }
+
+    std::array<uint64_t,2> stolen_range;
+
+    try{
+      Utility::receive( *d_comm,
+                        victim,
+                        s_steal_reply_tag,
+                        Utility::arrayView( stolen_range ) );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Process " << d_comm->rank() << " unable to "
+                             "receive steal reply from process " << victim
+                             << "!" );
+
+    if( stolen_range[0] < stolen_range[1] )
+    {
+      history_range.first = stolen_range[0];
+      history_range.second = stolen_range[1];
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Wait for all processes to complete the rendezvous batch
+/*! \details Steal requests will be serviced (with empty ranges) until every
+ * other process has reported that it has completed the rendezvous batch.
+ */
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::waitForRendezvousBatchCompletion(
+                                std::pair<uint64_t,uint64_t>& history_range )
+{
+  // Make sure that all histories have been simulated
+  testPrecondition( history_range.first == history_range.second );
+  
+  int rendezvous_batch_complete_message = 1;
+  
+  std::vector<Utility::Communicator::Request> requests;
+
+  for( int i = 0; i < d_comm->size(); ++i )
+  {
+    if( i != d_comm->rank() )
+    {
+      try{
+        requests.push_back(
+                      Utility::isend( *d_comm,
+                                      i,
+                                      s_rendezvous_batch_complete_tag,
+                                      rendezvous_batch_complete_message ) );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Process " << d_comm->rank() << " unable to "
+                               "send rendezvous batch complete message to "
+                               "process " << i << "!" );
+    }
+  }
+
+  int incomplete_processes = d_comm->size()-1;
+
+  while( incomplete_processes > 0 )
+  {
+    Utility::Communicator::Status complete_process_info;
+
+    try{
+      complete_process_info =
+        Utility::iprobe<int>( *d_comm,
+                              d_comm->anySourceValue(),
+                              s_rendezvous_batch_complete_tag );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Process " << d_comm->rank() << " unable to "
+                             "probe for rendezvous batch complete "
+                             "messages!" );
+
+    if( complete_process_info.hasMessageDetails() )
+    {
+      int message;
+
+      try{
+        Utility::receive( *d_comm,
+                          complete_process_info.source(),
+                          s_rendezvous_batch_complete_tag,
+                          message );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Process " << d_comm->rank() << " unable to "
+                               "receive rendezvous batch complete message "
+                               "from process "
+                               << complete_process_info.source() << "!" );
+
+      --incomplete_processes;
+    }
+    else
+      this->serviceStealRequests( history_range );
+  }
+
+  // Wait for the rendezvous batch complete messages to send
+  std::vector<Utility::Communicator::Status> statuses( requests.size() );
+
+  Utility::wait( requests, statuses );
+}
+
+// Run a simulation batch and record the work (return the busy time)
+template<ParticleModeType mode>
+double BatchedDistributedStandardParticleSimulationManager<mode>::runAndRecordSimulationBatch(
+                                            const uint64_t batch_start_history,
+                                            const uint64_t batch_end_history )
+{
+  std::shared_ptr<Utility::Timer> timer = d_comm->createTimer();
+
+  timer->start();
+
+  this->runSimulationBatch( batch_start_history, batch_end_history );
+
+  timer->stop();
+
+  const double busy_time = timer->elapsed().count();
+
+  ++d_batches_completed;
+  d_histories_completed += batch_end_history - batch_start_history;
+  d_busy_time += busy_time;
+
+  return busy_time;
+}
+
+// Gather the process load balance telemetry on the root process
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::gatherProcessLoadBalanceTelemetry(
+                                                       const double wall_time )
+{
+  std::vector<uint64_t> batches, histories;
+  std::vector<double> busy_times, wall_times;
+
+  try{
+    Utility::gather( *d_comm, d_batches_completed, batches, 0 );
+    Utility::gather( *d_comm, d_histories_completed, histories, 0 );
+    Utility::gather( *d_comm, d_busy_time, busy_times, 0 );
+    Utility::gather( *d_comm, wall_time, wall_times, 0 );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to gather the process load balance "
+                           "telemetry on the root process!" );
+
+  if( d_comm->rank() == 0 )
+  {
+    d_process_load_balance_telemetry.setNumberOfProcesses( d_comm->size() );
+
+    for( int i = 0; i < d_comm->size(); ++i )
+    {
+      d_process_load_balance_telemetry.setProcessRecord( i,
+                                                         batches[i],
+                                                         histories[i],
+                                                         busy_times[i],
+                                                         wall_times[i] );
+    }
+  }
+}
+
 // Print the simulation data to the desired stream
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::printSimulationSummary( std::ostream& os ) const
 {
   if( d_comm->rank() == 0 )
+  {
     ParticleSimulationManager::printSimulationSummary( os );
+
+    d_process_load_balance_telemetry.print( os );
+  }
 }
 
 // Log the simulation data
@@ -365,7 +814,15 @@ template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::logSimulationSummary() const
 {
   if( d_comm->rank() == 0 )
+  {
     ParticleSimulationManager::logSimulationSummary();
+
+    std::ostringstream oss;
+
+    d_process_load_balance_telemetry.print( oss );
+
+    FRENSIE_LOG_NOTIFICATION( oss.str() );
+  }
 }
 
 // The signal handler
@@ -381,7 +838,7 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::signalHandler( i
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::rendezvous()
 {
-  this->reduceData( *d_comm, 0 );
+  this->reduceData( *d_observer_data_reducer, *d_comm, 0 );
 
   if( d_comm->rank() == 0 )
     ParticleSimulationManager::rendezvous();
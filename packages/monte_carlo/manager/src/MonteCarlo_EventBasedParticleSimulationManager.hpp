@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EventBasedParticleSimulationManager.hpp
+//! \author Alex Robinson
+//! \brief  Event-based particle simulation manager class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_HPP
+#define MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_HPP
+
+// FRENSIE Includes
+#include "MonteCarlo_StandardParticleSimulationManager.hpp"
+#include "MonteCarlo_ParticleEventQueue.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_Map.hpp"
+
+namespace MonteCarlo{
+
+/*! The event-based particle simulation manager class
+ *
+ * Each thread collects the particles of several consecutive histories (a
+ * history batch) in its own event queues, which are sorted by particle type.
+ * The particles in each queue are then simulated together one event stage at
+ * a time (see ParticleSimulationManager::simulateParticleEvents). The
+ * observers accumulate the contributions of each history in the batch in a
+ * separate history contribution slot (see
+ * MonteCarlo::ParticleHistoryObserver), which are committed once every
+ * particle in the batch is gone. Each history in a batch draws its random
+ * numbers from its own stream (the generator state of the history is
+ * restored before the events of one of its particles are simulated) so the
+ * random numbers of a history do not depend on the batch that it is
+ * simulated in. Particle types
+ * that have forced collision cells are simulated with the history-based
+ * "alternative" tracking method.
+ */
+template<ParticleModeType mode>
+class EventBasedParticleSimulationManager : public ParticleSimulationManager
+{
+
+public:
+
+  //! Constructor
+  EventBasedParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<const WeightWindow> weight_windows,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file );
+
+  //! Destructor
+  ~EventBasedParticleSimulationManager()
+  { /* ... */ }
+
+protected:
+
+  //! Simulate an unresolved particle
+  void simulateUnresolvedParticle( ParticleState& unresolved_particle,
+                                   ParticleBank& bank,
+                                   const bool source_particle ) final override;
+
+  //! Enable thread support
+  void enableThreadSupport() final override;
+
+  //! Simulate a history
+  void simulateHistory( const uint64_t history,
+                        ParticleBank& source_bank,
+                        ParticleBank& bank ) final override;
+
+  //! Finish the histories that have been started by the calling thread
+  void finishThreadHistories( ParticleBank& source_bank,
+                              ParticleBank& bank ) final override;
+
+  //! Return the max number of histories that a thread simulates together
+  unsigned getThreadHistoryBatchSize() const final override;
+
+  //! Select the history that the next particle events belong to
+  void selectParticleHistory( const uint64_t history ) final override;
+
+private:
+
+  // The simulation functions
+  typedef std::function<void(ParticleState&, ParticleBank&, const bool)>
+  SimulateParticleFunction;
+
+  typedef std::map<ParticleType,SimulateParticleFunction>
+  SimulateParticleFunctionMap;
+
+  // The event simulation functions
+  typedef std::function<void(ParticleEventQueue&, ParticleBank&)>
+  SimulateParticleEventsFunction;
+
+  typedef std::map<ParticleType,SimulateParticleEventsFunction>
+  SimulateParticleEventsFunctionMap;
+
+  // The event queues
+  typedef std::map<ParticleType,ParticleEventQueue> ParticleEventQueueMap;
+
+  // The history batch of a thread
+  struct ThreadHistoryBatch
+  {
+    // The event queues (reused by every batch simulated by the thread)
+    ParticleEventQueueMap event_queues;
+
+    // The first history in the batch
+    uint64_t first_history;
+
+    // The number of histories that have been added to the batch
+    unsigned number_of_histories;
+
+    // The histories whose source particle states have been sampled
+    std::vector<uint64_t> started_histories;
+
+    // The random number generator state of each history in the batch
+    // (indexed by the history offset from the first history)
+    std::vector<Utility::RandomNumberGenerator::GeneratorState>
+    random_number_generator_states;
+
+    // The offset of the history whose random number generator state is
+    // loaded in the thread's stream
+    unsigned active_history_offset;
+  };
+
+  // Add simulate particle function for particle type
+  template<typename State>
+  void addSimulateParticleFunction();
+
+  // Move the particles in a bank to the event queues
+  void fillEventQueues( ParticleBank& particles,
+                        ParticleBank& bank,
+                        ParticleEventQueueMap& event_queues,
+                        const bool source_particles );
+
+  // Simulate the histories in a thread history batch
+  void simulateThreadHistoryBatch( ThreadHistoryBatch& batch,
+                                   ParticleBank& bank );
+
+  // Add the mode initialization helper class as a friend
+  template<typename T, typename U>
+  friend class Details::ModeInitializationHelper;
+
+  // The history-based simulation functions
+  SimulateParticleFunctionMap d_simulate_particle_function_map;
+
+  // The event-based simulation functions
+  SimulateParticleEventsFunctionMap d_simulate_particle_events_function_map;
+
+  // The history batch of each thread
+  std::vector<ThreadHistoryBatch> d_thread_history_batches;
+
+  // The max number of histories in a thread history batch
+  static const unsigned s_thread_history_batch_size;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_EventBasedParticleSimulationManager_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EventBasedParticleSimulationManager.hpp
+//---------------------------------------------------------------------------//
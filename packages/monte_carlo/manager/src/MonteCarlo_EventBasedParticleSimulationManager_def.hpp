@@ -0,0 +1,371 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_EventBasedParticleSimulationManager_def.hpp
+//! \author Alex Robinson
+//! \brief  Event-based particle simulation manager definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+#define MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+// Boost Includes
+#include <boost/mpl/begin_end.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleModeTypeTraits.hpp"
+#include "MonteCarlo_ParticleHistoryObserver.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+
+namespace MonteCarlo{
+
+// The max number of histories in a thread history batch
+template<ParticleModeType mode>
+const unsigned EventBasedParticleSimulationManager<mode>::s_thread_history_batch_size = 64;
+
+// Constructor
+template<ParticleModeType mode>
+EventBasedParticleSimulationManager<mode>::EventBasedParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<const WeightWindow> weight_windows,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file )
+  : ParticleSimulationManager( simulation_name,
+                               archive_type,
+                               model,
+                               source,
+                               event_handler,
+                               weight_windows,
+                               collision_forcer,
+                               properties,
+                               next_history,
+                               rendezvous_number,
+                               use_single_rendezvous_file )
+{
+  Details::ModeInitializationHelper<typename boost::mpl::begin<typename ParticleModeTypeTraits<mode>::ActiveParticles>::type,typename boost::mpl::end<typename ParticleModeTypeTraits<mode>::ActiveParticles>::type>::initializeSimulateParticleFunctions( *this );
+}
+
+// Simulate an unresolved particle
+/*! \details The particle will be simulated with history-based transport.
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::simulateUnresolvedParticle(
+                                            ParticleState& unresolved_particle,
+                                            ParticleBank& bank,
+                                            const bool source_particle )
+{
+  typename SimulateParticleFunctionMap::const_iterator simulation_function_it =
+    d_simulate_particle_function_map.find( unresolved_particle.getParticleType() );
+
+  // Only simulate the particle if there is a simulation function associated
+  // with the type
+  if( simulation_function_it != d_simulate_particle_function_map.end() )
+  {
+    // The particle may belong to any history in the thread's history batch
+    this->selectParticleHistory( unresolved_particle.getHistoryNumber() );
+
+    simulation_function_it->second( unresolved_particle, bank, source_particle );
+  }
+  else
+    unresolved_particle.setAsGone();
+}
+
+// Enable thread support
+/*! \details Each thread gets its own history batch (and event queues).
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::enableThreadSupport()
+{
+  ParticleSimulationManager::enableThreadSupport();
+
+  d_thread_history_batches.clear();
+  d_thread_history_batches.resize(
+                     Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  for( size_t i = 0; i < d_thread_history_batches.size(); ++i )
+  {
+    d_thread_history_batches[i].first_history = 0;
+    d_thread_history_batches[i].number_of_histories = 0;
+    d_thread_history_batches[i].started_histories.reserve(
+                                                 s_thread_history_batch_size );
+    d_thread_history_batches[i].random_number_generator_states.resize(
+                                                 s_thread_history_batch_size );
+    d_thread_history_batches[i].active_history_offset = 0;
+  }
+}
+
+// Simulate a history
+/*! \details The particles generated by the source are moved to the event
+ * queues of the calling thread's history batch. The batch will only be
+ * simulated once it is full or once the next history cannot share the
+ * observer history contribution slots with the histories already in the
+ * batch (i.e. it is not within s_thread_history_batch_size of the first
+ * history in the batch). The random number generator is initialized for
+ * every history - the generator state of the history is saved when the
+ * events of a particle from another history in the batch are simulated (see
+ * EventBasedParticleSimulationManager::selectParticleHistory) so that every
+ * history draws the same random numbers that it would draw in a batch of its
+ * own.
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::simulateHistory(
+                                                     const uint64_t history,
+                                                     ParticleBank& source_bank,
+                                                     ParticleBank& bank )
+{
+  ThreadHistoryBatch& batch =
+    d_thread_history_batches[Utility::OpenMPProperties::getThreadId()];
+
+  if( batch.number_of_histories > 0 )
+  {
+    if( history < batch.first_history ||
+        history >= batch.first_history + s_thread_history_batch_size )
+      this->simulateThreadHistoryBatch( batch, bank );
+  }
+
+  if( batch.number_of_histories == 0 )
+    batch.first_history = history;
+
+  // Save the generator state of the history that is currently loaded
+  else
+  {
+    Utility::RandomNumberGenerator::saveState(
+      batch.random_number_generator_states[batch.active_history_offset] );
+  }
+
+  // Initialize the random number generator for this history
+  Utility::RandomNumberGenerator::initialize( history );
+
+  batch.active_history_offset = history - batch.first_history;
+
+  ++batch.number_of_histories;
+
+  ParticleHistoryObserver::selectHistoryContributionSlot( history );
+
+  // Sample a particle state from the source
+  if( this->sampleHistorySourceParticleStates( source_bank, history ) )
+  {
+    batch.started_histories.push_back( history );
+
+    this->fillEventQueues( source_bank, bank, batch.event_queues, true );
+  }
+
+  // Simulate the batch once it is full
+  if( history + 1 >= batch.first_history + s_thread_history_batch_size )
+    this->simulateThreadHistoryBatch( batch, bank );
+}
+
+// Finish the histories that have been started by the calling thread
+/*! \details The partially filled history batch of the calling thread will
+ * be simulated.
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::finishThreadHistories(
+                                                     ParticleBank&,
+                                                     ParticleBank& bank )
+{
+  ThreadHistoryBatch& batch =
+    d_thread_history_batches[Utility::OpenMPProperties::getThreadId()];
+
+  if( batch.number_of_histories > 0 )
+    this->simulateThreadHistoryBatch( batch, bank );
+}
+
+// Return the max number of histories that a thread simulates together
+template<ParticleModeType mode>
+unsigned EventBasedParticleSimulationManager<mode>::getThreadHistoryBatchSize() const
+{
+  return s_thread_history_batch_size;
+}
+
+// Select the history that the next particle events belong to
+/*! \details The observer history contribution slot of the history will be
+ * selected. If the history is not the history whose random number generator
+ * state is currently loaded, the loaded state will be saved and the state of
+ * the history will be restored.
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::selectParticleHistory(
+                                                       const uint64_t history )
+{
+  ThreadHistoryBatch& batch =
+    d_thread_history_batches[Utility::OpenMPProperties::getThreadId()];
+
+  // Make sure that the history belongs to the batch
+  testPrecondition( history >= batch.first_history );
+  testPrecondition( history < batch.first_history +
+                    s_thread_history_batch_size );
+
+  ParticleHistoryObserver::selectHistoryContributionSlot( history );
+
+  const unsigned history_offset = history - batch.first_history;
+
+  if( history_offset != batch.active_history_offset )
+  {
+    Utility::RandomNumberGenerator::saveState(
+      batch.random_number_generator_states[batch.active_history_offset] );
+
+    Utility::RandomNumberGenerator::restoreState(
+                   batch.random_number_generator_states[history_offset] );
+
+    batch.active_history_offset = history_offset;
+  }
+}
+
+// Simulate the histories in a thread history batch
+/*! \details The queues are processed until they are empty. The progeny
+ * created while processing the queues are moved to the queues next. The
+ * histories in the batch only end once the particle bank is empty, at which
+ * point the observer history contributions of each history will be
+ * committed.
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::simulateThreadHistoryBatch(
+                                                     ThreadHistoryBatch& batch,
+                                                     ParticleBank& bank )
+{
+  while( true )
+  {
+    typename ParticleEventQueueMap::iterator event_queue_it =
+      batch.event_queues.begin();
+
+    while( event_queue_it != batch.event_queues.end() )
+    {
+      if( !event_queue_it->second.isEmpty() )
+      {
+        d_simulate_particle_events_function_map.find(
+              event_queue_it->first )->second( event_queue_it->second, bank );
+      }
+
+      ++event_queue_it;
+    }
+
+    // The histories only end when the particle bank is empty
+    if( bank.isEmpty() )
+      break;
+
+    this->fillEventQueues( bank, bank, batch.event_queues, false );
+  }
+
+  // Histories complete - commit all observer history contributions
+  for( size_t i = 0; i < batch.started_histories.size(); ++i )
+  {
+    ParticleHistoryObserver::selectHistoryContributionSlot(
+                                                  batch.started_histories[i] );
+
+    this->getEventHandler().commitObserverHistoryContributions();
+  }
+
+  batch.started_histories.clear();
+  batch.number_of_histories = 0;
+}
+
+// Move the particles in a bank to the event queues
+/*! \details Particles that must be simulated with history-based transport
+ * will be simulated immediately. Their progeny will be added to the bank.
+ */
+template<ParticleModeType mode>
+void EventBasedParticleSimulationManager<mode>::fillEventQueues(
+                                         ParticleBank& particles,
+                                         ParticleBank& bank,
+                                         ParticleEventQueueMap& event_queues,
+                                         const bool source_particles )
+{
+  while( !particles.isEmpty() )
+  {
+    const ParticleType particle_type = particles.top().getParticleType();
+
+    if( d_simulate_particle_events_function_map.count( particle_type ) )
+    {
+      // The bank will create a copy of the particle that is owned by the
+      // event queue
+      std::shared_ptr<ParticleState> particle;
+
+      particles.pop( particle );
+
+      event_queues[particle_type].push( particle, source_particles );
+    }
+    else
+    {
+      this->simulateUnresolvedParticle( particles.top(),
+                                        bank,
+                                        source_particles );
+
+      particles.pop();
+    }
+  }
+}
+
+// Add simulate particle function for particle type
+template<ParticleModeType mode>
+template<typename State>
+void EventBasedParticleSimulationManager<mode>::addSimulateParticleFunction()
+{
+  constexpr const ParticleType particle_type = State::type;
+
+  // Make sure that the state is compatible with the mode
+  testPrecondition( MonteCarlo::isParticleTypeCompatible<mode>( particle_type ) );
+
+  // Forced collisions can only be done with the history-based "alternative"
+  // tracking method
+  if( this->getCollisionForcer().hasForcedCollisionCells( particle_type ) )
+  {
+    d_simulate_particle_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticleAlternative<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3 );
+  }
+  // Condensed history is only done with the history-based tracking method
+  else if( this->template isCondensedHistoryUsed<State>() )
+  {
+    d_simulate_particle_function_map[particle_type] =
+      std::bind<void>( &EventBasedParticleSimulationManager::simulateElectronCondensedHistory,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3 );
+  }
+  // Delta tracking is only done with the history-based tracking method
+  else if( this->template isDeltaTrackingUsed<State>() )
+  {
+    d_simulate_particle_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticleDeltaTracking<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3 );
+  }
+  else
+  {
+    d_simulate_particle_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticle<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3 );
+
+    d_simulate_particle_events_function_map[particle_type] =
+      std::bind<void>( &ParticleSimulationManager::simulateParticleEvents<State>,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2 );
+  }
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_EVENT_BASED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_EventBasedParticleSimulationManager_def.hpp
+//---------------------------------------------------------------------------//
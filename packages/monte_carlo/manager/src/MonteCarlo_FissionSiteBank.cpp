@@ -0,0 +1,521 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionSiteBank.cpp
+//! \author Alex Robinson
+//! \brief  Fission site bank class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <iterator>
+#include <functional>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data (2^32)
+const double FissionSiteBank::s_fixed_point_scale = 4294967296.0;
+
+// Default constructor
+FissionSiteBank::FissionSiteBank()
+  : d_sites(),
+    d_last_history_number( std::numeric_limits<uint64_t>::max() ),
+    d_next_site_index( 0 )
+{ /* ... */ }
+
+// Check if the bank is empty
+bool FissionSiteBank::isEmpty() const
+{
+  return d_sites.empty();
+}
+
+// The size of the bank
+size_t FissionSiteBank::size() const
+{
+  return d_sites.size();
+}
+
+// Access a site
+const FissionSiteBank::Site& FissionSiteBank::operator[](
+                                                    const size_t index ) const
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_sites.size() );
+
+  return d_sites[index];
+}
+
+// Bank the site of a fission neutron
+/*! \details The index of the site will be the number of sites that have
+ * already been banked in the history of the neutron. The histories
+ * simulated by the thread that fills the bank must therefore not be
+ * interleaved.
+ */
+void FissionSiteBank::push( const NeutronState& neutron )
+{
+  // Make sure the neutron weight is valid
+  testPrecondition( neutron.getWeight() > 0.0 );
+
+  if( neutron.getHistoryNumber() != d_last_history_number )
+  {
+    d_last_history_number = neutron.getHistoryNumber();
+    d_next_site_index = 0;
+  }
+
+  Site site;
+  site.history_number = d_last_history_number;
+  site.index = d_next_site_index;
+
+  std::copy( neutron.getPosition(), neutron.getPosition()+3, site.position );
+  std::copy( neutron.getDirection(), neutron.getDirection()+3, site.direction );
+
+  site.energy = neutron.getEnergy();
+  site.weight = neutron.getWeight();
+
+  d_sites.push_back( site );
+
+  ++d_next_site_index;
+}
+
+// Bank a site
+void FissionSiteBank::push( const Site& site )
+{
+  // Make sure the site weight is valid
+  testPrecondition( site.weight > 0.0 );
+
+  d_sites.push_back( site );
+}
+
+// Remove all sites from the bank
+void FissionSiteBank::clear()
+{
+  d_sites.clear();
+
+  d_last_history_number = std::numeric_limits<uint64_t>::max();
+  d_next_site_index = 0;
+}
+
+// Check if the bank is sorted
+bool FissionSiteBank::isSorted() const
+{
+  return std::is_sorted( d_sites.begin(), d_sites.end(), &FissionSiteBank::compare );
+}
+
+// Sort the sites
+/*! \details The sites will be sorted by history number first and then by
+ * their index in the history.
+ */
+void FissionSiteBank::sort()
+{
+  std::sort( d_sites.begin(), d_sites.end(), &FissionSiteBank::compare );
+}
+
+// Merge the bank with another sorted bank (the other bank will be empty)
+/*! \details Because the keys of the sites do not depend on the thread that
+ * banked them, the merged bank will always have the same ordering
+ * regardless of the order in which the thread banks are merged.
+ */
+void FissionSiteBank::merge( FissionSiteBank& other_bank )
+{
+  // Make sure that both banks are sorted
+  testPrecondition( this->isSorted() );
+  testPrecondition( other_bank.isSorted() );
+
+  std::vector<Site> merged_sites;
+  merged_sites.reserve( d_sites.size() + other_bank.d_sites.size() );
+
+  std::merge( d_sites.begin(), d_sites.end(),
+              other_bank.d_sites.begin(), other_bank.d_sites.end(),
+              std::back_inserter( merged_sites ),
+              &FissionSiteBank::compare );
+
+  d_sites.swap( merged_sites );
+
+  other_bank.clear();
+}
+
+// Return the total weight of the sites banked by all processes
+/*! \details The weights are summed using a fixed point representation so
+ * that the total weight does not depend on the number of processes that
+ * have banked the sites. This is a collective operation.
+ */
+double FissionSiteBank::getTotalWeight(
+                                    const Utility::Communicator& comm ) const
+{
+  uint64_t local_total_weight = 0;
+
+  for( size_t i = 0; i < d_sites.size(); ++i )
+    local_total_weight += FissionSiteBank::convertToFixedPoint( d_sites[i].weight );
+
+  uint64_t total_weight;
+
+  try{
+    Utility::allReduce( comm,
+                        local_total_weight,
+                        total_weight,
+                        std::plus<uint64_t>() );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to calculate the total fission site "
+                           "weight!" );
+
+  return FissionSiteBank::convertFromFixedPoint( total_weight );
+}
+
+// Resample the sites banked by all processes
+/*! \details Systematic (comb) sampling will be used to select the desired
+ * number of sites from the globally ordered bank (the sorted banks of the
+ * processes in rank order). The teeth of the comb are placed at
+ * (j+random_number)*W/N, where W is the total weight of the sites and N is
+ * the number of sites to select. A site is selected once for every tooth
+ * that falls in its cumulative weight interval. The cumulative weights are
+ * calculated with a parallel prefix sum (over the threads of each process
+ * and over the processes using a scan) of the fixed point site weights, which
+ * makes the selected sites independent of the number of threads and
+ * processes. The random number must be the same on every process. Once the
+ * sites have been selected they will be sent directly to the processes that
+ * own them - the first N%P processes will own N/P+1 sites and the remaining
+ * processes will own N/P sites (see
+ * MonteCarlo::FissionSiteBank::getProcessRangeStart). Only the first
+ * resampled site index of each process is gathered (the sites are never
+ * gathered). The weight of every resampled site will be one. This is a
+ * collective operation.
+ */
+void FissionSiteBank::resample( const Utility::Communicator& comm,
+                                const uint64_t number_of_sites,
+                                const double random_number )
+{
+  // Make sure the number of sites is valid
+  testPrecondition( number_of_sites > 0 );
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number < 1.0 );
+  // Make sure the bank is sorted
+  testPrecondition( this->isSorted() );
+
+  // Calculate the cumulative weights of the local sites
+  std::vector<uint64_t> prefix_sums;
+
+  const uint64_t local_total_weight =
+    this->calculateLocalPrefixSums( prefix_sums );
+
+  // Calculate the cumulative weight of the sites banked by the lower
+  // rank processes
+  uint64_t inclusive_weight_offset, total_weight;
+
+  try{
+    Utility::scan( comm,
+                   local_total_weight,
+                   inclusive_weight_offset,
+                   std::plus<uint64_t>() );
+
+    Utility::allReduce( comm,
+                        local_total_weight,
+                        total_weight,
+                        std::plus<uint64_t>() );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to calculate the fission site weight "
+                           "offsets!" );
+
+  TEST_FOR_EXCEPTION( total_weight == 0,
+                      std::runtime_error,
+                      "The fission sites cannot be resampled because no "
+                      "fission sites have been banked!" );
+
+  const uint64_t weight_offset = inclusive_weight_offset - local_total_weight;
+
+  // Determine the global indices of the sites that will be selected by
+  // this process
+  const uint64_t global_start_index =
+    FissionSiteBank::calculateNumberOfTeeth( weight_offset,
+                                             total_weight,
+                                             number_of_sites,
+                                             random_number );
+
+  const uint64_t global_end_index =
+    FissionSiteBank::calculateNumberOfTeeth( inclusive_weight_offset,
+                                             total_weight,
+                                             number_of_sites,
+                                             random_number );
+
+  std::vector<Site> resampled_sites( global_end_index - global_start_index );
+
+  // Copy each site once for every tooth in its cumulative weight interval
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < d_sites.size(); ++i )
+  {
+    const uint64_t first_copy_index =
+      FissionSiteBank::calculateNumberOfTeeth( weight_offset+prefix_sums[i],
+                                               total_weight,
+                                               number_of_sites,
+                                               random_number );
+
+    const uint64_t end_copy_index =
+      FissionSiteBank::calculateNumberOfTeeth( weight_offset+prefix_sums[i+1],
+                                               total_weight,
+                                               number_of_sites,
+                                               random_number );
+
+    for( uint64_t j = first_copy_index; j < end_copy_index; ++j )
+    {
+      Site& resampled_site = resampled_sites[j-global_start_index];
+
+      resampled_site = d_sites[i];
+      resampled_site.weight = 1.0;
+    }
+  }
+
+  this->redistribute( comm,
+                      number_of_sites,
+                      global_start_index,
+                      resampled_sites );
+
+  d_last_history_number = std::numeric_limits<uint64_t>::max();
+  d_next_site_index = 0;
+}
+
+// Return the start of the site range assigned to a process
+/*! \details The first number_of_sites%number_of_processes processes will be
+ * assigned one extra site. The end of the range assigned to a process is the
+ * start of the range assigned to the next process.
+ */
+uint64_t FissionSiteBank::getProcessRangeStart(
+                                           const uint64_t number_of_sites,
+                                           const int number_of_processes,
+                                           const int process_id )
+{
+  // Make sure the number of processes is valid
+  testPrecondition( number_of_processes > 0 );
+  // Make sure the process id is valid
+  testPrecondition( process_id >= 0 );
+  testPrecondition( process_id <= number_of_processes );
+
+  const uint64_t sites_per_process = number_of_sites/number_of_processes;
+  const uint64_t extra_sites = number_of_sites%number_of_processes;
+
+  return sites_per_process*process_id +
+    std::min( (uint64_t)process_id, extra_sites );
+}
+
+// Convert a weight to the fixed point representation
+inline uint64_t FissionSiteBank::convertToFixedPoint( const double weight )
+{
+  return (uint64_t)std::llround( weight*s_fixed_point_scale );
+}
+
+// Convert a fixed point weight to a double
+inline double FissionSiteBank::convertFromFixedPoint(
+                                           const uint64_t fixed_point_weight )
+{
+  return fixed_point_weight/s_fixed_point_scale;
+}
+
+// Calculate the fixed point weight prefix sums of the local sites
+/*! \details The exclusive prefix sums will be calculated (the first value
+ * is always zero and the last value is the total weight). The sites are
+ * divided into contiguous chunks (one for each thread). The sum of each
+ * chunk is calculated first. The chunk sums are then scanned and used as the
+ * starting values of the chunk prefix sums. Because integer addition is
+ * associative the prefix sums do not depend on the number of threads.
+ */
+uint64_t FissionSiteBank::calculateLocalPrefixSums(
+                                   std::vector<uint64_t>& prefix_sums ) const
+{
+  prefix_sums.resize( d_sites.size()+1 );
+  prefix_sums[0] = 0;
+
+  const unsigned number_of_threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  std::vector<uint64_t> chunk_offsets( number_of_threads+1, 0 );
+
+  #pragma omp parallel num_threads( number_of_threads )
+  {
+    const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+    const unsigned team_size = Utility::OpenMPProperties::getNumberOfThreads();
+
+    const size_t chunk_start = (d_sites.size()*thread_id)/team_size;
+    const size_t chunk_end = (d_sites.size()*(thread_id+1))/team_size;
+
+    // Calculate the chunk sum
+    uint64_t chunk_sum = 0;
+
+    for( size_t i = chunk_start; i < chunk_end; ++i )
+    {
+      chunk_sum += FissionSiteBank::convertToFixedPoint( d_sites[i].weight );
+
+      prefix_sums[i+1] = chunk_sum;
+    }
+
+    chunk_offsets[thread_id+1] = chunk_sum;
+
+    #pragma omp barrier
+
+    // Scan the chunk sums
+    #pragma omp master
+    {
+      for( unsigned i = 1; i <= team_size; ++i )
+        chunk_offsets[i] += chunk_offsets[i-1];
+    }
+
+    #pragma omp barrier
+
+    // Offset the chunk prefix sums
+    for( size_t i = chunk_start; i < chunk_end; ++i )
+      prefix_sums[i+1] += chunk_offsets[thread_id];
+  }
+
+  return prefix_sums.back();
+}
+
+// Calculate the number of comb teeth below a fixed point weight
+/*! \details The number of teeth in the cumulative weight interval of a site
+ * is the difference between the number of teeth below the end and the start
+ * of the interval. The number of teeth below a cumulative weight only
+ * depends on the cumulative weight (an integer), which guarantees that every
+ * process (and thread) will calculate the same value for the shared end
+ * points of adjacent intervals.
+ */
+uint64_t FissionSiteBank::calculateNumberOfTeeth(
+                                          const uint64_t cumulative_weight,
+                                          const uint64_t total_weight,
+                                          const uint64_t number_of_sites,
+                                          const double random_number )
+{
+  const double number_of_teeth =
+    std::ceil( ((double)cumulative_weight/(double)total_weight)*number_of_sites
+               - random_number );
+
+  if( number_of_teeth <= 0.0 )
+    return 0;
+  else if( number_of_teeth >= (double)number_of_sites )
+    return number_of_sites;
+  else
+    return (uint64_t)number_of_teeth;
+}
+
+// Redistribute the resampled sites to the processes that own them
+/*! \details The resampled sites of each process have contiguous global
+ * indices, which means that the sites only need to be exchanged between
+ * processes with overlapping index ranges. The number of messages sent by a
+ * process is therefore usually small.
+ */
+void FissionSiteBank::redistribute( const Utility::Communicator& comm,
+                                    const uint64_t number_of_sites,
+                                    const uint64_t global_start_index,
+                                    std::vector<Site>& resampled_sites )
+{
+  if( comm.size() == 1 )
+  {
+    d_sites.swap( resampled_sites );
+
+    return;
+  }
+
+  const uint64_t global_end_index =
+    global_start_index + resampled_sites.size();
+
+  // Gather the global start index of the resampled sites of each process
+  std::vector<uint64_t> process_start_indices;
+
+  try{
+    Utility::allGather( comm, global_start_index, process_start_indices );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to gather the resampled fission site "
+                           "ranges!" );
+
+  process_start_indices.push_back( number_of_sites );
+
+  const uint64_t owned_start_index =
+    FissionSiteBank::getProcessRangeStart( number_of_sites,
+                                           comm.size(),
+                                           comm.rank() );
+
+  const uint64_t owned_end_index =
+    FissionSiteBank::getProcessRangeStart( number_of_sites,
+                                           comm.size(),
+                                           comm.rank()+1 );
+
+  std::vector<Site> owned_sites( owned_end_index - owned_start_index );
+
+  std::vector<Utility::Communicator::Request> requests;
+
+  try{
+    for( int process = 0; process < comm.size(); ++process )
+    {
+      // Send the resampled sites that are owned by the process
+      {
+        const uint64_t start_index =
+          std::max( global_start_index,
+                    FissionSiteBank::getProcessRangeStart( number_of_sites,
+                                                           comm.size(),
+                                                           process ) );
+
+        const uint64_t end_index =
+          std::min( global_end_index,
+                    FissionSiteBank::getProcessRangeStart( number_of_sites,
+                                                           comm.size(),
+                                                           process+1 ) );
+
+        if( start_index < end_index )
+        {
+          if( process == comm.rank() )
+          {
+            std::copy( resampled_sites.begin()+(start_index-global_start_index),
+                       resampled_sites.begin()+(end_index-global_start_index),
+                       owned_sites.begin()+(start_index-owned_start_index) );
+          }
+          else
+          {
+            requests.push_back( Utility::isend( comm, process, s_site_tag,
+                  Utility::ArrayView<const Site>( resampled_sites.data()+(start_index-global_start_index),
+                                                  end_index-start_index ) ) );
+          }
+        }
+      }
+
+      // Receive the owned sites that were resampled by the process
+      if( process != comm.rank() )
+      {
+        const uint64_t start_index =
+          std::max( owned_start_index, process_start_indices[process] );
+
+        const uint64_t end_index =
+          std::min( owned_end_index, process_start_indices[process+1] );
+
+        if( start_index < end_index )
+        {
+          requests.push_back( Utility::ireceive( comm, process, s_site_tag,
+                  Utility::ArrayView<Site>( owned_sites.data()+(start_index-owned_start_index),
+                                            end_index-start_index ) ) );
+        }
+      }
+    }
+
+    std::vector<Utility::Communicator::Status> statuses( requests.size() );
+
+    Utility::wait( requests, statuses );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to redistribute the resampled fission "
+                           "sites!" );
+
+  d_sites.swap( owned_sites );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionSiteBank.cpp
+//---------------------------------------------------------------------------//
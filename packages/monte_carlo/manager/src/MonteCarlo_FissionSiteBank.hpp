@@ -0,0 +1,180 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionSiteBank.hpp
+//! \author Alex Robinson
+//! \brief  Fission site bank class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_FISSION_SITE_BANK_HPP
+#define MONTE_CARLO_FISSION_SITE_BANK_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/serialization/array_wrapper.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_Communicator.hpp"
+
+namespace MonteCarlo{
+
+/*! The fission site bank class
+ *
+ * The sites of the fission neutrons created during a power iteration cycle
+ * are stored in this bank. Every site has a key (the history number of the
+ * neutron and the order in which the site was created in that history) that
+ * does not depend on the thread or process that simulated the history. The
+ * banks of different threads can therefore be merged into a bank with a
+ * deterministic ordering. Because each process simulates a contiguous range
+ * of histories in a cycle, the sorted banks of the processes (in rank order)
+ * form the globally ordered bank without ever being gathered. A bank should
+ * only be filled by a single thread.
+ */
+class FissionSiteBank
+{
+
+public:
+
+  //! The fission site
+  struct Site
+  {
+    //! The history number of the neutron that caused the fission
+    uint64_t history_number;
+
+    //! The order in which the site was created in the history
+    uint32_t index;
+
+    //! The position of the fission neutron
+    double position[3];
+
+    //! The direction of the fission neutron
+    double direction[3];
+
+    //! The energy of the fission neutron (MeV)
+    double energy;
+
+    //! The weight of the fission neutron
+    double weight;
+
+    //! Save/load the site to an archive
+    template<typename Archive>
+    void serialize( Archive& ar, const unsigned version )
+    {
+      ar & BOOST_SERIALIZATION_NVP( history_number );
+      ar & BOOST_SERIALIZATION_NVP( index );
+      ar & boost::serialization::make_nvp( "position", boost::serialization::make_array( position, 3 ) );
+      ar & boost::serialization::make_nvp( "direction", boost::serialization::make_array( direction, 3 ) );
+      ar & BOOST_SERIALIZATION_NVP( energy );
+      ar & BOOST_SERIALIZATION_NVP( weight );
+    }
+  };
+
+  //! Default constructor
+  FissionSiteBank();
+
+  //! Destructor
+  ~FissionSiteBank()
+  { /* ... */ }
+
+  //! Check if the bank is empty
+  bool isEmpty() const;
+
+  //! The size of the bank
+  size_t size() const;
+
+  //! Access a site
+  const Site& operator[]( const size_t index ) const;
+
+  //! Bank the site of a fission neutron
+  void push( const NeutronState& neutron );
+
+  //! Bank a site
+  void push( const Site& site );
+
+  //! Remove all sites from the bank
+  void clear();
+
+  //! Check if the bank is sorted
+  bool isSorted() const;
+
+  //! Sort the sites
+  void sort();
+
+  //! Merge the bank with another sorted bank (the other bank will be empty)
+  void merge( FissionSiteBank& other_bank );
+
+  //! Return the total weight of the sites banked by all processes
+  double getTotalWeight( const Utility::Communicator& comm ) const;
+
+  //! Resample the sites banked by all processes
+  void resample( const Utility::Communicator& comm,
+                 const uint64_t number_of_sites,
+                 const double random_number );
+
+  //! Return the start of the site range assigned to a process
+  static uint64_t getProcessRangeStart( const uint64_t number_of_sites,
+                                        const int number_of_processes,
+                                        const int process_id );
+
+  //! Check if a site precedes another site
+  static bool compare( const Site& lhs, const Site& rhs );
+
+private:
+
+  // Convert a weight to the fixed point representation
+  static uint64_t convertToFixedPoint( const double weight );
+
+  // Convert a fixed point weight to a double
+  static double convertFromFixedPoint( const uint64_t fixed_point_weight );
+
+  // Calculate the fixed point weight prefix sums of the local sites
+  uint64_t calculateLocalPrefixSums( std::vector<uint64_t>& prefix_sums ) const;
+
+  // Calculate the number of comb teeth below a fixed point weight
+  static uint64_t calculateNumberOfTeeth( const uint64_t cumulative_weight,
+                                          const uint64_t total_weight,
+                                          const uint64_t number_of_sites,
+                                          const double random_number );
+
+  // Redistribute the resampled sites to the processes that own them
+  void redistribute( const Utility::Communicator& comm,
+                     const uint64_t number_of_sites,
+                     const uint64_t global_start_index,
+                     std::vector<Site>& resampled_sites );
+
+  // The fixed point weight scale
+  static const double s_fixed_point_scale;
+
+  // The site message tag
+  static const int s_site_tag = 11;
+
+  // The sites
+  std::vector<Site> d_sites;
+
+  // The history number of the last banked fission neutron
+  uint64_t d_last_history_number;
+
+  // The index of the next site in the history of the last banked neutron
+  uint32_t d_next_site_index;
+};
+
+// Check if a site precedes another site
+inline bool FissionSiteBank::compare( const Site& lhs, const Site& rhs )
+{
+  if( lhs.history_number != rhs.history_number )
+    return lhs.history_number < rhs.history_number;
+  else
+    return lhs.index < rhs.index;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_FISSION_SITE_BANK_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionSiteBank.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,82 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionSiteParticleBank.cpp
+//! \author Alex Robinson
+//! \brief  Fission site particle bank class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteParticleBank.hpp"
+#include "MonteCarlo_NuclearReactionType.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+FissionSiteParticleBank::FissionSiteParticleBank(
+                 const std::shared_ptr<FissionSiteBank>& fission_site_bank )
+  : ParticleBank(),
+    d_fission_site_bank( fission_site_bank )
+{
+  // Make sure that the fission site bank is valid
+  testPrecondition( fission_site_bank.get() );
+}
+
+// Push a neutron to the bank
+/*! \details If the reaction is a fission reaction only the site of the
+ * neutron will be banked.
+ */
+void FissionSiteParticleBank::push( std::shared_ptr<NeutronState>& neutron,
+                                    const int reaction )
+{
+  // Make sure the particle is valid
+  testPrecondition( neutron.get() );
+
+  if( FissionSiteParticleBank::isFissionReaction( reaction ) )
+    d_fission_site_bank->push( *neutron );
+  else
+    this->push( neutron );
+}
+
+// Push a neutron to the bank
+/*! \details If the reaction is a fission reaction only the site of the
+ * neutron will be banked.
+ */
+void FissionSiteParticleBank::push( const NeutronState& neutron,
+                                    const int reaction )
+{
+  if( FissionSiteParticleBank::isFissionReaction( reaction ) )
+    d_fission_site_bank->push( neutron );
+  else
+    this->push( neutron );
+}
+
+// Return the fission site bank
+const std::shared_ptr<FissionSiteBank>&
+FissionSiteParticleBank::getFissionSiteBank() const
+{
+  return d_fission_site_bank;
+}
+
+// Check if a reaction is a fission reaction
+bool FissionSiteParticleBank::isFissionReaction( const int reaction )
+{
+  switch( reaction )
+  {
+    case N__TOTAL_FISSION_REACTION:
+    case N__FISSION_REACTION:
+    case N__N_FISSION_REACTION:
+    case N__2N_FISSION_REACTION:
+    case N__3N_FISSION_REACTION:
+      return true;
+    default:
+      return false;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionSiteParticleBank.cpp
+//---------------------------------------------------------------------------//
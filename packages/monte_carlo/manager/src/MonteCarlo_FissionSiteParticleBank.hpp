@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionSiteParticleBank.hpp
+//! \author Alex Robinson
+//! \brief  Fission site particle bank class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_FISSION_SITE_PARTICLE_BANK_HPP
+#define MONTE_CARLO_FISSION_SITE_PARTICLE_BANK_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_FissionSiteBank.hpp"
+
+namespace MonteCarlo{
+
+/*! The fission site particle bank class
+ *
+ * The neutrons that are pushed into this bank after a fission reaction will
+ * not be stored in the bank. Instead, their sites will be stored in the
+ * fission site bank (which will not be transported in the current power
+ * iteration cycle). All other particles are stored in the bank. The fission
+ * site bank can be shared with other banks that will only be used by the
+ * same thread.
+ */
+class FissionSiteParticleBank : public ParticleBank
+{
+
+public:
+
+  //! Constructor
+  FissionSiteParticleBank(
+               const std::shared_ptr<FissionSiteBank>& fission_site_bank );
+
+  //! Destructor
+  ~FissionSiteParticleBank()
+  { /* ... */ }
+
+  // Use the base class push methods
+  using ParticleBank::push;
+
+  //! Insert a neutron into the bank after an interaction
+  void push( std::shared_ptr<NeutronState>& neutron,
+             const int reaction ) override;
+
+  //! Insert a neutron into the bank after an interaction
+  void push( const NeutronState& neutron,
+             const int reaction ) override;
+
+  //! Return the fission site bank
+  const std::shared_ptr<FissionSiteBank>& getFissionSiteBank() const;
+
+  //! Check if a reaction is a fission reaction
+  static bool isFissionReaction( const int reaction );
+
+private:
+
+  // The fission site bank
+  std::shared_ptr<FissionSiteBank> d_fission_site_bank;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_FISSION_SITE_PARTICLE_BANK_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionSiteParticleBank.hpp
+//---------------------------------------------------------------------------//
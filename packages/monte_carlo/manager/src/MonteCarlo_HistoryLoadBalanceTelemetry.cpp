@@ -0,0 +1,200 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_HistoryLoadBalanceTelemetry.cpp
+//! \author Alex Robinson
+//! \brief  History load balance telemetry class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryLoadBalanceTelemetry.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+HistoryLoadBalanceTelemetry::HistoryLoadBalanceTelemetry()
+  : d_thread_records( 1 )
+{
+  this->reset();
+}
+
+// Set the number of threads (all records will be reset)
+void HistoryLoadBalanceTelemetry::setNumberOfThreads(
+                                             const unsigned number_of_threads )
+{
+  // Make sure the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+
+  d_thread_records.resize( number_of_threads );
+
+  this->reset();
+}
+
+// Return the number of threads
+unsigned HistoryLoadBalanceTelemetry::getNumberOfThreads() const
+{
+  return d_thread_records.size();
+}
+
+// Reset the records of all threads
+void HistoryLoadBalanceTelemetry::reset()
+{
+  for( size_t i = 0; i < d_thread_records.size(); ++i )
+  {
+    ThreadRecord& record = d_thread_records[i];
+
+    record.micro_batches = 0;
+    record.histories = 0;
+    record.busy_time = 0.0;
+    record.idle_time = 0.0;
+    record.max_micro_batch_idle_time = 0.0;
+  }
+}
+
+// Record the micro batch statistics of a thread
+/*! \details This method can be called by every thread concurrently as long
+ * as each thread only updates its own record.
+ */
+void HistoryLoadBalanceTelemetry::recordMicroBatch( const unsigned thread_id,
+                                                    const uint64_t histories,
+                                                    const double busy_time,
+                                                    const double idle_time )
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_thread_records.size() );
+  // Make sure the times are valid
+  testPrecondition( busy_time >= 0.0 );
+  testPrecondition( idle_time >= 0.0 );
+
+  ThreadRecord& record = d_thread_records[thread_id];
+
+  ++record.micro_batches;
+  record.histories += histories;
+  record.busy_time += busy_time;
+  record.idle_time += idle_time;
+
+  if( idle_time > record.max_micro_batch_idle_time )
+    record.max_micro_batch_idle_time = idle_time;
+}
+
+// Return the number of micro batches that have been recorded
+uint64_t HistoryLoadBalanceTelemetry::getNumberOfMicroBatches() const
+{
+  uint64_t micro_batches = 0;
+
+  for( size_t i = 0; i < d_thread_records.size(); ++i )
+  {
+    micro_batches = std::max( micro_batches,
+                              d_thread_records[i].micro_batches );
+  }
+
+  return micro_batches;
+}
+
+// Return the number of histories completed by a thread
+uint64_t HistoryLoadBalanceTelemetry::getNumberOfHistories(
+                                               const unsigned thread_id ) const
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_thread_records.size() );
+
+  return d_thread_records[thread_id].histories;
+}
+
+// Return the busy time of a thread (s)
+double HistoryLoadBalanceTelemetry::getBusyTime(
+                                               const unsigned thread_id ) const
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_thread_records.size() );
+
+  return d_thread_records[thread_id].busy_time;
+}
+
+// Return the idle time of a thread (s)
+double HistoryLoadBalanceTelemetry::getIdleTime(
+                                               const unsigned thread_id ) const
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_thread_records.size() );
+
+  return d_thread_records[thread_id].idle_time;
+}
+
+// Return the max idle time of a thread in a single micro batch (s)
+double HistoryLoadBalanceTelemetry::getMaxMicroBatchIdleTime(
+                                               const unsigned thread_id ) const
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_thread_records.size() );
+
+  return d_thread_records[thread_id].max_micro_batch_idle_time;
+}
+
+// Return the load imbalance (max busy time/mean busy time)
+/*! \details A value of 1.0 indicates a perfectly balanced load. If no busy
+ * time has been recorded a value of 1.0 will be returned.
+ */
+double HistoryLoadBalanceTelemetry::getLoadImbalance() const
+{
+  double max_busy_time = 0.0;
+  double total_busy_time = 0.0;
+
+  for( size_t i = 0; i < d_thread_records.size(); ++i )
+  {
+    max_busy_time = std::max( max_busy_time, d_thread_records[i].busy_time );
+    total_busy_time += d_thread_records[i].busy_time;
+  }
+
+  if( total_busy_time > 0.0 )
+    return max_busy_time*d_thread_records.size()/total_busy_time;
+  else
+    return 1.0;
+}
+
+// Return the fraction of the total thread time spent idle
+double HistoryLoadBalanceTelemetry::getIdleFraction() const
+{
+  double total_busy_time = 0.0;
+  double total_idle_time = 0.0;
+
+  for( size_t i = 0; i < d_thread_records.size(); ++i )
+  {
+    total_busy_time += d_thread_records[i].busy_time;
+    total_idle_time += d_thread_records[i].idle_time;
+  }
+
+  if( total_busy_time + total_idle_time > 0.0 )
+    return total_idle_time/(total_busy_time + total_idle_time);
+  else
+    return 0.0;
+}
+
+// Print the telemetry
+void HistoryLoadBalanceTelemetry::print( std::ostream& os ) const
+{
+  os << "History load balance: " << this->getNumberOfMicroBatches()
+     << " micro batches, load imbalance " << this->getLoadImbalance()
+     << ", idle fraction " << this->getIdleFraction() << std::endl;
+
+  for( size_t i = 0; i < d_thread_records.size(); ++i )
+  {
+    const ThreadRecord& record = d_thread_records[i];
+
+    os << "  Thread " << i << ": "
+       << record.histories << " histories, "
+       << record.busy_time << " s busy, "
+       << record.idle_time << " s idle (max micro batch idle: "
+       << record.max_micro_batch_idle_time << " s)" << std::endl;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_HistoryLoadBalanceTelemetry.cpp
+//---------------------------------------------------------------------------//
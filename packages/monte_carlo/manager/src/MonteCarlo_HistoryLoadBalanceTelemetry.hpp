@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_HistoryLoadBalanceTelemetry.hpp
+//! \author Alex Robinson
+//! \brief  History load balance telemetry class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_HISTORY_LOAD_BALANCE_TELEMETRY_HPP
+#define MONTE_CARLO_HISTORY_LOAD_BALANCE_TELEMETRY_HPP
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/align/aligned_allocator.hpp>
+
+namespace MonteCarlo{
+
+/*! The history load balance telemetry class
+ *
+ * The number of histories completed by each thread and the time that each
+ * thread spends simulating histories (busy time) and waiting for the other
+ * threads to complete the micro batch (idle time) are recorded. Each thread
+ * has its own record so the records of different threads can be updated
+ * concurrently. All other methods must be called outside of a parallel block.
+ */
+class HistoryLoadBalanceTelemetry
+{
+
+public:
+
+  //! Constructor
+  HistoryLoadBalanceTelemetry();
+
+  //! Destructor
+  ~HistoryLoadBalanceTelemetry()
+  { /* ... */ }
+
+  //! Set the number of threads (all records will be reset)
+  void setNumberOfThreads( const unsigned number_of_threads );
+
+  //! Return the number of threads
+  unsigned getNumberOfThreads() const;
+
+  //! Reset the records of all threads
+  void reset();
+
+  //! Record the micro batch statistics of a thread
+  void recordMicroBatch( const unsigned thread_id,
+                         const uint64_t histories,
+                         const double busy_time,
+                         const double idle_time );
+
+  //! Return the number of micro batches that have been recorded
+  uint64_t getNumberOfMicroBatches() const;
+
+  //! Return the number of histories completed by a thread
+  uint64_t getNumberOfHistories( const unsigned thread_id ) const;
+
+  //! Return the busy time of a thread (s)
+  double getBusyTime( const unsigned thread_id ) const;
+
+  //! Return the idle time of a thread (s)
+  double getIdleTime( const unsigned thread_id ) const;
+
+  //! Return the max idle time of a thread in a single micro batch (s)
+  double getMaxMicroBatchIdleTime( const unsigned thread_id ) const;
+
+  //! Return the load imbalance (max busy time/mean busy time)
+  double getLoadImbalance() const;
+
+  //! Return the fraction of the total thread time spent idle
+  double getIdleFraction() const;
+
+  //! Print the telemetry
+  void print( std::ostream& os ) const;
+
+private:
+
+  // The record of a thread (padded to a cache line to prevent false sharing
+  // between the threads)
+  struct alignas(64) ThreadRecord
+  {
+    // The number of micro batches
+    uint64_t micro_batches;
+
+    // The number of histories completed
+    uint64_t histories;
+
+    // The busy time
+    double busy_time;
+
+    // The idle time
+    double idle_time;
+
+    // The max idle time in a single micro batch
+    double max_micro_batch_idle_time;
+  };
+
+  // The thread records
+  std::vector<ThreadRecord,boost::alignment::aligned_allocator<ThreadRecord,64> >
+  d_thread_records;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_HISTORY_LOAD_BALANCE_TELEMETRY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_HistoryLoadBalanceTelemetry.hpp
+//---------------------------------------------------------------------------//
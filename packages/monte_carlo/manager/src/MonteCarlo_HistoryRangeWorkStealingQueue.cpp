@@ -0,0 +1,204 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_HistoryRangeWorkStealingQueue.cpp
+//! \author Alex Robinson
+//! \brief  History range work stealing queue class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryRangeWorkStealingQueue.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The first (end_history-start_history)%number_of_threads threads
+ * will be assigned one extra history.
+ */
+HistoryRangeWorkStealingQueue::HistoryRangeWorkStealingQueue(
+                                             const uint64_t start_history,
+                                             const uint64_t end_history,
+                                             const unsigned number_of_threads,
+                                             const uint64_t chunk_size )
+  : d_ranges( number_of_threads ),
+    d_chunk_size( chunk_size ),
+    d_steals( 0 )
+{
+  // Make sure the history range is valid
+  testPrecondition( start_history <= end_history );
+  // Make sure the number of threads is valid
+  testPrecondition( number_of_threads > 0 );
+  // Make sure the chunk size is valid
+  testPrecondition( chunk_size > 0 );
+
+  const uint64_t histories = end_history - start_history;
+  const uint64_t histories_per_thread = histories/number_of_threads;
+  const uint64_t extra_histories = histories%number_of_threads;
+
+  uint64_t range_start = start_history;
+
+  for( unsigned i = 0; i < number_of_threads; ++i )
+  {
+    d_ranges[i].start = range_start;
+
+    range_start += histories_per_thread;
+
+    if( i < extra_histories )
+      ++range_start;
+
+    d_ranges[i].end = range_start;
+
+    d_ranges[i].remaining_histories = d_ranges[i].end - d_ranges[i].start;
+  }
+}
+
+// Acquire the next chunk of histories for a thread
+/*! \details If the thread's range is empty, half of the histories remaining
+ * in the range with the most remaining histories will be stolen first. False
+ * will be returned when no histories remain in any range.
+ */
+bool HistoryRangeWorkStealingQueue::acquireHistories(
+                                             const unsigned thread_id,
+                                             uint64_t& chunk_start_history,
+                                             uint64_t& chunk_end_history )
+{
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_ranges.size() );
+
+  HistoryRange& range = d_ranges[thread_id];
+
+  // Acquire a chunk from the front of the range
+  {
+    std::lock_guard<std::mutex> range_lock( range.mutex );
+
+    if( range.start < range.end )
+    {
+      chunk_start_history = range.start;
+      chunk_end_history = std::min( range.start + d_chunk_size, range.end );
+
+      range.start = chunk_end_history;
+      range.remaining_histories = range.end - range.start;
+
+      return true;
+    }
+  }
+
+  // Steal from the most loaded thread
+  uint64_t stolen_start_history, stolen_end_history;
+
+  if( !this->stealHistories( thread_id,
+                             stolen_start_history,
+                             stolen_end_history ) )
+    return false;
+
+  // Acquire a chunk from the front of the stolen histories and make the
+  // rest of them the thread's new range
+  chunk_start_history = stolen_start_history;
+  chunk_end_history =
+    std::min( stolen_start_history + d_chunk_size, stolen_end_history );
+
+  {
+    std::lock_guard<std::mutex> range_lock( range.mutex );
+
+    range.start = chunk_end_history;
+    range.end = stolen_end_history;
+    range.remaining_histories = range.end - range.start;
+  }
+
+  return true;
+}
+
+// Steal half of the histories remaining in the most loaded range
+/*! \details Only the victim's range will be locked. If another thread
+ * empties the victim's range before it can be locked the search will be
+ * repeated. False will be returned when no histories remain in any range.
+ */
+bool HistoryRangeWorkStealingQueue::stealHistories(
+                                             const unsigned thread_id,
+                                             uint64_t& stolen_start_history,
+                                             uint64_t& stolen_end_history )
+{
+  while( true )
+  {
+    unsigned victim_id = thread_id;
+    uint64_t max_remaining_histories = 0;
+
+    for( unsigned i = 0; i < d_ranges.size(); ++i )
+    {
+      const uint64_t remaining_histories = d_ranges[i].remaining_histories;
+
+      if( remaining_histories > max_remaining_histories )
+      {
+        victim_id = i;
+        max_remaining_histories = remaining_histories;
+      }
+    }
+
+    if( max_remaining_histories == 0 )
+      return false;
+
+    HistoryRange& victim_range = d_ranges[victim_id];
+
+    std::lock_guard<std::mutex> victim_range_lock( victim_range.mutex );
+
+    // The victim's range may have changed since the search
+    const uint64_t remaining_histories = victim_range.end - victim_range.start;
+
+    if( remaining_histories > 0 )
+    {
+      const uint64_t stolen_histories = (remaining_histories+1)/2;
+
+      stolen_end_history = victim_range.end;
+      stolen_start_history = victim_range.end - stolen_histories;
+
+      victim_range.end = stolen_start_history;
+      victim_range.remaining_histories = victim_range.end - victim_range.start;
+
+      ++d_steals;
+
+      return true;
+    }
+  }
+}
+
+// Return the number of threads
+unsigned HistoryRangeWorkStealingQueue::getNumberOfThreads() const
+{
+  return d_ranges.size();
+}
+
+// Return the chunk size
+uint64_t HistoryRangeWorkStealingQueue::getChunkSize() const
+{
+  return d_chunk_size;
+}
+
+// Return the number of histories that have not been acquired
+/*! \details The returned value is only exact when no other thread is
+ * acquiring histories.
+ */
+uint64_t HistoryRangeWorkStealingQueue::getNumberOfRemainingHistories() const
+{
+  uint64_t remaining_histories = 0;
+
+  for( size_t i = 0; i < d_ranges.size(); ++i )
+    remaining_histories += d_ranges[i].remaining_histories;
+
+  return remaining_histories;
+}
+
+// Return the number of successful steals
+uint64_t HistoryRangeWorkStealingQueue::getNumberOfSteals() const
+{
+  return d_steals;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_HistoryRangeWorkStealingQueue.cpp
+//---------------------------------------------------------------------------//
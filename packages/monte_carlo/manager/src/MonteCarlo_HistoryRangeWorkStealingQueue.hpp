@@ -0,0 +1,108 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_HistoryRangeWorkStealingQueue.hpp
+//! \author Alex Robinson
+//! \brief  History range work stealing queue class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_HISTORY_RANGE_WORK_STEALING_QUEUE_HPP
+#define MONTE_CARLO_HISTORY_RANGE_WORK_STEALING_QUEUE_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+
+// Boost Includes
+#include <boost/align/aligned_allocator.hpp>
+
+namespace MonteCarlo{
+
+/*! The history range work stealing queue class
+ *
+ * The histories of a micro batch are initially divided into contiguous,
+ * equally sized ranges (one for each thread). A thread acquires chunks of
+ * histories from the front of its own range. Once its range is empty it
+ * steals the back half of the range with the most remaining histories. Each
+ * range is protected by its own lock. A thread only locks its own range when
+ * acquiring a chunk and only locks the victim's range when stealing (the
+ * victim search uses the atomic remaining history count of each range), so
+ * threads that are working through their own ranges never contend.
+ */
+class HistoryRangeWorkStealingQueue
+{
+
+public:
+
+  //! Constructor
+  HistoryRangeWorkStealingQueue( const uint64_t start_history,
+                                 const uint64_t end_history,
+                                 const unsigned number_of_threads,
+                                 const uint64_t chunk_size );
+
+  //! Destructor
+  ~HistoryRangeWorkStealingQueue()
+  { /* ... */ }
+
+  //! Acquire the next chunk of histories for a thread
+  bool acquireHistories( const unsigned thread_id,
+                         uint64_t& chunk_start_history,
+                         uint64_t& chunk_end_history );
+
+  //! Return the number of threads
+  unsigned getNumberOfThreads() const;
+
+  //! Return the chunk size
+  uint64_t getChunkSize() const;
+
+  //! Return the number of histories that have not been acquired
+  uint64_t getNumberOfRemainingHistories() const;
+
+  //! Return the number of successful steals
+  uint64_t getNumberOfSteals() const;
+
+private:
+
+  // The history range of a thread (padded to a cache line to prevent false
+  // sharing between the threads)
+  struct alignas(64) HistoryRange
+  {
+    // The range lock
+    std::mutex mutex;
+
+    // The next history in the range
+    uint64_t start;
+
+    // The end of the range (exclusive)
+    uint64_t end;
+
+    // The number of histories remaining in the range (can be read without
+    // acquiring the range lock)
+    std::atomic<uint64_t> remaining_histories;
+  };
+
+  // Steal half of the histories remaining in the most loaded range
+  bool stealHistories( const unsigned thread_id,
+                       uint64_t& stolen_start_history,
+                       uint64_t& stolen_end_history );
+
+  // The history ranges of the threads
+  std::vector<HistoryRange,boost::alignment::aligned_allocator<HistoryRange,64> >
+  d_ranges;
+
+  // The chunk size
+  uint64_t d_chunk_size;
+
+  // The number of successful steals
+  std::atomic<uint64_t> d_steals;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_HISTORY_RANGE_WORK_STEALING_QUEUE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_HistoryRangeWorkStealingQueue.hpp
+//---------------------------------------------------------------------------//
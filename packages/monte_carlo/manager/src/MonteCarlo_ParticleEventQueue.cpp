@@ -0,0 +1,231 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleEventQueue.cpp
+//! \author Alex Robinson
+//! \brief  Particle event queue class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleEventQueue.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ParticleEventQueue::ParticleEventQueue()
+{ /* ... */ }
+
+// Add a particle to the queue
+/*! \details The queue takes shared ownership of the particle. A new track
+ * will be required for the particle.
+ */
+void ParticleEventQueue::push( const std::shared_ptr<ParticleState>& particle,
+                               const bool source_particle )
+{
+  // Make sure that the particle is valid
+  testPrecondition( particle.get() );
+
+  TrackRecord track;
+  track.particle = particle;
+  track.track_start_point[0] = particle->getXPosition();
+  track.track_start_point[1] = particle->getYPosition();
+  track.track_start_point[2] = particle->getZPosition();
+  track.surface_hit = 0;
+  track.starting_from_source = source_particle;
+  track.new_track_required = true;
+  track.subtrack_ending_global_event_dispatched = false;
+
+  d_tracks.push_back( track );
+  d_remaining_optical_paths.push_back( 0.0 );
+  d_cell_total_macro_cross_sections.push_back( 0.0 );
+  d_distances_to_collision.push_back( 0.0 );
+  d_distances_to_surface_hit.push_back( 0.0 );
+}
+
+// Check if the queue is empty
+bool ParticleEventQueue::isEmpty() const
+{
+  return d_tracks.empty();
+}
+
+// Return the number of particles in the queue
+size_t ParticleEventQueue::size() const
+{
+  return d_tracks.size();
+}
+
+// Remove the particles that are gone from the queue
+/*! \details The relative order of the remaining particles is preserved.
+ * The memory used by the queue is not released so that it can be reused by
+ * the next batch of particles.
+ */
+void ParticleEventQueue::removeGoneParticles()
+{
+  size_t new_size = 0;
+
+  for( size_t i = 0; i < d_tracks.size(); ++i )
+  {
+    if( *d_tracks[i].particle )
+    {
+      if( new_size != i )
+      {
+        d_tracks[new_size] = d_tracks[i];
+        d_remaining_optical_paths[new_size] = d_remaining_optical_paths[i];
+      }
+
+      ++new_size;
+    }
+  }
+
+  // Release the gone particles
+  for( size_t i = new_size; i < d_tracks.size(); ++i )
+    d_tracks[i].particle.reset();
+
+  d_tracks.resize( new_size );
+  d_remaining_optical_paths.resize( new_size );
+  d_cell_total_macro_cross_sections.resize( new_size );
+  d_distances_to_collision.resize( new_size );
+  d_distances_to_surface_hit.resize( new_size );
+}
+
+// Remove all particles from the queue
+void ParticleEventQueue::clear()
+{
+  d_tracks.clear();
+  d_remaining_optical_paths.clear();
+  d_cell_total_macro_cross_sections.clear();
+  d_distances_to_collision.clear();
+  d_distances_to_surface_hit.clear();
+}
+
+// Return a particle in the queue
+ParticleState& ParticleEventQueue::getParticle( const size_t index )
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+
+  return *d_tracks[index].particle;
+}
+
+// Check if a particle is starting from a source point
+bool ParticleEventQueue::isStartingFromSource( const size_t index ) const
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+
+  return d_tracks[index].starting_from_source;
+}
+
+// Check if a new track must be started for a particle
+bool ParticleEventQueue::isNewTrackRequired( const size_t index ) const
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+
+  return d_tracks[index].new_track_required;
+}
+
+// Start a new track for a particle
+/*! \details The track will start at the particle's current position.
+ */
+void ParticleEventQueue::startNewTrack( const size_t index,
+                                        const double optical_path )
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+  // Make sure that the optical path is valid
+  testPrecondition( optical_path >= 0.0 );
+
+  TrackRecord& track = d_tracks[index];
+
+  track.track_start_point[0] = track.particle->getXPosition();
+  track.track_start_point[1] = track.particle->getYPosition();
+  track.track_start_point[2] = track.particle->getZPosition();
+  track.new_track_required = false;
+  track.subtrack_ending_global_event_dispatched = false;
+
+  d_remaining_optical_paths[index] = optical_path;
+}
+
+// Continue the track of a particle from a cell boundary
+/*! \details After the first subtrack the particle can no longer be starting
+ * from a source point.
+ */
+void ParticleEventQueue::continueTrack( const size_t index )
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+
+  d_tracks[index].starting_from_source = false;
+}
+
+// End the track of a particle
+void ParticleEventQueue::endTrack( const size_t index )
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+
+  d_tracks[index].starting_from_source = false;
+  d_tracks[index].new_track_required = true;
+}
+
+// Return the start point of a particle's current track
+const double* ParticleEventQueue::getTrackStartPoint(
+                                                  const size_t index ) const
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+
+  return d_tracks[index].track_start_point;
+}
+
+// Return the surface hit by a particle's ray
+Geometry::Model::EntityId& ParticleEventQueue::getSurfaceHit(
+                                                          const size_t index )
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+
+  return d_tracks[index].surface_hit;
+}
+
+// Check if the subtrack ending global event has been dispatched
+bool& ParticleEventQueue::getSubtrackEndingGlobalEventDispatched(
+                                                          const size_t index )
+{
+  // Make sure that the index is valid
+  testPrecondition( index < d_tracks.size() );
+
+  return d_tracks[index].subtrack_ending_global_event_dispatched;
+}
+
+// Return the remaining optical paths of the current tracks
+double* ParticleEventQueue::getRemainingOpticalPaths()
+{
+  return d_remaining_optical_paths.data();
+}
+
+// Return the cell total macroscopic cross sections
+double* ParticleEventQueue::getCellTotalMacroscopicCrossSections()
+{
+  return d_cell_total_macro_cross_sections.data();
+}
+
+// Return the distances to collision
+double* ParticleEventQueue::getDistancesToCollision()
+{
+  return d_distances_to_collision.data();
+}
+
+// Return the distances to the next surface hit
+double* ParticleEventQueue::getDistancesToSurfaceHit()
+{
+  return d_distances_to_surface_hit.data();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleEventQueue.cpp
+//---------------------------------------------------------------------------//
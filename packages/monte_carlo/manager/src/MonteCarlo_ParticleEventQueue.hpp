@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ParticleEventQueue.hpp
+//! \author Alex Robinson
+//! \brief  Particle event queue class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PARTICLE_EVENT_QUEUE_HPP
+#define MONTE_CARLO_PARTICLE_EVENT_QUEUE_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleState.hpp"
+#include "Geometry_Model.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle event queue class
+ *
+ * The event queue stores the particles of a single type that are being
+ * simulated with the event-based transport mode along with the state of
+ * their current tracks. The per-particle track quantities that are used by
+ * the vectorizable event stages (the remaining optical path, the cell total
+ * macroscopic cross section, the distance to collision and the distance to
+ * the next surface hit) are stored in separate contiguous arrays. All other
+ * track quantities are stored in a per-particle track record. The queue is
+ * not thread safe - each thread must use its own queue.
+ */
+class ParticleEventQueue
+{
+
+public:
+
+  //! Constructor
+  ParticleEventQueue();
+
+  //! Destructor
+  ~ParticleEventQueue()
+  { /* ... */ }
+
+  //! Add a particle to the queue
+  void push( const std::shared_ptr<ParticleState>& particle,
+             const bool source_particle );
+
+  //! Check if the queue is empty
+  bool isEmpty() const;
+
+  //! Return the number of particles in the queue
+  size_t size() const;
+
+  //! Remove the particles that are gone from the queue
+  void removeGoneParticles();
+
+  //! Remove all particles from the queue
+  void clear();
+
+  //! Return a particle in the queue
+  ParticleState& getParticle( const size_t index );
+
+  //! Check if a particle is starting from a source point
+  bool isStartingFromSource( const size_t index ) const;
+
+  //! Check if a new track must be started for a particle
+  bool isNewTrackRequired( const size_t index ) const;
+
+  //! Start a new track for a particle
+  void startNewTrack( const size_t index, const double optical_path );
+
+  //! Continue the track of a particle from a cell boundary
+  void continueTrack( const size_t index );
+
+  //! End the track of a particle
+  void endTrack( const size_t index );
+
+  //! Return the start point of a particle's current track
+  const double* getTrackStartPoint( const size_t index ) const;
+
+  //! Return the surface hit by a particle's ray
+  Geometry::Model::EntityId& getSurfaceHit( const size_t index );
+
+  //! Check if the subtrack ending global event has been dispatched
+  bool& getSubtrackEndingGlobalEventDispatched( const size_t index );
+
+  //! Return the remaining optical paths of the current tracks
+  double* getRemainingOpticalPaths();
+
+  //! Return the cell total macroscopic cross sections
+  double* getCellTotalMacroscopicCrossSections();
+
+  //! Return the distances to collision
+  double* getDistancesToCollision();
+
+  //! Return the distances to the next surface hit
+  double* getDistancesToSurfaceHit();
+
+private:
+
+  // The particle track record
+  struct TrackRecord
+  {
+    // The particle
+    std::shared_ptr<ParticleState> particle;
+
+    // The track start point
+    double track_start_point[3];
+
+    // The surface hit by the last ray
+    Geometry::Model::EntityId surface_hit;
+
+    // Records if the particle is starting from a source point
+    bool starting_from_source;
+
+    // Records if a new track must be started
+    bool new_track_required;
+
+    // Records if the subtrack ending global event has been dispatched
+    bool subtrack_ending_global_event_dispatched;
+  };
+
+  // The track records
+  std::vector<TrackRecord> d_tracks;
+
+  // The remaining optical paths
+  std::vector<double> d_remaining_optical_paths;
+
+  // The cell total macroscopic cross sections
+  std::vector<double> d_cell_total_macro_cross_sections;
+
+  // The distances to collision
+  std::vector<double> d_distances_to_collision;
+
+  // The distances to the next surface hit
+  std::vector<double> d_distances_to_surface_hit;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PARTICLE_EVENT_QUEUE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ParticleEventQueue.hpp
+//---------------------------------------------------------------------------//
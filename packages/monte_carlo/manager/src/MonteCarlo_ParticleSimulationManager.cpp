@@ -9,14 +9,22 @@
 // Std Lib Includes
 #include <csignal>
 #include <fstream>
+#include <sstream>
+#include <functional>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManager.hpp"
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_ArenaParticleBank.hpp"
+#include "MonteCarlo_MacroscopicCrossSectionCache.hpp"
+#include "MonteCarlo_HistoryRangeWorkStealingQueue.hpp"
+#include "Geometry_ClosestBoundaryQueryStatistics.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_JustInTimeInitializer.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 // The registered managers (these must be global so that the custom signal
@@ -63,6 +71,8 @@ ParticleSimulationManager::ParticleSimulationManager(
     d_collision_forcer( collision_forcer ),
     d_weight_roulette( std::make_shared<StandardWeightCutoffRoulette>() ),
     d_properties( properties ),
+    d_load_balance_telemetry(),
+    d_rendezvous_archive_writer( new Utility::AsynchronousFileWriter ),
     d_next_history( next_history ),
     d_rendezvous_number( rendezvous_number ),
     d_rendezvous_batch_size( 0 ),
@@ -182,6 +192,12 @@ const SimulationProperties& ParticleSimulationManager::getSimulationProperties()
   return *d_properties;
 }
 
+// Return the history load balance telemetry
+const HistoryLoadBalanceTelemetry& ParticleSimulationManager::getHistoryLoadBalanceTelemetry() const
+{
+  return d_load_balance_telemetry;
+}
+
 // Get the simulation name
 const std::string& ParticleSimulationManager::getSimulationName() const
 {
@@ -466,13 +482,34 @@ const CollisionForcer& ParticleSimulationManager::getCollisionForcer() const
 void ParticleSimulationManager::enableThreadSupport()
 {
   // Set up the random number generator for the number of threads requested
+  if( d_properties->isCounterBasedRandomNumberGeneratorModeOn() )
+    Utility::RandomNumberGenerator::useCounterBasedGenerator();
+  else
+    Utility::RandomNumberGenerator::useLinearCongruentialGenerator();
+
   Utility::RandomNumberGenerator::createStreams();
 
+  // Enable model thread support
+  d_model->getUnfilledModel().enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
   // Enable source thread support
   d_source->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
 
+  // Each history that a thread simulates together with others needs its own
+  // observer history contribution slot
+  ParticleHistoryObserver::setNumberOfHistoryContributionSlots(
+                                         this->getThreadHistoryBatchSize() );
+
   // Enable event handler thread support
   d_event_handler->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  // Only record the cross section cache usage and the closest boundary
+  // queries of this simulation
+  MacroscopicCrossSectionCache::resetStatistics();
+  Geometry::ClosestBoundaryQueryStatistics::resetStatistics();
+
+  // Create a load balance record for each thread
+  d_load_balance_telemetry.setNumberOfThreads( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
 }
 
 // Reset data
@@ -494,6 +531,24 @@ void ParticleSimulationManager::reduceData( const Utility::Communicator& comm,
   comm.barrier();
 }
 
+// Reduce distributed data
+/*! \details The reducer must have been created from the communicator with
+ * the same root process. It will be reused for the observer data so that
+ * its sub-communicators do not have to be recreated for every reduction.
+ */
+void ParticleSimulationManager::reduceData(
+                                         Utility::HierarchicalReducer& reducer,
+                                         const Utility::Communicator& comm,
+                                         const int root_process )
+{
+  comm.barrier();
+
+  d_source->reduceData( comm, root_process );
+  d_event_handler->reduceObserverData( reducer, comm, root_process );
+
+  comm.barrier();
+}
+
 // Register simulation started event
 void ParticleSimulationManager::registerSimulationStartedEvent()
 {
@@ -501,8 +556,13 @@ void ParticleSimulationManager::registerSimulationStartedEvent()
 }
 
 // Register simulation stopped event
+/*! \details The rendezvous archive of the last rendezvous is guaranteed to
+ * have been written once this method returns.
+ */
 void ParticleSimulationManager::registerSimulationStoppedEvent()
 {
+  this->waitForRendezvousArchiveWrite();
+  
   d_event_handler->updateObserversFromParticleSimulationStoppedEvent();
 }
 
@@ -513,15 +573,30 @@ bool ParticleSimulationManager::isSimulationComplete()
 }
 
 // Rendezvous (cache state)
+/*! \details The rendezvous archive will be written asynchronously (see
+ * ParticleSimulationManager::basicRendezvous).
+ */
 void ParticleSimulationManager::rendezvous()
 {
-  this->basicRendezvous();
+  this->basicRendezvous( true );
 
   ++d_rendezvous_number;
 }
 
 // Conduct a basic rendezvous
-void ParticleSimulationManager::basicRendezvous() const
+/*! \details The state of the simulation is always captured synchronously.
+ * When an asynchronous rendezvous is requested only the data that changes
+ * during the simulation (e.g. the estimator moments and the source sampling
+ * statistics) is captured by the event handler and the source (see
+ * EventHandler::takeArchiveSnapshot). The captured state is then serialized
+ * to an in-memory archive and written to the rendezvous file by a background
+ * thread while the simulation continues. The captured data is released once
+ * it has been serialized. Only one rendezvous archive write can be pending -
+ * if the previous write has not finished this method will wait for it
+ * before capturing the new state. HDF5 archives cannot be saved to memory
+ * and will always be written synchronously.
+ */
+void ParticleSimulationManager::basicRendezvous( const bool asynchronous ) const
 {
   std::string archive_name( d_simulation_name );
   archive_name += "_rendezvous";
@@ -541,20 +616,75 @@ void ParticleSimulationManager::basicRendezvous() const
 
   FRENSIE_FLUSH_ALL_LOGS();
 
-  ParticleSimulationManagerFactory
-    tmp_factory( d_model,
-                 d_source,
-                 d_event_handler,
-                 d_weight_windows,
-                 d_collision_forcer,
-                 d_properties,
-                 d_simulation_name,
-                 d_archive_type,
-                 d_next_history,
-                 d_rendezvous_number+1,
-                 d_use_single_rendezvous_file );
+  std::shared_ptr<const ParticleSimulationManagerFactory>
+    tmp_factory( new ParticleSimulationManagerFactory(
+                                               d_model,
+                                               d_source,
+                                               d_event_handler,
+                                               d_weight_windows,
+                                               d_collision_forcer,
+                                               d_properties,
+                                               d_simulation_name,
+                                               d_archive_type,
+                                               d_next_history,
+                                               d_rendezvous_number+1,
+                                               d_use_single_rendezvous_file ) );
+
+  // A pending write must finish first - it may be writing to the same file
+  this->waitForRendezvousArchiveWrite();
+
+  if( asynchronous && d_archive_type != "h5fa" )
+  {
+    std::shared_ptr<EventHandler> event_handler = d_event_handler;
+    std::shared_ptr<ParticleSource> source = d_source;
+    std::string extension = "." + d_archive_type;
+
+    event_handler->takeArchiveSnapshot();
+    source->takeArchiveSnapshot();
+
+    std::function<void(std::string&)> save_to_buffer =
+      [tmp_factory, event_handler, source, extension]( std::string& buffer ){
+        try{
+          tmp_factory->saveToBuffer( extension, buffer );
+        }
+        catch( ... )
+        {
+          event_handler->releaseArchiveSnapshot();
+          source->releaseArchiveSnapshot();
+
+          throw;
+        }
+
+        event_handler->releaseArchiveSnapshot();
+        source->releaseArchiveSnapshot();
+      };
+
+    try{
+      d_rendezvous_archive_writer->write( archive_name,
+                                          std::move( save_to_buffer ) );
+    }
+    catch( ... )
+    {
+      // The snapshot will never be serialized
+      event_handler->releaseArchiveSnapshot();
+      source->releaseArchiveSnapshot();
+
+      throw;
+    }
+  }
+  else
+    tmp_factory->saveToFile( archive_name, true );
+}
 
-  tmp_factory.saveToFile( archive_name, true );
+// Wait for the pending rendezvous archive write to finish
+void ParticleSimulationManager::waitForRendezvousArchiveWrite() const
+{
+  try{
+    d_rendezvous_archive_writer->wait();
+  }
+  EXCEPTION_CATCH_RETHROW_AS( std::exception,
+                              std::runtime_error,
+                              "Unable to write the rendezvous archive!" );
 }
 
 // Print the simulation data to the desired stream
@@ -562,6 +692,9 @@ void ParticleSimulationManager::printSimulationSummary( std::ostream& os ) const
 {
   d_source->printSummary( os );
   d_event_handler->printObserverSummaries( os );
+  MacroscopicCrossSectionCache::printStatistics( os );
+  Geometry::ClosestBoundaryQueryStatistics::printStatistics( os );
+  d_load_balance_telemetry.print( os );
 }
 
 // Log the simulation data
@@ -569,6 +702,14 @@ void ParticleSimulationManager::logSimulationSummary() const
 {
   d_source->logSummary();
   d_event_handler->logObserverSummaries();
+
+  std::ostringstream oss;
+
+  MacroscopicCrossSectionCache::printStatistics( oss );
+  Geometry::ClosestBoundaryQueryStatistics::printStatistics( oss );
+  d_load_balance_telemetry.print( oss );
+
+  FRENSIE_LOG_NOTIFICATION( oss.str() );
 }
 
 // Run the simulation batch
@@ -617,81 +758,551 @@ void ParticleSimulationManager::runSimulationBatch(
 }
 
 // Run the simulation micro batch
+/*! \details The histories will be distributed among the threads using the
+ * history schedule set in the simulation properties. The number of histories
+ * completed by each thread and the time that each thread spends busy and
+ * idle will be recorded in the load balance telemetry.
+ */
 void ParticleSimulationManager::runSimulationMicroBatch(
                                             const uint64_t batch_start_history,
                                             const uint64_t batch_end_history )
 {
   // Make sure the history range is valid
   testPrecondition( batch_start_history < batch_end_history );
+  // Make sure there is a load balance record for each thread
+  testPrecondition( d_load_balance_telemetry.getNumberOfThreads() >=
+                    Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  const HistoryScheduleType schedule_type =
+    d_properties->getHistoryScheduleType();
+
+  const uint64_t chunk_size = d_properties->getHistoryScheduleChunkSize();
+
+  // The work stealing queue is only needed by the work stealing schedule
+  std::unique_ptr<HistoryRangeWorkStealingQueue> work_stealing_queue;
+
+  if( schedule_type == WORK_STEALING_HISTORY_SCHEDULE )
+  {
+    work_stealing_queue.reset( new HistoryRangeWorkStealingQueue(
+                   batch_start_history,
+                   batch_end_history,
+                   Utility::OpenMPProperties::getRequestedNumberOfThreads(),
+                   chunk_size ) );
+  }
 
   #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
   {
     // Create a bank for each thread
-    ParticleBank source_bank, bank;
+    std::unique_ptr<ParticleBank> source_bank, bank;
 
-    #pragma omp for
-    for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+    this->createThreadParticleBanks( source_bank, bank );
+
+    const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+    uint64_t histories_completed = 0;
+
+    std::shared_ptr<Utility::Timer> timer =
+      Utility::OpenMPProperties::createTimer();
+
+    timer->start();
+
+    // End the simulation if requested (by the signal handler)
+    // Note: Conformal OpenMP code cannot have a break statement in a
+    //       worksharing loop. Therefore we will simply loop through remaining
+    //       histories without doing anything if the simulation needs to be
+    //       ended.
+    switch( schedule_type )
     {
-      // End the simulation if requested (by the signal handler)
-      // Note: Conformal OpenMP code cannot have a break statement. Therefore
-      //       we will simply loop through remaining histories without doing
-      //       anything if the simulation needs to be ended.
-      if( d_exit_simulation )
-        continue;
+      case STATIC_HISTORY_SCHEDULE:
+      {
+        #pragma omp for schedule( static ) nowait
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+        {
+          if( d_exit_simulation )
+            continue;
 
-      // Initialize the random number generator for this history
-      Utility::RandomNumberGenerator::initialize( history );
+          this->simulateHistory( history, *source_bank, *bank );
 
-      // Sample a particle state from the source
-      try{
-        d_source->sampleParticleState( source_bank, history );
+          ++histories_completed;
+        }
+
+        break;
       }
-      catch( const Geometry::GeometryError& exception )
+      case DYNAMIC_HISTORY_SCHEDULE:
       {
-        LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+        #pragma omp for schedule( dynamic, chunk_size ) nowait
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+        {
+          if( d_exit_simulation )
+            continue;
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+          this->simulateHistory( history, *source_bank, *bank );
 
-        continue;
+          ++histories_completed;
+        }
+
+        break;
       }
-      catch( const std::runtime_error& exception )
+      case GUIDED_HISTORY_SCHEDULE:
       {
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+        #pragma omp for schedule( guided, chunk_size ) nowait
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+        {
+          if( d_exit_simulation )
+            continue;
+
+          this->simulateHistory( history, *source_bank, *bank );
 
-        continue;
+          ++histories_completed;
+        }
+
+        break;
       }
-      // The source has likely been constructed incorrectly
-      catch( const std::logic_error& exception )
+      case WORK_STEALING_HISTORY_SCHEDULE:
       {
-        FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+        uint64_t chunk_start_history, chunk_end_history;
+
+        while( !d_exit_simulation &&
+               work_stealing_queue->acquireHistories( thread_id,
+                                                      chunk_start_history,
+                                                      chunk_end_history ) )
+        {
+          for( uint64_t history = chunk_start_history; history < chunk_end_history; ++history )
+          {
+            if( d_exit_simulation )
+              break;
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+            this->simulateHistory( history, *source_bank, *bank );
 
-        d_exit_simulation = true;
+            ++histories_completed;
+          }
+        }
 
-        continue;
+        break;
       }
+    }
+
+    // Finish the histories that the thread has started but not completed
+    this->finishThreadHistories( *source_bank, *bank );
+
+    const double busy_time = timer->elapsed().count();
+
+    // Wait for the other threads to complete the micro batch
+    #pragma omp barrier
+
+    timer->stop();
+
+    d_load_balance_telemetry.recordMicroBatch(
+                                      thread_id,
+                                      histories_completed,
+                                      busy_time,
+                                      timer->elapsed().count() - busy_time );
+  }
+}
+
+// Create the particle banks that will be used by a thread
+/*! \details This method will be called by every thread at the start of a
+ * micro batch.
+ */
+void ParticleSimulationManager::createThreadParticleBanks(
+                            std::unique_ptr<ParticleBank>& source_bank,
+                            std::unique_ptr<ParticleBank>& bank ) const
+{
+  if( d_properties->isArenaParticleBankModeOn() )
+  {
+    // Both banks share the thread's arena
+    std::shared_ptr<ParticleStateArena> arena =
+      std::make_shared<ParticleStateArena>();
+
+    source_bank.reset( new ArenaParticleBank( arena ) );
+    bank.reset( new ArenaParticleBank( arena ) );
+  }
+  else
+  {
+    source_bank.reset( new ParticleBank );
+    bank.reset( new ParticleBank );
+  }
+}
+
+// Sample the source particle states of a history
+void ParticleSimulationManager::sampleSourceParticleStates(
+                                                     ParticleBank& source_bank,
+                                                     const uint64_t history )
+{
+  d_source->sampleParticleState( source_bank, history );
+}
+
+// Sample the source particle states of a history and handle the errors
+/*! \details If the source particle states could not be sampled the history
+ * will not be simulated and false will be returned. Source errors that
+ * indicate that the source has been constructed incorrectly will cause the
+ * simulation to exit.
+ */
+bool ParticleSimulationManager::sampleHistorySourceParticleStates(
+                                                     ParticleBank& source_bank,
+                                                     const uint64_t history )
+{
+  try{
+    this->sampleSourceParticleStates( source_bank, history );
+  }
+  catch( const Geometry::GeometryError& exception )
+  {
+    LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
 
-      // Simulate the particles generated by the source first
-      while( source_bank.size() > 0 )
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return false;
+  }
+  catch( const std::runtime_error& exception )
+  {
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return false;
+  }
+  // The source has likely been constructed incorrectly
+  catch( const std::logic_error& exception )
+  {
+    FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    d_exit_simulation = true;
+
+    return false;
+  }
+
+  return true;
+}
+
+// Simulate a history
+void ParticleSimulationManager::simulateHistory( const uint64_t history,
+                                                 ParticleBank& source_bank,
+                                                 ParticleBank& bank )
+{
+  // Initialize the random number generator for this history
+  Utility::RandomNumberGenerator::initialize( history );
+
+  // Sample a particle state from the source
+  if( !this->sampleHistorySourceParticleStates( source_bank, history ) )
+    return;
+
+  // Simulate the particles generated by the source and their progeny
+  this->simulateHistoryParticles( source_bank, bank );
+
+  // History complete - commit all observer history contributions
+  d_event_handler->commitObserverHistoryContributions();
+}
+
+// Finish the histories that have been started by the calling thread
+/*! \details This method will be called by every thread at the end of a
+ * micro batch. Each history is completed by
+ * ParticleSimulationManager::simulateHistory so there is nothing left to do.
+ */
+void ParticleSimulationManager::finishThreadHistories( ParticleBank&,
+                                                       ParticleBank& )
+{ /* ... */ }
+
+// Return the max number of histories that a thread simulates together
+unsigned ParticleSimulationManager::getThreadHistoryBatchSize() const
+{
+  return 1u;
+}
+
+// Select the history that the next particle events belong to
+/*! \details The observer history contribution slot of the history will be
+ * selected. This method will be called before the events of a particle in
+ * an event queue are simulated (see
+ * ParticleSimulationManager::simulateParticleEvents).
+ */
+void ParticleSimulationManager::selectParticleHistory( const uint64_t history )
+{
+  ParticleHistoryObserver::selectHistoryContributionSlot( history );
+}
+
+// Simulate the particles of a history
+/*! \details The particles generated by the source will be simulated first.
+ * The history only ends once the particle bank is empty. Each particle is
+ * simulated from birth to death before the next particle is simulated
+ * (history-based transport).
+ */
+void ParticleSimulationManager::simulateHistoryParticles(
+                                                     ParticleBank& source_bank,
+                                                     ParticleBank& bank )
+{
+  // Simulate the particles generated by the source first
+  while( source_bank.size() > 0 )
+  {
+    this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+
+    source_bank.pop();
+  }
+
+  // This history only ends when the particle bank is empty
+  while( bank.size() > 0 )
+  {
+    this->simulateUnresolvedParticle( bank.top(), bank, false );
+
+    bank.pop();
+  }
+}
+
+// Simulate an electron using the condensed history method
+void ParticleSimulationManager::simulateElectronCondensedHistory(
+                                            ParticleState& unresolved_particle,
+                                            ParticleBank& bank,
+                                            const bool source_particle )
+{
+  // Make sure that the particle is embedded in the model
+  testPrecondition( unresolved_particle.isEmbeddedInModel( *d_model ) );
+
+  this->simulateParticleImpl<ElectronState>( unresolved_particle,
+                                             bank,
+                                             source_particle,
+                                             std::bind<void>( &ParticleSimulationManager::simulateElectronTrackCondensedHistory,
+                                                              std::ref( *this ),
+                                                              std::placeholders::_1,
+                                                              std::placeholders::_2,
+                                                              std::placeholders::_3,
+                                                              std::placeholders::_4 ) );
+}
+
+// Simulate an electron track using the condensed history method
+/*! \details This is a class-II condensed history method. The optical path
+ * is measured in hard collision mean free paths - only the reactions that
+ * are not condensed by the cell material (bremsstrahlung, electroionization,
+ * absorption) are sampled as discrete collisions. Between hard collisions
+ * the electron takes condensed steps that are limited by the max
+ * fractional energy loss. At the end of each step the electron energy is
+ * reduced by the restricted stopping power (atomic excitation) and its
+ * direction is deflected by an angle sampled from the Goudsmit-Saunderson
+ * multiple scattering distribution of the path length (no lateral
+ * displacement). Steps are also limited by the ray safety distance so that
+ * a condensed step never crosses a cell boundary. Once the electron is
+ * within the boundary skin depth (measured in elastic mean free paths) of a
+ * boundary the steps are limited to one elastic mean free path and the
+ * electron is ray traced to the boundary so that boundary crossings are
+ * simulated exactly. Void cells and materials without condensed history
+ * data will be surface tracked with the standard method.
+ */
+void ParticleSimulationManager::simulateElectronTrackCondensedHistory(
+                                              ElectronState& electron,
+                                              ParticleBank& bank,
+                                              const double optical_path,
+                                              const bool starting_from_source )
+{
+  // Surface track electrons that start the track in a void cell or in a
+  // material that cannot be condensed
+  if( d_model->isCellVoid<ElectronState>( electron.getCell() ) ||
+      !d_model->FilledElectronGeometryModel::getMaterial( electron.getCell() )->hasCondensedHistoryData() )
+  {
+    this->simulateParticleTrack( electron,
+                                 bank,
+                                 optical_path,
+                                 starting_from_source );
+
+    return;
+  }
+
+  // Particle tracking information (op = optical_path)
+  double remaining_track_op = optical_path;
+
+  const double max_energy_loss_fraction =
+    d_properties->getCondensedHistoryMaxEnergyLossFraction();
+
+  const double boundary_skin_depth =
+    d_properties->getCondensedHistoryBoundarySkinDepth();
+
+  // If the particle started from a source point, update the relevant
+  // particle entering cell event observers
+  if( starting_from_source )
+  {
+    d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                electron, electron.getCell() );
+  }
+
+  // Take condensed steps until a hard collision occurs
+  while( true )
+  {
+    const ElectronMaterial& material =
+      *d_model->FilledElectronGeometryModel::getMaterial( electron.getCell() );
+
+    const double energy = electron.getEnergy();
+
+    const double hard_collision_cross_section =
+      material.getMacroscopicHardCollisionCrossSection( energy );
+
+    const double distance_to_hard_collision =
+      (hard_collision_cross_section > 0.0 ?
+       remaining_track_op/hard_collision_cross_section :
+       std::numeric_limits<double>::infinity());
+
+    double step_length =
+      std::min( distance_to_hard_collision,
+                material.getMaxCondensedHistoryStepLength(
+                                                  energy,
+                                                  max_energy_loss_fraction ) );
+
+    const double condensed_elastic_cross_section =
+      material.getMacroscopicCondensedElasticCrossSection( energy );
+
+    const double step_start_point[3] = {electron.getXPosition(),
+                                        electron.getYPosition(),
+                                        electron.getZPosition()};
+
+    const Geometry::Model::EntityId step_start_cell = electron.getCell();
+
+    // Update the ray safety distance if it cannot contain the step
+    if( electron.getRaySafetyDistance() < step_length )
+    {
+      try{
+        electron.setRaySafetyDistance(
+           electron.navigator().getDistanceToClosestBoundary().value() );
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( electron );
+    }
+
+    bool boundary_crossed = false;
+
+    // The electron is far enough from the boundaries for a condensed step
+    if( electron.getRaySafetyDistance()*condensed_elastic_cross_section >
+        boundary_skin_depth )
+    {
+      step_length = std::min( step_length, electron.getRaySafetyDistance() );
+    }
+    // The electron is within the boundary skin - ray trace the step
+    else
+    {
+      if( condensed_elastic_cross_section > 0.0 )
       {
-        this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+        step_length = std::min( step_length,
+                                1.0/condensed_elastic_cross_section );
+      }
+
+      Geometry::Model::EntityId surface_hit;
+      double distance_to_surface_hit;
 
-        source_bank.pop();
+      try{
+        distance_to_surface_hit =
+          electron.navigator().fireRay( surface_hit ).value();
       }
+      CATCH_LOST_PARTICLE_AND_BREAK( electron );
 
-      // This history only ends when the particle bank is empty
-      while( bank.size() > 0 )
+      if( distance_to_surface_hit < step_length )
       {
-        this->simulateUnresolvedParticle( bank.top(), bank, false );
+        step_length = distance_to_surface_hit;
+
+        try{
+          this->advanceParticleToCellBoundary( electron,
+                                               surface_hit,
+                                               distance_to_surface_hit );
+        }
+        CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+        electron.setRaySafetyDistance( 0.0 );
 
-        bank.pop();
+        boundary_crossed = true;
       }
+    }
 
-      // History complete - commit all observer history contributions
-      d_event_handler->commitObserverHistoryContributions();
+    if( !boundary_crossed )
+    {
+      try{
+        electron.navigator().advanceBySubstep( *Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( &step_length ) );
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+      electron.setRaySafetyDistance(
+               std::max( electron.getRaySafetyDistance() - step_length, 0.0 ) );
+
+      // Update the observers: particle subtrack ending in cell event
+      d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
+                                                              electron,
+                                                              step_start_cell,
+                                                              step_length );
+    }
+
+    // Update the observers: particle subtrack ending global event
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      electron,
+                                                      step_start_point,
+                                                      electron.getPosition() );
+
+    remaining_track_op -= step_length*hard_collision_cross_section;
+
+    // Apply the continuous energy loss along the step
+    const double final_energy =
+      material.getEnergyAfterContinuousSlowingDown( energy, step_length );
+
+    if( final_energy < d_properties->getMinElectronEnergy() )
+    {
+      electron.setAsGone();
+
+      break;
     }
+
+    electron.setEnergy( final_energy );
+
+    // Apply the multiple scattering deflection along the step
+    if( step_length > 0.0 )
+    {
+      electron.rotateDirection(
+           material.sampleMultipleScatteringAngleCosine( energy, step_length ),
+           2*Utility::PhysicalConstants::pi*
+           Utility::RandomNumberGenerator::getRandomNumber<double>() );
+    }
+
+    if( boundary_crossed )
+    {
+      // The particle has exited the geometry
+      if( d_model->isTerminationCell( electron.getCell() ) )
+      {
+        electron.setAsGone();
+
+        break;
+      }
+
+      // Surface track the remainder of the track (flights are memoryless)
+      if( d_model->isCellVoid<ElectronState>( electron.getCell() ) ||
+          !d_model->FilledElectronGeometryModel::getMaterial( electron.getCell() )->hasCondensedHistoryData() )
+      {
+        this->simulateParticleTrack(
+                   electron,
+                   bank,
+                   d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite(),
+                   false );
+
+        return;
+      }
+    }
+    // A hard collision occurs at the end of the step
+    else if( step_length >= distance_to_hard_collision )
+    {
+      this->collideHardWithCellMaterial( electron, material, bank );
+
+      // This track is finished
+      break;
+    }
+  }
+
+  if( !electron )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( electron );
+}
+
+// Collide with the cell material (condensed history hard collisions only)
+void ParticleSimulationManager::collideHardWithCellMaterial(
+                                              ElectronState& electron,
+                                              const ElectronMaterial& material,
+                                              ParticleBank& bank )
+{
+  ParticleBank local_bank;
+
+  // Undergo a hard collision with the material in the cell
+  try{
+    material.collideHardAnalogue( electron, local_bank );
   }
+  CATCH_LOST_PARTICLE( electron );
+
+  this->applyWeightWindowsToCollisionProducts( electron, local_bank, bank );
 }
 
 // The signal handler
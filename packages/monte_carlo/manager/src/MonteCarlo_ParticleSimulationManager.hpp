@@ -25,6 +25,9 @@
 #include "MonteCarlo_CollisionKernel.hpp"
 #include "MonteCarlo_TransportKernel.hpp"
 #include "MonteCarlo_SimulationProperties.hpp"
+#include "MonteCarlo_HistoryLoadBalanceTelemetry.hpp"
+#include "MonteCarlo_ParticleEventQueue.hpp"
+#include "Utility_AsynchronousFileWriter.hpp"
 #include "Utility_Communicator.hpp"
 
 extern "C" void __custom_signal_handler__( int signal );
@@ -68,6 +71,9 @@ public:
   //! Return the simulation properties
   const SimulationProperties& getSimulationProperties() const;
 
+  //! Return the history load balance telemetry
+  const HistoryLoadBalanceTelemetry& getHistoryLoadBalanceTelemetry() const;
+
   //! Set the simulation name
   void setSimulationName( const std::string& new_name );
 
@@ -155,11 +161,66 @@ protected:
                                     ParticleBank& bank,
                                     const bool source_particle );
 
+  //! Simulate a resolved particle using the delta tracking method
+  template<typename State>
+  void simulateParticleDeltaTracking( ParticleState& unresolved_particle,
+                                      ParticleBank& bank,
+                                      const bool source_particle );
+
+  //! Check if delta tracking will be used for a particle type
+  template<typename State>
+  bool isDeltaTrackingUsed() const;
+
+  //! Simulate an electron using the condensed history method
+  void simulateElectronCondensedHistory( ParticleState& unresolved_particle,
+                                         ParticleBank& bank,
+                                         const bool source_particle );
+
+  //! Check if condensed history will be used for a particle type
+  template<typename State>
+  bool isCondensedHistoryUsed() const;
+
+  //! Create the particle banks that will be used by a thread
+  virtual void createThreadParticleBanks(
+                                   std::unique_ptr<ParticleBank>& source_bank,
+                                   std::unique_ptr<ParticleBank>& bank ) const;
+
+  //! Sample the source particle states of a history
+  virtual void sampleSourceParticleStates( ParticleBank& source_bank,
+                                           const uint64_t history );
+
+  //! Sample the source particle states of a history and handle the errors
+  bool sampleHistorySourceParticleStates( ParticleBank& source_bank,
+                                          const uint64_t history );
+
+  //! Simulate a history
+  virtual void simulateHistory( const uint64_t history,
+                                ParticleBank& source_bank,
+                                ParticleBank& bank );
+
+  //! Finish the histories that have been started by the calling thread
+  virtual void finishThreadHistories( ParticleBank& source_bank,
+                                      ParticleBank& bank );
+
+  //! Return the max number of histories that a thread simulates together
+  virtual unsigned getThreadHistoryBatchSize() const;
+
+  //! Simulate the particles of a history
+  virtual void simulateHistoryParticles( ParticleBank& source_bank,
+                                         ParticleBank& bank );
+
+  //! Select the history that the next particle events belong to
+  virtual void selectParticleHistory( const uint64_t history );
+
+  //! Simulate the particles in an event queue using event-based transport
+  template<typename State>
+  void simulateParticleEvents( ParticleEventQueue& queue, ParticleBank& bank );
+
   //! Get the collision forcer
   const CollisionForcer& getCollisionForcer() const;
 
   //! Enable thread support
-  void enableThreadSupport();
+  virtual void enableThreadSupport();
 
   //! Reset data
   void resetData();
@@ -168,6 +229,11 @@ protected:
   void reduceData( const Utility::Communicator& comm,
                    const int root_process );
 
+  //! Reduce distributed data
+  void reduceData( Utility::HierarchicalReducer& reducer,
+                   const Utility::Communicator& comm,
+                   const int root_process );
+
   //! Register simulation started event
   void registerSimulationStartedEvent();
 
@@ -248,6 +314,45 @@ private:
                                          const double optical_path,
                                          const bool starting_from_source );
 
+  // Simulate a resolved particle track using the delta tracking method
+  template<typename State>
+  void simulateParticleTrackDeltaTracking( State& particle,
+                                           ParticleBank& bank,
+                                           const double optical_path,
+                                           const bool starting_from_source );
+
+  // Return a particle to a delta tracking site and surface track the rest
+  // of the track
+  template<typename State>
+  void surfaceTrackFromDeltaTrackingSite(
+                                 State& particle,
+                                 ParticleBank& bank,
+                                 const double site_position[3],
+                                 const Geometry::Model::EntityId site_cell,
+                                 const double track_start_point[3] );
+
+  // Simulate an electron track using the condensed history method
+  void simulateElectronTrackCondensedHistory(
+                                            ElectronState& electron,
+                                            ParticleBank& bank,
+                                            const double optical_path,
+                                            const bool starting_from_source );
+
+  // Collide with the cell material (condensed history hard collisions only)
+  void collideHardWithCellMaterial( ElectronState& electron,
+                                    const ElectronMaterial& material,
+                                    ParticleBank& bank );
+
+  // Start a new track for the particles in an event queue that need one
+  template<typename State>
+  void startParticleEventTracks( ParticleEventQueue& queue );
+
+  // End the track of a particle in an event queue
+  template<typename State>
+  void endParticleEventTrack( State& particle,
+                              ParticleEventQueue& queue,
+                              const size_t index );
+
   // Advance a particle to the cell boundary
   template<typename State>
   void advanceParticleToCellBoundary(
@@ -269,8 +374,23 @@ private:
   void collideWithCellMaterial( State& particle,
                                 ParticleBank& bank );
 
+  // Collide with the cell material implementation
+  template<typename State>
+  void collideWithCellMaterialImpl( State& particle,
+                                    ParticleBank& local_bank,
+                                    ParticleBank& bank );
+
+  // Apply the weight windows to a collided particle and its progeny
+  template<typename State>
+  void applyWeightWindowsToCollisionProducts( State& particle,
+                                              ParticleBank& local_bank,
+                                              ParticleBank& bank );
+
   // Conduct a basic rendezvous
-  void basicRendezvous() const;
+  void basicRendezvous( const bool asynchronous = false ) const;
+
+  // Wait for the pending rendezvous archive write to finish
+  void waitForRendezvousArchiveWrite() const;
 
   // Declare the custom signal handler as a friend
   friend void ::__custom_signal_handler__( int );
@@ -308,6 +428,12 @@ private:
   // The simulation properties
   std::shared_ptr<const SimulationProperties> d_properties;
 
+  // The history load balance telemetry
+  HistoryLoadBalanceTelemetry d_load_balance_telemetry;
+
+  // The rendezvous archive writer
+  std::unique_ptr<Utility::AsynchronousFileWriter> d_rendezvous_archive_writer;
+
   // The next history to run
   uint64_t d_next_history;
 
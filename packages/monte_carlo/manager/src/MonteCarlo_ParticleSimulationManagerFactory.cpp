@@ -10,7 +10,9 @@
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
 #include "MonteCarlo_StandardParticleSimulationManager.hpp"
+#include "MonteCarlo_EventBasedParticleSimulationManager.hpp"
 #include "MonteCarlo_BatchedDistributedStandardParticleSimulationManager.hpp"
+#include "MonteCarlo_PowerIterationParticleSimulationManager.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_GlobalMPISession.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -238,6 +240,23 @@ void ParticleSimulationManagerFactory::saveToFileImpl(
   this->restoreBposPointer<Data::ZAID>( extension, zaid_bpos );
 }
 
+// Archive the object to an in-memory buffer (implementation)
+void ParticleSimulationManagerFactory::saveToBufferImpl(
+                                                 const std::string& extension,
+                                                 std::string& buffer ) const
+{
+  // The bpos pointer must be NULL. Depending on the libraries that have been
+  // loaded the bpos might be initialized to a non-NULL value
+  const boost::archive::detail::basic_pointer_oserializer* zaid_bpos =
+    this->resetBposPointer<Data::ZAID>( extension );
+
+  BaseArchivableObjectType::saveToBufferImpl( extension, buffer );
+
+  // The bpos pointer must be restored to its original value so that libraries
+  // that expect it to be non-NULL behave correctly
+  this->restoreBposPointer<Data::ZAID>( extension, zaid_bpos );
+}
+
 // Set the weight windows that will be used by the manager
 void ParticleSimulationManagerFactory::setWeightWindows(
                     const std::shared_ptr<const WeightWindow>& weight_windows )
@@ -282,7 +301,24 @@ struct ParticleSimulationManagerFactoryCreateHelper
   template<ParticleModeType mode>
   static void createManager( ParticleSimulationManagerFactory& factory )
   {
-    if( factory.d_comm->size() > 1 )
+    if( factory.d_properties->isPowerIterationModeOn() )
+    {
+      factory.d_simulation_manager.reset(
+                 new PowerIterationParticleSimulationManager<mode>(
+                                          factory.d_simulation_name,
+                                          factory.d_archive_type,
+                                          factory.d_model,
+                                          factory.d_source,
+                                          factory.d_event_handler,
+                                          factory.d_weight_windows,
+                                          factory.d_collision_forcer,
+                                          factory.d_properties,
+                                          factory.d_next_history,
+                                          factory.d_rendezvous_number,
+                                          factory.d_use_single_rendezvous_file,
+                                          factory.d_comm ) );
+    }
+    else if( factory.d_comm->size() > 1 )
     {
       factory.d_simulation_manager.reset(
                  new BatchedDistributedStandardParticleSimulationManager<mode>(
@@ -299,6 +335,22 @@ struct ParticleSimulationManagerFactoryCreateHelper
                                           factory.d_use_single_rendezvous_file,
                                           factory.d_comm ) );
     }
+    else if( factory.d_properties->isEventBasedTransportModeOn() )
+    {
+      factory.d_simulation_manager.reset(
+                 new EventBasedParticleSimulationManager<mode>(
+                                      factory.d_simulation_name,
+                                      factory.d_archive_type,
+                                      factory.d_model,
+                                      factory.d_source,
+                                      factory.d_event_handler,
+                                      factory.d_weight_windows,
+                                      factory.d_collision_forcer,
+                                      factory.d_properties,
+                                      factory.d_next_history,
+                                      factory.d_rendezvous_number,
+                                      factory.d_use_single_rendezvous_file ) );
+    }
     else
     {
       factory.d_simulation_manager.reset(
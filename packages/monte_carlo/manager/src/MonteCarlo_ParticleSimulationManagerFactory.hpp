@@ -94,6 +94,10 @@ protected:
   void saveToFileImpl( const boost::filesystem::path& archive_name_with_path,
                        const bool overwrite ) const final override;
 
+  //! Archive the object to an in-memory buffer (implementation)
+  void saveToBufferImpl( const std::string& extension,
+                         std::string& buffer ) const final override;
+
 private:
 
   //! Archive constructor
@@ -13,6 +13,10 @@
 #include <functional>
 #include <type_traits>
 
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteParticleBank.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+
 //! Log lost particle details
 #define LOG_LOST_PARTICLE_DETAILS( particle )   \
   FRENSIE_LOG_TAGGED_WARNING(                   \
@@ -170,6 +174,65 @@ void ParticleSimulationManager::simulateParticleAlternative(
                                                       std::placeholders::_4 ) );
 }
 
+// Simulate a resolved particle using the delta tracking method
+template<typename State>
+void ParticleSimulationManager::simulateParticleDeltaTracking(
+                                            ParticleState& unresolved_particle,
+                                            ParticleBank& bank,
+                                            const bool source_particle )
+{
+  // Make sure that the particle is embedded in the model
+  testPrecondition( unresolved_particle.isEmbeddedInModel( *d_model ) );
+
+  this->simulateParticleImpl<State>( unresolved_particle,
+                                     bank,
+                                     source_particle,
+                                     std::bind<void>( &ParticleSimulationManager::simulateParticleTrackDeltaTracking<State>,
+                                                      std::ref( *this ),
+                                                      std::placeholders::_1,
+                                                      std::placeholders::_2,
+                                                      std::placeholders::_3,
+                                                      std::placeholders::_4 ) );
+}
+
+// Check if delta tracking will be used for a particle type
+/*! \details Delta tracking will only be used if it has been requested in
+ * the simulation properties. Particle types with observers that require
+ * surface tracking (e.g. cell track-length flux estimators, surface
+ * estimators) fall back to surface tracking because a delta tracking flight
+ * cannot determine which cells and surfaces it passes through.
+ */
+template<typename State>
+bool ParticleSimulationManager::isDeltaTrackingUsed() const
+{
+  const ParticleType particle_type = State::type;
+
+  if( !d_properties->isDeltaTrackingModeOn() )
+    return false;
+
+  if( d_event_handler->hasSurfaceTrackingObservers( particle_type ) )
+  {
+    FRENSIE_LOG_NOTIFICATION( particle_type << " particles will be surface "
+                              "tracked because observers that require "
+                              "surface tracking have been registered" );
+
+    return false;
+  }
+
+  return true;
+}
+
+// Check if condensed history will be used for a particle type
+/*! \details Condensed history will only be used for electrons and only if
+ * it has been requested in the simulation properties.
+ */
+template<typename State>
+bool ParticleSimulationManager::isCondensedHistoryUsed() const
+{
+  return std::is_same<State,ElectronState>::value &&
+    d_properties->isCondensedHistoryModeOn();
+}
+
 // Simulate a resolved particle implementation
 template<typename State, typename SimulateParticleTrackMethod>
 void ParticleSimulationManager::simulateParticleImpl(
@@ -566,6 +629,468 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
 }
 
+// Simulate a resolved particle track using the delta tracking method
+/*! \details The distance to the next tentative collision site is sampled
+ * using the majorant cross section of the particle type (the energy of the
+ * particle does not change between collisions). The particle is then
+ * located in the model at the tentative collision site - the cell
+ * boundaries along the flight are never ray traced and no cell or surface
+ * events are reported. The termination cell is assumed to enclose the model
+ * so a particle whose tentative collision site is located in a termination
+ * cell will be terminated. A tentative collision is accepted as a real
+ * collision with
+ * probability equal to the ratio of the cell total macroscopic cross section
+ * and the majorant cross section. Otherwise the tentative (virtual)
+ * collision is ignored and a new flight is sampled from the tentative
+ * collision site. The majorant cross section is an upper bound of the
+ * material cross sections (see
+ * MonteCarlo::StandardFilledParticleGeometryModel). Because flights are
+ * memoryless, the particle is returned to the last tentative collision site
+ * and surface tracked for the remainder of the track if a tentative
+ * collision site cannot be located in the model (e.g. the site is beyond the
+ * outer boundary of the termination cell) or if the cell cross section is
+ * ever greater than the majorant cross section (e.g. due to roundoff). If
+ * the model did not construct a majorant cross section for the
+ * particle type (e.g. the model is void or has reflecting surfaces) the track
+ * will be surface tracked. Forced collisions cannot be done with this
+ * tracking method.
+ */
+template<typename State>
+void ParticleSimulationManager::simulateParticleTrackDeltaTracking(
+                                              State& particle,
+                                              ParticleBank& bank,
+                                              const double optical_path,
+                                              const bool starting_from_source )
+{
+  if( !d_model->hasMajorantCrossSection<State>() )
+  {
+    this->simulateParticleTrack( particle,
+                                 bank,
+                                 optical_path,
+                                 starting_from_source );
+
+    return;
+  }
+
+  // Particle tracking information (op = optical_path)
+  double remaining_track_op = optical_path;
+
+  double track_start_point[3] = {particle.getXPosition(),
+                                 particle.getYPosition(),
+                                 particle.getZPosition()};
+
+  // Records if global subtrack ending event has been dispatched
+  bool global_subtrack_ending_event_dispatched = false;
+
+  // If the particle started from a source point, update the relevant
+  // particle entering cell event observers
+  if( starting_from_source )
+  {
+    d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                particle, particle.getCell() );
+  }
+
+  const double majorant_cross_section =
+    d_model->getMajorantCrossSection<State>( particle.getEnergy() );
+
+  // Sample tentative collision sites until a real collision occurs
+  while( true )
+  {
+    const double distance_to_tentative_collision =
+      remaining_track_op/majorant_cross_section;
+
+    // Cache the last tentative collision site
+    const double last_site_position[3] = {particle.getXPosition(),
+                                          particle.getYPosition(),
+                                          particle.getZPosition()};
+
+    const Geometry::Model::EntityId last_site_cell = particle.getCell();
+
+    // Locate the particle at the tentative collision site (point location
+    // only - the flight is not ray traced)
+    {
+      const double* direction = particle.getDirection();
+
+      const Geometry::Navigator::Length site_position[3] =
+        {Geometry::Navigator::Length::from_value( last_site_position[0] +
+                                   distance_to_tentative_collision*direction[0] ),
+         Geometry::Navigator::Length::from_value( last_site_position[1] +
+                                   distance_to_tentative_collision*direction[1] ),
+         Geometry::Navigator::Length::from_value( last_site_position[2] +
+                                   distance_to_tentative_collision*direction[2] )};
+
+      const double site_direction[3] = {direction[0],
+                                        direction[1],
+                                        direction[2]};
+
+      try{
+        particle.navigator().setState( site_position, site_direction );
+      }
+      catch( const std::runtime_error& )
+      {
+        this->surfaceTrackFromDeltaTrackingSite( particle,
+                                                 bank,
+                                                 last_site_position,
+                                                 last_site_cell,
+                                                 track_start_point );
+
+        return;
+      }
+    }
+
+    // The ray safety distance is not valid at the new site
+    particle.setRaySafetyDistance( 0.0 );
+
+    // The particle has exited the geometry
+    if( d_model->isTerminationCell( particle.getCell() ) )
+    {
+      particle.setAsGone();
+
+      break;
+    }
+
+    // Get the total cross section for the cell
+    double cell_total_macro_cross_section;
+
+    if( !d_model->isCellVoid<State>( particle.getCell() ) )
+    {
+      cell_total_macro_cross_section =
+        d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+    }
+    else
+      cell_total_macro_cross_section = 0.0;
+
+    // The majorant cross section is not valid at this energy
+    if( cell_total_macro_cross_section > majorant_cross_section )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "Delta Tracking",
+                                  "cell " << particle.getCell() <<
+                                  " total cross section ("
+                                  << cell_total_macro_cross_section <<
+                                  ") is greater than the majorant cross "
+                                  "section (" << majorant_cross_section <<
+                                  ") at energy " << particle.getEnergy() );
+
+      this->surfaceTrackFromDeltaTrackingSite( particle,
+                                               bank,
+                                               last_site_position,
+                                               last_site_cell,
+                                               track_start_point );
+
+      return;
+    }
+
+    // A real collision occurs at the tentative collision site
+    if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+        majorant_cross_section < cell_total_macro_cross_section )
+    {
+      // Update the observers: particle subtrack ending global event
+      d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+
+      global_subtrack_ending_event_dispatched = true;
+
+      this->collideWithCellMaterial( particle, bank );
+
+      // This track is finished
+      break;
+    }
+
+    // A virtual collision occurs - sample a new flight
+    remaining_track_op =
+      d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite();
+  }
+
+  if( !global_subtrack_ending_event_dispatched )
+  {
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+  }
+
+  if( !particle )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+}
+
+// Return a particle to a delta tracking site and surface track the rest of
+// the track
+/*! \details The subtrack from the start of the track to the delta tracking
+ * site will be reported to the global observers before the remainder of the
+ * track is simulated with a new optical path (flights are memoryless).
+ */
+template<typename State>
+void ParticleSimulationManager::surfaceTrackFromDeltaTrackingSite(
+                                 State& particle,
+                                 ParticleBank& bank,
+                                 const double site_position[3],
+                                 const Geometry::Model::EntityId site_cell,
+                                 const double track_start_point[3] )
+{
+  const double direction[3] = {particle.getXDirection(),
+                               particle.getYDirection(),
+                               particle.getZDirection()};
+
+  particle.navigator().setState(
+          Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( site_position ),
+          direction,
+          site_cell );
+
+  particle.setRaySafetyDistance( 0.0 );
+
+  // Update the observers: particle subtrack ending global event
+  d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+
+  this->simulateParticleTrack(
+                   particle,
+                   bank,
+                   d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite(),
+                   false );
+}
+
+// Simulate the particles in an event queue using event-based transport
+/*! \details Instead of following each particle from the start of a track to
+ * the end of the track, every particle in the queue is taken through an
+ * event stage (track start, cross section lookup, distance to collision, ray
+ * trace and surface crossing/collision) before the next stage is started.
+ * The cross section lookups and the distance to collision calculations are
+ * done in tight loops over contiguous arrays so that they can be vectorized.
+ * Particles that cross a cell boundary stay in the queue and continue their
+ * track during the next pass. The progeny generated by collisions will be
+ * added to the bank. This method returns once every particle in the queue is
+ * gone. The queue can hold the particles of several histories - the history
+ * of a particle is selected (see
+ * ParticleSimulationManager::selectParticleHistory) before any of its events
+ * are simulated. Forced collisions cannot
+ * be done with this method (use the "alternative" history-based tracking
+ * method instead).
+ */
+template<typename State>
+void ParticleSimulationManager::simulateParticleEvents(
+                                                     ParticleEventQueue& queue,
+                                                     ParticleBank& bank )
+{
+  while( !queue.isEmpty() )
+  {
+    // Track start stage: start a new track (of random optical path length)
+    // for the particles that have just been added to the queue and for the
+    // particles that have collided
+    this->startParticleEventTracks<State>( queue );
+
+    queue.removeGoneParticles();
+
+    const size_t queue_size = queue.size();
+
+    double* remaining_track_ops = queue.getRemainingOpticalPaths();
+    double* cell_total_macro_cross_sections =
+      queue.getCellTotalMacroscopicCrossSections();
+    double* cell_distances_to_collision = queue.getDistancesToCollision();
+    double* distances_to_surface_hit = queue.getDistancesToSurfaceHit();
+
+    // Cross section lookup stage
+    for( size_t i = 0; i < queue_size; ++i )
+    {
+      State& particle = static_cast<State&>( queue.getParticle( i ) );
+
+      this->selectParticleHistory( particle.getHistoryNumber() );
+
+      if( !d_model->isCellVoid<State>( particle.getCell() ) )
+      {
+        cell_total_macro_cross_sections[i] =
+          d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+      }
+      else
+        cell_total_macro_cross_sections[i] = 0.0;
+    }
+
+    // Distance to collision stage
+    #pragma omp simd
+    for( size_t i = 0; i < queue_size; ++i )
+    {
+      cell_distances_to_collision[i] =
+        remaining_track_ops[i]/cell_total_macro_cross_sections[i];
+    }
+
+    // Ray trace stage
+    for( size_t i = 0; i < queue_size; ++i )
+    {
+      State& particle = static_cast<State&>( queue.getParticle( i ) );
+
+      this->selectParticleHistory( particle.getHistoryNumber() );
+
+      // Fire a ray through the cell currently containing the particle
+      try{
+        distances_to_surface_hit[i] =
+          Details::RaySafetyHelper<State>::getDistanceToSurfaceHit(
+                                            particle,
+                                            queue.getSurfaceHit( i ),
+                                            cell_distances_to_collision[i] );
+      }
+      CATCH_LOST_PARTICLE( particle,
+                           this->endParticleEventTrack( particle, queue, i ) );
+    }
+
+    // Surface crossing and collision stage
+    for( size_t i = 0; i < queue_size; ++i )
+    {
+      State& particle = static_cast<State&>( queue.getParticle( i ) );
+
+      // The particle was lost during the ray trace stage
+      if( !particle )
+        continue;
+
+      this->selectParticleHistory( particle.getHistoryNumber() );
+
+      // Convert the distance to the surface to optical path
+      const double op_to_surface_hit =
+        distances_to_surface_hit[i]*cell_total_macro_cross_sections[i];
+
+      // The particle passes through this cell to the next
+      if( op_to_surface_hit < remaining_track_ops[i] )
+      {
+        try{
+          this->advanceParticleToCellBoundary( particle,
+                                               queue.getSurfaceHit( i ),
+                                               distances_to_surface_hit[i] );
+        }
+        CATCH_LOST_PARTICLE_AND_CONTINUE( particle,
+                           this->endParticleEventTrack( particle, queue, i ) );
+
+        // The particle has exited the geometry
+        if( d_model->isTerminationCell( particle.getCell() ) )
+        {
+          particle.setAsGone();
+
+          this->endParticleEventTrack( particle, queue, i );
+
+          continue;
+        }
+
+        // Update the remaining subtrack mfp
+        remaining_track_ops[i] -= op_to_surface_hit;
+
+        // Set the ray safety distance to zero
+        particle.setRaySafetyDistance( 0.0 );
+
+        queue.continueTrack( i );
+      }
+
+      // A collision occurs in this cell
+      else
+      {
+        this->advanceParticleToCollisionSite(
+                          particle,
+                          remaining_track_ops[i],
+                          cell_distances_to_collision[i],
+                          queue.getTrackStartPoint( i ),
+                          queue.getSubtrackEndingGlobalEventDispatched( i ) );
+
+        // Update the particle's ray safety distance
+        Details::RaySafetyHelper<State>::updateRaySafetyDistance(
+                                            particle,
+                                            cell_distances_to_collision[i] );
+
+        this->collideWithCellMaterial( particle, bank );
+
+        // This track is finished
+        this->endParticleEventTrack( particle, queue, i );
+      }
+    }
+
+    queue.removeGoneParticles();
+  }
+}
+
+// Start a new track for the particles in an event queue that need one
+template<typename State>
+void ParticleSimulationManager::startParticleEventTracks(
+                                                    ParticleEventQueue& queue )
+{
+  for( size_t i = 0; i < queue.size(); ++i )
+  {
+    if( !queue.isNewTrackRequired( i ) )
+      continue;
+
+    State& particle = static_cast<State&>( queue.getParticle( i ) );
+
+    this->selectParticleHistory( particle.getHistoryNumber() );
+
+    if( queue.isStartingFromSource( i ) )
+    {
+      // Check if the particle energy is below the cutoff
+      if( particle.getEnergy() < d_properties->getMinParticleEnergy<State>() )
+      {
+        FRENSIE_LOG_WARNING( particle.getParticleType() <<
+                             " born below global cutoff energy. Check source "
+                             "definition!\n" << particle );
+
+        particle.setAsGone();
+      }
+      // Check if the particle energy is above the max energy
+      else if( particle.getEnergy() > d_properties->getMaxParticleEnergy<State>() )
+      {
+        FRENSIE_LOG_WARNING( particle.getParticleType() <<
+                             " born above global max energy. Check source "
+                             "definition!\n" << particle );
+
+        particle.setAsGone();
+      }
+    }
+    else
+    {
+      // Check if the particle energy is outside of the energy limits
+      if( particle.getEnergy() < d_properties->getMinParticleEnergy<State>() ||
+          particle.getEnergy() > d_properties->getMaxParticleEnergy<State>() )
+      {
+        particle.setAsGone();
+      }
+      // Roulette the particle if it is below the threshold weight
+      else
+        d_weight_roulette->rouletteParticleWeight( particle );
+    }
+
+    if( particle )
+    {
+      queue.startNewTrack(
+                i, d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite() );
+
+      // If the particle started from a source point, update the relevant
+      // particle entering cell event observers
+      if( queue.isStartingFromSource( i ) )
+      {
+        d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                particle, particle.getCell() );
+      }
+    }
+  }
+}
+
+// End the track of a particle in an event queue
+template<typename State>
+void ParticleSimulationManager::endParticleEventTrack(
+                                                     State& particle,
+                                                     ParticleEventQueue& queue,
+                                                     const size_t index )
+{
+  if( !queue.getSubtrackEndingGlobalEventDispatched( index ) )
+  {
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                particle,
+                                                queue.getTrackStartPoint( index ),
+                                                particle.getPosition() );
+  }
+
+  if( !particle )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+
+  queue.endTrack( index );
+}
+
 // Advance a particle to the cell boundary
 template<typename State>
 void ParticleSimulationManager::advanceParticleToCellBoundary(
@@ -636,18 +1161,60 @@ void ParticleSimulationManager::advanceParticleToCollisionSite(
 }
 
 // Collide with the cell material
+/*! \details When the history bank is a fission site particle bank the
+ * neutron progeny will be collected in a fission site particle bank that
+ * shares its fission site bank. This ensures that the fission sites are
+ * banked before the weight windows are applied (the reaction that created
+ * the progeny is not known once they have been moved to the history bank).
+ */
 template<typename State>
 void ParticleSimulationManager::collideWithCellMaterial( State& particle,
                                                          ParticleBank& bank )
 {
+  if( std::is_same<State,NeutronState>::value )
+  {
+    FissionSiteParticleBank* fission_site_bank =
+      dynamic_cast<FissionSiteParticleBank*>( &bank );
+
+    if( fission_site_bank )
+    {
+      FissionSiteParticleBank local_bank(
+                                  fission_site_bank->getFissionSiteBank() );
+
+      this->collideWithCellMaterialImpl( particle, local_bank, bank );
+
+      return;
+    }
+  }
+
   ParticleBank local_bank;
 
+  this->collideWithCellMaterialImpl( particle, local_bank, bank );
+}
+
+// Collide with the cell material implementation
+template<typename State>
+void ParticleSimulationManager::collideWithCellMaterialImpl(
+                                                     State& particle,
+                                                     ParticleBank& local_bank,
+                                                     ParticleBank& bank )
+{
   // Undergo a collision with the material in the cell
   try{
     d_collision_kernel->collideWithCellMaterial( particle, local_bank );
   }
   CATCH_LOST_PARTICLE( particle );
 
+  this->applyWeightWindowsToCollisionProducts( particle, local_bank, bank );
+}
+
+// Apply the weight windows to a collided particle and its progeny
+template<typename State>
+void ParticleSimulationManager::applyWeightWindowsToCollisionProducts(
+                                                     State& particle,
+                                                     ParticleBank& local_bank,
+                                                     ParticleBank& bank )
+{
   // Apply the weight windows to the original particle and to each of its
   // progeny
   if( particle )
@@ -665,16 +1232,15 @@ void ParticleSimulationManager::collideWithCellMaterial( State& particle,
                                              split_particle_bank );
     }
 
-    std::shared_ptr<ParticleState> local_particle;
-
-    local_bank.pop( local_particle );
-
-    // If the particle wasn't Rouletted, add it to the bank
-    if( local_particle )
+    // If the particle wasn't Rouletted, move it to the bank (the particle
+    // state is not copied)
+    if( local_bank.top() )
     {
-      bank.push( local_particle );
+      local_bank.spliceTop( bank );
       bank.splice( split_particle_bank );
     }
+    else
+      local_bank.pop();
   }
 }
 
@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PowerIterationParticleSimulationManager.hpp
+//! \author Alex Robinson
+//! \brief  Power iteration particle simulation manager class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POWER_ITERATION_PARTICLE_SIMULATION_MANAGER_HPP
+#define MONTE_CARLO_POWER_ITERATION_PARTICLE_SIMULATION_MANAGER_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_StandardParticleSimulationManager.hpp"
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "Utility_Communicator.hpp"
+#include "Utility_HierarchicalReducer.hpp"
+
+namespace MonteCarlo{
+
+/*! The power iteration (k-eigenvalue) particle simulation manager
+ *
+ * The simulation is divided into inactive and active cycles. The source of
+ * the first cycle is sampled from the particle source. The fission neutrons
+ * created in a cycle are not transported - their sites are stored in a
+ * fission site bank owned by the thread that simulated the history. At the
+ * end of a cycle the thread banks are merged (sorted by history number and
+ * site index) and the source of the next cycle is resampled from the banked
+ * sites (see MonteCarlo::FissionSiteBank::resample). The histories of each
+ * cycle are divided into contiguous ranges (one for each process) so that
+ * the process banks form a globally ordered bank. The history numbers (and
+ * therefore the random number streams) of a cycle only depend on the
+ * cycle number, which makes the simulation reproducible regardless of the
+ * number of threads and processes. The observers only collect data during
+ * the active cycles. The multiplication factor of a cycle is the total
+ * weight of the banked sites divided by the number of source neutrons.
+ */
+template<ParticleModeType mode>
+class PowerIterationParticleSimulationManager : public StandardParticleSimulationManager<mode>
+{
+
+public:
+
+  //! Constructor
+  PowerIterationParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<const WeightWindow> weight_windows,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file,
+                 const std::shared_ptr<const Utility::Communicator>& comm );
+
+  //! Destructor
+  ~PowerIterationParticleSimulationManager()
+  { /* ... */ }
+
+  //! Run the simulation set up by the user
+  void runSimulation() final override;
+
+  //! Run the simulation set up by the user with the ability to interrupt
+  void runInterruptibleSimulation() final override;
+
+  //! Return the number of completed cycles
+  unsigned getNumberOfCompletedCycles() const;
+
+  //! Return the multiplication factor of each completed cycle
+  const std::vector<double>& getCycleMultiplicationFactors() const;
+
+  //! Return the mean multiplication factor of the active cycles
+  double getMultiplicationFactor() const;
+
+  //! Return the std dev of the mean multiplication factor
+  double getMultiplicationFactorStandardDeviation() const;
+
+  //! Return the fission source of the next cycle assigned to this process
+  const FissionSiteBank& getFissionSites() const;
+
+  //! Print the simulation data to the desired stream
+  void printSimulationSummary( std::ostream& os ) const final override;
+
+  //! Log the simulation data
+  void logSimulationSummary() const final override;
+
+protected:
+
+  //! Create the particle banks that will be used by a thread
+  void createThreadParticleBanks(
+               std::unique_ptr<ParticleBank>& source_bank,
+               std::unique_ptr<ParticleBank>& bank ) const final override;
+
+  //! Sample the source particle states of a history
+  void sampleSourceParticleStates( ParticleBank& source_bank,
+                                   const uint64_t history ) final override;
+
+  //! Rendezvous (cache state)
+  void rendezvous() final override;
+
+private:
+
+  // Run a cycle
+  void runCycle();
+
+  // Collect the fission sites banked by the threads
+  void collectThreadFissionSites();
+
+  // Print the multiplication factor summary
+  void printMultiplicationFactorSummary( std::ostream& os ) const;
+
+  // The communicator
+  std::shared_ptr<const Utility::Communicator> d_comm;
+
+  // The observer data reducer (created once since it requires collective
+  // communication)
+  std::unique_ptr<Utility::HierarchicalReducer> d_observer_data_reducer;
+
+  // The unfilled model (used to embed the fission source neutrons)
+  std::shared_ptr<const Geometry::Model> d_unfilled_model;
+
+  // The number of neutrons per cycle
+  uint64_t d_neutrons_per_cycle;
+
+  // The number of inactive cycles
+  unsigned d_inactive_cycles;
+
+  // The number of active cycles
+  unsigned d_active_cycles;
+
+  // The current cycle
+  unsigned d_cycle;
+
+  // The first history of the current cycle
+  uint64_t d_cycle_start_history;
+
+  // The first source site index assigned to this process
+  uint64_t d_process_start_site;
+
+  // The fission sites banked by each thread in the current cycle
+  std::vector<std::shared_ptr<FissionSiteBank> > d_thread_fission_sites;
+
+  // The fission sites (the source of the current cycle - or the next cycle
+  // once the current cycle has been completed - that is assigned to this
+  // process)
+  FissionSiteBank d_fission_sites;
+
+  // The multiplication factor of each completed cycle
+  std::vector<double> d_cycle_multiplication_factors;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_PowerIterationParticleSimulationManager_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_POWER_ITERATION_PARTICLE_SIMULATION_MANAGER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PowerIterationParticleSimulationManager.hpp
+//---------------------------------------------------------------------------//
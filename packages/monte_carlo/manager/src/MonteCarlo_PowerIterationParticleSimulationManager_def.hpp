@@ -0,0 +1,441 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PowerIterationParticleSimulationManager_def.hpp
+//! \author Alex Robinson
+//! \brief  Power iteration particle simulation manager class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POWER_ITERATION_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+#define MONTE_CARLO_POWER_ITERATION_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+// Std Lib Includes
+#include <cmath>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteParticleBank.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_JustInTimeInitializer.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+template<ParticleModeType mode>
+PowerIterationParticleSimulationManager<mode>::PowerIterationParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<const WeightWindow> weight_windows,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file,
+                 const std::shared_ptr<const Utility::Communicator>& comm )
+  : StandardParticleSimulationManager<mode>( simulation_name,
+                                             archive_type,
+                                             model,
+                                             source,
+                                             event_handler,
+                                             weight_windows,
+                                             collision_forcer,
+                                             properties,
+                                             next_history,
+                                             rendezvous_number,
+                                             use_single_rendezvous_file ),
+  d_comm( comm ),
+  d_observer_data_reducer(),
+  d_unfilled_model( *model ),
+  d_neutrons_per_cycle( properties->getNumberOfNeutronsPerCycle() ),
+  d_inactive_cycles( properties->getNumberOfInactiveCycles() ),
+  d_active_cycles( properties->getNumberOfActiveCycles() ),
+  d_cycle( 0 ),
+  d_cycle_start_history( next_history ),
+  d_process_start_site( 0 ),
+  d_thread_fission_sites(),
+  d_fission_sites(),
+  d_cycle_multiplication_factors()
+{
+  // Make sure that the communicator pointer is valid
+  testPrecondition( comm.get() );
+
+  TEST_FOR_EXCEPTION( mode != NEUTRON_MODE &&
+                      mode != NEUTRON_PHOTON_MODE &&
+                      mode != NEUTRON_PHOTON_ELECTRON_MODE,
+                      std::runtime_error,
+                      "Power iteration cannot be done in particle mode "
+                      << mode << " (neutrons must be transported)!" );
+
+  if( comm->size() > 1 )
+    d_observer_data_reducer.reset( new Utility::HierarchicalReducer( *comm, 0 ) );
+}
+
+// Run the simulation set up by the user with the ability to interrupt
+/*! \details Distributed simulations cannot be interrupted. The
+ * runSimulation method will be called after issuing a warning. Serial
+ * simulations will be terminated once the current cycle is completed.
+ */
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::runInterruptibleSimulation()
+{
+  if( d_comm->size() > 1 )
+  {
+    if( d_comm->rank() == 0 )
+    {
+      FRENSIE_LOG_WARNING( "Distributed simulations cannot be interrupted!" );
+    }
+
+    this->runSimulation();
+  }
+  else
+    ParticleSimulationManager::runInterruptibleSimulation();
+}
+
+// Run the simulation set up by the user
+/*! \details The observer data collected during the inactive cycles will be
+ * discarded. A rendezvous will only be conducted before the first cycle and
+ * after the last cycle.
+ */
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::runSimulation()
+{
+  // Make sure that all objects are initialized before running the simulation
+  Utility::JustInTimeInitializer::getInstance().initializeObjectsAndClear();
+
+  d_comm->barrier();
+
+  if( d_comm->rank() == 0 )
+  {
+    FRENSIE_LOG_NOTIFICATION( "Simulation started. " );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+
+  // Enable thread support
+  this->enableThreadSupport();
+
+  // Create a fission site bank for each thread
+  d_thread_fission_sites.resize( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  for( size_t i = 0; i < d_thread_fission_sites.size(); ++i )
+    d_thread_fission_sites[i] = std::make_shared<FissionSiteBank>();
+
+  // Conduct the first rendezvous (for caching only)
+  if( d_comm->rank() == 0 )
+    ParticleSimulationManager::rendezvous();
+
+  // Reset data on non-root processes to avoid double counting
+  else
+    this->resetData();
+
+  d_comm->barrier();
+
+  // The simulation has started
+  this->registerSimulationStartedEvent();
+
+  d_cycle_multiplication_factors.clear();
+
+  const unsigned number_of_cycles = d_inactive_cycles + d_active_cycles;
+
+  for( d_cycle = 0; d_cycle < number_of_cycles; ++d_cycle )
+  {
+    // End the simulation if requested (from signal handler)
+    if( d_comm->size() == 1 && this->hasEndSimulationRequestBeenMade() )
+      break;
+
+    // Discard the observer data collected during the inactive cycles
+    if( d_cycle == d_inactive_cycles && d_inactive_cycles > 0 )
+      this->resetData();
+
+    this->runCycle();
+
+    if( d_comm->rank() == 0 )
+    {
+      FRENSIE_LOG_NOTIFICATION( "Cycle " << d_cycle+1 << " of "
+                                << number_of_cycles
+                                << (d_cycle < d_inactive_cycles ?
+                                    " (inactive)" : " (active)")
+                                << ": k = "
+                                << d_cycle_multiplication_factors.back() );
+    }
+  }
+
+  // Conduct the final rendezvous
+  this->rendezvous();
+
+  // The simulation has finished
+  this->registerSimulationStoppedEvent();
+
+  if( d_comm->rank() == 0 )
+  {
+    FRENSIE_LOG_NOTIFICATION( "Simulation finished. " );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+
+  d_comm->barrier();
+}
+
+// Run a cycle
+/*! \details Each process simulates a contiguous range of the cycle
+ * histories. The history that follows the last history of the cycle is
+ * reserved for the random number that is used to resample the fission
+ * sites (every process will use the same random number). The fission sites
+ * are also resampled after the last cycle so that the source of the next
+ * cycle is available once the simulation has finished.
+ */
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::runCycle()
+{
+  d_cycle_start_history = this->getNextHistory();
+
+  d_process_start_site =
+    FissionSiteBank::getProcessRangeStart( d_neutrons_per_cycle,
+                                           d_comm->size(),
+                                           d_comm->rank() );
+
+  const uint64_t process_end_site =
+    FissionSiteBank::getProcessRangeStart( d_neutrons_per_cycle,
+                                           d_comm->size(),
+                                           d_comm->rank()+1 );
+
+  for( size_t i = 0; i < d_thread_fission_sites.size(); ++i )
+    d_thread_fission_sites[i]->clear();
+
+  if( d_process_start_site < process_end_site )
+  {
+    this->runSimulationBatch( d_cycle_start_history + d_process_start_site,
+                              d_cycle_start_history + process_end_site );
+  }
+
+  this->collectThreadFissionSites();
+
+  // Calculate the multiplication factor of the cycle
+  d_cycle_multiplication_factors.push_back(
+                d_fission_sites.getTotalWeight( *d_comm )/d_neutrons_per_cycle );
+
+  // Resample the fission sites (the source of the next cycle)
+  Utility::RandomNumberGenerator::initialize( d_cycle_start_history +
+                                              d_neutrons_per_cycle );
+
+  const double random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  d_fission_sites.resample( *d_comm, d_neutrons_per_cycle, random_number );
+
+  this->incrementNextHistory( d_neutrons_per_cycle + 1 );
+}
+
+// Collect the fission sites banked by the threads
+/*! \details The thread banks will be sorted in parallel and then merged.
+ */
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::collectThreadFissionSites()
+{
+  d_fission_sites.clear();
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( size_t i = 0; i < d_thread_fission_sites.size(); ++i )
+    d_thread_fission_sites[i]->sort();
+
+  for( size_t i = 0; i < d_thread_fission_sites.size(); ++i )
+    d_fission_sites.merge( *d_thread_fission_sites[i] );
+}
+
+// Create the particle banks that will be used by a thread
+/*! \details The history bank will store the sites of the fission neutrons
+ * in the fission site bank of the thread. The arena particle bank mode is
+ * not used in power iteration mode.
+ */
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::createThreadParticleBanks(
+                                   std::unique_ptr<ParticleBank>& source_bank,
+                                   std::unique_ptr<ParticleBank>& bank ) const
+{
+  // Make sure that there is a fission site bank for the thread
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_fission_sites.size() );
+
+  source_bank.reset( new ParticleBank );
+  bank.reset( new FissionSiteParticleBank( d_thread_fission_sites[Utility::OpenMPProperties::getThreadId()] ) );
+}
+
+// Sample the source particle states of a history
+/*! \details The source of the first cycle is sampled from the particle
+ * source. The source of every other cycle is created from the resampled
+ * fission sites.
+ */
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::sampleSourceParticleStates(
+                                                     ParticleBank& source_bank,
+                                                     const uint64_t history )
+{
+  if( d_cycle == 0 )
+  {
+    ParticleSimulationManager::sampleSourceParticleStates( source_bank,
+                                                           history );
+  }
+  else
+  {
+    // Make sure that the history has a fission site
+    testPrecondition( history >= d_cycle_start_history + d_process_start_site );
+    testPrecondition( history - d_cycle_start_history - d_process_start_site <
+                      d_fission_sites.size() );
+
+    const FissionSiteBank::Site& site =
+      d_fission_sites[history - d_cycle_start_history - d_process_start_site];
+
+    std::shared_ptr<NeutronState> neutron( new NeutronState( history ) );
+
+    neutron->setSourceEnergy( site.energy );
+    neutron->setEnergy( site.energy );
+    neutron->setSourceWeight( site.weight );
+    neutron->setWeight( site.weight );
+
+    // Embed the neutron in the model (the start cell will be found)
+    neutron->embedInModel( d_unfilled_model, site.position, site.direction );
+    neutron->setSourceCell( neutron->getCell() );
+
+    source_bank.push( neutron );
+  }
+}
+
+// Return the number of completed cycles
+template<ParticleModeType mode>
+unsigned PowerIterationParticleSimulationManager<mode>::getNumberOfCompletedCycles() const
+{
+  return d_cycle_multiplication_factors.size();
+}
+
+// Return the multiplication factor of each completed cycle
+template<ParticleModeType mode>
+const std::vector<double>& PowerIterationParticleSimulationManager<mode>::getCycleMultiplicationFactors() const
+{
+  return d_cycle_multiplication_factors;
+}
+
+// Return the mean multiplication factor of the active cycles
+/*! \details If no active cycles have been completed zero will be returned.
+ */
+template<ParticleModeType mode>
+double PowerIterationParticleSimulationManager<mode>::getMultiplicationFactor() const
+{
+  if( d_cycle_multiplication_factors.size() <= d_inactive_cycles )
+    return 0.0;
+
+  double sum = 0.0;
+
+  for( size_t i = d_inactive_cycles; i < d_cycle_multiplication_factors.size(); ++i )
+    sum += d_cycle_multiplication_factors[i];
+
+  return sum/(d_cycle_multiplication_factors.size() - d_inactive_cycles);
+}
+
+// Return the std dev of the mean multiplication factor
+/*! \details If fewer than two active cycles have been completed zero will be
+ * returned.
+ */
+template<ParticleModeType mode>
+double PowerIterationParticleSimulationManager<mode>::getMultiplicationFactorStandardDeviation() const
+{
+  if( d_cycle_multiplication_factors.size() < d_inactive_cycles + 2 )
+    return 0.0;
+
+  const double number_of_active_cycles =
+    d_cycle_multiplication_factors.size() - d_inactive_cycles;
+
+  const double mean = this->getMultiplicationFactor();
+
+  double sum_of_squared_deviations = 0.0;
+
+  for( size_t i = d_inactive_cycles; i < d_cycle_multiplication_factors.size(); ++i )
+  {
+    const double deviation = d_cycle_multiplication_factors[i] - mean;
+
+    sum_of_squared_deviations += deviation*deviation;
+  }
+
+  return std::sqrt( sum_of_squared_deviations/
+                    (number_of_active_cycles*(number_of_active_cycles-1.0)) );
+}
+
+// Return the fission source of the next cycle assigned to this process
+/*! \details The sites are the resampled sites of the last completed cycle.
+ * The sites assigned to the processes (in rank order) form the globally
+ * ordered fission source.
+ */
+template<ParticleModeType mode>
+const FissionSiteBank& PowerIterationParticleSimulationManager<mode>::getFissionSites() const
+{
+  return d_fission_sites;
+}
+
+// Print the multiplication factor summary
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::printMultiplicationFactorSummary( std::ostream& os ) const
+{
+  const unsigned number_of_active_cycles =
+    d_cycle_multiplication_factors.size() > d_inactive_cycles ?
+    d_cycle_multiplication_factors.size() - d_inactive_cycles : 0;
+
+  os << "Power Iteration: " << d_neutrons_per_cycle << " neutrons/cycle, "
+     << d_inactive_cycles << " inactive cycles, "
+     << number_of_active_cycles << " active cycles\n"
+     << "  k-eigenvalue: " << this->getMultiplicationFactor() << " +/- "
+     << this->getMultiplicationFactorStandardDeviation() << "\n";
+}
+
+// Print the simulation data to the desired stream
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::printSimulationSummary( std::ostream& os ) const
+{
+  if( d_comm->rank() == 0 )
+  {
+    ParticleSimulationManager::printSimulationSummary( os );
+
+    this->printMultiplicationFactorSummary( os );
+  }
+}
+
+// Log the simulation data
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::logSimulationSummary() const
+{
+  if( d_comm->rank() == 0 )
+  {
+    ParticleSimulationManager::logSimulationSummary();
+
+    std::ostringstream oss;
+
+    this->printMultiplicationFactorSummary( oss );
+
+    FRENSIE_LOG_NOTIFICATION( oss.str() );
+  }
+}
+
+// Rendezvous (cache state)
+template<ParticleModeType mode>
+void PowerIterationParticleSimulationManager<mode>::rendezvous()
+{
+  if( d_comm->size() > 1 )
+    this->reduceData( *d_observer_data_reducer, *d_comm, 0 );
+
+  if( d_comm->rank() == 0 )
+    ParticleSimulationManager::rendezvous();
+
+  d_comm->barrier();
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_POWER_ITERATION_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PowerIterationParticleSimulationManager_def.hpp
+//---------------------------------------------------------------------------//
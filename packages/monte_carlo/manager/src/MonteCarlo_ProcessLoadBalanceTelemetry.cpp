@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ProcessLoadBalanceTelemetry.cpp
+//! \author Alex Robinson
+//! \brief  Process load balance telemetry class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_ProcessLoadBalanceTelemetry.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ProcessLoadBalanceTelemetry::ProcessLoadBalanceTelemetry()
+  : d_process_records( 1 )
+{
+  this->reset();
+}
+
+// Set the number of processes (all records will be reset)
+void ProcessLoadBalanceTelemetry::setNumberOfProcesses(
+                                           const unsigned number_of_processes )
+{
+  // Make sure the number of processes is valid
+  testPrecondition( number_of_processes > 0 );
+
+  d_process_records.resize( number_of_processes );
+
+  this->reset();
+}
+
+// Return the number of processes
+unsigned ProcessLoadBalanceTelemetry::getNumberOfProcesses() const
+{
+  return d_process_records.size();
+}
+
+// Reset the records of all processes
+void ProcessLoadBalanceTelemetry::reset()
+{
+  for( size_t i = 0; i < d_process_records.size(); ++i )
+  {
+    ProcessRecord& record = d_process_records[i];
+
+    record.batches = 0;
+    record.histories = 0;
+    record.busy_time = 0.0;
+    record.wall_time = 0.0;
+  }
+}
+
+// Set the record of a process
+void ProcessLoadBalanceTelemetry::setProcessRecord( const unsigned process_id,
+                                                    const uint64_t batches,
+                                                    const uint64_t histories,
+                                                    const double busy_time,
+                                                    const double wall_time )
+{
+  // Make sure the process id is valid
+  testPrecondition( process_id < d_process_records.size() );
+  // Make sure the times are valid
+  testPrecondition( busy_time >= 0.0 );
+  testPrecondition( wall_time >= 0.0 );
+
+  ProcessRecord& record = d_process_records[process_id];
+
+  record.batches = batches;
+  record.histories = histories;
+  record.busy_time = busy_time;
+  record.wall_time = wall_time;
+}
+
+// Return the number of batches completed by a process
+uint64_t ProcessLoadBalanceTelemetry::getNumberOfBatches(
+                                              const unsigned process_id ) const
+{
+  // Make sure the process id is valid
+  testPrecondition( process_id < d_process_records.size() );
+
+  return d_process_records[process_id].batches;
+}
+
+// Return the number of histories completed by a process
+uint64_t ProcessLoadBalanceTelemetry::getNumberOfHistories(
+                                              const unsigned process_id ) const
+{
+  // Make sure the process id is valid
+  testPrecondition( process_id < d_process_records.size() );
+
+  return d_process_records[process_id].histories;
+}
+
+// Return the busy time of a process (s)
+double ProcessLoadBalanceTelemetry::getBusyTime(
+                                              const unsigned process_id ) const
+{
+  // Make sure the process id is valid
+  testPrecondition( process_id < d_process_records.size() );
+
+  return d_process_records[process_id].busy_time;
+}
+
+// Return the wall time of a process (s)
+double ProcessLoadBalanceTelemetry::getWallTime(
+                                              const unsigned process_id ) const
+{
+  // Make sure the process id is valid
+  testPrecondition( process_id < d_process_records.size() );
+
+  return d_process_records[process_id].wall_time;
+}
+
+// Return the utilization of a process (busy time/wall time)
+/*! \details If no wall time has been recorded a value of 0.0 will be
+ * returned.
+ */
+double ProcessLoadBalanceTelemetry::getUtilization(
+                                              const unsigned process_id ) const
+{
+  // Make sure the process id is valid
+  testPrecondition( process_id < d_process_records.size() );
+
+  const ProcessRecord& record = d_process_records[process_id];
+
+  if( record.wall_time > 0.0 )
+    return record.busy_time/record.wall_time;
+  else
+    return 0.0;
+}
+
+// Return the mean utilization of the processes
+double ProcessLoadBalanceTelemetry::getMeanUtilization() const
+{
+  double total_utilization = 0.0;
+
+  for( size_t i = 0; i < d_process_records.size(); ++i )
+    total_utilization += this->getUtilization( i );
+
+  return total_utilization/d_process_records.size();
+}
+
+// Return the load imbalance (max busy time/mean busy time)
+/*! \details A value of 1.0 indicates a perfectly balanced load. If no busy
+ * time has been recorded a value of 1.0 will be returned.
+ */
+double ProcessLoadBalanceTelemetry::getLoadImbalance() const
+{
+  double max_busy_time = 0.0;
+  double total_busy_time = 0.0;
+
+  for( size_t i = 0; i < d_process_records.size(); ++i )
+  {
+    max_busy_time = std::max( max_busy_time, d_process_records[i].busy_time );
+    total_busy_time += d_process_records[i].busy_time;
+  }
+
+  if( total_busy_time > 0.0 )
+    return max_busy_time*d_process_records.size()/total_busy_time;
+  else
+    return 1.0;
+}
+
+// Print the telemetry
+void ProcessLoadBalanceTelemetry::print( std::ostream& os ) const
+{
+  os << "Process load balance: " << d_process_records.size()
+     << " processes, load imbalance " << this->getLoadImbalance()
+     << ", mean utilization " << this->getMeanUtilization() << std::endl;
+
+  for( size_t i = 0; i < d_process_records.size(); ++i )
+  {
+    const ProcessRecord& record = d_process_records[i];
+
+    os << "  Process " << i << ": "
+       << record.batches << " batches, "
+       << record.histories << " histories, "
+       << record.busy_time << " s busy, "
+       << record.wall_time << " s wall (utilization: "
+       << this->getUtilization( i ) << ")" << std::endl;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ProcessLoadBalanceTelemetry.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ProcessLoadBalanceTelemetry.hpp
+//! \author Alex Robinson
+//! \brief  Process load balance telemetry class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_PROCESS_LOAD_BALANCE_TELEMETRY_HPP
+#define MONTE_CARLO_PROCESS_LOAD_BALANCE_TELEMETRY_HPP
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+namespace MonteCarlo{
+
+/*! The process load balance telemetry class
+ *
+ * The number of batches and histories completed by each process of a
+ * distributed simulation, the time that each process spends simulating
+ * histories (busy time) and the wall time of each process are recorded. The
+ * utilization of a process is the fraction of its wall time that it spends
+ * busy.
+ */
+class ProcessLoadBalanceTelemetry
+{
+
+public:
+
+  //! Constructor
+  ProcessLoadBalanceTelemetry();
+
+  //! Destructor
+  ~ProcessLoadBalanceTelemetry()
+  { /* ... */ }
+
+  //! Set the number of processes (all records will be reset)
+  void setNumberOfProcesses( const unsigned number_of_processes );
+
+  //! Return the number of processes
+  unsigned getNumberOfProcesses() const;
+
+  //! Reset the records of all processes
+  void reset();
+
+  //! Set the record of a process
+  void setProcessRecord( const unsigned process_id,
+                         const uint64_t batches,
+                         const uint64_t histories,
+                         const double busy_time,
+                         const double wall_time );
+
+  //! Return the number of batches completed by a process
+  uint64_t getNumberOfBatches( const unsigned process_id ) const;
+
+  //! Return the number of histories completed by a process
+  uint64_t getNumberOfHistories( const unsigned process_id ) const;
+
+  //! Return the busy time of a process (s)
+  double getBusyTime( const unsigned process_id ) const;
+
+  //! Return the wall time of a process (s)
+  double getWallTime( const unsigned process_id ) const;
+
+  //! Return the utilization of a process (busy time/wall time)
+  double getUtilization( const unsigned process_id ) const;
+
+  //! Return the mean utilization of the processes
+  double getMeanUtilization() const;
+
+  //! Return the load imbalance (max busy time/mean busy time)
+  double getLoadImbalance() const;
+
+  //! Print the telemetry
+  void print( std::ostream& os ) const;
+
+private:
+
+  // The record of a process
+  struct ProcessRecord
+  {
+    // The number of batches completed
+    uint64_t batches;
+
+    // The number of histories completed
+    uint64_t histories;
+
+    // The busy time
+    double busy_time;
+
+    // The wall time
+    double wall_time;
+  };
+
+  // The process records
+  std::vector<ProcessRecord> d_process_records;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_PROCESS_LOAD_BALANCE_TELEMETRY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ProcessLoadBalanceTelemetry.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,71 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstAdaptiveBatchSizer.cpp
+//! \author Alex Robinson
+//! \brief  Adaptive batch sizer unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "MonteCarlo_AdaptiveBatchSizer.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the worker throughputs can be recorded
+FRENSIE_UNIT_TEST( AdaptiveBatchSizer, recordWorkerThroughput )
+{
+  MonteCarlo::AdaptiveBatchSizer batch_sizer( 3, 100, 10 );
+
+  FRENSIE_CHECK_EQUAL( batch_sizer.getNumberOfWorkers(), 3 );
+  FRENSIE_CHECK_EQUAL( batch_sizer.getWorkerThroughput( 0 ), 0.0 );
+
+  batch_sizer.recordWorkerThroughput( 0, 50.0 );
+  batch_sizer.recordWorkerThroughput( 2, 150.0 );
+
+  FRENSIE_CHECK_EQUAL( batch_sizer.getWorkerThroughput( 0 ), 50.0 );
+  FRENSIE_CHECK_EQUAL( batch_sizer.getWorkerThroughput( 1 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( batch_sizer.getWorkerThroughput( 2 ), 150.0 );
+
+  // Non-positive throughputs are ignored
+  batch_sizer.recordWorkerThroughput( 0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( batch_sizer.getWorkerThroughput( 0 ), 50.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the batch size can be calculated
+FRENSIE_UNIT_TEST( AdaptiveBatchSizer, calculateBatchSize )
+{
+  MonteCarlo::AdaptiveBatchSizer batch_sizer( 2, 100, 10 );
+
+  // Workers without a measured throughput get the base batch size
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 0, 1000 ), 100 );
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 0, 50 ), 50 );
+
+  // Unmeasured workers are assumed to have the mean throughput
+  batch_sizer.recordWorkerThroughput( 0, 100.0 );
+
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 0, 1000 ), 250 );
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 1, 1000 ), 100 );
+
+  // Batch sizes are proportional to the throughput
+  batch_sizer.recordWorkerThroughput( 1, 300.0 );
+
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 0, 1000 ), 125 );
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 1, 1000 ), 375 );
+
+  // The batch size never drops below the min batch size or exceeds the
+  // remaining histories
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 0, 40 ), 10 );
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 0, 5 ), 5 );
+  FRENSIE_CHECK_EQUAL( batch_sizer.calculateBatchSize( 1, 0 ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstAdaptiveBatchSizer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,367 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFissionSiteBank.cpp
+//! \author Alex Robinson
+//! \brief  Fission site bank unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Create a site
+MonteCarlo::FissionSiteBank::Site createSite( const uint64_t history_number,
+                                              const uint32_t index,
+                                              const double weight )
+{
+  MonteCarlo::FissionSiteBank::Site site;
+  site.history_number = history_number;
+  site.index = index;
+  site.position[0] = 1.0*history_number;
+  site.position[1] = 1.0*index;
+  site.position[2] = 0.0;
+  site.direction[0] = 0.0;
+  site.direction[1] = 0.0;
+  site.direction[2] = 1.0;
+  site.energy = 2.0;
+  site.weight = weight;
+
+  return site;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a bank can be constructed
+FRENSIE_UNIT_TEST( FissionSiteBank, constructor )
+{
+  MonteCarlo::FissionSiteBank bank;
+
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+  FRENSIE_CHECK( bank.isSorted() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the site of a fission neutron can be banked
+FRENSIE_UNIT_TEST( FissionSiteBank, push_neutron )
+{
+  MonteCarlo::FissionSiteBank bank;
+
+  MonteCarlo::NeutronState neutron_a( 3ull );
+  neutron_a.setPosition( 1.0, 2.0, 3.0 );
+  neutron_a.setDirection( 0.0, 1.0, 0.0 );
+  neutron_a.setEnergy( 1.5 );
+  neutron_a.setWeight( 0.5 );
+
+  bank.push( neutron_a );
+  bank.push( neutron_a );
+
+  MonteCarlo::NeutronState neutron_b( 5ull );
+  neutron_b.setEnergy( 2.5 );
+
+  bank.push( neutron_b );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 3 );
+  FRENSIE_CHECK_EQUAL( bank[0].history_number, 3 );
+  FRENSIE_CHECK_EQUAL( bank[0].index, 0 );
+  FRENSIE_CHECK_EQUAL( bank[0].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( bank[0].position[1], 2.0 );
+  FRENSIE_CHECK_EQUAL( bank[0].position[2], 3.0 );
+  FRENSIE_CHECK_EQUAL( bank[0].direction[1], 1.0 );
+  FRENSIE_CHECK_EQUAL( bank[0].energy, 1.5 );
+  FRENSIE_CHECK_EQUAL( bank[0].weight, 0.5 );
+  FRENSIE_CHECK_EQUAL( bank[1].history_number, 3 );
+  FRENSIE_CHECK_EQUAL( bank[1].index, 1 );
+  FRENSIE_CHECK_EQUAL( bank[2].history_number, 5 );
+  FRENSIE_CHECK_EQUAL( bank[2].index, 0 );
+  FRENSIE_CHECK_EQUAL( bank[2].energy, 2.5 );
+  FRENSIE_CHECK_EQUAL( bank[2].weight, 1.0 );
+
+  bank.clear();
+
+  FRENSIE_CHECK( bank.isEmpty() );
+
+  // The site index must restart after the bank has been cleared
+  bank.push( neutron_a );
+
+  FRENSIE_CHECK_EQUAL( bank[0].index, 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sites can be sorted
+FRENSIE_UNIT_TEST( FissionSiteBank, sort )
+{
+  MonteCarlo::FissionSiteBank bank;
+
+  bank.push( createSite( 7, 1, 1.0 ) );
+  bank.push( createSite( 2, 0, 1.0 ) );
+  bank.push( createSite( 7, 0, 1.0 ) );
+  bank.push( createSite( 4, 0, 1.0 ) );
+
+  FRENSIE_CHECK( !bank.isSorted() );
+
+  bank.sort();
+
+  FRENSIE_CHECK( bank.isSorted() );
+  FRENSIE_CHECK_EQUAL( bank[0].history_number, 2 );
+  FRENSIE_CHECK_EQUAL( bank[1].history_number, 4 );
+  FRENSIE_CHECK_EQUAL( bank[2].history_number, 7 );
+  FRENSIE_CHECK_EQUAL( bank[2].index, 0 );
+  FRENSIE_CHECK_EQUAL( bank[3].history_number, 7 );
+  FRENSIE_CHECK_EQUAL( bank[3].index, 1 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the merge order does not change the merged bank
+FRENSIE_UNIT_TEST( FissionSiteBank, merge )
+{
+  MonteCarlo::FissionSiteBank bank_a, bank_b, bank_c, bank_d;
+
+  bank_a.push( createSite( 0, 0, 1.0 ) );
+  bank_a.push( createSite( 3, 0, 1.0 ) );
+  bank_a.push( createSite( 3, 1, 1.0 ) );
+
+  bank_b.push( createSite( 1, 0, 1.0 ) );
+  bank_b.push( createSite( 2, 0, 1.0 ) );
+  bank_b.push( createSite( 4, 0, 1.0 ) );
+
+  bank_c = bank_b;
+  bank_d = bank_a;
+
+  bank_a.merge( bank_b );
+  bank_c.merge( bank_d );
+
+  FRENSIE_CHECK( bank_b.isEmpty() );
+  FRENSIE_CHECK( bank_d.isEmpty() );
+  FRENSIE_REQUIRE_EQUAL( bank_a.size(), 6 );
+  FRENSIE_REQUIRE_EQUAL( bank_c.size(), 6 );
+  FRENSIE_CHECK( bank_a.isSorted() );
+
+  for( size_t i = 0; i < bank_a.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( bank_a[i].history_number, bank_c[i].history_number );
+    FRENSIE_CHECK_EQUAL( bank_a[i].index, bank_c[i].index );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the process ranges can be calculated
+FRENSIE_UNIT_TEST( FissionSiteBank, getProcessRangeStart )
+{
+  FRENSIE_CHECK_EQUAL( MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, 1, 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, 1, 1 ), 10 );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, 4, 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, 4, 1 ), 3 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, 4, 2 ), 6 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, 4, 3 ), 8 );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, 4, 4 ), 10 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the total weight of the sites banked by all processes can be
+// returned
+FRENSIE_UNIT_TEST( FissionSiteBank, getTotalWeight )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  MonteCarlo::FissionSiteBank bank;
+
+  bank.push( createSite( comm->rank(), 0, 0.25 ) );
+  bank.push( createSite( comm->rank(), 1, 0.5 ) );
+
+  FRENSIE_CHECK_EQUAL( bank.getTotalWeight( *comm ), 0.75*comm->size() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sites banked by all processes can be resampled
+FRENSIE_UNIT_TEST( FissionSiteBank, resample )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  // Each process banks a contiguous range of the 10 global sites
+  const uint64_t banked_start =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, comm->size(), comm->rank() );
+  const uint64_t banked_end =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 10, comm->size(), comm->rank()+1 );
+
+  MonteCarlo::FissionSiteBank bank;
+
+  for( uint64_t i = banked_start; i < banked_end; ++i )
+    bank.push( createSite( i, 0, 1.0 ) );
+
+  // Comb teeth: 1, 3, 5, 7, 9
+  bank.resample( *comm, 5, 0.5 );
+
+  const uint64_t owned_start =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 5, comm->size(), comm->rank() );
+  const uint64_t owned_end =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 5, comm->size(), comm->rank()+1 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), owned_end - owned_start );
+
+  for( size_t i = 0; i < bank.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( bank[i].history_number, 2*(owned_start+i)+1 );
+    FRENSIE_CHECK_EQUAL( bank[i].weight, 1.0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that sites with large weights can be selected more than once
+FRENSIE_UNIT_TEST( FissionSiteBank, resample_weighted )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  MonteCarlo::FissionSiteBank bank;
+
+  // Only the first process banks sites: weights 3, 1
+  if( comm->rank() == 0 )
+  {
+    bank.push( createSite( 0, 0, 3.0 ) );
+    bank.push( createSite( 1, 0, 1.0 ) );
+  }
+
+  // Comb teeth: 0.5, 1.5, 2.5, 3.5
+  bank.resample( *comm, 4, 0.5 );
+
+  const uint64_t owned_start =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 4, comm->size(), comm->rank() );
+  const uint64_t owned_end =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 4, comm->size(), comm->rank()+1 );
+
+  FRENSIE_REQUIRE_EQUAL( bank.size(), owned_end - owned_start );
+
+  for( size_t i = 0; i < bank.size(); ++i )
+  {
+    const uint64_t expected_history_number = (owned_start + i < 3 ? 0 : 1);
+
+    FRENSIE_CHECK_EQUAL( bank[i].history_number, expected_history_number );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the resampled sites do not depend on the number of threads and
+// processes that banked them
+FRENSIE_UNIT_TEST( FissionSiteBank, resample_reproducible )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  // Bank the fission neutrons of a history (0, 1 or 2 neutrons with weights
+  // that cannot be summed exactly in floating point)
+  auto bank_history = []( MonteCarlo::FissionSiteBank& bank,
+                          const uint64_t history_number )
+  {
+    for( unsigned i = 0; i < history_number%3; ++i )
+    {
+      MonteCarlo::NeutronState neutron( history_number );
+      neutron.setEnergy( 1.0 + i );
+      neutron.setWeight( 0.1*(history_number%7) + 0.3 );
+
+      bank.push( neutron );
+    }
+  };
+
+  // Every process banks all 1000 histories serially
+  MonteCarlo::FissionSiteBank reference_bank;
+
+  for( uint64_t i = 0; i < 1000; ++i )
+    bank_history( reference_bank, i );
+
+  std::shared_ptr<const Utility::Communicator> reference_comm =
+    comm->split( comm->rank() );
+
+  const double reference_total_weight =
+    reference_bank.getTotalWeight( *reference_comm );
+
+  reference_bank.resample( *reference_comm, 500, 0.25 );
+
+  // Each process banks its range of the histories with all threads
+  const uint64_t history_start =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 1000, comm->size(), comm->rank() );
+  const uint64_t history_end =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 1000, comm->size(), comm->rank()+1 );
+
+  std::vector<MonteCarlo::FissionSiteBank>
+    thread_banks( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  #pragma omp parallel for schedule( dynamic, 7 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( uint64_t i = history_start; i < history_end; ++i )
+    bank_history( thread_banks[Utility::OpenMPProperties::getThreadId()], i );
+
+  MonteCarlo::FissionSiteBank bank;
+
+  for( size_t i = 0; i < thread_banks.size(); ++i )
+  {
+    thread_banks[i].sort();
+    bank.merge( thread_banks[i] );
+  }
+
+  // The site weights are summed with fixed point arithmetic
+  FRENSIE_CHECK_EQUAL( bank.getTotalWeight( *comm ), reference_total_weight );
+
+  bank.resample( *comm, 500, 0.25 );
+
+  const uint64_t owned_start =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 500, comm->size(), comm->rank() );
+  const uint64_t owned_end =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 500, comm->size(), comm->rank()+1 );
+
+  FRENSIE_REQUIRE_EQUAL( reference_bank.size(), 500 );
+  FRENSIE_REQUIRE_EQUAL( bank.size(), owned_end - owned_start );
+
+  for( size_t i = 0; i < bank.size(); ++i )
+  {
+    const MonteCarlo::FissionSiteBank::Site& site = bank[i];
+
+    const MonteCarlo::FissionSiteBank::Site& reference_site =
+      reference_bank[owned_start+i];
+
+    FRENSIE_CHECK_EQUAL( site.history_number, reference_site.history_number );
+    FRENSIE_CHECK_EQUAL( site.index, reference_site.index );
+    FRENSIE_CHECK_EQUAL( site.energy, reference_site.energy );
+    FRENSIE_CHECK_EQUAL( site.weight, reference_site.weight );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstFissionSiteBank.cpp
+//---------------------------------------------------------------------------//
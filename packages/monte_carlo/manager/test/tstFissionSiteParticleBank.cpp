@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFissionSiteParticleBank.cpp
+//! \author Alex Robinson
+//! \brief  Fission site particle bank unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteParticleBank.hpp"
+#include "MonteCarlo_NuclearReactionType.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the fission reactions can be identified
+FRENSIE_UNIT_TEST( FissionSiteParticleBank, isFissionReaction )
+{
+  FRENSIE_CHECK( MonteCarlo::FissionSiteParticleBank::isFissionReaction( MonteCarlo::N__TOTAL_FISSION_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::FissionSiteParticleBank::isFissionReaction( MonteCarlo::N__FISSION_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::FissionSiteParticleBank::isFissionReaction( MonteCarlo::N__N_FISSION_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::FissionSiteParticleBank::isFissionReaction( MonteCarlo::N__2N_FISSION_REACTION ) );
+  FRENSIE_CHECK( MonteCarlo::FissionSiteParticleBank::isFissionReaction( MonteCarlo::N__3N_FISSION_REACTION ) );
+  FRENSIE_CHECK( !MonteCarlo::FissionSiteParticleBank::isFissionReaction( MonteCarlo::N__N_ELASTIC_REACTION ) );
+  FRENSIE_CHECK( !MonteCarlo::FissionSiteParticleBank::isFissionReaction( MonteCarlo::N__2N_REACTION ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the fission neutrons are sent to the fission site bank
+FRENSIE_UNIT_TEST( FissionSiteParticleBank, push_fission_neutron )
+{
+  std::shared_ptr<MonteCarlo::FissionSiteBank>
+    fission_site_bank( new MonteCarlo::FissionSiteBank );
+
+  MonteCarlo::FissionSiteParticleBank bank( fission_site_bank );
+
+  FRENSIE_CHECK_EQUAL( bank.getFissionSiteBank().get(),
+                       fission_site_bank.get() );
+
+  MonteCarlo::NeutronState neutron_a( 1ull );
+  neutron_a.setPosition( 1.0, 2.0, 3.0 );
+  neutron_a.setDirection( 0.0, 0.0, 1.0 );
+  neutron_a.setEnergy( 2.0 );
+
+  bank.push( neutron_a, MonteCarlo::N__FISSION_REACTION );
+
+  std::shared_ptr<MonteCarlo::NeutronState>
+    neutron_b( new MonteCarlo::NeutronState( 1ull ) );
+  neutron_b->setEnergy( 1.0 );
+  neutron_b->setWeight( 0.5 );
+
+  bank.push( neutron_b, MonteCarlo::N__TOTAL_FISSION_REACTION );
+
+  FRENSIE_CHECK( bank.isEmpty() );
+  FRENSIE_REQUIRE_EQUAL( fission_site_bank->size(), 2 );
+  FRENSIE_CHECK_EQUAL( (*fission_site_bank)[0].history_number, 1 );
+  FRENSIE_CHECK_EQUAL( (*fission_site_bank)[0].index, 0 );
+  FRENSIE_CHECK_EQUAL( (*fission_site_bank)[0].position[2], 3.0 );
+  FRENSIE_CHECK_EQUAL( (*fission_site_bank)[0].energy, 2.0 );
+  FRENSIE_CHECK_EQUAL( (*fission_site_bank)[1].history_number, 1 );
+  FRENSIE_CHECK_EQUAL( (*fission_site_bank)[1].index, 1 );
+  FRENSIE_CHECK_EQUAL( (*fission_site_bank)[1].energy, 1.0 );
+  FRENSIE_CHECK_EQUAL( (*fission_site_bank)[1].weight, 0.5 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the neutrons from other reactions are stored in the bank
+FRENSIE_UNIT_TEST( FissionSiteParticleBank, push_neutron )
+{
+  std::shared_ptr<MonteCarlo::FissionSiteBank>
+    fission_site_bank( new MonteCarlo::FissionSiteBank );
+
+  MonteCarlo::FissionSiteParticleBank bank( fission_site_bank );
+
+  MonteCarlo::NeutronState neutron_a( 1ull );
+  neutron_a.setEnergy( 2.0 );
+
+  bank.push( neutron_a, MonteCarlo::N__2N_REACTION );
+
+  std::shared_ptr<MonteCarlo::NeutronState>
+    neutron_b( new MonteCarlo::NeutronState( 1ull ) );
+  neutron_b->setEnergy( 1.0 );
+
+  bank.push( neutron_b, MonteCarlo::N__N_ELASTIC_REACTION );
+
+  // Particles that are not pushed after a reaction are always stored
+  MonteCarlo::PhotonState photon( 1ull );
+
+  bank.push( photon );
+
+  FRENSIE_CHECK( fission_site_bank->isEmpty() );
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 3 );
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 2.0 );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::NEUTRON );
+  FRENSIE_CHECK_EQUAL( bank.top().getEnergy(), 1.0 );
+
+  bank.pop();
+
+  FRENSIE_CHECK_EQUAL( bank.top().getParticleType(), MonteCarlo::PHOTON );
+}
+
+//---------------------------------------------------------------------------//
+// end tstFissionSiteParticleBank.cpp
+//---------------------------------------------------------------------------//
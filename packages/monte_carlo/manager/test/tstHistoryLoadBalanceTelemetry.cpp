@@ -0,0 +1,91 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstHistoryLoadBalanceTelemetry.cpp
+//! \author Alex Robinson
+//! \brief  History load balance telemetry unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryLoadBalanceTelemetry.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the number of threads can be set
+FRENSIE_UNIT_TEST( HistoryLoadBalanceTelemetry, setNumberOfThreads )
+{
+  MonteCarlo::HistoryLoadBalanceTelemetry telemetry;
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfThreads(), 1 );
+
+  telemetry.setNumberOfThreads( 3 );
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfThreads(), 3 );
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfMicroBatches(), 0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getLoadImbalance(), 1.0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getIdleFraction(), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that micro batches can be recorded
+FRENSIE_UNIT_TEST( HistoryLoadBalanceTelemetry, recordMicroBatch )
+{
+  MonteCarlo::HistoryLoadBalanceTelemetry telemetry;
+  telemetry.setNumberOfThreads( 2 );
+
+  telemetry.recordMicroBatch( 0, 10, 3.0, 1.0 );
+  telemetry.recordMicroBatch( 1, 5, 4.0, 0.0 );
+  telemetry.recordMicroBatch( 0, 8, 3.0, 0.5 );
+  telemetry.recordMicroBatch( 1, 7, 2.0, 1.5 );
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfMicroBatches(), 2 );
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfHistories( 0 ), 18 );
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfHistories( 1 ), 12 );
+  FRENSIE_CHECK_EQUAL( telemetry.getBusyTime( 0 ), 6.0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getBusyTime( 1 ), 6.0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getIdleTime( 0 ), 1.5 );
+  FRENSIE_CHECK_EQUAL( telemetry.getIdleTime( 1 ), 1.5 );
+  FRENSIE_CHECK_EQUAL( telemetry.getMaxMicroBatchIdleTime( 0 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getMaxMicroBatchIdleTime( 1 ), 1.5 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( telemetry.getLoadImbalance(), 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( telemetry.getIdleFraction(), 0.2, 1e-15 );
+
+  telemetry.recordMicroBatch( 0, 1, 6.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfMicroBatches(), 3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( telemetry.getLoadImbalance(), 1.2, 1e-15 );
+
+  telemetry.reset();
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfMicroBatches(), 0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfHistories( 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getBusyTime( 1 ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the telemetry can be printed
+FRENSIE_UNIT_TEST( HistoryLoadBalanceTelemetry, print )
+{
+  MonteCarlo::HistoryLoadBalanceTelemetry telemetry;
+  telemetry.setNumberOfThreads( 2 );
+
+  telemetry.recordMicroBatch( 0, 10, 3.0, 1.0 );
+  telemetry.recordMicroBatch( 1, 5, 4.0, 0.0 );
+
+  std::ostringstream oss;
+
+  telemetry.print( oss );
+
+  FRENSIE_CHECK( oss.str().find( "load imbalance" ) != std::string::npos );
+  FRENSIE_CHECK( oss.str().find( "Thread 1" ) != std::string::npos );
+}
+
+//---------------------------------------------------------------------------//
+// end tstHistoryLoadBalanceTelemetry.cpp
+//---------------------------------------------------------------------------//
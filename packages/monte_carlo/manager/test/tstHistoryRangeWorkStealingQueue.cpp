@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstHistoryRangeWorkStealingQueue.cpp
+//! \author Alex Robinson
+//! \brief  History range work stealing queue unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryRangeWorkStealingQueue.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the queue can be constructed
+FRENSIE_UNIT_TEST( HistoryRangeWorkStealingQueue, constructor )
+{
+  MonteCarlo::HistoryRangeWorkStealingQueue queue( 10, 21, 4, 2 );
+
+  FRENSIE_CHECK_EQUAL( queue.getNumberOfThreads(), 4 );
+  FRENSIE_CHECK_EQUAL( queue.getChunkSize(), 2 );
+  FRENSIE_CHECK_EQUAL( queue.getNumberOfRemainingHistories(), 11 );
+  FRENSIE_CHECK_EQUAL( queue.getNumberOfSteals(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a thread acquires chunks from its own range first
+FRENSIE_UNIT_TEST( HistoryRangeWorkStealingQueue, acquireHistories_own_range )
+{
+  // Ranges: [10,13), [13,16), [16,19), [19,21)
+  MonteCarlo::HistoryRangeWorkStealingQueue queue( 10, 21, 4, 2 );
+
+  uint64_t chunk_start, chunk_end;
+
+  FRENSIE_REQUIRE( queue.acquireHistories( 1, chunk_start, chunk_end ) );
+  FRENSIE_CHECK_EQUAL( chunk_start, 13 );
+  FRENSIE_CHECK_EQUAL( chunk_end, 15 );
+
+  FRENSIE_REQUIRE( queue.acquireHistories( 1, chunk_start, chunk_end ) );
+  FRENSIE_CHECK_EQUAL( chunk_start, 15 );
+  FRENSIE_CHECK_EQUAL( chunk_end, 16 );
+
+  FRENSIE_REQUIRE( queue.acquireHistories( 3, chunk_start, chunk_end ) );
+  FRENSIE_CHECK_EQUAL( chunk_start, 19 );
+  FRENSIE_CHECK_EQUAL( chunk_end, 21 );
+
+  FRENSIE_CHECK_EQUAL( queue.getNumberOfRemainingHistories(), 6 );
+  FRENSIE_CHECK_EQUAL( queue.getNumberOfSteals(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a thread steals from the most loaded range
+FRENSIE_UNIT_TEST( HistoryRangeWorkStealingQueue, acquireHistories_steal )
+{
+  // Ranges: [0,8), [8,16)
+  MonteCarlo::HistoryRangeWorkStealingQueue queue( 0, 16, 2, 1 );
+
+  uint64_t chunk_start, chunk_end;
+
+  // Empty the range of thread 0
+  for( unsigned i = 0; i < 8; ++i )
+    FRENSIE_REQUIRE( queue.acquireHistories( 0, chunk_start, chunk_end ) );
+
+  // Thread 1 takes two histories from its range: [10,16) remains
+  FRENSIE_REQUIRE( queue.acquireHistories( 1, chunk_start, chunk_end ) );
+  FRENSIE_REQUIRE( queue.acquireHistories( 1, chunk_start, chunk_end ) );
+
+  // Thread 0 steals the back half of the range of thread 1: [13,16)
+  FRENSIE_REQUIRE( queue.acquireHistories( 0, chunk_start, chunk_end ) );
+  FRENSIE_CHECK_EQUAL( chunk_start, 13 );
+  FRENSIE_CHECK_EQUAL( chunk_end, 14 );
+  FRENSIE_CHECK_EQUAL( queue.getNumberOfSteals(), 1 );
+
+  // Thread 1 keeps the front half: [10,13)
+  FRENSIE_REQUIRE( queue.acquireHistories( 1, chunk_start, chunk_end ) );
+  FRENSIE_CHECK_EQUAL( chunk_start, 10 );
+  FRENSIE_CHECK_EQUAL( chunk_end, 11 );
+
+  FRENSIE_CHECK_EQUAL( queue.getNumberOfRemainingHistories(), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that every history is acquired exactly once by all threads
+FRENSIE_UNIT_TEST( HistoryRangeWorkStealingQueue, acquireHistories_parallel )
+{
+  const unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  MonteCarlo::HistoryRangeWorkStealingQueue queue( 100, 1100, threads, 3 );
+
+  std::vector<int> history_counts( 1000, 0 );
+
+  #pragma omp parallel num_threads( threads )
+  {
+    uint64_t chunk_start, chunk_end;
+
+    while( queue.acquireHistories( Utility::OpenMPProperties::getThreadId(),
+                                   chunk_start,
+                                   chunk_end ) )
+    {
+      for( uint64_t history = chunk_start; history < chunk_end; ++history )
+        ++history_counts[history-100];
+    }
+  }
+
+  FRENSIE_CHECK_EQUAL( history_counts, std::vector<int>( 1000, 1 ) );
+  FRENSIE_CHECK_EQUAL( queue.getNumberOfRemainingHistories(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set up the global OpenMP session
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstHistoryRangeWorkStealingQueue.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstParticleEventQueue.cpp
+//! \author Alex Robinson
+//! \brief  Particle event queue unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleEventQueue.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that particles can be added to the queue
+FRENSIE_UNIT_TEST( ParticleEventQueue, push )
+{
+  MonteCarlo::ParticleEventQueue queue;
+
+  FRENSIE_CHECK( queue.isEmpty() );
+  FRENSIE_CHECK_EQUAL( queue.size(), 0 );
+
+  std::shared_ptr<MonteCarlo::ParticleState>
+    particle( new MonteCarlo::PhotonState( 1ull ) );
+  particle->setPosition( 1.0, 2.0, 3.0 );
+
+  queue.push( particle, true );
+  queue.push( std::shared_ptr<MonteCarlo::ParticleState>( new MonteCarlo::PhotonState( 2ull ) ), false );
+
+  FRENSIE_CHECK( !queue.isEmpty() );
+  FRENSIE_CHECK_EQUAL( queue.size(), 2 );
+  FRENSIE_CHECK_EQUAL( &queue.getParticle( 0 ), particle.get() );
+  FRENSIE_CHECK_EQUAL( queue.getParticle( 1 ).getHistoryNumber(), 2 );
+  FRENSIE_CHECK( queue.isStartingFromSource( 0 ) );
+  FRENSIE_CHECK( !queue.isStartingFromSource( 1 ) );
+  FRENSIE_CHECK( queue.isNewTrackRequired( 0 ) );
+  FRENSIE_CHECK( queue.isNewTrackRequired( 1 ) );
+
+  queue.clear();
+
+  FRENSIE_CHECK( queue.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track of a particle can be started, continued and ended
+FRENSIE_UNIT_TEST( ParticleEventQueue, startNewTrack_continueTrack_endTrack )
+{
+  MonteCarlo::ParticleEventQueue queue;
+
+  std::shared_ptr<MonteCarlo::ParticleState>
+    particle( new MonteCarlo::PhotonState( 1ull ) );
+
+  queue.push( particle, true );
+
+  particle->setPosition( 1.0, 2.0, 3.0 );
+
+  queue.startNewTrack( 0, 2.5 );
+
+  FRENSIE_CHECK( !queue.isNewTrackRequired( 0 ) );
+  FRENSIE_CHECK( queue.isStartingFromSource( 0 ) );
+  FRENSIE_CHECK( !queue.getSubtrackEndingGlobalEventDispatched( 0 ) );
+  FRENSIE_CHECK_EQUAL( queue.getRemainingOpticalPaths()[0], 2.5 );
+  FRENSIE_CHECK_EQUAL( queue.getTrackStartPoint( 0 )[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( queue.getTrackStartPoint( 0 )[1], 2.0 );
+  FRENSIE_CHECK_EQUAL( queue.getTrackStartPoint( 0 )[2], 3.0 );
+
+  queue.continueTrack( 0 );
+
+  FRENSIE_CHECK( !queue.isNewTrackRequired( 0 ) );
+  FRENSIE_CHECK( !queue.isStartingFromSource( 0 ) );
+
+  queue.getSubtrackEndingGlobalEventDispatched( 0 ) = true;
+  queue.endTrack( 0 );
+
+  FRENSIE_CHECK( queue.isNewTrackRequired( 0 ) );
+
+  particle->setPosition( 4.0, 5.0, 6.0 );
+
+  queue.startNewTrack( 0, 1.0 );
+
+  FRENSIE_CHECK( !queue.getSubtrackEndingGlobalEventDispatched( 0 ) );
+  FRENSIE_CHECK_EQUAL( queue.getRemainingOpticalPaths()[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( queue.getTrackStartPoint( 0 )[0], 4.0 );
+  FRENSIE_CHECK_EQUAL( queue.getTrackStartPoint( 0 )[1], 5.0 );
+  FRENSIE_CHECK_EQUAL( queue.getTrackStartPoint( 0 )[2], 6.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the gone particles can be removed from the queue
+FRENSIE_UNIT_TEST( ParticleEventQueue, removeGoneParticles )
+{
+  MonteCarlo::ParticleEventQueue queue;
+
+  for( uint64_t i = 0; i < 5; ++i )
+  {
+    queue.push( std::shared_ptr<MonteCarlo::ParticleState>( new MonteCarlo::PhotonState( i ) ), false );
+
+    queue.startNewTrack( i, i + 0.5 );
+  }
+
+  queue.getParticle( 0 ).setAsGone();
+  queue.getParticle( 2 ).setAsLost();
+  queue.getParticle( 3 ).setAsGone();
+
+  queue.removeGoneParticles();
+
+  FRENSIE_REQUIRE_EQUAL( queue.size(), 2 );
+  FRENSIE_CHECK_EQUAL( queue.getParticle( 0 ).getHistoryNumber(), 1 );
+  FRENSIE_CHECK_EQUAL( queue.getParticle( 1 ).getHistoryNumber(), 4 );
+  FRENSIE_CHECK_EQUAL( queue.getRemainingOpticalPaths()[0], 1.5 );
+  FRENSIE_CHECK_EQUAL( queue.getRemainingOpticalPaths()[1], 4.5 );
+
+  queue.getParticle( 0 ).setAsGone();
+  queue.getParticle( 1 ).setAsGone();
+
+  queue.removeGoneParticles();
+
+  FRENSIE_CHECK( queue.isEmpty() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstParticleEventQueue.cpp
+//---------------------------------------------------------------------------//
@@ -17,12 +17,19 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_EventBasedParticleSimulationManager.hpp"
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_CellPulseHeightEstimator.hpp"
+#include "MonteCarlo_SurfaceCurrentEstimator.hpp"
 #include "MonteCarlo_StandardParticleSource.hpp"
 #include "MonteCarlo_StandardParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardParticleDistribution.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
+#include "Geometry_NativeModel.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "ArchiveTestHelpers.hpp"
 #include "FRENSIE_config.hpp"
@@ -924,6 +931,864 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_wall )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that a simulation can be run with every history schedule
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_schedule )
+{
+  std::vector<MonteCarlo::HistoryScheduleType> schedule_types(
+                              {MonteCarlo::STATIC_HISTORY_SCHEDULE,
+                               MonteCarlo::DYNAMIC_HISTORY_SCHEDULE,
+                               MonteCarlo::GUIDED_HISTORY_SCHEDULE,
+                               MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE} );
+
+  for( auto&& schedule_type : schedule_types )
+  {
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+    {
+      std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+      properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+      properties->setNumberOfHistories( 10 );
+      properties->setHistoryScheduleType( schedule_type );
+      properties->setHistoryScheduleChunkSize( 2 );
+
+      std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+      std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+      {
+        std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+          source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+        source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+      }
+
+      std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+      std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+      factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+      manager = factory->getManager();
+    }
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 10 );
+
+    // Every history must be recorded by exactly one thread
+    const MonteCarlo::HistoryLoadBalanceTelemetry& telemetry =
+      manager->getHistoryLoadBalanceTelemetry();
+
+    uint64_t histories = 0;
+
+    for( unsigned i = 0; i < telemetry.getNumberOfThreads(); ++i )
+    {
+      histories += telemetry.getNumberOfHistories( i );
+
+      FRENSIE_CHECK( telemetry.getBusyTime( i ) >= 0.0 );
+      FRENSIE_CHECK( telemetry.getIdleTime( i ) >= 0.0 );
+    }
+
+    FRENSIE_CHECK_EQUAL( histories, 10 );
+    FRENSIE_CHECK( telemetry.getNumberOfMicroBatches() > 0 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the event-based transport mode tallies agree with the
+// history-based transport mode tallies
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_event_based )
+{
+  std::vector<double> means( 2 ), relative_errors( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    const bool event_based_transport = (i == 1);
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+    {
+      std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+      properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+      properties->setNumberOfHistories( 1000 );
+
+      if( event_based_transport )
+        properties->setEventBasedTransportModeOn();
+
+      std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+      std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+      {
+        std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+          source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+        source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+      }
+
+      event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+      std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+        estimator( new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 {1},
+                                                                 {1.0} ) );
+      estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+      event_handler->addEstimator( estimator );
+
+      std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+      factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+      manager = factory->getManager();
+    }
+
+    FRENSIE_CHECK_EQUAL( (dynamic_cast<MonteCarlo::EventBasedParticleSimulationManager<MonteCarlo::PHOTON_MODE>*>( manager.get() ) != NULL),
+                         event_based_transport );
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 1000 );
+
+    std::vector<double> mean, relative_error, vov, fom;
+
+    event_handler->getEstimator( 0 ).getEntityTotalProcessedData(
+                                        1, mean, relative_error, vov, fom );
+
+    FRENSIE_REQUIRE_EQUAL( mean.size(), 1 );
+
+    means[i] = mean.front();
+    relative_errors[i] = relative_error.front();
+  }
+
+  // The random numbers are consumed in a different order by the two modes so
+  // the tallies can only be compared statistically
+  const double history_based_sigma = means[0]*relative_errors[0];
+  const double event_based_sigma = means[1]*relative_errors[1];
+
+  FRENSIE_CHECK( means[0] > 0.0 );
+  FRENSIE_CHECK( means[1] > 0.0 );
+  FRENSIE_CHECK( std::fabs( means[0] - means[1] ) <=
+                 4.0*std::sqrt( history_based_sigma*history_based_sigma +
+                                event_based_sigma*event_based_sigma ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the event-based transport mode tallies agree with the
+// history-based transport mode tallies in neutron mode
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_event_based_neutron )
+{
+  std::vector<double> means( 2 ), relative_errors( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    const bool event_based_transport = (i == 1);
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+    {
+      std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+      properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+      properties->setNumberOfHistories( 1000 );
+
+      if( event_based_transport )
+        properties->setEventBasedTransportModeOn();
+
+      std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+      std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+      {
+        std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+          source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+        source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+      }
+
+      event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+      std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+        estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 {1},
+                                                                 {1.0} ) );
+      estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+
+      event_handler->addEstimator( estimator );
+
+      std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+      factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+      manager = factory->getManager();
+    }
+
+    FRENSIE_CHECK_EQUAL( (dynamic_cast<MonteCarlo::EventBasedParticleSimulationManager<MonteCarlo::NEUTRON_MODE>*>( manager.get() ) != NULL),
+                         event_based_transport );
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 1000 );
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(), 1000 );
+
+    std::vector<double> mean, relative_error, vov, fom;
+
+    event_handler->getEstimator( 0 ).getEntityTotalProcessedData(
+                                        1, mean, relative_error, vov, fom );
+
+    FRENSIE_REQUIRE_EQUAL( mean.size(), 1 );
+
+    means[i] = mean.front();
+    relative_errors[i] = relative_error.front();
+  }
+
+  const double history_based_sigma = means[0]*relative_errors[0];
+  const double event_based_sigma = means[1]*relative_errors[1];
+
+  FRENSIE_CHECK( means[0] > 0.0 );
+  FRENSIE_CHECK( means[1] > 0.0 );
+  FRENSIE_CHECK( std::fabs( means[0] - means[1] ) <=
+                 4.0*std::sqrt( history_based_sigma*history_based_sigma +
+                                event_based_sigma*event_based_sigma ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the event-based transport mode commits the contributions of
+// each history in a history batch separately
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_event_based_pulse_height )
+{
+  // The histories are not a multiple of the history batch size and the
+  // chunks break up the history batches
+  std::vector<MonteCarlo::HistoryScheduleType> schedule_types(
+                              {MonteCarlo::STATIC_HISTORY_SCHEDULE,
+                               MonteCarlo::WORK_STEALING_HISTORY_SCHEDULE} );
+
+  for( auto&& schedule_type : schedule_types )
+  {
+    for( size_t i = 0; i < 2; ++i )
+    {
+      const bool event_based_transport = (i == 1);
+
+      std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+      std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+      {
+        std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+        properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+        properties->setNumberOfHistories( 150 );
+        properties->setHistoryScheduleType( schedule_type );
+        properties->setHistoryScheduleChunkSize( 3 );
+
+        if( event_based_transport )
+          properties->setEventBasedTransportModeOn();
+
+        std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+        std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+        {
+          std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+            source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+          source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+        }
+
+        event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+        // Every history deposits the source energy (1.0 MeV) in the infinite
+        // medium - a history that is committed together with another history
+        // would land in the second bin
+        std::shared_ptr<MonteCarlo::WeightMultipliedCellPulseHeightEstimator>
+          estimator( new MonteCarlo::WeightMultipliedCellPulseHeightEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 {1} ) );
+        estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+        estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                        std::vector<double>( {0.0, 1.5, 3.0} ) );
+
+        event_handler->addEstimator( estimator );
+
+        std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+        factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+        manager = factory->getManager();
+      }
+
+      FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+      FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 150 );
+      FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(), 150 );
+
+      std::vector<double> mean, relative_error, vov, fom;
+
+      event_handler->getEstimator( 0 ).getEntityBinProcessedData(
+                                        1, mean, relative_error, vov, fom );
+
+      FRENSIE_REQUIRE_EQUAL( mean.size(), 2 );
+      FRENSIE_CHECK_FLOATING_EQUALITY( mean[0], 1.0, 1e-12 );
+      FRENSIE_CHECK_EQUAL( mean[1], 0.0 );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the event-based transport mode reproduces the history-based
+// transport mode tallies exactly when every history has a single particle
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_event_based_reproducible )
+{
+  // Each history in a history batch must draw its random numbers from its
+  // own stream. The tallies are accumulated in the same order by the two
+  // modes when a single thread is used.
+  std::vector<std::vector<double> > means( 2 ), relative_errors( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    const bool event_based_transport = (i == 1);
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+    {
+      std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+      properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+      properties->setNumberOfHistories( 150 );
+
+      if( event_based_transport )
+        properties->setEventBasedTransportModeOn();
+
+      std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+      std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+      {
+        std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+          source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+        source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+      }
+
+      event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+      std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+        estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 {1},
+                                                                 {1.0} ) );
+      estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+      estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                          std::vector<double>( {1e-11, 1e-6, 1e-3, 1.0} ) );
+
+      event_handler->addEstimator( estimator );
+
+      std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+      factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              1 ) );
+
+      manager = factory->getManager();
+    }
+
+    FRENSIE_CHECK_EQUAL( (dynamic_cast<MonteCarlo::EventBasedParticleSimulationManager<MonteCarlo::NEUTRON_MODE>*>( manager.get() ) != NULL),
+                         event_based_transport );
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(), 150 );
+
+    std::vector<double> vov, fom;
+
+    event_handler->getEstimator( 0 ).getEntityBinProcessedData(
+                                   1, means[i], relative_errors[i], vov, fom );
+
+    FRENSIE_REQUIRE_EQUAL( means[i].size(), 3 );
+  }
+
+  FRENSIE_CHECK( means[0][2] > 0.0 );
+  FRENSIE_CHECK_EQUAL( means[1], means[0] );
+  FRENSIE_CHECK_EQUAL( relative_errors[1], relative_errors[0] );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the counter-based random number generator can be used
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   runSimulation_counter_based_random_number_generator )
+{
+  // The random numbers of a history only depend on the history number when
+  // the counter-based generator is used. The tallies are accumulated in the
+  // same order by the two transport modes when a single thread is used.
+  std::vector<std::vector<double> > means( 2 ), relative_errors( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    const bool event_based_transport = (i == 1);
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+    {
+      std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+      properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+      properties->setNumberOfHistories( 150 );
+      properties->setCounterBasedRandomNumberGeneratorModeOn();
+
+      if( event_based_transport )
+        properties->setEventBasedTransportModeOn();
+
+      std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+      std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+      {
+        std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+          source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+        source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+      }
+
+      event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+      std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+        estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 {1},
+                                                                 {1.0} ) );
+      estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::NEUTRON} ) );
+      estimator->setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                          std::vector<double>( {1e-11, 1e-6, 1e-3, 1.0} ) );
+
+      event_handler->addEstimator( estimator );
+
+      std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+      factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              1 ) );
+
+      manager = factory->getManager();
+    }
+
+    FRENSIE_CHECK_EQUAL( (dynamic_cast<MonteCarlo::EventBasedParticleSimulationManager<MonteCarlo::NEUTRON_MODE>*>( manager.get() ) != NULL),
+                         event_based_transport );
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK( Utility::RandomNumberGenerator::isCounterBasedGeneratorUsed() );
+
+    FRENSIE_CHECK_EQUAL( event_handler->getNumberOfCommittedHistories(), 150 );
+
+    std::vector<double> vov, fom;
+
+    event_handler->getEstimator( 0 ).getEntityBinProcessedData(
+                                   1, means[i], relative_errors[i], vov, fom );
+
+    FRENSIE_REQUIRE_EQUAL( means[i].size(), 3 );
+  }
+
+  FRENSIE_CHECK( means[0][2] > 0.0 );
+  FRENSIE_CHECK_EQUAL( means[1], means[0] );
+  FRENSIE_CHECK_EQUAL( relative_errors[1], relative_errors[0] );
+
+  Utility::RandomNumberGenerator::useLinearCongruentialGenerator();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the delta tracking mode tallies agree with the surface tracking
+// mode tallies
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_delta_tracking )
+{
+  std::vector<double> means( 2 ), relative_errors( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    const bool delta_tracking = (i == 1);
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+    {
+      std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+      properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+      properties->setNumberOfHistories( 1000 );
+
+      if( delta_tracking )
+        properties->setDeltaTrackingModeOn();
+
+      std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+      FRENSIE_REQUIRE_EQUAL( model->hasMajorantCrossSection<MonteCarlo::PhotonState>(),
+                             delta_tracking );
+
+      // The majorant cross section must bound the cell cross section
+      if( delta_tracking )
+      {
+        for( double energy : {1e-3, 1e-2, 0.1, 1.0, 10.0} )
+        {
+          FRENSIE_CHECK( model->getMajorantCrossSection<MonteCarlo::PhotonState>( energy ) >=
+                         model->getMacroscopicTotalForwardCrossSection<MonteCarlo::PhotonState>( 1, energy ) );
+        }
+      }
+
+      std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+      {
+        std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+          source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+        source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+      }
+
+      event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+      // Collision estimators do not require surface tracking
+      std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+        estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 {1},
+                                                                 {1.0} ) );
+      estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+      event_handler->addEstimator( estimator );
+
+      FRENSIE_CHECK( !event_handler->hasSurfaceTrackingObservers( MonteCarlo::PHOTON ) );
+
+      std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+      factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+      manager = factory->getManager();
+    }
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 1000 );
+
+    std::vector<double> mean, relative_error, vov, fom;
+
+    event_handler->getEstimator( 0 ).getEntityTotalProcessedData(
+                                        1, mean, relative_error, vov, fom );
+
+    FRENSIE_REQUIRE_EQUAL( mean.size(), 1 );
+
+    means[i] = mean.front();
+    relative_errors[i] = relative_error.front();
+  }
+
+  // The random numbers are consumed in a different order by the two modes so
+  // the tallies can only be compared statistically
+  const double surface_tracking_sigma = means[0]*relative_errors[0];
+  const double delta_tracking_sigma = means[1]*relative_errors[1];
+
+  FRENSIE_CHECK( means[0] > 0.0 );
+  FRENSIE_CHECK( means[1] > 0.0 );
+  FRENSIE_CHECK( std::fabs( means[0] - means[1] ) <=
+                 4.0*std::sqrt( surface_tracking_sigma*surface_tracking_sigma +
+                                delta_tracking_sigma*delta_tracking_sigma ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the condensed history mode tallies agree with the analog mode
+// tallies in a slab
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_condensed_history )
+{
+  // A thin H slab (cell 1) inside of a void sphere (cell 2) - the 1 MeV
+  // source electrons start at the center of the slab and their range is much
+  // larger than the slab thickness so almost every electron will escape
+  std::shared_ptr<Geometry::NativeModel>
+    slab_model( new Geometry::NativeModel( "slab" ) );
+
+  slab_model->addSurface( 1, Geometry::QuadricSurface::createXPlane( -0.005 ) );
+  slab_model->addSurface( 2, Geometry::QuadricSurface::createXPlane( 0.005 ) );
+  slab_model->addSurface( 3, Geometry::QuadricSurface::createSphere( 0.0, 0.0, 0.0, 1.0 ) );
+
+  slab_model->addCell( 1, "1 n -2 n -3" );
+  slab_model->addCell( 2, "-3 n (-1 u 2)" );
+  slab_model->addCell( 3, "3" );
+
+  slab_model->setCellMaterial( 1, 1, -1.0*Geometry::Model::DensityUnit() );
+  slab_model->setTerminationCell( 3 );
+
+  std::shared_ptr<const Geometry::Model> unfilled_slab_model( slab_model );
+
+  std::vector<double> deposition_means( 2 ), deposition_relative_errors( 2 );
+  std::vector<double> current_means( 2 ), current_relative_errors( 2 );
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    const bool condensed_history = (i == 1);
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler;
+
+    {
+      std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+      properties->setParticleMode( MonteCarlo::ELECTRON_MODE );
+      properties->setNumberOfHistories( 1000 );
+
+      // The slab is many elastic mean free paths thick so condensed steps
+      // will be taken in its interior and every boundary crossing will be
+      // ray traced from within the skin
+      if( condensed_history )
+      {
+        properties->setCondensedHistoryModeOn();
+        properties->setCondensedHistoryBoundarySkinDepth( 3.0 );
+      }
+
+      std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_slab_model,
+                                        false ) );
+
+      FRENSIE_REQUIRE_EQUAL( model->FilledElectronGeometryModel::getMaterial( 1 )->hasCondensedHistoryData(),
+                             condensed_history );
+
+      std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+      {
+        std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+          source_component( new MonteCarlo::StandardElectronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_slab_model,
+                                                     particle_distribution ) );
+
+        source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+      }
+
+      event_handler.reset( new MonteCarlo::EventHandler( *properties ) );
+
+      // Energy deposited in the slab
+      std::shared_ptr<MonteCarlo::WeightAndEnergyMultipliedCellPulseHeightEstimator>
+        deposition_estimator( new MonteCarlo::WeightAndEnergyMultipliedCellPulseHeightEstimator(
+                                                                 0,
+                                                                 1.0,
+                                                                 {1} ) );
+      deposition_estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::ELECTRON} ) );
+
+      event_handler->addEstimator( deposition_estimator );
+
+      // Electrons transmitted through the slab faces
+      std::shared_ptr<MonteCarlo::WeightMultipliedSurfaceCurrentEstimator>
+        current_estimator( new MonteCarlo::WeightMultipliedSurfaceCurrentEstimator(
+                                                                 1,
+                                                                 1.0,
+                                                                 {1, 2} ) );
+      current_estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::ELECTRON} ) );
+
+      event_handler->addEstimator( current_estimator );
+
+      std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+      factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+      manager = factory->getManager();
+    }
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 1000 );
+
+    std::vector<double> mean, relative_error, vov, fom;
+
+    event_handler->getEstimator( 0 ).getEntityTotalProcessedData(
+                                        1, mean, relative_error, vov, fom );
+
+    FRENSIE_REQUIRE_EQUAL( mean.size(), 1 );
+
+    deposition_means[i] = mean.front();
+    deposition_relative_errors[i] = relative_error.front();
+
+    event_handler->getEstimator( 1 ).getTotalProcessedData(
+                                           mean, relative_error, vov, fom );
+
+    FRENSIE_REQUIRE_EQUAL( mean.size(), 1 );
+
+    current_means[i] = mean.front();
+    current_relative_errors[i] = relative_error.front();
+  }
+
+  // The two modes sample different random walks so the tallies can only be
+  // compared statistically - the condensed history electrons can only leave
+  // the slab through a boundary crossing in the skin
+  FRENSIE_CHECK( current_means[0] > 0.0 );
+  FRENSIE_CHECK( current_means[1] > 0.0 );
+
+  const double analog_current_sigma =
+    current_means[0]*current_relative_errors[0];
+  const double condensed_current_sigma =
+    current_means[1]*current_relative_errors[1];
+
+  FRENSIE_CHECK( std::fabs( current_means[0] - current_means[1] ) <=
+                 4.0*std::sqrt( analog_current_sigma*analog_current_sigma +
+                                condensed_current_sigma*condensed_current_sigma ) );
+
+  FRENSIE_CHECK( deposition_means[0] > 0.0 );
+  FRENSIE_CHECK( deposition_means[1] > 0.0 );
+
+  const double analog_deposition_sigma =
+    deposition_means[0]*deposition_relative_errors[0];
+  const double condensed_deposition_sigma =
+    deposition_means[1]*deposition_relative_errors[1];
+
+  FRENSIE_CHECK( std::fabs( deposition_means[0] - deposition_means[1] ) <=
+                 4.0*std::sqrt( analog_deposition_sigma*analog_deposition_sigma +
+                                condensed_deposition_sigma*condensed_deposition_sigma ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a simulation can be run
 FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
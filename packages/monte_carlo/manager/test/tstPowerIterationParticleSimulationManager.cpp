@@ -0,0 +1,269 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPowerIterationParticleSimulationManager.cpp
+//! \author Alex Robinson
+//! \brief  The power iteration particle simulation manager unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_PowerIterationParticleSimulationManager.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_IndependentPhaseSpaceDimensionDistribution.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_DeltaDistribution.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using boost::units::cgs::cubic_centimeter;
+using Utility::Units::MeV;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::string test_scattering_center_database_name;
+
+std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+scattering_center_definition_database;
+
+std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+material_definition_database;
+
+std::shared_ptr<const Geometry::Model> unfilled_model;
+
+std::shared_ptr<const MonteCarlo::ParticleDistribution> particle_distribution;
+
+int threads;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a power iteration manager for the U-238 infinite medium
+std::shared_ptr<MonteCarlo::PowerIterationParticleSimulationManager<MonteCarlo::NEUTRON_MODE> >
+createManager( const std::shared_ptr<const Utility::Communicator>& comm,
+               const int number_of_threads,
+               const std::string& simulation_name )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+  properties->setPowerIterationModeOn();
+  properties->setNumberOfNeutronsPerCycle( 100 );
+  properties->setNumberOfInactiveCycles( 1 );
+  properties->setNumberOfActiveCycles( 2 );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  Utility::OpenMPProperties::setNumberOfThreads( number_of_threads );
+
+  return std::make_shared<MonteCarlo::PowerIterationParticleSimulationManager<MonteCarlo::NEUTRON_MODE> >(
+                                   simulation_name,
+                                   "xml",
+                                   model,
+                                   source,
+                                   event_handler,
+                                   MonteCarlo::WeightWindow::getDefault(),
+                                   MonteCarlo::CollisionForcer::getDefault(),
+                                   properties,
+                                   0,
+                                   0,
+                                   true,
+                                   comm );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the power iteration results do not depend on the number of
+// threads and processes
+FRENSIE_UNIT_TEST( PowerIterationParticleSimulationManager,
+                   runSimulation_reproducible )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  // Every process runs the serial (single thread) reference simulation
+  std::shared_ptr<MonteCarlo::PowerIterationParticleSimulationManager<MonteCarlo::NEUTRON_MODE> >
+    reference_manager;
+
+  {
+    std::ostringstream reference_name;
+    reference_name << "test_power_iteration_reference_" << comm->rank();
+
+    reference_manager = createManager( comm->split( comm->rank() ),
+                                       1,
+                                       reference_name.str() );
+  }
+
+  FRENSIE_REQUIRE_NO_THROW( reference_manager->runSimulation() );
+
+  const std::vector<double>& reference_cycle_multiplication_factors =
+    reference_manager->getCycleMultiplicationFactors();
+
+  const MonteCarlo::FissionSiteBank& reference_fission_sites =
+    reference_manager->getFissionSites();
+
+  // Every cycle must bank fission neutrons
+  FRENSIE_REQUIRE_EQUAL( reference_manager->getNumberOfCompletedCycles(), 3 );
+  FRENSIE_CHECK( reference_cycle_multiplication_factors[0] > 0.0 );
+  FRENSIE_CHECK( reference_cycle_multiplication_factors[1] > 0.0 );
+  FRENSIE_CHECK( reference_cycle_multiplication_factors[2] > 0.0 );
+  FRENSIE_REQUIRE_EQUAL( reference_fission_sites.size(), 100 );
+
+  // Run the simulation with all processes and the requested threads
+  std::shared_ptr<MonteCarlo::PowerIterationParticleSimulationManager<MonteCarlo::NEUTRON_MODE> >
+    manager = createManager( comm, threads, "test_power_iteration" );
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_REQUIRE_EQUAL( manager->getNumberOfCompletedCycles(), 3 );
+
+  const MonteCarlo::FissionSiteBank& fission_sites =
+    manager->getFissionSites();
+
+  // The banked site weights are summed with fixed-point arithmetic so the
+  // multiplication factors must be identical
+  FRENSIE_CHECK_EQUAL( manager->getCycleMultiplicationFactors(),
+                       reference_cycle_multiplication_factors );
+
+  // Each process must own its range of the resampled reference sites
+  const uint64_t owned_start =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 100, comm->size(), comm->rank() );
+  const uint64_t owned_end =
+    MonteCarlo::FissionSiteBank::getProcessRangeStart( 100, comm->size(), comm->rank()+1 );
+
+  FRENSIE_REQUIRE_EQUAL( fission_sites.size(), owned_end - owned_start );
+
+  for( size_t i = 0; i < fission_sites.size(); ++i )
+  {
+    const MonteCarlo::FissionSiteBank::Site& site = fission_sites[i];
+
+    const MonteCarlo::FissionSiteBank::Site& reference_site =
+      reference_fission_sites[owned_start+i];
+
+    FRENSIE_CHECK_EQUAL( site.history_number, reference_site.history_number );
+    FRENSIE_CHECK_EQUAL( site.index, reference_site.index );
+    FRENSIE_CHECK_EQUAL( site.position[0], reference_site.position[0] );
+    FRENSIE_CHECK_EQUAL( site.position[1], reference_site.position[1] );
+    FRENSIE_CHECK_EQUAL( site.position[2], reference_site.position[2] );
+    FRENSIE_CHECK_EQUAL( site.direction[0], reference_site.direction[0] );
+    FRENSIE_CHECK_EQUAL( site.direction[1], reference_site.direction[1] );
+    FRENSIE_CHECK_EQUAL( site.direction[2], reference_site.direction[2] );
+    FRENSIE_CHECK_EQUAL( site.energy, reference_site.energy );
+    FRENSIE_CHECK_EQUAL( site.weight, reference_site.weight );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::NuclideProperties& u238_properties =
+      database.getNuclideProperties( 92238 );
+
+    // Set the sattering center definitions
+    scattering_center_definition_database.reset(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+    MonteCarlo::ScatteringCenterDefinition& u238_definition =
+      scattering_center_definition_database->createDefinition( "U238 @ 293.6K", 92238 );
+
+    u238_definition.setNuclearDataProperties(
+          u238_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
+
+    material_definition_database.reset(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+    material_definition_database->addDefinition( "U238 @ 293.6K", 1,
+                                                 {"U238 @ 293.6K"}, {1.0} );
+  }
+
+  unfilled_model.reset(
+           new Geometry::InfiniteMediumModel( 1, 1, -19.1/cubic_centimeter ) );
+
+  // The source neutrons of the first cycle are above the U-238 fission
+  // threshold
+  {
+    std::shared_ptr<MonteCarlo::StandardParticleDistribution>
+      tmp_particle_distribution( new MonteCarlo::StandardParticleDistribution( "test dist" ) );
+
+    std::shared_ptr<MonteCarlo::PhaseSpaceDimensionDistribution>
+      energy_dimension_dist( new MonteCarlo::IndependentPhaseSpaceDimensionDistribution<MonteCarlo::ENERGY_DIMENSION>( std::shared_ptr<const Utility::UnivariateDistribution>( new Utility::DeltaDistribution( 14.0 ) ) ) );
+
+    tmp_particle_distribution->setDimensionDistribution( energy_dimension_dist );
+    tmp_particle_distribution->constructDimensionDistributionDependencyTree();
+
+    particle_distribution = tmp_particle_distribution;
+  }
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstPowerIterationParticleSimulationManager.cpp
+//---------------------------------------------------------------------------//
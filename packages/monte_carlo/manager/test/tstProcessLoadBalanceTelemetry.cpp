@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstProcessLoadBalanceTelemetry.cpp
+//! \author Alex Robinson
+//! \brief  Process load balance telemetry unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_ProcessLoadBalanceTelemetry.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the number of processes can be set
+FRENSIE_UNIT_TEST( ProcessLoadBalanceTelemetry, setNumberOfProcesses )
+{
+  MonteCarlo::ProcessLoadBalanceTelemetry telemetry;
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfProcesses(), 1 );
+
+  telemetry.setNumberOfProcesses( 4 );
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfProcesses(), 4 );
+  FRENSIE_CHECK_EQUAL( telemetry.getUtilization( 3 ), 0.0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getMeanUtilization(), 0.0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getLoadImbalance(), 1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the process records can be set
+FRENSIE_UNIT_TEST( ProcessLoadBalanceTelemetry, setProcessRecord )
+{
+  MonteCarlo::ProcessLoadBalanceTelemetry telemetry;
+  telemetry.setNumberOfProcesses( 2 );
+
+  telemetry.setProcessRecord( 0, 0, 0, 0.0, 10.0 );
+  telemetry.setProcessRecord( 1, 5, 100, 8.0, 10.0 );
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfBatches( 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfBatches( 1 ), 5 );
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfHistories( 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfHistories( 1 ), 100 );
+  FRENSIE_CHECK_EQUAL( telemetry.getBusyTime( 1 ), 8.0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getWallTime( 1 ), 10.0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getUtilization( 0 ), 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( telemetry.getUtilization( 1 ), 0.8, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( telemetry.getMeanUtilization(), 0.4, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( telemetry.getLoadImbalance(), 2.0, 1e-15 );
+
+  telemetry.setProcessRecord( 0, 4, 100, 8.0, 10.0 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( telemetry.getLoadImbalance(), 1.0, 1e-15 );
+
+  telemetry.reset();
+
+  FRENSIE_CHECK_EQUAL( telemetry.getNumberOfHistories( 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( telemetry.getBusyTime( 1 ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the telemetry can be printed
+FRENSIE_UNIT_TEST( ProcessLoadBalanceTelemetry, print )
+{
+  MonteCarlo::ProcessLoadBalanceTelemetry telemetry;
+  telemetry.setNumberOfProcesses( 2 );
+
+  telemetry.setProcessRecord( 1, 5, 100, 8.0, 10.0 );
+
+  std::ostringstream oss;
+
+  telemetry.print( oss );
+
+  FRENSIE_CHECK( oss.str().find( "mean utilization" ) != std::string::npos );
+  FRENSIE_CHECK( oss.str().find( "Process 1" ) != std::string::npos );
+}
+
+//---------------------------------------------------------------------------//
+// end tstProcessLoadBalanceTelemetry.cpp
+//---------------------------------------------------------------------------//
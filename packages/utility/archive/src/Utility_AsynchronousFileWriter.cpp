@@ -0,0 +1,171 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_AsynchronousFileWriter.cpp
+//! \author Alex Robinson
+//! \brief  Asynchronous file writer class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_AsynchronousFileWriter.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_LoggingMacros.hpp"
+
+namespace Utility{
+
+// Constructor
+AsynchronousFileWriter::AsynchronousFileWriter()
+  : d_writer_thread(),
+    d_file_name_with_path(),
+    d_contents(),
+    d_create_contents(),
+    d_write_exception()
+{ /* ... */ }
+
+// Destructor
+/*! \details Exceptions cannot be thrown from the destructor. If the pending
+ * write fails a warning will be logged instead.
+ */
+AsynchronousFileWriter::~AsynchronousFileWriter()
+{
+  try{
+    this->wait();
+  }
+  catch( const std::exception& exception )
+  {
+    FRENSIE_LOG_WARNING( "The asynchronous write failed: "
+                         << exception.what() );
+  }
+}
+
+// Write the contents to the file (asynchronously)
+/*! \details If a write is pending this method will wait for it to finish
+ * before starting the new write. The contents will be moved into the writer.
+ * If the file already exists it will be replaced once the write finishes.
+ */
+void AsynchronousFileWriter::write(
+                            const boost::filesystem::path& file_name_with_path,
+                            std::string&& contents )
+{
+  this->prepareWrite( file_name_with_path );
+
+  d_contents = std::move( contents );
+
+  d_writer_thread = std::thread( &AsynchronousFileWriter::writeBuffer, this );
+}
+
+// Create the contents and write them to the file (asynchronously)
+/*! \details If a write is pending this method will wait for it to finish
+ * before starting the new write. The function will be called by the writer
+ * thread with an empty buffer that it must fill with the contents. Any data
+ * that the function uses must not be modified by the caller until the write
+ * has finished (see AsynchronousFileWriter::wait). An exception thrown by
+ * the function will be handled like any other write failure.
+ */
+void AsynchronousFileWriter::write(
+           const boost::filesystem::path& file_name_with_path,
+           std::function<void(std::string&)>&& create_contents )
+{
+  this->prepareWrite( file_name_with_path );
+
+  d_create_contents = std::move( create_contents );
+
+  d_writer_thread = std::thread( &AsynchronousFileWriter::writeBuffer, this );
+}
+
+// Prepare for a new write
+void AsynchronousFileWriter::prepareWrite(
+                          const boost::filesystem::path& file_name_with_path )
+{
+  this->wait();
+
+  // Verify that the parent directory exists
+  if( file_name_with_path.has_parent_path() )
+  {
+    TEST_FOR_EXCEPTION( !boost::filesystem::exists( file_name_with_path.parent_path() ),
+                        std::runtime_error,
+                        "Cannot write the file "
+                        << file_name_with_path.string() <<
+                        " because the parent directory does not exist!" );
+  }
+
+  d_file_name_with_path = file_name_with_path;
+}
+
+// Check if a write is pending
+bool AsynchronousFileWriter::isWritePending() const
+{
+  return d_writer_thread.joinable();
+}
+
+// Wait for the pending write to finish
+/*! \details If the pending write failed the exception thrown by the writer
+ * thread will be rethrown.
+ */
+void AsynchronousFileWriter::wait()
+{
+  if( d_writer_thread.joinable() )
+    d_writer_thread.join();
+
+  // Release the buffer memory and any data used to create it
+  std::string().swap( d_contents );
+  d_create_contents = nullptr;
+
+  if( d_write_exception )
+  {
+    std::exception_ptr write_exception = d_write_exception;
+
+    d_write_exception = nullptr;
+
+    std::rethrow_exception( write_exception );
+  }
+}
+
+// Write the buffer to the file (called by the writer thread)
+void AsynchronousFileWriter::writeBuffer() noexcept
+{
+  try{
+    if( d_create_contents )
+      d_create_contents( d_contents );
+
+    boost::filesystem::path tmp_file_name_with_path( d_file_name_with_path );
+    tmp_file_name_with_path += ".tmp";
+
+    {
+      std::ofstream file( tmp_file_name_with_path.string(),
+                          std::ofstream::binary | std::ofstream::trunc );
+
+      TEST_FOR_EXCEPTION( !file.good(),
+                          std::runtime_error,
+                          "Could not open the file "
+                          << tmp_file_name_with_path.string() << "!" );
+
+      file.write( d_contents.data(), d_contents.size() );
+      file.close();
+
+      TEST_FOR_EXCEPTION( file.fail(),
+                          std::runtime_error,
+                          "Could not write the file "
+                          << tmp_file_name_with_path.string() << "!" );
+    }
+
+    boost::filesystem::rename( tmp_file_name_with_path,
+                               d_file_name_with_path );
+  }
+  catch( ... )
+  {
+    d_write_exception = std::current_exception();
+  }
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_AsynchronousFileWriter.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_AsynchronousFileWriter.hpp
+//! \author Alex Robinson
+//! \brief  Asynchronous file writer class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_ASYNCHRONOUS_FILE_WRITER_HPP
+#define UTILITY_ASYNCHRONOUS_FILE_WRITER_HPP
+
+// Std Lib Includes
+#include <string>
+#include <thread>
+#include <exception>
+#include <functional>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+
+namespace Utility{
+
+/*! The asynchronous file writer
+ *
+ * This class writes the contents of an in-memory buffer (e.g. an archive
+ * created with Utility::OArchivableObject::saveToBuffer) to a file on a
+ * background thread so that the caller can continue working while the
+ * file is being written. At most one write can be pending at any time -
+ * starting a new write will wait for the pending write to finish, which
+ * limits the memory used by the writer to a single buffer. The buffer is
+ * first written to a temporary file in the same directory, which is then
+ * renamed to the requested file so that a partially written file never
+ * replaces a complete one (e.g. if the program is killed during the write).
+ * Any exception thrown while writing will be rethrown by the next call to
+ * wait (or write). The contents can also be created by a function that will
+ * be called on the background thread right before the file is written, which
+ * allows expensive serialization to overlap with the caller's work too.
+ */
+class AsynchronousFileWriter
+{
+
+public:
+
+  //! Constructor
+  AsynchronousFileWriter();
+
+  //! Destructor (waits for the pending write to finish)
+  ~AsynchronousFileWriter();
+
+  //! Write the contents to the file (asynchronously)
+  void write( const boost::filesystem::path& file_name_with_path,
+              std::string&& contents );
+
+  //! Create the contents and write them to the file (asynchronously)
+  void write( const boost::filesystem::path& file_name_with_path,
+              std::function<void(std::string&)>&& create_contents );
+
+  //! Check if a write is pending
+  bool isWritePending() const;
+
+  //! Wait for the pending write to finish
+  void wait();
+
+private:
+
+  // Copy constructor
+  AsynchronousFileWriter( const AsynchronousFileWriter& that ) = delete;
+
+  // Assignment operator
+  AsynchronousFileWriter& operator=( const AsynchronousFileWriter& that ) = delete;
+
+  // Prepare for a new write
+  void prepareWrite( const boost::filesystem::path& file_name_with_path );
+
+  // Write the buffer to the file (called by the writer thread)
+  void writeBuffer() noexcept;
+
+  // The writer thread
+  std::thread d_writer_thread;
+
+  // The name of the file that is being written
+  boost::filesystem::path d_file_name_with_path;
+
+  // The contents that are being written
+  std::string d_contents;
+
+  // The function that creates the contents (optional)
+  std::function<void(std::string&)> d_create_contents;
+
+  // The exception thrown by the writer thread
+  std::exception_ptr d_write_exception;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_ASYNCHRONOUS_FILE_WRITER_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_AsynchronousFileWriter.hpp
+//---------------------------------------------------------------------------//
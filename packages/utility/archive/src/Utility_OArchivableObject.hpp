@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <string>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -50,12 +51,20 @@ public:
   void saveToFile( const boost::filesystem::path& archive_name_with_path,
                    const bool overwrite = false ) const;
 
+  //! Archive the object to an in-memory buffer
+  void saveToBuffer( const std::string& extension,
+                     std::string& buffer ) const;
+
 protected:
 
   //! Archive the object (implementation)
   virtual void saveToFileImpl( const boost::filesystem::path& archive_name_with_path,
                                const bool overwrite ) const;
 
+  //! Archive the object to an in-memory buffer (implementation)
+  virtual void saveToBufferImpl( const std::string& extension,
+                                 std::string& buffer ) const;
+
   //! Reset the bpos pointer
   template<typename T>
   const boost::archive::detail::basic_pointer_oserializer* resetBposPointer( const std::string& extension ) const;
@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <fstream>
+#include <sstream>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
@@ -35,6 +36,20 @@ void OArchivableObject<DerivedType>::saveToFile(
   this->saveToFileImpl( archive_name_with_path, overwrite );
 }
 
+// Archive the object to an in-memory buffer
+/*! \details The extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin). The buffer contents are identical to the contents
+ * of a file created with saveToFile using the same extension, which allows
+ * the (potentially slow) file write to be done separately. HDF5 archives
+ * cannot be saved to a buffer.
+ */
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::saveToBuffer( const std::string& extension,
+                                                   std::string& buffer ) const
+{
+  this->saveToBufferImpl( extension, buffer );
+}
+
 // Archive the object (implementation)
 /*! \details The file extension will be used to determine the archive type
  * (e.g. .xml, .txt, .bin, .h5fa)
@@ -118,6 +133,48 @@ void OArchivableObject<DerivedType>::saveToFileImpl(
   }
 }
 
+// Archive the object to an in-memory buffer (implementation)
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::saveToBufferImpl(
+                                                 const std::string& extension,
+                                                 std::string& buffer ) const
+{
+  // Initialize the archive ostream here to ensure that it gets deleted
+  // after the archive
+  std::ostringstream oarchive_stream;
+
+  // Create the oarchive
+  if( extension == ".xml" )
+  {
+    boost::archive::xml_oarchive archive( oarchive_stream );
+
+    this->saveToArchive( archive );
+  }
+  else if( extension == ".txt" )
+  {
+    boost::archive::text_oarchive archive( oarchive_stream );
+
+    this->saveToArchive( archive );
+  }
+  else if( extension == ".bin" )
+  {
+    boost::archive::binary_oarchive archive( oarchive_stream );
+
+    this->saveToArchive( archive );
+  }
+  else
+  {
+    THROW_EXCEPTION( std::runtime_error,
+                     "Cannot save the object to a buffer because the "
+                     "extension type (" << extension << ") is not "
+                     "supported!" );
+  }
+
+  // The archives must be destroyed before the buffer is extracted so that
+  // any archive trailers (e.g. xml closing tags) get written
+  buffer = oarchive_stream.str();
+}
+
 // Reset the bpos pointer
 template<typename DerivedType>
 template<typename T>
@@ -0,0 +1,135 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstAsynchronousFileWriter.cpp
+//! \author Alex Robinson
+//! \brief  Asynchronous file writer unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "Utility_AsynchronousFileWriter.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Read the contents of a file
+std::string readFile( const std::string& file_name )
+{
+  std::ifstream file( file_name, std::ifstream::binary );
+
+  std::ostringstream oss;
+  oss << file.rdbuf();
+
+  return oss.str();
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a file can be written asynchronously
+FRENSIE_UNIT_TEST( AsynchronousFileWriter, write )
+{
+  Utility::AsynchronousFileWriter writer;
+
+  FRENSIE_CHECK( !writer.isWritePending() );
+
+  std::string contents( 1000000, 'a' );
+  contents += "end";
+
+  writer.write( "test_async_file.txt", std::string( contents ) );
+
+  FRENSIE_CHECK( writer.isWritePending() );
+  
+  FRENSIE_REQUIRE_NO_THROW( writer.wait() );
+  FRENSIE_CHECK( !writer.isWritePending() );
+  FRENSIE_CHECK( boost::filesystem::exists( "test_async_file.txt" ) );
+  FRENSIE_CHECK( !boost::filesystem::exists( "test_async_file.txt.tmp" ) );
+  FRENSIE_CHECK( readFile( "test_async_file.txt" ) == contents );
+
+  // Consecutive writes to the same file
+  writer.write( "test_async_file.txt", std::string( "first" ) );
+  writer.write( "test_async_file.txt", std::string( "second" ) );
+
+  FRENSIE_REQUIRE_NO_THROW( writer.wait() );
+  FRENSIE_CHECK_EQUAL( readFile( "test_async_file.txt" ), "second" );
+
+  // The destructor must wait for the pending write
+  {
+    Utility::AsynchronousFileWriter tmp_writer;
+
+    tmp_writer.write( "test_async_file_2.txt", std::string( "contents" ) );
+  }
+
+  FRENSIE_CHECK_EQUAL( readFile( "test_async_file_2.txt" ), "contents" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the contents can be created by the writer thread
+FRENSIE_UNIT_TEST( AsynchronousFileWriter, write_created_contents )
+{
+  Utility::AsynchronousFileWriter writer;
+
+  std::thread::id creator_thread_id;
+
+  writer.write( "test_async_file_4.txt",
+                [&creator_thread_id]( std::string& contents ){
+                  creator_thread_id = std::this_thread::get_id();
+                  contents = "created";
+                } );
+
+  FRENSIE_CHECK( writer.isWritePending() );
+
+  FRENSIE_REQUIRE_NO_THROW( writer.wait() );
+  FRENSIE_CHECK( creator_thread_id != std::this_thread::get_id() );
+  FRENSIE_CHECK_EQUAL( readFile( "test_async_file_4.txt" ), "created" );
+
+  // An exception thrown while creating the contents is a write failure
+  writer.write( "test_async_file_4.txt",
+                []( std::string& contents ){
+                  throw std::runtime_error( "bad contents" );
+                } );
+
+  FRENSIE_CHECK_THROW( writer.wait(), std::runtime_error );
+  FRENSIE_CHECK_EQUAL( readFile( "test_async_file_4.txt" ), "created" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that write errors are reported
+FRENSIE_UNIT_TEST( AsynchronousFileWriter, write_error )
+{
+  Utility::AsynchronousFileWriter writer;
+
+  FRENSIE_CHECK_THROW( writer.write( "dummy_dir/test_async_file.txt",
+                                     std::string( "contents" ) ),
+                       std::runtime_error );
+
+  FRENSIE_CHECK( !writer.isWritePending() );
+
+  // The parent "directory" is a file
+  {
+    std::ofstream file( "test_async_file_3.txt" );
+    file << "contents";
+  }
+  
+  writer.write( "test_async_file_3.txt/test_async_file.txt",
+                std::string( "contents" ) );
+
+  FRENSIE_CHECK_THROW( writer.wait(), std::exception );
+
+  // The exception is only reported once
+  FRENSIE_CHECK_NO_THROW( writer.wait() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstAsynchronousFileWriter.cpp
+//---------------------------------------------------------------------------//
@@ -12,6 +12,9 @@
 // Std Lib Includes
 #include <functional>
 #include <iostream>
+#include <deque>
+#include <vector>
+#include <exception>
 
 // Boost Includes
 #include <boost/function.hpp>
@@ -47,6 +50,15 @@ public:
   //! Check if an exception will be thrown on dirty convergence
   bool isExceptionThrownOnDirtyConvergence() const;
 
+  //! Evaluate the midpoints of each refinement sweep in parallel
+  void setParallelRefinementModeOn();
+
+  //! Evaluate the midpoints one at a time (default)
+  void setParallelRefinementModeOff();
+
+  //! Check if the midpoints of each refinement sweep are evaluated in parallel
+  bool isParallelRefinementModeOn() const;
+
   //! Set the convergence tolerance
   void setConvergenceTolerance( const double convergence_tol );
 
@@ -126,6 +138,55 @@ public:
 
 private:
 
+  // A grid interval that is being refined
+  struct GridInterval
+  {
+    // The lower grid point
+    double lower_grid_point;
+
+    // The upper grid point
+    double upper_grid_point;
+
+    // The function value at the lower grid point
+    double lower_function_value;
+
+    // The function value at the upper grid point
+    double upper_function_value;
+  };
+
+  // Refine the grid between the min and max values one midpoint at a time
+  template<typename STLCompliantContainerA,
+           typename STLCompliantContainerB,
+           typename Functor>
+  void refineAndEvaluateSerially( STLCompliantContainerA& grid,
+                                  STLCompliantContainerB& evaluated_function,
+                                  const Functor& function,
+                                  std::deque<double>& lower_grid_queue,
+                                  const double min_value,
+                                  std::deque<double>& grid_queue,
+                                  std::deque<double>& upper_grid_queue ) const;
+
+  // Refine the grid between the min and max values in parallel sweeps
+  template<typename STLCompliantContainerA,
+           typename STLCompliantContainerB,
+           typename Functor>
+  void refineAndEvaluateInParallel(
+                               STLCompliantContainerA& grid,
+                               STLCompliantContainerB& evaluated_function,
+                               const Functor& function,
+                               const std::deque<double>& lower_grid_queue,
+                               const double min_value,
+                               const std::deque<double>& grid_queue,
+                               const std::deque<double>& upper_grid_queue ) const;
+
+  // Evaluate the function at every grid point in parallel
+  template<typename Functor>
+  static void evaluateInParallel(
+                       const Functor& function,
+                       const std::vector<double>& grid_points,
+                       std::vector<double>& function_values,
+                       std::vector<std::exception_ptr>& function_exceptions );
+
   // Check for convergence
   bool hasGridConverged( const double lower_grid_point,
                          const double mid_grid_point,
@@ -144,6 +205,9 @@ private:
 
   // Throw exception on dirty convergence
   bool d_throw_exceptions;
+
+  // Evaluate the midpoints of each refinement sweep in parallel
+  bool d_parallel_refinement_mode_on;
 };
 
 } // end Utility namespace
@@ -13,6 +13,8 @@
 #include <deque>
 #include <iterator>
 #include <sstream>
+#include <algorithm>
+#include <limits>
 
 // FRENSIE Includes
 #include "Utility_DesignByContract.hpp"
@@ -22,6 +24,7 @@
 #include "Utility_SearchAlgorithms.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_ExplicitTemplateInstantiationMacros.hpp"
 
 namespace Utility{
@@ -34,7 +37,8 @@ GridGenerator<InterpPolicy>::GridGenerator( const double convergence_tol,
   : d_convergence_tol( convergence_tol ),
     d_absolute_diff_tol( absolute_diff_tol ),
     d_distance_tol( distance_tol ),
-    d_throw_exceptions( false )
+    d_throw_exceptions( false ),
+    d_parallel_refinement_mode_on( false )
 {
   // Make sure the convergence tolerance is valid
   testPrecondition( convergence_tol <= 1.0 );
@@ -78,6 +82,39 @@ bool GridGenerator<InterpPolicy>::isExceptionThrownOnDirtyConvergence() const
   return d_throw_exceptions;
 }
 
+// Evaluate the midpoints of each refinement sweep in parallel
+/*! \details In parallel refinement mode the grid is refined in sweeps. The
+ * midpoints of all intervals that have not converged yet are evaluated
+ * concurrently using the number of threads requested through
+ * Utility::OpenMPProperties, and each function value is computed only once.
+ * The function must therefore be safe to call from multiple threads. The
+ * generated grids are identical to the grids generated in serial refinement
+ * mode because the convergence of an interval only depends on its end points.
+ * If dirty convergence occurs (and exceptions are thrown), the exception
+ * associated with the lowest interval is thrown, which is the exception that
+ * would be thrown in serial refinement mode. When dirty convergence warnings
+ * are emitted instead, they are ordered by sweep instead of by interval.
+ */
+template<typename InterpPolicy>
+void GridGenerator<InterpPolicy>::setParallelRefinementModeOn()
+{
+  d_parallel_refinement_mode_on = true;
+}
+
+// Evaluate the midpoints one at a time (default)
+template<typename InterpPolicy>
+void GridGenerator<InterpPolicy>::setParallelRefinementModeOff()
+{
+  d_parallel_refinement_mode_on = false;
+}
+
+// Check if the midpoints of each refinement sweep are evaluated in parallel
+template<typename InterpPolicy>
+bool GridGenerator<InterpPolicy>::isParallelRefinementModeOn() const
+{
+  return d_parallel_refinement_mode_on;
+}
+
 // Set the convergence tolerance
 template<typename InterpPolicy>
 void GridGenerator<InterpPolicy>::setConvergenceTolerance(
@@ -286,14 +323,62 @@ void GridGenerator<InterpPolicy>::refineAndEvaluateInPlace(
   grid.clear();
   evaluated_function.clear();
 
+  if( d_parallel_refinement_mode_on )
+  {
+    this->refineAndEvaluateInParallel( grid,
+                                       evaluated_function,
+                                       function,
+                                       min_value_queue,
+                                       min_value,
+                                       grid_queue,
+                                       max_value_queue );
+  }
+  else
+  {
+    this->refineAndEvaluateSerially( grid,
+                                     evaluated_function,
+                                     function,
+                                     min_value_queue,
+                                     min_value,
+                                     grid_queue,
+                                     max_value_queue );
+  }
+
+  // Make sure the linearized grid has at least 2 points
+  testPostcondition( grid.size() >= 2 );
+  testPostcondition( grid.size() == evaluated_function.size() );
+  // Make sure the linearized grid is sorted
+  testPostcondition( Sort::isSortedAscending( grid.begin(), grid.end() ) );
+}
+
+// Refine the grid between the min and max values one midpoint at a time
+/*! \details The grid points in the lower grid queue and the upper grid queue
+ * are only evaluated. The grid points in the grid queue (which must end with
+ * the max value) are refined. The function values at the points at the front
+ * of the grid queue are cached so that the function is only evaluated once
+ * at every grid point.
+ */
+template<typename InterpPolicy>
+template<typename STLCompliantContainerA,
+         typename STLCompliantContainerB,
+         typename Functor>
+void GridGenerator<InterpPolicy>::refineAndEvaluateSerially(
+                                    STLCompliantContainerA& grid,
+                                    STLCompliantContainerB& evaluated_function,
+                                    const Functor& function,
+                                    std::deque<double>& lower_grid_queue,
+                                    const double min_value,
+                                    std::deque<double>& grid_queue,
+                                    std::deque<double>& upper_grid_queue ) const
+{
   // Variables used to calculate the linearized grid
   double x0, x1, x_mid, y0, y1, y_mid_exact, y_mid_estimated;
 
   // Evaluate the grid point before the min value
-  while( !min_value_queue.empty() )
+  while( !lower_grid_queue.empty() )
   {
-    x0 = min_value_queue.front();
-    min_value_queue.pop_front();
+    x0 = lower_grid_queue.front();
+    lower_grid_queue.pop_front();
 
     y0 = function( x0 );
 
@@ -305,6 +390,10 @@ void GridGenerator<InterpPolicy>::refineAndEvaluateInPlace(
   x0 = min_value;
   y0 = function( x0 );
 
+  // The function values at the first grid_queue_values.size() points in the
+  // grid queue (midpoints are always added to the front of the grid queue)
+  std::deque<double> grid_queue_values;
+
   // Calculate the grid points
   while( !grid_queue.empty() )
   {
@@ -314,7 +403,10 @@ void GridGenerator<InterpPolicy>::refineAndEvaluateInPlace(
                                      0.5*(InterpPolicy::processIndepVar(x0) +
                                           InterpPolicy::processIndepVar(x1)) );
 
-    y1 = function( x1 );
+    if( grid_queue_values.empty() )
+      grid_queue_values.push_front( function( x1 ) );
+
+    y1 = grid_queue_values.front();
     y_mid_exact = function( x_mid );
 
     y_mid_estimated = InterpPolicy::interpolate( x0, x1, x_mid, y0, y1 );
@@ -332,35 +424,251 @@ void GridGenerator<InterpPolicy>::refineAndEvaluateInPlace(
       grid_queue.pop_front();
 
       y0 = y1;
+      grid_queue_values.pop_front();
     }
     // Refine the grid
     else
+    {
       grid_queue.push_front( x_mid );
+      grid_queue_values.push_front( y_mid_exact );
+    }
   }
 
   // Add the last point to the linearized grid
   grid.push_back( x0 );
   evaluated_function.push_back( y0 );
 
-  testPostcondition( x0 = max_value );
-
   // Evaluate the grid point after the max value
-  while( !max_value_queue.empty() )
+  while( !upper_grid_queue.empty() )
   {
-    x0 = max_value_queue.front();
-    max_value_queue.pop_front();
+    x0 = upper_grid_queue.front();
+    upper_grid_queue.pop_front();
 
     y0 = function( x0 );
 
     grid.push_back( x0 );
     evaluated_function.push_back( y0 );
   }
+}
 
-  // Make sure the linearized grid has at least 2 points
-  testPostcondition( grid.size() >= 2 );
-  testPostcondition( grid.size() == evaluated_function.size() );
-  // Make sure the linearized grid is sorted
-  testPostcondition( Sort::isSortedAscending( grid.begin(), grid.end() ) );
+// Refine the grid between the min and max values in parallel sweeps
+/*! \details The grid points in the lower grid queue and the upper grid queue
+ * are only evaluated. The grid points in the grid queue (which must end with
+ * the max value) are refined. In every sweep the midpoints of all intervals
+ * that have not converged are evaluated concurrently. Intervals that have not
+ * converged are split at their midpoints for the next sweep (the function
+ * values at the midpoints are reused). Because the convergence of an interval
+ * only depends on the interval end points, the converged intervals are the
+ * same intervals that would be found by the serial refinement.
+ */
+template<typename InterpPolicy>
+template<typename STLCompliantContainerA,
+         typename STLCompliantContainerB,
+         typename Functor>
+void GridGenerator<InterpPolicy>::refineAndEvaluateInParallel(
+                              STLCompliantContainerA& grid,
+                              STLCompliantContainerB& evaluated_function,
+                              const Functor& function,
+                              const std::deque<double>& lower_grid_queue,
+                              const double min_value,
+                              const std::deque<double>& grid_queue,
+                              const std::deque<double>& upper_grid_queue ) const
+{
+  // Evaluate the function at all of the initial grid points concurrently
+  std::vector<double> initial_grid_points( lower_grid_queue.begin(),
+                                           lower_grid_queue.end() );
+
+  const size_t min_value_index = initial_grid_points.size();
+
+  initial_grid_points.push_back( min_value );
+  initial_grid_points.insert( initial_grid_points.end(),
+                              grid_queue.begin(),
+                              grid_queue.end() );
+
+  const size_t max_value_index = initial_grid_points.size() - 1;
+
+  initial_grid_points.insert( initial_grid_points.end(),
+                              upper_grid_queue.begin(),
+                              upper_grid_queue.end() );
+
+  std::vector<double> initial_function_values;
+  std::vector<std::exception_ptr> initial_function_exceptions;
+
+  GridGenerator<InterpPolicy>::evaluateInParallel(
+                                                 function,
+                                                 initial_grid_points,
+                                                 initial_function_values,
+                                                 initial_function_exceptions );
+
+  for( size_t i = 0; i < initial_function_exceptions.size(); ++i )
+  {
+    if( initial_function_exceptions[i] )
+      std::rethrow_exception( initial_function_exceptions[i] );
+  }
+
+  // Create the initial intervals
+  std::vector<GridInterval> intervals( max_value_index - min_value_index );
+
+  for( size_t i = 0; i < intervals.size(); ++i )
+  {
+    intervals[i].lower_grid_point = initial_grid_points[min_value_index+i];
+    intervals[i].upper_grid_point = initial_grid_points[min_value_index+i+1];
+    intervals[i].lower_function_value =
+      initial_function_values[min_value_index+i];
+    intervals[i].upper_function_value =
+      initial_function_values[min_value_index+i+1];
+  }
+
+  std::vector<GridInterval> converged_intervals;
+
+  // The lowest interval that could not be converged (the serial refinement
+  // would stop at this interval - the intervals above it can be ignored)
+  double failed_interval_lower_grid_point =
+    std::numeric_limits<double>::infinity();
+
+  std::exception_ptr failed_interval_exception;
+
+  // Refine the intervals
+  std::vector<double> midpoints, midpoint_values;
+  std::vector<std::exception_ptr> midpoint_exceptions;
+  std::vector<GridInterval> refined_intervals;
+
+  while( !intervals.empty() )
+  {
+    midpoints.resize( intervals.size() );
+
+    for( size_t i = 0; i < intervals.size(); ++i )
+    {
+      midpoints[i] = InterpPolicy::recoverProcessedIndepVar(
+             0.5*(InterpPolicy::processIndepVar(intervals[i].lower_grid_point) +
+                  InterpPolicy::processIndepVar(intervals[i].upper_grid_point)) );
+    }
+
+    GridGenerator<InterpPolicy>::evaluateInParallel( function,
+                                                     midpoints,
+                                                     midpoint_values,
+                                                     midpoint_exceptions );
+
+    refined_intervals.clear();
+
+    for( size_t i = 0; i < intervals.size(); ++i )
+    {
+      const GridInterval& interval = intervals[i];
+
+      if( interval.lower_grid_point > failed_interval_lower_grid_point )
+        break;
+
+      bool converged;
+
+      try{
+        if( midpoint_exceptions[i] )
+          std::rethrow_exception( midpoint_exceptions[i] );
+
+        const double y_mid_estimated =
+          InterpPolicy::interpolate( interval.lower_grid_point,
+                                     interval.upper_grid_point,
+                                     midpoints[i],
+                                     interval.lower_function_value,
+                                     interval.upper_function_value );
+
+        converged = this->hasGridConverged( interval.lower_grid_point,
+                                            midpoints[i],
+                                            interval.upper_grid_point,
+                                            y_mid_estimated,
+                                            midpoint_values[i] );
+      }
+      catch( ... )
+      {
+        failed_interval_lower_grid_point = interval.lower_grid_point;
+        failed_interval_exception = std::current_exception();
+
+        break;
+      }
+
+      // Keep the interval
+      if( converged )
+        converged_intervals.push_back( interval );
+
+      // Split the interval at the midpoint
+      else
+      {
+        GridInterval lower_interval = {interval.lower_grid_point,
+                                       midpoints[i],
+                                       interval.lower_function_value,
+                                       midpoint_values[i]};
+
+        GridInterval upper_interval = {midpoints[i],
+                                       interval.upper_grid_point,
+                                       midpoint_values[i],
+                                       interval.upper_function_value};
+
+        refined_intervals.push_back( lower_interval );
+        refined_intervals.push_back( upper_interval );
+      }
+    }
+
+    intervals.swap( refined_intervals );
+  }
+
+  if( failed_interval_exception )
+    std::rethrow_exception( failed_interval_exception );
+
+  // Order the converged intervals
+  std::sort( converged_intervals.begin(),
+             converged_intervals.end(),
+             []( const GridInterval& a, const GridInterval& b ){
+               return a.lower_grid_point < b.lower_grid_point; } );
+
+  // Construct the grid
+  for( size_t i = 0; i < min_value_index; ++i )
+  {
+    grid.push_back( initial_grid_points[i] );
+    evaluated_function.push_back( initial_function_values[i] );
+  }
+
+  for( size_t i = 0; i < converged_intervals.size(); ++i )
+  {
+    grid.push_back( converged_intervals[i].lower_grid_point );
+    evaluated_function.push_back( converged_intervals[i].lower_function_value );
+  }
+
+  grid.push_back( initial_grid_points[max_value_index] );
+  evaluated_function.push_back( initial_function_values[max_value_index] );
+
+  for( size_t i = max_value_index+1; i < initial_grid_points.size(); ++i )
+  {
+    grid.push_back( initial_grid_points[i] );
+    evaluated_function.push_back( initial_function_values[i] );
+  }
+}
+
+// Evaluate the function at every grid point in parallel
+/*! \details Exceptions cannot propagate out of a parallel region. The
+ * exception thrown at each grid point (if any) will be stored.
+ */
+template<typename InterpPolicy>
+template<typename Functor>
+void GridGenerator<InterpPolicy>::evaluateInParallel(
+                        const Functor& function,
+                        const std::vector<double>& grid_points,
+                        std::vector<double>& function_values,
+                        std::vector<std::exception_ptr>& function_exceptions )
+{
+  function_values.resize( grid_points.size() );
+
+  function_exceptions.assign( grid_points.size(), std::exception_ptr() );
+
+  #pragma omp parallel for num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() ) schedule( dynamic, 1 )
+  for( size_t i = 0; i < grid_points.size(); ++i )
+  {
+    try{
+      function_values[i] = function( grid_points[i] );
+    }
+    catch( ... )
+    {
+      function_exceptions[i] = std::current_exception();
+    }
+  }
 }
 
 // Generate the grid in place (return evaluated function on grid)
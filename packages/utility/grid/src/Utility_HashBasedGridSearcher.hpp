@@ -40,6 +40,12 @@ public:
   //! Return the index of the lower bin boundary that a value falls in
   virtual size_t findLowerBinIndexIncludingUpperBound( const ValueType value ) const = 0;
 
+  //! Return the number of grid points
+  virtual size_t getNumberOfGridPoints() const = 0;
+
+  //! Return the grid point at the desired index
+  virtual ValueType getGridPoint( const size_t index ) const = 0;
+
 private:
 
   // Save the searcher to an archive
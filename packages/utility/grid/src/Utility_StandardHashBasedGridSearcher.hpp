@@ -77,6 +77,12 @@ public:
   //! Return the index of the lower bin boundary that a value falls in
   size_t findLowerBinIndexIncludingUpperBound( const ValueType value ) const override;
 
+  //! Return the number of grid points
+  size_t getNumberOfGridPoints() const override;
+
+  //! Return the grid point at the desired index
+  ValueType getGridPoint( const size_t index ) const override;
+
 private:
 
   // Default Constructor
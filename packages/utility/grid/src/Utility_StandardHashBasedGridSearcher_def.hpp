@@ -152,6 +152,10 @@ public:
   //! Process a value
   static inline T processValue( const T value )
   { return std::log( value ); }
+
+  //! Unprocess a value
+  static inline T unprocessValue( const T value )
+  { return std::exp( value ); }
 };
 
 //! Specialization of StandardHashBasedGridSearcherHelper for raw grids
@@ -209,6 +213,10 @@ public:
   static inline T processValue( const T value )
   { return value; }
 
+  //! Unprocess a value
+  static inline T unprocessValue( const T value )
+  { return value; }
+
 private:
 
   //! Check if a grid element is <= 0
@@ -371,6 +379,27 @@ StandardHashBasedGridSearcher<STLCompliantArray,processed_grid>::findLowerBinInd
     return index;
 }
 
+// Return the number of grid points
+template<typename STLCompliantArray,bool processed_grid>
+inline size_t StandardHashBasedGridSearcher<STLCompliantArray,processed_grid>::getNumberOfGridPoints() const
+{
+  return d_grid->size();
+}
+
+// Return the grid point at the desired index
+/*! \details If the grid has been processed the grid point will be
+ * unprocessed before it is returned.
+ */
+template<typename STLCompliantArray,bool processed_grid>
+inline auto StandardHashBasedGridSearcher<STLCompliantArray,processed_grid>::getGridPoint(
+                                       const size_t index ) const -> ValueType
+{
+  // Make sure the index is valid
+  testPrecondition( index < d_grid->size() );
+
+  return Details::StandardHashBasedGridSearcherHelper<ValueType,processed_grid>::unprocessValue( (*d_grid)[index] );
+}
+
 // Test if a value falls within the bounds of the grid
 template<typename STLCompliantArray,bool processed_grid>
 void StandardHashBasedGridSearcher<STLCompliantArray,processed_grid>::initializeHashGrid()
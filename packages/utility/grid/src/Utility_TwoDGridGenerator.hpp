@@ -59,6 +59,15 @@ public:
   //! Check if an exception will be thrown on dirty convergence
   bool isExceptionThrownOnDirtyConvergence() const;
 
+  //! Evaluate the secondary grid refinement midpoints in parallel
+  void setParallelRefinementModeOn();
+
+  //! Evaluate the secondary grid refinement midpoints serially (default)
+  void setParallelRefinementModeOff();
+
+  //! Check if the secondary grid refinement midpoints are evaluated in parallel
+  bool isParallelRefinementModeOn() const;
+
   //! Set the convergence tolerance
   void setConvergenceTolerance( const double convergence_tol );
 
@@ -109,6 +109,31 @@ bool TwoDGridGenerator<TwoDInterpPolicy>::isExceptionThrownOnDirtyConvergence()
   return d_throw_exceptions;
 }
 
+// Evaluate the secondary grid refinement midpoints in parallel
+/*! \details The secondary grid evaluation functor must be safe to call from
+ * multiple threads (see
+ * Utility::GridGenerator::setParallelRefinementModeOn).
+ */
+template<typename TwoDInterpPolicy>
+void TwoDGridGenerator<TwoDInterpPolicy>::setParallelRefinementModeOn()
+{
+  d_secondary_grid_generator.setParallelRefinementModeOn();
+}
+
+// Evaluate the secondary grid refinement midpoints serially (default)
+template<typename TwoDInterpPolicy>
+void TwoDGridGenerator<TwoDInterpPolicy>::setParallelRefinementModeOff()
+{
+  d_secondary_grid_generator.setParallelRefinementModeOff();
+}
+
+// Check if the secondary grid refinement midpoints are evaluated in parallel
+template<typename TwoDInterpPolicy>
+bool TwoDGridGenerator<TwoDInterpPolicy>::isParallelRefinementModeOn() const
+{
+  return d_secondary_grid_generator.isParallelRefinementModeOn();
+}
+
 // Set the convergence tolerance
 template<typename TwoDInterpPolicy>
 void TwoDGridGenerator<TwoDInterpPolicy>::setConvergenceTolerance(
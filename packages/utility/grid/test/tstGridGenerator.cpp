@@ -18,6 +18,7 @@
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_List.hpp"
 #include "Utility_InterpolationPolicy.hpp"
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -87,6 +88,23 @@ FRENSIE_UNIT_TEST( GridGenerator, dirty_convergence_handling )
   FRENSIE_CHECK( !generator.isExceptionThrownOnDirtyConvergence() );
 }
 
+//---------------------------------------------------------------------------//
+// Check if the parallel refinement mode can be set
+FRENSIE_UNIT_TEST( GridGenerator, parallel_refinement_mode )
+{
+  Utility::GridGenerator<Utility::LinLin> generator;
+
+  FRENSIE_CHECK( !generator.isParallelRefinementModeOn() );
+
+  generator.setParallelRefinementModeOn();
+
+  FRENSIE_CHECK( generator.isParallelRefinementModeOn() );
+
+  generator.setParallelRefinementModeOff();
+
+  FRENSIE_CHECK( !generator.isParallelRefinementModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the convergence tolerance can be set
 FRENSIE_UNIT_TEST( GridGenerator, setConvergenceTolerance )
@@ -790,6 +808,207 @@ FRENSIE_UNIT_TEST( GridGenerator, refineAndEvaluateInPlace )
   FRENSIE_CHECK_EQUAL( grid.back(), initial_grid[7] );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the parallel refinement mode generates the serial grids
+FRENSIE_UNIT_TEST( GridGenerator, generateAndEvaluateInPlace_parallel )
+{
+  // Create the different grid generators
+  Utility::GridGenerator<Utility::LinLin> linlin_generator( 0.001, 1e-12 );
+  Utility::GridGenerator<Utility::LinLog> linlog_generator( 0.001, 1e-12 );
+
+  Utility::GridGenerator<Utility::LinLin> parallel_linlin_generator( 0.001, 1e-12 );
+  parallel_linlin_generator.setParallelRefinementModeOn();
+
+  Utility::GridGenerator<Utility::LinLog> parallel_linlog_generator( 0.001, 1e-12 );
+  parallel_linlog_generator.setParallelRefinementModeOn();
+
+  // Create the initial grid
+  std::vector<double> initial_grid( 3 );
+  initial_grid[0] = 1e-3;
+  initial_grid[1] = 1.0;
+  initial_grid[2] = 10.0;
+
+  // Create a lin-lin grid for x^2
+  boost::function<double (double x)> function = &x2;
+
+  std::vector<double> grid = initial_grid, evaluated_function;
+  std::vector<double> parallel_grid = initial_grid, parallel_evaluated_function;
+
+  linlin_generator.generateAndEvaluateInPlace( grid,
+                                               evaluated_function,
+                                               function );
+
+  parallel_linlin_generator.generateAndEvaluateInPlace(
+                                                 parallel_grid,
+                                                 parallel_evaluated_function,
+                                                 function );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid, grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function, evaluated_function );
+
+  // Create a lin-log grid for cos(x)
+  function = static_cast<double(*)(double)>(&std::cos);
+
+  grid = initial_grid;
+  parallel_grid = initial_grid;
+
+  linlog_generator.generateAndEvaluateInPlace( grid,
+                                               evaluated_function,
+                                               function );
+
+  parallel_linlog_generator.generateAndEvaluateInPlace(
+                                                 parallel_grid,
+                                                 parallel_evaluated_function,
+                                                 function );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid, grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function, evaluated_function );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the parallel refinement mode refines the serial grids
+FRENSIE_UNIT_TEST( GridGenerator, refineAndEvaluateInPlace_parallel )
+{
+  Utility::GridGenerator<Utility::LinLin> linlin_generator( 0.001, 1e-12 );
+
+  Utility::GridGenerator<Utility::LinLin> parallel_linlin_generator( 0.001, 1e-12 );
+  parallel_linlin_generator.setParallelRefinementModeOn();
+
+  // Create a lin-lin grid for (x-2)^3
+  std::vector<double> initial_grid( 4 );
+  initial_grid[0] = -1.0;
+  initial_grid[1] = 0.0;
+  initial_grid[2] = 10.0;
+  initial_grid[3] = 20.0;
+
+  x3 x_cubed( 2 );
+  boost::function<double (double x)> function =
+    boost::bind<double>(x_cubed, _1);
+
+  std::vector<double> grid = initial_grid, evaluated_function;
+  std::vector<double> parallel_grid = initial_grid, parallel_evaluated_function;
+
+  linlin_generator.refineAndEvaluateInPlace( grid,
+                                             evaluated_function,
+                                             function,
+                                             initial_grid[1],
+                                             initial_grid[2] );
+
+  parallel_linlin_generator.refineAndEvaluateInPlace(
+                                                 parallel_grid,
+                                                 parallel_evaluated_function,
+                                                 function,
+                                                 initial_grid[1],
+                                                 initial_grid[2] );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid.size(), 710 );
+  FRENSIE_CHECK_EQUAL( parallel_grid, grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function, evaluated_function );
+
+  // Create a lin-lin grid for x*cos(x) in [-1, 1]
+  xcosxAB x_cos_x( -1, 1 );
+  function = boost::bind<double>(x_cos_x, _1);
+
+  initial_grid.resize( 9 );
+  initial_grid[0] = -3.0;
+  initial_grid[1] = -2.0;
+  initial_grid[2] = -1.0 - 1e-15;
+  initial_grid[3] = -1.0;
+  initial_grid[4] = 0.0;
+  initial_grid[5] = 1.0;
+  initial_grid[6] = 1.0 + 1e-15;
+  initial_grid[7] = 2.0;
+  initial_grid[8] = 3.0;
+
+  grid = initial_grid;
+  parallel_grid = initial_grid;
+
+  linlin_generator.refineAndEvaluateInPlace( grid,
+                                             evaluated_function,
+                                             function,
+                                             initial_grid[1],
+                                             initial_grid[7] );
+
+  parallel_linlin_generator.refineAndEvaluateInPlace(
+                                                 parallel_grid,
+                                                 parallel_evaluated_function,
+                                                 function,
+                                                 initial_grid[1],
+                                                 initial_grid[7] );
+
+  FRENSIE_CHECK_EQUAL( parallel_grid.size(), 71 );
+  FRENSIE_CHECK_EQUAL( parallel_grid, grid );
+  FRENSIE_CHECK_EQUAL( parallel_evaluated_function, evaluated_function );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the parallel refinement mode throws the serial dirty
+// convergence exception
+FRENSIE_UNIT_TEST( GridGenerator, dirty_convergence_parallel )
+{
+  Utility::GridGenerator<Utility::LinLin> generator( 1e-12, 1e-30, 1e-4 );
+  generator.throwExceptionOnDirtyConvergence();
+
+  Utility::GridGenerator<Utility::LinLin> parallel_generator( 1e-12, 1e-30, 1e-4 );
+  parallel_generator.throwExceptionOnDirtyConvergence();
+  parallel_generator.setParallelRefinementModeOn();
+
+  std::vector<double> initial_grid( 2 );
+  initial_grid[0] = 0.0;
+  initial_grid[1] = 10.0;
+
+  boost::function<double (double x)> function =
+    static_cast<double(*)(double)>(&std::cos);
+
+  std::vector<double> grid = initial_grid, evaluated_function;
+  std::string exception_message, parallel_exception_message;
+
+  try{
+    generator.generateAndEvaluateInPlace( grid, evaluated_function, function );
+  }
+  catch( const std::runtime_error& exception )
+  {
+    exception_message = exception.what();
+  }
+
+  grid = initial_grid;
+
+  try{
+    parallel_generator.generateAndEvaluateInPlace( grid,
+                                                   evaluated_function,
+                                                   function );
+  }
+  catch( const std::runtime_error& exception )
+  {
+    parallel_exception_message = exception.what();
+  }
+
+  FRENSIE_CHECK( exception_message.size() > 0 );
+  FRENSIE_CHECK_EQUAL( parallel_exception_message, exception_message );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+int threads;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Set the number of threads to use
+  Utility::OpenMPProperties::setNumberOfThreads( threads );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
 //---------------------------------------------------------------------------//
 // end tstGridGenerator.cpp
 //---------------------------------------------------------------------------//
@@ -66,6 +66,32 @@ FRENSIE_UNIT_TEST( HashBasedGridSearcher, isValueWithinGridBounds )
   FRENSIE_CHECK( !processed_grid_searcher->isValueWithinGridBounds( 1000.5 ) );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the grid points can be returned
+FRENSIE_UNIT_TEST( HashBasedGridSearcher, getGridPoint )
+{
+  FRENSIE_CHECK_EQUAL( grid_searcher->getNumberOfGridPoints(), 1000 );
+  FRENSIE_CHECK_EQUAL( grid_searcher->getGridPoint( 0 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( grid_searcher->getGridPoint( 499 ), 500.0 );
+  FRENSIE_CHECK_EQUAL( grid_searcher->getGridPoint( 999 ), 1000.0 );
+
+  FRENSIE_CHECK_EQUAL( energy_grid_searcher->getNumberOfGridPoints(), 1000 );
+  FRENSIE_CHECK_EQUAL( energy_grid_searcher->getGridPoint( 0 ), 1.0*MeV );
+  FRENSIE_CHECK_EQUAL( energy_grid_searcher->getGridPoint( 999 ), 1000.0*MeV );
+
+  // The processed grid points must be unprocessed
+  FRENSIE_CHECK_EQUAL( processed_grid_searcher->getNumberOfGridPoints(), 1000 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( processed_grid_searcher->getGridPoint( 0 ),
+                                   1.0,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( processed_grid_searcher->getGridPoint( 499 ),
+                                   500.0,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( processed_grid_searcher->getGridPoint( 999 ),
+                                   1000.0,
+                                   1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the index of the lower bin boundary of a value can be found
 FRENSIE_UNIT_TEST( HashBasedGridSearcher, findLowerBinIndex )
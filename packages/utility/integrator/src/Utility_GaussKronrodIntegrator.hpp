@@ -193,8 +193,61 @@ typedef std::vector<ExtrapolatedBinTraits<T>> BinArray;
                 T& result_abs,
                 T& result_asc ) const;
 
+  //! Integrate the function with point rule and a batch integrand
+  template<int Points, typename BatchFunctor>
+  void integrateWithPointRuleInBatch( BatchFunctor& integrand,
+                                      T lower_limit,
+                                      T upper_limit,
+                                      T& result,
+                                      T& absolute_error,
+                                      T& result_abs,
+                                      T& result_asc ) const;
+
+  //! Integrate the function adaptively with a batch integrand
+  template<int Points, typename BatchFunctor>
+  void integrateAdaptivelyInBatch( BatchFunctor& integrand,
+                                   T lower_limit,
+                                   T upper_limit,
+                                   T& result,
+                                   T& absolute_error ) const;
+
+  //! Integrate independent functions adaptively in lockstep
+  template<int Points, typename LockstepBatchFunctor>
+  void integrateAdaptivelyInLockstep( LockstepBatchFunctor& integrand,
+                                      const std::vector<T>& lower_limits,
+                                      const std::vector<T>& upper_limits,
+                                      std::vector<T>& results,
+                                      std::vector<T>& absolute_errors ) const;
+
 protected:
 
+  // Calculate the point rule abscissae of an interval
+  template<int Points>
+  void calculatePointRuleAbscissae( T lower_limit,
+                                    T upper_limit,
+                                    T* abscissae ) const;
+
+  // Apply the point rule to the integrand values of an interval
+  template<int Points>
+  void applyPointRuleToIntegrandValues( T lower_limit,
+                                        T upper_limit,
+                                        const T* integrand_values,
+                                        T& result,
+                                        T& absolute_error,
+                                        T& result_abs,
+                                        T& result_asc ) const;
+
+  // Evaluate a lockstep batch integrand at the abscissae of intervals
+  template<int Points, typename LockstepBatchFunctor>
+  void evaluateLockstepBatchIntegrand(
+                   LockstepBatchFunctor& integrand,
+                   const std::vector<size_t>& interval_integral_indices,
+                   const std::vector<T>& interval_lower_limits,
+                   const std::vector<T>& interval_upper_limits,
+                   std::vector<size_t>& abscissa_integral_indices,
+                   std::vector<T>& abscissae,
+                   std::vector<T>& integrand_values ) const;
+
   // Calculate the quadrature upper and lower integrand values at an abscissa
   template<typename FunctorType = double, typename Functor>
   void calculateQuadratureIntegrandValuesAtAbscissa(
@@ -11,6 +11,8 @@
 
 // Std Includes
 #include <limits>
+#include <array>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "Utility_DesignByContract.hpp"
@@ -2147,6 +2149,612 @@ void GaussKronrodIntegrator<T>::integrateWithPointRule(
   }
 }
 
+// Integrate the function with point rule and a batch integrand
+/*! \details BatchFunctor must have
+ * operator()( const Utility::ArrayView<const T>&, const Utility::ArrayView<T>& )
+ * defined. The integrand will be evaluated at all of the point rule abscissae
+ * (Points values) with a single call, which allows the integrand evaluation to
+ * be vectorized. The abscissae will be passed to the integrand as values of
+ * type T. The results are identical to the results of
+ * integrateWithPointRule when the integrand returns the same values. Valid
+ * Gauss-Kronrod rules are 15, 21, 31, 41, 51 and 61.
+ */
+template<typename T>
+template<int Points, typename BatchFunctor>
+void GaussKronrodIntegrator<T>::integrateWithPointRuleInBatch(
+                                                BatchFunctor& integrand,
+                                                T lower_limit,
+                                                T upper_limit,
+                                                T& result,
+                                                T& absolute_error,
+                                                T& result_abs,
+                                                T& result_asc ) const
+{
+  // Make sure the point rule is valid_rule
+  testStaticPrecondition( (GaussKronrodQuadratureSetTraits<Points,T>::valid_rule) );
+  // Make sure the integration limits are valid
+  testPrecondition( lower_limit <= upper_limit );
+
+  if( lower_limit < upper_limit )
+  {
+    std::array<T,Points> abscissae, integrand_values;
+
+    this->calculatePointRuleAbscissae<Points>( lower_limit,
+                                               upper_limit,
+                                               abscissae.data() );
+
+    integrand( Utility::ArrayView<const T>( abscissae.data(), Points ),
+               Utility::ArrayView<T>( integrand_values.data(), Points ) );
+
+    this->applyPointRuleToIntegrandValues<Points>( lower_limit,
+                                                   upper_limit,
+                                                   integrand_values.data(),
+                                                   result,
+                                                   absolute_error,
+                                                   result_abs,
+                                                   result_asc );
+  }
+  else if( lower_limit == upper_limit )
+  {
+    result = 0.0;
+    absolute_error = 0.0;
+  }
+  else // invalid limits
+  {
+    THROW_EXCEPTION( Utility::IntegratorException,
+		     "Invalid integration limits: " << lower_limit << " !< "
+		     << upper_limit << "." );
+  }
+}
+
+// Integrate the function adaptively with a batch integrand
+/*! \details BatchFunctor must have
+ * operator()( const Utility::ArrayView<const T>&, const Utility::ArrayView<T>& )
+ * defined. The adaptive integration strategy is the same as the strategy used
+ * by integrateAdaptively but the integrand is evaluated at all of the
+ * abscissae of both bisected bins with a single call. The results are
+ * identical to the results of integrateAdaptively when the integrand returns
+ * the same values.
+ */
+template<typename T>
+template<int Points, typename BatchFunctor>
+void GaussKronrodIntegrator<T>::integrateAdaptivelyInBatch(
+                                                  BatchFunctor& integrand,
+                                                  T lower_limit,
+                                                  T upper_limit,
+                                                  T& result,
+                                                  T& absolute_error ) const
+{
+  // The integral index of each abscissa can be ignored
+  auto lockstep_integrand =
+    [&integrand]( const Utility::ArrayView<const size_t>&,
+                  const Utility::ArrayView<const T>& abscissae,
+                  const Utility::ArrayView<T>& integrand_values )
+    { integrand( abscissae, integrand_values ); };
+
+  std::vector<T> lower_limits( 1, lower_limit ), upper_limits( 1, upper_limit );
+  std::vector<T> results, absolute_errors;
+
+  this->integrateAdaptivelyInLockstep<Points>( lockstep_integrand,
+                                               lower_limits,
+                                               upper_limits,
+                                               results,
+                                               absolute_errors );
+
+  result = results.front();
+  absolute_error = absolute_errors.front();
+}
+
+// Integrate independent functions adaptively in lockstep
+/*! \details LockstepBatchFunctor must have
+ * operator()( const Utility::ArrayView<const size_t>&,
+ *             const Utility::ArrayView<const T>&,
+ *             const Utility::ArrayView<T>& )
+ * defined. The first array view stores the index of the integral (in the
+ * lower_limits and upper_limits arrays) that each abscissa belongs to, which
+ * allows a family of integrands (e.g. one integrand per energy) to be
+ * evaluated together. Every integral is integrated adaptively using the same
+ * strategy as integrateAdaptively. On each iteration the bin with the largest
+ * error estimate of every integral that has not converged yet is bisected and
+ * the integrand is evaluated at all of the abscissae of the bisected bins with
+ * a single call. Each integral has a fixed capacity bin heap that can hold
+ * the subinterval limit number of bins, which is allocated up front so that
+ * no memory is allocated when bins are bisected. The results are identical to
+ * the results of integrating each integral with integrateAdaptively when the
+ * integrand returns the same values.
+ */
+template<typename T>
+template<int Points, typename LockstepBatchFunctor>
+void GaussKronrodIntegrator<T>::integrateAdaptivelyInLockstep(
+                                        LockstepBatchFunctor& integrand,
+                                        const std::vector<T>& lower_limits,
+                                        const std::vector<T>& upper_limits,
+                                        std::vector<T>& results,
+                                        std::vector<T>& absolute_errors ) const
+{
+  // Make sure the point rule is valid_rule
+  testStaticPrecondition( (GaussKronrodQuadratureSetTraits<Points,T>::valid_rule) );
+  // Make sure the integration limits are valid
+  testPrecondition( lower_limits.size() == upper_limits.size() );
+
+  const size_t number_of_integrals = lower_limits.size();
+
+  results.assign( number_of_integrals, 0.0 );
+  absolute_errors.assign( number_of_integrals, 0.0 );
+
+  // The fixed capacity bin heap of each integral (a bin is added to a heap
+  // every time that a bin is bisected)
+  const size_t bin_heap_capacity = d_subinterval_limit + 1;
+
+  std::vector<BinTraits<T> > bin_heaps( number_of_integrals*bin_heap_capacity );
+  std::vector<size_t> bin_heap_sizes( number_of_integrals, 0 );
+
+  std::vector<T> areas( number_of_integrals, 0.0 );
+  std::vector<int> round_offs_1( number_of_integrals, 0 );
+  std::vector<int> round_offs_2( number_of_integrals, 0 );
+
+  // The integrals that have not converged
+  std::vector<size_t> active_integrals, remaining_active_integrals;
+  active_integrals.reserve( number_of_integrals );
+  remaining_active_integrals.reserve( number_of_integrals );
+
+  // The intervals that will be integrated in a single batch (at most two
+  // per active integral)
+  std::vector<size_t> interval_integral_indices;
+  std::vector<T> interval_lower_limits, interval_upper_limits;
+  std::vector<BinTraits<T> > bisected_bins;
+
+  interval_integral_indices.reserve( 2*number_of_integrals );
+  interval_lower_limits.reserve( 2*number_of_integrals );
+  interval_upper_limits.reserve( 2*number_of_integrals );
+  bisected_bins.reserve( number_of_integrals );
+
+  std::vector<size_t> abscissa_integral_indices;
+  std::vector<T> abscissae, integrand_values;
+
+  abscissa_integral_indices.reserve( 2*number_of_integrals*Points );
+  abscissae.reserve( 2*number_of_integrals*Points );
+  integrand_values.reserve( 2*number_of_integrals*Points );
+
+  /* perform the first integration */
+
+  for( size_t i = 0; i < number_of_integrals; ++i )
+  {
+    TEST_FOR_EXCEPTION( lower_limits[i] > upper_limits[i],
+                        Utility::IntegratorException,
+                        "Invalid integration limits: " << lower_limits[i]
+                        << " !< " << upper_limits[i] << "." );
+
+    // The integral over an empty interval is zero
+    if( lower_limits[i] < upper_limits[i] )
+    {
+      active_integrals.push_back( i );
+
+      interval_integral_indices.push_back( i );
+      interval_lower_limits.push_back( lower_limits[i] );
+      interval_upper_limits.push_back( upper_limits[i] );
+    }
+  }
+
+  this->evaluateLockstepBatchIntegrand<Points>( integrand,
+                                                interval_integral_indices,
+                                                interval_lower_limits,
+                                                interval_upper_limits,
+                                                abscissa_integral_indices,
+                                                abscissae,
+                                                integrand_values );
+
+  for( size_t k = 0; k < active_integrals.size(); ++k )
+  {
+    const size_t i = active_integrals[k];
+
+    BinTraits<T> bin;
+    bin.lower_limit = lower_limits[i];
+    bin.upper_limit = upper_limits[i];
+
+    T result_abs = 0.0;
+    T result_asc = 0.0;
+
+    this->applyPointRuleToIntegrandValues<Points>( bin.lower_limit,
+                                                   bin.upper_limit,
+                                                   &integrand_values[k*Points],
+                                                   bin.result,
+                                                   bin.error,
+                                                   result_abs,
+                                                   result_asc );
+
+    typename std::vector<BinTraits<T> >::iterator bin_heap_start =
+      bin_heaps.begin() + i*bin_heap_capacity;
+
+    *bin_heap_start = bin;
+    bin_heap_sizes[i] = 1;
+
+    /* Test on accuracy */
+
+    T tolerance =
+      getMax(d_absolute_error_tol, d_relative_error_tol * fabs (bin.result));
+
+    T round_off = 50*std::numeric_limits<T>::epsilon()*result_abs;
+
+    // Check roundoff on first attempt - dirty integration
+    if ( bin.error <= round_off && bin.error > tolerance )
+    {
+      std::ostringstream oss;
+      oss.precision( 18 );
+      oss << " Cannot reach tolerance because of roundoff error on first attempt";
+
+      if ( d_throw_exceptions )
+      {
+        THROW_EXCEPTION( Utility::IntegratorException, oss.str() );
+      }
+      else
+      {
+        FRENSIE_LOG_TAGGED_WARNING( "Gauss-Kronrod", oss.str() );
+      }
+    }
+
+    if ( ( bin.error <= tolerance && bin.error != result_asc ) ||
+         bin.error == 0 )
+    {
+      results[i] = bin.result;
+      absolute_errors[i] = bin.error;
+    }
+    else
+    {
+      TEST_FOR_EXCEPTION( d_subinterval_limit == 1,
+                          Utility::IntegratorException,
+                          "A maximum of one iteration was insufficient" );
+
+      areas[i] = bin.result;
+      absolute_errors[i] = bin.error;
+
+      remaining_active_integrals.push_back( i );
+    }
+  }
+
+  active_integrals.swap( remaining_active_integrals );
+
+  for ( size_t last = 1; !active_integrals.empty(); ++last )
+  {
+    interval_integral_indices.clear();
+    interval_lower_limits.clear();
+    interval_upper_limits.clear();
+    bisected_bins.clear();
+
+    // Pop the bin with the highest error from each heap and bisect it
+    for( size_t k = 0; k < active_integrals.size(); ++k )
+    {
+      const size_t i = active_integrals[k];
+
+      typename std::vector<BinTraits<T> >::iterator bin_heap_start =
+        bin_heaps.begin() + i*bin_heap_capacity;
+
+      std::pop_heap( bin_heap_start, bin_heap_start + bin_heap_sizes[i] );
+      --bin_heap_sizes[i];
+
+      const BinTraits<T>& bin = *(bin_heap_start + bin_heap_sizes[i]);
+
+      bisected_bins.push_back( bin );
+
+      T midpoint = (1/2.0)  * ( bin.lower_limit + bin.upper_limit );
+
+      interval_integral_indices.push_back( i );
+      interval_lower_limits.push_back( bin.lower_limit );
+      interval_upper_limits.push_back( midpoint );
+
+      interval_integral_indices.push_back( i );
+      interval_lower_limits.push_back( midpoint );
+      interval_upper_limits.push_back( bin.upper_limit );
+    }
+
+    this->evaluateLockstepBatchIntegrand<Points>( integrand,
+                                                  interval_integral_indices,
+                                                  interval_lower_limits,
+                                                  interval_upper_limits,
+                                                  abscissa_integral_indices,
+                                                  abscissae,
+                                                  integrand_values );
+
+    remaining_active_integrals.clear();
+
+    for( size_t k = 0; k < active_integrals.size(); ++k )
+    {
+      const size_t i = active_integrals[k];
+
+      const BinTraits<T>& bin = bisected_bins[k];
+
+      T result_asc_1 = 0.0, result_asc_2 = 0.0, result_abs_1, result_abs_2;
+      BinTraits<T> bin_1, bin_2;
+
+      bin_1.lower_limit = interval_lower_limits[2*k];
+      bin_1.upper_limit = interval_upper_limits[2*k];
+
+      bin_2.lower_limit = interval_lower_limits[2*k+1];
+      bin_2.upper_limit = interval_upper_limits[2*k+1];
+
+      this->applyPointRuleToIntegrandValues<Points>(
+                                            bin_1.lower_limit,
+                                            bin_1.upper_limit,
+                                            &integrand_values[2*k*Points],
+                                            bin_1.result,
+                                            bin_1.error,
+                                            result_abs_1,
+                                            result_asc_1 );
+
+      this->applyPointRuleToIntegrandValues<Points>(
+                                            bin_2.lower_limit,
+                                            bin_2.upper_limit,
+                                            &integrand_values[(2*k+1)*Points],
+                                            bin_2.result,
+                                            bin_2.error,
+                                            result_abs_2,
+                                            result_asc_2 );
+
+      typename std::vector<BinTraits<T> >::iterator bin_heap_start =
+        bin_heaps.begin() + i*bin_heap_capacity;
+
+      *(bin_heap_start + bin_heap_sizes[i]) = bin_1;
+      ++bin_heap_sizes[i];
+      std::push_heap( bin_heap_start, bin_heap_start + bin_heap_sizes[i] );
+
+      *(bin_heap_start + bin_heap_sizes[i]) = bin_2;
+      ++bin_heap_sizes[i];
+      std::push_heap( bin_heap_start, bin_heap_start + bin_heap_sizes[i] );
+
+      // Improve previous approximations to integral and error and test for accuracy
+      absolute_errors[i] += bin_1.error + bin_2.error - bin.error;
+      areas[i] += bin_1.result + bin_2.result - bin.result;
+
+      if ( d_estimate_roundoff )
+      {
+        // Check that the roundoff error is not too high
+        checkRoundoffError( bin,
+                            bin_1,
+                            bin_2,
+                            result_asc_1,
+                            result_asc_2,
+                            round_offs_1[i],
+                            round_offs_2[i],
+                            last+1 );
+      }
+
+      T tolerance =
+        getMax( d_absolute_error_tol, d_relative_error_tol * fabs (areas[i]));
+
+      bool integral_finished = false;
+
+      if ( absolute_errors[i] <= tolerance )
+        integral_finished = true;
+
+      // Check if the subinterval limit was hit - dirty integration
+      else if ( last+1 == d_subinterval_limit )
+      {
+        std::ostringstream oss;
+        oss.precision( 18 );
+        oss << " The maximum number of subdivisions ( "
+            << d_subinterval_limit
+            << " ) were reached";
+
+        if ( d_throw_exceptions )
+        {
+          THROW_EXCEPTION( Utility::IntegratorException, oss.str() );
+        }
+        else
+        {
+          FRENSIE_LOG_TAGGED_WARNING( "Gauss-Kronrod", oss.str() );
+        }
+
+        integral_finished = true;
+      }
+
+      // Check if the subdivisions have gotten too small - dirty integration
+      else if ( subintervalTooSmall<Points>( bin_1.lower_limit,
+                                             bin_2.lower_limit,
+                                             bin_2.upper_limit ) )
+      {
+        std::ostringstream oss;
+        oss.precision( 18 );
+        oss << " Subdivisions have become too small - "
+            << "subinterval size(lower boundary, upper boundary) =\n"
+            << "subinterval size(" << bin_1.lower_limit << ", "
+            << bin_2.upper_limit <<") = " << bin_2.upper_limit - bin_1.lower_limit;
+
+        if ( d_throw_exceptions )
+        {
+          THROW_EXCEPTION( Utility::IntegratorException, oss.str() );
+        }
+        else
+        {
+          FRENSIE_LOG_TAGGED_WARNING( "Gauss-Kronrod", oss.str() );
+        }
+
+        integral_finished = true;
+      }
+
+      if( integral_finished )
+        results[i] = areas[i];
+      else
+        remaining_active_integrals.push_back( i );
+    }
+
+    active_integrals.swap( remaining_active_integrals );
+  }
+}
+
+// Calculate the point rule abscissae of an interval
+/*! \details The abscissae below the midpoint are stored first (in the order
+ * of the Kronrod abscissae), followed by the abscissae above the midpoint and
+ * then the midpoint. The abscissae are calculated in the same way as in
+ * calculateQuadratureIntegrandValuesAtAbscissa.
+ */
+template<typename T>
+template<int Points>
+void GaussKronrodIntegrator<T>::calculatePointRuleAbscissae(
+                                                        T lower_limit,
+                                                        T upper_limit,
+                                                        T* abscissae ) const
+{
+  // midpoint between upper and lower integration limits
+  T midpoint = ( upper_limit + lower_limit )/2.0;
+
+  // half the length between the upper and lower integration limits
+  T half_length = (upper_limit - lower_limit )/2.0;
+
+  // Get number of Kronrod weights
+  const int number_of_weights =
+    GaussKronrodQuadratureSetTraits<Points,T>::kronrod_weights.size();
+
+  for ( int j = 0; j < number_of_weights-1; ++j )
+  {
+    T weighted_abscissa = half_length*
+      GaussKronrodQuadratureSetTraits<Points,T>::kronrod_abscissae[j];
+
+    abscissae[j] = midpoint - weighted_abscissa;
+    abscissae[number_of_weights-1+j] = midpoint + weighted_abscissa;
+  }
+
+  abscissae[2*number_of_weights-2] = midpoint;
+}
+
+// Apply the point rule to the integrand values of an interval
+/*! \details The integrand values must be ordered in the same way as the
+ * abscissae calculated by calculatePointRuleAbscissae. The operations are
+ * carried out in the same order as in integrateWithPointRule.
+ */
+template<typename T>
+template<int Points>
+void GaussKronrodIntegrator<T>::applyPointRuleToIntegrandValues(
+                                                    T lower_limit,
+                                                    T upper_limit,
+                                                    const T* integrand_values,
+                                                    T& result,
+                                                    T& absolute_error,
+                                                    T& result_abs,
+                                                    T& result_asc ) const
+{
+  typedef GaussKronrodQuadratureSetTraits<Points,T> QuadratureSetTraits;
+
+  // half the length between the upper and lower integration limits
+  T half_length = (upper_limit - lower_limit )/2.0;
+  T abs_half_length = fabs( half_length );
+
+  // Get number of Kronrod weights
+  const int number_of_weights = QuadratureSetTraits::kronrod_weights.size();
+
+  const T* integrand_values_lower = integrand_values;
+  const T* integrand_values_upper = integrand_values + number_of_weights - 1;
+  const T& integrand_midpoint = integrand_values[2*number_of_weights-2];
+
+  // Estimate Kronrod and absolute value integral for all but last weight
+  T kronrod_result = 0.0;
+  result_abs = kronrod_result;
+  for ( int j = 0; j < number_of_weights-1; ++j )
+  {
+    kronrod_result += QuadratureSetTraits::kronrod_weights[j]*
+      (integrand_values_lower[j] + integrand_values_upper[j]);
+
+    result_abs += QuadratureSetTraits::kronrod_weights[j]*(
+      fabs( integrand_values_lower[j] ) + fabs( integrand_values_upper[j] ) );
+  }
+
+  // Estimate Kronrod integral for the last weight
+  T kronrod_result_last_weight = integrand_midpoint*
+    QuadratureSetTraits::kronrod_weights[number_of_weights-1];
+
+  // Update Kronrod estimate and absolute value with last weight
+  kronrod_result += kronrod_result_last_weight;
+  result_abs += fabs( kronrod_result_last_weight );
+
+  // Calculate final integral result and absolute value
+  result = kronrod_result*half_length;
+  result_abs *= abs_half_length;
+
+  // Calculate the mean kronrod result
+  T mean_kronrod_result = kronrod_result/2.0;
+
+  // Estimate the result asc for all but the last weight
+  result_asc = 0.0;
+  for ( int j = 0; j < number_of_weights - 1; ++j )
+  {
+    result_asc += QuadratureSetTraits::kronrod_weights[j]*
+      ( fabs( integrand_values_lower[j] - mean_kronrod_result ) +
+        fabs( integrand_values_upper[j] - mean_kronrod_result ) );
+  }
+
+  // Estimate the result asc for the last weight
+  result_asc += QuadratureSetTraits::kronrod_weights[number_of_weights-1]*
+    fabs( integrand_midpoint - mean_kronrod_result );
+
+  // Calculate final result acx
+  result_asc *= abs_half_length;
+
+  // Estimate Gauss integral
+  T gauss_result = 0.0;
+
+  for ( int j = 0; j < (number_of_weights-1)/2; ++j )
+  {
+    int jj = j*2 + 1;
+    gauss_result += (integrand_values_lower[jj] + integrand_values_upper[jj])*
+      QuadratureSetTraits::gauss_weights[j];
+  }
+
+  // Update Gauss estimate with last weight if needed
+  if ( number_of_weights % 2 == 0 )
+  {
+    gauss_result += integrand_midpoint*
+      QuadratureSetTraits::gauss_weights[number_of_weights/2 - 1];
+  }
+
+  // Estimate error in integral
+  absolute_error = fabs( ( kronrod_result - gauss_result ) * half_length );
+  rescaleAbsoluteError( absolute_error, result_abs, result_asc);
+}
+
+// Evaluate a lockstep batch integrand at the abscissae of intervals
+/*! \details The abscissae of each interval will be stored contiguously (see
+ * calculatePointRuleAbscissae). The abscissa arrays are resized but their
+ * capacity should be reserved by the caller.
+ */
+template<typename T>
+template<int Points, typename LockstepBatchFunctor>
+void GaussKronrodIntegrator<T>::evaluateLockstepBatchIntegrand(
+                   LockstepBatchFunctor& integrand,
+                   const std::vector<size_t>& interval_integral_indices,
+                   const std::vector<T>& interval_lower_limits,
+                   const std::vector<T>& interval_upper_limits,
+                   std::vector<size_t>& abscissa_integral_indices,
+                   std::vector<T>& abscissae,
+                   std::vector<T>& integrand_values ) const
+{
+  const size_t number_of_abscissae =
+    interval_integral_indices.size()*Points;
+
+  abscissa_integral_indices.resize( number_of_abscissae );
+  abscissae.resize( number_of_abscissae );
+  integrand_values.resize( number_of_abscissae );
+
+  if( number_of_abscissae == 0 )
+    return;
+
+  for( size_t k = 0; k < interval_integral_indices.size(); ++k )
+  {
+    std::fill_n( abscissa_integral_indices.begin() + k*Points,
+                 Points,
+                 interval_integral_indices[k] );
+
+    this->calculatePointRuleAbscissae<Points>( interval_lower_limits[k],
+                                               interval_upper_limits[k],
+                                               &abscissae[k*Points] );
+  }
+
+  integrand( Utility::ArrayView<const size_t>( abscissa_integral_indices.data(),
+                                               number_of_abscissae ),
+             Utility::ArrayView<const T>( abscissae.data(),
+                                          number_of_abscissae ),
+             Utility::ArrayView<T>( integrand_values.data(),
+                                    number_of_abscissae ) );
+}
+
 // Test if subinterval is too small
 template<typename T>
 template<int Points>
@@ -299,6 +299,45 @@ public:
   using Utility::GaussKronrodIntegrator<double>::getWynnEpsilonAlgorithmExtrapolation;
 };
 
+// Batch integrand that evaluates a functor at every abscissa
+template<typename Functor>
+struct BatchFunctor
+{
+  void operator()( const Utility::ArrayView<const double>& abscissae,
+                   const Utility::ArrayView<double>& integrand_values ) const
+  {
+    for( size_t i = 0; i < abscissae.size(); ++i )
+      integrand_values[i] = d_functor( abscissae[i] );
+  }
+
+  Functor d_functor;
+};
+
+// Lockstep batch integrand for exp(-a*|x|) (one a value per integral)
+struct ExpNegAbsXLockstepFunctor
+{
+  ExpNegAbsXLockstepFunctor( const std::vector<double>& a_values )
+    : d_a_values( a_values ),
+      d_number_of_calls( 0 )
+  { /* ... */ }
+
+  void operator()( const Utility::ArrayView<const size_t>& integral_indices,
+                   const Utility::ArrayView<const double>& abscissae,
+                   const Utility::ArrayView<double>& integrand_values )
+  {
+    for( size_t i = 0; i < abscissae.size(); ++i )
+    {
+      integrand_values[i] =
+        exp_neg_abs_x( abscissae[i], d_a_values[integral_indices[i]] );
+    }
+
+    ++d_number_of_calls;
+  }
+
+  std::vector<double> d_a_values;
+  size_t d_number_of_calls;
+};
+
 //---------------------------------------------------------------------------//
 // Tests
 //---------------------------------------------------------------------------//
@@ -1327,6 +1366,219 @@ FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
   FRENSIE_CHECK_FLOATING_EQUALITY( Functor::getIntegratedValue(), result, tol );
 }
 
+//---------------------------------------------------------------------------//
+// Check that functions can be integrated with a batch integrand
+FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
+                            integrateWithPointRuleInBatch,
+                            TestFunctors )
+{
+  FETCH_TEMPLATE_PARAM( 0, Functor );
+
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  double result, absolute_error, result_abs, result_asc;
+  double batch_result, batch_absolute_error, batch_result_abs, batch_result_asc;
+
+  Functor functor_instance;
+  BatchFunctor<Functor> batch_functor_instance;
+
+  // Test the 15-point rule
+  gk_integrator.integrateWithPointRule<15>( functor_instance,
+                                            0.0,
+                                            1.0,
+                                            result,
+                                            absolute_error,
+                                            result_abs,
+                                            result_asc );
+
+  gk_integrator.integrateWithPointRuleInBatch<15>( batch_functor_instance,
+                                                   0.0,
+                                                   1.0,
+                                                   batch_result,
+                                                   batch_absolute_error,
+                                                   batch_result_abs,
+                                                   batch_result_asc );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+  FRENSIE_CHECK_EQUAL( batch_result_abs, result_abs );
+  FRENSIE_CHECK_EQUAL( batch_result_asc, result_asc );
+
+  // Test the 21-point rule
+  gk_integrator.integrateWithPointRule<21>( functor_instance,
+                                            0.0,
+                                            0.5,
+                                            result,
+                                            absolute_error,
+                                            result_abs,
+                                            result_asc );
+
+  gk_integrator.integrateWithPointRuleInBatch<21>( batch_functor_instance,
+                                                   0.0,
+                                                   0.5,
+                                                   batch_result,
+                                                   batch_absolute_error,
+                                                   batch_result_abs,
+                                                   batch_result_asc );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+  FRENSIE_CHECK_EQUAL( batch_result_abs, result_abs );
+  FRENSIE_CHECK_EQUAL( batch_result_asc, result_asc );
+
+  // Test the 61-point rule
+  gk_integrator.integrateWithPointRule<61>( functor_instance,
+                                            0.0,
+                                            1.0,
+                                            result,
+                                            absolute_error,
+                                            result_abs,
+                                            result_asc );
+
+  gk_integrator.integrateWithPointRuleInBatch<61>( batch_functor_instance,
+                                                   0.0,
+                                                   1.0,
+                                                   batch_result,
+                                                   batch_absolute_error,
+                                                   batch_result_abs,
+                                                   batch_result_asc );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+  FRENSIE_CHECK_EQUAL( batch_result_abs, result_abs );
+  FRENSIE_CHECK_EQUAL( batch_result_asc, result_asc );
+}
+
+//---------------------------------------------------------------------------//
+// Check that functions can be integrated adaptively with a batch integrand
+FRENSIE_UNIT_TEST( GaussKronrodIntegrator, integrateAdaptivelyInBatch )
+{
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  double result, absolute_error;
+  double batch_result, batch_absolute_error;
+
+  boost::function<double (double)> functor = &inv_sqrt_abs_x;
+  BatchFunctor<boost::function<double (double)> > batch_functor_instance;
+  batch_functor_instance.d_functor = functor;
+
+  // Test the 15-point rule
+  gk_integrator.integrateAdaptively<15>( functor,
+                                         0.25,
+                                         4.0,
+                                         result,
+                                         absolute_error );
+
+  gk_integrator.integrateAdaptivelyInBatch<15>( batch_functor_instance,
+                                                0.25,
+                                                4.0,
+                                                batch_result,
+                                                batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, 3.0, 1e-12 );
+
+  // Test the 51-point rule
+  gk_integrator.integrateAdaptively<51>( functor,
+                                         1e-6,
+                                         1.0,
+                                         result,
+                                         absolute_error );
+
+  gk_integrator.integrateAdaptivelyInBatch<51>( batch_functor_instance,
+                                                1e-6,
+                                                1.0,
+                                                batch_result,
+                                                batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, result );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, absolute_error );
+  FRENSIE_CHECK_FLOATING_EQUALITY( batch_result, 2.0 - 2e-3, 1e-12 );
+
+  // Test an empty interval
+  gk_integrator.integrateAdaptivelyInBatch<15>( batch_functor_instance,
+                                                1.0,
+                                                1.0,
+                                                batch_result,
+                                                batch_absolute_error );
+
+  FRENSIE_CHECK_EQUAL( batch_result, 0.0 );
+  FRENSIE_CHECK_EQUAL( batch_absolute_error, 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that independent functions can be integrated adaptively in lockstep
+FRENSIE_UNIT_TEST( GaussKronrodIntegrator, integrateAdaptivelyInLockstep )
+{
+  Utility::GaussKronrodIntegrator<double> gk_integrator( 1e-12 );
+
+  std::vector<double> a_values( {0.1, 1.0, 10.0, 100.0, 1000.0} );
+  std::vector<double> lower_limits( {-1.0, 0.0, -2.0, 0.5, 1e-3} );
+  std::vector<double> upper_limits( {1.0, 0.0, 3.0, 0.5, 1.0} );
+
+  ExpNegAbsXLockstepFunctor lockstep_functor_instance( a_values );
+
+  std::vector<double> results, absolute_errors;
+
+  gk_integrator.integrateAdaptivelyInLockstep<21>( lockstep_functor_instance,
+                                                   lower_limits,
+                                                   upper_limits,
+                                                   results,
+                                                   absolute_errors );
+
+  FRENSIE_REQUIRE_EQUAL( results.size(), a_values.size() );
+  FRENSIE_REQUIRE_EQUAL( absolute_errors.size(), a_values.size() );
+
+  size_t number_of_calls = 0;
+
+  for( size_t i = 0; i < a_values.size(); ++i )
+  {
+    boost::function<double (double)> functor =
+      boost::bind<double>( exp_neg_abs_x, _1, a_values[i] );
+
+    BatchFunctor<boost::function<double (double)> > batch_functor_instance;
+    batch_functor_instance.d_functor = functor;
+
+    double result, absolute_error;
+
+    gk_integrator.integrateAdaptively<21>( functor,
+                                           lower_limits[i],
+                                           upper_limits[i],
+                                           result,
+                                           absolute_error );
+
+    FRENSIE_CHECK_EQUAL( results[i], result );
+    FRENSIE_CHECK_EQUAL( absolute_errors[i], absolute_error );
+
+    ExpNegAbsXLockstepFunctor single_lockstep_functor_instance(
+                                     std::vector<double>( 1, a_values[i] ) );
+
+    std::vector<double> single_results, single_absolute_errors;
+
+    gk_integrator.integrateAdaptivelyInLockstep<21>(
+                              single_lockstep_functor_instance,
+                              std::vector<double>( 1, lower_limits[i] ),
+                              std::vector<double>( 1, upper_limits[i] ),
+                              single_results,
+                              single_absolute_errors );
+
+    number_of_calls = std::max( number_of_calls,
+                                single_lockstep_functor_instance.d_number_of_calls );
+  }
+
+  // The integrand is only called once per iteration of the slowest integral
+  FRENSIE_CHECK_EQUAL( lockstep_functor_instance.d_number_of_calls,
+                       number_of_calls );
+
+  FRENSIE_CHECK_EQUAL( results[1], 0.0 );
+  FRENSIE_CHECK_EQUAL( results[3], 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( results[0], 20.0*(1.0 - exp(-0.1)), 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( results[2],
+                                   (2.0 - exp(-20.0) - exp(-30.0))/10.0,
+                                   1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that functions can be integrated over [0,1] adaptively
 FRENSIE_UNIT_TEST_TEMPLATE( GaussKronrodIntegrator,
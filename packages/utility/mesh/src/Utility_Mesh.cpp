@@ -21,6 +21,42 @@
 
 namespace Utility{
 
+// Determine the mesh elements that a batch of line segments intersect
+/*! \details The element track lengths of segment i will be stored in the
+ * range [segment_offsets[i],segment_offsets[i+1]) of the element track
+ * lengths array. The default implementation simply computes the track
+ * lengths of each segment individually.
+ */
+void Mesh::computeTrackLengths(
+              const std::vector<std::array<double,3> >& start_points,
+              const std::vector<std::array<double,3> >& end_points,
+              ElementHandleTrackLengthArray& element_track_lengths,
+              std::vector<size_t>& segment_offsets ) const
+{
+  // Make sure that there is an end point for every start point
+  testPrecondition( start_points.size() == end_points.size() );
+
+  element_track_lengths.clear();
+
+  segment_offsets.resize( start_points.size() + 1 );
+  segment_offsets[0] = 0;
+
+  ElementHandleTrackLengthArray segment_track_lengths;
+
+  for( size_t i = 0; i < start_points.size(); ++i )
+  {
+    this->computeTrackLengths( start_points[i].data(),
+                               end_points[i].data(),
+                               segment_track_lengths );
+
+    element_track_lengths.insert( element_track_lengths.end(),
+                                  segment_track_lengths.begin(),
+                                  segment_track_lengths.end() );
+
+    segment_offsets[i+1] = element_track_lengths.size();
+  }
+}
+
 // Export the mesh to a file
 void Mesh::exportData( const std::string& output_file_name ) const
 {
@@ -88,6 +88,13 @@ public:
               const double end_point[3],
               ElementHandleTrackLengthArray& element_track_lengths ) const = 0;
 
+  //! Determine the mesh elements that a batch of line segments intersect
+  virtual void computeTrackLengths(
+              const std::vector<std::array<double,3> >& start_points,
+              const std::vector<std::array<double,3> >& end_points,
+              ElementHandleTrackLengthArray& element_track_lengths,
+              std::vector<size_t>& segment_offsets ) const;
+
   //! Export the mesh to a file (type determined by suffix - e.g. mesh.vtk)
   virtual void exportData( const std::string& output_file_name,
                            const TagNameSet& tag_root_names,
@@ -6,16 +6,16 @@
 //!
 //---------------------------------------------------------------------------//
 
-//std includes
-#include <math.h>
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // This must be included first
 #include "Utility_StructuredHexMesh.hpp"
 #include "Utility_MOABException.hpp"
-#include "Utility_3DCartesianVectorHelpers.hpp"
 #include "Utility_DesignByContract.hpp"
-#include "Utility_SearchAlgorithms.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -30,7 +30,7 @@
 namespace Utility{
 
 // Initialize static member data
-const double StructuredHexMesh::s_tol = 1e-12;
+const size_t StructuredHexMesh::s_segment_batch_size;
 
 // Default constructor
 StructuredHexMesh::StructuredHexMesh()
@@ -70,6 +70,8 @@ StructuredHexMesh::StructuredHexMesh( const std::vector<double>& x_planes,
     }
   }
 
+  this->initializePlaneLookupData();
+
 #ifndef HAVE_FRENSIE_MOAB
   FRENSIE_LOG_TAGGED_WARNING( "StructuredHexMesh",
                               "Cannot export mesh data to vtk because moab "
@@ -134,35 +136,10 @@ auto StructuredHexMesh::whichElementIsPointIn( const double point[3] ) const ->
   // Make sure that the point is in the mesh
   testPrecondition( this->isPointInMesh(point) );
 
-  size_t x_index = Search::binaryLowerBoundIndex( d_x_planes.begin(),
-                                                  d_x_planes.end(),
-                                                  point[X_DIMENSION] );
-
-  // Take care of when the point is exactly on the last x plane. The search
-  // will return the last x plane if this is true which does not correspond to
-  // any of the hex elements. Instead, move it back one
-  if( x_index == d_x_planes.size() - 1)
-  {
-    x_index = d_x_planes.size() - 2;
-  }
-
-  size_t y_index = Search::binaryLowerBoundIndex( d_y_planes.begin(),
-                                                  d_y_planes.end(),
-                                                  point[Y_DIMENSION] );
-  if( y_index == d_y_planes.size() - 1)
-  {
-    y_index = d_y_planes.size() - 2;
-  }
-
-  size_t z_index = Search::binaryLowerBoundIndex( d_z_planes.begin(),
-                                                  d_z_planes.end(),
-                                                  point[Z_DIMENSION] );
-  if( z_index == d_z_planes.size() - 1)
-  {
-    z_index = d_z_planes.size() - 2;
-  }
-
-  return this->findIndex( x_index, y_index, z_index );
+  return this->findIndex(
+                this->findElementPlaneIndex( X_DIMENSION, point[X_DIMENSION] ),
+                this->findElementPlaneIndex( Y_DIMENSION, point[Y_DIMENSION] ),
+                this->findElementPlaneIndex( Z_DIMENSION, point[Z_DIMENSION] ) );
 }
 
 // Returns an array of pairs of hex IDs and partial track lengths along a given line segment
@@ -173,62 +150,72 @@ void StructuredHexMesh::computeTrackLengths(
 {
   hex_element_track_lengths.clear();
 
-  if( !(start_point[X_DIMENSION] == end_point[X_DIMENSION] &&
-        start_point[Y_DIMENSION] == end_point[Y_DIMENSION] &&
-        start_point[Z_DIMENSION] == end_point[Z_DIMENSION]) )
+  std::array<double,3> start( {start_point[X_DIMENSION],
+                               start_point[Y_DIMENSION],
+                               start_point[Z_DIMENSION]} );
+  std::array<double,3> end( {end_point[X_DIMENSION],
+                             end_point[Y_DIMENSION],
+                             end_point[Z_DIMENSION]} );
+
+  ClippedSegmentBatch clipped_segment;
+
+  this->clipSegmentsToMesh( &start, &end, 1, clipped_segment );
+
+  if( clipped_segment.entry_distance[0] < clipped_segment.exit_distance[0] )
   {
-    // Calculate track length and direction unit vector
-    double direction[3] {end_point[X_DIMENSION] - start_point[X_DIMENSION],
-                         end_point[Y_DIMENSION] - start_point[Y_DIMENSION],
-                         end_point[Z_DIMENSION] - start_point[Z_DIMENSION]};
+    this->traceThroughMesh( start_point,
+                            clipped_segment,
+                            0,
+                            hex_element_track_lengths );
+  }
+}
+
+// Returns the hex IDs and partial track lengths along a batch of line segments
+/*! \details The hex element track lengths of segment i will be stored in the
+ * range [segment_offsets[i],segment_offsets[i+1]) of the hex element track
+ * lengths array. The segments are clipped to the mesh bounding box in small
+ * batches so that the intersection math can be vectorized.
+ */
+void StructuredHexMesh::computeTrackLengths(
+               const std::vector<std::array<double,3> >& start_points,
+               const std::vector<std::array<double,3> >& end_points,
+               ElementHandleTrackLengthArray& hex_element_track_lengths,
+               std::vector<size_t>& segment_offsets ) const
+{
+  // Make sure that there is an end point for every start point
+  testPrecondition( start_points.size() == end_points.size() );
+
+  hex_element_track_lengths.clear();
 
-    double track_length =
-      Utility::normalizeVectorAndReturnMagnitude( direction );
+  segment_offsets.resize( start_points.size() + 1 );
+  segment_offsets[0] = 0;
 
-    double current_point[3] { start_point[X_DIMENSION],
-                              start_point[Y_DIMENSION],
-                              start_point[Z_DIMENSION] };
+  ClippedSegmentBatch clipped_segments;
 
-    // Test if point starts in mesh. If not, figure out if it interacts with mesh
-    if( !this->isPointInMesh(current_point) )
-    {
-      // First member of pair is whether the mesh was intersected,
-      // second member of pair is the distance to the intersection
-      std::tuple<bool,Dimension,double> ray_intersection_tuple;
+  for( size_t batch_start = 0;
+       batch_start < start_points.size();
+       batch_start += s_segment_batch_size )
+  {
+    const size_t batch_size =
+      std::min( s_segment_batch_size, start_points.size() - batch_start );
 
-      this->doesRayIntersectMesh( current_point,
-                                  direction,
-                                  track_length,
-                                  ray_intersection_tuple );
+    this->clipSegmentsToMesh( &start_points[batch_start],
+                              &end_points[batch_start],
+                              batch_size,
+                              clipped_segments );
 
-      if( std::get<0>( ray_intersection_tuple ) )
+    for( size_t i = 0; i < batch_size; ++i )
+    {
+      if( clipped_segments.entry_distance[i] <
+          clipped_segments.exit_distance[i] )
       {
-        this->pushPoint( current_point,
-                         direction,
-                         std::get<2>( ray_intersection_tuple ) );
-
-        PlaneIndex hex_plane_indices[3];
-        this->setHexPlaneIndices( std::get<1>( ray_intersection_tuple ),
-                                  current_point,
-                                  hex_plane_indices );
-
-        this->traceThroughMesh( current_point,
-                                direction,
-                                track_length - std::get<2>( ray_intersection_tuple ),
-                                hex_plane_indices,
+        this->traceThroughMesh( start_points[batch_start+i].data(),
+                                clipped_segments,
+                                i,
                                 hex_element_track_lengths );
       }
-    }
-    else
-    {
-      PlaneIndex hex_plane_indices[3];
-      this->setHexPlaneIndices( current_point, hex_plane_indices );
-
-      this->traceThroughMesh( current_point,
-                              direction,
-                              track_length,
-                              hex_plane_indices,
-                              hex_element_track_lengths );
+
+      segment_offsets[batch_start+i+1] = hex_element_track_lengths.size();
     }
   }
 }
@@ -325,518 +312,349 @@ void StructuredHexMesh::getHexPlaneIndices(
 
 // Begin private functions
 
-// Returns a pair where the first member is true if the ray intersects with the mesh and the second is the distance to the intersection point
-void
-StructuredHexMesh::doesRayIntersectMesh(
-                   const double point[3],
-                   const double direction[3],
-                   const double track_length,
-                   std::tuple<bool,Dimension,double>& intersection_data ) const
+// Initialize the plane lookup data
+void StructuredHexMesh::initializePlaneLookupData()
+{
+  this->initializePlaneLookupData( X_DIMENSION );
+  this->initializePlaneLookupData( Y_DIMENSION );
+  this->initializePlaneLookupData( Z_DIMENSION );
+}
+
+// Initialize the plane lookup data for a dimension
+/*! \details If the planes are uniformly spaced the inverse plane spacing
+ * will be used to find the element slab that a coordinate falls in directly.
+ * Otherwise a hash grid with one bin per element slab will be created. Each
+ * hash grid bin stores the index of the element slab that its lower
+ * boundary falls in so that only the slabs that overlap a bin need to be
+ * searched.
+ */
+void StructuredHexMesh::initializePlaneLookupData( const Dimension dimension )
 {
-  // This method should only be used when the point starts outside of mesh
-  testPrecondition( !(this->isPointInMesh(point)) );
-  // Make sure direction vector is a unit vector
-  testPrecondition( Utility::isUnitVector( direction ) );
+  const std::vector<double>& planes = this->getPlanes( dimension );
 
-  // Initialize the intersection data
-  Utility::get<0>( intersection_data ) = false;
-  Utility::get<1>( intersection_data ) = X_DIMENSION;
-  Utility::get<2>( intersection_data ) = 0.0;
+  const size_t number_of_slabs = planes.size() - 1;
 
-  std::vector<std::pair<Dimension,double> > bounding_plane_distance_set;
+  const double plane_spacing =
+    (planes.back() - planes.front())/number_of_slabs;
 
-  this->findBoundingInteractionPlaneDistances( point,
-                                               direction,
-                                               bounding_plane_distance_set );
+  d_uniform_plane_spacing[dimension] = true;
 
-  // Check whether there are any possible bounding planes to intersect with
-  if( bounding_plane_distance_set.size() > 0 )
+  for( size_t i = 1; i < number_of_slabs; ++i )
   {
-    for( size_t i = 0; i < bounding_plane_distance_set.size(); ++i )
+    if( std::fabs( planes[i] - (planes.front() + i*plane_spacing) ) >
+        1e-6*plane_spacing )
     {
-      // If the distance is greater than the track length, skip it
-      if( bounding_plane_distance_set[i].second >= track_length )
-        continue;
-
-      double new_point[3] { point[X_DIMENSION],
-                            point[Y_DIMENSION],
-                            point[Z_DIMENSION] };
-
-      // Push point up to plane intersection point
-      this->pushPoint( new_point,
-                       direction,
-                       bounding_plane_distance_set[i].second );
-
-      // Check if the point is on the mesh surface
-      if( this->isPointOnMeshSurface( new_point, bounding_plane_distance_set[i].first ) )
-      {
-        Utility::get<0>( intersection_data ) = true;
-
-        Utility::get<1>( intersection_data ) =
-          bounding_plane_distance_set[i].first;
-
-        Utility::get<2>( intersection_data ) =
-          bounding_plane_distance_set[i].second;
+      d_uniform_plane_spacing[dimension] = false;
 
-        break;
-      }
+      break;
     }
   }
-}
-
-// Trace particle path through mesh until it dies or leaves mesh
-void StructuredHexMesh::traceThroughMesh(
-               double point[3],
-               const double direction[3],
-               const double track_length,
-               PlaneIndex hex_plane_indices[3],
-               ElementHandleTrackLengthArray& hex_element_track_lengths ) const
-{
-  std::vector<std::pair<Dimension,PlaneIndex> > interaction_planes;
-  this->findInteractionPlanes( point,
-                               direction,
-                               hex_plane_indices,
-                               interaction_planes );
 
-  double iteration_distance = 0;
+  d_inverse_plane_lookup_bin_widths[dimension] = 1.0/plane_spacing;
 
-  size_t incrementer[3];
-  this->setIncrementer( incrementer, direction );
-
-  bool continue_tracing = true;
-
-  while(continue_tracing)
+  if( d_uniform_plane_spacing[dimension] )
+    d_plane_hash_grids[dimension].clear();
+  else
   {
-    std::pair<Dimension, double> intersection_distance;
-    this->findIntersectionDistance( point,
-                                    direction,
-                                    interaction_planes,
-                                    intersection_distance );
-    double partial_track_length;
-
-    // Check if track length is exhausted
-    if( track_length <= iteration_distance + intersection_distance.second )
-    {
-      partial_track_length = track_length - iteration_distance;
-      continue_tracing = false;
-    }
-    else
-    {
-      partial_track_length = intersection_distance.second;
-    }
+    std::vector<PlaneIndex>& hash_grid = d_plane_hash_grids[dimension];
 
-    // Push back a new pair for the indices
-    hex_element_track_lengths.push_back(
-       std::make_tuple( this->findIndex( hex_plane_indices ),
-                        std::array<double,3>( {point[0], point[1], point[2]} ),
-                        partial_track_length ) );
+    hash_grid.resize( number_of_slabs + 1 );
 
-    // Check if the particle left the mesh
-    if( this->didParticleLeaveMesh( intersection_distance.first,
-                                    interaction_planes ) )
-    {
-      continue_tracing = false;
-    }
+    PlaneIndex slab_index = 0;
 
-    // If the track length was exhausted or the particle left the mesh, leave
-    // loop and return array.
-    if( continue_tracing )
+    for( size_t i = 0; i < hash_grid.size(); ++i )
     {
-      // Otherwise, push point up to new location
-      this->pushPoint(point, direction, partial_track_length);
-
-      // Increase iteration_distance to new value
-      iteration_distance += partial_track_length;
+      const double bin_lower_bound = planes.front() + i*plane_spacing;
 
-      // Increment indices and perform calculation again.
-      hex_plane_indices[intersection_distance.first] +=
-        incrementer[intersection_distance.first];
+      while( slab_index < number_of_slabs - 1 &&
+             planes[slab_index+1] <= bin_lower_bound )
+        ++slab_index;
 
-      for( size_t i = 0; i < interaction_planes.size() ; ++i )
-      {
-        if(interaction_planes[i].first == intersection_distance.first)
-        {
-          interaction_planes[i].second +=
-            incrementer[interaction_planes[i].first];
-
-          break;
-        }
-      }
+      hash_grid[i] = slab_index;
     }
   }
 }
 
-// Find the interaction planes that a particle will interact with
-void StructuredHexMesh::findInteractionPlanes(
-      const double point[3],
-      const double direction[3],
-      const PlaneIndex hex_plane_indices[3],
-      std::vector<std::pair<Dimension,PlaneIndex> >& interaction_planes ) const
+// Return the planes of a dimension
+const std::vector<double>& StructuredHexMesh::getPlanes(
+                                            const Dimension dimension ) const
 {
-  // Make sure that the point is in the mesh
-  testPrecondition( this->isPointInMesh( point ) );
-
-  for( size_t i = X_DIMENSION; i <= Z_DIMENSION; ++i)
+  switch( dimension )
   {
-    if( direction[i] < 0 )
-    {
-      interaction_planes.push_back( std::make_pair( static_cast<Dimension>(i), hex_plane_indices[i] ) );
-    }
-    else if( direction[i] > 0)
-    {
-      interaction_planes.push_back( std::make_pair( static_cast<Dimension>(i), hex_plane_indices[i] + 1) );
-    }
+    case X_DIMENSION: return d_x_planes;
+    case Y_DIMENSION: return d_y_planes;
+    default: return d_z_planes;
   }
 }
 
-// Find the intersection distance along the path of the particle with the next hex
-void StructuredHexMesh::findIntersectionDistance(
-                           const double point[3],
-                           const double direction[3],
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes,
-                           std::pair<Dimension,double>&
-                           intersection_distance ) const
+// Find the index of the element slab along a dimension that a coordinate is in
+/*! \details Coordinates that fall on an interior plane belong to the slab
+ * above the plane. Coordinates below the first plane or on/above the last
+ * plane are assigned to the first or last slab respectively.
+ */
+auto StructuredHexMesh::findElementPlaneIndex( const Dimension dimension,
+                                               const double coordinate ) const
+  -> PlaneIndex
 {
-  // Make sure that the point is in the mesh
-  testPrecondition( this->isPointInMesh(point) );
-  // Make sure that the direction is valid
-  testPrecondition( Utility::isUnitVector( direction ) );
+  const std::vector<double>& planes = this->getPlanes( dimension );
 
-  intersection_distance.second = std::numeric_limits<double>::infinity();
+  const long max_slab_index = planes.size() - 2;
 
-  double possible_distance;
+  const double scaled_coordinate = (coordinate - planes.front())*
+    d_inverse_plane_lookup_bin_widths[dimension];
 
-  for( size_t i = 0; i < interaction_planes.size(); ++i )
+  long slab_index;
+
+  if( scaled_coordinate <= 0.0 )
+    slab_index = 0;
+  else if( scaled_coordinate >= max_slab_index + 1 )
+    slab_index = max_slab_index;
+  else
   {
-    if(interaction_planes[i].first == X_DIMENSION)
-    {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_x_planes[ interaction_planes[i].second ],
-                                    point[X_DIMENSION],
-                                    direction[X_DIMENSION] );
+    slab_index = static_cast<long>( scaled_coordinate );
 
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = X_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
-    }
-    else if(interaction_planes[i].first == Y_DIMENSION)
+    if( !d_uniform_plane_spacing[dimension] )
     {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_y_planes[ interaction_planes[i].second ],
-                                    point[Y_DIMENSION],
-                                    direction[Y_DIMENSION] );
+      const std::vector<PlaneIndex>& hash_grid =
+        d_plane_hash_grids[dimension];
 
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = Y_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
-    }
-    else if(interaction_planes[i].first == Z_DIMENSION)
-    {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_z_planes[ interaction_planes[i].second ],
-                                    point[Z_DIMENSION],
-                                    direction[Z_DIMENSION] );
+      // Search the slabs that overlap the hash grid bin
+      const long lower_slab_index = hash_grid[slab_index];
+      const long upper_slab_index = hash_grid[slab_index+1];
 
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = Z_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
+      slab_index = lower_slab_index;
+
+      while( slab_index < upper_slab_index &&
+             planes[slab_index+1] <= coordinate )
+        ++slab_index;
     }
   }
-}
 
-// Calculate distance to a plane from a ray along its direction
-double StructuredHexMesh::findDistanceToInteractionPlane(
-                                       const double interaction_plane_location,
-                                       const double position_component,
-                                       const double direction_component ) const
-{
-  return (interaction_plane_location - position_component)/direction_component;
-}
+  // Correct for roundoff in the slab index calculation
+  while( slab_index > 0 && coordinate < planes[slab_index] )
+    --slab_index;
 
-// Form the incrementer so that the particle increments over the planes in the correct direction
-void StructuredHexMesh::setIncrementer( size_t incrementer[3],
-                                        const double direction[3] ) const
-{
-  for(size_t i = 0; i < 3; ++i)
-  {
-    if(direction[i] >= 0)
-    {
-      incrementer[i] = 1;
-    }
-    else
-    {
-      incrementer[i] = -1;
-    }
-  }
-}
+  while( slab_index < max_slab_index && planes[slab_index+1] <= coordinate )
+    ++slab_index;
 
-// Overloaded method to set the hex plane indices of a given particle
-void StructuredHexMesh::setHexPlaneIndices(
-                                        const double current_point[3],
-                                        PlaneIndex hex_plane_indices[3] ) const
-{
-  // Make sure that the point is in the mesh
-  testPrecondition( this->isPointInMesh(current_point) );
-
-  hex_plane_indices[X_DIMENSION] =
-    this->setHexPlaneIndex( current_point[X_DIMENSION], d_x_planes, X_DIMENSION );
-  hex_plane_indices[Y_DIMENSION] =
-    this->setHexPlaneIndex( current_point[Y_DIMENSION], d_y_planes, Y_DIMENSION );
-  hex_plane_indices[Z_DIMENSION] =
-    this->setHexPlaneIndex( current_point[Z_DIMENSION], d_z_planes, Z_DIMENSION );
-
-  testPostcondition( hex_plane_indices[X_DIMENSION] >= 0 && hex_plane_indices[X_DIMENSION] <= d_x_planes.size()-2);
-  testPostcondition( hex_plane_indices[Y_DIMENSION] >= 0 && hex_plane_indices[Y_DIMENSION] <= d_y_planes.size()-2);
-  testPostcondition( hex_plane_indices[Z_DIMENSION] >= 0 && hex_plane_indices[Z_DIMENSION] <= d_z_planes.size()-2);
+  return slab_index;
 }
 
-// Set hex plane indices for a particle at its intersection point
-void StructuredHexMesh::setHexPlaneIndices(
-                                        const Dimension intersection_dimension,
-                                        const double current_point[3],
-                                        PlaneIndex hex_plane_indices[3] ) const
+// Clip a batch of line segments to the mesh bounding box
+/*! \details The directions of the segments and the distances along each
+ * segment where the mesh bounding box is entered and exited (slab method)
+ * will be calculated. The entry distance will not be less than the exit
+ * distance if a segment does not intersect the mesh bounding box. The loops
+ * are over the segments and are free of branches so that they can be
+ * vectorized.
+ */
+void StructuredHexMesh::clipSegmentsToMesh(
+                              const std::array<double,3>* start_points,
+                              const std::array<double,3>* end_points,
+                              const size_t number_of_segments,
+                              ClippedSegmentBatch& clipped_segments ) const
 {
-  // Check which dimension was intersected
-  if( intersection_dimension == X_DIMENSION )
-  {
-    /*
-      Check which bounding plane of that intersection was intersected. If not the
-      first plane, then it must have been the other.
-    */
+  // Make sure that the batch size is valid
+  testPrecondition( number_of_segments <= s_segment_batch_size );
 
-    if( current_point[X_DIMENSION] <= d_x_planes.front() + s_tol &&
-        current_point[X_DIMENSION] >= d_x_planes.front() - s_tol )
-    {
-      hex_plane_indices[X_DIMENSION] = 0;
-    }
-    else
-    {
-      hex_plane_indices[X_DIMENSION] = d_x_planes.size() - 2;
-    }
-    hex_plane_indices[Y_DIMENSION] =
-      this->setHexPlaneIndex( current_point[Y_DIMENSION], d_y_planes, Y_DIMENSION);
-    hex_plane_indices[Z_DIMENSION] =
-      this->setHexPlaneIndex( current_point[Z_DIMENSION], d_z_planes, Z_DIMENSION);
-  }
-  else if( intersection_dimension == Y_DIMENSION )
+  double segment_length[s_segment_batch_size];
+
+  for( size_t i = 0; i < number_of_segments; ++i )
   {
-    if( current_point[Y_DIMENSION] <= d_y_planes.front() + s_tol &&
-        current_point[Y_DIMENSION] >= d_y_planes.front() - s_tol )
-    {
-      hex_plane_indices[Y_DIMENSION] = 0;
-    }
-    else
-    {
-      hex_plane_indices[Y_DIMENSION] = d_y_planes.size() - 2;
-    }
-    hex_plane_indices[X_DIMENSION] =
-      this->setHexPlaneIndex( current_point[X_DIMENSION], d_x_planes, X_DIMENSION);
-    hex_plane_indices[Z_DIMENSION] =
-      this->setHexPlaneIndex( current_point[Z_DIMENSION], d_z_planes, Z_DIMENSION);
+    const double delta_x = end_points[i][X_DIMENSION] - start_points[i][X_DIMENSION];
+    const double delta_y = end_points[i][Y_DIMENSION] - start_points[i][Y_DIMENSION];
+    const double delta_z = end_points[i][Z_DIMENSION] - start_points[i][Z_DIMENSION];
+
+    segment_length[i] =
+      std::sqrt( delta_x*delta_x + delta_y*delta_y + delta_z*delta_z );
 
+    const double inverse_length =
+      (segment_length[i] > 0.0 ? 1.0/segment_length[i] : 0.0);
+
+    clipped_segments.direction[X_DIMENSION][i] = delta_x*inverse_length;
+    clipped_segments.direction[Y_DIMENSION][i] = delta_y*inverse_length;
+    clipped_segments.direction[Z_DIMENSION][i] = delta_z*inverse_length;
+
+    clipped_segments.entry_distance[i] = 0.0;
+    clipped_segments.exit_distance[i] = segment_length[i];
   }
-  else if( intersection_dimension == Z_DIMENSION )
+
+  for( size_t d = X_DIMENSION; d <= Z_DIMENSION; ++d )
   {
-    if( current_point[Z_DIMENSION] <= d_z_planes.front() + s_tol &&
-        current_point[Z_DIMENSION] >= d_z_planes.front() - s_tol )
-    {
-      hex_plane_indices[Z_DIMENSION] = 0;
-    }
-    else
+    const std::vector<double>& planes =
+      this->getPlanes( static_cast<Dimension>( d ) );
+
+    const double lower_bound = planes.front();
+    const double upper_bound = planes.back();
+
+    for( size_t i = 0; i < number_of_segments; ++i )
     {
-      hex_plane_indices[Z_DIMENSION] = d_z_planes.size() - 2;
-    }
-    hex_plane_indices[X_DIMENSION] =
-      this->setHexPlaneIndex( current_point[X_DIMENSION], d_x_planes, X_DIMENSION);
-    hex_plane_indices[Y_DIMENSION] =
-      this->setHexPlaneIndex( current_point[Y_DIMENSION], d_y_planes, Y_DIMENSION);
-  }
+      const double position = start_points[i][d];
+      const double direction = clipped_segments.direction[d][i];
 
-  testPostcondition( hex_plane_indices[X_DIMENSION] >= 0 && hex_plane_indices[X_DIMENSION] <= d_x_planes.size()-2);
-  testPostcondition( hex_plane_indices[Y_DIMENSION] >= 0 && hex_plane_indices[Y_DIMENSION] <= d_y_planes.size()-2);
-  testPostcondition( hex_plane_indices[Z_DIMENSION] >= 0 && hex_plane_indices[Z_DIMENSION] <= d_z_planes.size()-2);
-}
+      // Segments that are parallel to the planes of this dimension either
+      // always or never overlap the mesh slab
+      const bool parallel = (direction == 0.0);
 
-// Set individual hex plane indices for particle.
-auto StructuredHexMesh::setHexPlaneIndex(
-                         const double position_component,
-                         const std::vector<double>& plane_set,
-                         const Dimension plane_dimension  ) const -> PlaneIndex
-{
-  PlaneIndex hex_plane_index;
+      const bool inside_slab =
+        (lower_bound <= position && position <= upper_bound);
 
-  if( position_component == plane_set.back() )
-  {
-    hex_plane_index = plane_set.size() - 2;
-  }
-  else
-  {
-    hex_plane_index = Search::binaryLowerBoundIndex( plane_set.begin(),
-                                                     plane_set.end(),
-                                                     position_component );
-  }
+      const double inverse_direction =
+        (parallel ? 0.0 : 1.0/direction);
 
-  return hex_plane_index;
-}
+      clipped_segments.inverse_direction[d][i] = inverse_direction;
 
-// Returns a set of distances to up to 3 planes that bound the mesh which the particle may interact with
-void StructuredHexMesh::findBoundingInteractionPlaneDistances(
-  const double point[3],
-  const double direction[3],
-  std::vector<std::pair<Dimension,double> >& bounding_intersection_data ) const
-{
-  this->checkPlaneSet( d_x_planes,
-                       point[X_DIMENSION],
-                       direction[X_DIMENSION],
-                       bounding_intersection_data,
-                       X_DIMENSION );
-
-  this->checkPlaneSet( d_y_planes,
-                       point[Y_DIMENSION],
-                       direction[Y_DIMENSION],
-                       bounding_intersection_data,
-                       Y_DIMENSION );
-
-  this->checkPlaneSet( d_z_planes,
-                       point[Z_DIMENSION],
-                       direction[Z_DIMENSION],
-                       bounding_intersection_data,
-                       Z_DIMENSION );
-}
+      const double lower_distance = (lower_bound - position)*inverse_direction;
+      const double upper_distance = (upper_bound - position)*inverse_direction;
 
-// Checks an individual set of planes for interaction plane in that dimension
-void StructuredHexMesh::checkPlaneSet(
-                   const std::vector<double>& plane_set,
-                   const double position_component,
-                   const double direction_component,
-                   std::vector<std::pair<Dimension, double> >& boundary_planes,
-                   const Dimension plane_dimension ) const
-{
-  if( position_component < plane_set.front() && direction_component > 0 )
-  {
-    boundary_planes.push_back( std::make_pair(plane_dimension,
-                                              (plane_set.front() - position_component)/direction_component) );
-  }
-  else if( position_component > plane_set.back() && direction_component < 0 )
-  {
-    boundary_planes.push_back( std::make_pair( plane_dimension,
-                                               (plane_set.back() - position_component)/direction_component ) );
+      const double near_distance =
+        (parallel ? (inside_slab ? -std::numeric_limits<double>::infinity() :
+                     std::numeric_limits<double>::infinity()) :
+         std::min( lower_distance, upper_distance ));
+
+      const double far_distance =
+        (parallel ? (inside_slab ? std::numeric_limits<double>::infinity() :
+                     -std::numeric_limits<double>::infinity()) :
+         std::max( lower_distance, upper_distance ));
+
+      clipped_segments.entry_distance[i] =
+        std::max( clipped_segments.entry_distance[i], near_distance );
+
+      clipped_segments.exit_distance[i] =
+        std::min( clipped_segments.exit_distance[i], far_distance );
+    }
   }
 }
 
-// Returns whether or not a particle actually hit the mesh surface
-bool StructuredHexMesh::isPointOnMeshSurface(
-                                  const double point[3],
-                                  const Dimension dimension_intersected ) const
+// Trace a clipped segment through the mesh
+/*! \details The segment is traced from its mesh entry point to its mesh exit
+ * point (or end point) one plane crossing at a time (3D-DDA). The distance
+ * to the next plane crossing of each dimension is always calculated from the
+ * segment start point so that roundoff does not accumulate. Plane crossings
+ * that coincide (e.g. at hex edges and corners) will not result in zero
+ * length track length entries.
+ */
+void StructuredHexMesh::traceThroughMesh(
+              const double start_point[3],
+              const ClippedSegmentBatch& clipped_segments,
+              const size_t segment_index,
+              ElementHandleTrackLengthArray& hex_element_track_lengths ) const
 {
-  bool point_on_mesh = false;
+  const double* planes[3] = {d_x_planes.data(),
+                             d_y_planes.data(),
+                             d_z_planes.data()};
+
+  const long max_slab_indices[3] = {static_cast<long>( d_x_planes.size() ) - 2,
+                                    static_cast<long>( d_y_planes.size() ) - 2,
+                                    static_cast<long>( d_z_planes.size() ) - 2};
+
+  const double direction[3] =
+    {clipped_segments.direction[X_DIMENSION][segment_index],
+     clipped_segments.direction[Y_DIMENSION][segment_index],
+     clipped_segments.direction[Z_DIMENSION][segment_index]};
+
+  const double inverse_direction[3] =
+    {clipped_segments.inverse_direction[X_DIMENSION][segment_index],
+     clipped_segments.inverse_direction[Y_DIMENSION][segment_index],
+     clipped_segments.inverse_direction[Z_DIMENSION][segment_index]};
 
-  if(dimension_intersected == X_DIMENSION)
+  const double exit_distance = clipped_segments.exit_distance[segment_index];
+
+  double distance = clipped_segments.entry_distance[segment_index];
+
+  // Find the hex that the segment enters and the distance to the next plane
+  // crossing of each dimension
+  long hex_plane_indices[3];
+  long incrementer[3];
+  double next_crossing_distance[3];
+
+  for( size_t d = X_DIMENSION; d <= Z_DIMENSION; ++d )
   {
-    if(this->checkWithinBoundingPlane( point[Y_DIMENSION], d_y_planes ) )
+    const double entry_coordinate = start_point[d] + direction[d]*distance;
+
+    hex_plane_indices[d] =
+      this->findElementPlaneIndex( static_cast<Dimension>( d ),
+                                   entry_coordinate );
+
+    if( direction[d] > 0.0 )
     {
-      if(this->checkWithinBoundingPlane( point[Z_DIMENSION], d_z_planes ) )
-      {
-        point_on_mesh = true;
-      }
+      incrementer[d] = 1;
+
+      next_crossing_distance[d] =
+        (planes[d][hex_plane_indices[d]+1] - start_point[d])*inverse_direction[d];
     }
-  }
-  else if(dimension_intersected == Y_DIMENSION)
-  {
-    if(this->checkWithinBoundingPlane( point[X_DIMENSION], d_x_planes ) )
+    else if( direction[d] < 0.0 )
     {
-      if(this->checkWithinBoundingPlane( point[Z_DIMENSION], d_z_planes ) )
-      {
-        point_on_mesh = true;
-      }
+      incrementer[d] = -1;
+
+      // A particle on a plane moving in the negative direction is in the
+      // lower hex
+      if( hex_plane_indices[d] > 0 &&
+          entry_coordinate <= planes[d][hex_plane_indices[d]] )
+        --hex_plane_indices[d];
+
+      next_crossing_distance[d] =
+        (planes[d][hex_plane_indices[d]] - start_point[d])*inverse_direction[d];
     }
-  }
-  else if(dimension_intersected == Z_DIMENSION)
-  {
-    if(this->checkWithinBoundingPlane( point[X_DIMENSION], d_x_planes ) )
+    else
     {
-      if(this->checkWithinBoundingPlane( point[Y_DIMENSION], d_y_planes ) )
-      {
-        point_on_mesh = true;
-      }
+      incrementer[d] = 0;
+
+      next_crossing_distance[d] = std::numeric_limits<double>::infinity();
     }
   }
-  return point_on_mesh;
-}
 
-// Function for checking each individual plane to see if it is within bounds
-bool StructuredHexMesh::checkWithinBoundingPlane(
-                                   const double position_component,
-                                   const std::vector<double>& plane_set ) const
-{
-  if( plane_set.front() <= position_component &&
-      position_component <= plane_set.back() )
+  while( true )
   {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
-}
+    // Find the dimension of the next plane crossing
+    size_t crossing_dimension = X_DIMENSION;
 
-// Pushes point along direction to new intersection point
-void StructuredHexMesh::pushPoint( double point[3],
-                                   const double direction[3],
-                                   const double push_distance ) const
-{
-  point[X_DIMENSION] += direction[X_DIMENSION]*push_distance;
-  point[Y_DIMENSION] += direction[Y_DIMENSION]*push_distance;
-  point[Z_DIMENSION] += direction[Z_DIMENSION]*push_distance;
-}
+    if( next_crossing_distance[Y_DIMENSION] <
+        next_crossing_distance[crossing_dimension] )
+      crossing_dimension = Y_DIMENSION;
 
-// Return whether or not a particle has exited the mesh
-bool StructuredHexMesh::didParticleLeaveMesh(
-                           Dimension intersection_dimension,
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes ) const
-{
-  bool exit_mesh = false;
+    if( next_crossing_distance[Z_DIMENSION] <
+        next_crossing_distance[crossing_dimension] )
+      crossing_dimension = Z_DIMENSION;
 
-  for( size_t i = 0; i < interaction_planes.size(); ++i )
-  {
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == X_DIMENSION )
-    {
-      if( interaction_planes[i].second == d_x_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
-    }
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == Y_DIMENSION )
-    {
-      if( interaction_planes[i].second == d_y_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
-    }
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == Z_DIMENSION )
+    const double crossing_distance =
+      std::min( next_crossing_distance[crossing_dimension], exit_distance );
+
+    if( crossing_distance > distance )
     {
-      if( interaction_planes[i].second == d_z_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
+      hex_element_track_lengths.push_back(
+         std::make_tuple( this->findIndex( hex_plane_indices[X_DIMENSION],
+                                           hex_plane_indices[Y_DIMENSION],
+                                           hex_plane_indices[Z_DIMENSION] ),
+                          std::array<double,3>( {start_point[X_DIMENSION] + direction[X_DIMENSION]*distance,
+                                                 start_point[Y_DIMENSION] + direction[Y_DIMENSION]*distance,
+                                                 start_point[Z_DIMENSION] + direction[Z_DIMENSION]*distance} ),
+                          crossing_distance - distance ) );
+
+      distance = crossing_distance;
     }
-  }
 
-  return exit_mesh;
+    // Check if the track length is exhausted
+    if( crossing_distance >= exit_distance )
+      break;
+
+    // Move to the next hex
+    hex_plane_indices[crossing_dimension] += incrementer[crossing_dimension];
+
+    // Check if the particle left the mesh
+    if( hex_plane_indices[crossing_dimension] < 0 ||
+        hex_plane_indices[crossing_dimension] >
+        max_slab_indices[crossing_dimension] )
+      break;
+
+    const long next_plane_index = (incrementer[crossing_dimension] > 0 ?
+                                   hex_plane_indices[crossing_dimension] + 1 :
+                                   hex_plane_indices[crossing_dimension]);
+
+    next_crossing_distance[crossing_dimension] =
+      (planes[crossing_dimension][next_plane_index] -
+       start_point[crossing_dimension])*inverse_direction[crossing_dimension];
+  }
 }
 
 // Calculate hex index from respective plane indices
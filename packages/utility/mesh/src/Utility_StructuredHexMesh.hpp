@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <utility>
+#include <array>
 
 // Boost Includes
 #include <boost/serialization/vector.hpp>
@@ -27,7 +28,10 @@ namespace Utility{
 /*! The structured hexahedral mesh class
  * \details This class stores the mesh itself and can be used to acquire
  * important information from the mesh (e.g. intersections of a line segment
- * with mesh elements).
+ * with mesh elements). Line segments are traced through the mesh using a 3D
+ * digital differential analyzer (DDA). The plane that a coordinate falls
+ * in is found in constant time for uniformly spaced planes and with a hashed
+ * lookup for non-uniformly spaced planes.
  */
 class StructuredHexMesh : public Mesh
 {
@@ -115,6 +119,12 @@ public:
                             ElementHandleTrackLengthArray&
                             hex_element_track_lengths ) const final override;
 
+  //! Returns the hex IDs and partial track lengths along a batch of line segments
+  void computeTrackLengths( const std::vector<std::array<double,3> >& start_points,
+                            const std::vector<std::array<double,3> >& end_points,
+                            ElementHandleTrackLengthArray& hex_element_track_lengths,
+                            std::vector<size_t>& segment_offsets ) const final override;
+
   //! Export the mesh to a file (type determined by suffix - e.g. mesh.vtk)
   void exportData( const std::string& output_file_name,
                    const TagNameSet& tag_root_names,
@@ -133,97 +143,51 @@ private:
                           Y_DIMENSION = 1,
                           Z_DIMENSION = 2 };
 
-  // Returns a pair where the first member is true if the ray intersects with the mesh and the second is the distance to the intersection point
-  void doesRayIntersectMesh(
-                  const double point[3],
-                  const double direction[3],
-                  const double track_length,
-                  std::tuple<bool,Dimension,double>& intersection_data ) const;
+  // The maximum number of segments that are clipped together
+  static const size_t s_segment_batch_size = 16;
+
+  // The clipped segment batch data (structure-of-arrays layout)
+  struct ClippedSegmentBatch
+  {
+    // The segment directions
+    double direction[3][s_segment_batch_size];
+
+    // The inverse of the segment direction components
+    double inverse_direction[3][s_segment_batch_size];
+
+    // The distance along each segment where the mesh is entered
+    double entry_distance[s_segment_batch_size];
+
+    // The distance along each segment where the mesh is exited
+    double exit_distance[s_segment_batch_size];
+  };
+
+  // Initialize the plane lookup data
+  void initializePlaneLookupData();
+
+  // Initialize the plane lookup data for a dimension
+  void initializePlaneLookupData( const Dimension dimension );
+
+  // Return the planes of a dimension
+  const std::vector<double>& getPlanes( const Dimension dimension ) const;
 
-  // Trace particle path through mesh until it dies or leaves mesh
+  // Find the index of the element slab along a dimension that a coordinate is in
+  PlaneIndex findElementPlaneIndex( const Dimension dimension,
+                                    const double coordinate ) const;
+
+  // Clip a batch of line segments to the mesh bounding box
+  void clipSegmentsToMesh( const std::array<double,3>* start_points,
+                           const std::array<double,3>* end_points,
+                           const size_t number_of_segments,
+                           ClippedSegmentBatch& clipped_segments ) const;
+
+  // Trace a clipped segment through the mesh
   void traceThroughMesh(
-              double point[3],
-              const double direction[3],
-              const double track_length,
-              PlaneIndex hex_plane_indices[3],
+              const double start_point[3],
+              const ClippedSegmentBatch& clipped_segments,
+              const size_t segment_index,
               ElementHandleTrackLengthArray& hex_element_track_lengths ) const;
 
-  // Find the interaction planes that a particle will interact with
-  void findInteractionPlanes( const double point[3],
-                              const double direction[3],
-                              const PlaneIndex hex_plane_indices[3],
-                              std::vector<std::pair<Dimension,PlaneIndex> >&
-                              interaction_planes ) const;
-
-  // Find the intersection distance along the path of the particle with the next hex
-  void findIntersectionDistance(
-                    const double point[3],
-                    const double direction[3],
-                    const std::vector<std::pair<Dimension,PlaneIndex> >&
-                    interaction_planes,
-                    std::pair<Dimension,double>& intersection_distance ) const;
-
-  // Calculate distance to a plane from a ray along its direction
-  double findDistanceToInteractionPlane(
-                                      const double interaction_plane_location,
-                                      const double position_component,
-                                      const double direction_component ) const;
-
-  // Form the incrementer so that the particle increments over the planes in the correct direction
-  void setIncrementer( size_t incrementer[3],
-                       const double direction[3] ) const;
-
-  // set the plane indices that make up the hex element index
-  void setHexPlaneIndices( const double current_point[3],
-                           PlaneIndex hex_plane_indices[3] )const;
-
-  // overloaded function for setting member indices
-  void setHexPlaneIndices( const Dimension intersection_dimension,
-                           const double current_point[3],
-                           PlaneIndex hex_plane_indices[3] )const;
-
-  // Set individual hex plane indicies for particle.
-  PlaneIndex setHexPlaneIndex( const double position_component,
-                               const std::vector<double>& plane_set,
-                               const Dimension plane_dimension  ) const;
-
-  // Returns a set of distances to up to 3 planes that bound the mesh which the particle may interact with
-  void findBoundingInteractionPlaneDistances(
-                                    const double point[3],
-                                    const double direction[3],
-                                    std::vector<std::pair<Dimension, double> >&
-                                    bounding_intersection_data  ) const;
-
-  // Checks an individual set of planes for interaction plane in that dimension
-  void checkPlaneSet( const std::vector<double>& plane_set,
-                      const double position_component,
-                      const double direction_component,
-                      std::vector<std::pair<Dimension, double> >& boundary_planes,
-                      const Dimension plane_dimension ) const;
-
-  // Returns whether or not a particle actually hit the mesh surface
-  bool isPointOnMeshSurface( const double point[3],
-                             const Dimension dimension_intersected ) const;
-
-  // function for checking each individual plane to see if it is within bounds
-  bool checkWithinBoundingPlane( const double position_component,
-                                 const std::vector<double>& plane_set )const;
-
-  // determines if the particle has exited the mesh
-  bool didParticleLeaveMesh(
-                           const Dimension intersection_dimension,
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes ) const;
-
-  // sets the incrementer for mesh iteration
-  void setIncrementer( const double direction[3],
-                       int incrementer[3] ) const;
-
-  // pushes point along direction to new intersection point
-  void pushPoint( double point[3],
-                  const double direction[3],
-                  const double push_distance ) const;
-
   // Compute hex index from plane indices
   size_t findIndex( const size_t i, const size_t j, const size_t k ) const;
 
@@ -243,9 +207,6 @@ private:
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
-  // The tolerance used for geometric tests
-  static const double s_tol;
-
   // The plane location member data
   std::vector<double> d_x_planes;
   std::vector<double> d_y_planes;
@@ -253,6 +214,16 @@ private:
 
   // The hex elements (ids)
   std::vector<ElementHandle> d_hex_elements;
+
+  // Records if the planes of each dimension are uniformly spaced
+  std::array<bool,3> d_uniform_plane_spacing;
+
+  // The inverse plane spacing (uniform spacing) or inverse plane hash grid
+  // bin width (non-uniform spacing) of each dimension
+  std::array<double,3> d_inverse_plane_lookup_bin_widths;
+
+  // The plane hash grid of each dimension (non-uniform spacing only)
+  std::array<std::vector<PlaneIndex>,3> d_plane_hash_grids;
 };
 
 // Save the data to an archive
@@ -281,6 +252,9 @@ void StructuredHexMesh::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_y_planes );
   ar & BOOST_SERIALIZATION_NVP( d_z_planes );
   ar & BOOST_SERIALIZATION_NVP( d_hex_elements );
+
+  // Rebuild the plane lookup data
+  this->initializePlaneLookupData();
 }
 
 } // end Utility namespace
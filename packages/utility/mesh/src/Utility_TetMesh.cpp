@@ -6,12 +6,16 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // Boost Includes
 #include <boost/serialization/array_wrapper.hpp>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // This must be included first
 #include "Utility_TetMesh.hpp"
+#include "Utility_TetMeshTracker.hpp"
 #include "Utility_TetrahedronHelpers.hpp"
 #include "Utility_3DCartesianVectorHelpers.hpp"
 #include "Utility_MOABException.hpp"
@@ -24,7 +28,6 @@
 #include <moab/Interface.hpp>
 #include <moab/Core.hpp>
 #include <moab/BoundBox.hpp>
-#include <moab/AdaptiveKDTree.hpp>
 #include <moab/Matrix3.hpp>
 #endif // end HAVE_FRENSIE_MOAB
 
@@ -35,7 +38,10 @@ namespace Utility{
  * This class is used to hide the moab api from the Utility::TetMesh
  * declaration. Note that all moab::EntityHandle objects will be stored as
  * Utility::Mesh::ElementHandle objects (uint64_t) instead. This is done to
- * ensure that every mesh archive is the same across systems.
+ * ensure that every mesh archive is the same across systems. Moab is only
+ * used to load the mesh and to export mesh data. Point location and track
+ * length queries are handled by a Utility::TetMeshTracker, which is rebuilt
+ * from the moab connectivity data whenever the mesh is constructed or loaded.
  */
 class TetMeshImpl
 {
@@ -109,9 +115,8 @@ private:
   void createTetMeshset( moab::Range& all_tet_elements,
                          const bool verbose );
 
-  // Create the kd-tree
-  void createKDTree( moab::Range& all_tet_elements,
-                     const bool verbose );
+  // Create the tet mesh tracker
+  void createTetMeshTracker( const bool verbose );
 
 #endif // end HAVE_FRENSIE_MOAB
 
@@ -145,15 +150,9 @@ private:
   // The tet meshset
   ElementHandle d_tet_meshset;
 
-  // The root of the kd-tree
-  ElementHandle d_kd_tree_root;
-
-  // The kd-tree for finding point in tet
-  std::unique_ptr<moab::AdaptiveKDTree> d_kd_tree;
-
-  // The map of tet ids and barycentric coordinate transform matrices
-  std::unordered_map<ElementHandle,std::pair<std::array<double,9>,std::array<double,3> > >
-  d_tet_barycentric_data;
+  // The tet mesh tracker (tet indices correspond to the tet element handle
+  // indices)
+  std::unique_ptr<TetMeshTracker> d_tet_mesh_tracker;
 
   // The tet element handles
   std::vector<ElementHandle> d_tets;
@@ -165,7 +164,7 @@ const double TetMeshImpl::s_tol = 1e-6;
 
 } // end Utility namespace
 
-BOOST_CLASS_VERSION( Utility::TetMeshImpl, 0 );
+BOOST_CLASS_VERSION( Utility::TetMeshImpl, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( TetMeshImpl, Utility );
 
 namespace Utility{
@@ -210,20 +209,16 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
     d_display_warnings( display_warnings ),
     d_moab_interface( new moab::Core ),
     d_tet_meshset(),
-    d_kd_tree_root(),
-    d_kd_tree( new moab::AdaptiveKDTree( d_moab_interface.get() ) ),
-    d_tet_barycentric_data(),
+    d_tet_mesh_tracker(),
     d_tets()
 #endif // end HAVE_FRENSIE_MOAB
 {
 #ifdef HAVE_FRENSIE_MOAB
-  moab::ErrorCode return_value;
-
   moab::Range all_tet_elements;
 
   this->createTetMeshset( all_tet_elements, verbose_construction );
 
-  // Construct the extra tet data
+  // Cache the tet element handles
   for( moab::Range::const_iterator tet_handle_it = all_tet_elements.begin();
        tet_handle_it != all_tet_elements.end();
        ++tet_handle_it )
@@ -233,49 +228,12 @@ TetMeshImpl::TetMeshImpl( const std::string& input_mesh_file_name,
                         Utility::MOABException,
                         "An invalid tet element was found!" );
 
-    moab::EntityHandle tet_handle = *tet_handle_it;
-
     // Add the tet handle to the cached list of element handles
-    d_tets.push_back( tet_handle );
-
-    // Extract the vertex data for the given tet
-    {
-      std::vector<moab::EntityHandle> vertex_handles;
-
-      d_moab_interface->get_connectivity( &tet_handle, 1, vertex_handles );
-
-      // Test that the vertex entity contains four points
-      TEST_FOR_EXCEPTION( vertex_handles.size() != 4,
-                          Utility::MOABException,
-                          "A tet was found with an invalid number of vertices "
-                          "(" << vertex_handles.size() << " != 4)" );
-
-      std::array<double,3> vertices[4];
-
-      for( size_t i = 0; i < vertex_handles.size(); ++i )
-      {
-        d_moab_interface->get_coords( &vertex_handles[i],
-                                      1,
-                                      vertices[i].data() );
-      }
-
-      // Calculate barycentric matrix
-      std::pair<std::array<double,9>,std::array<double,3> >&
-        tet_barycentric_data = d_tet_barycentric_data[tet_handle];
-      Utility::calculateBarycentricTransformMatrix(
-                                           vertices[0].data(),
-                                           vertices[1].data(),
-                                           vertices[2].data(),
-                                           vertices[3].data(),
-                                           tet_barycentric_data.first.data() );
-
-      // Assign reference vertices (always the fourth vertex)
-      tet_barycentric_data.second = vertices[3];
-    }
+    d_tets.push_back( *tet_handle_it );
   }
 
-  // Create the kd-tree
-  this->createKDTree( all_tet_elements, verbose_construction );
+  // Create the tet mesh tracker
+  this->createTetMeshTracker( verbose_construction );
 #endif // end HAVE_FRENSIE_MOAB
 }
 
@@ -354,43 +312,76 @@ void TetMeshImpl::createTetMeshset( moab::Range& all_tet_elements,
   }
 }
 
-// Create the kd-tree
-void TetMeshImpl::createKDTree( moab::Range& all_tet_elements,
-                                const bool verbose_construction )
+// Create the tet mesh tracker
+/*! \details The vertex data of every tet is extracted from moab with a single
+ * connectivity query and a single coordinate query. The tracker tet indices
+ * correspond to the indices of the cached tet element handles.
+ */
+void TetMeshImpl::createTetMeshTracker( const bool verbose_construction )
 {
-  // Get the dimension of the input set
-  int current_dimension =
-    d_moab_interface->dimension_from_handle(all_tet_elements[0]);
+  if( verbose_construction )
+  {
+    FRENSIE_LOG_PARTIAL_NOTIFICATION( "Constructing tet mesh tracker ... " );
+  }
+
+  // Extract the vertex handles of every tet
+  TEST_FOR_EXCEPTION( d_tets.empty(),
+                      Utility::MOABException,
+                      "The tet mesh does not contain any tets!" );
 
-  moab::Range surface_triangles;
+  std::vector<moab::EntityHandle> tet_handles( d_tets.begin(), d_tets.end() );
+  std::vector<moab::EntityHandle> tet_vertex_handles;
 
-  // Determine the edges from the input set
   moab::ErrorCode return_value =
-    d_moab_interface->get_adjacencies( all_tet_elements,
-                                       current_dimension - 1,
-                                       true,
-                                       surface_triangles,
-                                       moab::Interface::UNION );
+    d_moab_interface->get_connectivity( tet_handles.data(),
+                                        tet_handles.size(),
+                                        tet_vertex_handles );
 
   TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
                       Utility::MOABException,
                       moab::ErrorCodeStr[return_value] );
 
-  all_tet_elements.merge( surface_triangles );
+  // Test that every tet contains four points
+  TEST_FOR_EXCEPTION( tet_vertex_handles.size() != 4*tet_handles.size(),
+                      Utility::MOABException,
+                      "A tet was found with an invalid number of vertices!" );
 
-  const char settings[]="MESHSET_FLAGS=0x1;TAG_NAME=0";
-  moab::FileOptions fileopts(settings);
+  // Extract the unique vertices
+  std::vector<moab::EntityHandle> vertex_handles( tet_vertex_handles );
 
-  if( verbose_construction )
-  {
-    FRENSIE_LOG_PARTIAL_NOTIFICATION( "Constructing kd-tree ... " );
-  }
+  std::sort( vertex_handles.begin(), vertex_handles.end() );
 
-  moab::EntityHandle tmp_kd_tree_root;
+  vertex_handles.erase( std::unique( vertex_handles.begin(),
+                                     vertex_handles.end() ),
+                        vertex_handles.end() );
 
-  d_kd_tree->build_tree( all_tet_elements, &tmp_kd_tree_root, &fileopts );
+  std::vector<std::array<double,3> > vertices( vertex_handles.size() );
 
-  d_kd_tree_root = tmp_kd_tree_root;
+  return_value = d_moab_interface->get_coords( vertex_handles.data(),
+                                               vertex_handles.size(),
+                                               vertices.front().data() );
+
+  TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                      Utility::MOABException,
+                      moab::ErrorCodeStr[return_value] );
+
+  // Convert the tet vertex handles to vertex indices
+  std::vector<std::array<size_t,4> > tet_vertex_indices( tet_handles.size() );
+
+  for( size_t i = 0; i < tet_handles.size(); ++i )
+  {
+    for( size_t j = 0; j < 4; ++j )
+    {
+      tet_vertex_indices[i][j] =
+        std::lower_bound( vertex_handles.begin(),
+                          vertex_handles.end(),
+                          tet_vertex_handles[4*i+j] ) - vertex_handles.begin();
+    }
+  }
+
+  d_tet_mesh_tracker.reset( new TetMeshTracker( vertices,
+                                                tet_vertex_indices,
+                                                s_tol ) );
 
   if( verbose_construction )
   {
@@ -527,51 +518,9 @@ bool TetMesh::isPointInMesh( const double point[3] ) const
 bool TetMeshImpl::isPointInMesh( const double point[3] ) const
 {
 #ifdef HAVE_FRENSIE_MOAB
-  // Find the leaf node that the point is in (if there is one)
-  moab::AdaptiveKDTreeIter kd_tree_iteration;
-
-  moab::ErrorCode return_value =
-    d_kd_tree->point_search( point, kd_tree_iteration );
-
-  // Check that the leaf actually contains the point (concave mesh)
-  if( return_value == moab::MB_SUCCESS && kd_tree_iteration.handle() != 0 )
-  {
-    moab::EntityHandle leaf_node = kd_tree_iteration.handle();
-
-    moab::Range tets_in_leaf;
-
-    return_value = d_moab_interface->get_entities_by_dimension( leaf_node,
-                                                                3,
-                                                                tets_in_leaf,
-                                                                false );
-
-    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
-                        Utility::MOABException,
-                        moab::ErrorCodeStr[return_value] );
-
-    // Quickly check if the point is likely in one of the tets
-    for( moab::Range::const_iterator tet_handle_it = tets_in_leaf.begin();
-         tet_handle_it != tets_in_leaf.end();
-         ++tet_handle_it )
-    {
-      const std::pair<std::array<double,9>,std::array<double,3> >&
-        tet_barycentric_data = d_tet_barycentric_data.find( *tet_handle_it )->second;
-
-      if( Utility::isPointInTet( point,
-                                 tet_barycentric_data.second.data(),
-                                 tet_barycentric_data.first.data(),
-                                 s_tol ) )
-      {
-        return true;
-      }
-    }
+  size_t tet_index;
 
-    // The point is not in any of the tets in the leaf node
-    return false;
-  }
-  // The point is outside of the mesh bounding box
-  else
-    return false;
+  return d_tet_mesh_tracker->findTetContainingPoint( point, tet_index );
 #else // HAVE_FRENSIE_MOAB
   return false;
 #endif // end HAVE_FRENSIE_MOAB
@@ -590,67 +539,24 @@ auto TetMeshImpl::whichElementIsPointIn( const double point[3] ) const -> Elemen
   testPrecondition( this->isPointInMesh( point ) );
 
 #ifdef HAVE_FRENSIE_MOAB
-  // Find the kd-tree leaf that contains the point
-  moab::AdaptiveKDTreeIter kd_tree_iterator;
-
-  moab::ErrorCode return_value = d_kd_tree->point_search( point,
-                                                          kd_tree_iterator );
-
-  TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
-                      Utility::MOABException,
-                      moab::ErrorCodeStr[return_value] );
-
-  TEST_FOR_EXCEPTION( kd_tree_iterator.handle() == 0,
-		      Utility::MOABException,
-		      moab::ErrorCodeStr[return_value] );
+  size_t tet_index;
 
-  moab::EntityHandle leaf = kd_tree_iterator.handle();
-  moab::Range tets_in_leaf;
-
-  return_value = d_moab_interface->get_entities_by_dimension( leaf,
-							      3,
-							      tets_in_leaf,
-							      false );
-
-  TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
-		      Utility::MOABException,
-		      moab::ErrorCodeStr[return_value] );
-
-  // A tet must be found since a leaf was found - failure to find a tet
-  // indicates a tolerance issue usually
+  // A tet should always be found since the point is in the mesh - failure to
+  // find a tet indicates a tolerance issue usually
   ElementHandle element_handle = 0;
 
-  for( moab::Range::const_iterator tet_handle_it = tets_in_leaf.begin();
-       tet_handle_it != tets_in_leaf.end();
-       ++tet_handle_it )
-  {
-    const std::pair<std::array<double,9>,std::array<double,3> >&
-      tet_barycentric_data = d_tet_barycentric_data.find( *tet_handle_it )->second;
-
-    if( Utility::isPointInTet( point,
-                               tet_barycentric_data.second.data(),
-                               tet_barycentric_data.first.data(),
-                               s_tol ) )
-    {
-      element_handle = *tet_handle_it;
-
-      break;
-    }
-  }
+  if( d_tet_mesh_tracker->findTetContainingPoint( point, tet_index ) )
+    element_handle = d_tets[tet_index];
 
   // Make sure that the tet has been found
-  if( element_handle == 0 && d_display_warnings )
+  else if( d_display_warnings )
   {
     FRENSIE_LOG_TAGGED_WARNING( "TetMesh",
                                 "The tetrahedron containing point {"
                                 << point[0] << "," << point[1] << ","
-                                << point[2] << "} could not be found ("
-                                << tets_in_leaf.size() << " tets in leaf)!" );
+                                << point[2] << "} could not be found!" );
   }
 
-  // Make sure that the leaf is valid
-  testPostcondition( tets_in_leaf.size() > 0 );
-
   return element_handle;
 #else // HAVE_FRENSIE_MOAB
   return 0;
@@ -675,147 +581,14 @@ void TetMeshImpl::computeTrackLengths( const double start_point[3],
                                        tet_element_track_lengths ) const
 {
 #ifdef HAVE_FRENSIE_MOAB
-  // Calculate the direction and determine the track length
-  double direction[3] = {end_point[0]-start_point[0],
-                         end_point[1]-start_point[1],
-                         end_point[2]-start_point[2]};
-
-  double track_length =
-    Utility::normalizeVectorAndReturnMagnitude( direction );
-
-  // Determine the distances to intersections with mesh elements
-  std::vector<double> ray_tet_intersections;
-  std::vector<moab::EntityHandle> tet_surface_triangles;
-
-  moab::ErrorCode return_value =
-    d_kd_tree->ray_intersect_triangles( d_kd_tree_root,
-                                        s_tol,
-                                        direction,
-                                        start_point,
-                                        tet_surface_triangles,
-                                        ray_tet_intersections,
-                                        0,
-                                        track_length );
-
-  TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
-                      Utility::MOABException,
-                      moab::ErrorCodeStr[return_value] );
-
-  // Clear the tet surface triangles - not used
-  tet_surface_triangles.clear();
-
-  // Reset the tet element track lengths
-  tet_element_track_lengths.clear();
-
-  if( ray_tet_intersections.size() > 0 )
-  {
-    // Sort all intersections of the ray with the tets
-    std::sort( ray_tet_intersections.begin(),
-               ray_tet_intersections.end() );
-
-    // Remove the first intersection if it is zero (start point on surface)
-    if( ray_tet_intersections.front() == 0.0 )
-      ray_tet_intersections.erase( ray_tet_intersections.begin() );
-
-    // Calculate the tet intersection points and partial track lengths
-    std::vector<moab::CartVect> array_of_hit_points;
-
-    // Add the origin point
-    {
-      moab::CartVect start_point_cv( start_point[0],
-                                     start_point[1],
-                                     start_point[2] );
-
-      array_of_hit_points.push_back( start_point_cv );
-    }
-
-    // Add all intermediate points
-    for( size_t i = 0; i < ray_tet_intersections.size(); ++i )
-    {
-      moab::CartVect hit_point;
-
-      hit_point[0] = direction[0]*ray_tet_intersections[i]
-        + start_point[0];
-      hit_point[1] = direction[1]*ray_tet_intersections[i]
-        + start_point[1];
-      hit_point[2] = direction[2]*ray_tet_intersections[i]
-        + start_point[2];
-
-      array_of_hit_points.push_back( hit_point );
-    }
-
-    // Add the end point (don't add if the end point lies on the surface)
-    if( ray_tet_intersections.back() < track_length )
-    {
-      moab::CartVect end_point_cv(end_point[0], end_point[1], end_point[2]);
-
-      array_of_hit_points.push_back( end_point_cv );
-
-      ray_tet_intersections.push_back( track_length );
-    }
-
-    // Determine the tet that each line segment passes through
-    for( size_t i = 0; i < ray_tet_intersections.size(); ++i )
-    {
-      moab::CartVect tet_centroid =
-        (array_of_hit_points[i+1] + array_of_hit_points[i])/2.0;
-
-      // Check that the centroid falls in the mesh - if the mesh is concave
-      // it is possible that it falls outside
-      if( this->isPointInMesh( tet_centroid.array() ) )
-      {
-        ElementHandle element_handle =
-          this->whichElementIsPointIn( tet_centroid.array() );
-
-        // Make sure that a tet was found (tolerance issue may prevent this)
-        if( element_handle == 0 )
-          continue;
-
-        double tet_track_length;
-
-        if( i != 0 )
-        {
-          tet_track_length = ray_tet_intersections[i] -
-            ray_tet_intersections[i-1];
-        }
-        else
-          tet_track_length = ray_tet_intersections[i];
-
-        tet_element_track_lengths.push_back( std::make_tuple(
-                           element_handle,
-                           std::array<double,3>( {array_of_hit_points[i][0],
-                                                  array_of_hit_points[i][1],
-                                                  array_of_hit_points[i][2]} ),
-                           tet_track_length ) );
-      }
-    }
-  }
-
-  // Handle the cases where there are no intersections
-  else
-  {
-    double mid_point[3] = {(end_point[0]+start_point[0])/2,
-                           (end_point[1]+start_point[1])/2,
-                           (end_point[2]+start_point[2])/2};
-
-    // case 1: line segment is entirely in one tet
-    if( this->isPointInMesh( mid_point ) )
-    {
-      ElementHandle element_handle = this->whichElementIsPointIn( mid_point );
-
-      if( element_handle != 0 )
-      {
-        tet_element_track_lengths.push_back( std::make_tuple(
-                                      element_handle,
-                                      std::array<double,3>( {start_point[0],
-                                                             start_point[1],
-                                                             start_point[2]} ),
-                                      track_length ) );
-      }
-    }
-
-    // case 2: track entirely misses mesh - do nothing
-  }
+  // Walk the segment through the tets
+  d_tet_mesh_tracker->computeTrackLengths( start_point,
+                                           end_point,
+                                           tet_element_track_lengths );
+
+  // Convert the tet indices to tet element handles
+  for( auto&& tet_track_length : tet_element_track_lengths )
+    std::get<0>( tet_track_length ) = d_tets[std::get<0>( tet_track_length )];
 #endif // end HAVE_FRENSIE_MOAB
 }
 
@@ -852,7 +625,6 @@ void TetMeshImpl::save( Archive& ar, const unsigned version ) const
 #ifdef HAVE_FRENSIE_MOAB
   ar & BOOST_SERIALIZATION_NVP( d_mesh_input_file );
   ar & BOOST_SERIALIZATION_NVP( d_display_warnings );
-  ar & BOOST_SERIALIZATION_NVP( d_tet_barycentric_data );
   ar & BOOST_SERIALIZATION_NVP( d_tets );
 #endif // end HAVE_FRENSIE_MOAB
 }
@@ -875,7 +647,18 @@ void TetMeshImpl::load( Archive& ar, const unsigned version )
 #ifdef HAVE_FRENSIE_MOAB
   ar & BOOST_SERIALIZATION_NVP( d_mesh_input_file );
   ar & BOOST_SERIALIZATION_NVP( d_display_warnings );
-  ar & BOOST_SERIALIZATION_NVP( d_tet_barycentric_data );
+
+  // Version 0 archives store the tet barycentric data, which is now
+  // recomputed by the tet mesh tracker
+  if( version == 0 )
+  {
+    std::unordered_map<ElementHandle,std::pair<std::array<double,9>,std::array<double,3> > >
+      tet_barycentric_data;
+
+    ar & boost::serialization::make_nvp( "d_tet_barycentric_data",
+                                         tet_barycentric_data );
+  }
+
   ar & BOOST_SERIALIZATION_NVP( d_tets );
 
   // Initialize the moab interface
@@ -886,12 +669,6 @@ void TetMeshImpl::load( Archive& ar, const unsigned version )
 
   this->createTetMeshset( all_tet_elements, false );
 
-  // Initialize the kd-tree
-  d_kd_tree.reset( new moab::AdaptiveKDTree( d_moab_interface.get() ) );
-
-  // Reconstruct the kd-tree
-  this->createKDTree( all_tet_elements, false );
-
   // Verify that the entity handles haven't changed
   for( auto&& cached_element_handle : d_tets )
   {
@@ -901,6 +678,9 @@ void TetMeshImpl::load( Archive& ar, const unsigned version )
                         "The tet mesh cannot be loaded from the archive "
                         "because the moab::EntityHandles have changed!" );
   }
+
+  // Reconstruct the tet mesh tracker
+  this->createTetMeshTracker( false );
 #endif // end HAVE_FRENSIE_MOAB
 }
 
@@ -90,6 +90,9 @@ public:
                             ElementHandleTrackLengthArray&
                             tet_element_track_lengths ) const final override;
 
+  //! Returns the tet IDs and partial track lengths along a batch of line segments
+  using Mesh::computeTrackLengths;
+
   //! Export the mesh to a vtk file (type determined by suffix - e.g. mesh.vtk)
   virtual void exportData( const std::string& output_file_name,
                            const TagNameSet& tag_root_names,
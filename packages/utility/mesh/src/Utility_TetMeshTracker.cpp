@@ -0,0 +1,698 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_TetMeshTracker.cpp
+//! \author Alex Robinson
+//! \brief  Tetrahedral mesh point location and track length class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_TetMeshTracker.hpp"
+#include "Utility_TetrahedronHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Initialize static member data
+const size_t TetMeshTracker::s_max_leaf_size;
+const size_t TetMeshTracker::s_max_traversal_stack_size;
+
+// Default constructor
+TetMeshTracker::TetMeshTracker()
+  : d_point_location_tolerance( 1e-6 ),
+    d_number_of_tets( 0 )
+{ /* ... */ }
+
+// Constructor
+/*! \details The vertices of each tet must be listed in the tet vertex
+ * indices array. Face i of a tet is the face opposite of vertex i.
+ */
+TetMeshTracker::TetMeshTracker(
+                 const std::vector<std::array<double,3> >& vertices,
+                 const std::vector<std::array<size_t,4> >& tet_vertex_indices,
+                 const double point_location_tolerance )
+  : d_point_location_tolerance( point_location_tolerance ),
+    d_number_of_tets( tet_vertex_indices.size() )
+{
+  // Make sure that the tolerance is valid
+  testPrecondition( point_location_tolerance >= 0.0 );
+
+  // Make sure that the tet vertex indices are valid
+  for( auto&& tet : tet_vertex_indices )
+  {
+    for( size_t i = 0; i < 4; ++i )
+    {
+      TEST_FOR_EXCEPTION( tet[i] >= vertices.size(),
+                          std::runtime_error,
+                          "A tet references vertex " << tet[i] << " but "
+                          "there are only " << vertices.size() <<
+                          " vertices!" );
+    }
+  }
+
+  TEST_FOR_EXCEPTION( tet_vertex_indices.size() >
+                      std::numeric_limits<unsigned>::max(),
+                      std::runtime_error,
+                      "The tet mesh tracker cannot handle more than "
+                      << std::numeric_limits<unsigned>::max() << " tets!" );
+
+  this->initializeBarycentricData( vertices, tet_vertex_indices );
+  this->initializeFaceAdjacencyTable( tet_vertex_indices );
+  this->initializeBVH( vertices, tet_vertex_indices );
+}
+
+// Initialize the barycentric transform data
+/*! \details The fourth vertex of every tet is used as the reference vertex.
+ */
+void TetMeshTracker::initializeBarycentricData(
+                 const std::vector<std::array<double,3> >& vertices,
+                 const std::vector<std::array<size_t,4> >& tet_vertex_indices )
+{
+  d_barycentric_matrices.resize( 9*d_number_of_tets );
+  d_reference_vertices.resize( 3*d_number_of_tets );
+
+  for( size_t i = 0; i < d_number_of_tets; ++i )
+  {
+    const std::array<size_t,4>& tet = tet_vertex_indices[i];
+
+    Utility::calculateBarycentricTransformMatrix(
+                                           vertices[tet[0]].data(),
+                                           vertices[tet[1]].data(),
+                                           vertices[tet[2]].data(),
+                                           vertices[tet[3]].data(),
+                                           &d_barycentric_matrices[9*i] );
+
+    std::copy( vertices[tet[3]].begin(),
+               vertices[tet[3]].end(),
+               &d_reference_vertices[3*i] );
+  }
+}
+
+// Initialize the face adjacency table
+/*! \details Every face is identified by its sorted vertex indices. After
+ * sorting the faces of all tets the faces that are shared by two tets will
+ * be adjacent in the sorted face list.
+ */
+void TetMeshTracker::initializeFaceAdjacencyTable(
+                 const std::vector<std::array<size_t,4> >& tet_vertex_indices )
+{
+  // The sorted face vertex indices and the tet face (4*tet index + face)
+  typedef std::pair<std::array<size_t,3>,size_t> Face;
+
+  std::vector<Face> faces( 4*d_number_of_tets );
+
+  for( size_t i = 0; i < d_number_of_tets; ++i )
+  {
+    const std::array<size_t,4>& tet = tet_vertex_indices[i];
+
+    for( size_t face = 0; face < 4; ++face )
+    {
+      Face& tet_face = faces[4*i + face];
+
+      size_t k = 0;
+
+      for( size_t j = 0; j < 4; ++j )
+      {
+        if( j != face )
+          tet_face.first[k++] = tet[j];
+      }
+
+      std::sort( tet_face.first.begin(), tet_face.first.end() );
+
+      tet_face.second = 4*i + face;
+    }
+  }
+
+  std::sort( faces.begin(), faces.end() );
+
+  d_face_neighbors.clear();
+  d_face_neighbors.resize( 4*d_number_of_tets, -1 );
+
+  for( size_t i = 1; i < faces.size(); ++i )
+  {
+    if( faces[i].first == faces[i-1].first )
+    {
+      d_face_neighbors[faces[i].second] = faces[i-1].second/4;
+      d_face_neighbors[faces[i-1].second] = faces[i].second/4;
+    }
+  }
+}
+
+// Initialize the BVH
+/*! \details The bounding box of each tet is expanded by the point location
+ * tolerance (relative to the largest tet bounding box dimension) so that
+ * points that are considered to be inside of a tet are always inside of its
+ * bounding box.
+ */
+void TetMeshTracker::initializeBVH(
+                 const std::vector<std::array<double,3> >& vertices,
+                 const std::vector<std::array<size_t,4> >& tet_vertex_indices )
+{
+  std::vector<std::array<double,6> > tet_bounding_boxes( d_number_of_tets );
+  std::vector<std::array<double,3> > tet_centroids( d_number_of_tets );
+
+  for( size_t i = 0; i < d_number_of_tets; ++i )
+  {
+    const std::array<size_t,4>& tet = tet_vertex_indices[i];
+
+    std::array<double,6>& box = tet_bounding_boxes[i];
+
+    double max_extent = 0.0;
+
+    for( size_t d = 0; d < 3; ++d )
+    {
+      box[d] = std::min( std::min( vertices[tet[0]][d], vertices[tet[1]][d] ),
+                         std::min( vertices[tet[2]][d], vertices[tet[3]][d] ) );
+      box[d+3] = std::max( std::max( vertices[tet[0]][d], vertices[tet[1]][d] ),
+                           std::max( vertices[tet[2]][d], vertices[tet[3]][d] ) );
+
+      max_extent = std::max( max_extent, box[d+3] - box[d] );
+
+      tet_centroids[i][d] = 0.25*(vertices[tet[0]][d] + vertices[tet[1]][d] +
+                                  vertices[tet[2]][d] + vertices[tet[3]][d]);
+    }
+
+    for( size_t d = 0; d < 3; ++d )
+    {
+      box[d] -= d_point_location_tolerance*max_extent;
+      box[d+3] += d_point_location_tolerance*max_extent;
+    }
+  }
+
+  d_bvh_tet_indices.resize( d_number_of_tets );
+
+  for( size_t i = 0; i < d_number_of_tets; ++i )
+    d_bvh_tet_indices[i] = i;
+
+  d_bvh_nodes.clear();
+
+  this->buildBVHNode( 0, d_number_of_tets, tet_bounding_boxes, tet_centroids );
+}
+
+// Build a BVH node
+/*! \details The tets are split into (up to) four groups by splitting them
+ * in half along the longest dimension of their centroid bounds and then
+ * splitting each half again. Groups that are small enough become leaves.
+ * Unused children have inverted (empty) bounding boxes so that the child
+ * bounding box tests never need to check the number of children.
+ */
+unsigned TetMeshTracker::buildBVHNode(
+                 const size_t begin,
+                 const size_t end,
+                 const std::vector<std::array<double,6> >& tet_bounding_boxes,
+                 const std::vector<std::array<double,3> >& tet_centroids )
+{
+  const unsigned node_index = d_bvh_nodes.size();
+
+  d_bvh_nodes.push_back( BVHNode() );
+
+  for( size_t c = 0; c < 4; ++c )
+  {
+    for( size_t d = 0; d < 3; ++d )
+    {
+      d_bvh_nodes[node_index].lower_bounds[d][c] =
+        std::numeric_limits<double>::infinity();
+      d_bvh_nodes[node_index].upper_bounds[d][c] =
+        -std::numeric_limits<double>::infinity();
+    }
+
+    d_bvh_nodes[node_index].child_indices[c] = 0;
+    d_bvh_nodes[node_index].child_tet_counts[c] = 0;
+  }
+
+  // Split a range of the tets in half along the longest centroid dimension
+  auto split_tets = [this,&tet_centroids]( const size_t split_begin,
+                                           const size_t split_end ) -> size_t
+  {
+    const size_t split_mid = split_begin + (split_end - split_begin)/2;
+
+    if( split_end - split_begin < 2 )
+      return split_mid;
+
+    double lower[3], upper[3];
+
+    for( size_t d = 0; d < 3; ++d )
+    {
+      lower[d] = std::numeric_limits<double>::infinity();
+      upper[d] = -std::numeric_limits<double>::infinity();
+    }
+
+    for( size_t i = split_begin; i < split_end; ++i )
+    {
+      for( size_t d = 0; d < 3; ++d )
+      {
+        lower[d] = std::min( lower[d], tet_centroids[d_bvh_tet_indices[i]][d] );
+        upper[d] = std::max( upper[d], tet_centroids[d_bvh_tet_indices[i]][d] );
+      }
+    }
+
+    size_t axis = 0;
+
+    if( upper[1] - lower[1] > upper[axis] - lower[axis] )
+      axis = 1;
+
+    if( upper[2] - lower[2] > upper[axis] - lower[axis] )
+      axis = 2;
+
+    std::nth_element( d_bvh_tet_indices.begin() + split_begin,
+                      d_bvh_tet_indices.begin() + split_mid,
+                      d_bvh_tet_indices.begin() + split_end,
+                      [&tet_centroids,axis]( const size_t a, const size_t b )
+                      { return tet_centroids[a][axis] < tet_centroids[b][axis]; } );
+
+    return split_mid;
+  };
+
+  size_t group_bounds[5];
+
+  if( end - begin <= s_max_leaf_size )
+  {
+    group_bounds[0] = begin;
+    group_bounds[1] = group_bounds[2] = group_bounds[3] = group_bounds[4] = end;
+  }
+  else
+  {
+    group_bounds[0] = begin;
+    group_bounds[2] = split_tets( begin, end );
+    group_bounds[1] = split_tets( begin, group_bounds[2] );
+    group_bounds[3] = split_tets( group_bounds[2], end );
+    group_bounds[4] = end;
+  }
+
+  for( size_t c = 0; c < 4; ++c )
+  {
+    const size_t group_begin = group_bounds[c];
+    const size_t group_end = group_bounds[c+1];
+
+    if( group_begin == group_end )
+      continue;
+
+    for( size_t i = group_begin; i < group_end; ++i )
+    {
+      const std::array<double,6>& box =
+        tet_bounding_boxes[d_bvh_tet_indices[i]];
+
+      for( size_t d = 0; d < 3; ++d )
+      {
+        d_bvh_nodes[node_index].lower_bounds[d][c] =
+          std::min( d_bvh_nodes[node_index].lower_bounds[d][c], box[d] );
+        d_bvh_nodes[node_index].upper_bounds[d][c] =
+          std::max( d_bvh_nodes[node_index].upper_bounds[d][c], box[d+3] );
+      }
+    }
+
+    if( group_end - group_begin <= s_max_leaf_size )
+    {
+      d_bvh_nodes[node_index].child_indices[c] = group_begin;
+      d_bvh_nodes[node_index].child_tet_counts[c] = group_end - group_begin;
+    }
+    else
+    {
+      // Note: the node array may be reallocated while the child is built
+      const unsigned child_index = this->buildBVHNode( group_begin,
+                                                       group_end,
+                                                       tet_bounding_boxes,
+                                                       tet_centroids );
+
+      d_bvh_nodes[node_index].child_indices[c] = child_index;
+    }
+  }
+
+  return node_index;
+}
+
+// Return the number of tets
+size_t TetMeshTracker::getNumberOfTets() const
+{
+  return d_number_of_tets;
+}
+
+// Return the index of the tet that neighbors a tet across a face
+/*! \details Face i is the face opposite of vertex i. A negative value will be
+ * returned if the face is on the mesh surface.
+ */
+long TetMeshTracker::getFaceNeighbor( const size_t tet_index,
+                                      const size_t face ) const
+{
+  // Make sure that the tet index is valid
+  testPrecondition( tet_index < d_number_of_tets );
+  // Make sure that the face is valid
+  testPrecondition( face < 4 );
+
+  return d_face_neighbors[4*tet_index + face];
+}
+
+// Check if a point is in a tet
+inline bool TetMeshTracker::isPointInTet( const double point[3],
+                                          const size_t tet_index ) const
+{
+  return Utility::isPointInTet( point,
+                                &d_reference_vertices[3*tet_index],
+                                &d_barycentric_matrices[9*tet_index],
+                                d_point_location_tolerance );
+}
+
+// Return the tet that contains a point
+/*! \details If the point is not in the mesh false will be returned.
+ */
+bool TetMeshTracker::findTetContainingPoint( const double point[3],
+                                             size_t& tet_index ) const
+{
+  if( d_number_of_tets == 0 )
+    return false;
+
+  unsigned node_stack[s_max_traversal_stack_size];
+  size_t stack_size = 0;
+
+  node_stack[stack_size++] = 0;
+
+  while( stack_size > 0 )
+  {
+    const BVHNode& node = d_bvh_nodes[node_stack[--stack_size]];
+
+    // Test the point against all child bounding boxes
+    bool child_hit[4];
+
+    for( size_t c = 0; c < 4; ++c )
+    {
+      child_hit[c] =
+        node.lower_bounds[0][c] <= point[0] && point[0] <= node.upper_bounds[0][c] &&
+        node.lower_bounds[1][c] <= point[1] && point[1] <= node.upper_bounds[1][c] &&
+        node.lower_bounds[2][c] <= point[2] && point[2] <= node.upper_bounds[2][c];
+    }
+
+    for( size_t c = 0; c < 4; ++c )
+    {
+      if( !child_hit[c] )
+        continue;
+
+      if( node.child_tet_counts[c] > 0 )
+      {
+        for( size_t i = node.child_indices[c];
+             i < node.child_indices[c] + node.child_tet_counts[c];
+             ++i )
+        {
+          if( this->isPointInTet( point, d_bvh_tet_indices[i] ) )
+          {
+            tet_index = d_bvh_tet_indices[i];
+
+            return true;
+          }
+        }
+      }
+      else
+      {
+        // Make sure that the traversal stack is large enough
+        testInvariant( stack_size < s_max_traversal_stack_size );
+
+        node_stack[stack_size++] = node.child_indices[c];
+      }
+    }
+  }
+
+  return false;
+}
+
+// Compute the interval along a ray that is inside of a tet
+/*! \details The barycentric coordinates of a point on the ray are linear in
+ * the distance along the ray. The tet is the region where all four
+ * barycentric coordinates are non-negative, which means that the interval
+ * can be found by clipping the ray against the four barycentric half spaces.
+ * The entry distance will not be less than the min distance. The exit
+ * distance will not be greater than the entry distance if the ray misses the
+ * tet.
+ */
+void TetMeshTracker::computeTetRayInterval( const double ray_start_point[3],
+                                            const double ray_direction[3],
+                                            const size_t tet_index,
+                                            const double min_distance,
+                                            TetRayInterval& interval ) const
+{
+  // The tolerance used when the ray is parallel to a face
+  const double parallel_tolerance = 1e-12;
+
+  const double* matrix = &d_barycentric_matrices[9*tet_index];
+  const double* reference_vertex = &d_reference_vertices[3*tet_index];
+
+  const double relative_position[3] =
+    {ray_start_point[0] - reference_vertex[0],
+     ray_start_point[1] - reference_vertex[1],
+     ray_start_point[2] - reference_vertex[2]};
+
+  double coordinates[4], coordinate_derivatives[4];
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    coordinates[i] = matrix[3*i]*relative_position[0] +
+      matrix[3*i+1]*relative_position[1] +
+      matrix[3*i+2]*relative_position[2];
+
+    coordinate_derivatives[i] = matrix[3*i]*ray_direction[0] +
+      matrix[3*i+1]*ray_direction[1] +
+      matrix[3*i+2]*ray_direction[2];
+  }
+
+  coordinates[3] = 1.0 - coordinates[0] - coordinates[1] - coordinates[2];
+  coordinate_derivatives[3] = -coordinate_derivatives[0] -
+    coordinate_derivatives[1] - coordinate_derivatives[2];
+
+  interval.entry_distance = min_distance;
+  interval.exit_distance = std::numeric_limits<double>::infinity();
+  interval.exit_face = 0;
+
+  for( size_t i = 0; i < 4; ++i )
+  {
+    if( coordinate_derivatives[i] > 0.0 )
+    {
+      interval.entry_distance =
+        std::max( interval.entry_distance,
+                  -coordinates[i]/coordinate_derivatives[i] );
+    }
+    else if( coordinate_derivatives[i] < 0.0 )
+    {
+      const double face_distance = -coordinates[i]/coordinate_derivatives[i];
+
+      if( face_distance < interval.exit_distance )
+      {
+        interval.exit_distance = face_distance;
+        interval.exit_face = i;
+      }
+    }
+    else if( coordinates[i] < -parallel_tolerance )
+    {
+      interval.exit_distance = -std::numeric_limits<double>::infinity();
+    }
+  }
+}
+
+// Find the first tet that a ray enters beyond a min distance
+/*! \details Only tets that the ray is inside of beyond the min distance will
+ * be considered. The tet with the smallest entry distance (which will be
+ * the min distance if the ray start point + min distance is in a tet) will
+ * be returned.
+ */
+bool TetMeshTracker::findFirstTetAlongRay( const double ray_start_point[3],
+                                           const double ray_direction[3],
+                                           const double min_distance,
+                                           const double max_distance,
+                                           size_t& tet_index ) const
+{
+  if( d_number_of_tets == 0 )
+    return false;
+
+  bool parallel[3];
+  double inverse_direction[3];
+
+  for( size_t d = 0; d < 3; ++d )
+  {
+    parallel[d] = (ray_direction[d] == 0.0);
+    inverse_direction[d] = (parallel[d] ? 0.0 : 1.0/ray_direction[d]);
+  }
+
+  double closest_entry_distance = max_distance;
+  bool tet_found = false;
+
+  unsigned node_stack[s_max_traversal_stack_size];
+  size_t stack_size = 0;
+
+  node_stack[stack_size++] = 0;
+
+  while( stack_size > 0 )
+  {
+    const BVHNode& node = d_bvh_nodes[node_stack[--stack_size]];
+
+    // Clip the ray against all child bounding boxes (slab method)
+    double near_distance[4], far_distance[4];
+
+    for( size_t c = 0; c < 4; ++c )
+    {
+      near_distance[c] = min_distance;
+      far_distance[c] = closest_entry_distance;
+    }
+
+    for( size_t d = 0; d < 3; ++d )
+    {
+      for( size_t c = 0; c < 4; ++c )
+      {
+        const double lower_distance =
+          (node.lower_bounds[d][c] - ray_start_point[d])*inverse_direction[d];
+        const double upper_distance =
+          (node.upper_bounds[d][c] - ray_start_point[d])*inverse_direction[d];
+
+        const bool inside_slab =
+          node.lower_bounds[d][c] <= ray_start_point[d] &&
+          ray_start_point[d] <= node.upper_bounds[d][c];
+
+        const double slab_near_distance =
+          (parallel[d] ? (inside_slab ? -std::numeric_limits<double>::infinity() :
+                          std::numeric_limits<double>::infinity()) :
+           (inverse_direction[d] > 0.0 ? lower_distance : upper_distance));
+
+        const double slab_far_distance =
+          (parallel[d] ? (inside_slab ? std::numeric_limits<double>::infinity() :
+                          -std::numeric_limits<double>::infinity()) :
+           (inverse_direction[d] > 0.0 ? upper_distance : lower_distance));
+
+        near_distance[c] = std::max( near_distance[c], slab_near_distance );
+        far_distance[c] = std::min( far_distance[c], slab_far_distance );
+      }
+    }
+
+    for( size_t c = 0; c < 4; ++c )
+    {
+      if( !(near_distance[c] <= far_distance[c]) )
+        continue;
+
+      if( node.child_tet_counts[c] > 0 )
+      {
+        for( size_t i = node.child_indices[c];
+             i < node.child_indices[c] + node.child_tet_counts[c];
+             ++i )
+        {
+          TetRayInterval interval;
+
+          this->computeTetRayInterval( ray_start_point,
+                                       ray_direction,
+                                       d_bvh_tet_indices[i],
+                                       min_distance,
+                                       interval );
+
+          if( interval.entry_distance < interval.exit_distance &&
+              interval.exit_distance > min_distance &&
+              interval.entry_distance < closest_entry_distance )
+          {
+            closest_entry_distance = interval.entry_distance;
+            tet_index = d_bvh_tet_indices[i];
+            tet_found = true;
+          }
+        }
+      }
+      else
+      {
+        // Make sure that the traversal stack is large enough
+        testInvariant( stack_size < s_max_traversal_stack_size );
+
+        node_stack[stack_size++] = node.child_indices[c];
+      }
+    }
+  }
+
+  return tet_found;
+}
+
+// Compute the track lengths of a line segment in the tets
+/*! \details The tet index, the point where the segment enters the tet (or
+ * the segment start point) and the track length in the tet will be stored
+ * for every tet that the segment passes through (in order).
+ */
+void TetMeshTracker::computeTrackLengths(
+                          const double start_point[3],
+                          const double end_point[3],
+                          TetIndexTrackLengthArray& tet_track_lengths ) const
+{
+  tet_track_lengths.clear();
+
+  double direction[3] = {end_point[0] - start_point[0],
+                         end_point[1] - start_point[1],
+                         end_point[2] - start_point[2]};
+
+  const double track_length = std::sqrt( direction[0]*direction[0] +
+                                         direction[1]*direction[1] +
+                                         direction[2]*direction[2] );
+
+  if( track_length == 0.0 )
+    return;
+
+  direction[0] /= track_length;
+  direction[1] /= track_length;
+  direction[2] /= track_length;
+
+  size_t tet_index;
+
+  if( !this->findFirstTetAlongRay( start_point,
+                                   direction,
+                                   0.0,
+                                   track_length,
+                                   tet_index ) )
+    return;
+
+  double distance = 0.0;
+
+  while( true )
+  {
+    TetRayInterval interval;
+
+    this->computeTetRayInterval( start_point,
+                                 direction,
+                                 tet_index,
+                                 distance,
+                                 interval );
+
+    const double exit_distance =
+      std::min( interval.exit_distance, track_length );
+
+    long next_tet_index = -1;
+
+    if( exit_distance > interval.entry_distance )
+    {
+      tet_track_lengths.push_back( std::make_tuple(
+               tet_index,
+               std::array<double,3>( {start_point[0] + direction[0]*interval.entry_distance,
+                                      start_point[1] + direction[1]*interval.entry_distance,
+                                      start_point[2] + direction[2]*interval.entry_distance} ),
+               exit_distance - interval.entry_distance ) );
+
+      distance = exit_distance;
+
+      if( distance >= track_length )
+        break;
+
+      next_tet_index = d_face_neighbors[4*tet_index + interval.exit_face];
+    }
+
+    // Walk across the exit face to the neighboring tet. If the exit face is
+    // on the mesh surface or no progress was made in the current tet (e.g.
+    // the segment passes through an edge or vertex) the BVH must be used to
+    // find the next tet.
+    if( next_tet_index >= 0 )
+      tet_index = next_tet_index;
+    else if( !this->findFirstTetAlongRay( start_point,
+                                          direction,
+                                          distance,
+                                          track_length,
+                                          tet_index ) )
+      break;
+  }
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_TetMeshTracker.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,175 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_TetMeshTracker.hpp
+//! \author Alex Robinson
+//! \brief  Tetrahedral mesh point location and track length class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_TET_MESH_TRACKER_HPP
+#define UTILITY_TET_MESH_TRACKER_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <array>
+
+// FRENSIE Includes
+#include "Utility_Mesh.hpp"
+
+namespace Utility{
+
+/*! The tetrahedral mesh tracker class
+ * \details This class locates points in a tetrahedral mesh and computes the
+ * track lengths of line segments in the tets of the mesh without any
+ * external mesh library. The barycentric transform of every tet is stored in
+ * contiguous arrays. The initial tet that a point is in (or that a segment
+ * enters) is found with a 4-wide bounding volume hierarchy (BVH) whose child
+ * bounding boxes are stored in structure-of-arrays layout so that all four
+ * children of a node can be tested together. Once the first tet along a
+ * segment has been found, the segment is traced by walking from tet to tet
+ * across shared faces using a precomputed face adjacency table. The BVH is
+ * only queried again if the segment leaves the mesh (concave meshes) or the
+ * walk fails to make progress. Tets are identified by their index
+ * (0 <= index < number of tets) - mapping indices to external element handles
+ * is the responsibility of the client.
+ */
+class TetMeshTracker
+{
+
+public:
+
+  //! The tet index, primary intersection point, track length tuple array
+  typedef Mesh::ElementHandleTrackLengthArray TetIndexTrackLengthArray;
+
+  //! Default constructor
+  TetMeshTracker();
+
+  //! Constructor
+  TetMeshTracker( const std::vector<std::array<double,3> >& vertices,
+                  const std::vector<std::array<size_t,4> >& tet_vertex_indices,
+                  const double point_location_tolerance = 1e-6 );
+
+  //! Destructor
+  ~TetMeshTracker()
+  { /* ... */ }
+
+  //! Return the number of tets
+  size_t getNumberOfTets() const;
+
+  //! Return the index of the tet that neighbors a tet across a face
+  long getFaceNeighbor( const size_t tet_index, const size_t face ) const;
+
+  //! Return the tet that contains a point
+  bool findTetContainingPoint( const double point[3],
+                               size_t& tet_index ) const;
+
+  //! Compute the track lengths of a line segment in the tets
+  void computeTrackLengths( const double start_point[3],
+                            const double end_point[3],
+                            TetIndexTrackLengthArray& tet_track_lengths ) const;
+
+private:
+
+  // The maximum number of tets stored in a BVH leaf
+  static const size_t s_max_leaf_size = 4;
+
+  // The maximum size of the BVH traversal stack
+  static const size_t s_max_traversal_stack_size = 256;
+
+  // The BVH node (4-wide)
+  struct BVHNode
+  {
+    // The child bounding box lower bounds (3 dimensions, 4 children)
+    double lower_bounds[3][4];
+
+    // The child bounding box upper bounds (3 dimensions, 4 children)
+    double upper_bounds[3][4];
+
+    // The child node index (internal child) or first tet index (leaf child)
+    unsigned child_indices[4];
+
+    // The number of tets in each child (0 for internal children)
+    unsigned child_tet_counts[4];
+  };
+
+  // The interval along a ray that is inside of a tet
+  struct TetRayInterval
+  {
+    // The distance where the ray enters the tet
+    double entry_distance;
+
+    // The distance where the ray exits the tet
+    double exit_distance;
+
+    // The face that the ray exits through
+    size_t exit_face;
+  };
+
+  // Initialize the barycentric transform data
+  void initializeBarycentricData(
+                const std::vector<std::array<double,3> >& vertices,
+                const std::vector<std::array<size_t,4> >& tet_vertex_indices );
+
+  // Initialize the face adjacency table
+  void initializeFaceAdjacencyTable(
+                const std::vector<std::array<size_t,4> >& tet_vertex_indices );
+
+  // Initialize the BVH
+  void initializeBVH(
+                const std::vector<std::array<double,3> >& vertices,
+                const std::vector<std::array<size_t,4> >& tet_vertex_indices );
+
+  // Build a BVH node
+  unsigned buildBVHNode(
+                 const size_t begin,
+                 const size_t end,
+                 const std::vector<std::array<double,6> >& tet_bounding_boxes,
+                 const std::vector<std::array<double,3> >& tet_centroids );
+
+  // Check if a point is in a tet
+  bool isPointInTet( const double point[3], const size_t tet_index ) const;
+
+  // Compute the interval along a ray that is inside of a tet
+  void computeTetRayInterval( const double ray_start_point[3],
+                              const double ray_direction[3],
+                              const size_t tet_index,
+                              const double min_distance,
+                              TetRayInterval& interval ) const;
+
+  // Find the first tet that a ray enters beyond a min distance
+  bool findFirstTetAlongRay( const double ray_start_point[3],
+                             const double ray_direction[3],
+                             const double min_distance,
+                             const double max_distance,
+                             size_t& tet_index ) const;
+
+  // The point location tolerance (barycentric coordinates)
+  double d_point_location_tolerance;
+
+  // The number of tets
+  size_t d_number_of_tets;
+
+  // The barycentric transform matrices (9 values per tet)
+  std::vector<double> d_barycentric_matrices;
+
+  // The barycentric reference vertices (3 values per tet)
+  std::vector<double> d_reference_vertices;
+
+  // The face neighbors (4 values per tet - face i is opposite vertex i). A
+  // negative value indicates that the face is on the mesh surface.
+  std::vector<long> d_face_neighbors;
+
+  // The BVH nodes (the root node is always the first node)
+  std::vector<BVHNode> d_bvh_nodes;
+
+  // The BVH ordered tet indices
+  std::vector<size_t> d_bvh_tet_indices;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_TET_MESH_TRACKER_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_TetMeshTracker.hpp
+//---------------------------------------------------------------------------//
@@ -11,6 +11,8 @@
 #include <iomanip>
 #include <memory>
 #include <utility>
+#include <random>
+#include <map>
 
 // FRENSIE Includes
 #include "Utility_StructuredHexMesh.hpp"
@@ -1089,6 +1091,256 @@ FRENSIE_UNIT_TEST( StructuredHexMesh,
                                    1e-10);
 }
 
+//---------------------------------------------------------------------------//
+// Check that the correct elements are found in a non-uniform mesh
+FRENSIE_UNIT_TEST( StructuredHexMesh, whichElementIsPointIn_non_uniform )
+{
+  std::vector<double> x_planes( {-2.0, -1.5, 0.0, 0.1, 0.25, 3.0} ),
+    y_planes( {0.0, 1e-3, 1.0} ),
+    z_planes( {-1.0, 1.0} );
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  double point[3] {-2.0, 0.0, -1.0};
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 0 );
+
+  point[0] = -1.5;
+  point[1] = 5e-4;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 1 );
+
+  point[0] = 0.05;
+  point[1] = 1e-3;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 7 );
+
+  point[0] = 0.1;
+  point[1] = 0.5;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 8 );
+
+  point[0] = 2.9;
+  point[1] = 1.0;
+  point[2] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 9 );
+
+  point[0] = 3.0;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 9 );
+}
+
+//---------------------------------------------------------------------------//
+// Compute the track lengths of a segment by clipping it with every element
+std::map<Utility::StructuredHexMesh::ElementHandle,double>
+computeReferenceTrackLengths( const std::vector<double>& x_planes,
+                              const std::vector<double>& y_planes,
+                              const std::vector<double>& z_planes,
+                              const std::array<double,3>& start_point,
+                              const std::array<double,3>& end_point )
+{
+  std::map<Utility::StructuredHexMesh::ElementHandle,double> track_lengths;
+
+  const std::vector<double>* planes[3] = {&x_planes, &y_planes, &z_planes};
+
+  double ray[3] = {end_point[0] - start_point[0],
+                   end_point[1] - start_point[1],
+                   end_point[2] - start_point[2]};
+
+  const double ray_length = Utility::vectorMagnitude( ray );
+
+  for( size_t k = 0; k < z_planes.size()-1; ++k )
+  {
+    for( size_t j = 0; j < y_planes.size()-1; ++j )
+    {
+      for( size_t i = 0; i < x_planes.size()-1; ++i )
+      {
+        const size_t indices[3] = {i, j, k};
+
+        double entry = 0.0, exit = 1.0;
+
+        for( size_t d = 0; d < 3; ++d )
+        {
+          const double lower = (*planes[d])[indices[d]];
+          const double upper = (*planes[d])[indices[d]+1];
+
+          if( ray[d] == 0.0 )
+          {
+            if( start_point[d] < lower || start_point[d] > upper )
+              exit = -1.0;
+          }
+          else
+          {
+            const double t0 = (lower - start_point[d])/ray[d];
+            const double t1 = (upper - start_point[d])/ray[d];
+
+            entry = std::max( entry, std::min( t0, t1 ) );
+            exit = std::min( exit, std::max( t0, t1 ) );
+          }
+        }
+
+        if( exit > entry )
+        {
+          track_lengths[i + j*(x_planes.size()-1) +
+                        k*(x_planes.size()-1)*(y_planes.size()-1)] =
+            (exit - entry)*ray_length;
+        }
+      }
+    }
+  }
+
+  return track_lengths;
+}
+
+//---------------------------------------------------------------------------//
+// Create random segments (some of which will start or end outside of the
+// mesh)
+void createRandomSegments( const size_t number_of_segments,
+                           std::vector<std::array<double,3> >& start_points,
+                           std::vector<std::array<double,3> >& end_points )
+{
+  std::mt19937 generator( 1 );
+  std::uniform_real_distribution<double> distribution( -0.5, 1.5 );
+
+  start_points.resize( number_of_segments );
+  end_points.resize( number_of_segments );
+
+  for( size_t i = 0; i < number_of_segments; ++i )
+  {
+    for( size_t d = 0; d < 3; ++d )
+    {
+      start_points[i][d] = distribution( generator );
+      end_points[i][d] = distribution( generator );
+    }
+
+    // Create some segments that are parallel to the mesh planes
+    if( i % 5 == 0 )
+      end_points[i][i % 3] = start_points[i][i % 3];
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths of random segments can be computed
+#define CHECK_RANDOM_SEGMENT_TRACK_LENGTHS( x_planes, y_planes, z_planes )  \
+  {                                                                     \
+    std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(               \
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) ); \
+                                                                        \
+    std::vector<std::array<double,3> > start_points, end_points;        \
+                                                                        \
+    createRandomSegments( 1000, start_points, end_points );             \
+                                                                        \
+    Utility::StructuredHexMesh::ElementHandleTrackLengthArray contribution; \
+                                                                        \
+    for( size_t i = 0; i < start_points.size(); ++i )                   \
+    {                                                                   \
+      hex_mesh->computeTrackLengths( start_points[i].data(),            \
+                                     end_points[i].data(),              \
+                                     contribution );                    \
+                                                                        \
+      std::map<Utility::StructuredHexMesh::ElementHandle,double> reference = \
+        computeReferenceTrackLengths( x_planes, y_planes, z_planes,     \
+                                      start_points[i], end_points[i] ); \
+                                                                        \
+      FRENSIE_REQUIRE_EQUAL( contribution.size(), reference.size() );   \
+                                                                        \
+      for( size_t j = 0; j < contribution.size(); ++j )                 \
+      {                                                                 \
+        FRENSIE_REQUIRE( reference.count( Utility::get<0>( contribution[j] ) ) ); \
+        FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( contribution[j] ), \
+                                         reference[Utility::get<0>( contribution[j] )], \
+                                         1e-9 );                        \
+      }                                                                 \
+    }                                                                   \
+  }
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths of random segments can be computed
+FRENSIE_UNIT_TEST( StructuredHexMesh, computeTrackLengths_random_uniform )
+{
+  std::vector<double> planes( 11 );
+
+  for( size_t i = 0; i < planes.size(); ++i )
+    planes[i] = i*0.1;
+
+  CHECK_RANDOM_SEGMENT_TRACK_LENGTHS( planes, planes, planes );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths of random segments can be computed
+FRENSIE_UNIT_TEST( StructuredHexMesh, computeTrackLengths_random_non_uniform )
+{
+  std::vector<double> x_planes( {0.0, 0.01, 0.02, 0.5, 0.55, 0.9, 1.0} ),
+    y_planes( {0.0, 0.3, 0.31, 0.32, 0.33, 1.0} ),
+    z_planes( {0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 0.95, 1.0} );
+
+  CHECK_RANDOM_SEGMENT_TRACK_LENGTHS( x_planes, y_planes, z_planes );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths of a batch of segments can be computed
+FRENSIE_UNIT_TEST( StructuredHexMesh, computeTrackLengths_batch )
+{
+  std::vector<double> x_planes( {0.0, 0.01, 0.02, 0.5, 0.55, 0.9, 1.0} ),
+    y_planes( {0.0, 0.25, 0.5, 0.75, 1.0} ),
+    z_planes( {0.0, 0.5, 1.0} );
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  std::vector<std::array<double,3> > start_points, end_points;
+
+  // Use a number of segments that is not a multiple of the batch size
+  createRandomSegments( 101, start_points, end_points );
+
+  Utility::StructuredHexMesh::ElementHandleTrackLengthArray batch_contribution;
+  std::vector<size_t> segment_offsets;
+
+  hex_mesh->computeTrackLengths( start_points,
+                                 end_points,
+                                 batch_contribution,
+                                 segment_offsets );
+
+  FRENSIE_REQUIRE_EQUAL( segment_offsets.size(), start_points.size()+1 );
+  FRENSIE_CHECK_EQUAL( segment_offsets.front(), 0 );
+  FRENSIE_CHECK_EQUAL( segment_offsets.back(), batch_contribution.size() );
+
+  Utility::StructuredHexMesh::ElementHandleTrackLengthArray contribution;
+
+  for( size_t i = 0; i < start_points.size(); ++i )
+  {
+    hex_mesh->computeTrackLengths( start_points[i].data(),
+                                   end_points[i].data(),
+                                   contribution );
+
+    FRENSIE_REQUIRE_EQUAL( segment_offsets[i+1] - segment_offsets[i],
+                           contribution.size() );
+
+    for( size_t j = 0; j < contribution.size(); ++j )
+    {
+      FRENSIE_CHECK_EQUAL( batch_contribution[segment_offsets[i]+j],
+                           contribution[j] );
+    }
+  }
+
+  // The base class implementation should give the same results
+  const Utility::Mesh& base_mesh = *hex_mesh;
+
+  Utility::StructuredHexMesh::ElementHandleTrackLengthArray
+    default_batch_contribution;
+  std::vector<size_t> default_segment_offsets;
+
+  base_mesh.Utility::Mesh::computeTrackLengths( start_points,
+                                                end_points,
+                                                default_batch_contribution,
+                                                default_segment_offsets );
+
+  FRENSIE_CHECK_EQUAL( default_segment_offsets, segment_offsets );
+  FRENSIE_CHECK_EQUAL( default_batch_contribution, batch_contribution );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the mesh data can be exported
 FRENSIE_UNIT_TEST( StructuredHexMesh, exportData )
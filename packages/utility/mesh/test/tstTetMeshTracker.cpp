@@ -0,0 +1,433 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstTetMeshTracker.cpp
+//! \author Alex Robinson
+//! \brief  TetMeshTracker class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <random>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_TetMeshTracker.hpp"
+#include "Utility_TetrahedronHelpers.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing variables
+//---------------------------------------------------------------------------//
+
+std::vector<std::array<double,3> > vertices;
+std::vector<std::array<size_t,4> > tets;
+
+std::unique_ptr<Utility::TetMeshTracker> tracker;
+
+//---------------------------------------------------------------------------//
+// Testing functions
+//---------------------------------------------------------------------------//
+// Create a tet mesh of a box by splitting each cube of a cube lattice into
+// six tets (Kuhn triangulation)
+void createCubeTetMesh( const size_t cubes_per_dimension,
+                        const double x_offset,
+                        std::vector<std::array<double,3> >& mesh_vertices,
+                        std::vector<std::array<size_t,4> >& mesh_tets )
+{
+  const size_t n = cubes_per_dimension;
+  const size_t vertex_offset = mesh_vertices.size();
+
+  auto vertex_index = [n,vertex_offset]( size_t i, size_t j, size_t k )
+    { return vertex_offset + i + (n+1)*(j + (n+1)*k); };
+
+  for( size_t k = 0; k <= n; ++k )
+  {
+    for( size_t j = 0; j <= n; ++j )
+    {
+      for( size_t i = 0; i <= n; ++i )
+      {
+        mesh_vertices.push_back( std::array<double,3>(
+                                              {x_offset + double(i)/n,
+                                               double(j)/n,
+                                               double(k)/n} ) );
+      }
+    }
+  }
+
+  const size_t axis_permutations[6][3] =
+    {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+
+  for( size_t k = 0; k < n; ++k )
+  {
+    for( size_t j = 0; j < n; ++j )
+    {
+      for( size_t i = 0; i < n; ++i )
+      {
+        for( size_t p = 0; p < 6; ++p )
+        {
+          size_t corner[3] = {i, j, k};
+
+          std::array<size_t,4> tet;
+
+          tet[0] = vertex_index( corner[0], corner[1], corner[2] );
+
+          for( size_t v = 0; v < 3; ++v )
+          {
+            ++corner[axis_permutations[p][v]];
+
+            tet[v+1] = vertex_index( corner[0], corner[1], corner[2] );
+          }
+
+          mesh_tets.push_back( tet );
+        }
+      }
+    }
+  }
+}
+
+// Check if a point is in a tet
+bool isPointInMeshTet( const double point[3],
+                       const std::array<size_t,4>& tet,
+                       const double tol )
+{
+  double matrix[9];
+
+  Utility::calculateBarycentricTransformMatrix( vertices[tet[0]].data(),
+                                                vertices[tet[1]].data(),
+                                                vertices[tet[2]].data(),
+                                                vertices[tet[3]].data(),
+                                                matrix );
+
+  return Utility::isPointInTet( point, vertices[tet[3]].data(), matrix, tol );
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the number of tets can be returned
+FRENSIE_UNIT_TEST( TetMeshTracker, getNumberOfTets )
+{
+  FRENSIE_CHECK_EQUAL( tracker->getNumberOfTets(), 6*4*4*4 );
+
+  Utility::TetMeshTracker empty_tracker;
+
+  FRENSIE_CHECK_EQUAL( empty_tracker.getNumberOfTets(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the face neighbors can be returned
+FRENSIE_UNIT_TEST( TetMeshTracker, getFaceNeighbor )
+{
+  size_t number_of_surface_faces = 0;
+
+  for( size_t i = 0; i < tracker->getNumberOfTets(); ++i )
+  {
+    for( size_t face = 0; face < 4; ++face )
+    {
+      const long neighbor = tracker->getFaceNeighbor( i, face );
+
+      if( neighbor < 0 )
+        ++number_of_surface_faces;
+      else
+      {
+        FRENSIE_REQUIRE_LESS( neighbor, tracker->getNumberOfTets() );
+
+        // The neighbor must share the face (all vertices except the one
+        // opposite of the face)
+        size_t shared_vertices = 0;
+
+        for( size_t j = 0; j < 4; ++j )
+        {
+          if( j == face )
+            continue;
+
+          for( size_t k = 0; k < 4; ++k )
+          {
+            if( tets[i][j] == tets[neighbor][k] )
+              ++shared_vertices;
+          }
+        }
+
+        FRENSIE_CHECK_EQUAL( shared_vertices, 3 );
+
+        // The neighbor relationship must be symmetric
+        bool symmetric = false;
+
+        for( size_t k = 0; k < 4; ++k )
+        {
+          if( tracker->getFaceNeighbor( neighbor, k ) == (long)i )
+            symmetric = true;
+        }
+
+        FRENSIE_CHECK( symmetric );
+      }
+    }
+  }
+
+  // Each face of each surface cube is split into two triangles
+  FRENSIE_CHECK_EQUAL( number_of_surface_faces, 6*4*4*2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the tet containing a point can be found
+FRENSIE_UNIT_TEST( TetMeshTracker, findTetContainingPoint )
+{
+  std::mt19937 generator( 1 );
+  std::uniform_real_distribution<double> distribution( -0.2, 1.2 );
+
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    double point[3] = {distribution( generator ),
+                       distribution( generator ),
+                       distribution( generator )};
+
+    size_t tet_index;
+
+    const bool point_in_mesh =
+      tracker->findTetContainingPoint( point, tet_index );
+
+    const bool point_in_box = point[0] >= 0.0 && point[0] <= 1.0 &&
+      point[1] >= 0.0 && point[1] <= 1.0 &&
+      point[2] >= 0.0 && point[2] <= 1.0;
+
+    FRENSIE_CHECK_EQUAL( point_in_mesh, point_in_box );
+
+    if( point_in_mesh )
+    {
+      FRENSIE_REQUIRE_LESS( tet_index, tets.size() );
+      FRENSIE_CHECK( isPointInMeshTet( point, tets[tet_index], 1e-6 ) );
+    }
+  }
+
+  // Vertices of the mesh
+  double point[3] = {0.0, 0.0, 0.0};
+  size_t tet_index;
+
+  FRENSIE_CHECK( tracker->findTetContainingPoint( point, tet_index ) );
+
+  point[0] = 1.0;
+  point[1] = 1.0;
+  point[2] = 1.0;
+
+  FRENSIE_CHECK( tracker->findTetContainingPoint( point, tet_index ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths of a segment can be computed
+FRENSIE_UNIT_TEST( TetMeshTracker, computeTrackLengths )
+{
+  Utility::TetMeshTracker::TetIndexTrackLengthArray track_lengths;
+
+  // Segment misses the mesh
+  double start_point[3] = {2.0, -1.0, 0.0};
+  double end_point[3] = {4.0, -1.0, 0.0};
+
+  tracker->computeTrackLengths( start_point, end_point, track_lengths );
+
+  FRENSIE_CHECK( track_lengths.empty() );
+
+  // Segment in a single tet
+  start_point[0] = 0.01;
+  start_point[1] = 0.02;
+  start_point[2] = 0.03;
+
+  end_point[0] = 0.02;
+  end_point[1] = 0.03;
+  end_point[2] = 0.04;
+
+  tracker->computeTrackLengths( start_point, end_point, track_lengths );
+
+  FRENSIE_REQUIRE_EQUAL( track_lengths.size(), 1 );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>( track_lengths[0] ),
+                       (std::array<double,3>( {0.01, 0.02, 0.03} )) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>( track_lengths[0] ),
+                                   std::sqrt( 3e-4 ),
+                                   1e-12 );
+  FRENSIE_CHECK( isPointInMeshTet( start_point,
+                                   tets[Utility::get<0>( track_lengths[0] )],
+                                   1e-12 ) );
+
+  // Segment that starts outside of the mesh and passes through the mesh
+  start_point[0] = -0.5;
+  start_point[1] = 0.3;
+  start_point[2] = 0.6;
+
+  end_point[0] = 1.5;
+  end_point[1] = 0.3;
+  end_point[2] = 0.6;
+
+  tracker->computeTrackLengths( start_point, end_point, track_lengths );
+
+  FRENSIE_REQUIRE( !track_lengths.empty() );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>( track_lengths[0] ),
+                                   (std::array<double,3>( {0.0, 0.3, 0.6} )),
+                                   1e-12 );
+
+  double total_track_length = 0.0;
+
+  for( auto&& track_length : track_lengths )
+    total_track_length += Utility::get<2>( track_length );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( total_track_length, 1.0, 1e-12 );
+
+  // Segment along a mesh edge
+  start_point[0] = 0.0;
+  start_point[1] = 0.0;
+  start_point[2] = 0.0;
+
+  end_point[0] = 1.0;
+  end_point[1] = 1.0;
+  end_point[2] = 1.0;
+
+  tracker->computeTrackLengths( start_point, end_point, track_lengths );
+
+  total_track_length = 0.0;
+
+  for( auto&& track_length : track_lengths )
+    total_track_length += Utility::get<2>( track_length );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( total_track_length, std::sqrt( 3.0 ), 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths of random segments can be computed
+FRENSIE_UNIT_TEST( TetMeshTracker, computeTrackLengths_random )
+{
+  std::mt19937 generator( 1 );
+  std::uniform_real_distribution<double> distribution( -0.5, 1.5 );
+
+  Utility::TetMeshTracker::TetIndexTrackLengthArray track_lengths;
+
+  for( size_t i = 0; i < 1000; ++i )
+  {
+    double start_point[3], end_point[3], direction[3];
+
+    for( size_t d = 0; d < 3; ++d )
+    {
+      start_point[d] = distribution( generator );
+      end_point[d] = distribution( generator );
+      direction[d] = end_point[d] - start_point[d];
+    }
+
+    const double length = std::sqrt( direction[0]*direction[0] +
+                                      direction[1]*direction[1] +
+                                      direction[2]*direction[2] );
+
+    for( size_t d = 0; d < 3; ++d )
+      direction[d] /= length;
+
+    // Clip the segment to the unit cube
+    double entry = 0.0, exit = length;
+
+    for( size_t d = 0; d < 3; ++d )
+    {
+      const double t0 = (0.0 - start_point[d])/direction[d];
+      const double t1 = (1.0 - start_point[d])/direction[d];
+
+      entry = std::max( entry, std::min( t0, t1 ) );
+      exit = std::min( exit, std::max( t0, t1 ) );
+    }
+
+    tracker->computeTrackLengths( start_point, end_point, track_lengths );
+
+    if( exit <= entry )
+    {
+      FRENSIE_CHECK( track_lengths.empty() );
+    }
+    else
+    {
+      FRENSIE_REQUIRE( !track_lengths.empty() );
+
+      double distance = entry;
+
+      for( auto&& track_length : track_lengths )
+      {
+        // Each track length must start where the last one ended
+        const std::array<double,3>& entry_point = Utility::get<1>( track_length );
+
+        FRENSIE_CHECK_SMALL( entry_point[0] - (start_point[0] + direction[0]*distance), 1e-10 );
+        FRENSIE_CHECK_SMALL( entry_point[1] - (start_point[1] + direction[1]*distance), 1e-10 );
+        FRENSIE_CHECK_SMALL( entry_point[2] - (start_point[2] + direction[2]*distance), 1e-10 );
+
+        // The mid point of the track must be in the tet
+        const double mid_distance = distance + Utility::get<2>( track_length )/2;
+
+        const double mid_point[3] =
+          {start_point[0] + direction[0]*mid_distance,
+           start_point[1] + direction[1]*mid_distance,
+           start_point[2] + direction[2]*mid_distance};
+
+        FRENSIE_CHECK( isPointInMeshTet( mid_point,
+                                         tets[Utility::get<0>( track_length )],
+                                         1e-9 ) );
+
+        distance += Utility::get<2>( track_length );
+      }
+
+      FRENSIE_CHECK_FLOATING_EQUALITY( distance, exit, 1e-10 );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths of a segment in a concave mesh can be computed
+FRENSIE_UNIT_TEST( TetMeshTracker, computeTrackLengths_concave )
+{
+  // Create two disjoint cubes
+  std::vector<std::array<double,3> > concave_mesh_vertices;
+  std::vector<std::array<size_t,4> > concave_mesh_tets;
+
+  createCubeTetMesh( 2, 0.0, concave_mesh_vertices, concave_mesh_tets );
+  createCubeTetMesh( 2, 2.0, concave_mesh_vertices, concave_mesh_tets );
+
+  Utility::TetMeshTracker concave_tracker( concave_mesh_vertices,
+                                           concave_mesh_tets );
+
+  double start_point[3] = {-0.5, 0.3, 0.7};
+  double end_point[3] = {3.5, 0.3, 0.7};
+
+  Utility::TetMeshTracker::TetIndexTrackLengthArray track_lengths;
+
+  concave_tracker.computeTrackLengths( start_point, end_point, track_lengths );
+
+  FRENSIE_REQUIRE( !track_lengths.empty() );
+
+  double total_track_length = 0.0;
+  size_t second_cube_entry = 0;
+
+  for( size_t i = 0; i < track_lengths.size(); ++i )
+  {
+    total_track_length += Utility::get<2>( track_lengths[i] );
+
+    if( Utility::get<0>( track_lengths[i] ) >= concave_mesh_tets.size()/2 &&
+        second_cube_entry == 0 )
+      second_cube_entry = i;
+  }
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( total_track_length, 2.0, 1e-12 );
+  FRENSIE_REQUIRE_GREATER( second_cube_entry, 0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                     Utility::get<1>( track_lengths[second_cube_entry] ),
+                     (std::array<double,3>( {2.0, 0.3, 0.7} )),
+                     1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  createCubeTetMesh( 4, 0.0, vertices, tets );
+
+  tracker.reset( new Utility::TetMeshTracker( vertices, tets ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstTetMeshTracker.cpp
+//---------------------------------------------------------------------------//
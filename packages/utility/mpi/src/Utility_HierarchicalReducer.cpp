@@ -0,0 +1,193 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_HierarchicalReducer.cpp
+//! \author Alex Robinson
+//! \brief  Hierarchical (node-local then inter-node) reducer definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <functional>
+#include <algorithm>
+#include <string>
+
+// FRENSIE Includes
+#include "Utility_HierarchicalReducer.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionCatchMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Initialize static member data
+const size_t HierarchicalReducer::s_block_size = 1048576;
+
+// Constructor (processes with the same processor name share a node)
+/*! \details This constructor must be called by all processes in the
+ * communicator. The node id of each process is created by hashing the
+ * processor name. Hash collisions between the names of different nodes will
+ * only cause the nodes to be treated as a single node - the reduction will
+ * still be correct.
+ */
+HierarchicalReducer::HierarchicalReducer( const Communicator& comm,
+                                          const int root_process )
+  : d_node_comm(),
+    d_node_leader_comm(),
+    d_number_of_nodes( 1 ),
+    d_node_reduction_time( 0.0 ),
+    d_inter_node_reduction_time( 0.0 )
+{
+  // Make sure that the root process is valid
+  testPrecondition( root_process < comm.size() );
+
+  const int node_id = static_cast<int>(
+             std::hash<std::string>()( GlobalMPISession::processorName() ) &
+             0x7FFFFFFF );
+
+  this->createSubCommunicators( comm, root_process, node_id );
+}
+
+// Constructor (processes with the same node id share a node)
+/*! \details This constructor must be called by all processes in the
+ * communicator. The node id must be non-negative. This constructor can be
+ * used to group processes in other ways (e.g. by socket or rack).
+ */
+HierarchicalReducer::HierarchicalReducer( const Communicator& comm,
+                                          const int root_process,
+                                          const int node_id )
+  : d_node_comm(),
+    d_node_leader_comm(),
+    d_number_of_nodes( 1 ),
+    d_node_reduction_time( 0.0 ),
+    d_inter_node_reduction_time( 0.0 )
+{
+  // Make sure that the root process is valid
+  testPrecondition( root_process < comm.size() );
+  // Make sure that the node id is valid
+  testPrecondition( node_id >= 0 );
+
+  this->createSubCommunicators( comm, root_process, node_id );
+}
+
+// Create the sub-communicators
+void HierarchicalReducer::createSubCommunicators( const Communicator& comm,
+                                                  const int root_process,
+                                                  const int node_id )
+{
+  // The root process must be process 0 in both sub-communicators
+  const int key = (comm.rank() == root_process ? 0 : comm.rank()+1);
+
+  d_node_comm = comm.split( node_id, key );
+
+  const int node_leader = (this->isNodeLeader() ? 1 : 0);
+
+  d_node_leader_comm = comm.split( 1 - node_leader, key );
+
+  if( comm.size() > 1 )
+    Utility::allReduce( comm, node_leader, d_number_of_nodes, std::plus<int>() );
+}
+
+// Return the number of nodes
+int HierarchicalReducer::getNumberOfNodes() const
+{
+  return d_number_of_nodes;
+}
+
+// Check if this process is the leader of its node
+bool HierarchicalReducer::isNodeLeader() const
+{
+  return d_node_comm->rank() == 0;
+}
+
+// Sum the values on all processes and collect on the root process
+/*! \details This method must be called by all processes in the communicator
+ * and the number of values must be the same on every process. Only the
+ * values on the root process will be the global sums once this method
+ * returns (the values on the other node leaders will be the node sums).
+ */
+void HierarchicalReducer::reduceSum( std::vector<double>& values )
+{
+  d_node_reduction_time = 0.0;
+  d_inter_node_reduction_time = 0.0;
+
+  std::vector<double> reduced_values( std::min( s_block_size, values.size() ) );
+
+  std::shared_ptr<Timer> timer = d_node_comm->createTimer();
+
+  for( size_t i = 0; i < values.size(); i += s_block_size )
+  {
+    Utility::ArrayView<double> block_values( values.data()+i,
+                                             std::min( s_block_size,
+                                                       values.size() - i ) );
+
+    // Reduce the block over the node
+    timer->start();
+
+    HierarchicalReducer::reduceBlock( *d_node_comm,
+                                      block_values,
+                                      reduced_values );
+
+    timer->stop();
+
+    d_node_reduction_time += timer->elapsed().count();
+
+    // Reduce the block over the nodes
+    if( this->isNodeLeader() )
+    {
+      timer->start();
+
+      HierarchicalReducer::reduceBlock( *d_node_leader_comm,
+                                        block_values,
+                                        reduced_values );
+
+      timer->stop();
+
+      d_inter_node_reduction_time += timer->elapsed().count();
+    }
+  }
+}
+
+// Sum a block of values over a communicator and collect on its first proc
+void HierarchicalReducer::reduceBlock( const Communicator& comm,
+                                       const Utility::ArrayView<double>& values,
+                                       std::vector<double>& reduced_values )
+{
+  if( comm.size() > 1 )
+  {
+    try{
+      Utility::reduce( comm,
+                       values.toConst(),
+                       Utility::ArrayView<double>( reduced_values.data(),
+                                                   values.size() ),
+                       std::plus<double>(),
+                       0 );
+    }
+    EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                             "Unable to perform the hierarchical reduction!" );
+
+    if( comm.rank() == 0 )
+    {
+      std::copy( reduced_values.begin(),
+                 reduced_values.begin() + values.size(),
+                 values.begin() );
+    }
+  }
+}
+
+// Return the time spent in the node-local stage of the last reduction (s)
+double HierarchicalReducer::getNodeReductionTime() const
+{
+  return d_node_reduction_time;
+}
+
+// Return the time spent in the inter-node stage of the last reduction (s)
+double HierarchicalReducer::getInterNodeReductionTime() const
+{
+  return d_inter_node_reduction_time;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_HierarchicalReducer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_HierarchicalReducer.hpp
+//! \author Alex Robinson
+//! \brief  Hierarchical (node-local then inter-node) reducer declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_HIERARCHICAL_REDUCER_HPP
+#define UTILITY_HIERARCHICAL_REDUCER_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_Communicator.hpp"
+
+namespace Utility{
+
+/*! The hierarchical reducer
+ * \details This class sums a contiguous array of values over all processes
+ * of a communicator in two stages. The values are first reduced over the
+ * processes that share a node (using a node sub-communicator) and the
+ * partial sums stored by the node leaders are then reduced over the nodes
+ * (using a node leader sub-communicator). Compared to a single flat
+ * reduction, the number of messages that must cross the network is reduced
+ * from the number of processes to the number of nodes. The root process is
+ * always the leader of its node so that it receives the final sums. The
+ * values are reduced in fixed-size blocks so that the temporary memory
+ * required stays small regardless of the array size. The sub-communicators
+ * are created once (collectively) at construction and can be reused for
+ * any number of reductions. The time spent in each stage of the last
+ * reduction is recorded.
+ * \ingroup mpi
+ */
+class HierarchicalReducer
+{
+
+public:
+
+  //! Constructor (processes with the same processor name share a node)
+  HierarchicalReducer( const Communicator& comm, const int root_process );
+
+  //! Constructor (processes with the same node id share a node)
+  HierarchicalReducer( const Communicator& comm,
+                       const int root_process,
+                       const int node_id );
+
+  //! Destructor
+  ~HierarchicalReducer()
+  { /* ... */ }
+
+  //! Return the number of nodes
+  int getNumberOfNodes() const;
+
+  //! Check if this process is the leader of its node
+  bool isNodeLeader() const;
+
+  //! Sum the values on all processes and collect on the root process
+  void reduceSum( std::vector<double>& values );
+
+  //! Return the time spent in the node-local stage of the last reduction (s)
+  double getNodeReductionTime() const;
+
+  //! Return the time spent in the inter-node stage of the last reduction (s)
+  double getInterNodeReductionTime() const;
+
+private:
+
+  // Create the sub-communicators
+  void createSubCommunicators( const Communicator& comm,
+                               const int root_process,
+                               const int node_id );
+
+  // Sum a block of values over a communicator and collect on its first proc
+  static void reduceBlock( const Communicator& comm,
+                           const Utility::ArrayView<double>& values,
+                           std::vector<double>& reduced_values );
+
+  // The number of values that are reduced at a time
+  static const size_t s_block_size;
+
+  // The node communicator (the node leader is process 0)
+  std::shared_ptr<const Communicator> d_node_comm;
+
+  // The node leader communicator (the root process is process 0)
+  std::shared_ptr<const Communicator> d_node_leader_comm;
+
+  // The number of nodes
+  int d_number_of_nodes;
+
+  // The time spent in the node-local stage of the last reduction
+  double d_node_reduction_time;
+
+  // The time spent in the inter-node stage of the last reduction
+  double d_inter_node_reduction_time;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_HIERARCHICAL_REDUCER_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_HierarchicalReducer.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstHierarchicalReducer.cpp
+//! \author Alex Robinson
+//! \brief  Hierarchical reducer unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "Utility_HierarchicalReducer.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the values stored by a process
+std::vector<double> createValues( const size_t number_of_values,
+                                  const int rank )
+{
+  std::vector<double> values( number_of_values );
+
+  for( size_t i = 0; i < values.size(); ++i )
+    values[i] = i + rank;
+
+  return values;
+}
+
+// Create the expected reduced values
+std::vector<double> createReducedValues( const size_t number_of_values,
+                                         const int procs )
+{
+  std::vector<double> reduced_values( number_of_values );
+
+  for( size_t i = 0; i < reduced_values.size(); ++i )
+    reduced_values[i] = procs*i + procs*(procs-1)/2;
+
+  return reduced_values;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the values on all processes can be summed
+FRENSIE_UNIT_TEST( HierarchicalReducer, reduceSum )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  Utility::HierarchicalReducer reducer( *comm, 0 );
+
+  // All processes run on the same node in the tests
+  FRENSIE_CHECK_EQUAL( reducer.getNumberOfNodes(), 1 );
+  FRENSIE_CHECK_EQUAL( reducer.isNodeLeader(), comm->rank() == 0 );
+
+  std::vector<double> values = createValues( 10, comm->rank() );
+
+  reducer.reduceSum( values );
+
+  if( comm->rank() == 0 )
+  {
+    FRENSIE_CHECK_EQUAL( values, createReducedValues( 10, comm->size() ) );
+  }
+
+  FRENSIE_CHECK( reducer.getNodeReductionTime() >= 0.0 );
+  FRENSIE_CHECK( reducer.getInterNodeReductionTime() >= 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the values on all processes can be summed over multiple nodes
+FRENSIE_UNIT_TEST( HierarchicalReducer, reduceSum_multiple_nodes )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  // Every pair of processes shares a node - use the last process as the root
+  const int root_process = comm->size()-1;
+  
+  Utility::HierarchicalReducer reducer( *comm, root_process, comm->rank()/2 );
+
+  FRENSIE_CHECK_EQUAL( reducer.getNumberOfNodes(), (comm->size()+1)/2 );
+
+  if( comm->rank() == root_process )
+  {
+    FRENSIE_CHECK( reducer.isNodeLeader() );
+  }
+  
+  // Use enough values to require multiple reduction blocks
+  std::vector<double> values = createValues( 1500000, comm->rank() );
+
+  reducer.reduceSum( values );
+
+  if( comm->rank() == root_process )
+  {
+    FRENSIE_CHECK( values == createReducedValues( 1500000, comm->size() ) );
+  }
+
+  // The reducer can be reused
+  values = createValues( 5, comm->rank() );
+
+  reducer.reduceSum( values );
+
+  if( comm->rank() == root_process )
+  {
+    FRENSIE_CHECK_EQUAL( values, createReducedValues( 5, comm->size() ) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// end tstHierarchicalReducer.cpp
+//---------------------------------------------------------------------------//
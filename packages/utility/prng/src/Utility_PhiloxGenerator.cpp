@@ -0,0 +1,161 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PhiloxGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Definition of a counter-based (Philox-4x32-10) pseudo-random
+//!         number generator that can be used to create reproducible parallel
+//!         random number streams.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor
+PhiloxGenerator::PhiloxGenerator()
+  : d_history( 0ULL ),
+    d_substream( 0u ),
+    d_next_block( 0ULL ),
+    d_buffer_index( 2u )
+{
+  d_buffer[0] = 0ULL;
+  d_buffer[1] = 0ULL;
+}
+
+// Evaluate the Philox-4x32-10 bijection
+PhiloxGenerator::Counter PhiloxGenerator::evaluate( const Counter& counter,
+                                                    const Key& key )
+{
+  Counter output = counter;
+
+  PhiloxGenerator::evaluate( output.words[0],
+                             output.words[1],
+                             output.words[2],
+                             output.words[3],
+                             key.words[0],
+                             key.words[1] );
+
+  return output;
+}
+
+// Fill an array with random numbers for the current history
+/*! \details The random numbers are identical to the ones that would be
+ * returned from consecutive calls to getRandomNumber. Every block that is
+ * not already buffered is evaluated in a single (vectorizable) loop.
+ */
+void PhiloxGenerator::getRandomNumbers( double* random_numbers,
+                                        const size_t size )
+{
+  // Make sure the array is valid
+  testPrecondition( size == 0 || random_numbers != NULL );
+
+  size_t i = 0;
+
+  // Use the buffered random integers first
+  while( i < size && d_buffer_index < 2u )
+    random_numbers[i++] = this->getRandomNumber();
+
+  // Evaluate all of the remaining complete blocks
+  const size_t number_of_blocks = (size - i)/2;
+
+  const unsigned long long first_block = d_next_block;
+  const uint32_t history_low = (uint32_t)d_history;
+  const uint32_t history_high = (uint32_t)(d_history >> 32);
+  const uint32_t substream = d_substream;
+
+  double* block_random_numbers = random_numbers + i;
+
+  #pragma omp simd
+  for( size_t j = 0; j < number_of_blocks; ++j )
+  {
+    const unsigned long long block = first_block + j;
+
+    uint32_t c0 = (uint32_t)block;
+    uint32_t c1 = (uint32_t)(block >> 32);
+    uint32_t c2 = history_low;
+    uint32_t c3 = history_high;
+
+    PhiloxGenerator::evaluate( c0, c1, c2, c3,
+                               substream, PhiloxGenerator::seed );
+
+    block_random_numbers[2*j] = PhiloxGenerator::convertToDouble(
+                                             ((uint64_t)c1 << 32) | c0 );
+    block_random_numbers[2*j+1] = PhiloxGenerator::convertToDouble(
+                                             ((uint64_t)c3 << 32) | c2 );
+  }
+
+  d_next_block += number_of_blocks;
+  i += 2*number_of_blocks;
+
+  // Use a partial block for the remaining random number
+  while( i < size )
+    random_numbers[i++] = this->getRandomNumber();
+}
+
+// Initialize the generator for the desired history and substream
+/*! \details The first history number is assumed to be 0. The substream can
+ * be used to create independent streams for the same history (e.g. one for
+ * source sampling and one for transport).
+ */
+void PhiloxGenerator::changeHistory( const unsigned long long history_number,
+                                     const unsigned substream )
+{
+  d_history = history_number;
+  d_substream = substream;
+  d_next_block = 0ULL;
+  d_buffer_index = 2u;
+}
+
+// Initialize the generator for the next history
+/*! \details The substream will not change.
+ */
+void PhiloxGenerator::nextHistory()
+{
+  this->changeHistory( d_history+1, d_substream );
+}
+
+// Return the current history number
+unsigned long long PhiloxGenerator::getHistory() const
+{
+  return d_history;
+}
+
+// Return the current substream number
+unsigned PhiloxGenerator::getSubstream() const
+{
+  return d_substream;
+}
+
+// Return the number of 64-bit integers drawn from the current stream
+unsigned long long PhiloxGenerator::getNumberOfDraws() const
+{
+  return 2*d_next_block - (2u - d_buffer_index);
+}
+
+// Refill the buffer with the next block of random integers
+void PhiloxGenerator::refillBuffer()
+{
+  uint32_t c0 = (uint32_t)d_next_block;
+  uint32_t c1 = (uint32_t)(d_next_block >> 32);
+  uint32_t c2 = (uint32_t)d_history;
+  uint32_t c3 = (uint32_t)(d_history >> 32);
+
+  PhiloxGenerator::evaluate( c0, c1, c2, c3,
+                             d_substream, PhiloxGenerator::seed );
+
+  d_buffer[0] = ((uint64_t)c1 << 32) | c0;
+  d_buffer[1] = ((uint64_t)c3 << 32) | c2;
+
+  d_buffer_index = 0u;
+
+  ++d_next_block;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_PhiloxGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,200 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PhiloxGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Declaration of a counter-based (Philox-4x32-10) pseudo-random
+//!         number generator that can be used to create reproducible parallel
+//!         random number streams.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PHILOX_GENERATOR_HPP
+#define UTILITY_PHILOX_GENERATOR_HPP
+
+// Std Lib Includes
+#include <cstddef>
+#include <cstdint>
+
+namespace Utility{
+
+//! A counter-based pseudo-random number generator (Philox-4x32-10)
+/*! \details Every random number is a function of the history number, the
+ * substream number and the position in the stream only. The history and
+ * substream number make up the key and the counter that are passed to the
+ * Philox-4x32-10 bijection (Salmon et al., "Parallel Random Numbers: As Easy
+ * as 1, 2, 3", SC11). Each evaluation of the bijection produces two 64-bit
+ * integers (and therefore two uniform deviates). Because no state is carried
+ * between histories, changing the history is a constant time operation and
+ * the random numbers generated for a history do not depend on how the
+ * histories were distributed among the threads.
+ */
+class PhiloxGenerator
+{
+
+public:
+
+  //! The counter type
+  struct Counter
+  {
+    uint32_t words[4];
+  };
+
+  //! The key type
+  struct Key
+  {
+    uint32_t words[2];
+  };
+
+  //! Evaluate the Philox-4x32-10 bijection
+  static Counter evaluate( const Counter& counter, const Key& key );
+
+  //! Constructor
+  PhiloxGenerator();
+
+  //! Destructor
+  ~PhiloxGenerator()
+  { /* ... */ }
+
+  //! Return a random number for the current history
+  double getRandomNumber();
+
+  //! Return a random 64-bit integer for the current history
+  unsigned long long getRandomInteger();
+
+  //! Fill an array with random numbers for the current history
+  void getRandomNumbers( double* random_numbers, const size_t size );
+
+  //! Initialize the generator for the desired history and substream
+  void changeHistory( const unsigned long long history_number,
+                      const unsigned substream = 0u );
+
+  //! Initialize the generator for the next history
+  void nextHistory();
+
+  //! Return the current history number
+  unsigned long long getHistory() const;
+
+  //! Return the current substream number
+  unsigned getSubstream() const;
+
+  //! Return the number of 64-bit integers drawn from the current stream
+  unsigned long long getNumberOfDraws() const;
+
+private:
+
+  // Evaluate the Philox-4x32-10 bijection (no struct overhead)
+  static void evaluate( uint32_t& c0, uint32_t& c1, uint32_t& c2, uint32_t& c3,
+                        uint32_t k0, uint32_t k1 );
+
+  // Multiply two 32-bit integers (returning the high and low words)
+  static void multiplyHighLow( const uint32_t a,
+                               const uint32_t b,
+                               uint32_t& high,
+                               uint32_t& low );
+
+  // Convert a 64-bit integer to a uniform deviate in [0,1)
+  static double convertToDouble( const uint64_t value );
+
+  // Refill the buffer with the next block of random integers
+  void refillBuffer();
+
+  // The generator seed (second key word)
+  static const uint32_t seed = 0x5eed1e55u;
+
+  // The multipliers of the bijection
+  static const uint32_t multiplier_0 = 0xD2511F53u;
+  static const uint32_t multiplier_1 = 0xCD9E8D57u;
+
+  // The key increments (Weyl sequence) of the bijection
+  static const uint32_t key_increment_0 = 0x9E3779B9u;
+  static const uint32_t key_increment_1 = 0xBB67AE85u;
+
+  // The current history number
+  unsigned long long d_history;
+
+  // The current substream
+  unsigned d_substream;
+
+  // The index of the next block that will be evaluated
+  unsigned long long d_next_block;
+
+  // The buffered random integers
+  uint64_t d_buffer[2];
+
+  // The index of the next buffered random integer (2 = empty)
+  unsigned d_buffer_index;
+};
+
+// Multiply two 32-bit integers (returning the high and low words)
+inline void PhiloxGenerator::multiplyHighLow( const uint32_t a,
+                                              const uint32_t b,
+                                              uint32_t& high,
+                                              uint32_t& low )
+{
+  const uint64_t product = (uint64_t)a*(uint64_t)b;
+
+  high = (uint32_t)(product >> 32);
+  low = (uint32_t)product;
+}
+
+// Evaluate the Philox-4x32-10 bijection (no struct overhead)
+inline void PhiloxGenerator::evaluate( uint32_t& c0,
+                                       uint32_t& c1,
+                                       uint32_t& c2,
+                                       uint32_t& c3,
+                                       uint32_t k0,
+                                       uint32_t k1 )
+{
+  for( unsigned round = 0; round < 10; ++round )
+  {
+    // The key is bumped before every round but the first
+    if( round > 0 )
+    {
+      k0 += PhiloxGenerator::key_increment_0;
+      k1 += PhiloxGenerator::key_increment_1;
+    }
+
+    uint32_t high_0, low_0, high_1, low_1;
+
+    PhiloxGenerator::multiplyHighLow( PhiloxGenerator::multiplier_0, c0,
+                                      high_0, low_0 );
+    PhiloxGenerator::multiplyHighLow( PhiloxGenerator::multiplier_1, c2,
+                                      high_1, low_1 );
+
+    c0 = high_1^c1^k0;
+    c1 = low_1;
+    c2 = high_0^c3^k1;
+    c3 = low_0;
+  }
+}
+
+// Convert a 64-bit integer to a uniform deviate in [0,1)
+/*! \details The 53 most significant bits are used (value*2^-53).
+ */
+inline double PhiloxGenerator::convertToDouble( const uint64_t value )
+{
+  return (value >> 11)*1.1102230246251565404e-16;
+}
+
+// Return a random 64-bit integer for the current history
+inline unsigned long long PhiloxGenerator::getRandomInteger()
+{
+  if( d_buffer_index > 1u )
+    this->refillBuffer();
+
+  return d_buffer[d_buffer_index++];
+}
+
+// Return a random number for the current history
+inline double PhiloxGenerator::getRandomNumber()
+{
+  return PhiloxGenerator::convertToDouble( this->getRandomInteger() );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_PHILOX_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PhiloxGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -13,9 +13,12 @@
 
 namespace Utility{
 
-// Initialize the stored generator pointer
-boost::ptr_vector<LinearCongruentialGenerator>
-RandomNumberGenerator::generator( 1 );
+// Initialize the random number streams
+std::vector<RandomNumberGenerator::Stream,boost::alignment::aligned_allocator<RandomNumberGenerator::Stream,64> >
+RandomNumberGenerator::streams;
+
+// Use the linear congruential generator by default
+bool RandomNumberGenerator::counter_based_generator_used = false;
 
 // Constructor
 RandomNumberGenerator::RandomNumberGenerator()
@@ -25,22 +28,13 @@ RandomNumberGenerator::RandomNumberGenerator()
 bool RandomNumberGenerator::hasStreams()
 {
   // Check that there are enough streams
-  if( generator.size() < OpenMPProperties::getRequestedNumberOfThreads() )
-    return false;
-
-  // Check that each stream has been initialized
-  for( unsigned i = 0u; i < generator.size(); ++i )
-  {
-    if( generator.is_null(i) )
-      return false;
-  }
-
-  return true;
+  return streams.size() >= OpenMPProperties::getRequestedNumberOfThreads();
 }
 
 // Create the number of random number streams required
 /*! \details The number of streams that are created will be determined by
- * the number of threads requested at run time
+ * the number of threads requested at run time. Each stream occupies its own
+ * cache line(s).
  */
 void RandomNumberGenerator::createStreams()
 {
@@ -48,40 +42,138 @@ void RandomNumberGenerator::createStreams()
   {
     #pragma omp master
     {
-      generator.resize( OpenMPProperties::getRequestedNumberOfThreads() );
+      streams.clear();
+      streams.resize( OpenMPProperties::getRequestedNumberOfThreads() );
     }
 
     #pragma omp barrier
 
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new LinearCongruentialGenerator() );
+    streams[OpenMPProperties::getThreadId()] = Stream();
   }
 
   // Make sure the streams have been created
-  testPostcondition( !generator.is_null( OpenMPProperties::getThreadId() ));
+  testPostcondition( RandomNumberGenerator::hasStreams() );
+}
+
+// Use the counter-based (Philox) generator for all streams
+/*! \details The random numbers generated for a history will only depend on
+ * the history number and the substream number (the random numbers will be
+ * bit-reproducible regardless of the number of threads or processes and the
+ * order that the histories are simulated in). The streams must be initialized
+ * after changing the generator type. This method must not be called inside
+ * of a parallel block.
+ */
+void RandomNumberGenerator::useCounterBasedGenerator()
+{
+  counter_based_generator_used = true;
+}
+
+// Use the linear congruential generator for all streams (default)
+/*! \details The streams must be initialized after changing the generator
+ * type. This method must not be called inside of a parallel block.
+ */
+void RandomNumberGenerator::useLinearCongruentialGenerator()
+{
+  counter_based_generator_used = false;
+}
+
+// Check if the counter-based generator is used
+bool RandomNumberGenerator::isCounterBasedGeneratorUsed()
+{
+  return counter_based_generator_used;
 }
 
 // Initialize the generator for the desired history
+/*! \details Substreams are only supported by the counter-based generator.
+ */
 void RandomNumberGenerator::initialize(
-				      const unsigned long long history_number )
+				      const unsigned long long history_number,
+                                      const unsigned substream )
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure the streams have been created
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  // Make sure the substream is valid
+  testPrecondition( substream == 0u || counter_based_generator_used );
 
-  generator[OpenMPProperties::getThreadId()].changeHistory(history_number);
+  Stream& stream = RandomNumberGenerator::getThreadStream();
+
+  if( stream.fake_generator )
+    stream.fake_generator->changeHistory( history_number );
+
+  if( counter_based_generator_used )
+    stream.counter_based_generator.changeHistory( history_number, substream );
+  else
+    stream.linear_congruential_generator.changeHistory( history_number );
 }
 
 // Initialize the generator for the next history
 void RandomNumberGenerator::initializeNextHistory()
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure the streams have been created
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
+  Stream& stream = RandomNumberGenerator::getThreadStream();
+
+  if( stream.fake_generator )
+    stream.fake_generator->nextHistory();
+
+  if( counter_based_generator_used )
+    stream.counter_based_generator.nextHistory();
+  else
+    stream.linear_congruential_generator.nextHistory();
+}
 
-  generator[OpenMPProperties::getThreadId()].nextHistory();
+// Save the generator state of the calling thread's stream
+/*! \details The saved state can be restored later to continue the random
+ * number sequence of a history (e.g. when the particles of several histories
+ * are simulated together by one thread). The fake stream is not saved.
+ */
+void RandomNumberGenerator::saveState( GeneratorState& state )
+{
+  const Stream& stream = RandomNumberGenerator::getThreadStream();
+
+  state.linear_congruential_generator = stream.linear_congruential_generator;
+  state.counter_based_generator = stream.counter_based_generator;
+}
+
+// Restore the generator state of the calling thread's stream
+/*! \details The fake stream is not changed.
+ */
+void RandomNumberGenerator::restoreState( const GeneratorState& state )
+{
+  Stream& stream = RandomNumberGenerator::getThreadStream();
+
+  stream.linear_congruential_generator = state.linear_congruential_generator;
+  stream.counter_based_generator = state.counter_based_generator;
+}
+
+// Fill the array with random numbers in interval [0,1)
+/*! \details When the counter-based generator is used the random numbers
+ * will be generated in blocks (using SIMD instructions when possible). The
+ * random numbers will be identical to the ones that would be returned from
+ * consecutive calls to getRandomNumber.
+ */
+void RandomNumberGenerator::getRandomNumbers(
+                                         std::vector<double>& random_numbers )
+{
+  RandomNumberGenerator::getRandomNumbers( random_numbers.data(),
+                                           random_numbers.size() );
+}
+
+// Fill the array with random numbers in interval [0,1)
+/*! \details This overload can be used by sampling routines that need a
+ * small fixed number of random numbers (e.g. stored in a local array).
+ */
+void RandomNumberGenerator::getRandomNumbers( double* random_numbers,
+                                              const size_t size )
+{
+  // Make sure the array is valid
+  testPrecondition( size == 0 || random_numbers != NULL );
+
+  Stream& stream = RandomNumberGenerator::getThreadStream();
+
+  if( !stream.fake_generator && counter_based_generator_used )
+    stream.counter_based_generator.getRandomNumbers( random_numbers, size );
+  else
+  {
+    for( size_t i = 0; i < size; ++i )
+      random_numbers[i] = RandomNumberGenerator::getRandomDouble( stream );
+  }
 }
 
 // Set a fake stream for the generator
@@ -96,12 +188,9 @@ void RandomNumberGenerator::setFakeStream(
 
   if( thread_id == OpenMPProperties::getThreadId() )
   {
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new FakeGenerator( fake_stream ) );
+    RandomNumberGenerator::getThreadStream().fake_generator.reset(
+                                              new FakeGenerator( fake_stream ) );
   }
-
-  // Make sure the generator has been created
-  testPostcondition( !generator.is_null( OpenMPProperties::getThreadId() ));
 }
 
 // Unset the fake stream
@@ -113,13 +202,7 @@ void RandomNumberGenerator::unsetFakeStream( const unsigned thread_id )
   testPrecondition( thread_id < OpenMPProperties::getNumberOfThreads() );
 
   if( thread_id == OpenMPProperties::getThreadId() )
-  {
-    generator.replace( OpenMPProperties::getThreadId(),
-		       new LinearCongruentialGenerator() );
-  }
-
-  // Make sure that the generator has been created
-  testPostcondition(!generator.is_null( OpenMPProperties::getThreadId() ) );
+    RandomNumberGenerator::getThreadStream() = Stream();
 }
 
 } // end Utility namespace
@@ -11,13 +11,14 @@
 
 // Std Lib Includes
 #include <vector>
+#include <memory>
 
 // Boost Includes
-#include <boost/ptr_container/ptr_vector.hpp>
-#include <boost/scoped_ptr.hpp>
+#include <boost/align/aligned_allocator.hpp>
 
 // FRENSIE includes
 #include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_PhiloxGenerator.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -29,18 +30,44 @@ class RandomNumberGenerator
 
 public:
 
+  //! The generator state of a random number stream
+  struct GeneratorState
+  {
+    //! The linear congruential generator
+    LinearCongruentialGenerator linear_congruential_generator;
+
+    //! The counter-based generator
+    PhiloxGenerator counter_based_generator;
+  };
+
   //! Check if the streams have been created
   static bool hasStreams();
 
   //! Create the number of random number streams required
   static void createStreams();
 
+  //! Use the counter-based (Philox) generator for all streams
+  static void useCounterBasedGenerator();
+
+  //! Use the linear congruential generator for all streams (default)
+  static void useLinearCongruentialGenerator();
+
+  //! Check if the counter-based generator is used
+  static bool isCounterBasedGeneratorUsed();
+
   //! Initialize the generator for the desired history
-  static void initialize( const unsigned long long history_number = 0ULL );
+  static void initialize( const unsigned long long history_number = 0ULL,
+                          const unsigned substream = 0u );
 
   //! Initialize the generator for the next history
   static void initializeNextHistory();
 
+  //! Save the generator state of the calling thread's stream
+  static void saveState( GeneratorState& state );
+
+  //! Restore the generator state of the calling thread's stream
+  static void restoreState( const GeneratorState& state );
+
   //! Set a fake stream for the generator
   static void setFakeStream( const std::vector<double>& fake_stream,
 			     const unsigned thread_id = 0u );
@@ -52,6 +79,12 @@ public:
   template<typename ScalarType>
   static ScalarType getRandomNumber();
 
+  //! Fill the array with random numbers in interval [0,1)
+  static void getRandomNumbers( std::vector<double>& random_numbers );
+
+  //! Fill the array with random numbers in interval [0,1)
+  static void getRandomNumbers( double* random_numbers, const size_t size );
+
   //! Destructor
   ~RandomNumberGenerator()
   { /* ... */ }
@@ -61,33 +94,72 @@ private:
   // Constructor
   RandomNumberGenerator();
 
-  // Pointer to generator
-  static boost::ptr_vector<LinearCongruentialGenerator> generator;
+  // The random number stream of a thread (padded to a cache line to prevent
+  // false sharing between the threads)
+  struct alignas(64) Stream
+  {
+    // The linear congruential generator
+    LinearCongruentialGenerator linear_congruential_generator;
+
+    // The counter-based generator
+    PhiloxGenerator counter_based_generator;
+
+    // The fake generator (only set for testing)
+    std::shared_ptr<LinearCongruentialGenerator> fake_generator;
+  };
+
+  // Return the stream of the calling thread
+  static Stream& getThreadStream();
+
+  // Return a random double in interval [0,1) from the stream
+  static double getRandomDouble( Stream& stream );
+
+  // The random number streams (one for each thread)
+  static std::vector<Stream,boost::alignment::aligned_allocator<Stream,64> >
+  streams;
+
+  // Records if the counter-based generator is used
+  static bool counter_based_generator_used;
 };
 
+// Return the stream of the calling thread
+inline auto RandomNumberGenerator::getThreadStream() -> Stream&
+{
+  // Make sure the generator has been set up correctly
+  testPrecondition( OpenMPProperties::getThreadId() < streams.size() );
+
+  return streams[OpenMPProperties::getThreadId()];
+}
+
+// Return a random double in interval [0,1) from the stream
+/*! \details The generators are stored by value so that no virtual function
+ * call is required (unless a fake stream has been set).
+ */
+inline double RandomNumberGenerator::getRandomDouble( Stream& stream )
+{
+  if( stream.fake_generator )
+    return stream.fake_generator->getRandomNumber();
+  else if( counter_based_generator_used )
+    return stream.counter_based_generator.getRandomNumber();
+  else
+    return stream.linear_congruential_generator.getRandomNumber();
+}
+
 // Return a random number in interval [0,1)
 template<typename ScalarType>
 inline ScalarType RandomNumberGenerator::getRandomNumber()
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
-
   return static_cast<ScalarType>(
-	     generator[OpenMPProperties::getThreadId()].getRandomNumber() );
+     RandomNumberGenerator::getRandomDouble(
+                                RandomNumberGenerator::getThreadStream() ) );
 }
 
 // Return a random double in interval [0,1)
 template<>
 inline double RandomNumberGenerator::getRandomNumber<double>()
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
-
-  return generator[OpenMPProperties::getThreadId()].getRandomNumber();
+  return RandomNumberGenerator::getRandomDouble(
+                                    RandomNumberGenerator::getThreadStream() );
 }
 
 // Return a random long long unsigned integer in [0,2^64)
@@ -95,14 +167,22 @@ template<>
 inline unsigned long long
 RandomNumberGenerator::getRandomNumber<unsigned long long>()
 {
-  // Make sure the generator has been set up correctly
-  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
-  // Make sure that the generator has been initialized
-  testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
-
-  generator[OpenMPProperties::getThreadId()].getRandomNumber();
-
-  return generator[OpenMPProperties::getThreadId()].getGeneratorState();
+  Stream& stream = RandomNumberGenerator::getThreadStream();
+
+  if( stream.fake_generator )
+  {
+    stream.fake_generator->getRandomNumber();
+
+    return stream.fake_generator->getGeneratorState();
+  }
+  else if( counter_based_generator_used )
+    return stream.counter_based_generator.getRandomInteger();
+  else
+  {
+    stream.linear_congruential_generator.getRandomNumber();
+
+    return stream.linear_congruential_generator.getGeneratorState();
+  }
 }
 
 } // end Utility namespace
@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPhiloxGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Philox generator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the bijection matches the Random123 known answers
+FRENSIE_UNIT_TEST( PhiloxGenerator, evaluate )
+{
+  Utility::PhiloxGenerator::Counter counter = {{0u, 0u, 0u, 0u}};
+  Utility::PhiloxGenerator::Key key = {{0u, 0u}};
+
+  Utility::PhiloxGenerator::Counter output =
+    Utility::PhiloxGenerator::evaluate( counter, key );
+
+  FRENSIE_CHECK_EQUAL( output.words[0], 0x6627e8d5u );
+  FRENSIE_CHECK_EQUAL( output.words[1], 0xe169c58du );
+  FRENSIE_CHECK_EQUAL( output.words[2], 0xbc57ac4cu );
+  FRENSIE_CHECK_EQUAL( output.words[3], 0x9b00dbd8u );
+
+  counter = {{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}};
+  key = {{0xffffffffu, 0xffffffffu}};
+
+  output = Utility::PhiloxGenerator::evaluate( counter, key );
+
+  FRENSIE_CHECK_EQUAL( output.words[0], 0x408f276du );
+  FRENSIE_CHECK_EQUAL( output.words[1], 0x41c83b0eu );
+  FRENSIE_CHECK_EQUAL( output.words[2], 0xa20bc7c6u );
+  FRENSIE_CHECK_EQUAL( output.words[3], 0x6d5451fdu );
+
+  counter = {{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}};
+  key = {{0xa4093822u, 0x299f31d0u}};
+
+  output = Utility::PhiloxGenerator::evaluate( counter, key );
+
+  FRENSIE_CHECK_EQUAL( output.words[0], 0xd16cfe09u );
+  FRENSIE_CHECK_EQUAL( output.words[1], 0x94fdccebu );
+  FRENSIE_CHECK_EQUAL( output.words[2], 0x5001e420u );
+  FRENSIE_CHECK_EQUAL( output.words[3], 0x24126ea1u );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a random number in the interval [0,1) can be obtained
+FRENSIE_UNIT_TEST( PhiloxGenerator, getRandomNumber )
+{
+  Utility::PhiloxGenerator generator;
+
+  for( unsigned i = 0; i < 100; ++i )
+  {
+    double random_number = generator.getRandomNumber();
+
+    FRENSIE_CHECK_GREATER_OR_EQUAL( random_number, 0.0 );
+    FRENSIE_CHECK_LESS( random_number, 1.0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfDraws(), 100ull );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an array can be filled with random numbers
+FRENSIE_UNIT_TEST( PhiloxGenerator, getRandomNumbers )
+{
+  Utility::PhiloxGenerator generator;
+  generator.changeHistory( 10ull );
+
+  std::vector<double> expected_random_numbers( 101 );
+
+  for( size_t i = 0; i < expected_random_numbers.size(); ++i )
+    expected_random_numbers[i] = generator.getRandomNumber();
+
+  // Start with a partially consumed block
+  generator.changeHistory( 10ull );
+
+  std::vector<double> random_numbers( 101 );
+  random_numbers[0] = generator.getRandomNumber();
+
+  generator.getRandomNumbers( random_numbers.data()+1,
+                              random_numbers.size()-1 );
+
+  FRENSIE_CHECK_EQUAL( random_numbers, expected_random_numbers );
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfDraws(), 101ull );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the random numbers only depend on the history and substream
+FRENSIE_UNIT_TEST( PhiloxGenerator, changeHistory )
+{
+  Utility::PhiloxGenerator generator;
+
+  generator.changeHistory( 1000ull, 1u );
+
+  FRENSIE_CHECK_EQUAL( generator.getHistory(), 1000ull );
+  FRENSIE_CHECK_EQUAL( generator.getSubstream(), 1u );
+
+  double random_number_a = generator.getRandomNumber();
+  double random_number_b = generator.getRandomNumber();
+
+  // A different history must produce a different stream
+  generator.changeHistory( 1001ull, 1u );
+
+  FRENSIE_CHECK( generator.getRandomNumber() != random_number_a );
+
+  // A different substream must produce a different stream
+  generator.changeHistory( 1000ull, 0u );
+
+  FRENSIE_CHECK( generator.getRandomNumber() != random_number_a );
+
+  // Returning to the history must reproduce the stream
+  generator.changeHistory( 1000ull, 1u );
+
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), random_number_a );
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), random_number_b );
+
+  // The next history keeps the substream
+  generator.nextHistory();
+
+  FRENSIE_CHECK_EQUAL( generator.getHistory(), 1001ull );
+  FRENSIE_CHECK_EQUAL( generator.getSubstream(), 1u );
+  FRENSIE_CHECK_EQUAL( generator.getNumberOfDraws(), 0ull );
+}
+
+//---------------------------------------------------------------------------//
+// end tstPhiloxGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -133,6 +133,198 @@ FRENSIE_UNIT_TEST( RandomNumberGenerator, initialize_history )
   FRENSIE_CHECK_EQUAL( all_random_numbers.size(), random_set.size() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the counter-based generator produces the same random numbers
+// for a history regardless of the thread that simulates it
+FRENSIE_UNIT_TEST( RandomNumberGenerator, counter_based_reproducibility )
+{
+  Utility::RandomNumberGenerator::useCounterBasedGenerator();
+  Utility::RandomNumberGenerator::createStreams();
+
+  FRENSIE_CHECK( Utility::RandomNumberGenerator::isCounterBasedGeneratorUsed() );
+
+  const unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+  const unsigned histories = 4*threads;
+
+  // Generate the random numbers of every history on the master thread
+  std::vector<double> expected_random_numbers( 2*histories );
+
+  for( unsigned i = 0; i < histories; ++i )
+  {
+    Utility::RandomNumberGenerator::initialize( i );
+
+    expected_random_numbers[2*i] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+    expected_random_numbers[2*i+1] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  // Generate the random numbers of every history in reverse order on all
+  // threads
+  std::vector<double> random_numbers( 2*histories );
+
+  #pragma omp parallel for num_threads( threads ) schedule( dynamic )
+  for( unsigned i = 0; i < histories; ++i )
+  {
+    const unsigned history = histories - i - 1;
+
+    Utility::RandomNumberGenerator::initialize( history );
+
+    random_numbers[2*history] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+    random_numbers[2*history+1] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  FRENSIE_CHECK_EQUAL( random_numbers, expected_random_numbers );
+
+  // A different substream must produce a different stream
+  Utility::RandomNumberGenerator::initialize( 0, 1 );
+
+  FRENSIE_CHECK( Utility::RandomNumberGenerator::getRandomNumber<double>() !=
+                 expected_random_numbers[0] );
+
+  Utility::RandomNumberGenerator::useLinearCongruentialGenerator();
+  Utility::RandomNumberGenerator::createStreams();
+
+  FRENSIE_CHECK( !Utility::RandomNumberGenerator::isCounterBasedGeneratorUsed() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an array can be filled with random numbers
+FRENSIE_UNIT_TEST( RandomNumberGenerator, getRandomNumbers )
+{
+  std::vector<double> random_numbers( 11 );
+
+  // Linear congruential generator
+  Utility::RandomNumberGenerator::initialize( 3 );
+
+  std::vector<double> expected_random_numbers( random_numbers.size() );
+
+  for( size_t i = 0; i < expected_random_numbers.size(); ++i )
+  {
+    expected_random_numbers[i] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  Utility::RandomNumberGenerator::initialize( 3 );
+  Utility::RandomNumberGenerator::getRandomNumbers( random_numbers );
+
+  FRENSIE_CHECK_EQUAL( random_numbers, expected_random_numbers );
+
+  // Counter-based generator
+  Utility::RandomNumberGenerator::useCounterBasedGenerator();
+  Utility::RandomNumberGenerator::createStreams();
+  Utility::RandomNumberGenerator::initialize( 3 );
+
+  for( size_t i = 0; i < expected_random_numbers.size(); ++i )
+  {
+    expected_random_numbers[i] =
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  Utility::RandomNumberGenerator::initialize( 3 );
+  Utility::RandomNumberGenerator::getRandomNumbers( random_numbers );
+
+  FRENSIE_CHECK_EQUAL( random_numbers, expected_random_numbers );
+
+  // Fill a local array in two calls
+  double local_random_numbers[11];
+
+  Utility::RandomNumberGenerator::initialize( 3 );
+  Utility::RandomNumberGenerator::getRandomNumbers( local_random_numbers, 3 );
+  Utility::RandomNumberGenerator::getRandomNumbers( local_random_numbers+3,
+                                                    8 );
+
+  FRENSIE_CHECK_EQUAL( std::vector<double>( local_random_numbers,
+                                            local_random_numbers+11 ),
+                       expected_random_numbers );
+
+  // Fake stream
+  std::vector<double> fake_stream( {0.2, 0.4, 0.6} );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  random_numbers.resize( 3 );
+
+  Utility::RandomNumberGenerator::getRandomNumbers( random_numbers );
+
+  FRENSIE_CHECK_EQUAL( random_numbers, fake_stream );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  Utility::RandomNumberGenerator::useLinearCongruentialGenerator();
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator state of a history can be saved and restored
+FRENSIE_UNIT_TEST( RandomNumberGenerator, saveState_restoreState )
+{
+  for( size_t i = 0; i < 2; ++i )
+  {
+    if( i == 1 )
+    {
+      Utility::RandomNumberGenerator::useCounterBasedGenerator();
+      Utility::RandomNumberGenerator::createStreams();
+    }
+
+    // Generate the random numbers of two histories one after the other
+    std::vector<double> expected_random_numbers( 6 );
+
+    Utility::RandomNumberGenerator::initialize( 5 );
+
+    for( size_t j = 0; j < 3; ++j )
+    {
+      expected_random_numbers[j] =
+        Utility::RandomNumberGenerator::getRandomNumber<double>();
+    }
+
+    Utility::RandomNumberGenerator::initialize( 6 );
+
+    for( size_t j = 3; j < 6; ++j )
+    {
+      expected_random_numbers[j] =
+        Utility::RandomNumberGenerator::getRandomNumber<double>();
+    }
+
+    // Generate the random numbers of the two histories in an interleaved
+    // order
+    std::vector<double> random_numbers( 6 );
+
+    Utility::RandomNumberGenerator::GeneratorState history_5_state,
+      history_6_state;
+
+    Utility::RandomNumberGenerator::initialize( 5 );
+    Utility::RandomNumberGenerator::saveState( history_5_state );
+
+    Utility::RandomNumberGenerator::initialize( 6 );
+    Utility::RandomNumberGenerator::saveState( history_6_state );
+
+    for( size_t j = 0; j < 3; ++j )
+    {
+      Utility::RandomNumberGenerator::restoreState( history_6_state );
+
+      random_numbers[3+j] =
+        Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+      Utility::RandomNumberGenerator::saveState( history_6_state );
+      Utility::RandomNumberGenerator::restoreState( history_5_state );
+
+      random_numbers[j] =
+        Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+      Utility::RandomNumberGenerator::saveState( history_5_state );
+    }
+
+    FRENSIE_CHECK_EQUAL( random_numbers, expected_random_numbers );
+  }
+
+  Utility::RandomNumberGenerator::useLinearCongruentialGenerator();
+  Utility::RandomNumberGenerator::createStreams();
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
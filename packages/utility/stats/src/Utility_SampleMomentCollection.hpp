@@ -107,6 +107,9 @@ public:
   //! Add a raw score to all moments in the collection
   void addRawScore( const T& raw_score );
 
+  //! Merge collections
+  void mergeCollections( const SampleMomentCollection& other_collection );
+
 private:
 
   // Make the data extractor class a friend
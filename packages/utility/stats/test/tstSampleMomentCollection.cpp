@@ -585,6 +585,47 @@ FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollection, addRawScore, TestingTypes )
                        Utility::QuantityTraits<ValueType4>::one()*10000. );
 }
 
+//---------------------------------------------------------------------------//
+// Check that collections can be merged
+FRENSIE_UNIT_TEST_TEMPLATE( SampleMomentCollection, mergeCollections, TestingTypes )
+{
+  FETCH_TEMPLATE_PARAM( 0, T );
+
+  Utility::SampleMomentCollection<T,1,2,3,4> moment_collection( 2 );
+  Utility::SampleMomentCollection<T,1,2,3,4> other_moment_collection( 2 );
+
+  moment_collection.addRawScore( 0, Utility::QuantityTraits<T>::one()*10. );
+  other_moment_collection.addRawScore( Utility::QuantityTraits<T>::one()*10. );
+
+  moment_collection.mergeCollections( other_moment_collection );
+
+  typedef typename Utility::SampleMoment<1,T>::ValueType ValueType1;
+  typedef typename Utility::SampleMoment<2,T>::ValueType ValueType2;
+  typedef typename Utility::SampleMoment<3,T>::ValueType ValueType3;
+  typedef typename Utility::SampleMoment<4,T>::ValueType ValueType4;
+
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 0 ),
+                       Utility::QuantityTraits<ValueType1>::one()*20. );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( moment_collection, 1 ),
+                       Utility::QuantityTraits<ValueType1>::one()*10. );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, 0 ),
+                       Utility::QuantityTraits<ValueType2>::one()*200. );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<2>( moment_collection, 1 ),
+                       Utility::QuantityTraits<ValueType2>::one()*100. );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( moment_collection, 0 ),
+                       Utility::QuantityTraits<ValueType3>::one()*2000. );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<3>( moment_collection, 1 ),
+                       Utility::QuantityTraits<ValueType3>::one()*1000. );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 0 ),
+                       Utility::QuantityTraits<ValueType4>::one()*20000. );
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<4>( moment_collection, 1 ),
+                       Utility::QuantityTraits<ValueType4>::one()*10000. );
+
+  // The other collection should not be modified
+  FRENSIE_CHECK_EQUAL( Utility::getCurrentScore<1>( other_moment_collection, 0 ),
+                       Utility::QuantityTraits<ValueType1>::one()*10. );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the current score can be returned using the standalone helper
 // function
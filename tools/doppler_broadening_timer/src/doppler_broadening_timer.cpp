@@ -0,0 +1,365 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   doppler_broadening_timer.cpp
+//! \author Alex Robinson
+//! \brief  The on-the-fly Doppler broadening timing exec
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// Boost Includes
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_Nuclide.hpp"
+#include "MonteCarlo_NuclideACEFactory.hpp"
+#include "MonteCarlo_NuclearReactionType.hpp"
+#include "MonteCarlo_SimulationProperties.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Data_ACEFileHandler.hpp"
+#include "Data_XSSNeutronDataExtractor.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_LoggingMacros.hpp"
+
+// A nuclear data table evaluated at a single temperature
+struct Table
+{
+  std::string name;
+  double temperature;
+  size_t energy_grid_size;
+  size_t cross_section_values;
+  std::shared_ptr<const MonteCarlo::Nuclide> nuclide;
+};
+
+// Return the elapsed time (s) since the start time
+double getElapsedTime( const std::chrono::steady_clock::time_point& start_time )
+{
+  return std::chrono::duration<double>( std::chrono::steady_clock::now() -
+                                        start_time ).count();
+}
+
+// Load a nuclear data table
+/*! \details The number of cross section values that are stored by the table
+ * (the ESZ and SIG blocks) will also be recorded.
+ */
+void loadTable( const boost::filesystem::path& data_directory,
+                const Data::NuclearDataProperties& data_properties,
+                const double atomic_weight_ratio,
+                const MonteCarlo::SimulationProperties& properties,
+                Table& table )
+{
+  boost::filesystem::path ace_file_path = data_directory;
+  ace_file_path /= data_properties.filePath();
+  ace_file_path.make_preferred();
+
+  Data::ACEFileHandler ace_file_handler( ace_file_path,
+                                         data_properties.tableName(),
+                                         data_properties.fileStartLine(),
+                                         true );
+
+  Data::XSSNeutronDataExtractor xss_data_extractor(
+                                         ace_file_handler.getTableNXSArray(),
+                                         ace_file_handler.getTableJXSArray(),
+                                         ace_file_handler.getTableXSSArray() );
+
+  table.name = data_properties.tableName();
+  table.temperature = data_properties.evaluationTemperatureInMeV().value();
+  table.energy_grid_size = xss_data_extractor.extractEnergyGrid().size();
+  table.cross_section_values = xss_data_extractor.extractESZBlock().size() +
+    xss_data_extractor.extractSIGBlock().size();
+
+  MonteCarlo::NuclideACEFactory::createNuclide(
+                                     xss_data_extractor,
+                                     data_properties.tableName(),
+                                     data_properties.zaid().atomicNumber(),
+                                     data_properties.zaid().atomicMassNumber(),
+                                     data_properties.zaid().isomerNumber(),
+                                     atomic_weight_ratio,
+                                     table.temperature,
+                                     properties,
+                                     table.nuclide );
+}
+
+// Time the cross section lookups
+/*! \details The sum of the cross sections is stored in the checksum so that
+ * the lookups cannot be optimized away. The elapsed wall time (s) is
+ * returned.
+ */
+template<typename LookupFunction>
+double timeLookups( const std::vector<double>& energies,
+                    const LookupFunction& lookup,
+                    double& checksum )
+{
+  checksum = 0.0;
+
+  std::chrono::steady_clock::time_point start_time =
+    std::chrono::steady_clock::now();
+
+  for( size_t i = 0; i < energies.size(); ++i )
+    checksum += lookup( energies[i] );
+
+  return getElapsedTime( start_time );
+}
+
+int main( int argc, char** argv )
+{
+  FRENSIE_SETUP_STANDARD_SYNCHRONOUS_LOGS( std::cout );
+
+  boost::program_options::variables_map command_line_arguments;
+
+  // Create the command line options
+  {
+    boost::program_options::options_description command_line_options;
+    command_line_options.add_options()
+      ("help,h", "produce help message")
+      ("database,d",
+       boost::program_options::value<std::string>(),
+       "specify the scattering center database name (with path)")
+      ("zaid,z",
+       boost::program_options::value<unsigned>(),
+       "specify the zaid of the nuclide (e.g. 92238) - the database must "
+       "contain ACE tables evaluated at two or more temperatures")
+      ("table_version",
+       boost::program_options::value<unsigned>(),
+       "specify the ACE table major version (the recommended version will "
+       "be used by default)")
+      ("lookups,n",
+       boost::program_options::value<unsigned>()->default_value( 1000000 ),
+       "specify the number of cross section lookups at each temperature")
+      ("min_energy",
+       boost::program_options::value<double>()->default_value( 1e-11 ),
+       "specify the min lookup energy (MeV)")
+      ("max_broadening_energy",
+       boost::program_options::value<double>()->default_value( 0.1 ),
+       "specify the max Doppler broadening energy (MeV), which is also the "
+       "max lookup energy")
+      ("reaction_mt",
+       boost::program_options::value<unsigned>()->default_value( 2 ),
+       "specify the MT number of the reaction cross section that will be "
+       "looked up along with the total cross section");
+
+    // Parse the command line arguments
+    boost::program_options::store(
+         boost::program_options::command_line_parser(argc, argv).options(command_line_options).run(),
+         command_line_arguments );
+
+    boost::program_options::notify( command_line_arguments );
+
+    if( command_line_arguments.count( "help" ) )
+    {
+      std::cout << command_line_options << std::endl;
+
+      return 0;
+    }
+  }
+
+  TEST_FOR_EXCEPTION( !command_line_arguments.count( "database" ),
+                      std::runtime_error,
+                      "The scattering center database must be specified!" );
+
+  TEST_FOR_EXCEPTION( !command_line_arguments.count( "zaid" ),
+                      std::runtime_error,
+                      "The nuclide zaid must be specified!" );
+
+  const double min_energy = command_line_arguments["min_energy"].as<double>();
+  const double max_broadening_energy =
+    command_line_arguments["max_broadening_energy"].as<double>();
+
+  TEST_FOR_EXCEPTION( min_energy <= 0.0 ||
+                      min_energy >= max_broadening_energy,
+                      std::runtime_error,
+                      "The min energy must be positive and less than the "
+                      "max broadening energy!" );
+
+  const MonteCarlo::NuclearReactionType reaction =
+    MonteCarlo::convertMTNumberToNuclearReactionType(
+                         command_line_arguments["reaction_mt"].as<unsigned>() );
+
+  // Load the database
+  const boost::filesystem::path database_path =
+    command_line_arguments["database"].as<std::string>();
+
+  const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+  const Data::NuclideProperties& nuclide_properties =
+    database.getNuclideProperties( command_line_arguments["zaid"].as<unsigned>() );
+
+  const unsigned table_version = command_line_arguments.count( "table_version" ) ?
+    command_line_arguments["table_version"].as<unsigned>() :
+    nuclide_properties.getRecommendedDataFileVersion( Data::NuclearDataProperties::ACE_FILE );
+
+  std::vector<Data::NuclideProperties::Energy> evaluation_temps =
+    nuclide_properties.getDataEvaluationTempsInMeV(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         table_version );
+
+  TEST_FOR_EXCEPTION( evaluation_temps.size() < 2,
+                      std::runtime_error,
+                      "ACE tables evaluated at two or more temperatures are "
+                      "required (" << evaluation_temps.size() << " found)!" );
+
+  std::sort( evaluation_temps.begin(), evaluation_temps.end() );
+
+  MonteCarlo::SimulationProperties properties;
+  properties.setParticleMode( MonteCarlo::NEUTRON_MODE );
+  properties.setMaxDopplerBroadeningEnergy( max_broadening_energy );
+
+  // Load the pre-broadened tables (one for each temperature)
+  std::vector<Table> tables( evaluation_temps.size() );
+
+  std::chrono::steady_clock::time_point start_time =
+    std::chrono::steady_clock::now();
+
+  for( size_t i = 0; i < tables.size(); ++i )
+  {
+    loadTable( database_path.parent_path(),
+               nuclide_properties.getNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         table_version,
+                                         evaluation_temps[i],
+                                         true ),
+               nuclide_properties.atomicWeightRatio(),
+               properties,
+               tables[i] );
+  }
+
+  FRENSIE_LOG_NOTIFICATION( "Pre-broadened table load time (s): "
+                            << getElapsedTime( start_time ) );
+
+  // Broaden the lowest temperature table to every other temperature
+  std::vector<std::shared_ptr<const MonteCarlo::Nuclide> >
+    broadened_nuclides( tables.size() );
+
+  broadened_nuclides[0] = tables[0].nuclide;
+
+  start_time = std::chrono::steady_clock::now();
+
+  for( size_t i = 1; i < tables.size(); ++i )
+  {
+    broadened_nuclides[i].reset(
+                       new MonteCarlo::Nuclide( *tables[0].nuclide,
+                                                tables[i].temperature,
+                                                max_broadening_energy ) );
+  }
+
+  FRENSIE_LOG_NOTIFICATION( "On-the-fly nuclide construction time (s): "
+                            << getElapsedTime( start_time ) );
+
+  // Compare the cross section memory footprints - the broadened nuclides
+  // only store the total and total absorption cross sections
+  {
+    size_t pre_broadened_values = 0;
+
+    for( size_t i = 0; i < tables.size(); ++i )
+      pre_broadened_values += tables[i].cross_section_values;
+
+    const size_t on_the_fly_values = tables[0].cross_section_values +
+      2*(tables.size()-1)*tables[0].energy_grid_size;
+
+    FRENSIE_LOG_NOTIFICATION( "Pre-broadened cross section memory (MB): "
+                              << pre_broadened_values*sizeof(double)/1048576.0 );
+    FRENSIE_LOG_NOTIFICATION( "On-the-fly cross section memory (MB): "
+                              << on_the_fly_values*sizeof(double)/1048576.0 );
+  }
+
+  // Sample the lookup energies (log-uniform)
+  std::vector<double> energies( command_line_arguments["lookups"].as<unsigned>() );
+
+  {
+    std::mt19937 generator( 1 );
+    std::uniform_real_distribution<double>
+      log_energy_distribution( std::log( min_energy ),
+                               std::log( max_broadening_energy ) );
+
+    for( size_t i = 0; i < energies.size(); ++i )
+      energies[i] = std::exp( log_energy_distribution( generator ) );
+  }
+
+  // Time the lookups at each temperature
+  for( size_t i = 1; i < tables.size(); ++i )
+  {
+    const MonteCarlo::Nuclide& pre_broadened_nuclide = *tables[i].nuclide;
+    const MonteCarlo::Nuclide& broadened_nuclide = *broadened_nuclides[i];
+
+    FRENSIE_LOG_NOTIFICATION( "Temperature (MeV): " << tables[i].temperature
+                              << " (" << tables[i].name << " vs. "
+                              << tables[0].name << " broadened)" );
+
+    double pre_broadened_checksum, on_the_fly_checksum;
+
+    double time = timeLookups( energies,
+                               [&pre_broadened_nuclide]( const double energy ){
+                                 return pre_broadened_nuclide.getTotalCrossSection( energy ); },
+                               pre_broadened_checksum );
+
+    FRENSIE_LOG_NOTIFICATION( "  Pre-broadened total cross section lookups/s: "
+                              << energies.size()/time );
+
+    time = timeLookups( energies,
+                        [&broadened_nuclide]( const double energy ){
+                          return broadened_nuclide.getTotalCrossSection( energy ); },
+                        on_the_fly_checksum );
+
+    FRENSIE_LOG_NOTIFICATION( "  On-the-fly total cross section lookups/s: "
+                              << energies.size()/time );
+    FRENSIE_LOG_NOTIFICATION( "  Summed total cross section relative difference: "
+                              << (on_the_fly_checksum - pre_broadened_checksum)/
+                              pre_broadened_checksum );
+
+    // The broadened reaction cross sections are evaluated on every lookup
+    time = timeLookups( energies,
+                        [&pre_broadened_nuclide, reaction]( const double energy ){
+                          return pre_broadened_nuclide.getReactionCrossSection( energy, reaction ); },
+                        pre_broadened_checksum );
+
+    FRENSIE_LOG_NOTIFICATION( "  Pre-broadened " << reaction
+                              << " cross section lookups/s: "
+                              << energies.size()/time );
+
+    time = timeLookups( energies,
+                        [&broadened_nuclide, reaction]( const double energy ){
+                          return broadened_nuclide.getReactionCrossSection( energy, reaction ); },
+                        on_the_fly_checksum );
+
+    FRENSIE_LOG_NOTIFICATION( "  On-the-fly " << reaction
+                              << " cross section lookups/s: "
+                              << energies.size()/time );
+
+    // The max relative difference of the total cross sections
+    double max_relative_difference = 0.0;
+
+    for( size_t j = 0; j < energies.size(); ++j )
+    {
+      const double pre_broadened_cross_section =
+        pre_broadened_nuclide.getTotalCrossSection( energies[j] );
+
+      if( pre_broadened_cross_section > 0.0 )
+      {
+        max_relative_difference =
+          std::max( max_relative_difference,
+                    std::fabs( broadened_nuclide.getTotalCrossSection( energies[j] ) -
+                               pre_broadened_cross_section )/
+                    pre_broadened_cross_section );
+      }
+    }
+
+    FRENSIE_LOG_NOTIFICATION( "  Max total cross section relative difference: "
+                              << max_relative_difference );
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end doppler_broadening_timer.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   epr_to_mapped_epr.cpp
+//! \author Alex Robinson
+//! \brief  The native epr to mapped native epr converter exec
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <chrono>
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+// FRENSIE Includes
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Data_MappedElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_LoggingMacros.hpp"
+
+// Return the elapsed time (s) since the start time
+double getElapsedTime( const std::chrono::steady_clock::time_point& start_time )
+{
+  return std::chrono::duration<double>( std::chrono::steady_clock::now() -
+                                        start_time ).count();
+}
+
+int main( int argc, char** argv )
+{
+  FRENSIE_SETUP_STANDARD_SYNCHRONOUS_LOGS( std::cout );
+
+  boost::program_options::variables_map command_line_arguments;
+
+  // Create the command line options
+  {
+    boost::program_options::options_description command_line_options;
+    command_line_options.add_options()
+      ("help,h", "produce help message")
+      ("epr_file,e",
+       boost::program_options::value<std::string>(),
+       "specify the relative location of the native epr file")
+      ("output_file,o",
+       boost::program_options::value<std::string>(),
+       "specify the output (mapped native epr) file name")
+      ("overwrite",
+       "overwrite the output file if it already exists")
+      ("time,t",
+       "report the load time of the native epr file and the mapped file");
+
+    // Parse the command line arguments
+    boost::program_options::store(
+         boost::program_options::command_line_parser(argc, argv).options(command_line_options).run(),
+         command_line_arguments );
+
+    boost::program_options::notify( command_line_arguments );
+
+    if( command_line_arguments.count( "help" ) )
+    {
+      std::cout << command_line_options << std::endl;
+
+      return 0;
+    }
+  }
+
+  // Set the native epr file name
+  TEST_FOR_EXCEPTION( !command_line_arguments.count( "epr_file" ),
+                      std::runtime_error,
+                      "The native epr file must be specified!" );
+
+  boost::filesystem::path epr_file_name =
+    command_line_arguments["epr_file"].as<std::string>();
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( epr_file_name ),
+                      std::runtime_error,
+                      "The native epr file path is not valid!" );
+
+  // Set the output file name
+  TEST_FOR_EXCEPTION( !command_line_arguments.count( "output_file" ),
+                      std::runtime_error,
+                      "The output file must be specified!" );
+
+  boost::filesystem::path output_file_name =
+    command_line_arguments["output_file"].as<std::string>();
+
+  const bool overwrite = command_line_arguments.count( "overwrite" );
+
+  // Load the native epr file
+  std::chrono::steady_clock::time_point start_time =
+    std::chrono::steady_clock::now();
+
+  std::unique_ptr<const Data::ElectronPhotonRelaxationDataContainer>
+    epr_data( new Data::ElectronPhotonRelaxationDataContainer( epr_file_name ) );
+
+  const double archive_load_time = getElapsedTime( start_time );
+
+  // Write the mapped native epr file
+  FRENSIE_LOG_NOTIFICATION( "Converting " << epr_file_name.string() <<
+                            " to " << output_file_name.string() << " ... " );
+
+  epr_data->saveToMappedFile( output_file_name, overwrite );
+
+  FRENSIE_LOG_NOTIFICATION( "done." );
+
+  // Report the load times
+  if( command_line_arguments.count( "time" ) )
+  {
+    start_time = std::chrono::steady_clock::now();
+
+    std::unique_ptr<const Data::MappedElectronPhotonRelaxationDataContainer>
+      mapped_epr_data( new Data::MappedElectronPhotonRelaxationDataContainer( output_file_name ) );
+
+    const double mapped_load_time = getElapsedTime( start_time );
+
+    FRENSIE_LOG_NOTIFICATION( "Native epr load time (s): "
+                              << archive_load_time );
+    FRENSIE_LOG_NOTIFICATION( "Mapped native epr load time (s): "
+                              << mapped_load_time );
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end epr_to_mapped_epr.cpp
+//---------------------------------------------------------------------------//
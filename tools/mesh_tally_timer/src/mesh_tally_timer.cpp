@@ -0,0 +1,331 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   mesh_tally_timer.cpp
+//! \author Alex Robinson
+//! \brief  The mesh track-length flux estimator timing exec
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// Boost Includes
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_DenseMeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_TetMesh.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "FRENSIE_config.hpp"
+
+// A particle subtrack
+struct Subtrack
+{
+  double start_point[3];
+  double end_point[3];
+  double energy;
+};
+
+// Return the elapsed time (s) since the start time
+double getElapsedTime( const std::chrono::steady_clock::time_point& start_time )
+{
+  return std::chrono::duration<double>( std::chrono::steady_clock::now() -
+                                        start_time ).count();
+}
+
+// Create the particle histories
+/*! \details Each history is a random walk that starts at a random point in
+ * the box and takes exponentially distributed steps in isotropic directions.
+ * Steps that would leave the box are clipped to just inside the box surface.
+ */
+void createHistories( const unsigned number_of_histories,
+                      const unsigned subtracks_per_history,
+                      const double min_coord,
+                      const double max_coord,
+                      const double mean_free_path,
+                      std::vector<std::vector<Subtrack> >& histories )
+{
+  std::mt19937 generator( 1 );
+  std::uniform_real_distribution<double> position_distribution( min_coord, max_coord );
+  std::uniform_real_distribution<double> mu_distribution( -1.0, 1.0 );
+  std::uniform_real_distribution<double> phi_distribution( 0.0, 2*M_PI );
+  std::uniform_real_distribution<double> energy_distribution( 0.0, 1.0 );
+  std::exponential_distribution<double> distance_distribution( 1.0/mean_free_path );
+
+  const double tolerance = 1e-9*(max_coord - min_coord);
+
+  histories.resize( number_of_histories );
+
+  for( auto&& history : histories )
+  {
+    history.resize( subtracks_per_history );
+
+    double position[3] = {position_distribution( generator ),
+                          position_distribution( generator ),
+                          position_distribution( generator )};
+
+    for( auto&& subtrack : history )
+    {
+      const double mu = mu_distribution( generator );
+      const double phi = phi_distribution( generator );
+      const double sin_theta = std::sqrt( 1.0 - mu*mu );
+      const double distance = distance_distribution( generator );
+
+      for( size_t i = 0; i < 3; ++i )
+        subtrack.start_point[i] = position[i];
+
+      subtrack.end_point[0] = position[0] + distance*sin_theta*std::cos( phi );
+      subtrack.end_point[1] = position[1] + distance*sin_theta*std::sin( phi );
+      subtrack.end_point[2] = position[2] + distance*mu;
+
+      // Keep the particle inside of the mesh
+      for( size_t i = 0; i < 3; ++i )
+      {
+        subtrack.end_point[i] =
+          std::min( std::max( subtrack.end_point[i], min_coord + tolerance ),
+                    max_coord - tolerance );
+      }
+
+      subtrack.energy = energy_distribution( generator );
+
+      for( size_t i = 0; i < 3; ++i )
+        position[i] = subtrack.end_point[i];
+    }
+  }
+}
+
+// Time the estimator
+/*! \details The estimator is updated with every subtrack of a history and
+ * the history contribution is then committed. The histories are distributed
+ * over the requested number of threads. The elapsed wall time (s) is returned.
+ */
+template<typename EstimatorType>
+double timeEstimator( EstimatorType& estimator,
+                      const std::vector<std::vector<Subtrack> >& histories,
+                      const unsigned threads )
+{
+  std::vector<double> energy_bin_boundaries( {0.0, 0.1, 0.5, 1.0} );
+
+  estimator.template setDiscretization<MonteCarlo::OBSERVER_ENERGY_DIMENSION>(
+                                                       energy_bin_boundaries );
+
+  std::vector<MonteCarlo::ParticleType> particle_types( 1, MonteCarlo::PHOTON );
+
+  estimator.setParticleTypes( particle_types );
+
+  estimator.enableThreadSupport( threads );
+
+  std::chrono::steady_clock::time_point start_time =
+    std::chrono::steady_clock::now();
+
+  #pragma omp parallel for num_threads( threads ) schedule( dynamic, 100 )
+  for( size_t i = 0; i < histories.size(); ++i )
+  {
+    MonteCarlo::PhotonState particle( i );
+    particle.setWeight( 1.0 );
+
+    for( auto&& subtrack : histories[i] )
+    {
+      particle.setEnergy( subtrack.energy );
+
+      estimator.updateFromGlobalParticleSubtrackEndingEvent(
+                                                         particle,
+                                                         subtrack.start_point,
+                                                         subtrack.end_point );
+    }
+
+    estimator.commitHistoryContribution();
+  }
+
+  return getElapsedTime( start_time );
+}
+
+int main( int argc, char** argv )
+{
+  FRENSIE_SETUP_STANDARD_SYNCHRONOUS_LOGS( std::cout );
+
+  boost::program_options::variables_map command_line_arguments;
+
+  // Create the command line options
+  {
+    boost::program_options::options_description command_line_options;
+    command_line_options.add_options()
+      ("help,h", "produce help message")
+      ("mesh_type,m",
+       boost::program_options::value<std::string>()->default_value( "hex" ),
+       "specify the mesh type (hex or tet)")
+      ("elements_per_dimension,n",
+       boost::program_options::value<unsigned>()->default_value( 100 ),
+       "specify the number of hex elements along each dimension of the "
+       "structured hex mesh")
+      ("tet_mesh_file",
+       boost::program_options::value<std::string>(),
+       "specify the tet mesh file (requires moab)")
+      ("min_coordinate",
+       boost::program_options::value<double>()->default_value( 0.0 ),
+       "specify the minimum coordinate of the (cubic) mesh bounding box")
+      ("max_coordinate",
+       boost::program_options::value<double>()->default_value( 1.0 ),
+       "specify the maximum coordinate of the (cubic) mesh bounding box")
+      ("histories",
+       boost::program_options::value<unsigned>()->default_value( 100000 ),
+       "specify the number of histories")
+      ("subtracks_per_history",
+       boost::program_options::value<unsigned>()->default_value( 10 ),
+       "specify the number of subtracks in each history")
+      ("mean_free_path",
+       boost::program_options::value<double>()->default_value( 0.1 ),
+       "specify the mean subtrack length")
+      ("threads,t",
+       boost::program_options::value<unsigned>()->default_value( 1 ),
+       "specify the number of threads")
+      ("single_precision_second_moments",
+       "store the second moments of the dense estimator in single precision")
+      ("skip_standard",
+       "only time the dense estimator");
+
+    // Parse the command line arguments
+    boost::program_options::store(
+         boost::program_options::command_line_parser(argc, argv).options(command_line_options).run(),
+         command_line_arguments );
+
+    boost::program_options::notify( command_line_arguments );
+
+    if( command_line_arguments.count( "help" ) )
+    {
+      std::cout << command_line_options << std::endl;
+
+      return 0;
+    }
+  }
+
+  const double min_coord = command_line_arguments["min_coordinate"].as<double>();
+  const double max_coord = command_line_arguments["max_coordinate"].as<double>();
+
+  TEST_FOR_EXCEPTION( min_coord >= max_coord,
+                      std::runtime_error,
+                      "The min coordinate must be less than the max "
+                      "coordinate!" );
+
+  const unsigned threads = command_line_arguments["threads"].as<unsigned>();
+
+  TEST_FOR_EXCEPTION( threads == 0,
+                      std::runtime_error,
+                      "At least one thread must be used!" );
+
+  if( Utility::OpenMPProperties::isOpenMPUsed() )
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+  // Create the mesh
+  std::shared_ptr<const Utility::Mesh> mesh;
+
+  std::chrono::steady_clock::time_point start_time =
+    std::chrono::steady_clock::now();
+
+  const std::string mesh_type =
+    command_line_arguments["mesh_type"].as<std::string>();
+
+  if( mesh_type == "hex" )
+  {
+    const unsigned elements_per_dimension =
+      command_line_arguments["elements_per_dimension"].as<unsigned>();
+
+    TEST_FOR_EXCEPTION( elements_per_dimension == 0,
+                        std::runtime_error,
+                        "At least one element per dimension is required!" );
+
+    std::vector<double> planes( elements_per_dimension+1 );
+
+    for( size_t i = 0; i < planes.size(); ++i )
+    {
+      planes[i] = min_coord +
+        i*(max_coord - min_coord)/elements_per_dimension;
+    }
+
+    mesh.reset( new Utility::StructuredHexMesh( planes, planes, planes ) );
+  }
+  else if( mesh_type == "tet" )
+  {
+#ifdef HAVE_FRENSIE_MOAB
+    TEST_FOR_EXCEPTION( !command_line_arguments.count( "tet_mesh_file" ),
+                        std::runtime_error,
+                        "The tet mesh file must be specified!" );
+
+    mesh.reset( new Utility::TetMesh(
+                  command_line_arguments["tet_mesh_file"].as<std::string>(),
+                  false,
+                  false ) );
+#else
+    THROW_EXCEPTION( std::runtime_error,
+                     "Tet meshes can only be used when FRENSIE has been "
+                     "built with moab!" );
+#endif // end HAVE_FRENSIE_MOAB
+  }
+  else
+  {
+    THROW_EXCEPTION( std::runtime_error,
+                     "Mesh type " << mesh_type << " is not supported!" );
+  }
+
+  FRENSIE_LOG_NOTIFICATION( "Mesh elements: " << mesh->getNumberOfElements() );
+  FRENSIE_LOG_NOTIFICATION( "Mesh construction time (s): "
+                            << getElapsedTime( start_time ) );
+
+  // Create the histories
+  std::vector<std::vector<Subtrack> > histories;
+
+  createHistories( command_line_arguments["histories"].as<unsigned>(),
+                   command_line_arguments["subtracks_per_history"].as<unsigned>(),
+                   min_coord,
+                   max_coord,
+                   command_line_arguments["mean_free_path"].as<double>(),
+                   histories );
+
+  // Time the standard estimator
+  if( !command_line_arguments.count( "skip_standard" ) )
+  {
+    MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator
+      estimator( 0, 1.0, mesh );
+
+    const double time = timeEstimator( estimator, histories, threads );
+
+    FRENSIE_LOG_NOTIFICATION( "Standard mesh estimator time (s): " << time );
+    FRENSIE_LOG_NOTIFICATION( "Standard mesh estimator histories/s: "
+                              << histories.size()/time );
+  }
+
+  // Time the dense estimator
+  {
+    MonteCarlo::WeightMultipliedDenseMeshTrackLengthFluxEstimator
+      estimator( 1,
+                 1.0,
+                 mesh,
+                 command_line_arguments.count( "single_precision_second_moments" ) );
+
+    const double time = timeEstimator( estimator, histories, threads );
+
+    FRENSIE_LOG_NOTIFICATION( "Dense mesh estimator time (s): " << time );
+    FRENSIE_LOG_NOTIFICATION( "Dense mesh estimator histories/s: "
+                              << histories.size()/time );
+    FRENSIE_LOG_NOTIFICATION( "Dense mesh estimator element moments memory (MB): "
+                              << estimator.getElementMomentsMemoryFootprint()/1048576.0 );
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end mesh_tally_timer.cpp
+//---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <vector>
 #include <time.h>
 
 // Boost Scoped Pointer
@@ -23,6 +24,90 @@
 // Time macro
 #define TIME() (clock()/((double)CLOCKS_PER_SEC))
 
+// Counter-based generator timing function
+void timeCounterBasedGenerator( const int trial_size, const int histories = 1 )
+{
+  // Raw generator
+  Utility::PhiloxGenerator generator;
+
+  // Block of random numbers
+  std::vector<double> random_numbers( trial_size/histories );
+
+  Utility::RandomNumberGenerator::useCounterBasedGenerator();
+  Utility::RandomNumberGenerator::createStreams();
+
+  double time1 = TIME();
+
+  // Wrapped double generator timing
+  for( int i = 0; i < histories; ++i )
+  {
+    Utility::RandomNumberGenerator::initialize( i );
+
+    for( int j = 0; j < trial_size/histories; ++j )
+      Utility::RandomNumberGenerator::getRandomNumber<double>();
+  }
+
+  double time2 = TIME();
+
+  // Raw double generator timing
+  for( int i = 0; i < histories; ++i )
+  {
+    generator.changeHistory( i );
+
+    for( int j = 0; j < trial_size/histories; ++j )
+      generator.getRandomNumber();
+  }
+
+  double time3 = TIME();
+
+  // Wrapped block generator timing
+  for( int i = 0; i < histories; ++i )
+  {
+    Utility::RandomNumberGenerator::initialize( i );
+
+    Utility::RandomNumberGenerator::getRandomNumbers( random_numbers );
+  }
+
+  double time4 = TIME();
+
+  // Check for valid time intervals
+  if( time2 - time1 < 1.0e-15 || time3 - time2 < 1.0e-15 ||
+      time4 - time3 < 1.0e-15 )
+  {
+    std::cerr << "Timing information not accurate enough for this generator."
+	      << std::endl;
+  }
+  else
+  {
+    // Calculate the generation speed (Millions/sec)
+    double mdbls_per_sec_wrapped = trial_size/(time2-time1)/1e6;
+    double mdbls_per_sec_raw = trial_size/(time3-time2)/1e6;
+    double mdbls_per_sec_block = trial_size/(time4-time3)/1e6;
+
+    // Print the last double generated
+    std::cout << "Last random number generated: "
+	      << generator.getRandomNumber() << " "
+	      << random_numbers.back()
+	      << std::endl
+	      << "Random numbers per history: " << trial_size/histories
+	      << std::endl
+	      << "User + System time information (NOTE: MRS = Million Random "
+	      << "Numbers Per Second)\n" << std::endl
+	      << "  Wrapped Philox generator:\tTime = " << time2-time1
+	      << " seconds " << "=> " << mdbls_per_sec_wrapped
+	      << std::endl
+	      << "  Raw Philox generator:\t\tTime = " << time3-time2
+	      << " seconds " << "=> " << mdbls_per_sec_raw
+	      << std::endl
+	      << "  Block Philox generator:\tTime = " << time4-time3
+	      << " seconds " << "=> " << mdbls_per_sec_block
+	      << std::endl << std::endl;
+  }
+
+  Utility::RandomNumberGenerator::useLinearCongruentialGenerator();
+  Utility::RandomNumberGenerator::createStreams();
+}
+
 // Generator timing function
 void timeGenerator( const int trial_size, const int histories = 1 )
 {
@@ -96,15 +181,19 @@ int main()
 
   std::cout << "Timing generator for single history" << std::endl;
   timeGenerator( trial_size );
+  timeCounterBasedGenerator( trial_size );
 
   std::cout << "Timing generator for 10 histories" << std::endl;
   timeGenerator( trial_size, 10 );
+  timeCounterBasedGenerator( trial_size, 10 );
 
   std::cout << "Timing generator for 100 histories" << std::endl;
   timeGenerator( trial_size, 100 );
+  timeCounterBasedGenerator( trial_size, 100 );
 
   std::cout << "Timing generator for 1000 histories" << std::endl;
   timeGenerator( trial_size, 1000 );
+  timeCounterBasedGenerator( trial_size, 1000 );
 
   return 0;
 }